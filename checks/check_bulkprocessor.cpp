@@ -0,0 +1,194 @@
+#include "rts2fits/bulkprocessor.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+
+#include <check.h>
+#include <check_utils.h>
+
+#define ITEMS 50
+
+static char checkpointname[] = "/tmp/check_bulkprocessorXXXXXX";
+
+// processor recording processed items, items with failing IDs fail
+class TestProcessor:public rts2image::BulkProcessor
+{
+	public:
+		TestProcessor (int failEvery = 0, bool failCommit = false)
+		{
+			this->failEvery = failEvery;
+			this->failCommit = failCommit;
+			pthread_mutex_init (&mutex, NULL);
+			setThreads (4);
+			setBatchSize (7);
+			setReportInterval (0);
+			for (int i = 0; i < ITEMS; i++)
+			{
+				char path[50];
+				snprintf (path, 50, "/data/img%03d.fits", i);
+				addItem (path, i);
+			}
+		}
+
+		~TestProcessor () { pthread_mutex_destroy (&mutex); }
+
+		std::map <std::string, int> processed;
+		std::set <std::string> committed;
+
+	protected:
+		virtual void processItem (rts2image::BulkItem *item, int worker)
+		{
+			IOSlot io (this);
+			pthread_mutex_lock (&mutex);
+			processed[item->path]++;
+			pthread_mutex_unlock (&mutex);
+			if (failEvery > 0 && item->id % failEvery == 0)
+			{
+				item->status = -1;
+				item->message = "failed";
+			}
+		}
+
+		virtual int commitItems (std::vector <rts2image::BulkItem *> &batch)
+		{
+			if (failCommit)
+				return -1;
+			for (std::vector <rts2image::BulkItem *>::iterator iter = batch.begin (); iter != batch.end (); iter++)
+			{
+				if ((*iter)->status == 0)
+					committed.insert ((*iter)->path);
+			}
+			return 0;
+		}
+
+	private:
+		int failEvery;
+		bool failCommit;
+		pthread_mutex_t mutex;
+};
+
+void setup_bulkprocessor (void)
+{
+	int fd = mkstemp (checkpointname);
+	ck_assert_msg (fd >= 0, "cannot create temporary file");
+	close (fd);
+}
+
+void teardown_bulkprocessor (void)
+{
+	unlink (checkpointname);
+	strcpy (checkpointname + strlen (checkpointname) - 6, "XXXXXX");
+}
+
+static std::set <std::string> readCheckpoint ()
+{
+	std::set <std::string> ret;
+	std::ifstream ifs (checkpointname);
+	std::string line;
+	while (std::getline (ifs, line))
+		ret.insert (line);
+	return ret;
+}
+
+START_TEST(process_all)
+{
+	TestProcessor tp;
+	ck_assert_int_eq (tp.run (), 0);
+	ck_assert_int_eq (tp.processed.size (), ITEMS);
+	ck_assert_int_eq (tp.committed.size (), ITEMS);
+	for (std::map <std::string, int>::iterator iter = tp.processed.begin (); iter != tp.processed.end (); iter++)
+		ck_assert_msg (iter->second == 1, "%s processed %d times", iter->first.c_str (), iter->second);
+}
+END_TEST
+
+START_TEST(checkpoint_resume)
+{
+	// every 7th item fails
+	{
+		TestProcessor tp (7);
+		ck_assert_int_eq (tp.setCheckpoint (checkpointname), 0);
+		ck_assert_int_eq (tp.run (), 8);
+		ck_assert_int_eq (tp.processed.size (), ITEMS);
+	}
+
+	std::set <std::string> cp = readCheckpoint ();
+	ck_assert_int_eq (cp.size (), ITEMS - 8);
+	ck_assert_msg (cp.find ("/data/img007.fits") == cp.end (), "failed item is in checkpoint");
+	ck_assert_msg (cp.find ("/data/img008.fits") != cp.end (), "processed item is not in checkpoint");
+
+	// only failed items are processed again
+	TestProcessor tp;
+	ck_assert_int_eq (tp.setCheckpoint (checkpointname), 0);
+	ck_assert_int_eq (tp.run (), 0);
+	ck_assert_int_eq (tp.processed.size (), 8);
+	for (int i = 0; i < ITEMS; i += 7)
+	{
+		char path[50];
+		snprintf (path, 50, "/data/img%03d.fits", i);
+		ck_assert_msg (tp.processed.find (path) != tp.processed.end (), "%s was not processed again", path);
+	}
+	ck_assert_int_eq (readCheckpoint ().size (), ITEMS);
+
+	// nothing left to process
+	TestProcessor tp2;
+	ck_assert_int_eq (tp2.setCheckpoint (checkpointname), 0);
+	ck_assert_int_eq (tp2.run (), 0);
+	ck_assert_int_eq (tp2.processed.size (), 0);
+}
+END_TEST
+
+START_TEST(failed_commit)
+{
+	{
+		TestProcessor tp (0, true);
+		ck_assert_int_eq (tp.setCheckpoint (checkpointname), 0);
+		ck_assert_int_eq (tp.run (), ITEMS);
+	}
+	// items which were not committed are not recorded
+	ck_assert_int_eq (readCheckpoint ().size (), 0);
+
+	TestProcessor tp;
+	ck_assert_int_eq (tp.setCheckpoint (checkpointname), 0);
+	ck_assert_int_eq (tp.run (), 0);
+	ck_assert_int_eq (tp.processed.size (), ITEMS);
+}
+END_TEST
+
+Suite * bulkprocessor_suite (void)
+{
+	Suite *s;
+	TCase *tc_bulk;
+
+	s = suite_create ("BulkProcessor");
+	tc_bulk = tcase_create ("Parallel resumable processing");
+
+	tcase_add_checked_fixture (tc_bulk, setup_bulkprocessor, teardown_bulkprocessor);
+	tcase_add_test (tc_bulk, process_all);
+	tcase_add_test (tc_bulk, checkpoint_resume);
+	tcase_add_test (tc_bulk, failed_commit);
+	suite_add_tcase (s, tc_bulk);
+
+	return s;
+}
+
+int main (void)
+{
+	int number_failed;
+	Suite *s;
+	SRunner *sr;
+
+	s = bulkprocessor_suite ();
+	sr = srunner_create (s);
+	srunner_run_all (sr, CK_NORMAL);
+	number_failed = srunner_ntests_failed (sr);
+	srunner_free (sr);
+
+	return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,343 @@
+#include "rts2fits/calibcombine.h"
+#include "rts2fits/parallel.h"
+#include "imghdr.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <iostream>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <check.h>
+#include <check_utils.h>
+
+static char tmpdir[] = "/tmp/check_calibcombineXXXXXX";
+static std::vector <std::string> files;
+
+void setup_calibcombine (void)
+{
+	ck_assert_msg (mkdtemp (tmpdir) != NULL, "cannot create temporary directory");
+	files.clear ();
+}
+
+void teardown_calibcombine (void)
+{
+	for (std::vector <std::string>::iterator iter = files.begin (); iter != files.end (); iter++)
+		unlink (iter->c_str ());
+	rmdir (tmpdir);
+	strcpy (tmpdir + strlen (tmpdir) - 6, "XXXXXX");
+}
+
+// write frame of given FITS type, returns file name
+static const char *writeFrame (int bitpix, long w, long h, const double *data, double exposure = 10)
+{
+	char fn[100];
+	snprintf (fn, 100, "%s/frame%03d.fits", tmpdir, (int) files.size ());
+	files.push_back (std::string (fn));
+
+	fitsfile *fptr;
+	int status = 0;
+	long naxes[2] = {w, h};
+	long fpixel[2] = {1, 1};
+	fits_create_file (&fptr, fn, &status);
+	fits_create_img (fptr, bitpix, 2, naxes, &status);
+	fits_write_key_dbl (fptr, (char *) "EXPTIME", exposure, 3, (char *) "exposure time", &status);
+	fits_write_pix (fptr, TDOUBLE, fpixel, w * h, (void *) data, &status);
+	fits_close_file (fptr, &status);
+	ck_assert_int_eq (status, 0);
+	return files.back ().c_str ();
+}
+
+START_TEST(median_types)
+{
+	// all RTS2_DATA types, values fit to byte
+	int types[] = {RTS2_DATA_BYTE, RTS2_DATA_SHORT, RTS2_DATA_LONG, RTS2_DATA_LONGLONG, RTS2_DATA_FLOAT, RTS2_DATA_DOUBLE, RTS2_DATA_SBYTE, RTS2_DATA_USHORT, RTS2_DATA_ULONG};
+	int n = sizeof (types) / sizeof (types[0]);
+	long w = 301, h = 47;
+
+	srand (1);
+	std::vector <std::vector <double> > data (n, std::vector <double> (w * h));
+
+	rts2image::CalibCombine median;
+	rts2image::CalibCombine mean;
+	mean.setMethod (rts2image::COMBINE_MEAN);
+	// force many strips
+	median.setThreads (3);
+	median.setMemoryLimit (3 * n * w * sizeof (float) * 4);
+
+	for (int i = 0; i < n; i++)
+	{
+		for (long p = 0; p < w * h; p++)
+			data[i][p] = 1 + rand () % 120;
+		const char *fn = writeFrame (types[i], w, h, &data[i][0]);
+		ck_assert_int_eq (median.addFrame (fn), 0);
+		ck_assert_int_eq (mean.addFrame (fn), 0);
+	}
+
+	ck_assert_msg (median.getStripRows () < 5, "too many rows per strip: %ld", median.getStripRows ());
+
+	std::vector <float> outMedian (w * h);
+	std::vector <float> outMean (w * h);
+	ck_assert_int_eq (median.combine (&outMedian[0]), 0);
+	ck_assert_int_eq (mean.combine (&outMean[0]), 0);
+
+	for (long p = 0; p < w * h; p++)
+	{
+		std::vector <double> v;
+		double sum = 0;
+		for (int i = 0; i < n; i++)
+		{
+			v.push_back (data[i][p]);
+			sum += data[i][p];
+		}
+		std::sort (v.begin (), v.end ());
+		ck_assert_dbl_eq (outMedian[p], v[n / 2], 1e-5);
+		ck_assert_dbl_eq (outMean[p], sum / n, 1e-3);
+	}
+}
+END_TEST
+
+START_TEST(median_network)
+{
+	long w = 17, h = 5;
+	std::vector <double> data (w * h);
+
+	rts2image::CalibCombine combine;
+	srand (2);
+	std::vector <std::vector <double> > frames;
+	for (int n = 1; n <= 40; n++)
+	{
+		for (long p = 0; p < w * h; p++)
+			data[p] = rand () % 1000;
+		frames.push_back (data);
+		ck_assert_int_eq (combine.addFrame (writeFrame (FLOAT_IMG, w, h, &data[0])), 0);
+
+		std::vector <float> out (w * h);
+		ck_assert_int_eq (combine.combine (&out[0]), 0);
+		for (long p = 0; p < w * h; p++)
+		{
+			std::vector <double> v;
+			for (int i = 0; i < n; i++)
+				v.push_back (frames[i][p]);
+			std::sort (v.begin (), v.end ());
+			ck_assert_dbl_eq (out[p], (v[(n - 1) / 2] + v[n / 2]) / 2, 1e-3);
+		}
+	}
+	// pruned network must be smaller than full sorting network
+	ck_assert_msg (combine.getMedianNetworkSize () < combine.getSortNetworkSize (), "median network is not pruned: %d %d", (int) combine.getMedianNetworkSize (), (int) combine.getSortNetworkSize ());
+}
+END_TEST
+
+START_TEST(sigma_clip)
+{
+	long w = 64, h = 32;
+	int n = 15;
+	std::vector <double> data (w * h);
+
+	rts2image::CalibCombine combine;
+	combine.setMethod (rts2image::COMBINE_SIGMA);
+
+	srand (3);
+	for (int i = 0; i < n; i++)
+	{
+		for (long p = 0; p < w * h; p++)
+		{
+			// uniform noise with mean 1000, cosmic rays in every second frame
+			data[p] = 995 + rand () % 11;
+			if (i % 2 && p % 7 == i % 7)
+				data[p] += 20000;
+		}
+		ck_assert_int_eq (combine.addFrame (writeFrame (USHORT_IMG, w, h, &data[0])), 0);
+	}
+
+	std::vector <float> out (w * h);
+	ck_assert_int_eq (combine.combine (&out[0]), 0);
+	for (long p = 0; p < w * h; p++)
+		ck_assert_dbl_eq (out[p], 1000, 5);
+}
+END_TEST
+
+START_TEST(normalize_flat)
+{
+	long w = 128, h = 100;
+	std::vector <double> data (w * h);
+
+	rts2image::CalibCombine combine;
+	combine.setNormalize (true);
+
+	double levels[] = {10000, 20000, 15000, 30000, 25000};
+	for (int i = 0; i < 5; i++)
+	{
+		// vignetting - level falls to 80% at the edges
+		for (long y = 0; y < h; y++)
+			for (long x = 0; x < w; x++)
+				data[y * w + x] = floor (levels[i] * (1 - 0.2 * fabs (x - w / 2.0) / (w / 2.0)));
+		ck_assert_int_eq (combine.addFrame (writeFrame (LONG_IMG, w, h, &data[0])), 0);
+	}
+
+	std::vector <float> out (w * h);
+	ck_assert_int_eq (combine.combine (&out[0]), 0);
+	for (int i = 0; i < 5; i++)
+		ck_assert_dbl_eq (combine.getScale (i), 1 / (levels[i] * 0.9), 0.02 / levels[i]);
+	// the same shape with unity median
+	for (long x = 0; x < w; x++)
+		ck_assert_dbl_eq (out[h / 2 * w + x], (1 - 0.2 * fabs (x - w / 2.0) / (w / 2.0)) / 0.9, 0.01);
+}
+END_TEST
+
+START_TEST(write_master)
+{
+	long w = 40, h = 30;
+	std::vector <double> data (w * h);
+
+	rts2image::CalibCombine combine;
+	for (int i = 0; i < 3; i++)
+	{
+		for (long p = 0; p < w * h; p++)
+			data[p] = 100 + i + p;
+		ck_assert_int_eq (combine.addFrame (writeFrame (SHORT_IMG, w, h, &data[0], 5 + i)), 0);
+	}
+
+	std::string fn = std::string (tmpdir) + "/master.fits";
+	ck_assert_int_eq (combine.combine (fn.c_str ()), 0);
+	files.push_back (fn);
+
+	fitsfile *fptr;
+	int status = 0;
+	int bitpix;
+	long ncombine;
+	double exposure;
+	long fpixel[2] = {1, 1};
+	std::vector <float> out (w * h);
+	fits_open_image (&fptr, fn.c_str (), READONLY, &status);
+	fits_get_img_type (fptr, &bitpix, &status);
+	fits_read_key_lng (fptr, (char *) "NCOMBINE", &ncombine, NULL, &status);
+	fits_read_key_dbl (fptr, (char *) "EXPTIME", &exposure, NULL, &status);
+	fits_read_pix (fptr, TFLOAT, fpixel, w * h, NULL, &out[0], NULL, &status);
+	fits_close_file (fptr, &status);
+
+	ck_assert_int_eq (status, 0);
+	ck_assert_int_eq (bitpix, FLOAT_IMG);
+	ck_assert_int_eq (ncombine, 3);
+	ck_assert_dbl_eq (exposure, 6, 1e-6);
+	for (long p = 0; p < w * h; p++)
+		ck_assert_dbl_eq (out[p], 101 + p, 1e-6);
+}
+END_TEST
+
+START_TEST(nan_pixels)
+{
+	long w = 33, h = 4;
+	int n = 7;
+	std::vector <double> data (w * h);
+
+	rts2image::combine_method_t methods[] = {rts2image::COMBINE_MEDIAN, rts2image::COMBINE_SIGMA, rts2image::COMBINE_MEAN};
+	rts2image::CalibCombine combine[3];
+	for (int m = 0; m < 3; m++)
+		combine[m].setMethod (methods[m]);
+
+	for (int i = 0; i < n; i++)
+	{
+		// every 5th pixel is NaN in one of the frames
+		for (long p = 0; p < w * h; p++)
+			data[p] = (p % 5 == 0 && p % n == i) ? NAN : 100 + i;
+		const char *fn = writeFrame (FLOAT_IMG, w, h, &data[0]);
+		for (int m = 0; m < 3; m++)
+			ck_assert_int_eq (combine[m].addFrame (fn), 0);
+	}
+
+	std::vector <float> out (w * h);
+	for (int m = 0; m < 3; m++)
+	{
+		ck_assert_int_eq (combine[m].combine (&out[0]), 0);
+		for (long p = 0; p < w * h; p++)
+		{
+			if (p % 5 == 0)
+				ck_assert_msg (isnan (out[p]), "pixel %ld is %f, method %d", p, out[p], m);
+			else
+				ck_assert_dbl_eq (out[p], 103, 1e-4);
+		}
+	}
+}
+END_TEST
+
+// 50 frames of 512x512 pixels; set RTS2_CHECK_COMBINE_SIZE=4096 for full size benchmark
+START_TEST(benchmark)
+{
+	long size = 512;
+	if (getenv ("RTS2_CHECK_COMBINE_SIZE"))
+		size = atol (getenv ("RTS2_CHECK_COMBINE_SIZE"));
+	int n = 50;
+
+	std::vector <double> data (size * size);
+	srand (4);
+	for (int i = 0; i < n; i++)
+	{
+		for (long p = 0; p < size * size; p++)
+			data[p] = 1000 + rand () % 100;
+		writeFrame (USHORT_IMG, size, size, &data[0]);
+	}
+
+	size_t memoryLimit = 256 * 1024 * 1024;
+	std::vector <float> out (size * size);
+	rts2image::combine_method_t methods[] = {rts2image::COMBINE_MEDIAN, rts2image::COMBINE_SIGMA, rts2image::COMBINE_MEAN};
+	const char *names[] = {"median", "sigma clipped mean", "mean"};
+	for (int m = 0; m < 3; m++)
+	{
+		rts2image::CalibCombine combine;
+		combine.setMethod (methods[m]);
+		combine.setMemoryLimit (memoryLimit);
+		for (std::vector <std::string>::iterator iter = files.begin (); iter != files.end (); iter++)
+			ck_assert_int_eq (combine.addFrame (iter->c_str ()), 0);
+
+		ck_assert_int_eq (combine.combine (&out[0]), 0);
+
+		int threads = rts2image::parallelThreads (0);
+		size_t buffers = threads * n * combine.getStripRows () * size * sizeof (float);
+		ck_assert_msg (buffers <= memoryLimit, "strip buffers %ld are above memory limit", (long) buffers);
+		std::cout << names[m] << " of " << n << " frames " << size << "x" << size << " took " << combine.getCombineTime () << " s, "
+			<< (n * size * size / combine.getCombineTime () / 1e6) << " Mpix/s, " << threads << " threads, " << combine.getStripRows () << " rows per strip" << std::endl;
+	}
+}
+END_TEST
+
+Suite * calibcombine_suite (void)
+{
+	Suite *s;
+	TCase *tc_combine;
+
+	s = suite_create ("CalibCombine");
+	tc_combine = tcase_create ("Calibration frames combination");
+
+	tcase_add_checked_fixture (tc_combine, setup_calibcombine, teardown_calibcombine);
+	tcase_add_test (tc_combine, median_types);
+	tcase_add_test (tc_combine, median_network);
+	tcase_add_test (tc_combine, sigma_clip);
+	tcase_add_test (tc_combine, normalize_flat);
+	tcase_add_test (tc_combine, write_master);
+	tcase_add_test (tc_combine, nan_pixels);
+	tcase_add_test (tc_combine, benchmark);
+	tcase_set_timeout (tc_combine, 600);
+	suite_add_tcase (s, tc_combine);
+
+	return s;
+}
+
+int main (void)
+{
+	int number_failed;
+	Suite *s;
+	SRunner *sr;
+
+	s = calibcombine_suite ();
+	sr = srunner_create (s);
+	srunner_run_all (sr, CK_NORMAL);
+	number_failed = srunner_ntests_failed (sr);
+	srunner_free (sr);
+
+	return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
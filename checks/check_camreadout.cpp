@@ -0,0 +1,119 @@
+#include "camd.h"
+#include "taplayout.h"
+
+#include <stdint.h>
+#include <vector>
+
+#include <check.h>
+#include <check_utils.h>
+
+#define CAM_WIDTH  64
+#define CAM_HEIGHT 16
+#define CAM_TAPS   4
+
+// camera reading line interleaved taps to data buffers, as multi-tap drivers do
+class TapCamera:public rts2camd::Camera
+{
+	public:
+		TapCamera ():rts2camd::Camera (0, NULL)
+		{
+			createDataChannels ();
+			setNumChannels (CAM_TAPS);
+			dataChannels->setValueInteger (CAM_TAPS);
+			setSize (CAM_WIDTH, CAM_HEIGHT, 0, 0);
+
+			// rows of taps follow each other, pixel value encodes tap, row and column
+			raw.resize (CAM_WIDTH * CAM_HEIGHT * CAM_TAPS);
+			for (int y = 0; y < CAM_HEIGHT; y++)
+				for (int t = 0; t < CAM_TAPS; t++)
+					for (int x = 0; x < CAM_WIDTH; x++)
+						raw[(y * CAM_TAPS + t) * CAM_WIDTH + x] = t * 10000 + y * 100 + x;
+			sent.resize (CAM_TAPS, NULL);
+		}
+
+		virtual int startExposure () { return 0; }
+
+		virtual int doReadout ()
+		{
+			rts2camd::TapLayout layout;
+			layout.setTaps (getUsedChannels ());
+			layout.setInterleave (rts2camd::TAP_LINE);
+
+			std::vector <void *> dst;
+			for (int j = 0; j < getUsedChannels (); j++)
+				dst.push_back (getDataBuffer (j));
+			if (layout.extractAll (&raw[0], raw.size () * 2, getUsedWidth (), getUsedHeight (), &(dst[0])) != getUsedHeight ())
+				return -1;
+
+			for (int j = 0; j < getUsedChannels (); j++)
+			{
+				sent[j] = (uint16_t *) dst[j];
+				if (sendReadoutData ((char *) dst[j], getUsedWidth () * getUsedHeight () * 2, j) < 0)
+					return -1;
+			}
+			return -2;
+		}
+
+		std::vector <uint16_t> raw;
+		std::vector <uint16_t *> sent;
+};
+
+START_TEST(readout_taps)
+{
+	TapCamera camera;
+	ck_assert_int_eq (camera.initValues (), 0);
+	ck_assert_int_eq (camera.doReadout (), -2);
+
+	for (int t = 0; t < CAM_TAPS; t++)
+	{
+		ck_assert_msg (camera.sent[t] != NULL, "data buffer of channel %d is NULL", t);
+		for (int y = 0; y < CAM_HEIGHT; y++)
+			for (int x = 0; x < CAM_WIDTH; x++)
+				ck_assert_int_eq (camera.sent[t][y * CAM_WIDTH + x], t * 10000 + y * 100 + x);
+	}
+	// channels must not share buffer
+	ck_assert_msg (camera.sent[0] != camera.sent[1], "channels share data buffer");
+}
+END_TEST
+
+START_TEST(layout_order)
+{
+	rts2camd::TapLayout layout;
+	ck_assert_int_eq (layout.parse ("taps=4 order=0,1,3,2"), 0);
+	// order must be permutation of taps
+	ck_assert_int_eq (layout.parse ("taps=2 order=0,0"), -1);
+	ck_assert_int_eq (layout.parse ("taps=3 order=0,1"), -1);
+	ck_assert_int_eq (layout.parse ("taps=2 order=0,2"), -1);
+}
+END_TEST
+
+Suite * camreadout_suite (void)
+{
+	Suite *s;
+	TCase *tc_readout;
+
+	s = suite_create ("CamReadout");
+	tc_readout = tcase_create ("Readout of multi-tap cameras");
+
+	tcase_add_test (tc_readout, readout_taps);
+	tcase_add_test (tc_readout, layout_order);
+
+	suite_add_tcase (s, tc_readout);
+
+	return s;
+}
+
+int main (void)
+{
+	int number_failed;
+	Suite *s;
+	SRunner *sr;
+
+	s = camreadout_suite ();
+	sr = srunner_create (s);
+	srunner_run_all (sr, CK_NORMAL);
+	number_failed = srunner_ntests_failed (sr);
+	srunner_free (sr);
+
+	return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
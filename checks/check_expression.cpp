@@ -0,0 +1,95 @@
+#include "expression.h"
+#include "bytecode.h"
+
+#include <check.h>
+#include <check_utils.h>
+
+void setup_expression (void)
+{
+}
+
+void teardown_expression (void)
+{
+}
+
+// evaluate expression both as tree and as bytecode
+static double evaluate (const char *str)
+{
+	rts2expression::Expression *exp = parseExpression (str);
+	rts2expression::Bytecode bc;
+	exp->compile (bc);
+	double ret = exp->evaluate ();
+	ck_assert_msg (bc.evaluate () == ret, "tree and bytecode of %s differ", str);
+	delete exp;
+	return ret;
+}
+
+START_TEST(expression_numbers)
+{
+	ck_assert_dbl_eq (evaluate ("1 < 2"), 1, 1e-10);
+	ck_assert_dbl_eq (evaluate ("2.5 == 2.50"), 1, 1e-10);
+	ck_assert_dbl_eq (evaluate ("1 < 2 and 3 >= 4"), 0, 1e-10);
+	ck_assert_dbl_eq (evaluate ("1 < 2 and 3 >= 4 or 5 != 6"), 1, 1e-10);
+}
+END_TEST
+
+START_TEST(expression_negative)
+{
+	ck_assert_dbl_eq (evaluate ("-20 < 10"), 1, 1e-10);
+	ck_assert_dbl_eq (evaluate ("10 > -20"), 1, 1e-10);
+	ck_assert_dbl_eq (evaluate ("-20 > -10.5"), 0, 1e-10);
+	ck_assert_dbl_eq (evaluate ("-0.25 == -0.250 and 3 > -3"), 1, 1e-10);
+}
+END_TEST
+
+START_TEST(expression_errors)
+{
+	const char *invalid[] = {"1 <", "< 2", "1 < 2 and", "1.2.3 < 4", "1a < 2", "temperature < 2", ""};
+	for (size_t i = 0; i < sizeof (invalid) / sizeof (invalid[0]); i++)
+	{
+		bool thrown = false;
+		try
+		{
+			delete parseExpression (invalid[i]);
+		}
+		catch (rts2core::Error &er)
+		{
+			thrown = true;
+		}
+		ck_assert_msg (thrown, "expression %s was parsed", invalid[i]);
+	}
+}
+END_TEST
+
+Suite * expression_suite (void)
+{
+	Suite *s;
+	TCase *tc_expression;
+
+	s = suite_create ("Expression");
+	tc_expression = tcase_create ("Expression parsing");
+
+	tcase_add_checked_fixture (tc_expression, setup_expression, teardown_expression);
+	tcase_add_test (tc_expression, expression_numbers);
+	tcase_add_test (tc_expression, expression_negative);
+	tcase_add_test (tc_expression, expression_errors);
+
+	suite_add_tcase (s, tc_expression);
+
+	return s;
+}
+
+int main (void)
+{
+	int number_failed;
+	Suite *s;
+	SRunner *sr;
+
+	s = expression_suite ();
+	sr = srunner_create (s);
+	srunner_run_all (sr, CK_NORMAL);
+	number_failed = srunner_ntests_failed (sr);
+	srunner_free (sr);
+
+	return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,187 @@
+#include "rts2fits/fitsheader.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+
+#include <check.h>
+#include <check_utils.h>
+
+static char fitsname[] = "/tmp/check_fitsheaderXXXXXX";
+
+void setup_fitsheader (void)
+{
+	int fd = mkstemp (fitsname);
+	ck_assert_msg (fd >= 0, "cannot create temporary file");
+	close (fd);
+}
+
+void teardown_fitsheader (void)
+{
+	unlink (fitsname);
+	strcpy (fitsname + strlen (fitsname) - 6, "XXXXXX");
+}
+
+// append card padded to 80 characters
+static void addCard (std::string &header, const char *card)
+{
+	std::string c (card);
+	c.resize (80, ' ');
+	header += c;
+}
+
+// write header, padded to 2880 bytes blocks, followed by dataSize bytes
+static void writeFile (std::string header, size_t dataSize)
+{
+	header.resize (((header.length () + 2879) / 2880) * 2880, ' ');
+	header.resize (header.length () + dataSize, '\0');
+	FILE *f = fopen (fitsname, "w");
+	ck_assert_msg (f != NULL, "cannot open %s", fitsname);
+	ck_assert_int_eq (fwrite (header.data (), 1, header.length (), f), header.length ());
+	fclose (f);
+}
+
+START_TEST(header_cards)
+{
+	std::string header;
+	addCard (header, "SIMPLE  =                    T / conforms to FITS standard");
+	addCard (header, "BITPIX  =                   16");
+	addCard (header, "NAXIS   =                    2");
+	addCard (header, "NAXIS1  =                  100");
+	addCard (header, "NAXIS2  =                   50");
+	addCard (header, "OBJECT  = 'M 31 ''core''  '     / object name");
+	addCard (header, "EXPOSURE=                 12.5 / [s] exposure time");
+	addCard (header, "GAIN    =              1.25D-1");
+	addCard (header, "COMMENT = this is not a value");
+	addCard (header, "HISTORY   image was created by test");
+	addCard (header, "FILTER  = 'R'");
+	addCard (header, "NOTNUM  = 'abc'");
+	// header spans two blocks
+	for (int i = 0; i < 30; i++)
+	{
+		char card[81];
+		snprintf (card, 81, "KEY%-5d= %20d", i, i);
+		addCard (header, card);
+	}
+	addCard (header, "FILTER  = 'V'");
+	addCard (header, "END");
+	writeFile (header, 100 * 50 * 2);
+
+	rts2image::FitsHeader fh;
+	ck_assert_int_eq (fh.load (fitsname), 0);
+
+	ck_assert_str_eq (fh.getString ("SIMPLE"), "T");
+	ck_assert_str_eq (fh.getString ("OBJECT"), "M 31 'core'");
+	// the last value of repeated keyword is kept
+	ck_assert_str_eq (fh.getString ("FILTER"), "V");
+	ck_assert_msg (!fh.hasKey ("COMMENT"), "COMMENT card was parsed");
+	ck_assert_msg (!fh.hasKey ("HISTORY"), "HISTORY card was parsed");
+	ck_assert_msg (fh.getString ("MISSING") == NULL, "missing key has value");
+
+	long l;
+	ck_assert_int_eq (fh.getInteger ("NAXIS1", l), 0);
+	ck_assert_int_eq (l, 100);
+	ck_assert_int_eq (fh.getInteger ("KEY29", l), 0);
+	ck_assert_int_eq (l, 29);
+	ck_assert_int_eq (fh.getInteger ("NOTNUM", l), -1);
+	ck_assert_int_eq (fh.getInteger ("MISSING", l), -1);
+
+	double d;
+	ck_assert_int_eq (fh.getDouble ("EXPOSURE", d), 0);
+	ck_assert_dbl_eq (d, 12.5, 1e-10);
+	ck_assert_int_eq (fh.getDouble ("GAIN", d), 0);
+	ck_assert_dbl_eq (d, 0.125, 1e-10);
+	ck_assert_int_eq (fh.getDouble ("OBJECT", d), -1);
+}
+END_TEST
+
+START_TEST(hdu_size)
+{
+	std::string header;
+	addCard (header, "SIMPLE  =                    T");
+	addCard (header, "BITPIX  =                  -32");
+	addCard (header, "NAXIS   =                    2");
+	addCard (header, "NAXIS1  =                  100");
+	addCard (header, "NAXIS2  =                   50");
+	addCard (header, "END");
+	writeFile (header, 100 * 50 * 4);
+
+	rts2image::FitsHeader fh;
+	ck_assert_int_eq (fh.getHDUSize (), 0);
+	ck_assert_int_eq (fh.load (fitsname), 0);
+	ck_assert_int_eq (fh.getHeaderSize (), 2880);
+	// 20000 bytes of data are padded to 7 blocks
+	ck_assert_int_eq (fh.getHDUSize (), 2880 * 8);
+
+	// header without data
+	header.clear ();
+	addCard (header, "SIMPLE  =                    T");
+	addCard (header, "BITPIX  =                    8");
+	addCard (header, "NAXIS   =                    0");
+	addCard (header, "END");
+	writeFile (header, 0);
+	ck_assert_int_eq (fh.load (fitsname), 0);
+	ck_assert_int_eq (fh.getHDUSize (), 2880);
+}
+END_TEST
+
+START_TEST(invalid_files)
+{
+	rts2image::FitsHeader fh;
+	ck_assert_int_eq (fh.load ("/nonexistent/file.fits"), -1);
+
+	// not a FITS file
+	std::string header;
+	addCard (header, "BITPIX  =                   16");
+	addCard (header, "END");
+	writeFile (header, 0);
+	ck_assert_int_eq (fh.load (fitsname), -1);
+	ck_assert_int_eq (fh.getHDUSize (), 0);
+
+	// END card is missing
+	header.clear ();
+	addCard (header, "SIMPLE  =                    T");
+	writeFile (header, 0);
+	ck_assert_int_eq (fh.load (fitsname), -1);
+
+	// truncated block
+	FILE *f = fopen (fitsname, "w");
+	fputs ("SIMPLE  =                    T", f);
+	fclose (f);
+	ck_assert_int_eq (fh.load (fitsname), -1);
+}
+END_TEST
+
+Suite * fitsheader_suite (void)
+{
+	Suite *s;
+	TCase *tc_header;
+
+	s = suite_create ("FitsHeader");
+	tc_header = tcase_create ("FITS header reading");
+
+	tcase_add_checked_fixture (tc_header, setup_fitsheader, teardown_fitsheader);
+	tcase_add_test (tc_header, header_cards);
+	tcase_add_test (tc_header, hdu_size);
+	tcase_add_test (tc_header, invalid_files);
+	suite_add_tcase (s, tc_header);
+
+	return s;
+}
+
+int main (void)
+{
+	int number_failed;
+	Suite *s;
+	SRunner *sr;
+
+	s = fitsheader_suite ();
+	sr = srunner_create (s);
+	srunner_run_all (sr, CK_NORMAL);
+	number_failed = srunner_ntests_failed (sr);
+	srunner_free (sr);
+
+	return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
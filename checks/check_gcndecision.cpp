@@ -0,0 +1,127 @@
+#include "gcndecision.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <check.h>
+#include <check_utils.h>
+
+using namespace rts2grbd;
+
+struct notice
+{
+	int type;
+	double ra;
+	double dec;
+	float errorbox;
+};
+
+// replay notices of a single GRB as grbd does, returns number of executor notifications
+static int replay (const notice *notices, int n, int grb_type_start, int grb_id, double gbm_error, bool execFollowups)
+{
+	bool known = false;
+	float errorbox = NAN;
+	int notified = 0;
+	for (int i = 0; i < n; i++)
+	{
+		GcnDecision d = decideGcn (known, errorbox, true, true, notices[i].ra, notices[i].dec, true, notices[i].errorbox);
+		if (!known || d.updateGrb)
+			errorbox = notices[i].errorbox;
+		known = true;
+		if (followGcn (d, grb_type_start, grb_id, gbm_error, execFollowups))
+			notified++;
+	}
+	return notified;
+}
+
+// Swift BAT burst; BAT follow-up notices carry instrument errorbox, which is larger than the BAT position errorbox
+static const notice swiftBat[] = {
+	{TYPE_SWIFT_BAT_GRB_POS_ACK_SRC, 123.4567, -12.3456, 0.05},
+	{TYPE_SWIFT_BAT_GRB_LC_SRC, 123.4567, -12.3456, 4.0 / 60.0},
+	{TYPE_SWIFT_FOM_2OBSAT_SRC, 123.4567, -12.3456, 4.0 / 60.0},
+	{TYPE_SWIFT_FOSC_2OBSAT_SRC, 123.4567, -12.3456, 4.0 / 60.0},
+	{TYPE_SWIFT_BAT_GRB_LC_PROC_SRC, 123.4567, -12.3456, 4.0 / 60.0}
+};
+
+START_TEST(swift_followups)
+{
+	int n = sizeof (swiftBat) / sizeof (swiftBat[0]);
+	// ignored follow-up notices do not notify executor again
+	ck_assert_int_eq (replay (swiftBat, n, TYPE_SWIFT_BAT_GRB_ALERT_SRC, 12345, 0, false), 1);
+	ck_assert_int_eq (replay (swiftBat, n, TYPE_SWIFT_BAT_GRB_ALERT_SRC, 12345, 0, true), n);
+
+	// XRT position is better, executor is notified about it
+	notice withXrt[6];
+	for (int i = 0; i < n; i++)
+		withXrt[i] = swiftBat[i];
+	withXrt[n].type = TYPE_SWIFT_XRT_POSITION_SRC;
+	withXrt[n].ra = 123.4512;
+	withXrt[n].dec = -12.3401;
+	withXrt[n].errorbox = 5.0 / 3600.0;
+	ck_assert_int_eq (replay (withXrt, n + 1, TYPE_SWIFT_BAT_GRB_ALERT_SRC, 12345, 0, false), 2);
+}
+END_TEST
+
+START_TEST(ignored_errorbox)
+{
+	// ignored notice is reported without errorbox, stored errorbox is kept
+	GcnDecision d = decideGcn (true, 0.05, true, true, 10, 20, true, 0.1);
+	ck_assert_msg (!d.updateTarget, "target updated by worse errorbox");
+	ck_assert_msg (isnan (d.noticeErrorbox), "ignored notice has errorbox %f", d.noticeErrorbox);
+	ck_assert_dbl_eq (d.storedErrorbox, 0.05, 1e-6);
+
+	// HETE retraction notice
+	d = decideGcn (true, 0.05, true, true, -999.99, -999.99, false, 0.01);
+	ck_assert_msg (!d.updateTarget, "target updated from retraction notice");
+	ck_assert_msg (d.updateIsGrb, "GRB flag not updated");
+	ck_assert_dbl_eq (d.storedErrorbox, 0.05, 1e-6);
+
+	// better position
+	d = decideGcn (true, 0.05, true, true, 10, 20, true, 0.01);
+	ck_assert_msg (d.updateTarget && d.updateGrb, "better position not applied");
+	ck_assert_dbl_eq (d.noticeErrorbox, 0.01, 1e-6);
+	ck_assert_dbl_eq (d.storedErrorbox, 0.01, 1e-6);
+}
+END_TEST
+
+START_TEST(gbm_limit)
+{
+	// GBM limit applies to stored errorbox, even when notice was ignored
+	GcnDecision d = decideGcn (true, 8, true, true, 10, 20, true, 12);
+	ck_assert_msg (!followGcn (d, TYPE_FERMI_GBM_ALERT, 1234, 5, false), "GBM GRB above limit followed");
+	d = decideGcn (true, 3, true, true, 10, 20, true, 12);
+	ck_assert_msg (followGcn (d, TYPE_FERMI_GBM_ALERT, 1234, 5, false), "GBM GRB below limit not followed");
+	ck_assert_msg (followGcn (d, TYPE_FERMI_GBM_ALERT, 1234, 0, false), "GBM GRB not followed without limit");
+}
+END_TEST
+
+Suite * gcndecision_suite (void)
+{
+	Suite *s;
+	TCase *tc_gcn;
+
+	s = suite_create ("GcnDecision");
+	tc_gcn = tcase_create ("GCN notices follow-up");
+
+	tcase_add_test (tc_gcn, swift_followups);
+	tcase_add_test (tc_gcn, ignored_errorbox);
+	tcase_add_test (tc_gcn, gbm_limit);
+	suite_add_tcase (s, tc_gcn);
+
+	return s;
+}
+
+int main (void)
+{
+	int number_failed;
+	Suite *s;
+	SRunner *sr;
+
+	s = gcndecision_suite ();
+	sr = srunner_create (s);
+	srunner_run_all (sr, CK_NORMAL);
+	number_failed = srunner_ntests_failed (sr);
+	srunner_free (sr);
+
+	return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,177 @@
+#include "rts2fits/image.h"
+#include "rts2fits/platesolver.h"
+#include "rts2fits/skygenerator.h"
+#include "rts2fits/sourceextractor.h"
+#include "catfile.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+
+#include <check.h>
+#include <check_utils.h>
+
+#define FIELD_RA     150.0
+#define FIELD_DEC    30.0
+#define FIELD_RADIUS 1.5
+#define FIELD_STARS  3000
+
+static char catname[] = "/tmp/check_platesolveXXXXXX";
+static rts2catd::CatFile *catalogue;
+
+// random stars around field centre, magnitudes 11 - 17
+static int writeCatalogue ()
+{
+	rts2catd::CatFileWriter writer (16);
+	for (int pass = 1; pass <= 2; pass++)
+	{
+		srand (1);
+		for (int i = 0; i < FIELD_STARS; i++)
+		{
+			double r = FIELD_RADIUS * sqrt (rand () / (double) RAND_MAX);
+			double a = 2 * M_PI * rand () / (double) RAND_MAX;
+			double dec = FIELD_DEC + r * sin (a);
+			double ra = FIELD_RA + r * cos (a) / cos (ln_deg_to_rad (dec));
+			float mag = 11 + 6 * pow (rand () / (double) RAND_MAX, 0.3);
+			if (pass == 1)
+				writer.count (ra, dec);
+			else if (writer.add (i, ra, dec, mag))
+				return -1;
+		}
+		if (pass == 1 && writer.create (catname))
+			return -1;
+	}
+	return writer.finish ();
+}
+
+void setup_platesolve (void)
+{
+	int fd = mkstemp (catname);
+	ck_assert_msg (fd >= 0, "cannot create temporary file");
+	close (fd);
+	ck_assert_int_eq (writeCatalogue (), 0);
+	catalogue = new rts2catd::CatFile ();
+	ck_assert_int_eq (catalogue->openFile (catname), 0);
+}
+
+void teardown_platesolve (void)
+{
+	delete catalogue;
+	unlink (catname);
+	strcpy (catname + strlen (catname) - 6, "XXXXXX");
+}
+
+// difference of two angles, in degrees
+static double angleDiff (double a1, double a2)
+{
+	double d = fmod (a1 - a2, 360);
+	if (d > 180)
+		d -= 360;
+	else if (d < -180)
+		d += 360;
+	return d;
+}
+
+START_TEST(solve_generated)
+{
+	long w = 1024, h = 1024;
+	double scale = 2;
+	double rotations[] = {0, 30, 200};
+
+	for (int r = 0; r < 3; r++)
+	{
+		struct ln_equ_posn centre;
+		centre.ra = FIELD_RA + 0.1;
+		centre.dec = FIELD_DEC - 0.05;
+
+		rts2image::SkyGenerator generator;
+		generator.setSky (100);
+		int added = generator.addCatalogueStars (catalogue, &centre, w, h, scale, rotations[r], 22, 10, 17);
+		ck_assert_msg (added > 50, "only %d stars in the field", added);
+
+		std::vector <float> data (w * h);
+		ck_assert_int_eq (generator.generate (&data[0], RTS2_DATA_FLOAT, w, h, r + 1), 0);
+
+		std::vector <rts2image::stardata> sources;
+		rts2image::SourceExtractor extractor;
+		ck_assert_msg (extractor.extract (&data[0], RTS2_DATA_FLOAT, w, h, sources) > 50, "too few sources detected");
+
+		// prior is 0.1 degree off, scale 2% off
+		struct ln_equ_posn prior;
+		prior.ra = centre.ra - 0.1;
+		prior.dec = centre.dec + 0.05;
+		rts2image::PlateSolver solver (catalogue);
+		solver.setScale (scale * 1.02);
+
+		rts2image::plateSolution sol;
+		// generator centre is at 0-based w / 2, h / 2
+		ck_assert_int_eq (solver.solve (sources, w, h, &prior, w / 2.0 + 1, h / 2.0 + 1, sol), 0);
+
+		double dra = angleDiff (sol.crval.ra, centre.ra) * cos (ln_deg_to_rad (centre.dec)) * 3600;
+		double ddec = (sol.crval.dec - centre.dec) * 3600;
+		ck_assert_msg (sqrt (dra * dra + ddec * ddec) < 0.5, "centre is off by %f %f arcsec for rotation %f", dra, ddec, rotations[r]);
+		ck_assert_dbl_eq (sol.scale, scale, 0.002);
+		ck_assert_msg (fabs (angleDiff (sol.rotation, rotations[r])) < 0.02, "rotation %f, expected %f", sol.rotation, rotations[r]);
+		ck_assert_msg (!sol.flip, "solution is flipped");
+		ck_assert_msg (sol.matched > added / 2, "only %d of %d stars matched", sol.matched, added);
+		ck_assert_msg (sol.rms < 0.5, "RMS %f arcsec", sol.rms);
+	}
+}
+END_TEST
+
+START_TEST(solve_wrong_field)
+{
+	long w = 512, h = 512;
+	rts2image::SkyGenerator generator;
+	generator.addRandomStars (100, w, h, 100000, 1);
+	std::vector <float> data (w * h);
+	ck_assert_int_eq (generator.generate (&data[0], RTS2_DATA_FLOAT, w, h, 1), 0);
+
+	std::vector <rts2image::stardata> sources;
+	rts2image::SourceExtractor extractor;
+	extractor.extract (&data[0], RTS2_DATA_FLOAT, w, h, sources);
+
+	struct ln_equ_posn prior;
+	prior.ra = FIELD_RA;
+	prior.dec = FIELD_DEC;
+	rts2image::PlateSolver solver (catalogue);
+	solver.setScale (2);
+
+	rts2image::plateSolution sol;
+	ck_assert_int_eq (solver.solve (sources, w, h, &prior, w / 2.0 + 1, h / 2.0 + 1, sol), -1);
+}
+END_TEST
+
+Suite * platesolve_suite (void)
+{
+	Suite *s;
+	TCase *tc_solve;
+
+	s = suite_create ("PlateSolve");
+	tc_solve = tcase_create ("Plate solving of generated frames");
+
+	tcase_add_checked_fixture (tc_solve, setup_platesolve, teardown_platesolve);
+	tcase_add_test (tc_solve, solve_generated);
+	tcase_add_test (tc_solve, solve_wrong_field);
+	tcase_set_timeout (tc_solve, 60);
+	suite_add_tcase (s, tc_solve);
+
+	return s;
+}
+
+int main (void)
+{
+	int number_failed;
+	Suite *s;
+	SRunner *sr;
+
+	s = platesolve_suite ();
+	sr = srunner_create (s);
+	srunner_run_all (sr, CK_NORMAL);
+	number_failed = srunner_ntests_failed (sr);
+	srunner_free (sr);
+
+	return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
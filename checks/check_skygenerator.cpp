@@ -0,0 +1,253 @@
+#include "rts2fits/image.h"
+#include "rts2fits/skygenerator.h"
+#include "rts2fits/sourceextractor.h"
+#include "catfile.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <limits>
+#include <vector>
+
+#include <check.h>
+#include <check_utils.h>
+
+#define FIELD_RA     45.0
+#define FIELD_DEC    -20.0
+// grid of catalogue stars, step in degrees
+#define GRID_STEP    0.02
+#define GRID_SIZE    12
+
+static char catname[] = "/tmp/check_skygeneratorXXXXXX";
+static rts2catd::CatFile *catalogue;
+
+static void gridStar (int i, int j, double &ra, double &dec, float &mag)
+{
+	dec = FIELD_DEC + i * GRID_STEP;
+	ra = FIELD_RA + j * GRID_STEP / cos (FIELD_DEC * M_PI / 180.0);
+	mag = 12 + ((i + j + 2 * GRID_SIZE) % 4) * 0.5;
+}
+
+void setup_skygenerator (void)
+{
+	int fd = mkstemp (catname);
+	ck_assert_msg (fd >= 0, "cannot create temporary file");
+	close (fd);
+
+	rts2catd::CatFileWriter writer (16);
+	for (int pass = 1; pass <= 2; pass++)
+	{
+		for (int i = -GRID_SIZE; i <= GRID_SIZE; i++)
+		{
+			for (int j = -GRID_SIZE; j <= GRID_SIZE; j++)
+			{
+				double ra, dec;
+				float mag;
+				gridStar (i, j, ra, dec, mag);
+				if (pass == 1)
+					writer.count (ra, dec);
+				else
+					ck_assert_int_eq (writer.add ((i + GRID_SIZE) * 100 + j + GRID_SIZE, ra, dec, mag), 0);
+			}
+		}
+		if (pass == 1)
+			ck_assert_int_eq (writer.create (catname), 0);
+	}
+	ck_assert_int_eq (writer.finish (), 0);
+
+	catalogue = new rts2catd::CatFile ();
+	ck_assert_int_eq (catalogue->openFile (catname), 0);
+}
+
+void teardown_skygenerator (void)
+{
+	delete catalogue;
+	unlink (catname);
+	strcpy (catname + strlen (catname) - 6, "XXXXXX");
+}
+
+// pixel position of star, 0-based, with rotation as FITS CROTA2 and east to the left
+static void expectedPosition (double ra, double dec, long w, long h, double scale, double rotation, double &x, double &y)
+{
+	double d0 = FIELD_DEC * M_PI / 180.0;
+	double d = dec * M_PI / 180.0;
+	double da = (ra - FIELD_RA) * M_PI / 180.0;
+	double cosc = sin (d0) * sin (d) + cos (d0) * cos (d) * cos (da);
+	double xi = cos (d) * sin (da) / cosc * 180.0 / M_PI * 3600.0 / scale;
+	double eta = (cos (d0) * sin (d) - sin (d0) * cos (d) * cos (da)) / cosc * 180.0 / M_PI * 3600.0 / scale;
+	double c = cos (rotation * M_PI / 180.0);
+	double s = sin (rotation * M_PI / 180.0);
+	// inverse of CD matrix with CDELT1 < 0
+	x = w / 2.0 - c * xi - s * eta;
+	y = h / 2.0 - s * xi + c * eta;
+}
+
+START_TEST(catalogue_field)
+{
+	// field as generated by the dummy camera: 600x400 binned pixels, 1 arcsec/pixel binned 2x2
+	long w = 600, h = 400;
+	double scale = 1 * 2;
+	double rotation = 20;
+	double zeroPoint = 22;
+	double exposure = 2;
+
+	struct ln_equ_posn centre;
+	centre.ra = FIELD_RA;
+	centre.dec = FIELD_DEC;
+
+	rts2image::SkyGenerator generator;
+	generator.setGain (1.5);
+	std::vector <uint16_t> data (w * h);
+	int added = generator.generateField (&data[0], RTS2_DATA_USHORT, w, h, catalogue, &centre, scale, rotation, zeroPoint, exposure, 18, 500, 500000, 1);
+
+	// stars expected in the field
+	std::vector <double> ex, ey, ef;
+	for (int i = -GRID_SIZE; i <= GRID_SIZE; i++)
+	{
+		for (int j = -GRID_SIZE; j <= GRID_SIZE; j++)
+		{
+			double ra, dec, x, y;
+			float mag;
+			gridStar (i, j, ra, dec, mag);
+			expectedPosition (ra, dec, w, h, scale, rotation, x, y);
+			if (x < 0 || x >= w || y < 0 || y >= h)
+				continue;
+			ex.push_back (x);
+			ey.push_back (y);
+			ef.push_back (exposure * pow (10, -0.4 * (mag - zeroPoint)));
+		}
+	}
+	ck_assert_msg (ex.size () > 100, "only %d stars in the field", (int) ex.size ());
+	ck_assert_int_eq (added, ex.size ());
+
+	std::vector <rts2image::stardata> sources;
+	rts2image::SourceExtractor extractor;
+	extractor.setThreshold (5);
+	ck_assert_msg (extractor.extract (&data[0], RTS2_DATA_USHORT, w, h, sources) > 0, "no sources detected");
+
+	// all stars away from the edges are detected at their positions with their fluxes
+	int inside = 0;
+	std::vector <bool> matched (sources.size (), false);
+	for (size_t e = 0; e < ex.size (); e++)
+	{
+		if (ex[e] < 8 || ex[e] > w - 9 || ey[e] < 8 || ey[e] > h - 9)
+			continue;
+		inside++;
+		int found = -1;
+		for (size_t i = 0; i < sources.size (); i++)
+		{
+			if (fabs (sources[i].X - 1 - ex[e]) < 0.2 && fabs (sources[i].Y - 1 - ey[e]) < 0.2)
+				found = i;
+		}
+		ck_assert_msg (found >= 0, "star at %f %f was not found", ex[e], ey[e]);
+		ck_assert_dbl_eq (sources[found].F, ef[e], ef[e] * 0.1);
+		matched[found] = true;
+	}
+	ck_assert_msg (inside > 100, "only %d stars inside the field", inside);
+
+	// there are no other bright sources
+	for (size_t i = 0; i < sources.size (); i++)
+	{
+		if (matched[i] || sources[i].X < 9 || sources[i].X > w - 8 || sources[i].Y < 9 || sources[i].Y > h - 8)
+			continue;
+		ck_assert_msg (sources[i].F < 500, "unexpected source at %f %f with flux %f", sources[i].X, sources[i].Y, sources[i].F);
+	}
+}
+END_TEST
+
+START_TEST(random_field)
+{
+	long w = 256, h = 128;
+	std::vector <float> data1 (w * h);
+	std::vector <float> data2 (w * h);
+
+	rts2image::SkyGenerator generator;
+	ck_assert_int_eq (generator.generateField (&data1[0], RTS2_DATA_FLOAT, w, h, NULL, NULL, 1, 0, 22, 1, 18, 50, 100000, 1), 50);
+	ck_assert_int_eq (generator.generateField (&data2[0], RTS2_DATA_FLOAT, w, h, NULL, NULL, 1, 0, 22, 1, 18, 50, 100000, 2), 50);
+
+	// stars are at the same positions in every frame, noise differs
+	std::vector <rts2image::stardata> sources1, sources2;
+	rts2image::SourceExtractor extractor;
+	extractor.setThreshold (5);
+	extractor.extract (&data1[0], RTS2_DATA_FLOAT, w, h, sources1);
+	extractor.extract (&data2[0], RTS2_DATA_FLOAT, w, h, sources2);
+	ck_assert_msg (sources1.size () > 20, "only %d sources detected", (int) sources1.size ());
+	ck_assert_msg (memcmp (&data1[0], &data2[0], w * h * sizeof (float)), "noise is the same");
+	for (size_t i = 0; i < 10; i++)
+	{
+		bool found = false;
+		for (size_t j = 0; j < sources2.size (); j++)
+			found |= fabs (sources1[i].X - sources2[j].X) < 0.2 && fabs (sources1[i].Y - sources2[j].Y) < 0.2;
+		ck_assert_msg (found, "star at %f %f is missing in the second frame", sources1[i].X, sources1[i].Y);
+	}
+}
+END_TEST
+
+template <typename dt> static void checkLimits (int dataType, double saturation)
+{
+	long w = 64, h = 64;
+	std::vector <dt> data (w * h);
+
+	rts2image::SkyGenerator generator;
+	generator.setSaturation (saturation);
+	generator.addStar (32, 32, 1e30);
+	ck_assert_int_eq (generator.generate (&data[0], dataType, w, h, 1), 0);
+
+	dt hi = std::numeric_limits <dt>::max ();
+	if (!isnan (saturation))
+		hi = (dt) saturation;
+	ck_assert_msg (data[32 * w + 32] == hi, "saturated pixel is %f, expected %f", (double) data[32 * w + 32], (double) hi);
+	// sky pixels are not affected
+	ck_assert_dbl_eq (data[0], 1200, 50);
+
+	generator.clearStars ();
+	generator.setBias (-1e30);
+	ck_assert_int_eq (generator.generate (&data[0], dataType, w, h, 1), 0);
+	ck_assert_msg (data[0] == std::numeric_limits <dt>::min (), "pixel below range is %f", (double) data[0]);
+}
+
+START_TEST(data_limits)
+{
+	checkLimits <uint16_t> (RTS2_DATA_USHORT, NAN);
+	checkLimits <int16_t> (RTS2_DATA_SHORT, NAN);
+	checkLimits <uint32_t> (RTS2_DATA_ULONG, NAN);
+	checkLimits <int32_t> (RTS2_DATA_LONG, NAN);
+	checkLimits <int64_t> (RTS2_DATA_LONGLONG, NAN);
+	checkLimits <uint32_t> (RTS2_DATA_ULONG, 60000);
+	checkLimits <int64_t> (RTS2_DATA_LONGLONG, 60000);
+}
+END_TEST
+
+Suite * skygenerator_suite (void)
+{
+	Suite *s;
+	TCase *tc_generator;
+
+	s = suite_create ("SkyGenerator");
+	tc_generator = tcase_create ("Synthetic sky frames");
+
+	tcase_add_checked_fixture (tc_generator, setup_skygenerator, teardown_skygenerator);
+	tcase_add_test (tc_generator, catalogue_field);
+	tcase_add_test (tc_generator, random_field);
+	tcase_add_test (tc_generator, data_limits);
+	suite_add_tcase (s, tc_generator);
+
+	return s;
+}
+
+int main (void)
+{
+	int number_failed;
+	Suite *s;
+	SRunner *sr;
+
+	s = skygenerator_suite ();
+	sr = srunner_create (s);
+	srunner_run_all (sr, CK_NORMAL);
+	number_failed = srunner_ntests_failed (sr);
+	srunner_free (sr);
+
+	return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
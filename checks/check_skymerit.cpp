@@ -0,0 +1,188 @@
+#include "skymerit.h"
+
+#include <stdlib.h>
+#include <sys/time.h>
+#include <iostream>
+
+#include <check.h>
+#include <check_utils.h>
+
+#include <libnova/libnova.h>
+
+static rts2core::SkyMerit *merit;
+static struct ln_lnlat_posn observer;
+
+// 2016-08-01 00:00 UT
+#define START_JD    2457601.5
+
+void setup_skymerit (void)
+{
+	observer.lng = -17.88;
+	observer.lat = 28.76;
+
+	merit = new rts2core::SkyMerit ();
+	merit->setObserver (&observer);
+	merit->setDetector (1.5, 0.5, 8);
+	merit->addFilter ("V", 1e10, 0.15, 21.5);
+	merit->addFilter ("R", 1.2e10, 0.10, 20.9);
+}
+
+void teardown_skymerit (void)
+{
+	delete merit;
+}
+
+// search for time with given Sun and Moon altitudes, in one hour steps
+static double findJD (double sunMin, double sunMax, double moonMin, double moonMax, double minIllumination)
+{
+	struct ln_equ_posn pos;
+	struct ln_hrz_posn hrz;
+	for (double JD = START_JD; JD < START_JD + 60; JD += 1 / 24.0)
+	{
+		ln_get_solar_equ_coords (JD, &pos);
+		ln_get_hrz_from_equ (&pos, &observer, JD, &hrz);
+		if (hrz.alt < sunMin || hrz.alt > sunMax)
+			continue;
+		ln_get_lunar_equ_coords (JD, &pos);
+		ln_get_hrz_from_equ (&pos, &observer, JD, &hrz);
+		if (hrz.alt < moonMin || hrz.alt > moonMax || ln_get_lunar_disk (JD) < minIllumination)
+			continue;
+		return JD;
+	}
+	return NAN;
+}
+
+// add candidate at zenith
+static int addZenith (double JD, double mag)
+{
+	return merit->addCandidate (ln_range_degrees (ln_get_apparent_sidereal_time (JD) * 15.0 + observer.lng), observer.lat, mag, 0, 60, 20);
+}
+
+START_TEST(dark_sky)
+{
+	double JD = findJD (-90, -20, -90, -10, 0);
+	ck_assert_msg (!isnan (JD), "cannot find dark time");
+
+	int z = addZenith (JD, 15);
+	merit->compute (JD);
+
+	ck_assert_dbl_eq (merit->getAltitude (z), 90, 0.5);
+	ck_assert_dbl_eq (merit->getAirmass (z), 1, 0.001);
+	ck_assert_dbl_eq (merit->getSkyBrightness (z), 21.5, 0.01);
+	ck_assert_msg (merit->getSNR (z) > 10, "SNR of 15 mag star is too low: %f", merit->getSNR (z));
+}
+END_TEST
+
+START_TEST(moon_sky)
+{
+	double JD = findJD (-90, -20, 30, 90, 0.8);
+	ck_assert_msg (!isnan (JD), "cannot find time with bright Moon");
+
+	struct ln_equ_posn moon;
+	ln_get_lunar_equ_coords (JD, &moon);
+
+	int z = addZenith (JD, 15);
+	int m = merit->addCandidate (moon.ra, moon.dec > 0 ? moon.dec - 15 : moon.dec + 15, 15, 0, 60, 20);
+	merit->compute (JD);
+
+	ck_assert_msg (merit->getSkyBrightness (z) < 20.5, "zenith sky with bright Moon is too dark: %f", merit->getSkyBrightness (z));
+	ck_assert_msg (merit->getSkyBrightness (m) < merit->getSkyBrightness (z), "sky close to the Moon %f is darker than at zenith %f", merit->getSkyBrightness (m), merit->getSkyBrightness (z));
+	ck_assert_dbl_eq (merit->getMoonDistance (m), 15, 0.01);
+}
+END_TEST
+
+START_TEST(twilight_sky)
+{
+	double JD = findJD (-11, -7, -90, -5, 0);
+	ck_assert_msg (!isnan (JD), "cannot find twilight");
+
+	int z = addZenith (JD, 15);
+	merit->compute (JD);
+
+	ck_assert_msg (merit->getSkyBrightness (z) < 19, "twilight sky is too dark: %f", merit->getSkyBrightness (z));
+}
+END_TEST
+
+START_TEST(ranking)
+{
+	double JD = findJD (-90, -20, -90, -10, 0);
+
+	double lst = ln_get_apparent_sidereal_time (JD) * 15.0 + observer.lng;
+
+	// low altitude
+	int low = merit->addCandidate (ln_range_degrees (lst + 75), observer.lat, 15, 0, 60, 20);
+	int zenith = addZenith (JD, 15);
+	// below horizon
+	int below = merit->addCandidate (ln_range_degrees (lst + 180), -observer.lat, 15, 0, 60, 20);
+	// faint target at zenith
+	int faint = addZenith (JD, 21);
+	// double weight of low altitude target
+	int weighted = merit->addCandidate (ln_range_degrees (lst + 75), observer.lat, 15, 0, 60, 20, 2);
+
+	std::vector <int> order;
+	merit->rank (JD, order);
+
+	ck_assert_int_eq (order.size (), 4);
+	ck_assert_int_eq (order[0], weighted);
+	ck_assert_int_eq (order[1], zenith);
+	ck_assert_int_eq (order[2], low);
+	ck_assert_int_eq (order[3], faint);
+	ck_assert_dbl_eq (merit->getMerit (below), 0, 1e-10);
+	ck_assert_dbl_eq (merit->getMerit (weighted), 2 * merit->getMerit (low), 1e-10);
+}
+END_TEST
+
+START_TEST(benchmark)
+{
+	srand (1);
+	for (int i = 0; i < 5000; i++)
+		merit->addCandidate (rand () * 360.0 / RAND_MAX, rand () * 150.0 / RAND_MAX - 60, 10 + rand () * 10.0 / RAND_MAX, i % 2, 10 + i % 300, 30, 1 + i % 5);
+
+	std::vector <int> order;
+	int repeat = 100;
+
+	struct timeval t0, t1;
+	gettimeofday (&t0, NULL);
+	for (int i = 0; i < repeat; i++)
+		merit->rank (START_JD + i / 1440.0, order);
+	gettimeofday (&t1, NULL);
+
+	double ms = ((t1.tv_sec - t0.tv_sec) * 1000.0 + (t1.tv_usec - t0.tv_usec) / 1000.0) / repeat;
+	std::cout << "ranking of 5000 candidates took " << ms << " ms" << std::endl;
+	ck_assert_int_eq (order.size (), 5000);
+}
+END_TEST
+
+Suite * skymerit_suite (void)
+{
+	Suite *s;
+	TCase *tc_merit;
+
+	s = suite_create ("SkyMerit");
+	tc_merit = tcase_create ("Sky brightness and merit");
+
+	tcase_add_checked_fixture (tc_merit, setup_skymerit, teardown_skymerit);
+	tcase_add_test (tc_merit, dark_sky);
+	tcase_add_test (tc_merit, moon_sky);
+	tcase_add_test (tc_merit, twilight_sky);
+	tcase_add_test (tc_merit, ranking);
+	tcase_add_test (tc_merit, benchmark);
+	suite_add_tcase (s, tc_merit);
+
+	return s;
+}
+
+int main (void)
+{
+	int number_failed;
+	Suite *s;
+	SRunner *sr;
+
+	s = skymerit_suite ();
+	sr = srunner_create (s);
+	srunner_run_all (sr, CK_NORMAL);
+	number_failed = srunner_ntests_failed (sr);
+	srunner_free (sr);
+
+	return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
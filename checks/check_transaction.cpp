@@ -0,0 +1,256 @@
+#include "block.h"
+#include "connection/transaction.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <check.h>
+#include <check_utils.h>
+
+// block running the main loop, without central server
+class TransactionBlock:public rts2core::Block
+{
+	public:
+		TransactionBlock ():rts2core::Block (0, NULL) { setTimeout (USEC_SEC / 100); }
+
+		virtual int run () { return 0; }
+
+		virtual rts2core::Connection *createClientConnection (rts2core::NetworkAddress * in_addr) { return NULL; }
+};
+
+class TransactionResults:public rts2core::TransactionCallback
+{
+	public:
+		TransactionResults () { finished = 0; state = rts2core::TRANS_QUEUED; }
+
+		virtual void transactionFinished (rts2core::Transaction *t)
+		{
+			finished++;
+			state = t->getState ();
+			response = t->getResponse ();
+		}
+
+		int finished;
+		rts2core::trans_state_t state;
+		std::string response;
+};
+
+static TransactionBlock *block;
+static rts2core::ConnTransaction *conn;
+static int sv[2];
+
+void setup_transaction (void)
+{
+	ck_assert_int_eq (socketpair (AF_UNIX, SOCK_STREAM, 0, sv), 0);
+	fcntl (sv[0], F_SETFL, O_NONBLOCK);
+	fcntl (sv[1], F_SETFL, O_NONBLOCK);
+	block = new TransactionBlock ();
+	conn = new rts2core::ConnTransaction (sv[0], block);
+}
+
+void teardown_transaction (void)
+{
+	delete conn;
+	delete block;
+	close (sv[1]);
+}
+
+// run main loop for given time, or until callback was called
+static void runLoop (double duration, TransactionResults *results = NULL)
+{
+	double end = getNow () + duration;
+	while (getNow () < end && (results == NULL || results->finished == 0))
+		block->oneRunLoop ();
+}
+
+// read everything written to the connection so far
+static std::string deviceRead ()
+{
+	char buf[100];
+	ssize_t ret = read (sv[1], buf, sizeof (buf));
+	if (ret <= 0)
+		return std::string ();
+	return std::string (buf, ret);
+}
+
+START_TEST(transaction_reply)
+{
+	TransactionResults results;
+	rts2core::Transaction *t = new rts2core::Transaction ("PR?\n", &results, 1);
+	t->setEndChar ('\n');
+	conn->queueTransaction (t);
+
+	runLoop (0.1);
+	ck_assert_str_eq (deviceRead ().c_str (), "PR?\n");
+	ck_assert_int_eq (write (sv[1], "1.5", 3), 3);
+	runLoop (0.1);
+	ck_assert_int_eq (results.finished, 0);
+	ck_assert_int_eq (write (sv[1], "E-3\n", 4), 4);
+	runLoop (1, &results);
+
+	ck_assert_int_eq (results.finished, 1);
+	ck_assert_int_eq (results.state, rts2core::TRANS_DONE);
+	ck_assert_str_eq (results.response.c_str (), "1.5E-3\n");
+	ck_assert_int_eq (conn->transactionsPending (), 0);
+	ck_assert_int_eq (conn->getLatencyHistogram ().getCount (), 1);
+}
+END_TEST
+
+START_TEST(transaction_timeout)
+{
+	TransactionResults results;
+	rts2core::Transaction *t = new rts2core::Transaction ("PR?\n", &results, 0.2);
+	t->setEndChar ('\n');
+	conn->queueTransaction (t);
+
+	double start = getNow ();
+	runLoop (2, &results);
+
+	ck_assert_int_eq (results.finished, 1);
+	ck_assert_int_eq (results.state, rts2core::TRANS_TIMEOUT);
+	// timer wakes up the loop, it does not wait for idle timeout
+	ck_assert_msg (getNow () - start < 0.5, "timeout reported after %f seconds", getNow () - start);
+	ck_assert_int_eq (conn->getTransactionTimeouts (), 1);
+	ck_assert_int_eq (conn->transactionsPending (), 0);
+	ck_assert_str_eq (deviceRead ().c_str (), "PR?\n");
+}
+END_TEST
+
+START_TEST(transaction_retry)
+{
+	TransactionResults results;
+	rts2core::Transaction *t = new rts2core::Transaction ("PR?\n", &results, 0.2);
+	t->setEndChar ('\n');
+	t->setRetries (1);
+	conn->queueTransaction (t);
+
+	// first request is not answered
+	runLoop (0.1);
+	ck_assert_str_eq (deviceRead ().c_str (), "PR?\n");
+	runLoop (0.2);
+	ck_assert_int_eq (results.finished, 0);
+	ck_assert_int_eq (conn->getTransactionRetries (), 1);
+
+	// request was send again, reply to it
+	ck_assert_str_eq (deviceRead ().c_str (), "PR?\n");
+	ck_assert_int_eq (write (sv[1], "OK\n", 3), 3);
+	runLoop (1, &results);
+
+	ck_assert_int_eq (results.finished, 1);
+	ck_assert_int_eq (results.state, rts2core::TRANS_DONE);
+	ck_assert_str_eq (results.response.c_str (), "OK\n");
+	ck_assert_int_eq (conn->getTransactionTimeouts (), 0);
+
+	// no retries left
+	t = new rts2core::Transaction ("PR?\n", &results, 0.1);
+	t->setEndChar ('\n');
+	t->setRetries (1);
+	results.finished = 0;
+	conn->queueTransaction (t);
+	runLoop (2, &results);
+
+	ck_assert_int_eq (results.state, rts2core::TRANS_TIMEOUT);
+	ck_assert_int_eq (conn->getTransactionRetries (), 2);
+	ck_assert_int_eq (conn->getTransactionTimeouts (), 1);
+	ck_assert_str_eq (deviceRead ().c_str (), "PR?\nPR?\n");
+}
+END_TEST
+
+START_TEST(transaction_late_reply)
+{
+	TransactionResults results;
+	rts2core::Transaction *t = new rts2core::Transaction ("PR?\n", &results, 0.2);
+	t->setEndChar ('\n');
+	conn->queueTransaction (t);
+
+	runLoop (2, &results);
+	ck_assert_int_eq (results.state, rts2core::TRANS_TIMEOUT);
+	ck_assert_str_eq (deviceRead ().c_str (), "PR?\n");
+
+	// device answers the timed out request, while the next request is queued
+	ck_assert_int_eq (write (sv[1], "OLD\n", 4), 4);
+	t = new rts2core::Transaction ("PR?\n", &results, 1);
+	t->setEndChar ('\n');
+	results.finished = 0;
+	conn->queueTransaction (t);
+
+	runLoop (0.1, &results);
+	ck_assert_int_eq (results.finished, 0);
+	ck_assert_str_eq (deviceRead ().c_str (), "PR?\n");
+	ck_assert_int_eq (write (sv[1], "NEW\n", 4), 4);
+	runLoop (1, &results);
+
+	ck_assert_int_eq (results.finished, 1);
+	ck_assert_int_eq (results.state, rts2core::TRANS_DONE);
+	ck_assert_str_eq (results.response.c_str (), "NEW\n");
+}
+END_TEST
+
+START_TEST(transaction_delete)
+{
+	// deleted connection must remove only its own timers
+	int sv2[2];
+	ck_assert_int_eq (socketpair (AF_UNIX, SOCK_STREAM, 0, sv2), 0);
+	rts2core::ConnTransaction *conn2 = new rts2core::ConnTransaction (sv2[0], block);
+
+	TransactionResults results;
+	TransactionResults results2;
+	rts2core::Transaction *t = new rts2core::Transaction ("A\n", &results, 0.2);
+	t->setEndChar ('\n');
+	conn->queueTransaction (t);
+	t = new rts2core::Transaction ("B\n", &results2, 0.1);
+	t->setEndChar ('\n');
+	conn2->queueTransaction (t);
+
+	runLoop (0.05);
+	delete conn2;
+	close (sv2[1]);
+
+	// only timer can wake up the loop in time
+	block->setTimeout (USEC_SEC * 10);
+	double start = getNow ();
+	runLoop (2, &results);
+	ck_assert_int_eq (results.finished, 1);
+	ck_assert_int_eq (results.state, rts2core::TRANS_TIMEOUT);
+	ck_assert_msg (getNow () - start < 0.5, "timeout reported after %f seconds", getNow () - start);
+	// transactions of the deleted connection are dropped without callback
+	ck_assert_int_eq (results2.finished, 0);
+}
+END_TEST
+
+Suite * transaction_suite (void)
+{
+	Suite *s;
+	TCase *tc_transaction;
+
+	s = suite_create ("Transaction");
+	tc_transaction = tcase_create ("Asynchronous transactions");
+
+	tcase_add_checked_fixture (tc_transaction, setup_transaction, teardown_transaction);
+	tcase_add_test (tc_transaction, transaction_reply);
+	tcase_add_test (tc_transaction, transaction_timeout);
+	tcase_add_test (tc_transaction, transaction_retry);
+	tcase_add_test (tc_transaction, transaction_late_reply);
+	tcase_add_test (tc_transaction, transaction_delete);
+
+	suite_add_tcase (s, tc_transaction);
+
+	return s;
+}
+
+int main (void)
+{
+	int number_failed;
+	Suite *s;
+	SRunner *sr;
+
+	s = transaction_suite ();
+	sr = srunner_create (s);
+	srunner_run_all (sr, CK_NORMAL);
+	number_failed = srunner_ntests_failed (sr);
+	srunner_free (sr);
+
+	return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -32,6 +32,9 @@
 namespace rts2core
 {
 
+struct LogRecord;
+class LogQueue;
+
 /**
  * Abstract class which provides functions for an application.
  * 
@@ -189,6 +192,26 @@ class App:public Object
 		 */
 		inline void sendMessage (messageType_t in_messageType, std::ostringstream & _os);
 
+		/**
+		 * Pass log message to the system. If log queue was started, the
+		 * message is queued and delivered asynchronously from the main
+		 * loop, otherwise sendMessage is called. Can be called from any
+		 * thread once the queue is started.
+		 *
+		 * @param in_messageType   Message type.
+		 * @param in_messageString Message.
+		 */
+		void queueMessage (messageType_t in_messageType, const char *in_messageString);
+
+		/**
+		 * Deliver batch of records drained from the log queue. Default
+		 * implementation calls sendMessage for each record.
+		 *
+		 * @param records  records ordered by time
+		 * @param n        number of records
+		 */
+		virtual void sendMessages (LogRecord **records, size_t n);
+
 		virtual LogStream logStream (messageType_t in_messageType);
 
 		/**
@@ -268,6 +291,24 @@ class App:public Object
 
 		void setDebug (int d) { debug = d; }
 
+		/**
+		 * Start queueing of log messages. Messages are then delivered
+		 * by drainLogQueue, called from the main loop.
+		 */
+		void startLogQueue ();
+
+		/**
+		 * Deliver all queued messages and stop queueing.
+		 */
+		void stopLogQueue ();
+
+		/**
+		 * Deliver queued log messages. Called from the main loop.
+		 */
+		virtual void drainLogQueue ();
+
+		LogQueue *getLogQueue () { return logQueue; }
+
 	private:
 		/**
 		 * Holds options which might be passed to the program.
@@ -304,6 +345,8 @@ class App:public Object
 
 		// use local time
 		bool useLocalTime;
+
+		LogQueue *logQueue;
 };
 
 }
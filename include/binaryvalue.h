@@ -0,0 +1,98 @@
+/*
+ * Binary encoding of value updates.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_BINARYVALUE__
+#define __RTS2_BINARYVALUE__
+
+#include <stdint.h>
+#include <string>
+
+/**
+ * Binary value frame. Followed by frame size in bytes, the frame follows
+ * the line. Frame is sequence of value records, each record contains:
+ *
+ *  - uint16 length of value name, followed by the name
+ *  - uint32 value type, as returned by Value::getValueType
+ *  - uint32 length of payload, followed by the payload
+ *
+ * All numbers are in network (big endian) byte order. Payload of scalar
+ * values is single number, payload of arrays is number of elements times
+ * element size.
+ *
+ * @ingroup RTS2Protocol
+ */
+#define PROTO_BINARY_VALUES    "W"
+
+namespace rts2core
+{
+
+inline void binaryAppendUInt16 (std::string &buf, uint16_t v)
+{
+	buf.push_back ((char) (v >> 8));
+	buf.push_back ((char) v);
+}
+
+inline void binaryAppendUInt32 (std::string &buf, uint32_t v)
+{
+	buf.push_back ((char) (v >> 24));
+	buf.push_back ((char) (v >> 16));
+	buf.push_back ((char) (v >> 8));
+	buf.push_back ((char) v);
+}
+
+inline void binaryAppendUInt64 (std::string &buf, uint64_t v)
+{
+	binaryAppendUInt32 (buf, (uint32_t) (v >> 32));
+	binaryAppendUInt32 (buf, (uint32_t) v);
+}
+
+inline void binaryAppendDouble (std::string &buf, double v)
+{
+	union { double d; uint64_t u; } c;
+	c.d = v;
+	binaryAppendUInt64 (buf, c.u);
+}
+
+inline uint16_t binaryGetUInt16 (const char *p)
+{
+	const unsigned char *u = (const unsigned char *) p;
+	return (u[0] << 8) | u[1];
+}
+
+inline uint32_t binaryGetUInt32 (const char *p)
+{
+	const unsigned char *u = (const unsigned char *) p;
+	return ((uint32_t) u[0] << 24) | ((uint32_t) u[1] << 16) | ((uint32_t) u[2] << 8) | u[3];
+}
+
+inline uint64_t binaryGetUInt64 (const char *p)
+{
+	return ((uint64_t) binaryGetUInt32 (p) << 32) | binaryGetUInt32 (p + 4);
+}
+
+inline double binaryGetDouble (const char *p)
+{
+	union { double d; uint64_t u; } c;
+	c.u = binaryGetUInt64 (p);
+	return c.d;
+}
+
+}
+
+#endif // !__RTS2_BINARYVALUE__
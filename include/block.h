@@ -74,6 +74,8 @@
 #define PROTO_METAINFO         "E"
 /** The command is metainformation about selection variable. Empty selection means clear selection list. @ingroup RTS2Protocol */
 #define PROTO_SELMETAINFO      "F"
+/** End of values pushed to connection which subscribed them. @ingroup RTS2Protocol */
+#define PROTO_PUSHED           "N"
 
 /** The command defines binary channel. @ingroup RTS2Protocol */
 #define PROTO_BINARY           "C"
@@ -623,6 +625,27 @@ class Block: public App
 		 */
 		Value *getValueExpression (std::string expression, const char *defaultDevice = NULL);
 
+		/**
+		 * Returns counter which is increased every time values of some
+		 * connection are deleted. Users which keep Value pointers
+		 * returned by getValue must look them up again when the
+		 * counter changes.
+		 */
+		unsigned long getValuesGeneration () { return valuesGeneration; }
+
+		/**
+		 * Called when connection values are deleted.
+		 */
+		void valuesDeleted () { valuesGeneration++; }
+
+		/**
+		 * Returns true if block asks devices to send value updates
+		 * in binary value frames.
+		 */
+		bool getBinaryValues () { return binaryValues; }
+
+		void setBinaryValues (bool _binaryValues) { binaryValues = _binaryValues; }
+
 		virtual void endRunLoop ()
 		{
 			setEndLoop (true);
@@ -664,6 +687,14 @@ class Block: public App
 		 */
 		void deleteTimers (int event_type);
 
+		/**
+		 * Remove timers with a given type and argument.
+		 *
+		 * @param event_type Type of event.
+		 * @param arg        Event argument.
+		 */
+		void deleteTimers (int event_type, void *arg);
+
 		/**
 		 * Updates metainformation about given value.
 		 *
@@ -832,6 +863,10 @@ class Block: public App
 		rts2_status_t masterState;
 		Connection *stateMasterConn;
 
+		unsigned long valuesGeneration;
+
+		bool binaryValues;
+
 		/**
 		 * Set value error mask.
 		 *
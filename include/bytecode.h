@@ -0,0 +1,202 @@
+/*
+ * Compiled expressions.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_BYTECODE__
+#define __RTS2_BYTECODE__
+
+#include "block.h"
+#include "expression.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace rts2expression
+{
+
+/**
+ * Expression compiled to a flat stack program.
+ *
+ * Expression trees (Expression, rts2operands::Operand) are compiled once,
+ * and the program is evaluated without virtual calls. Operations on
+ * constants are folded during compilation. Values are looked up by name
+ * only on the first evaluation; the Value pointer is then kept until the
+ * master block reports that some connection values were deleted (see
+ * rts2core::Block::getValuesGeneration), which happens when a device
+ * disconnects or changes its value type.
+ *
+ * Program is created by calling push methods in postfix order - first
+ * operands, then operator.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class Bytecode
+{
+	public:
+		/**
+		 * How missing value is handled.
+		 */
+		typedef enum {
+			/** throw ExpressionErrorValueMissing if device or value is missing */
+			MISSING_THROW,
+			/** throw rts2core::Error if device is missing, use NAN for missing value */
+			MISSING_NAN
+		} missing_t;
+
+		Bytecode ():code (), slots (), errors (), stack (), shortCircuits () { maxDepth = 0; depth = 0; lastLabel = 0; }
+
+		/**
+		 * Remove all instructions.
+		 */
+		void clear ();
+
+		bool empty () { return code.empty (); }
+
+		size_t size () { return code.size (); }
+
+		/**
+		 * Push constant to the stack.
+		 */
+		void pushConst (double val);
+
+		/**
+		 * Push device value to the stack.
+		 *
+		 * @param master   block used to look up the value
+		 * @param device   device name
+		 * @param value    value name
+		 * @param missing  missing value handling
+		 */
+		void pushValue (rts2core::Block *master, const char *device, const char *value, missing_t missing = MISSING_THROW);
+
+		/**
+		 * Throw rts2core::Error with given message when evaluated. Used
+		 * for operands which cannot be converted to number, so the
+		 * error is reported at the same time as during tree evaluation.
+		 */
+		void pushError (const char *msg);
+
+		/**
+		 * Replace two top stack values (from, to) with random number
+		 * from the interval.
+		 */
+		void pushRandom ();
+
+		/**
+		 * Replace two top stack values with result of the operation.
+		 * For OR and AND, beginShortCircuit and endShortCircuit must be
+		 * used instead.
+		 */
+		void pushOperator (op_t op);
+
+		/**
+		 * Start short-circuit OR or AND, after code for the left
+		 * operand was pushed. If result can be decided from the left
+		 * operand, right operand is not evaluated.
+		 */
+		void beginShortCircuit (op_t op);
+
+		/**
+		 * Finish short-circuit operation started by the last
+		 * beginShortCircuit call, after code for the right operand
+		 * was pushed.
+		 */
+		void endShortCircuit ();
+
+		/**
+		 * Evaluate program.
+		 *
+		 * @throw rts2core::Error when value cannot be found
+		 */
+		double evaluate ();
+
+		friend std::ostream & operator << (std::ostream &_os, Bytecode &bc);
+
+	private:
+		typedef enum { BC_CONST, BC_VALUE, BC_ERROR, BC_RANDOM, BC_OR, BC_AND, BC_BOOL, BC_XOR, BC_EQU, BC_LT, BC_LEQU, BC_GT, BC_GEQU, BC_NEQ } opcode_t;
+
+		struct instruction
+		{
+			opcode_t opcode;
+			union
+			{
+				double val;
+				size_t index;
+			} arg;
+		};
+
+		struct slot
+		{
+			rts2core::Block *master;
+			std::string device;
+			std::string value;
+			missing_t missing;
+			rts2core::Value *val;
+			unsigned long generation;
+		};
+
+		std::vector <instruction> code;
+		std::vector <slot> slots;
+		std::vector <std::string> errors;
+
+		std::vector <double> stack;
+		int maxDepth;
+		int depth;
+
+		// index of the last jump target - folding cannot cross it
+		size_t lastLabel;
+
+		typedef enum {
+			// result depends on both operands
+			SC_JUMP,
+			// result is decided by the constant left operand
+			SC_DECIDED,
+			// constant left operand was removed, result is the right operand
+			SC_BOOL
+		} sc_mode_t;
+
+		struct shortCircuit
+		{
+			sc_mode_t mode;
+			// jump instruction for SC_JUMP, start of the right operand for SC_DECIDED
+			size_t pos;
+			size_t lastLabel;
+		};
+
+		// unfinished short-circuit operations
+		std::vector <shortCircuit> shortCircuits;
+
+		void emit (opcode_t opcode, double val);
+		void emitIndex (opcode_t opcode, size_t index);
+		void emitBool ();
+		void changeDepth (int change);
+
+		// true if last n instructions are constants which can be folded
+		bool constTop (size_t n);
+
+		double resolve (slot &s);
+
+		static double apply (opcode_t opcode, double v1, double v2);
+};
+
+std::ostream & operator << (std::ostream &_os, Bytecode &bc);
+
+}
+
+#endif // !__RTS2_BYTECODE__
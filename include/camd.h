@@ -1016,6 +1016,24 @@ class Camera:public rts2core::ScriptDevice
 		int sharedMemNum;
 		rts2core::DataSharedWrite *sharedData;
 
+		// maximal number of bytes queued for a single consumer; 0 if image data are send with blocking writes
+		size_t streamLimit;
+		// additional consumers of image data, with IDs of their data connections
+		std::map <rts2core::Connection *, int> streamConsumers;
+		rts2core::StringArray *streamNames;
+		rts2core::DoubleArray *streamThroughput;
+		rts2core::DoubleArray *streamLag;
+
+		void startStreams (rts2core::Connection *conn, int chnTot, size_t *chansize);
+
+		/**
+		 * Queue data to exposure connection and to all stream consumers.
+		 * Data are copied only once, to chunk shared by all consumers.
+		 */
+		int streamData (int chan, char *data, size_t dataSize, bool toExposureConn);
+
+		void updateStreamValues ();
+
 		// number of exposures camera takes
 		rts2core::ValueLong *exposureNumber;
 		// exposure number inside script
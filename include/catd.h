@@ -21,6 +21,7 @@
 #define __RTS2_CATD__
 
 #include "device.h"
+#include "valuearray.h"
 
 /**
  * Abstract sensors, SensorWeather with functions to set weather state, and various other sensors.
@@ -43,13 +44,53 @@ class Catd:public rts2core::Device
 		Catd (int argc, char **argv, const char *cn = "CAT1");
 		virtual ~Catd (void);
 
+		virtual int commandAuthorized (rts2core::Connection * conn);
+
 	protected:
+		/**
+		 * Search stars inside RA/DEC box. Found stars shall be
+		 * passed to addStar, brightest first.
+		 *
+		 * @param c1   box corner
+		 * @param c2   opposite box corner
+		 * @param num  maximal number of stars
+		 *
+		 * @return number of stars found, -1 on error
+		 */
 		virtual int searchCataloge (struct ln_equ_posn *c1, struct ln_equ_posn *c2, int num) = 0;
 
+		/**
+		 * Search stars inside cone. Found stars shall be passed to
+		 * addStar, brightest first.
+		 *
+		 * @return number of stars found, -1 on error or if cone search is not supported
+		 */
+		virtual int coneSearch (struct ln_equ_posn *centre, double radius, int num) { return -1; }
+
+		/**
+		 * Faintest magnitude of returned stars.
+		 */
+		double getMagLimit () { return magLimit->getValueDouble (); }
+
+		void clearStars ();
+		void addStar (uint64_t id, double ra, double dec, double mag);
+
 	private:
 		rts2core::ValueRaDec *corner1;
 		rts2core::ValueRaDec *corner2;
 		rts2core::ValueInteger *numStars;
+		rts2core::ValueDouble *magLimit;
+
+		rts2core::ValueInteger *foundStars;
+		rts2core::ValueDouble *searchDuration;
+
+		rts2core::StringArray *starsId;
+		rts2core::DoubleArray *starsRa;
+		rts2core::DoubleArray *starsDec;
+		rts2core::DoubleArray *starsMag;
+
+		// send result values after search
+		int searchFinished (int ret, double start);
 };
 
 };
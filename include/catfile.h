@@ -0,0 +1,176 @@
+/*
+ * Memory mapped, HEALPix partitioned star catalogue.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_CATFILE__
+#define __RTS2_CATFILE__
+
+#include "healpix.h"
+
+#include <libnova/libnova.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#define CATFILE_MAGIC       "RTS2CAT"
+#define CATFILE_VERSION     2
+
+/**
+ * Catalogue file header. The header is followed by npix + 1 64bit indices
+ * of the first star of each HEALPix cell (last entry is number of stars),
+ * followed by array of catfile_star. Stars are sorted by (nested) HEALPix
+ * cell, inside cell by magnitude. Numbers are stored in host byte order.
+ */
+struct catfile_header
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t nside;
+	uint64_t nstars;
+};
+
+/**
+ * Star record in catalogue file. ID is 64bit, as some catalogues (Gaia
+ * source_id) do not fit into 32 bits.
+ */
+struct catfile_star
+{
+	double ra;
+	double dec;
+	uint64_t id;
+	float mag;
+};
+
+namespace rts2catd
+{
+
+/**
+ * Read-only access to memory mapped catalogue file. Only pages touched by
+ * queries are read from the disk, so catalogues larger than the available
+ * memory can be used.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class CatFile
+{
+	public:
+		CatFile ();
+		~CatFile ();
+
+		/**
+		 * Open and map catalogue file.
+		 *
+		 * @return -1 on error, 0 on success
+		 */
+		int openFile (const char *fn);
+
+		void closeFile ();
+
+		uint64_t getNStars () { return header ? header->nstars : 0; }
+
+		int getNside () { return header ? header->nside : 0; }
+
+		/**
+		 * Returns stars inside cone.
+		 *
+		 * @param centre  cone centre
+		 * @param radius  cone radius in degrees
+		 * @param maxmag  faintest magnitude
+		 * @param num     maximal number of stars to return; brightest stars are returned
+		 * @param result  stars sorted by magnitude. Pointers are valid till the file is closed.
+		 */
+		void coneSearch (struct ln_equ_posn *centre, double radius, float maxmag, size_t num, std::vector <const struct catfile_star *> &result);
+
+		/**
+		 * Returns stars inside RA/DEC box.
+		 *
+		 * @param c1  box corner
+		 * @param c2  opposite box corner. If c2 RA is smaller than c1 RA, box crosses 0h.
+		 */
+		void boxSearch (struct ln_equ_posn *c1, struct ln_equ_posn *c2, float maxmag, size_t num, std::vector <const struct catfile_star *> &result);
+
+	private:
+		void *map;
+		size_t mapSize;
+
+		const struct catfile_header *header;
+		const uint64_t *cellStart;
+		const struct catfile_star *stars;
+
+		rts2core::HealPix *healpix;
+
+		// stars from cells touching the cone, filtered by magnitude and by the given function
+		void searchCells (struct ln_equ_posn *centre, double radius, float maxmag, size_t num, struct ln_equ_posn *c1, struct ln_equ_posn *c2, std::vector <const struct catfile_star *> &result);
+};
+
+/**
+ * Writes catalogue file. Stars are added in two passes - first pass count
+ * stars in HEALPix cells, second pass writes stars to their final position.
+ * Memory requirements thus do not depend on the catalogue size.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class CatFileWriter
+{
+	public:
+		CatFileWriter (int _nside);
+		~CatFileWriter ();
+
+		/**
+		 * Count star for the first pass.
+		 */
+		void count (double ra, double dec);
+
+		/**
+		 * Create and map output file, sized for stars counted in the first pass.
+		 *
+		 * @return -1 on error, 0 on success
+		 */
+		int create (const char *fn);
+
+		/**
+		 * Add star in the second pass. Stars must be the same as in the first pass.
+		 *
+		 * @return -1 if star was not counted in the first pass
+		 */
+		int add (uint64_t id, double ra, double dec, float mag);
+
+		/**
+		 * Sort stars in cells by magnitude, write and close the file.
+		 *
+		 * @return -1 on error, 0 on success
+		 */
+		int finish ();
+
+		uint64_t getNStars () { return nstars; }
+
+	private:
+		rts2core::HealPix healpix;
+		std::vector <uint64_t> counts;
+		std::vector <uint64_t> cursor;
+		uint64_t nstars;
+
+		int fd;
+		void *map;
+		size_t mapSize;
+		struct catfile_star *stars;
+};
+
+}
+
+#endif // !__RTS2_CATFILE__
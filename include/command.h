@@ -47,6 +47,29 @@
  */
 #define COMMAND_INFO            "info"
 
+/**
+ * Subscribe values. @ingroup RTS2Command
+ *
+ * Parameters are minimal period (in seconds) between updates, deadband of
+ * numeric values, and optional list of value names. Without value names, all
+ * device values are subscribed. Device sends current values of the
+ * subscription before the command is finished. Afterwards it periodically
+ * calls info and pushes to the connection values which changed since the
+ * last push, followed by PROTO_PUSHED. Single info call serves all
+ * subscriptions which are due. New subscription replaces the previous one.
+ *
+ * @subsection Examples
+ *
+ *  - subscribe 10 0 CCD_TEMP CCD_SET
+ *  - subscribe 1 0.01
+ */
+#define COMMAND_SUBSCRIBE       "subscribe"
+
+/**
+ * Cancel value subscription. @ingroup RTS2Command
+ */
+#define COMMAND_UNSUBSCRIBE     "unsubscribe"
+
 
 /**
  * Move command. @ingroup RTS2Command
@@ -117,6 +140,11 @@
  */
 #define COMMAND_DATA_IN_FITS    "fits_data"
 
+/**
+ * Request binary framing of value updates on the connection.
+ */
+#define COMMAND_BINARY_VALUES   "binary_values"
+
 /**
  * Send by recipient connction to update image statistics. Can be used only
  * for FITS transfere data.
@@ -139,6 +167,17 @@
  */
 #define COMMAND_CCD_SHIFTSTORE  "shiftstore"
 
+/**
+ * Register connection as additional consumer of camera image data. Camera
+ * must run with data streaming enabled.
+ */
+#define COMMAND_CCD_STREAM      "stream_data"
+
+/**
+ * Stop sending image data to the connection.
+ */
+#define COMMAND_CCD_STREAM_STOP "stream_stop"
+
 /**
  * Open dome.
  */
@@ -391,14 +430,26 @@ class CommandSendKey:public Command
 		CommandSendKey (Block * _master, int _centrald_id, int _centrald_num, int _key);
 		virtual int send ();
 
-		virtual int commandReturnOK (Connection * conn)
+		virtual int commandReturnOK (Connection * conn);
+		virtual int commandReturnFailed (int status, Connection * conn)
 		{
-			connection->setConnState (CONN_AUTH_OK);
+			connection->setConnState (CONN_AUTH_FAILED);
 			return -1;
 		}
+};
+
+/**
+ * Ask device to send value updates in binary value frames.
+ *
+ * @ingroup RTS2Command
+ */
+class CommandBinaryValues:public Command
+{
+	public:
+		CommandBinaryValues (Block * _master);
 		virtual int commandReturnFailed (int status, Connection * conn)
 		{
-			connection->setConnState (CONN_AUTH_FAILED);
+			logStream (MESSAGE_WARNING) << conn->getName () << " does not support binary values, using text protocol" << sendLog;
 			return -1;
 		}
 };
@@ -836,6 +887,32 @@ class CommandInfo:public Command
 		virtual int commandReturnFailed (int status, Connection * conn);
 };
 
+/**
+ * Subscribe device values.
+ *
+ * Success and failure are reported to the other DevClient of the connection
+ * by subscribed and subscriptionFailed calls. Devices not supporting
+ * subscription respond with error, so the client can fall back to periodic
+ * info calls.
+ *
+ * @ingroup RTS2Command
+ */
+class CommandSubscribe:public Command
+{
+	public:
+		/**
+		 * Create subscription command.
+		 *
+		 * @param _master    master block
+		 * @param period     minimal period (in seconds) between updates
+		 * @param deadband   minimal change of numeric values which is pushed
+		 * @param names      names of subscribed values, empty for all values
+		 */
+		CommandSubscribe (Block * _master, double period, double deadband, const std::list <std::string> &names);
+		virtual int commandReturnOK (Connection * conn);
+		virtual int commandReturnFailed (int status, Connection * conn);
+};
+
 /**
  * Send status info command.
  *
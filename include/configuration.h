@@ -114,6 +114,28 @@ class Configuration:public IniParser
 		 */
 		int getFlatProcessTimeout () { return astrometryTimeout; }
 
+		/**
+		 * Returns minimal number of sources detected on image for
+		 * astrometry to be run. Images with less sources are moved to
+		 * trash without calling astrometry.
+		 *
+		 * @return minimal number of sources, 0 if images should not be checked
+		 */
+		int getAstrometryMinSources () { return astrometryMinSources; }
+
+		/**
+		 * Returns path to catalogue used by native plate solver.
+		 *
+		 * @return catalogue path, empty string if native plate solver should not be used
+		 */
+		std::string getAstrometryCatalogue () { return astrometryCatalogue; }
+
+		/**
+		 * Returns maximal distance of the field centre from the telescope
+		 * position for native plate solver, in degrees.
+		 */
+		double getAstrometrySearchRadius () { return astrometrySearchRadius; }
+
 		/**
 		 * Returns minimal heigh for flat observations.
 		 *
@@ -375,6 +397,9 @@ class Configuration:public IniParser
 		bool storeSexadecimals;
 		ObjectCheck *checker;
 		int astrometryTimeout;
+		int astrometryMinSources;
+		std::string astrometryCatalogue;
+		double astrometrySearchRadius;
 		double minFlatHeigh;
 		double calibrationAirmassDistance;
 		double calibrationLunarDist;
@@ -43,6 +43,10 @@
 #include "valuelist.h"
 
 #define MAX_DATA    2000
+// binary values batch is send when it exceeds this size
+#define MAX_BINARY_VALUES_FRAME  65536
+// connection sending larger binary values frame is dropped
+#define MAX_BINARY_FRAME_SIZE    (16 * 1024 * 1024)
 
 /**
  * Identifier of shared data connection.
@@ -254,8 +258,76 @@ class Connection:public Object
 		 */
 		int sendBinaryData (int data_conn, int chan, char *data, size_t dataSize);
 
+		/**
+		 * Queue part of binary data for sending. Data are written
+		 * without blocking, remaining data are written when the socket
+		 * becomes writable. Messages send after queued data are
+		 * queued behind them. If more then write queue limit bytes
+		 * are waiting, the call blocks until half of the limit is
+		 * written, so a slow consumer cannot exhaust sender memory.
+		 *
+		 * @param data_conn  ID of data connection
+		 * @param chan       data channel
+		 * @param chunk      data to send; reference is taken for the time data are queued
+		 *
+		 * @return -1 on error, 0 on success
+		 */
+		int queueBinaryData (int data_conn, int chan, DataChunk *chunk);
+
+		/**
+		 * Set maximal number of bytes waiting in write queue. 0 means no limit.
+		 */
+		void setWriteQueueLimit (size_t limit) { writeQueueLimit = limit; }
+
+		/**
+		 * Return number of bytes waiting in write queue.
+		 */
+		size_t getWriteQueueSize () { return writeQueueSize; }
+
+		/**
+		 * Return time (in seconds) the oldest queued data waits for sending.
+		 */
+		double getWriteLag ();
+
+		/**
+		 * Return throughput (bytes per second) of queued writes since
+		 * last resetWriteStatistics call.
+		 */
+		double getWriteThroughput ();
+
+		void resetWriteStatistics ();
+
 		void endBinaryData (int data_conn);
 
+		/**
+		 * Enable binary framing of value updates. Set on device side
+		 * when client negotiated binary values with COMMAND_BINARY_VALUES.
+		 */
+		void setBinaryValues (bool _binaryValues) { binaryValues = _binaryValues; }
+
+		bool getBinaryValues () { return binaryValues; }
+
+		/**
+		 * Send value in binary value frame. Inside value batch, value
+		 * is appended to frame, which is send by endValueBatch.
+		 *
+		 * @param value  value to send
+		 *
+		 * @return -1 if value does not support binary encoding or cannot be send, 0 on success
+		 */
+		int sendBinaryValue (Value *value);
+
+		/**
+		 * Start batch of value updates. Binary values are collected to
+		 * a single frame until matching endValueBatch call.
+		 */
+		void beginValueBatch () { valueBatch++; }
+
+		/**
+		 * End batch of value updates, send collected binary values.
+		 */
+		int endValueBatch ();
+
 		/**
 		 * Image data will be transfered in shared memory, attachable by key.
 		 * Those functions are called by client. The receiving side can check in 
@@ -810,6 +882,63 @@ class Connection:public Object
 		// ID of outgoing data connection
 		int dataConn;
 
+		struct QueuedWrite
+		{
+			DataChunk *chunk;
+			// bytes of chunk already written
+			size_t offset;
+			// time the chunk was queued
+			double queued;
+		};
+
+		// data waiting for socket to become writable
+		std::list <QueuedWrite> writeQueue;
+		size_t writeQueueSize;
+		size_t writeQueueLimit;
+
+		double writeStatStart;
+		double writeStatBytes;
+
+		void queueWrite (DataChunk *chunk);
+
+		// binary values were negotiated for the connection
+		bool binaryValues;
+		int valueBatch;
+		// binary value records waiting to be send
+		std::string binaryValueFrame;
+
+		// received binary value frame
+		std::vector <char> binaryValueRead;
+		// bytes remaining to read to binaryValueRead
+		size_t binaryValueRest;
+
+		int flushBinaryValues ();
+
+		/**
+		 * Write data to socket. Data which cannot be written without
+		 * blocking are queued.
+		 */
+		int sendRawData (const char *data, size_t len);
+
+		void addBinaryValueData (const char *data, size_t len);
+
+		/**
+		 * Set values from received binary value frame.
+		 */
+		void processBinaryValues ();
+
+		/**
+		 * Write queued data.
+		 *
+		 * @param block   if true, wait until no more then target bytes remain in the queue
+		 * @param target  number of bytes which can remain queued
+		 *
+		 * @return -1 on error, 0 on success
+		 */
+		int flushWriteQueue (bool block, size_t target = 0);
+
+		void clearWriteQueue ();
+
 		// connectionTimeout in seconds
 		int connectionTimeout;
 		conn_state_t conn_state;
@@ -35,6 +35,47 @@ class ModbusError:public ConnError
 		}
 };
 
+/**
+ * Asynchronous Modbus TCP transaction. Response is framed by length field of
+ * the MBAP header, so the transaction does not need to know the response size.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class ModbusTransaction:public Transaction
+{
+	public:
+		ModbusTransaction (const std::string &_request, char _func, TransactionCallback *_callback, double _timeout, int _id);
+
+		virtual size_t frameLength (const char *buf, size_t len);
+
+		virtual bool expectsResponse () { return true; }
+
+		/**
+		 * True if device replied with exception code.
+		 */
+		bool isException ();
+
+		/**
+		 * True if response is reply (not exception) to the request.
+		 */
+		bool isValidReply ();
+
+		/**
+		 * Returns reply data, without MBAP header and function code.
+		 */
+		std::string getReplyData ();
+
+		/**
+		 * Decode registers from read holding/input registers reply.
+		 *
+		 * @return -1 if reply is not valid, or does not contain qty registers
+		 */
+		int getRegisters (uint16_t *reply_data, int16_t qty);
+
+	private:
+		char func;
+};
+
 /**
  * Modbus TCP/IP connection class.
  *
@@ -174,6 +215,30 @@ class ConnModbus: public ConnTCP
 		 * @throw            ConnError on error.
 		 */
 		void writeHoldingRegisterMask (int16_t reg, int16_t mask, int16_t val);
+
+		/**
+		 * Queue asynchronous function call. Callback receives
+		 * ModbusTransaction. As each request carries transaction ID,
+		 * requests can be pipelined with setPipelineDepth.
+		 *
+		 * @param func       function code
+		 * @param data       function data
+		 * @param data_size  size of function data
+		 * @param callback   callback called with the reply
+		 * @param timeout    transaction timeout in seconds
+		 * @param id         transaction identification for the callback
+		 */
+		void queueFunction (char func, const void *data, size_t data_size, TransactionCallback *callback, double timeout = 2, int id = 0);
+
+		void queueReadHoldingRegisters (int16_t start, int16_t qty, TransactionCallback *callback, double timeout = 2, int id = 0);
+
+		void queueReadInputRegisters (int16_t start, int16_t qty, TransactionCallback *callback, double timeout = 2, int id = 0);
+
+		void queueWriteHoldingRegister (int16_t reg, int16_t val, TransactionCallback *callback, double timeout = 2, int id = 0);
+
+	private:
+		// fill MBAP header and function code, increase transaction ID
+		std::string createRequest (char func, const void *data, size_t data_size);
 };
 
 //class ConnModbusTCP
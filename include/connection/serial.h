@@ -20,7 +20,7 @@
 #ifndef __RTS2_CONN_SERIAL__
 #define __RTS2_CONN_SERIAL__
 
-#include "connnosend.h"
+#include "transaction.h"
 #include <termios.h>
 
 namespace rts2core
@@ -52,7 +52,7 @@ typedef enum {NONE, ODD, EVEN} parityT;
  *
  * @author Petr Kubanek <petr@kubanek.net>
  */
-class ConnSerial: public ConnNoSend
+class ConnSerial: public ConnTransaction
 {
 	public:
 		/**
@@ -205,6 +205,13 @@ class ConnSerial: public ConnNoSend
 
 		int writeRead (const char* wbuf, int wlen, char *rbuf, int rlen, const char *endChar);
 
+	protected:
+		/**
+		 * Flush port input after transaction timeout, so late reply will
+		 * not be mistaken for reply to the next transaction.
+		 */
+		virtual void transactionTimeout (Transaction *t) { tcflush (sock, TCIFLUSH); }
+
 	private:
 		struct termios s_termios;
 
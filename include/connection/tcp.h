@@ -20,7 +20,7 @@
 #ifndef __RTS2_CONNECTION_TCP__
 #define __RTS2_CONNECTION_TCP__
 
-#include "connnosend.h"
+#include "transaction.h"
 #include "error.h"
 
 #include <ostream>
@@ -92,7 +92,7 @@ class ConnReceivingError:public ConnError
  *
  * @author Petr Kubanek <petr@kubanek.net>
  */
-class ConnTCP:public ConnNoSend
+class ConnTCP:public ConnTransaction
 {
 	public:
 		/**
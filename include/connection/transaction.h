@@ -0,0 +1,320 @@
+/*
+ * Asynchronous request/response transactions on device connections.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_CONN_TRANSACTION__
+#define __RTS2_CONN_TRANSACTION__
+
+#include "connnosend.h"
+
+#include <deque>
+#include <math.h>
+#include <string>
+#include <ostream>
+
+namespace rts2core
+{
+
+class Transaction;
+
+/**
+ * Receives notification about finished transaction.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class TransactionCallback
+{
+	public:
+		virtual ~TransactionCallback () {}
+
+		/**
+		 * Called when transaction finished - either response was
+		 * received, or transaction timed out or failed. Called from
+		 * the main loop, so values can be updated directly. Transaction
+		 * is deleted after the call returns.
+		 */
+		virtual void transactionFinished (Transaction *t) = 0;
+};
+
+typedef enum {TRANS_QUEUED, TRANS_SENT, TRANS_DONE, TRANS_TIMEOUT, TRANS_FAILED} trans_state_t;
+
+/**
+ * Single request/response exchange. Response framing is specified either by
+ * end character(s), or by fixed response length. Protocols with more
+ * complicated framing shall override Transaction::frameLength.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class Transaction
+{
+	public:
+		/**
+		 * Create transaction.
+		 *
+		 * @param _request   data sent to the device
+		 * @param _callback  callback called when transaction finishes, can be NULL
+		 * @param _timeout   timeout (in seconds) from queueing the transaction to its completion; when the transaction is retried, each retry gets the full timeout
+		 * @param _id        transaction identification for the callback
+		 */
+		Transaction (const std::string &_request, TransactionCallback *_callback, double _timeout = 2, int _id = 0);
+
+		virtual ~Transaction () {}
+
+		/**
+		 * Response ends with given character.
+		 */
+		void setEndChar (char _endChar) { endString = std::string (1, _endChar); responseLength = 0; }
+
+		/**
+		 * Response ends with given string.
+		 */
+		void setEndString (const char *_endString) { endString = std::string (_endString); responseLength = 0; }
+
+		/**
+		 * Response has fixed length.
+		 */
+		void setResponseLength (size_t _length) { responseLength = _length; endString = std::string (); }
+
+		/**
+		 * Transaction expects no response - it finishes once the request is written.
+		 */
+		void setNoResponse () { endString = std::string (); responseLength = 0; }
+
+		/**
+		 * Number of times the request is send again after it timed out
+		 * without response. Default is 0, transaction is not retried.
+		 */
+		void setRetries (int _retries) { retries = _retries; }
+
+		/**
+		 * Number of remaining retries.
+		 */
+		int getRetries () { return retries; }
+
+		/**
+		 * Returns length of the response at the start of the buffer.
+		 *
+		 * @param buf  received data
+		 * @param len  length of received data
+		 *
+		 * @return 0 if buffer does not yet hold complete response, response length otherwise
+		 */
+		virtual size_t frameLength (const char *buf, size_t len);
+
+		/**
+		 * True if transaction waits for a response.
+		 */
+		virtual bool expectsResponse () { return responseLength > 0 || endString.length () > 0; }
+
+		const std::string &getRequest () { return request; }
+		const std::string &getResponse () { return response; }
+
+		int getId () { return id; }
+		trans_state_t getState () { return state; }
+		bool isDone () { return state == TRANS_DONE; }
+
+		double getTimeout () { return timeout; }
+
+		/**
+		 * Time from sending the request to receiving the response.
+		 */
+		double getLatency () { return finished - sent; }
+
+		double getQueued () { return queued; }
+		double getDeadline () { return queued + timeout; }
+
+	protected:
+		std::string request;
+		std::string response;
+
+	private:
+		TransactionCallback *callback;
+		double timeout;
+		int id;
+		int retries;
+
+		std::string endString;
+		size_t responseLength;
+
+		trans_state_t state;
+		double queued;
+		double sent;
+		double finished;
+
+		friend class ConnTransaction;
+};
+
+/**
+ * Histogram of transaction latencies. Buckets are logarithmic, first bucket
+ * holds latencies bellow 0.5 ms, each following bucket doubles the upper limit.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class LatencyHistogram
+{
+	public:
+		LatencyHistogram () { reset (); }
+
+		void reset ();
+
+		void add (double latency);
+
+		unsigned long getCount () { return count; }
+		double getMean () { return count > 0 ? sum / count : NAN; }
+		double getMax () { return count > 0 ? max : NAN; }
+
+		/**
+		 * Upper limit of the bucket containing given percentile of the transactions.
+		 *
+		 * @param p   percentile (0-1)
+		 */
+		double getPercentile (double p);
+
+		/**
+		 * Upper limit (in seconds) of the given bucket.
+		 */
+		static double bucketLimit (int b) { return 0.0005 * (1 << b); }
+
+		friend std::ostream & operator << (std::ostream &_os, LatencyHistogram &h);
+
+	private:
+		// 0.5 ms .. 16 s, last bucket holds everything slower
+		unsigned long buckets[17];
+		unsigned long count;
+		double sum;
+		double max;
+};
+
+std::ostream & operator << (std::ostream &_os, LatencyHistogram &h);
+
+/**
+ * Connection able to run asynchronous transactions.
+ *
+ * Transactions are queued with queueTransaction. Once the first transaction
+ * is queued, connection adds itself to the master block, so its file
+ * descriptor becomes part of the main poll loop. Requests are written when
+ * the descriptor is writable, responses are collected as they arrive, and
+ * transaction callbacks are called once the response is complete or the
+ * transaction timed out. The daemon thus never waits for a slow device.
+ * Data received after a transaction timed out, until the next request is
+ * written, are late responses, and are dropped.
+ *
+ * Blocking calls of the connection can still be used, but not while
+ * transactions are in progress, as they would read transaction responses.
+ * That allows drivers to migrate to transactions call by call.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class ConnTransaction:public ConnNoSend
+{
+	public:
+		ConnTransaction (Block *_master);
+		ConnTransaction (int _sock, Block *_master);
+		virtual ~ConnTransaction ();
+
+		/**
+		 * Queue transaction. Connection takes ownership of the transaction.
+		 */
+		void queueTransaction (Transaction *t);
+
+		/**
+		 * Set maximal number of transactions sent to the device before
+		 * receiving the response to the first of them. Default is 1 -
+		 * request is sent only after response to the previous one was
+		 * received. Only protocols which process requests in order can use
+		 * larger values.
+		 */
+		void setPipelineDepth (size_t _depth) { pipelineDepth = _depth > 0 ? _depth : 1; }
+
+		/**
+		 * Number of queued and in-progress transactions.
+		 */
+		size_t transactionsPending () { return waiting.size () + inProgress.size (); }
+
+		LatencyHistogram & getLatencyHistogram () { return latencies; }
+
+		unsigned long getTransactionTimeouts () { return timeouts; }
+		unsigned long getTransactionRetries () { return retried; }
+		unsigned long getTransactionFailures () { return failures; }
+
+		virtual int add (Block *block);
+		virtual int receive (Block *block);
+		virtual int writable (Block *block);
+		virtual int idle ();
+
+		virtual void postEvent (Event *event);
+
+	protected:
+		virtual bool canDelete () { return false; }
+
+		/**
+		 * Fails all pending transactions.
+		 */
+		virtual void connectionError (int last_data_size);
+
+		/**
+		 * Called after transaction timed out, before its callback is
+		 * called. Connection may use it to drop stale data.
+		 */
+		virtual void transactionTimeout (Transaction *t) {}
+
+		/**
+		 * Log transaction traffic.
+		 */
+		void setTransactionDebug (bool _debug) { transactionDebug = _debug; }
+
+		/**
+		 * Fail all queued and in-progress transactions.
+		 */
+		void failTransactions (trans_state_t state);
+
+	private:
+		std::deque <Transaction *> waiting;
+		std::deque <Transaction *> inProgress;
+
+		std::string writeBuffer;
+		std::string readBuffer;
+
+		size_t pipelineDepth;
+		bool registered;
+		bool transactionDebug;
+		// set after transaction timed out, until the next request is written; data received meanwhile are late responses
+		bool flushPending;
+		// time of the deadline for which timer is set
+		double timerDeadline;
+
+		LatencyHistogram latencies;
+		unsigned long timeouts;
+		unsigned long failures;
+		unsigned long retried;
+
+		// move transactions from the queue to the write buffer
+		void startTransactions ();
+
+		void finishTransaction (Transaction *t, trans_state_t state);
+
+		// drop received data and data waiting in the socket
+		void flushInput ();
+
+		void checkDeadlines ();
+		void scheduleDeadline ();
+};
+
+}
+
+#endif // !__RTS2_CONN_TRANSACTION__
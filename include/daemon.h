@@ -22,6 +22,7 @@
 
 #include "block.h"
 #include "iniparser.h"
+#include "logqueue.h"
 #include "logstream.h"
 #include "value.h"
 #include "valuelist.h"
@@ -467,6 +468,12 @@ class Daemon:public rts2core::Block
 		virtual int initValues ();
 		virtual int idle ();
 
+		/**
+		 * Deliver queued log messages and update counters of dropped
+		 * messages.
+		 */
+		virtual void drainLogQueue ();
+
 		/**
 		 * Set info time to supplied date. Please note that if you use this function,
 		 * you should consider not calling standard info () routine, which updates
@@ -488,6 +495,25 @@ class Daemon:public rts2core::Block
 
 		double getInfoTime () { return info_time->getValueDouble (); }
 
+		/**
+		 * Calls info, and records the call in hardware info statistics
+		 * (info_calls and info_rate values). All info calls triggered by
+		 * clients or timers shall go through this method.
+		 *
+		 * @return info return value
+		 */
+		int callInfo ();
+
+		/**
+		 * Time of the last callInfo call, NAN if info was not yet called.
+		 */
+		double getLastInfoCall () { return lastInfoCall; }
+
+		/**
+		 * Send info_time value to the connection.
+		 */
+		void sendInfoTime (Connection *conn) { info_time->send (conn); }
+
 		/**
 		 * Get time from last info time in seconds (and second fractions).
 		 *
@@ -661,6 +687,17 @@ class Daemon:public rts2core::Block
 
 		ValueTime *info_time;
 
+		// hardware info statistics
+		ValueLong *infoCalls;
+		ValueDouble *infoRate;
+		double lastInfoCall;
+		double infoRateStart;
+		long infoRateCalls;
+
+		// info and debug log messages dropped because of full queue or rate limit, NULL for error and warning
+		ValueLong *logDropped[LOG_LEVELS];
+		ValueInteger *logRateLimit;
+
 		double idleInfoInterval;
 
 		bool doHupIdleLoop;
@@ -22,6 +22,7 @@
 
 #include <errno.h>
 #include <unistd.h>
+#include <map>
 #include <vector>
 
 // maximal number of shared clients
@@ -32,6 +33,85 @@ namespace rts2core
 
 class Connection;
 
+/**
+ * Reference counted block of binary data. Single chunk can be queued for
+ * sending on multiple connections, without being copied for each of them.
+ * The chunk is deleted when the last reference is released.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class DataChunk
+{
+	public:
+		/**
+		 * Create chunk with a copy of the data. Creator holds the
+		 * first reference and must call unref when it does not need
+		 * the chunk anymore.
+		 */
+		DataChunk (const char *_data, size_t _size);
+
+		void ref () { refCount++; }
+		void unref () { if (--refCount <= 0) delete this; }
+
+		const char *getData () { return data; }
+		size_t getSize () { return size; }
+
+	private:
+		~DataChunk () { delete[] data; }
+
+		char *data;
+		size_t size;
+		int refCount;
+};
+
+/**
+ * Pool of buffers for received data. Buffers of released data
+ * connections are kept and reused for next data of the same size, so
+ * successive images of the same size do not allocate memory. By default
+ * no free buffers are kept; the limit is set by the --data-pool option.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class DataPool
+{
+	public:
+		static DataPool *instance ();
+
+		/**
+		 * Return buffer of given size, either from the pool or newly allocated.
+		 */
+		char *allocate (size_t size);
+
+		/**
+		 * Return buffer to the pool. If the pool is full, buffer is deleted.
+		 */
+		void release (char *buf, size_t size);
+
+		/**
+		 * Allocate buffers in advance, so the first image does not need to allocate memory.
+		 *
+		 * @param size   buffer size
+		 * @param count  number of buffers
+		 */
+		void preallocate (size_t size, int count);
+
+		/**
+		 * Set maximal number of bytes held in free buffers.
+		 */
+		void setMaxFree (size_t _maxFree);
+
+		size_t getFreeSize () { return freeSize; }
+
+	private:
+		DataPool ();
+
+		static DataPool *pInstance;
+
+		std::multimap <size_t, char *> freeBuffers;
+		size_t freeSize;
+		size_t maxFree;
+};
+
 /**
  * Interface for varius DataRead classes.
  *
@@ -92,7 +172,8 @@ class DataRead:public DataAbstractRead
 		DataRead (size_t in_binaryReadDataSize, int in_type)
 		{
 			binaryReadDataSize = in_binaryReadDataSize;
-			binaryReadBuff = new char[binaryReadDataSize];
+			binaryReadBuffSize = binaryReadDataSize;
+			binaryReadBuff = DataPool::instance ()->allocate (binaryReadBuffSize);
 			binaryReadTop = binaryReadBuff;
 			binaryReadType = in_type;
 			binaryReadChunkSize = -1;
@@ -100,7 +181,7 @@ class DataRead:public DataAbstractRead
 
 		~DataRead (void)
 		{
-			delete[] binaryReadBuff;
+			DataPool::instance ()->release (binaryReadBuff, binaryReadBuffSize);
 		}
 
 		virtual int readDataSize (Connection *conn);
@@ -156,6 +237,9 @@ class DataRead:public DataAbstractRead
 		// when it is negative, there aren't any data waiting
 		size_t binaryReadDataSize;
 
+		// size of buffer, which is returned to the pool
+		size_t binaryReadBuffSize;
+
 		char *binaryReadBuff;
 		char *binaryReadTop;
 
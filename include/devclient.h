@@ -107,6 +107,24 @@ class DevClient:public Object
 		 */
 		virtual void infoFailed () {}
 
+		/**
+		 * Called when subscribed values were pushed from the device.
+		 * Values are updated when the call is made. Default
+		 * implementation handles it as successful info command.
+		 */
+		virtual void infoPushed () { infoOK (); }
+
+		/**
+		 * Callback for subscribe command returned with OK status.
+		 */
+		virtual void subscribed () {}
+
+		/**
+		 * Callback for subscribe command returned with failed status,
+		 * e.g. when device does not support subscriptions.
+		 */
+		virtual void subscriptionFailed () {}
+
 		virtual void idle ();
 
 		virtual void valueChanged (Value * value) {}
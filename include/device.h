@@ -27,6 +27,7 @@
 #include "hoststring.h"
 #include "command.h"
 #include "daemon.h"
+#include "subscription.h"
 
 namespace rts2core
 {
@@ -241,6 +242,12 @@ class Device:public Daemon
 		// only devices can send messages
 		virtual void sendMessage (messageType_t in_messageType, const char *in_messageString);
 
+		/**
+		 * Send batch of log records. All records are sent to a centrald
+		 * connection with a single write.
+		 */
+		virtual void sendMessages (LogRecord **records, size_t n);
+
 		/**
 		 * The interrupt call. This is called on every device on
 		 * interruption. The device shall react by switching back to
@@ -302,6 +309,8 @@ class Device:public Daemon
 
 		virtual void setWeatherState (bool good_weather, const char *msg);
 
+		virtual void postEvent (Event *event);
+
 		friend class MultiDev;
 
 	protected:
@@ -376,6 +385,8 @@ class Device:public Daemon
 
 		void setDeviceName (const char *n) { device_name = n; }
 
+		virtual void connectionRemoved (Connection *conn);
+
 	private:
 		std::list <HostString> centraldHosts;
 
@@ -397,6 +408,32 @@ class Device:public Daemon
 		CommandDeviceStatusInfo *deviceStatusCommand;
 
 		char *last_weathermsg;
+
+		std::map <Connection *, Subscription *> subscriptions;
+
+		/**
+		 * Process subscribe command.
+		 */
+		int subscribe (Connection *conn);
+
+		void removeSubscription (Connection *conn);
+
+		/**
+		 * Send subscribed values which changed.
+		 *
+		 * @param force  send all subscribed values
+		 */
+		void sendSubscription (Subscription *sub, bool force);
+
+		/**
+		 * Call info once for all due subscriptions, and push changes to them.
+		 */
+		void pushSubscriptions ();
+
+		/**
+		 * Set timer for the next subscription push.
+		 */
+		void scheduleSubscriptions ();
 };
 
 }
@@ -96,6 +96,12 @@
 /** Set target, run killall, don't run scriptends. */
 #define EVENT_SET_TARGET_KILL_NOT_CLEAR  26
 
+/** Deadline of asynchronous transaction. */
+#define EVENT_TRANSACTION_TIMEOUT        27
+
+/** Push values to subscribed connections. */
+#define EVENT_SUBSCRIPTION_PUSH          28
+
 // events number below that number shoudl be considered RTS2-reserved
 #define RTS2_LOCAL_EVENT         1000
 
@@ -0,0 +1,93 @@
+/*
+ * HEALPix sky tesselation.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_HEALPIX__
+#define __RTS2_HEALPIX__
+
+#include <vector>
+
+namespace rts2core
+{
+
+/**
+ * HEALPix (Hierarchical Equal Area isoLatitude Pixelization) of the sphere,
+ * in the NESTED numbering scheme. Cells of the same resolution have equal
+ * area, and cell of resolution nside contains cells 4 * pix .. 4 * pix + 3 of
+ * resolution 2 * nside.
+ *
+ * Used to index catalogues for fast cone searches. Coordinates are in degrees.
+ *
+ * @see Gorski et al., 2005, ApJ 622, 759
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class HealPix
+{
+	public:
+		/**
+		 * @param _nside  resolution, must be power of 2
+		 */
+		HealPix (int _nside);
+
+		int getNside () { return nside; }
+
+		/**
+		 * Number of cells covering the sphere.
+		 */
+		long getNpix () { return 12L * nside * nside; }
+
+		/**
+		 * Returns index of cell containing given position.
+		 */
+		long ang2pix (double ra, double dec);
+
+		/**
+		 * Returns centre of the cell.
+		 */
+		void pix2ang (long pix, double &ra, double &dec);
+
+		/**
+		 * Returns cells whose centres are closer than radius + margin
+		 * to the given position. If margin is at least maximal distance
+		 * of a point inside cell from the cell centre, all cells
+		 * intersecting the cone are returned.
+		 *
+		 * @param ra      cone centre RA
+		 * @param dec     cone centre DEC
+		 * @param radius  cone radius (degrees)
+		 * @param margin  margin added to the radius (degrees); if negative, cell radius estimate is used
+		 * @param cells   returned cell indices, sorted
+		 */
+		void queryDisc (double ra, double dec, double radius, double margin, std::vector <long> &cells);
+
+		/**
+		 * Upper estimate of maximal distance of a point inside the cell from the cell centre, in degrees.
+		 */
+		double maxCellRadius ();
+
+	private:
+		int nside;
+
+		// recursive descent for queryDisc, ns is resolution of the pix cell, r includes margin
+		void queryCell (int ns, long pix, double x, double y, double z, double r, std::vector <long> &cells);
+};
+
+}
+
+#endif // !__RTS2_HEALPIX__
@@ -0,0 +1,198 @@
+/*
+ * Lock-free queue of log records.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_LOGQUEUE__
+#define __RTS2_LOGQUEUE__
+
+#include <message.h>
+
+#include <pthread.h>
+#include <sys/time.h>
+#include <time.h>
+#include <vector>
+
+// length of log record text stored in the record, longer texts are copied to heap
+#define LOG_RECORD_TEXT       472
+
+// number of records in per-thread ring, must be power of 2
+#define LOG_RING_SIZE         256
+
+// number of error and warning records held when rings of other than main thread are full
+#define LOG_OVERFLOW_SIZE     64
+
+// maximal time (in seconds) a thread waits for free overflow slot
+#define LOG_OVERFLOW_WAIT     1
+
+// number of levels - error (including critical), warning, info and debug
+#define LOG_LEVELS            4
+
+#define LOG_LEVEL_ERROR       0
+#define LOG_LEVEL_WARNING     1
+#define LOG_LEVEL_INFO        2
+#define LOG_LEVEL_DEBUG       3
+
+namespace rts2core
+{
+
+class App;
+
+/**
+ * Single log record. Fields are kept separated, so receivers can use
+ * message type, time and originating thread without parsing the text.
+ */
+struct LogRecord
+{
+	struct timeval time;
+	messageType_t type;
+	// index of ring (thread) which produced the record
+	uint16_t thread;
+	uint32_t len;
+	// copy of text which does not fit into the record, NULL otherwise
+	char *longText;
+	char text[LOG_RECORD_TEXT];
+
+	const char *getText () const { return longText != NULL ? longText : text; }
+};
+
+/**
+ * Ring of records produced by a single thread. Only owner thread advances
+ * head, only draining thread advances tail.
+ */
+struct LogRing
+{
+	LogRecord records[LOG_RING_SIZE];
+	uint32_t head;
+	uint32_t tail;
+	// head at the time of the last drain, used only by draining thread
+	uint32_t drainHead;
+	// info and debug records dropped because ring was full, written only by producer
+	uint32_t dropped[LOG_LEVELS];
+	// 1 if ring is owned by a running thread
+	int inUse;
+	uint16_t index;
+	LogRing *next;
+};
+
+/**
+ * Queue of log records. Each thread writes records to its own lock-free
+ * ring, so logging never blocks nor takes a lock. Rings are drained from
+ * the main loop, which passes records in batches to App::sendMessages.
+ *
+ * Info and debug records can be rate limited. Number of records dropped due
+ * to full ring or rate limit is counted per level. Error and warning records
+ * are never dropped - when ring of the main thread is full, it is drained in
+ * place; records of other threads are put to a small overflow list, and the
+ * thread waits for a while when the list is full. Texts longer than the
+ * record are copied to heap, and are released after the record is drained.
+ *
+ * Rings of finished threads are reused by new threads and are released only
+ * with the queue.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class LogQueue
+{
+	public:
+		/**
+		 * @param _app  application which receives records drained from full ring of the main thread
+		 */
+		LogQueue (App *_app = NULL);
+		~LogQueue ();
+
+		/**
+		 * Put record to calling thread ring. Safe to call from any
+		 * thread.
+		 */
+		void push (messageType_t type, const char *text);
+
+		/**
+		 * Pass all queued records, ordered by time, to the application.
+		 * Must be called only from one thread.
+		 *
+		 * @return number of passed records
+		 */
+		size_t drain (App *app);
+
+		/**
+		 * Set maximal number of info and debug records passed per second
+		 * for each of the levels. 0 disables the limit.
+		 */
+		void setRateLimit (int _rateLimit) { rateLimit = _rateLimit; }
+
+		/**
+		 * Returns number of dropped records of given level. Only info
+		 * and debug records are dropped.
+		 *
+		 * @param level  LOG_LEVEL_INFO or LOG_LEVEL_DEBUG
+		 */
+		unsigned long getDropped (int level);
+
+		/**
+		 * File descriptor which becomes readable when a record was
+		 * pushed from thread other than the one which created the
+		 * queue.
+		 */
+		int getWakeFD () { return wakePipe[0]; }
+
+		/**
+		 * Read all wake up bytes from wake pipe.
+		 */
+		void clearWake ();
+
+		static int getLevelIndex (messageType_t type);
+
+	private:
+		App *drainApp;
+		pthread_key_t ringKey;
+		pthread_t mainThread;
+		// true while drain is running, so records pushed from sendMessages are not drained recursively
+		bool draining;
+
+		// lock-free list of rings; rings are only added to the front
+		LogRing *rings;
+		uint16_t ringsNum;
+
+		int wakePipe[2];
+		int wakePending;
+
+		int rateLimit;
+		time_t rateSecond;
+		int rateCount[LOG_LEVELS];
+		unsigned long rateDropped[LOG_LEVELS];
+
+		std::vector <LogRecord *> batch;
+
+		// error and warning records which did not fit to full ring, allocated on heap
+		std::vector <LogRecord *> overflow;
+		std::vector <LogRecord *> overflowBatch;
+		pthread_mutex_t overflowMutex;
+		pthread_cond_t overflowCond;
+
+		LogRing *getRing ();
+
+		void pushOverflow (messageType_t type, uint16_t thread, const char *text, bool isMain);
+
+		static void fillRecord (LogRecord *rec, messageType_t type, uint16_t thread, const char *text);
+
+		static void releaseRing (void *ring);
+};
+
+}
+
+#endif // !__RTS2_LOGQUEUE__
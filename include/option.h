@@ -58,6 +58,8 @@
 
 #define OPT_DEFAULTS        1015
 
+#define OPT_BINARY_VALUES   1016
+
 /**
  * Start of local option number playground.
  */
@@ -0,0 +1,87 @@
+/*
+ * Recording of protocol lines.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_PROTORECORDER__
+#define __RTS2_PROTORECORDER__
+
+#include <fstream>
+
+namespace rts2core
+{
+
+class Connection;
+
+/**
+ * Records protocol lines received and send by all block connections.
+ *
+ * Each line of the recording holds time (seconds since 1970, with
+ * fraction), direction ('<' for received, '>' for send lines), name of the
+ * connection (- if connection does not have a name) and the protocol line.
+ * Recordings are replayed by rts2-protoreplay.
+ *
+ * Binary data and binary value frames are recorded only by their protocol
+ * header lines, payloads are not recorded. rts2-protoreplay refuses to
+ * replay sessions in which the daemon received binary data.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class ProtocolRecorder
+{
+	public:
+		static ProtocolRecorder *instance ();
+
+		/**
+		 * True if recording is active. Checked before record is called,
+		 * so protocol processing is not slowed when recording is off.
+		 */
+		static bool recording;
+
+		/**
+		 * Start recording to a file. Lines are appended to the file.
+		 *
+		 * @return -1 on error, 0 on success
+		 */
+		int open (const char *filename);
+
+		/**
+		 * Record protocol line.
+		 *
+		 * @param conn   connection which received or send the line
+		 * @param dir    '<' for received, '>' for send line
+		 * @param line   protocol line, without trailing new line
+		 */
+		void record (Connection *conn, char dir, const char *line);
+
+		/**
+		 * Stop recording.
+		 */
+		void close ();
+
+	private:
+		ProtocolRecorder ():os () { lastFlush = 0; }
+
+		static ProtocolRecorder *pInstance;
+
+		std::ofstream os;
+		double lastFlush;
+};
+
+}
+
+#endif // !__RTS2_PROTORECORDER__
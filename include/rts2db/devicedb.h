@@ -54,6 +54,19 @@ class DeviceDb:public rts2core::Device
 		 */
 		int initDB (const char *conn_name);
 
+		/**
+		 * Open named database connection and make it current
+		 * connection of the calling thread. ECPG connections cannot
+		 * be shared between threads, so every thread executing SQL
+		 * must open its own connection. Configuration must be
+		 * already loaded.
+		 *
+		 * @param conn_name   connection name, unique for the thread
+		 *
+		 * @return -1 on error, 0 on sucess.
+		 */
+		int connectDB (const char *conn_name);
+
 	protected:
 		virtual int willConnect (rts2core::NetworkAddress * in_addr);
 		virtual int processOption (int in_opt);
@@ -41,6 +41,20 @@ class MessageDB:public rts2core::Message
 		MessageDB (double in_messageTime, const char *in_messageOName, messageType_t in_messageType, const char *in_messageString);
 		virtual ~ MessageDB (void);
 		void insertDB ();
+
+		/**
+		 * Insert messages in a single transaction. If the
+		 * transaction fails, messages are inserted one by one.
+		 */
+		static void insertDB (std::vector <MessageDB> &messages);
+
+	private:
+		/**
+		 * Insert message without commit.
+		 *
+		 * @return false on error, transaction is then rolled back
+		 */
+		bool insert ();
 };
 
 /**
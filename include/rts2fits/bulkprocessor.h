@@ -0,0 +1,200 @@
+/*
+ * Parallel, resumable processing of large number of image files.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_BULKPROCESSOR__
+#define __RTS2_BULKPROCESSOR__
+
+#include <pthread.h>
+#include <stdio.h>
+
+#include <deque>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace rts2image
+{
+
+/**
+ * Single file (image) processed by BulkProcessor.
+ */
+struct BulkItem
+{
+	BulkItem (const char *_path, int _id, const char *_target, double _size)
+	{
+		path = std::string (_path);
+		id = _id;
+		if (_target != NULL)
+			target = std::string (_target);
+		size = _size;
+		status = 0;
+	}
+
+	std::string path;
+	// database ID (img_id), -1 if not known
+	int id;
+	// optional target path (for moves and copies)
+	std::string target;
+	// bytes processed, used for throughput reporting
+	double size;
+
+	// filled by processItem - 0 on success
+	int status;
+	std::string message;
+};
+
+/**
+ * Processes list of files in parallel. Items are split between worker
+ * threads, each worker takes items from front of its own queue and when it
+ * runs out of work, it steals from back of other workers queues.
+ *
+ * processItem is called from worker threads. Parts doing disk I/O should
+ * be guarded by IOSlot, so number of concurrent I/O operations can be set
+ * independently of number of threads.
+ *
+ * Finished items are collected by the calling thread and passed in
+ * batches to commitItems. This is the place for database updates, as
+ * database connection can be used only from the main thread. After
+ * commitItems returns, paths of successfully processed items are appended
+ * to the checkpoint file, and items listed in the checkpoint file are
+ * skipped when the processing is restarted.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class BulkProcessor
+{
+	public:
+		BulkProcessor ();
+		virtual ~BulkProcessor ();
+
+		/**
+		 * Number of worker threads. 0 (default) uses number of online CPUs.
+		 */
+		void setThreads (int _threads) { threads = _threads; }
+
+		/**
+		 * Maximal number of concurrent I/O operations. 0 (default)
+		 * means the same as number of threads.
+		 */
+		void setIOSlots (int _ioSlots) { ioSlots = _ioSlots; }
+
+		/**
+		 * Maximal number of items passed in one commitItems call.
+		 */
+		void setBatchSize (size_t _batchSize) { batchSize = _batchSize; }
+
+		/**
+		 * Interval (seconds) between throughput reports, 0 to disable reports.
+		 */
+		void setReportInterval (double _reportInterval) { reportInterval = _reportInterval; }
+
+		/**
+		 * Set checkpoint file. Items with path recorded in the file are
+		 * skipped.
+		 *
+		 * @return -1 if the file cannot be read or opened for writing
+		 */
+		int setCheckpoint (const char *filename);
+
+		void addItem (const char *path, int id = -1, const char *target = NULL, double size = 0);
+
+		size_t getItemsNum () { return items.size (); }
+
+		/**
+		 * Process all items.
+		 *
+		 * @return number of failed items
+		 */
+		int run ();
+
+		/**
+		 * Guard for I/O operations. Blocks until I/O slot is available.
+		 */
+		class IOSlot
+		{
+			public:
+				IOSlot (BulkProcessor *_bp);
+				~IOSlot ();
+			private:
+				BulkProcessor *bp;
+		};
+
+	protected:
+		/**
+		 * Process single item. Called from worker threads.
+		 *
+		 * @param item    item to process; status and message shall be set on failure
+		 * @param worker  worker index, 0 to number of threads - 1
+		 */
+		virtual void processItem (BulkItem *item, int worker) = 0;
+
+		/**
+		 * Called from thread which called run with batch of finished
+		 * items, including the failed ones.
+		 *
+		 * @return -1 if items cannot be committed; they will not be then
+		 * recorded in checkpoint file
+		 */
+		virtual int commitItems (std::vector <BulkItem *> &batch) { return 0; }
+
+		/**
+		 * Print throughput report.
+		 */
+		virtual void report (size_t done, size_t failed, size_t total, double bytes, double elapsed);
+
+	private:
+		std::vector <BulkItem *> items;
+
+		int threads;
+		int ioSlots;
+		size_t batchSize;
+		double reportInterval;
+
+		std::set <std::string> checkpointed;
+		FILE *checkpointFile;
+
+		// per worker queues of item indices
+		std::vector <std::deque <BulkItem *> > queues;
+		std::vector <pthread_mutex_t> queueMutex;
+
+		pthread_mutex_t ioMutex;
+		pthread_cond_t ioCond;
+		int ioFree;
+
+		pthread_mutex_t doneMutex;
+		pthread_cond_t doneCond;
+		std::vector <BulkItem *> done;
+		int runningWorkers;
+
+		BulkItem *nextItem (int worker);
+
+		void commit (std::vector <BulkItem *> &batch, size_t &failed);
+
+		struct workerArg
+		{
+			BulkProcessor *bp;
+			int worker;
+		};
+
+		static void *workerThread (void *arg);
+};
+
+}
+
+#endif // !__RTS2_BULKPROCESSOR__
@@ -0,0 +1,192 @@
+/*
+ * Combination of calibration frames.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_CALIBCOMBINE__
+#define __RTS2_CALIBCOMBINE__
+
+#include <fitsio.h>
+#include <pthread.h>
+
+#include <string>
+#include <vector>
+
+namespace rts2image
+{
+
+typedef enum {COMBINE_MEDIAN, COMBINE_MEAN, COMBINE_SIGMA} combine_method_t;
+
+/**
+ * Combines calibration frames (biases, darks, flats) to master frame.
+ * Frames are processed in strips of rows, so only strip of every frame is
+ * held in memory. Strips are combined in parallel, reads from FITS files are
+ * serialized.
+ *
+ * Median is calculated with selection network - Batcher odd-even merge
+ * sort network, reduced to comparators which influence the median. Sigma
+ * clipping uses the full sorting network to get robust initial centre and
+ * sigma. Networks are applied to blocks of pixels, so compare-exchange loops
+ * run over contiguous arrays and are vectorized by the compiler.
+ *
+ * Input frames can be of any type, they are converted to float on read.
+ * Master frame is written as float image. Output pixel is NaN if the pixel
+ * is NaN in any of the input frames; median and sigma clipping produce NaN
+ * for infinite values as well.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class CalibCombine
+{
+	public:
+		CalibCombine ();
+		~CalibCombine ();
+
+		void setMethod (combine_method_t _method) { method = _method; }
+
+		/**
+		 * Set rejection limits of sigma clipped mean, in standard
+		 * deviations below and above the centre.
+		 */
+		void setSigma (double _sigmaLow, double _sigmaHigh) { sigmaLow = _sigmaLow; sigmaHigh = _sigmaHigh; }
+
+		/**
+		 * Maximal number of sigma clipping iterations.
+		 */
+		void setIterations (int _iterations) { iterations = _iterations; }
+
+		/**
+		 * Number of threads. 0 (default) uses number of online CPUs.
+		 */
+		void setThreads (int _threads) { threads = _threads; }
+
+		/**
+		 * Maximal size of strip buffers in bytes. Output frame is not
+		 * included.
+		 */
+		void setMemoryLimit (size_t _memoryLimit) { memoryLimit = _memoryLimit; }
+
+		/**
+		 * Scale frames to unity median before combination. Should be
+		 * used for flat frames.
+		 */
+		void setNormalize (bool _normalize) { normalize = _normalize; }
+
+		/**
+		 * Add frame. Frame is opened and checked to have the same size
+		 * as the already added frames.
+		 *
+		 * @return -1 on error
+		 */
+		int addFrame (const char *filename);
+
+		size_t getFramesNum () { return frames.size (); }
+
+		/**
+		 * Combine frames and write result to new file.
+		 *
+		 * @return -1 on error
+		 */
+		int combine (const char *filename, bool overwrite = false);
+
+		/**
+		 * Combine frames to the provided buffer of width * height floats.
+		 *
+		 * @return -1 on error
+		 */
+		int combine (float *out);
+
+		long getWidth () { return width; }
+		long getHeight () { return height; }
+
+		/**
+		 * Returns number of rows in one strip, calculated from memory
+		 * limit, number of frames and threads.
+		 */
+		long getStripRows ();
+
+		/**
+		 * Returns number of comparators of median selection network.
+		 */
+		size_t getMedianNetworkSize () { buildNetwork (); return medianNetwork.size (); }
+
+		/**
+		 * Returns number of comparators of sorting network used for
+		 * sigma clipping.
+		 */
+		size_t getSortNetworkSize () { buildNetwork (); return sortNetwork.size (); }
+
+		/**
+		 * Returns scale of frame (1 / median when frames are normalized).
+		 */
+		double getScale (int f) { return frames[f].scale; }
+
+		/**
+		 * Returns time (in seconds) spend by the last combination.
+		 */
+		double getCombineTime () { return combineTime; }
+
+		/**
+		 * Process one strip. Called from parallelFor.
+		 */
+		void processStrip (int strip);
+
+	private:
+		struct frame
+		{
+			std::string filename;
+			fitsfile *fptr;
+			double scale;
+			double exposure;
+		};
+
+		std::vector <frame> frames;
+		long width;
+		long height;
+
+		combine_method_t method;
+		double sigmaLow;
+		double sigmaHigh;
+		int iterations;
+		int threads;
+		size_t memoryLimit;
+		bool normalize;
+
+		double combineTime;
+
+		// comparators of the full sorting network and of the median
+		// selection network
+		std::vector <std::pair <int, int> > sortNetwork;
+		std::vector <std::pair <int, int> > medianNetwork;
+		size_t networkFrames;
+
+		// strip processing state
+		float *output;
+		long stripRows;
+		bool failed;
+		pthread_mutex_t readMutex;
+		pthread_mutex_t bufferMutex;
+		std::vector <float *> freeBuffers;
+
+		int normalizeFrame (frame &f);
+		int readStrip (float *buf, long y, long rows);
+		void buildNetwork ();
+};
+
+}
+
+#endif // !__RTS2_CALIBCOMBINE__
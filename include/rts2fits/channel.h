@@ -22,8 +22,12 @@
 
 #include <vector>
 #include <malloc.h>
+#include <stdint.h>
 #include <sys/types.h>
 
+// number of bins of channel histogram
+#define CHANNEL_HISTOGRAM_BINS   65536
+
 namespace rts2image
 {
 
@@ -74,6 +78,32 @@ class Channel
 		long double getPixelSum () { return pixelSum; }
 		double getAverage () { return average; }
 		double getStDev () { return stdev; }
+		double getMin () { return min; }
+		double getMax () { return max; }
+		double getMedian () { return median; }
+
+		/**
+		 * Returns number of pixels used for statistics. NaN pixels
+		 * of floating point images are not counted.
+		 */
+		size_t getStatPixels () { return statPixels; }
+
+		/**
+		 * Returns approximate quantile, interpolated from histogram.
+		 * Exact for 8 and 16 bit integer data.
+		 *
+		 * @param q  quantile (0 - 1)
+		 */
+		double getQuantile (double q);
+
+		/**
+		 * Returns histogram computed by computeStatistics. Bin i counts
+		 * pixels with values from getHistogramLow () + i * getHistogramBinWidth ().
+		 * First and last bin also count values outside of histogram range.
+		 */
+		const std::vector <long> &getHistogram () { return histogram; }
+		double getHistogramLow () { return histLow; }
+		double getHistogramBinWidth () { return histWidth; }
 
 		const int16_t getDataType () { return dataType; }
 
@@ -90,6 +120,21 @@ class Channel
 
 		const char *getData () { return (char *) data; }
 
+		/**
+		 * Computes sum, average, standard deviation, minimum, maximum,
+		 * histogram and median in a single parallel pass over channel data.
+		 * Results are cached for data owned by the channel, which cannot
+		 * be modified through channel interface; calls for the same pixel
+		 * range return immediately. Data referenced from external buffers
+		 * can be rewritten by their owner, so their statistics are
+		 * recomputed on every call.
+		 *
+		 * 8 and 16 bit integer data are histogrammed with unit bins. Range
+		 * of other data types is estimated from sparse sample of pixels.
+		 *
+		 * @param _from      first pixel
+		 * @param _dataSize  number of pixels; 0 for all pixels
+		 */
 		void computeStatistics (size_t _from = 0, size_t _dataSize = 0);
 
 	private:
@@ -103,6 +148,24 @@ class Channel
 		long double pixelSum;
 		double average;
 		double stdev;
+		double min;
+		double max;
+		double median;
+		size_t statPixels;
+
+		std::vector <long> histogram;
+		double histLow;
+		double histWidth;
+		// true if histogram bins are single integer values
+		bool histExact;
+
+		bool statValid;
+		size_t statFrom;
+		size_t statSize;
+
+		template <typename dt> void computeDataStatistics (const dt *data, size_t totalPixels);
+
+		void clearStatistics ();
 
 		// channel number
 		int channelnum;
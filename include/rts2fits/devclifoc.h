@@ -27,6 +27,14 @@ class DevClientCameraFoc:public DevClientCameraImage
 		// when change == INT_MAX, focusing don't converge
 		virtual void focusChange (rts2core::Connection * focus);
 
+		/**
+		 * Detect sources on images with native source extractor. Sources
+		 * are stored in image sexResults, and their count and FWHM are
+		 * written to the image header, so they are available to the
+		 * focusing script.
+		 */
+		void setExtractSources (bool _extractSources) { extractSources = _extractSources; }
+
 	protected:
 		char *exe;
 
@@ -34,6 +42,7 @@ class DevClientCameraFoc:public DevClientCameraImage
 
 	private:
 		int isFocusing;
+		bool extractSources;
 
 };
 
@@ -0,0 +1,89 @@
+/*
+ * Fast reader of FITS primary header.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_FITSHEADER__
+#define __RTS2_FITSHEADER__
+
+#include <map>
+#include <string>
+
+namespace rts2image
+{
+
+/**
+ * Reads primary header of a FITS file without cfitsio. Only header blocks
+ * are read, the data are not touched, so it is much faster than opening
+ * the file as Image when only few header values are needed. As it does not
+ * use cfitsio, it can be used from multiple threads.
+ *
+ * Card values are stored as strings, with quotes of string values removed.
+ * COMMENT, HISTORY and blank cards are ignored, for repeated keywords the
+ * last value is kept.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class FitsHeader
+{
+	public:
+		FitsHeader () { headerSize = 0; }
+
+		/**
+		 * Read primary header.
+		 *
+		 * @return 0 on success, -1 on error (errno is set for I/O errors)
+		 */
+		int load (const char *filename);
+
+		bool hasKey (const char *key) { return cards.find (key) != cards.end (); }
+
+		/**
+		 * Returns value of the keyword, NULL if keyword is not present.
+		 */
+		const char *getString (const char *key);
+
+		/**
+		 * Returns keyword value converted to integer.
+		 *
+		 * @return -1 if keyword is missing or is not a number
+		 */
+		int getInteger (const char *key, long &value);
+
+		int getDouble (const char *key, double &value);
+
+		/**
+		 * Returns size of the primary header in bytes.
+		 */
+		size_t getHeaderSize () { return headerSize; }
+
+		/**
+		 * Returns expected size of primary header and data unit, calculated
+		 * from BITPIX and NAXISn. Returns 0 if header was not read.
+		 */
+		size_t getHDUSize ();
+
+	private:
+		std::map <std::string, std::string> cards;
+		size_t headerSize;
+
+		void parseCard (const char *card);
+};
+
+}
+
+#endif // !__RTS2_FITSHEADER__
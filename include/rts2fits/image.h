@@ -30,6 +30,8 @@
 
 #include "rts2fits/fitsfile.h"
 #include "rts2fits/channel.h"
+#include "rts2fits/sourceextractor.h"
+#include "rts2fits/platesolver.h"
 
 #include "libnova_cpp.h"
 #include "devclient.h"
@@ -68,16 +70,6 @@ namespace rts2image
 /** Image scaling functions. */
 typedef enum { SCALING_LINEAR, SCALING_LOG, SCALING_SQRT, SCALING_POW } scaling_type;
 
-/**
- * One pixel at the image, with coordinates and a value.
- */
-struct pixel
-{
-	int x;
-	int y;
-	unsigned short value;
-};
-
 struct stardata
 {
 	double X, Y, F, Fe, fwhm;
@@ -269,7 +261,8 @@ class Image:public FitsFile
 		void getImgHeader (struct imghdr *im_h, int chan);
 
 		/**
-		 * Build image histogram.
+		 * Build image histogram of values from 0 to 65535. Uses histograms
+		 * cached by Channel::computeStatistics.
 		 *
 		 * @param histogram array for calculated histogram
 		 * @param nbins     number of histogram bins
@@ -285,6 +278,13 @@ class Image:public FitsFile
 		 */
 		void getChannelHistogram (int chan, long *histogram, long nbins);
 
+		/**
+		 * Returns low and high quantiles of channel values, limited to
+		 * minval - mval range. Falls back to channel minimum and maximum,
+		 * or to full range, for flat images.
+		 */
+		template <typename dt> void getChannelQuantiles (int chan, dt minval, dt mval, float quantiles, dt &low, dt &high);
+
 
 		template <typename bt, typename dt> void getChannelGrayscaleByteBuffer (int chan, bt * &buf, bt black, dt low, dt high, long s, size_t offset, bool invert_y);
 
@@ -494,6 +494,17 @@ class Image:public FitsFile
 
 		int setAstroResults (double ra, double dec, double ra_err, double dec_err);
 
+		/**
+		 * Returns astrometry results, as set by setAstroResults.
+		 */
+		void getAstroResults (double &_ra, double &_dec, double &_ra_err, double &_dec_err)
+		{
+			_ra = pos_astr.ra;
+			_dec = pos_astr.dec;
+			_ra_err = ra_err;
+			_dec_err = dec_err;
+		}
+
 		int addStarData (struct stardata *sr);
 
 		double getPrecision ()
@@ -525,6 +536,11 @@ class Image:public FitsFile
 		 */
 		int getChannelNumber (int chan) { return channels[chan]->getChannelNumber (); }
 
+		/**
+		 * Returns channel, with cached statistics.
+		 */
+		Channel *getChannel (int chan) { return channels[chan]; }
+
 		long getChannelWidth (int chan) { return channels[chan]->getWidth (); }
 
 		long getChannelHeight (int chan) { return channels[chan]->getHeight (); }
@@ -684,18 +700,43 @@ class Image:public FitsFile
 		 */
 		double getExposureLST ();
 
-		// image processing routines and values
-		double classicMedian (double *q, int n, double *sigma);
-		int findMaxIntensity (unsigned short *in_data, struct pixel *ret);
-		unsigned short getPixel (unsigned short *data, int x, int y);
-		int findStar (unsigned short *data);
-		int aperture (unsigned short *data, struct pixel pix, struct pixel *ret);
-		int centroid (unsigned short *data, struct pixel pix, float *px, float *py);
-		int radius (unsigned short *data, double px, double py, int rmax);
-		int integrate (unsigned short *data, double px, double py, int size, float *ret);
+		/**
+		 * Detect sources on image channel with native source
+		 * extractor. Detected sources replace sexResults.
+		 *
+		 * @param chan       channel number
+		 * @param extractor  extractor with detection parameters, NULL for defaults
+		 *
+		 * @return number of sources stored in sexResults, -1 on error
+		 */
+		int extractSources (int chan = 0, SourceExtractor *extractor = NULL);
+
+		/**
+		 * Median FWHM of unflagged sources in sexResults, NAN if there
+		 * isn't any.
+		 */
+		double getSourcesFWHM ();
 
-		std::vector < pixel > list;
-		double median, sigma;
+		/**
+		 * Write number of sources and their median FWHM (SRCNUM and
+		 * FWHM keywords) to the image header.
+		 */
+		void writeSourcesStats ();
+
+		/**
+		 * Solve image astrometry with native plate solver. Sources are
+		 * extracted if sexResults is empty. Prior position is taken from
+		 * CRVAL, or from TELRA and TELDEC, pixel scale from CDELT1 if
+		 * solver scale is not set.
+		 *
+		 * @param solver  plate solver
+		 * @param sol     found solution
+		 * @param chan    channel number
+		 * @param write   if true, WCS keywords are written and setAstroResults is called on success
+		 *
+		 * @return 0 on success, -1 if image cannot be solved
+		 */
+		int solveAstrometry (PlateSolver &solver, plateSolution &sol, int chan = 0, bool write = true);
 
 		/**
 		 * Sets which values should be written to the image.
@@ -757,6 +798,9 @@ class Image:public FitsFile
 
 		void getHeaders ();
 
+		// adds histogram of channel values from 0 to 65535
+		void addChannelHistogram (Channel *ch, long *histogram, long nbins);
+
 		// if filename is NULL, will take name stored in this->getFileName ()
 		// if openFile will load header..
 		bool loadHeader;
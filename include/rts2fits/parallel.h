@@ -0,0 +1,100 @@
+/*
+ * Parallel loop over work items.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_PARALLEL__
+#define __RTS2_PARALLEL__
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <vector>
+
+namespace rts2image
+{
+
+/**
+ * Returns number of threads to use - given number, or number of online
+ * CPUs if threads is not positive.
+ */
+inline int parallelThreads (int threads)
+{
+	if (threads > 0)
+		return threads;
+	threads = sysconf (_SC_NPROCESSORS_ONLN);
+	return threads > 0 ? threads : 1;
+}
+
+template <class J> struct parallelCtx
+{
+	J *job;
+	void (J::*step) (int);
+	int next;
+	int count;
+	pthread_mutex_t mutex;
+};
+
+template <class J> void *parallelWorker (void *arg)
+{
+	parallelCtx <J> *ctx = (parallelCtx <J> *) arg;
+	while (true)
+	{
+		pthread_mutex_lock (&ctx->mutex);
+		int i = ctx->next++;
+		pthread_mutex_unlock (&ctx->mutex);
+		if (i >= ctx->count)
+			break;
+		(ctx->job->*(ctx->step)) (i);
+	}
+	return NULL;
+}
+
+/**
+ * Call job->step (i) for i in 0..count - 1, using up to threads threads.
+ * Items are handed out one by one, so they should be coarse. The calling
+ * thread works as well.
+ */
+template <class J> void parallelFor (J *job, void (J::*step) (int), int count, int threads)
+{
+	parallelCtx <J> ctx;
+	ctx.job = job;
+	ctx.step = step;
+	ctx.next = 0;
+	ctx.count = count;
+	pthread_mutex_init (&ctx.mutex, NULL);
+
+	std::vector <pthread_t> ths;
+	for (int i = 1; i < threads && i < count; i++)
+	{
+		pthread_t th;
+		if (pthread_create (&th, NULL, parallelWorker <J>, &ctx))
+			break;
+		ths.push_back (th);
+	}
+
+	parallelWorker <J> (&ctx);
+
+	for (typename std::vector <pthread_t>::iterator iter = ths.begin (); iter != ths.end (); iter++)
+		pthread_join (*iter, NULL);
+
+	pthread_mutex_destroy (&ctx.mutex);
+}
+
+}
+
+#endif // !__RTS2_PARALLEL__
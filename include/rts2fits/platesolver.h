@@ -0,0 +1,137 @@
+/*
+ * In-process plate solver.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_PLATESOLVER__
+#define __RTS2_PLATESOLVER__
+
+#include "catfile.h"
+
+#include <libnova/libnova.h>
+#include <vector>
+
+namespace rts2image
+{
+
+struct stardata;
+
+/**
+ * Result of plate solving. Linear WCS with gnomonic (TAN) projection.
+ */
+struct plateSolution
+{
+	// sky coordinates of the reference pixel
+	struct ln_equ_posn crval;
+	// reference pixel, 1-based
+	double crpix[2];
+	// CD1_1, CD1_2, CD2_1, CD2_2 matrix, degrees per pixel
+	double cd[4];
+	// pixel scale in arcsec/pixel
+	double scale;
+	// rotation angle in degrees, the same as CROTA2 of the FITS header
+	double rotation;
+	// true if image is mirrored (east is right when north is up)
+	bool flip;
+	// number of matched stars
+	int matched;
+	// RMS of matched star positions, in arcsec
+	double rms;
+};
+
+/**
+ * Matches detected sources to stars from local catalogue.
+ *
+ * Catalogue stars around prior position are projected to the tangent
+ * plane. Triangles formed from brightest sources and brightest catalogue
+ * stars are hashed by their side ratios, which do not depend on rotation,
+ * scale and position. Triangles with the same ratios and side lengths
+ * matching the expected pixel scale provide candidate transformations,
+ * which are verified against all sources. Candidates are verified in
+ * parallel threads; best transformation is refined by least squares fit
+ * of the linear WCS on all matched stars.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class PlateSolver
+{
+	public:
+		/**
+		 * @param _catalogue  catalogue used for solving
+		 */
+		PlateSolver (rts2catd::CatFile *_catalogue);
+
+		/**
+		 * Set expected pixel scale.
+		 *
+		 * @param _scale      expected scale in arcsec/pixel
+		 * @param _tolerance  relative tolerance of the scale (default 0.05)
+		 */
+		void setScale (double _scale, double _tolerance = 0.05) { scale = _scale; scaleTolerance = _tolerance; }
+
+		double getScale () { return scale; }
+
+		/**
+		 * Maximal distance of the field centre from the prior position, in
+		 * degrees (default 0.5).
+		 */
+		void setSearchRadius (double _searchRadius) { searchRadius = _searchRadius; }
+
+		/**
+		 * Faintest catalogue magnitude used (default 99 - no limit).
+		 */
+		void setMagLimit (float _magLimit) { magLimit = _magLimit; }
+
+		/**
+		 * Minimal number of matched stars of accepted solution (default 8).
+		 */
+		void setMinMatches (int _minMatches) { minMatches = _minMatches; }
+
+		/**
+		 * Set number of threads. 0 (default) uses number of online CPUs.
+		 */
+		void setThreads (int _threads) { threads = _threads; }
+
+		/**
+		 * Solve the field.
+		 *
+		 * @param sources  detected sources, with 1-based pixel coordinates
+		 * @param width    image width in pixels
+		 * @param height   image height in pixels
+		 * @param prior    expected position of the reference pixel
+		 * @param crpix1   reference pixel X (1-based)
+		 * @param crpix2   reference pixel Y (1-based)
+		 * @param sol      solution
+		 *
+		 * @return 0 on success, -1 if solution was not found
+		 */
+		int solve (std::vector <stardata> &sources, long width, long height, struct ln_equ_posn *prior, double crpix1, double crpix2, plateSolution &sol);
+
+	private:
+		rts2catd::CatFile *catalogue;
+
+		double scale;
+		double scaleTolerance;
+		double searchRadius;
+		float magLimit;
+		int minMatches;
+		int threads;
+};
+
+}
+
+#endif // !__RTS2_PLATESOLVER__
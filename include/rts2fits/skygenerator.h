@@ -0,0 +1,193 @@
+/*
+ * Synthetic sky image generator.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_SKYGENERATOR__
+#define __RTS2_SKYGENERATOR__
+
+#include "catfile.h"
+
+#include <libnova/libnova.h>
+#include <stdint.h>
+#include <vector>
+
+namespace rts2image
+{
+
+/**
+ * Star rendered by SkyGenerator.
+ */
+struct skyStar
+{
+	// 0-based pixel position
+	double x;
+	double y;
+	// total flux in ADU
+	double flux;
+};
+
+/**
+ * Generates synthetic sky frames: bias, sky background with linear
+ * gradient, stars with Gaussian PSF, cosmic rays, and noise. Noise combines
+ * read noise and photon noise of the signal; photon noise is approximated by
+ * Gaussian distribution, drawn from precomputed table of normal deviates.
+ *
+ * Frames are generated in bands of rows in parallel threads. Stars are
+ * stamped as separable PSFs, only into bands they touch. The same seed
+ * produces the same frame, regardless of number of threads.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class SkyGenerator
+{
+	public:
+		SkyGenerator ();
+
+		/**
+		 * Set bias level in ADU (default 1000).
+		 */
+		void setBias (double _bias) { bias = _bias; }
+
+		/**
+		 * Set read noise in ADU (default 5).
+		 */
+		void setReadNoise (double _readNoise) { readNoise = _readNoise; }
+
+		/**
+		 * Set gain in e-/ADU, used for photon noise (default 1).
+		 */
+		void setGain (double _gain) { gain = _gain; }
+
+		/**
+		 * Set sky level in ADU at image centre (default 200).
+		 */
+		void setSky (double _sky) { sky = _sky; }
+
+		/**
+		 * Set sky gradient, in ADU per pixel.
+		 */
+		void setGradient (double _gradientX, double _gradientY) { gradientX = _gradientX; gradientY = _gradientY; }
+
+		/**
+		 * Set FWHM of stars in pixels (default 3).
+		 */
+		void setFWHM (double _fwhm) { fwhm = _fwhm; }
+
+		/**
+		 * Set number of cosmic rays per frame (default 0).
+		 */
+		void setCosmics (int _cosmics) { cosmics = _cosmics; }
+
+		/**
+		 * Set saturation level in ADU. Defaults to NAN, which clips
+		 * only at limits of the data type.
+		 */
+		void setSaturation (double _saturation) { saturation = _saturation; }
+
+		/**
+		 * Set number of threads. 0 (default) uses number of online CPUs.
+		 */
+		void setThreads (int _threads) { threads = _threads; }
+
+		void clearStars () { stars.clear (); }
+
+		void addStar (double x, double y, double flux);
+
+		size_t getStarsNum () { return stars.size (); }
+
+		/**
+		 * Add stars at random positions. Number of stars grows with
+		 * decreasing flux as for uniformly distributed field stars.
+		 *
+		 * @param num      number of stars
+		 * @param width    image width
+		 * @param height   image height
+		 * @param maxFlux  flux of the brightest star in ADU
+		 * @param seed     random seed; the same seed generates the same stars
+		 */
+		void addRandomStars (int num, long width, long height, double maxFlux, uint64_t seed);
+
+		/**
+		 * Add stars from catalogue, projected to image with gnomonic
+		 * projection.
+		 *
+		 * @param catalogue  star catalogue
+		 * @param centre     sky position of image centre
+		 * @param width      image width
+		 * @param height     image height
+		 * @param scale      pixel scale in arcsec/pixel
+		 * @param rotation   rotation angle in degrees, the same as CROTA2 of the generated frame
+		 * @param zeroPoint  magnitude of star producing 1 ADU per second
+		 * @param exposure   exposure time in seconds
+		 * @param magLimit   faintest magnitude
+		 *
+		 * @return number of added stars
+		 */
+		int addCatalogueStars (rts2catd::CatFile *catalogue, struct ln_equ_posn *centre, long width, long height, double scale, double rotation, double zeroPoint, double exposure, float magLimit);
+
+		/**
+		 * Generate frame.
+		 *
+		 * @param data      image buffer, width * height pixels
+		 * @param dataType  one of the RTS2_DATA_* constants
+		 * @param width     image width
+		 * @param height    image height
+		 * @param seed      noise seed
+		 *
+		 * @return 0 on success, -1 on unknown data type
+		 */
+		int generate (void *data, int dataType, long width, long height, uint64_t seed);
+
+		/**
+		 * Generate sky field, as the dummy camera does. Stars are
+		 * taken from catalogue if it is specified, otherwise random
+		 * stars are generated at the same positions for every frame.
+		 *
+		 * @param catalogue    star catalogue, can be NULL
+		 * @param randomStars  number of random stars, used without catalogue
+		 * @param maxFlux      flux of the brightest random star in ADU
+		 * @param seed         noise seed
+		 *
+		 * @return number of stars in the field, -1 on unknown data type
+		 *
+		 * @see addCatalogueStars
+		 * @see generate
+		 */
+		int generateField (void *data, int dataType, long width, long height, rts2catd::CatFile *catalogue, struct ln_equ_posn *centre, double scale, double rotation, double zeroPoint, double exposure, float magLimit, int randomStars, double maxFlux, uint64_t seed);
+
+	private:
+		double bias;
+		double readNoise;
+		double gain;
+		double sky;
+		double gradientX;
+		double gradientY;
+		double fwhm;
+		int cosmics;
+		double saturation;
+		int threads;
+
+		std::vector <skyStar> stars;
+
+		// table of normal deviates
+		std::vector <float> normals;
+};
+
+}
+
+#endif // !__RTS2_SKYGENERATOR__
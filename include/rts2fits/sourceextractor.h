@@ -0,0 +1,142 @@
+/*
+ * Native source extraction.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_SOURCEEXTRACTOR__
+#define __RTS2_SOURCEEXTRACTOR__
+
+#include <vector>
+
+namespace rts2image
+{
+
+struct stardata;
+
+/** Source flags, same values as SExtractor FLAGS. */
+#define SOURCE_SATURATED      0x04
+#define SOURCE_TRUNCATED      0x08
+#define SOURCE_APER_INCOMPLETE 0x10
+
+/**
+ * In-process source detection and measurement.
+ *
+ * Works on data of any RTS2_DATA_* type. Processing follows SExtractor:
+ *
+ *  - background and its RMS are estimated on mesh of tiles, using
+ *    sigma-clipped mode, median filtered and bilinearly interpolated
+ *  - pixels of filtered image above threshold * RMS over background are
+ *    segmented to 8-connected components
+ *  - for each component with at least minimal area windowed
+ *    (XWIN/YWIN-like) centroid, circular aperture flux and its error and
+ *    FWHM are computed
+ *
+ * Background mesh, thresholding and source measurements run in parallel
+ * threads. Results are returned as stardata, with 1-based pixel
+ * coordinates (as X_IMAGE and Y_IMAGE of SExtractor), sorted by flux.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class SourceExtractor
+{
+	public:
+		SourceExtractor ();
+		~SourceExtractor ();
+
+		/**
+		 * Set size of background mesh tile in pixels (default 64).
+		 */
+		void setMeshSize (int _meshSize) { meshSize = _meshSize; }
+
+		/**
+		 * Set detection threshold, in RMS of background (default 1.5).
+		 */
+		void setThreshold (double _threshold) { threshold = _threshold; }
+
+		/**
+		 * Set minimal number of pixels above threshold (default 5).
+		 */
+		void setMinArea (int _minArea) { minArea = _minArea; }
+
+		/**
+		 * Set aperture radius in pixels (default 5).
+		 */
+		void setAperture (double _aperture) { aperture = _aperture; }
+
+		/**
+		 * Set detector gain in e-/ADU, used to calculate flux error.
+		 * 0 (default) ignores photon noise of the source.
+		 */
+		void setGain (double _gain) { gain = _gain; }
+
+		/**
+		 * Set saturation level. Sources with pixels above it are flagged
+		 * with SOURCE_SATURATED. NAN (default) disables the check.
+		 */
+		void setSaturation (double _saturation) { saturation = _saturation; }
+
+		/**
+		 * Filter image with 3x3 kernel before thresholding (default
+		 * true). Filtering suppresses detections of noise peaks.
+		 */
+		void setFilter (bool _filter) { filter = _filter; }
+
+		/**
+		 * Set number of threads. 0 (default) uses number of online CPUs.
+		 */
+		void setThreads (int _threads) { threads = _threads; }
+
+		/**
+		 * Detect and measure sources.
+		 *
+		 * @param data      image data
+		 * @param dataType  one of the RTS2_DATA_* constants
+		 * @param width     image width in pixels
+		 * @param height    image height in pixels
+		 * @param sources   detected sources will be appended to this vector
+		 *
+		 * @return number of detected sources, -1 on error (unknown data type)
+		 */
+		int extract (const void *data, int dataType, long width, long height, std::vector <stardata> &sources);
+
+		/**
+		 * Median background of the last extraction.
+		 */
+		double getBackground () { return background; }
+
+		/**
+		 * Median background RMS of the last extraction.
+		 */
+		double getBackgroundRms () { return backgroundRms; }
+
+	private:
+		int meshSize;
+		double threshold;
+		int minArea;
+		double aperture;
+		double gain;
+		double saturation;
+		bool filter;
+		int threads;
+
+		double background;
+		double backgroundRms;
+};
+
+}
+
+#endif // !__RTS2_SOURCEEXTRACTOR__
@@ -22,10 +22,13 @@
 #define __RTS2_ASYNCAPI__
 
 #include "httpreq.h"
+#include "valuejournal.h"
 #include "rts2fits/image.h"
 #include "xmlrpc++/XmlRpc.h"
 #include "device.h"
 
+#include <map>
+
 namespace rts2json
 {
 
@@ -77,6 +80,11 @@ class AsyncAPI:public rts2core::Object
 		 */
 		virtual int idle () { return source == NULL; }
 
+		/**
+		 * Returns time when the call would like to send pending data, NAN if nothing is pending.
+		 */
+		virtual double nextFlush () { return NAN; }
+
 	protected:
 		JSONRequest *req;
 		XmlRpc::XmlRpcServerConnection *source;
@@ -110,6 +118,18 @@ class AsyncState
 /**
  * Asynchronous class for value and state changes. Used to handle the "push" method.
  *
+ * Without special parameters, each value and state change is send as a separate
+ * chunk. If _rate or _seq parameter is present, the call works in subscription
+ * mode - changes are collected and send in batches, at most _rate batches per
+ * second. Values changed more times between batches are send only once, with
+ * their last value. Values are taken from the server ValueJournal, so they are
+ * serialised once per change, not once per client. Each batch carries sequence
+ * number of the last journal record and the journal instance token; client can
+ * reconnect with _seq and _instance set to those, and will receive only
+ * changes it missed. If the changes are not available in the journal, or the
+ * instance does not match (server was restarted), full snapshot (marked with
+ * "full":true) is send.
+ *
  * @author Petr Kubanek <kubanek@fzu.cz>
  */
 class AsyncValueAPI:public AsyncAPI
@@ -126,14 +146,43 @@ class AsyncValueAPI:public AsyncAPI
 		 */
 		void sendAll (rts2core::Device *device);
 
+		virtual int idle ();
+
+		virtual double nextFlush ();
+
 	private:
 		// values registered for ASYNC API
 		std::list <AsyncState> states;
 		std::vector <std::string> devices;
 		std::vector <std::pair <std::string, std::string> > values;
 
+		// subscription mode
+		bool batch;
+		// minimal time between batches
+		double batchInterval;
+		double lastFlush;
+		// sequence number client received before reconnect
+		unsigned long resumeSeq;
+		// journal instance client saw resumeSeq from
+		std::string resumeInstance;
+		// next journal record to process
+		unsigned long journalSeq;
+		bool fullSnapshot;
+		rts2core::Device *master;
+
+		// pending values - either sequence number of journal record, or value serialised localy (with sequence number 0)
+		std::map <std::pair <std::string, std::string>, std::pair <unsigned long, std::string> > pendingValues;
+		std::map <std::string, std::string> pendingStates;
+
+		bool isSubscribed (const std::string &device, const char *valueName);
+
 		void sendState (std::list <AsyncState>::iterator astate, rts2core::Connection *_conn);
 		void sendValue (const std::string &device, rts2core::Value *_value);
+
+		// put into pending values changes from journal, which were not yet processed
+		void processJournal (ValueJournal *journal);
+		void sendAllValues (rts2core::Device *device);
+		void flush ();
 };
 
 /**
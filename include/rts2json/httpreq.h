@@ -63,6 +63,8 @@ class GetRequestAuthorized: public XmlRpc::XmlRpcServerGetRequest
 
 		virtual void execute (XmlRpc::XmlRpcSource *source, struct ::sockaddr_in *saddr, std::string path, XmlRpc::HttpParams *params, int &http_code, const char* &response_type, char* &response, size_t &response_length);
 
+		HTTPServer *getServer () { return http_server; }
+
 	protected:
 		/**
 		 * Received exact path and HTTP params. Returns response - MIME
@@ -178,13 +180,32 @@ class GetRequestAuthorized: public XmlRpc::XmlRpcServerGetRequest
 			memcpy (response, _os.str ().c_str (), response_length);
 		}
 
-		HTTPServer *getServer () { return http_server; }
+		/**
+		 * Decide if response to the request can be cached. Default
+		 * implementation does not cache anything. Requests returning
+		 * data which are expensive to generate and which does not
+		 * change often should override this method and fill policy
+		 * maximal age and mask of events invalidating the response.
+		 * Requests with side effects must never be cached.
+		 *
+		 * @param path    request path
+		 * @param params  request parameters
+		 * @param policy  cache policy, to be filled
+		 */
+		virtual void responseCachePolicy (const std::string &path, XmlRpc::HttpParams *params, CachePolicy &policy) {}
 
 	private:
 		HTTPServer *http_server;
 		rts2core::UserPermissions *userPermissions;
 
 		struct sockaddr_in *source_addr;
+
+		/**
+		 * Execute request, answer from response cache if possible. Sets
+		 * ETag header of cacheable responses and replies with 304 Not
+		 * Modified if client has the response already.
+		 */
+		void cachedExecute (XmlRpc::XmlRpcSource *source, std::string path, XmlRpc::HttpParams *params, int &http_code, const char* &response_type, char* &response, size_t &response_length);
 };
 
 class JSONRequest:public GetRequestAuthorized
@@ -29,6 +29,8 @@
 #include "block.h"
 #include "userpermissions.h"
 #include "rts2db/camlist.h"
+#include "responsecache.h"
+#include "valuejournal.h"
 
 namespace rts2json
 {
@@ -41,10 +43,14 @@ class AsyncAPI;
 class HTTPServer
 {
 	public:
-		HTTPServer ()
+		HTTPServer ():responseCache (), valueJournal ()
 		{
 			sumAsync = NULL;
 			numberAsyncAPIs = NULL;
+			cacheEnabled = NULL;
+			cacheHits = NULL;
+			cacheMisses = NULL;
+			cacheEntries = NULL;
 		}
 
 		/**
@@ -103,11 +109,59 @@ class HTTPServer
 		 */
 		void registerAPI (AsyncAPI *a);
 
-		void asyncIdle ();
+		/**
+		 * Delete finished asynchronous API calls, let active calls send
+		 * pending data.
+		 *
+		 * @return time in usec till the next batch of pushed values should be send, -1 if there is no pending batch
+		 */
+		long asyncIdle ();
+
+		/**
+		 * Returns journal of value changes, used by push subscriptions.
+		 */
+		ValueJournal *getValueJournal () { return &valueJournal; }
+
+		/**
+		 * Record value change to the journal. Must be called before
+		 * value change is distributed to asynchronous APIs.
+		 */
+		void recordValueChange (const char *device, rts2core::Value *value) { valueJournal.record (device, value); }
+
+		/**
+		 * Returns cache for responses, or NULL if response caching is disabled.
+		 */
+		ResponseCache *getResponseCache ()
+		{
+			if (cacheEnabled != NULL && cacheEnabled->getValueBool () == false)
+				return NULL;
+			return &responseCache;
+		}
+
+		/**
+		 * Invalidate cached responses.
+		 *
+		 * @param events  mask of CACHE_INVALIDATE_xxx events
+		 * @param device  name of the device generating the event, NULL if the event is not device specific
+		 */
+		void invalidateCache (int events, const char *device = NULL);
+
+		/**
+		 * Records cache hit or miss.
+		 */
+		void cacheHit (bool hit);
 
 	protected:
 		rts2core::ValueInteger *numberAsyncAPIs;
 		rts2core::ValueInteger *sumAsync;
+
+		rts2core::ValueBool *cacheEnabled;
+		rts2core::ValueLong *cacheHits;
+		rts2core::ValueLong *cacheMisses;
+		rts2core::ValueInteger *cacheEntries;
+
+		ResponseCache responseCache;
+		ValueJournal valueJournal;
 		std::list <rts2json::AsyncAPI *> asyncAPIs;
 
 		bool auth_localhost;
@@ -92,6 +92,9 @@ class JpegImageRequest: public rts2json::GetRequestAuthorized
 		JpegImageRequest (const char* prefix, rts2json::HTTPServer *_http_server, XmlRpc::XmlRpcServer* s):rts2json::GetRequestAuthorized (prefix, _http_server, NULL, s) {}
 
 		virtual void authorizedExecute (XmlRpc::XmlRpcSource *source, std::string path, XmlRpc::HttpParams *params, const char* &response_type, char* &response, size_t &response_length);
+
+	protected:
+		virtual void responseCachePolicy (const std::string &path, XmlRpc::HttpParams *params, CachePolicy &policy);
 };
 
 /**
@@ -105,6 +108,10 @@ class JpegPreview:public rts2json::GetRequestAuthorized
 		JpegPreview (const char* prefix, rts2json::HTTPServer *_http_server, const char *_dirPath, XmlRpc::XmlRpcServer *s):rts2json::GetRequestAuthorized (prefix, _http_server, "JPEG image preview", s) { dirPath = _dirPath; }
 
 		virtual void authorizedExecute (XmlRpc::XmlRpcSource *source, std::string path, XmlRpc::HttpParams *params, const char* &response_type, char* &response, size_t &response_length);
+
+	protected:
+		virtual void responseCachePolicy (const std::string &path, XmlRpc::HttpParams *params, CachePolicy &policy);
+
 	private:
 		const char *dirPath;
 };
@@ -38,6 +38,13 @@ class JSONDBRequest:public JSONRequest
 		JSONDBRequest (const char *prefix, HTTPServer *_http_server, XmlRpc::XmlRpcServer* s):JSONRequest (prefix, _http_server, s) {}
 
 	protected:
+		/**
+		 * Cache policy for DB requests. Target listings are cached until
+		 * targets are modified through the API, or for a minute, as the
+		 * database can be modified by other programmes.
+		 */
+		virtual void responseCachePolicy (const std::string &path, XmlRpc::HttpParams *params, CachePolicy &policy);
+
 		/**
 		 * Process JSON API DB requests.
 		 */
@@ -0,0 +1,205 @@
+/*
+ * Cache for HTTP responses.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_RESPONSECACHE__
+#define __RTS2_RESPONSECACHE__
+
+#include <map>
+#include <set>
+#include <string>
+
+#include "xmlrpc++/XmlRpcServerGetRequest.h"
+
+/** Cached response does not depend on any event, it expires only after its maximal age. */
+#define CACHE_INVALIDATE_NONE        0x00
+/** Cached response is invalidated by change of a device value. */
+#define CACHE_INVALIDATE_VALUE       0x01
+/** Cached response is invalidated by device state change. */
+#define CACHE_INVALIDATE_STATE       0x02
+/** Cached response is invalidated when new image arrives. */
+#define CACHE_INVALIDATE_IMAGE       0x04
+/** Cached response is invalidated by modification of targets in the database. */
+#define CACHE_INVALIDATE_TARGET      0x08
+/** Invalidate all cached responses. */
+#define CACHE_INVALIDATE_ALL         0xff
+
+// number of CACHE_INVALIDATE_xxx event bits
+#define CACHE_INVALIDATE_BITS        8
+
+// responses smaller than this are not worth compressing
+#define CACHE_GZIP_MIN_SIZE          512
+
+namespace rts2json
+{
+
+/**
+ * Describes how response to a request can be cached. Filled by
+ * GetRequestAuthorized::responseCachePolicy.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class CachePolicy
+{
+	public:
+		CachePolicy ():device (), validator ()
+		{
+			maxAge = -1;
+			invalidate = CACHE_INVALIDATE_NONE;
+		}
+
+		/**
+		 * Maximal age of the cached response in seconds. Response is
+		 * not cached if maximal age is not positive.
+		 */
+		double maxAge;
+
+		/**
+		 * Mask of CACHE_INVALIDATE_xxx events which invalidate the response.
+		 */
+		int invalidate;
+
+		/**
+		 * If not empty, only events originating from the given device invalidate the response.
+		 */
+		std::string device;
+
+		/**
+		 * Extra string appended to cache key. Can hold e.g. modification time of the file response was created from.
+		 */
+		std::string validator;
+};
+
+/**
+ * Single cached response. Holds response body, its strong entity tag and
+ * optionally precompressed gzip body.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class CachedResponse
+{
+	public:
+		CachedResponse (const char *_response_type, const char *_response, size_t _response_length, double _created, const CachePolicy &policy);
+
+		const char *getResponseType () { return response_type.c_str (); }
+		const std::string &getBody () { return body; }
+		const std::string &getETag () { return etag; }
+
+		/**
+		 * Returns true if response can be send with gzip content encoding.
+		 */
+		bool haveGzip () { return gzipBody.length () > 0; }
+		const std::string &getGzipBody () { return gzipBody; }
+
+		/**
+		 * Returns true if event with given mask originated on the device invalidates the response.
+		 */
+		bool invalidatedBy (int events, const char *_device);
+
+		bool expired (double now) { return now > expires; }
+
+		int getInvalidate () { return invalidate; }
+		const std::string &getDevice () { return device; }
+
+		double getCreated () { return created; }
+
+		/**
+		 * Returns memory occupied by the response.
+		 */
+		size_t getSize () { return body.length () + gzipBody.length (); }
+
+	private:
+		std::string response_type;
+		std::string body;
+		std::string gzipBody;
+		std::string etag;
+
+		double created;
+		double expires;
+		int invalidate;
+		std::string device;
+};
+
+/**
+ * Cache of responses to HTTP requests. Responses are keyed by request
+ * prefix, path and parameters. They are removed from the cache either after
+ * their maximal age expires, or when an event they depend on occurs.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class ResponseCache
+{
+	public:
+		ResponseCache (size_t _maxEntries = 500, size_t _maxSize = 64 * 1024 * 1024);
+		~ResponseCache ();
+
+		/**
+		 * Construct cache key from request path and parameters.
+		 * Parameters are sorted, so their order in the request does not matter.
+		 */
+		static std::string requestKey (const std::string &prefix, const std::string &path, XmlRpc::HttpParams *params, const std::string &validator);
+
+		/**
+		 * Find valid response in the cache.
+		 *
+		 * @return NULL if response for the key is not cached or its maximal age expired
+		 */
+		CachedResponse *find (const std::string &key, double now);
+
+		/**
+		 * Put response into cache. Replaces existing entry with the same key.
+		 *
+		 * @return cached response
+		 */
+		CachedResponse *add (const std::string &key, const char *response_type, const char *response, size_t response_length, double now, const CachePolicy &policy);
+
+		/**
+		 * Remove entries invalidated by given events.
+		 *
+		 * @param events  mask of CACHE_INVALIDATE_xxx events
+		 * @param device  name of device which generated the event, NULL if the event is not device specific
+		 */
+		void invalidate (int events, const char *device = NULL);
+
+		void clear ();
+
+		size_t size () { return entries.size (); }
+
+	private:
+		std::map <std::string, CachedResponse *> entries;
+
+		// keys of entries invalidated by the event bit, indexed by the
+		// device entry depends on ("" for entries of any device)
+		std::map <std::string, std::set <std::string> > eventIndex[CACHE_INVALIDATE_BITS];
+
+		size_t maxEntries;
+		size_t maxSize;
+		size_t currentSize;
+
+		void remove (std::map <std::string, CachedResponse *>::iterator iter);
+
+		// remove all entries with keys in the set
+		void removeKeys (const std::set <std::string> &keys);
+
+		// make space for a new entry - remove expired, than the oldest entries
+		void expire (double now, size_t newSize);
+};
+
+}
+
+#endif // !__RTS2_RESPONSECACHE__
@@ -0,0 +1,117 @@
+/*
+ * Journal of serialised value changes.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_VALUEJOURNAL__
+#define __RTS2_VALUEJOURNAL__
+
+#include <deque>
+#include <string>
+
+#include "value.h"
+
+namespace rts2json
+{
+
+/**
+ * Single value change, serialised to JSON.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class ValueChangeRecord
+{
+	public:
+		ValueChangeRecord (unsigned long _seq, const std::string &_device, const std::string &_name, const std::string &_json):device (_device), name (_name), json (_json)
+		{
+			seq = _seq;
+		}
+
+		unsigned long seq;
+		std::string device;
+		std::string name;
+		// "name":value, as produced by jsonValue
+		std::string json;
+};
+
+/**
+ * Journal of the last value changes. Each change is serialised only once,
+ * and all push clients share the serialised record. Records are numbered with
+ * increasing sequence numbers, so clients can reconnect and receive changes
+ * they missed, as long as the changes are still in the journal.
+ *
+ * Sequence numbers start from 1 after every server start. Journal is
+ * identified by instance token, created from start time and process ID, so
+ * clients can detect server restart and do not resume with stale numbers.
+ *
+ * Journal is disabled until the first client asks for it, so servers without
+ * subscription clients do not pay for serialisation.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class ValueJournal
+{
+	public:
+		ValueJournal (size_t _maxRecords = 4096);
+
+		void enable () { enabled = true; }
+		bool isEnabled () { return enabled; }
+
+		/**
+		 * Serialise value change and append it to the journal.
+		 *
+		 * @return new record, NULL if journal is disabled
+		 */
+		const ValueChangeRecord *record (const char *device, rts2core::Value *value);
+
+		/**
+		 * Returns record with given sequence number, or NULL if the record was already removed from the journal.
+		 */
+		const ValueChangeRecord *find (unsigned long seq);
+
+		/**
+		 * Sequence number of the last recorded change, 0 if nothing was recorded yet.
+		 */
+		unsigned long lastSeq () { return nextSeq - 1; }
+
+		/**
+		 * Sequence number of the oldest record kept in the journal.
+		 */
+		unsigned long firstSeq () { return records.empty () ? nextSeq : records.front ().seq; }
+
+		/**
+		 * Returns true if all changes after given sequence number are still in the journal.
+		 */
+		bool canResume (unsigned long seq) { return seq > 0 && seq <= lastSeq () && seq + 1 >= firstSeq (); }
+
+		/**
+		 * Token identifying this journal instance. Sequence numbers
+		 * are valid only together with the token.
+		 */
+		const std::string &getInstance () { return instance; }
+
+	private:
+		std::deque <ValueChangeRecord> records;
+		size_t maxRecords;
+		unsigned long nextSeq;
+		bool enabled;
+		std::string instance;
+};
+
+}
+
+#endif // !__RTS2_VALUEJOURNAL__
@@ -102,6 +102,13 @@ class ConnImgOnlyProcess:public ConnProcess
 	private:
 		// normalize astrometry output and check if astrometry errors are reasonable
 		void checkAstrometry ();
+
+		/**
+		 * Solve image with native plate solver. On success astrometry
+		 * results are filled and astrometryStat is set to GET, so the
+		 * astrometry script is not called.
+		 */
+		void solveNative (rts2image::Image &image, const char *catalogue);
 };
 
 /**
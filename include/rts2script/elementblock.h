@@ -226,7 +226,7 @@ class ElementWhileSod:public ElementBlock
 class ElementWhile:public ElementBlock
 {
 	public:
-		ElementWhile (Script * _script, rts2operands::Operand *_condition, int _max_cycles):ElementBlock (_script) { condition = _condition; max_cycles = _max_cycles; }
+		ElementWhile (Script * _script, rts2operands::Operand *_condition, int _max_cycles):ElementBlock (_script), conditionCode () { condition = _condition; if (condition) condition->compile (conditionCode); max_cycles = _max_cycles; }
 		virtual ~ElementWhile () { delete condition; }
 
 		virtual void printScript (std::ostream &os);
@@ -234,6 +234,7 @@ class ElementWhile:public ElementBlock
 		virtual bool endLoop ();
 	private:
 		rts2operands::Operand *condition;
+		rts2expression::Bytecode conditionCode;
 		int max_cycles;
 };
 
@@ -245,15 +246,16 @@ class ElementWhile:public ElementBlock
 class ElementDo:public ElementBlock
 {
 	public:
-		ElementDo (Script *_script, int _max_cycles):ElementBlock (_script) { max_cycles = _max_cycles; condition = NULL; }
+		ElementDo (Script *_script, int _max_cycles):ElementBlock (_script), conditionCode () { max_cycles = _max_cycles; condition = NULL; }
 		virtual ~ElementDo () { delete condition; }
-		void setCondition (rts2operands::Operand *_condition) { condition = _condition; }
+		void setCondition (rts2operands::Operand *_condition) { delete condition; condition = _condition; conditionCode.clear (); if (condition) condition->compile (conditionCode); }
 
 		virtual void printScript (std::ostream &os);
 	protected:
 		virtual bool endLoop ();
 	private:
 		rts2operands::Operand *condition;
+		rts2expression::Bytecode conditionCode;
 		int max_cycles;
 };
 
@@ -62,12 +62,14 @@ class QueuedTarget:public rts2db::QueueEntry
 		{
 			target = qt.target;
 			unobservable_reported = qt.unobservable_reported;
+			simulationStarted = qt.simulationStarted;
 		}
 
 		QueuedTarget (const QueuedTarget &qt, rts2db::Target *_target):rts2db::QueueEntry (qt)
 		{
 			target = _target;
 			unobservable_reported = false;
+			simulationStarted = false;
 		}
 
 		~QueuedTarget () {}
@@ -82,6 +84,9 @@ class QueuedTarget:public rts2db::QueueEntry
 		bool hard;
 
 		bool unobservable_reported;
+
+		// observation of the entry was started in queue simulation
+		bool simulationStarted;
 };
 
 /**
@@ -129,7 +134,30 @@ class TargetQueue:public std::list <QueuedTarget>
 		// order by given target list
 		void orderByTargetList (std::list <rts2db::Target *> tl);
 
-		double getMaximalDuration (rts2db::Target *tar, struct ln_equ_posn *currentp = NULL, int runnum = 0);
+		virtual double getMaximalDuration (rts2db::Target *tar, struct ln_equ_posn *currentp = NULL, int runnum = 0);
+
+		/**
+		 * Return time when target constraints become violated.
+		 *
+		 * @see rts2db::Target::getSatisfiedDuration
+		 */
+		virtual double getSatisfiedDuration (rts2db::Target *tar, double from, double to, double length, double step);
+
+		/**
+		 * Return target horizontal coordinates. Used for queue sorting.
+		 */
+		virtual void getAltAz (rts2db::Target *tar, struct ln_hrz_posn *hrz, double JD);
+
+		/**
+		 * Return target hour angle (in degrees). Used for queue sorting.
+		 */
+		virtual double getHourAngle (rts2db::Target *tar, double JD);
+
+		/**
+		 * Returns true if target is above horizon at given time. Used
+		 * for queue sorting.
+		 */
+		virtual bool isAboveHorizon (rts2db::Target *tar, double JD);
 
 		/**
 		 * Put next target on front of the queue.
@@ -211,7 +239,22 @@ class TargetQueue:public std::list <QueuedTarget>
 		 */
 		virtual TargetQueue::iterator removeEntry (TargetQueue::iterator &iter, const removed_t reason) = 0;
 
-		bool isAboveHorizon (QueuedTarget &tar, double &JD);
+		virtual bool isAboveHorizon (QueuedTarget &tar, double &JD);
+
+		/**
+		 * Returns true if observation of queue entry was started.
+		 */
+		virtual bool observationStarted (QueuedTarget &qt) { return qt.target->observationStarted (); }
+
+		/**
+		 * Put front entry to the end of the queue, with fresh target.
+		 */
+		virtual void requeueFront ();
+
+		/**
+		 * Returns false if changes in the queue shall not be logged.
+		 */
+		virtual bool logChanges () { return true; }
 
 		// return true if its't time to remove first element from the queue. This is usaully when the
 		// second observation next time is before the current time
@@ -228,8 +271,6 @@ class TargetQueue:public std::list <QueuedTarget>
 		void filterUnobservable (double now, double maxLength, std::list <QueuedTarget> &skipped, bool removeObserved = true);
 };
 
-class SimulQueueTargets;
-
 enum first_ordering_t
 { ORDER_NONE, ORDER_HA, ORDER_SETFIRST };
 
@@ -290,12 +331,6 @@ class ExecutorQueue:public TargetQueue
 		 */
 		int selectNextObservation (int &pid, int &qid, bool &hard, double &next_time, double next_length, bool removeObserved = true);
 
-		/**
-		 * Simulate selection of next observation from the queue. Adjust sq list if 
-		 * observation is selected and will not be repeated.
-		 */
-		int selectNextSimulation (SimulQueueTargets &sq, double from, double to, double &e_end, struct ln_equ_posn *currentp, struct ln_equ_posn *nextp);
-
 		/**
 		 *
 		 * @param tryFirstPossible     try to set observation on the first possible place
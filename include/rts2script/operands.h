@@ -23,6 +23,7 @@
 #include "error.h"
 #include "utilsfunc.h"
 #include "block.h"
+#include "bytecode.h"
 
 #include <vector>
 #include <ostream>
@@ -48,6 +49,12 @@ class Operand
 		// return as number..
 		virtual double getDouble ();
 
+		/**
+		 * Append operand code to the bytecode program. Operands
+		 * which cannot be converted to number compile to an error.
+		 */
+		virtual void compile (rts2expression::Bytecode &bc) { bc.pushError ("Operand does not support conversion to double"); }
+
 		// return as string..
 
 		friend std::ostream & operator << (std::ostream &_os, Operand &_op)
@@ -66,6 +73,7 @@ class Number:public Operand
 	public:
 		Number (double _val) { val = _val; }
 		virtual double getDouble () { return val; }
+		virtual void compile (rts2expression::Bytecode &bc) { bc.pushConst (val); }
 		virtual std::ostream & writeTo (std::ostream &_os) { _os << getDouble (); return _os; }
 	private:
 		double val;
@@ -82,6 +90,7 @@ class SystemValue:public Operand
 	public:
 		SystemValue (rts2core::Block *_master, std::string _device, std::string _value):Operand () { master = _master; device = _device; value = _value; }
 		virtual double getDouble ();
+		virtual void compile (rts2expression::Bytecode &bc) { bc.pushValue (master, device.c_str (), value.c_str (), rts2expression::Bytecode::MISSING_NAN); }
 		virtual std::ostream & writeTo (std::ostream &_os) { _os << getDouble (); return _os; }
 	private:
 		rts2core::Block *master;
@@ -121,6 +130,7 @@ class RandomNumber:public Operand
 		~RandomNumber () { delete from; delete to; }
 
 		virtual double getDouble () { double f = from->getDouble (); return f + (to->getDouble () - f) * random_num (); }
+		virtual void compile (rts2expression::Bytecode &bc) { from->compile (bc); to->compile (bc); bc.pushRandom (); }
 
 		virtual std::ostream & writeTo (std::ostream &_os) { _os << getDouble (); return _os; }
 	
@@ -179,6 +189,8 @@ class OperandsLREquation:public Operand
 		 * Evaluate equation. Return 0 if it false, otherwise 1.
 		 */
 		virtual double getDouble ();
+
+		virtual void compile (rts2expression::Bytecode &bc);
 		
 		virtual std::ostream & writeTo (std::ostream &_os) { _os << l->getDouble () << getCmpSymbol () << r->getDouble (); return _os; }
 	private:
@@ -34,6 +34,8 @@
 #include "rts2fits/image.h"
 
 #include <list>
+#include <string>
+#include <vector>
 
 #define NEXT_COMMAND_STOP_TARGET       -3
 #define NEXT_COMMAND_NEXT              -2
@@ -138,6 +140,17 @@ class Script:public Object, public std::list <Element *>
 		 */
 		int setTarget (const char *cam_name, Rts2Target *target);
 
+		/**
+		 * Parse script from already retrieved script lines.
+		 *
+		 * @params cam_name Name of the camera.
+		 * @params target   Script target.
+		 * @params lines    Script lines, as returned by getScriptLines.
+		 *
+		 * @return 0 on success.
+		 */
+		int setTarget (const char *cam_name, Rts2Target *target, const std::vector <std::string> &lines);
+
 		virtual void postEvent (rts2core::Event * event);
 
 		/**
@@ -199,6 +212,14 @@ class Script:public Object, public std::list <Element *>
 		 */
 		double getExpectedDuration (struct ln_equ_posn *tel = NULL, int runnum = 0);
 
+		/**
+		 * Return time needed to move telescope from the current position to the target.
+		 *
+		 * @param tel  current telescope position (or NULL if it is unknow/unimportant).
+		 * @param pos  target position
+		 */
+		double getSlewDuration (struct ln_equ_posn *tel, struct ln_equ_posn *pos);
+
 		/**
 		 * Return expected script total of light time (shutter opened, system taking science data)
 		 */
@@ -338,6 +359,13 @@ template < typename T > int Script::nextCommand (T & device, Command ** new_comm
 
 typedef counted_ptr <Script> ScriptPtr;
 
+/**
+ * Retrieve all script lines for given camera from the target.
+ *
+ * @throw rts2core::Error if script cannot be retrieved
+ */
+void getScriptLines (const char *cam_name, Rts2Target *target, std::vector <std::string> &lines);
+
 /**
  * Return maximal script duration. Computes script's length for
  * all cameras, and return maximal duration.
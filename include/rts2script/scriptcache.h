@@ -0,0 +1,136 @@
+/*
+ * Cache of parsed target scripts.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_SCRIPTCACHE__
+#define __RTS2_SCRIPTCACHE__
+
+#include "rts2script/script.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace rts2script
+{
+
+/**
+ * Parsed script, used only to calculate script estimates. Expected duration
+ * is remembered for each run number, light time and number of images are
+ * calculated once.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class ScriptTemplate
+{
+	public:
+		/**
+		 * Parse script lines.
+		 *
+		 * @throw ParsingError if script cannot be parsed
+		 */
+		ScriptTemplate (const char *cam_name, Rts2Target *target, const std::vector <std::string> &_lines, unsigned long _hash);
+		~ScriptTemplate ();
+
+		/**
+		 * Returns true if template was created from the same script lines and target acquisition state.
+		 */
+		bool matches (const std::vector <std::string> &_lines, unsigned long _hash, bool _acquired) { return hash == _hash && acquired == _acquired && lines == _lines; }
+
+		/**
+		 * Expected duration of the script, without telescope movement.
+		 */
+		double getExpectedDuration (int runnum);
+
+		double getExpectedLightTime ();
+
+		int getExpectedImages ();
+
+		double getSlewDuration (struct ln_equ_posn *tel, struct ln_equ_posn *pos) { return script->getSlewDuration (tel, pos); }
+
+		float getTelescopeSettleTime () { return script->getTelescopeSettleTime (); }
+
+		float getTelescopeSpeed () { return script->getTelescopeSpeed (); }
+
+	private:
+		Script *script;
+		std::vector <std::string> lines;
+		unsigned long hash;
+		bool acquired;
+
+		std::map <int, double> durations;
+		double lightTime;
+		int images;
+};
+
+/**
+ * Process wide cache of parsed target scripts.
+ *
+ * Scripts are keyed by target ID and camera name. Script text is retrieved
+ * from target on every request, and the script is parsed again only if its
+ * text (or target acquisition state, which changes parsing of acquire
+ * commands) changed. Script edits thus invalidate cached entry
+ * automatically; invalidate shall be called when the script is changed,
+ * so the stale entry does not occupy memory.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class ScriptCache
+{
+	public:
+		static ScriptCache *instance ();
+
+		/**
+		 * Return parsed script for given camera and target.
+		 *
+		 * @throw rts2core::Error if script cannot be retrieved or parsed
+		 */
+		ScriptTemplate *getTemplate (const char *cam_name, Rts2Target *target);
+
+		/**
+		 * Return expected script duration, including time needed for telescope movement.
+		 *
+		 * @param cam_name  camera name
+		 * @param target    target
+		 * @param tel       current telescope position (or NULL if it is unknow/unimportant).
+		 * @param runnum    observation number
+		 */
+		double getExpectedDuration (const char *cam_name, Rts2Target *target, struct ln_equ_posn *tel = NULL, int runnum = 0);
+
+		/**
+		 * Remove all cached scripts of the target.
+		 */
+		void invalidate (int tar_id);
+
+		/**
+		 * Remove all cached scripts.
+		 */
+		void clear ();
+
+	private:
+		ScriptCache ():templates () {}
+		~ScriptCache ();
+
+		static ScriptCache *pInstance;
+
+		std::map <std::pair <int, std::string>, ScriptTemplate *> templates;
+};
+
+}
+
+#endif // !__RTS2_SCRIPTCACHE__
@@ -21,21 +21,173 @@
 #define __RTS2_SIMULQUEUE__
 
 #include "rts2script/executorque.h"
+#include "rts2db/constraints.h"
+
+#include <list>
+#include <map>
+#include <pthread.h>
 
 namespace rts2plan
 {
+
+/**
+ * Snapshot of target state used in queue simulation. Holds copy of target
+ * constraints, expected script durations, and target position and
+ * visibility computed at minute resolution over the simulated interval, so
+ * simulation does not need to access target, database or script cache.
+ *
+ * Computed positions are kept in the snapshot, so subsequent simulations of
+ * the same targets reuse them. They are dropped when target constraints are
+ * reloaded.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class SimulTarget
+{
+	public:
+		/**
+		 * @param _target  target; snapshot takes its ownership
+		 */
+		SimulTarget (rts2db::Target *_target);
+		~SimulTarget ();
+
+		/**
+		 * Refresh constraints and script durations, compute target
+		 * position and visibility from from to to. Must be called from
+		 * the main thread, as it accesses database and script cache.
+		 *
+		 * @param from  simulation start (seconds from 1/1/1970)
+		 * @param to    simulation end (seconds from 1/1/1970)
+		 */
+		void refresh (rts2db::CamList &cameras, struct ln_lnlat_posn *observer, double from, double to);
+
+		/**
+		 * Return target used to compute the snapshot. Simulation thread
+		 * must not call its methods, as they might access database.
+		 */
+		rts2db::Target *getTarget () { return target; }
+
+		/**
+		 * Return target position. Position is NAN outside of the simulated interval.
+		 */
+		void getPosition (struct ln_equ_posn *pos, double JD);
+
+		/**
+		 * Return target horizontal coordinates. Altitude and azimuth are NAN outside of the simulated interval.
+		 */
+		void getAltAz (struct ln_hrz_posn *hrz, double JD);
+
+		/**
+		 * Return target hour angle, NAN outside of the simulated interval.
+		 */
+		double getHourAngle (double JD);
+
+		/**
+		 * Return maximal script duration, including slew from currentp.
+		 *
+		 * @see rts2script::getMaximalScriptDuration
+		 */
+		double getMaximalDuration (struct ln_equ_posn *currentp, int runnum);
+
+		/**
+		 * Returns true if target is above horizon and, if testConstraints
+		 * is true, satisfies its constraints. Returns false outside of the
+		 * simulated interval.
+		 */
+		bool isAboveHorizon (double JD, bool testConstraints);
+
+		/**
+		 * Return time when target constraints become violated. Returns
+		 * INFINITY if constraints are satisfied till the end of the
+		 * simulated interval.
+		 *
+		 * @see rts2db::Target::getSatisfiedDuration
+		 */
+		double getSatisfiedDuration (double from, double to, double length, double step);
+
+	private:
+		rts2db::Target *target;
+
+		rts2db::Constraints *constraints;
+		// constraints from which the copy was made
+		rts2db::Constraints *sourceConstraints;
+		bool repeatsViolated;
+
+		struct scriptDuration
+		{
+			double first;
+			double next;
+			float settleTime;
+			float speed;
+		};
+
+		std::vector <scriptDuration> durations;
+		bool durationsValid;
+
+		// target position at simulation start, used to calculate slew
+		struct ln_equ_posn startPosition;
+
+		struct positionSample
+		{
+			struct ln_equ_posn pos;
+			struct ln_hrz_posn hrz;
+			double ha;
+			// bit 0 set if target is above horizon, bit 1 if constraints are satisfied
+			char visible;
+		};
+
+		// samples indexed by minute (JD * 1440)
+		std::map <long, positionSample> samples;
+
+		/**
+		 * Return sample for given time, NULL if it was not computed.
+		 */
+		positionSample *getSample (double JD);
+};
+
+/**
+ * Snapshots of targets, indexed by target ID.
+ */
+typedef std::map <int, SimulTarget *> SimulTargets;
+
 /**
  * Hold queue entries for simulation. As the code cannot remove observed
  * targets from real queues, it must create and fill queues for simulation.
+ * Entries point to targets held in SimulTarget snapshots, and queue
+ * settings are copied. Target positions, visibility and durations are
+ * taken from the snapshots, so the simulation can run outside of the main
+ * thread.
  */
 class SimulQueueTargets:public TargetQueue
 {
 	public:
-		SimulQueueTargets (ExecutorQueue &eq);
+		SimulQueueTargets (ExecutorQueue &eq, SimulTargets &_targets);
 		~SimulQueueTargets ();
 
 		void clearNext ();
 
+		/**
+		 * Simulate selection of next observation from the queue.
+		 *
+		 * @return ID of selected target, -1 if no target can be selected
+		 */
+		int selectNext (double from, double to, double &e_end, struct ln_equ_posn *currentp, struct ln_equ_posn *nextp);
+
+		virtual double getMaximalDuration (rts2db::Target *tar, struct ln_equ_posn *currentp = NULL, int runnum = 0);
+
+		virtual double getSatisfiedDuration (rts2db::Target *tar, double from, double to, double length, double step);
+
+		virtual void getAltAz (rts2db::Target *tar, struct ln_hrz_posn *hrz, double JD);
+
+		virtual double getHourAngle (rts2db::Target *tar, double JD);
+
+		virtual bool isAboveHorizon (rts2db::Target *tar, double JD);
+
+		/**
+		 * Start observation of the front entry.
+		 */
+		void startFront () { front ().simulationStarted = true; }
+
 	protected:
 		virtual int getQueueType () { return queueType; }
 		virtual const bool getSkipBelowHorizon () { return skipBelowHorizon; }
@@ -45,43 +197,72 @@ class SimulQueueTargets:public TargetQueue
 		virtual const bool getCheckTargetLength () { return checkTargetLength; }
 
 		virtual TargetQueue::iterator removeEntry (TargetQueue::iterator &iter, const removed_t reason);
+
+		virtual bool isAboveHorizon (QueuedTarget &qt, double &JD);
+		virtual bool observationStarted (QueuedTarget &qt) { return qt.simulationStarted; }
+		virtual void requeueFront ();
+		virtual bool logChanges () { return false; }
+
 	private:
+		SimulTargets *targets;
+
 		int queueType;
 		bool removeAfterExecution;
 		bool skipBelowHorizon;
 		bool testConstraints;
 		bool blockUntilVisible;
 		bool checkTargetLength;
+		bool queueEnabled;
+
+		SimulTarget *getSimulTarget (rts2db::Target *tar);
 };
 
 /**
  * Simulation queue. Allows to simulate observing run from queues.
  *
+ * Simulation runs in a background thread, on snapshots of queues and
+ * targets taken in start (). Steps computed by the thread are collected in
+ * step (), which creates selected targets and adds them to the queue, so
+ * results are available while the simulation progresses. Running
+ * simulation is cancelled when a new one is started.
+ *
  * @author Petr Kubanek <kubanek@fzu.cz>
  */
 class SimulQueue:public ExecutorQueue
 {
 	public:
-		SimulQueue (rts2db::DeviceDb *master, const char *name, struct ln_lnlat_posn **_observer, Queues *_queues);
+		SimulQueue (rts2db::DeviceDb *master, const char *name, struct ln_lnlat_posn **_observer, double _altitude, Queues *_queues);
 		virtual ~SimulQueue ();
 
+		/**
+		 * Take snapshot of queues and start simulation thread. Must be
+		 * called from the main thread.
+		 */
 		void start (double from, double to);
 
 		/**
-		 * Performs one step of the simulation.
+		 * Cancel running simulation and wait for its thread to finish.
+		 */
+		void cancel ();
+
+		/**
+		 * Retrieve next step of the simulation.
 		 *
-		 * @return Progress (0-1 range) of the simulation, 2 if simulation was done. Negative values means that queue target cannot be selected, but progress is reporetd anyway
+		 * @return Progress (0-1 range) of the simulation, 2 if simulation was done. Negative values means that queue target cannot be selected, but progress is reporetd anyway. NAN if the simulation thread did not yet compute next step.
 		 */
 		double step ();
 		
 		/**
 		 * Get simulation time.
 		 *
-		 * @return current simulation time. You can get simulation progress when calling step ().
+		 * @return simulation time of the last step retrieved by step ().
 		 * @see step()
 		 */
 		double getSimulationTime () { return t; } 
 
+		double getFrom () { return from; }
+		double getTo () { return to; }
+
 	private:
 		// list of simulation input queues
 
@@ -89,12 +270,34 @@ class SimulQueue:public ExecutorQueue
 
 		std::vector <SimulQueueTargets> sqs;
 
+		// target snapshots, kept between simulations
+		SimulTargets simulTargets;
+
 		double from;
-		double fr;
 		double to;
 		double t;
 
-		struct ln_equ_posn currentp;
+		struct simulStep
+		{
+			// ID of selected target, -1 if no target was selected
+			int tar_id;
+			double t_start;
+			double t_end;
+			// simulation time after the step
+			double t;
+			double progress;
+		};
+
+		pthread_t simulThread;
+		pthread_mutex_t stepsMutex;
+		bool running;
+		bool finished;
+		bool cancelled;
+		std::list <simulStep> steps;
+
+		static void *runSimulation (void *arg);
+
+		void run ();
 };
 
 }
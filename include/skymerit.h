@@ -0,0 +1,197 @@
+/*
+ * Sky brightness and photometric merit of observation targets.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_SKYMERIT__
+#define __RTS2_SKYMERIT__
+
+#include <libnova/ln_types.h>
+#include <string>
+#include <vector>
+
+namespace rts2core
+{
+
+/**
+ * Photometric properties of filter used by SkyMerit.
+ */
+struct meritFilter
+{
+	std::string name;
+	// electrons per second from star of magnitude 0 above atmosphere
+	double zeroPoint;
+	// extinction coefficient, magnitudes per airmass
+	double extinction;
+	// dark sky brightness at zenith, mag/arcsec^2
+	double darkSky;
+};
+
+/**
+ * Computes expected sky brightness, signal to noise ratio and merit of
+ * candidate targets at given time.
+ *
+ * Sky brightness is sum of dark sky brightened by airmass, twilight
+ * (modelled as function of Sun altitude) and scattered moonlight (model of
+ * Krisciunas and Schaefer, 1991, PASP 103, 1033). Signal to noise ratio of
+ * a point source is calculated from the CCD equation, with seeing growing
+ * with airmass. Merit is information gain per second, 0.5 log2 (1 + SNR^2)
+ * divided by exposure and overhead time, multiplied by target weight.
+ *
+ * Candidates are held in arrays. Sun and Moon ephemerides and sidereal time
+ * are calculated once for all candidates, and the only transcendental
+ * functions evaluated per candidate are a few exponentials, a square root
+ * and an arccosine.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class SkyMerit
+{
+	public:
+		SkyMerit ();
+
+		void setObserver (struct ln_lnlat_posn *_observer);
+
+		/**
+		 * Set zenith seeing (FWHM in arcsec, default 2), pixel scale
+		 * (arcsec/pixel, default 1), read noise (electrons, default 10)
+		 * and dark current (electrons/pixel/s, default 0).
+		 */
+		void setDetector (double _seeing, double _pixelScale, double _readNoise, double _darkCurrent = 0);
+
+		/**
+		 * Add filter. Returns index of the filter, used in addCandidate.
+		 */
+		int addFilter (const char *name, double zeroPoint, double extinction, double darkSky);
+
+		/**
+		 * Returns index of filter with given name, -1 if it was not added.
+		 */
+		int findFilter (const char *name);
+
+		void clearCandidates ();
+
+		/**
+		 * Add candidate target.
+		 *
+		 * @param ra        RA (degrees)
+		 * @param dec       DEC (degrees)
+		 * @param mag       target magnitude in the filter
+		 * @param filter    filter index
+		 * @param exposure  exposure time (seconds)
+		 * @param overhead  time spent outside of exposure - slew, readout,.. (seconds)
+		 * @param weight    multiplier of the merit, e.g. target priority
+		 *
+		 * @return candidate index
+		 */
+		int addCandidate (double ra, double dec, double mag, int filter, double exposure, double overhead = 0, double weight = 1);
+
+		/**
+		 * Update candidate position, e.g. for moving targets.
+		 */
+		void setCandidatePosition (int i, double ra, double dec);
+
+		size_t getCandidatesNum () { return ra.size (); }
+
+		/**
+		 * Calculate sky brightness, SNR and merit of all candidates.
+		 *
+		 * @param JD  Julian date
+		 */
+		void compute (double JD);
+
+		/**
+		 * Compute and return indices of candidates ordered by
+		 * decreasing merit. Candidates below horizon are not included.
+		 */
+		void rank (double JD, std::vector <int> &order);
+
+		double getSunAltitude () { return sunAlt; }
+		double getMoonAltitude () { return moonAlt; }
+
+		/**
+		 * Fraction of the Moon disc illuminated, 0 to 1.
+		 */
+		double getMoonIllumination () { return moonIllumination; }
+
+		/**
+		 * Candidate altitude, in degrees.
+		 */
+		double getAltitude (int i);
+
+		double getAirmass (int i) { return airmass[i]; }
+
+		/**
+		 * Distance of the candidate from the Moon, in degrees.
+		 */
+		double getMoonDistance (int i);
+
+		/**
+		 * Sky brightness at candidate position, mag/arcsec^2.
+		 */
+		double getSkyBrightness (int i);
+
+		double getSNR (int i) { return snr[i]; }
+
+		/**
+		 * Merit - weighted information gain per second. 0 for candidates below horizon.
+		 */
+		double getMerit (int i) { return merit[i]; }
+
+	private:
+		struct ln_lnlat_posn observer;
+		double sinLat;
+		double cosLat;
+
+		double seeing;
+		double pixelScale;
+		double readNoise;
+		double darkCurrent;
+
+		std::vector <meritFilter> filters;
+
+		// candidates
+		std::vector <double> ra;
+		std::vector <double> dec;
+		// precalculated sines and cosines
+		std::vector <double> sinRa;
+		std::vector <double> cosRa;
+		std::vector <double> sinDec;
+		std::vector <double> cosDec;
+		std::vector <double> mag;
+		std::vector <int> filter;
+		std::vector <double> exposure;
+		std::vector <double> overhead;
+		std::vector <double> weight;
+
+		// results; angles and brightness are converted in getters
+		std::vector <double> sinAltitude;
+		std::vector <double> airmass;
+		std::vector <double> cosMoonDistance;
+		// in nanoLamberts
+		std::vector <double> skyBrightness;
+		std::vector <double> snr;
+		std::vector <double> merit;
+
+		double sunAlt;
+		double moonAlt;
+		double moonIllumination;
+};
+
+}
+
+#endif // !__RTS2_SKYMERIT__
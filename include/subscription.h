@@ -0,0 +1,115 @@
+/*
+ * Value subscriptions.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_SUBSCRIPTION__
+#define __RTS2_SUBSCRIPTION__
+
+#include "value.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace rts2core
+{
+
+class Connection;
+
+/**
+ * Set of values subscribed by a connection.
+ *
+ * Values are pushed to the connection at most once per period. Only values
+ * which changed from the last push are send. Numeric values are send only if
+ * they changed by more than deadband. Each push ends with PROTO_PUSHED,
+ * which is send even if no value changed, so clients can use it as heartbeat.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class Subscription
+{
+	public:
+		/**
+		 * Create subscription.
+		 *
+		 * @param _conn      connection which subscribed values
+		 * @param _period    minimal period (in seconds) between pushes
+		 * @param _deadband  minimal change of numeric value which is pushed
+		 */
+		Subscription (Connection *_conn, double _period, double _deadband);
+
+		/**
+		 * Add value to the subscription. Subscription without values
+		 * holds all device values.
+		 */
+		void addValue (Value *val) { subscribed.push_back (val); }
+
+		bool subscribesAll () { return subscribed.empty (); }
+
+		bool isSubscribed (Value *val);
+
+		double getPeriod () { return period; }
+
+		/**
+		 * Time when values shall be pushed next time.
+		 */
+		double getNextPush () { return nextPush; }
+
+		bool isDue (double now) { return now >= nextPush; }
+
+		/**
+		 * Send value to the connection if it changed from the last
+		 * push.
+		 *
+		 * @param val    value to check
+		 * @param force  send value even if it did not change
+		 *
+		 * @return true if the value was send
+		 */
+		bool pushValue (Value *val, bool force = false);
+
+		/**
+		 * Finish push - send PROTO_PUSHED, and calculate time of the next push.
+		 */
+		void endPush (double now);
+
+		/**
+		 * Skip push when values cannot be retrieved, only calculate time of the next push.
+		 */
+		void skipPush (double now);
+
+	private:
+		Connection *conn;
+		double period;
+		double deadband;
+		double nextPush;
+
+		std::vector <Value *> subscribed;
+
+		struct sentValue
+		{
+			std::string str;
+			double dbl;
+		};
+
+		std::map <Value *, sentValue> lastSent;
+};
+
+}
+
+#endif // !__RTS2_SUBSCRIPTION__
@@ -0,0 +1,147 @@
+/*
+ * Readout layout of multi-tap cameras.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_TAPLAYOUT__
+#define __RTS2_TAPLAYOUT__
+
+#include <stddef.h>
+#include <vector>
+
+namespace rts2camd
+{
+
+/**
+ * How taps are interleaved in the raw readout buffer.
+ */
+typedef enum
+{
+	// pixel of each tap, followed by next pixel of each tap
+	TAP_PIXEL,
+	// row of each tap, followed by next row of each tap
+	TAP_LINE,
+	// whole frame of the first tap, followed by frames of other taps
+	TAP_BLOCK
+} tap_interleave_t;
+
+/**
+ * Declarative description of the raw readout buffer of multi-tap cameras,
+ * with kernels extracting taps from it.
+ *
+ * Tap rows in the raw buffer are in readout order, starting with prescan
+ * and ending with overscan pixels. Extraction strips prescan and overscan,
+ * optionally swaps bytes and flips taps read from the opposite side of the
+ * chip, and writes tap data directly to the destination buffer - usually
+ * Camera::getDataBuffer (chan). Swaps and flips are done on rows while they
+ * are in the cache. Pixel interleaved 16 bit data of 2, 4 or multiple of 8
+ * taps are deinterleaved with SSE2 when available.
+ *
+ * Layout can be specified as a string of whitespace separated keywords:
+ *
+ * <pre>
+ * taps=4 interleave=pixel bytes=2 prescan=8 overscan=16 flipx=1,3 flipy=2,3 order=0,1,3,2 swap
+ * </pre>
+ *
+ * order lists raw taps in channel order, so channel 2 is filled from raw tap 3
+ * in the example above.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class TapLayout
+{
+	public:
+		TapLayout ();
+
+		/**
+		 * Parse layout from string.
+		 *
+		 * @return -1 on error, 0 on success
+		 */
+		int parse (const char *spec);
+
+		/**
+		 * Set number of taps. Resets flips and order.
+		 */
+		void setTaps (int _taps);
+		int getTaps () { return taps; }
+
+		void setInterleave (tap_interleave_t _interleave) { interleave = _interleave; }
+
+		/**
+		 * Set number of bytes per pixel (1, 2, 4 or 8, default 2).
+		 */
+		void setPixelBytes (int _pixelBytes) { pixelBytes = _pixelBytes; }
+
+		/**
+		 * Set number of prescan and overscan pixels in each tap row.
+		 */
+		void setScan (int _prescan, int _overscan) { prescan = _prescan; overscan = _overscan; }
+
+		void setFlip (int tap, bool flipX, bool flipY);
+
+		/**
+		 * Swap bytes of pixels (for big endian data).
+		 */
+		void setByteSwap (bool _byteSwap) { byteSwap = _byteSwap; }
+
+		/**
+		 * Returns width of extracted tap row.
+		 *
+		 * @param rawWidth  width of tap row in raw buffer, including prescan and overscan
+		 */
+		long getDataWidth (long rawWidth) { return rawWidth - prescan - overscan; }
+
+		/**
+		 * Extract tap from raw buffer.
+		 *
+		 * @param raw       raw readout buffer
+		 * @param rawSize   size of raw buffer in bytes; rows not fully inside it are not written
+		 * @param rawWidth  width of tap row in raw buffer (in pixels, including prescan and overscan)
+		 * @param height    number of rows
+		 * @param chan      channel (position in order) to extract
+		 * @param dst       destination, getDataWidth (rawWidth) * height pixels
+		 *
+		 * @return number of extracted rows, -1 on invalid layout
+		 */
+		long extract (const void *raw, size_t rawSize, long rawWidth, long height, int chan, void *dst);
+
+		/**
+		 * Extract all taps in a single pass over raw buffer.
+		 *
+		 * @param dst  array of getTaps () destinations, indexed by channel. NULL entries are skipped.
+		 *
+		 * @see extract
+		 */
+		long extractAll (const void *raw, size_t rawSize, long rawWidth, long height, void **dst);
+
+	private:
+		int taps;
+		tap_interleave_t interleave;
+		int pixelBytes;
+		int prescan;
+		int overscan;
+		bool byteSwap;
+
+		std::vector <bool> flipX;
+		std::vector <bool> flipY;
+		std::vector <int> order;
+};
+
+}
+
+#endif // !__RTS2_TAPLAYOUT__
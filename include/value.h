@@ -482,6 +482,24 @@ class Value
 		 */
 		virtual void send (Connection * connection);
 
+		/**
+		 * Append binary encoding of the value (payload of binary value
+		 * record) to the buffer. Only values with fixed-size numeric
+		 * content support binary encoding.
+		 *
+		 * @param buf  buffer to which encoded value is appended
+		 *
+		 * @return false if value cannot be encoded, and must be send as text
+		 */
+		virtual bool encodeBinary (std::string &buf) { return false; }
+
+		/**
+		 * Set value from payload of binary value record.
+		 *
+		 * @return -2 on error, 0 on success.
+		 */
+		virtual int decodeBinary (const char *data, size_t size) { return -2; }
+
 		/**
 		 * Reset value change bit, so changes will be recorded from now on.
 		 *
@@ -604,6 +622,8 @@ class ValueInteger:public Value
 		virtual void setFromValue (Value * newValue);
 		virtual bool isEqual (Value *other_value);
 		virtual int checkNotNull ();
+		virtual bool encodeBinary (std::string &buf);
+		virtual int decodeBinary (const char *data, size_t size);
 	private:
 		int value;
 };
@@ -642,6 +662,8 @@ class ValueDouble:public Value
 		virtual void setFromValue (Value * newValue);
 		virtual bool isEqual (Value *other_value);
 		virtual int checkNotNull ();
+		virtual bool encodeBinary (std::string &buf);
+		virtual int decodeBinary (const char *data, size_t size);
 	protected:
 		double value;
 };
@@ -951,6 +973,8 @@ class ValueLong:public Value
 		}
 		virtual void setFromValue (Value * newValue);
 		virtual bool isEqual (Value *other_value);
+		virtual bool encodeBinary (std::string &buf);
+		virtual int decodeBinary (const char *data, size_t size);
 	private:
 		long int value;
 };
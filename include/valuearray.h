@@ -84,6 +84,12 @@ class StringArray: public ValueArray
 
 		size_t size () { return value.size (); }
 
+		void clear ()
+		{
+			value.clear ();
+			changed ();
+		}
+
 		/**
 		 * Returns true if given string is present in the array.
 		 *
@@ -164,6 +170,9 @@ class DoubleArray: public ValueArray
 
 		const std::vector <double> & getValueVector () { return value; }
 
+		virtual bool encodeBinary (std::string &buf);
+		virtual int decodeBinary (const char *data, size_t size);
+
 		double operator[] (int i) { return value[i]; }
 
 	protected:
@@ -249,6 +258,9 @@ class IntegerArray: public ValueArray
 
 		const std::vector <int> & getValueVector () { return value; }
 
+		virtual bool encodeBinary (std::string &buf);
+		virtual int decodeBinary (const char *data, size_t size);
+
 	protected:
 		std::string _os;
 		std::vector <int> value;
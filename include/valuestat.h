@@ -139,6 +139,8 @@ class ValueDoubleTimeserie:public ValueDouble
 		virtual const char *getDisplayValue ();
 		virtual void send (Connection * connection);
 		virtual void setFromValue (Value * newValue);
+		virtual bool encodeBinary (std::string &buf);
+		virtual int decodeBinary (const char *data, size_t size);
 
 		int getNumMes () { return numMes; }
 
@@ -16,6 +16,7 @@
 #include <ostream>
 
 #define HTTP_OK              200
+#define HTTP_NOT_MODIFIED    304
 #define HTTP_BAD_REQUEST     400
 #define HTTP_UNAUTHORIZED    401
 
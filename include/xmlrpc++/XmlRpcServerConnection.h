@@ -83,6 +83,18 @@ namespace XmlRpc
 
 			static std::string getHttpDate ();
 
+			/**
+			 * Returns true if client sent If-None-Match header matching the given entity tag.
+			 *
+			 * @param etag  entity tag (including quotes)
+			 */
+			bool matchETag (const std::string &etag);
+
+			/**
+			 * Returns true if client accepts gzip content encoding.
+			 */
+			bool acceptGzip ();
+
 			// Set response mask - for create asynchronous call
 			void setSourceEvents(unsigned eventMask);
 
@@ -141,6 +153,12 @@ namespace XmlRpc
 			// User authorization
 			std::string _authorization;
 
+			// Conditional GET - entity tags from If-None-Match header
+			std::string _if_none_match;
+
+			// Content encodings accepted by client
+			std::string _accept_encoding;
+
 			// Name of data requested with GET
 			std::string _get;
 
@@ -172,6 +190,9 @@ namespace XmlRpc
 			size_t _getHeaderWritten;
 			size_t _getWritten;
 
+			// True if response is 304 Not Modified, without any body
+			bool _notModified;
+
 			// Whether to keep the current client connection open for further requests
 			bool _keepAlive;
 		private:
@@ -183,6 +204,9 @@ namespace XmlRpc
 #endif
 			// prepare to receive next data
 			void prepareForNext ();
+
+			// returns header value, starting at vp, till end of line
+			static std::string headerValue (const char *vp, const char *ep);
 	};
 
 
@@ -19,6 +19,8 @@
 
 #include "error.h"
 #include "app.h"
+#include "data.h"
+#include "logqueue.h"
 
 #include "rts2-config.h"
 
@@ -41,6 +43,7 @@ static App *masterApp = NULL;
 #define OPT_VERSION      999
 #define OPT_DEBUG        998
 #define OPT_UTTIME       997
+#define OPT_DATA_POOL    996
 
 App *getMasterApp ()
 {
@@ -64,18 +67,22 @@ App::App (int argc, char **argv):Object ()
 
 	useLocalTime = true;
 
+	logQueue = NULL;
+
 	tzset ();
 
 	addOption ('h', "help", 0, "write this help");
 	addOption (OPT_VERSION, "version", 0, "show program version and license");
 	addOption (OPT_DEBUG, "debug", 0, "print debug messages");
 	addOption (OPT_UTTIME, "UT", 0, "use UT (not local) time for time displays");
+	addOption (OPT_DATA_POOL, "data-pool", 1, "MB of buffers of received binary data kept for reuse (default 0)");
 
 	masterApp = this;
 }
 
 App::~App ()
 {
+	stopLogQueue ();
 }
 
 int App::initOptions ()
@@ -226,6 +233,18 @@ int App::processOption (int in_opt)
 		case OPT_UTTIME:
 			useLocalTime = false;
 			break;
+		case OPT_DATA_POOL:
+			{
+				char *endptr;
+				double pool = strtod (optarg, &endptr);
+				if (*endptr != '\0' || !(pool >= 0))
+				{
+					std::cerr << "invalid data pool size: " << optarg << std::endl;
+					return -1;
+				}
+				DataPool::instance ()->setMaxFree (pool * 1024 * 1024);
+			}
+			break;
 		case OPT_VERSION:
 			std::cout << "Part of RTS2 version: " << RTS2_VERSION << std::endl
 				<< std::endl
@@ -453,6 +472,42 @@ void App::sendMessage (messageType_t in_messageType, std::ostringstream & _os)
 	sendMessage (in_messageType, _os.str ().c_str ());
 }
 
+void App::queueMessage (messageType_t in_messageType, const char *in_messageString)
+{
+	if (logQueue != NULL)
+		logQueue->push (in_messageType, in_messageString);
+	else
+		sendMessage (in_messageType, in_messageString);
+}
+
+void App::sendMessages (LogRecord **records, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		sendMessage (records[i]->type, records[i]->getText ());
+}
+
+void App::startLogQueue ()
+{
+	if (logQueue == NULL)
+		logQueue = new LogQueue (this);
+}
+
+void App::stopLogQueue ()
+{
+	if (logQueue == NULL)
+		return;
+	logQueue->drain (this);
+	LogQueue *lq = logQueue;
+	logQueue = NULL;
+	delete lq;
+}
+
+void App::drainLogQueue ()
+{
+	if (logQueue != NULL)
+		logQueue->drain (this);
+}
+
 LogStream App::logStream (messageType_t in_messageType)
 {
 	LogStream ls (this, in_messageType);
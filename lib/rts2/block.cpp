@@ -65,6 +65,8 @@ Block::Block (int in_argc, char **in_argv):App (in_argc, in_argv)
 
 	masterState = SERVERD_HARD_OFF;
 	stateMasterConn = NULL;
+	valuesGeneration = 0;
+	binaryValues = false;
 	// allocate ports dynamically
 	port = 0;
 }
@@ -410,6 +412,7 @@ void Block::oneRunLoop ()
 	if (ppoll (fds, npolls, &read_tout, NULL) > 0)
 		pollSuccess ();
 	ret = idle ();
+	drainLogQueue ();
 	if (ret == -1)
 		endRunLoop ();
 }
@@ -1001,6 +1004,19 @@ void Block::deleteTimers (int event_type)
 	}
 }
 
+void Block::deleteTimers (int event_type, void *arg)
+{
+	for (std::map <double, Event *>::iterator iter = timers.begin (); iter != timers.end (); )
+	{
+		if (iter->second->getType () == event_type && iter->second->getArg () == arg)
+		{
+			if (pushToDelete (iter))
+				delete (iter->second);
+		}
+		iter++;
+	}
+}
+
 void Block::valueMaskError (Value *val, int32_t err)
 {
   	if ((val->getFlags () & RTS2_VALUE_ERRORMASK) != err)
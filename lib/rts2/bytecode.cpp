@@ -0,0 +1,365 @@
+/*
+ * Compiled expressions.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "bytecode.h"
+#include "utilsfunc.h"
+
+#include <math.h>
+
+using namespace rts2expression;
+
+void Bytecode::clear ()
+{
+	code.clear ();
+	slots.clear ();
+	errors.clear ();
+	shortCircuits.clear ();
+	maxDepth = 0;
+	depth = 0;
+	lastLabel = 0;
+}
+
+void Bytecode::pushConst (double val)
+{
+	emit (BC_CONST, val);
+	changeDepth (1);
+}
+
+void Bytecode::pushValue (rts2core::Block *master, const char *device, const char *value, missing_t missing)
+{
+	slot s;
+	s.master = master;
+	s.device = std::string (device);
+	s.value = std::string (value);
+	s.missing = missing;
+	s.val = NULL;
+	s.generation = 0;
+	slots.push_back (s);
+
+	emitIndex (BC_VALUE, slots.size () - 1);
+	changeDepth (1);
+}
+
+void Bytecode::pushError (const char *msg)
+{
+	errors.push_back (std::string (msg));
+	emitIndex (BC_ERROR, errors.size () - 1);
+	// error pretends to be a value
+	changeDepth (1);
+}
+
+void Bytecode::pushRandom ()
+{
+	emit (BC_RANDOM, 0);
+	changeDepth (-1);
+}
+
+void Bytecode::pushOperator (op_t op)
+{
+	opcode_t opcode;
+	switch (op)
+	{
+		case XOR:
+			opcode = BC_XOR;
+			break;
+		case EQU:
+			opcode = BC_EQU;
+			break;
+		case LT:
+			opcode = BC_LT;
+			break;
+		case LEQU:
+			opcode = BC_LEQU;
+			break;
+		case GT:
+			opcode = BC_GT;
+			break;
+		case GEQU:
+			opcode = BC_GEQU;
+			break;
+		case NEQ:
+			opcode = BC_NEQ;
+			break;
+		default:
+			throw rts2core::Error ("OR and AND must be compiled as short-circuit operations");
+	}
+
+	if (constTop (2))
+	{
+		double v2 = code.back ().arg.val;
+		code.pop_back ();
+		double v1 = code.back ().arg.val;
+		code.pop_back ();
+		changeDepth (-2);
+		pushConst (apply (opcode, v1, v2));
+		return;
+	}
+
+	emit (opcode, 0);
+	changeDepth (-1);
+}
+
+void Bytecode::beginShortCircuit (op_t op)
+{
+	if (op != OR && op != AND)
+		throw rts2core::Error ("only OR and AND can be short-circuit operations");
+
+	shortCircuit sc;
+	sc.lastLabel = lastLabel;
+	sc.pos = 0;
+
+	if (constTop (1))
+	{
+		double v = code.back ().arg.val;
+		if (op == OR ? v != 0 : v == 0)
+		{
+			// right side will be removed
+			code.back ().arg.val = (op == OR) ? 1 : 0;
+			sc.mode = SC_DECIDED;
+			sc.pos = code.size ();
+		}
+		else
+		{
+			code.pop_back ();
+			changeDepth (-1);
+			sc.mode = SC_BOOL;
+		}
+	}
+	else
+	{
+		sc.mode = SC_JUMP;
+		sc.pos = code.size ();
+		// jump target is set in endShortCircuit
+		emitIndex (op == OR ? BC_OR : BC_AND, 0);
+		changeDepth (-1);
+	}
+	shortCircuits.push_back (sc);
+}
+
+void Bytecode::endShortCircuit ()
+{
+	if (shortCircuits.empty ())
+		throw rts2core::Error ("endShortCircuit called without beginShortCircuit");
+
+	shortCircuit sc = shortCircuits.back ();
+	shortCircuits.pop_back ();
+
+	switch (sc.mode)
+	{
+		case SC_JUMP:
+			emitBool ();
+			code[sc.pos].arg.index = code.size ();
+			lastLabel = code.size ();
+			break;
+		case SC_DECIDED:
+			code.resize (sc.pos);
+			changeDepth (-1);
+			lastLabel = sc.lastLabel;
+			break;
+		case SC_BOOL:
+			emitBool ();
+			break;
+	}
+}
+
+double Bytecode::evaluate ()
+{
+	if (code.empty ())
+		throw rts2core::Error ("empty expression");
+
+	if ((int) stack.size () < maxDepth)
+		stack.resize (maxDepth);
+
+	// points to the top of the stack
+	double *sp = &(stack[0]) - 1;
+	size_t n = code.size ();
+
+	for (size_t pc = 0; pc < n; pc++)
+	{
+		instruction &in = code[pc];
+		switch (in.opcode)
+		{
+			case BC_CONST:
+				*(++sp) = in.arg.val;
+				break;
+			case BC_VALUE:
+				*(++sp) = resolve (slots[in.arg.index]);
+				break;
+			case BC_ERROR:
+				throw rts2core::Error (errors[in.arg.index]);
+			case BC_RANDOM:
+				sp--;
+				sp[0] = sp[0] + (sp[1] - sp[0]) * random_num ();
+				break;
+			case BC_OR:
+				if (*sp != 0)
+				{
+					*sp = 1;
+					pc = in.arg.index - 1;
+				}
+				else
+				{
+					sp--;
+				}
+				break;
+			case BC_AND:
+				if (*sp == 0)
+				{
+					pc = in.arg.index - 1;
+				}
+				else
+				{
+					sp--;
+				}
+				break;
+			case BC_BOOL:
+				*sp = (*sp != 0);
+				break;
+			default:
+				sp--;
+				sp[0] = apply (in.opcode, sp[0], sp[1]);
+		}
+	}
+	return *sp;
+}
+
+std::ostream & rts2expression::operator << (std::ostream &_os, Bytecode &bc)
+{
+	const char *names[] = { "const", "value", "error", "random", "or", "and", "bool", "xor", "==", "<", "<=", ">", ">=", "!=" };
+	for (size_t i = 0; i < bc.code.size (); i++)
+	{
+		Bytecode::instruction &in = bc.code[i];
+		_os << i << " " << names[in.opcode];
+		switch (in.opcode)
+		{
+			case Bytecode::BC_CONST:
+				_os << " " << in.arg.val;
+				break;
+			case Bytecode::BC_VALUE:
+				_os << " " << bc.slots[in.arg.index].device << "." << bc.slots[in.arg.index].value;
+				break;
+			case Bytecode::BC_ERROR:
+				_os << " " << bc.errors[in.arg.index];
+				break;
+			case Bytecode::BC_OR:
+			case Bytecode::BC_AND:
+				_os << " " << in.arg.index;
+				break;
+			default:
+				break;
+		}
+		_os << std::endl;
+	}
+	return _os;
+}
+
+void Bytecode::emit (opcode_t opcode, double val)
+{
+	instruction in;
+	in.opcode = opcode;
+	in.arg.val = val;
+	code.push_back (in);
+}
+
+void Bytecode::emitIndex (opcode_t opcode, size_t index)
+{
+	instruction in;
+	in.opcode = opcode;
+	in.arg.index = index;
+	code.push_back (in);
+}
+
+void Bytecode::emitBool ()
+{
+	if (constTop (1))
+		code.back ().arg.val = (code.back ().arg.val != 0);
+	else
+		emit (BC_BOOL, 0);
+}
+
+void Bytecode::changeDepth (int change)
+{
+	depth += change;
+	if (depth > maxDepth)
+		maxDepth = depth;
+}
+
+bool Bytecode::constTop (size_t n)
+{
+	if (code.size () < lastLabel + n)
+		return false;
+	for (size_t i = code.size () - n; i < code.size (); i++)
+	{
+		if (code[i].opcode != BC_CONST)
+			return false;
+	}
+	return true;
+}
+
+double Bytecode::resolve (slot &s)
+{
+	if (s.master == NULL)
+		throw rts2core::Error ("cannot resolve value " + s.device + "." + s.value + " without master block");
+
+	unsigned long generation = s.master->getValuesGeneration ();
+	if (s.val == NULL || s.generation != generation)
+	{
+		s.val = NULL;
+		if (s.missing == MISSING_THROW)
+		{
+			s.val = s.master->getValue (s.device.c_str (), s.value.c_str ());
+			if (s.val == NULL)
+				throw ExpressionErrorValueMissing (s.device.c_str (), s.value.c_str ());
+		}
+		else
+		{
+			rts2core::Connection *conn = s.master->getOpenConnection (s.device.c_str ());
+			if (conn == NULL)
+				throw rts2core::Error ("Cannot find device " + s.device);
+			s.val = conn->getValue (s.value.c_str ());
+			if (s.val == NULL)
+				return NAN;
+		}
+		s.generation = generation;
+	}
+	return s.val->getValueDouble ();
+}
+
+double Bytecode::apply (opcode_t opcode, double v1, double v2)
+{
+	switch (opcode)
+	{
+		case BC_XOR:
+			return (v1 != 0) != (v2 != 0);
+		case BC_EQU:
+			return v1 == v2;
+		case BC_LT:
+			return v1 < v2;
+		case BC_LEQU:
+			return v1 <= v2;
+		case BC_GT:
+			return v1 > v2;
+		case BC_GEQU:
+			return v1 >= v2;
+		case BC_NEQ:
+			return v1 != v2;
+		default:
+			throw rts2core::Error ("invalid bytecode operator");
+	}
+}
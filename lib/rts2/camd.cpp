@@ -50,6 +50,7 @@
 #define OPT_COMMENTS          OPT_LOCAL + 421
 #define OPT_HISTORIES         OPT_LOCAL + 422
 #define OPT_RTS2_COOLING      OPT_LOCAL + 423
+#define OPT_STREAM_LIMIT      OPT_LOCAL + 424
 
 #define EVENT_TEMP_CHECK      RTS2_LOCAL_EVENT + 676
 
@@ -211,6 +212,8 @@ int Camera::deleteConnection (rts2core::Connection * conn)
 	{
 		exposureConn = NULL;
 	}
+	if (streamConsumers.erase (conn) > 0)
+		updateStreamValues ();
 	// delete connection in shared data
 	if (sharedData)
 	{
@@ -242,6 +245,8 @@ int Camera::endReadout ()
 		<< " (" << std::setiosflags (std::ios_base::fixed) << pixelsSecond->getValueDouble () << " pixels per second, transfered with " << transferSecond << " pixels per second)" << sendLog;
 
 	clearReadout ();
+	if (streamLimit > 0)
+		updateStreamValues ();
 	if (currentImageTransfer == SHARED && exposureConn)
 	{
 		if (currentImageData >= 0)
@@ -322,6 +327,91 @@ void Camera::startImageData (rts2core::Connection * conn)
 		currentImageTransfer = TCPIP;
 	}
 	exposureConn = conn;
+
+	if (streamLimit > 0)
+		startStreams (conn, chnTot, chansize);
+}
+
+void Camera::startStreams (rts2core::Connection *conn, int chnTot, size_t *chansize)
+{
+	if (currentImageTransfer == TCPIP)
+	{
+		conn->setWriteQueueLimit (streamLimit);
+		conn->resetWriteStatistics ();
+	}
+	for (std::map <rts2core::Connection *, int>::iterator iter = streamConsumers.begin (); iter != streamConsumers.end (); iter++)
+	{
+		// exposure connection receives data anyway
+		if (iter->first == conn)
+		{
+			iter->second = -1;
+			continue;
+		}
+		iter->first->setWriteQueueLimit (streamLimit);
+		iter->first->resetWriteStatistics ();
+		iter->second = iter->first->startBinaryData (dataType->getValueInteger (), chnTot, chansize);
+	}
+	updateStreamValues ();
+}
+
+int Camera::streamData (int chan, char *data, size_t dataSize, bool toExposureConn)
+{
+	if (!(toExposureConn && exposureConn) && streamConsumers.empty ())
+		return 0;
+
+	rts2core::DataChunk *chunk = new rts2core::DataChunk (data, dataSize);
+	int ret = 0;
+	if (toExposureConn && exposureConn)
+		ret = exposureConn->queueBinaryData (currentImageData, chan, chunk);
+	for (std::map <rts2core::Connection *, int>::iterator iter = streamConsumers.begin (); iter != streamConsumers.end (); iter++)
+	{
+		if (iter->second < 0)
+			continue;
+		// failure of a consumer does not stop the readout
+		if (iter->first->queueBinaryData (iter->second, chan, chunk))
+		{
+			logStream (MESSAGE_WARNING) << "cannot stream data to " << iter->first->getName () << sendLog;
+			iter->second = -1;
+		}
+	}
+	chunk->unref ();
+	return ret;
+}
+
+static std::string streamName (rts2core::Connection *conn)
+{
+	if (strlen (conn->getName ()) > 0)
+		return std::string (conn->getName ());
+	std::ostringstream _os;
+	_os << conn->getCentraldId ();
+	return _os.str ();
+}
+
+void Camera::updateStreamValues ()
+{
+	std::vector <std::string> names;
+	std::vector <double> throughput;
+	std::vector <double> lag;
+	if (exposureConn && currentImageTransfer == TCPIP)
+	{
+		names.push_back (streamName (exposureConn));
+		throughput.push_back (exposureConn->getWriteThroughput () / (1024 * 1024));
+		lag.push_back (exposureConn->getWriteLag ());
+	}
+	for (std::map <rts2core::Connection *, int>::iterator iter = streamConsumers.begin (); iter != streamConsumers.end (); iter++)
+	{
+		if (iter->first == exposureConn && currentImageTransfer == TCPIP)
+			continue;
+		names.push_back (streamName (iter->first));
+		throughput.push_back (iter->first->getWriteThroughput () / (1024 * 1024));
+		lag.push_back (iter->first->getWriteLag ());
+	}
+	streamNames->setValueArray (names);
+	streamThroughput->setValueArray (throughput);
+	streamLag->setValueArray (lag);
+	sendValueAll (streamNames);
+	sendValueAll (streamThroughput);
+	sendValueAll (streamLag);
 }
 
 int Camera::sendFirstLine (int chan, int pchan)
@@ -362,8 +452,12 @@ int Camera::sendFirstLine (int chan, int pchan)
 	{
 		case SHARED:
 			sharedData->dataWritten (chan, sizeof (imghdr));
+			if (streamLimit > 0)
+				return streamData (chan, (char *) focusingHeader, sizeof (imghdr), false);
 			break;
 		case TCPIP:
+			if (streamLimit > 0)
+				return streamData (chan, (char *) focusingHeader, sizeof (imghdr), true);
 			if (exposureConn)
 				return exposureConn->sendBinaryData (currentImageData, chan, (char *) focusingHeader, sizeof (imghdr));
 			break;
@@ -434,6 +528,11 @@ Camera::Camera (int in_argc, char **in_argv, rounding_t binning_rounding):rts2co
 	sharedData = NULL;
 	sharedMemNum = -1;
 
+	streamLimit = 0;
+	streamNames = NULL;
+	streamThroughput = NULL;
+	streamLag = NULL;
+
 	currentImageData = -1;
 	currentImageTransfer = TCPIP;
 
@@ -569,6 +668,7 @@ Camera::Camera (int in_argc, char **in_argv, rounding_t binning_rounding):rts2co
 	addOption (OPT_WCS_CDELT, "wcs", 1, "WCS CD matrix (CRPIX1:CRPIX2:CDELT1:CDELT2:CROTA in default, unbinned configuration)");
 	addOption (OPT_WCS_MULTI, "wcs-multi", 1, "letter for multiple WCS (A-Z)");
 	addOption (OPT_WITHSHM, "with-shm", 2, "use given numbers of segments of shared memory");
+	addOption (OPT_STREAM_LIMIT, "stream-limit", 1, "send image data without blocking, to multiple consumers; maximal MB queued for a single consumer");
 
 	// detector sizes, channel starting points and offsets
 	addOption (OPT_DETSIZE, "detsize", 1, "detector size - X:Y:W:H");
@@ -757,6 +857,8 @@ int Camera::info ()
 		viter->filter->setValueInteger (getFilterNum (*niter));
 	}
 	camFocVal->setValueInteger (getFocPos ());
+	if (streamLimit > 0)
+		updateStreamValues ();
 	return rts2core::ScriptDevice::info ();
 }
 
@@ -882,6 +984,20 @@ int Camera::processOption (int in_opt)
 			else
 				sharedMemNum = atoi (optarg);
 			break;
+		case OPT_STREAM_LIMIT:
+			{
+				double limit = atof (optarg);
+				if (!(limit > 0))
+				{
+					logStream (MESSAGE_ERROR) << "invalid stream limit: " << optarg << sendLog;
+					return -1;
+				}
+				streamLimit = limit * 1024 * 1024;
+			}
+			createValue (streamNames, "stream_consumers", "connections receiving image data", false);
+			createValue (streamThroughput, "stream_throughput", "[MB/s] throughput of image data to the consumers", false);
+			createValue (streamLag, "stream_lag", "[s] time the oldest queued data waits for the consumers", false);
+			break;
 
 		case OPT_DETSIZE:
 			{
@@ -1072,6 +1188,8 @@ int Camera::sendReadoutData (char *data, size_t dataSize, int chan)
 	
 	dataWritten[chan] += dataSize;
 
+	if (streamLimit > 0)
+		return streamData (chan, data, dataSize, currentImageTransfer == TCPIP);
 	if (exposureConn && currentImageTransfer == TCPIP)
 		return exposureConn->sendBinaryData (currentImageData, chan, data, dataSize);
 	return 0;
@@ -2046,6 +2164,28 @@ int Camera::commandAuthorized (rts2core::Connection * conn)
 		sendValueAll (centerAvgStat);
 		return 0;
 	}
+	else if (conn->isCommand (COMMAND_CCD_STREAM))
+	{
+		if (streamLimit == 0 || !conn->paramEnd ())
+			return -2;
+		streamConsumers[conn] = -1;
+		updateStreamValues ();
+		return 0;
+	}
+	else if (conn->isCommand (COMMAND_CCD_STREAM_STOP))
+	{
+		if (!conn->paramEnd ())
+			return -2;
+		std::map <rts2core::Connection *, int>::iterator iter = streamConsumers.find (conn);
+		if (iter != streamConsumers.end ())
+		{
+			if (iter->second >= 0 && conn->getWriteBinaryDataSize (iter->second) > 0)
+				conn->endBinaryData (iter->second);
+			streamConsumers.erase (iter);
+			updateStreamValues ();
+		}
+		return 0;
+	}
 	else if (conn->isCommand (COMMAND_FITS_STAT))
 	{
 		double p_average, p_min, p_max, p_sum, p_mode;
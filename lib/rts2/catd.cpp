@@ -19,13 +19,101 @@
 
 #include "catd.h"
 
+#include <sstream>
+
 using namespace rts2catd;
 
 Catd::Catd (int argc, char **argv, const char *cn):rts2core::Device (argc, argv, DEVICE_TYPE_CAT, cn)
 {
+	createValue (corner1, "corner1", "first corner of search box", false, RTS2_VALUE_WRITABLE);
+	createValue (corner2, "corner2", "second corner of search box", false, RTS2_VALUE_WRITABLE);
+	createValue (numStars, "num_stars", "maximal number of returned stars", false, RTS2_VALUE_WRITABLE);
+	numStars->setValueInteger (100);
+	createValue (magLimit, "mag_limit", "faintest magnitude of returned stars", false, RTS2_VALUE_WRITABLE);
+	magLimit->setValueDouble (99);
+
+	createValue (foundStars, "found", "number of stars found by the last search", false);
+	createValue (searchDuration, "search_duration", "[s] duration of the last search", false);
 
+	createValue (starsId, "stars_id", "catalogue ID of found stars", false);
+	createValue (starsRa, "stars_ra", "RA of found stars", false, RTS2_DT_RA);
+	createValue (starsDec, "stars_dec", "DEC of found stars", false, RTS2_DT_DEC);
+	createValue (starsMag, "stars_mag", "magnitude of found stars", false);
 }
 
 Catd::~Catd ()
 {
 }
+
+int Catd::commandAuthorized (rts2core::Connection * conn)
+{
+	if (conn->isCommand ("search"))
+	{
+		if (!conn->paramEnd ())
+			return -2;
+		double start = getNow ();
+		struct ln_equ_posn c1, c2;
+		c1.ra = corner1->getRa ();
+		c1.dec = corner1->getDec ();
+		c2.ra = corner2->getRa ();
+		c2.dec = corner2->getDec ();
+		if (isnan (c1.ra) || isnan (c1.dec) || isnan (c2.ra) || isnan (c2.dec))
+		{
+			conn->sendCommandEnd (DEVDEM_E_PARAMSVAL, "search box corners are not set");
+			return -1;
+		}
+		clearStars ();
+		return searchFinished (searchCataloge (&c1, &c2, numStars->getValueInteger ()), start);
+	}
+	else if (conn->isCommand ("cone"))
+	{
+		struct ln_equ_posn centre;
+		double radius;
+		if (conn->paramNextDouble (&centre.ra) || conn->paramNextDouble (&centre.dec) || conn->paramNextDouble (&radius) || !conn->paramEnd ())
+			return -2;
+		double start = getNow ();
+		clearStars ();
+		return searchFinished (coneSearch (&centre, radius, numStars->getValueInteger ()), start);
+	}
+	return rts2core::Device::commandAuthorized (conn);
+}
+
+void Catd::clearStars ()
+{
+	starsId->clear ();
+	starsRa->clear ();
+	starsDec->clear ();
+	starsMag->clear ();
+}
+
+void Catd::addStar (uint64_t id, double ra, double dec, double mag)
+{
+	// IDs are send as strings, integer values are 32bit only
+	std::ostringstream os;
+	os << id;
+	starsId->addValue (os.str ());
+	starsRa->addValue (ra);
+	starsDec->addValue (dec);
+	starsMag->addValue (mag);
+}
+
+int Catd::searchFinished (int ret, double start)
+{
+	searchDuration->setValueDouble (getNow () - start);
+	sendValueAll (searchDuration);
+	if (ret < 0)
+	{
+		clearStars ();
+		foundStars->setValueInteger (0);
+	}
+	else
+	{
+		foundStars->setValueInteger (ret);
+	}
+	sendValueAll (foundStars);
+	sendValueAll (starsId);
+	sendValueAll (starsRa);
+	sendValueAll (starsDec);
+	sendValueAll (starsMag);
+	return ret < 0 ? -1 : 0;
+}
@@ -0,0 +1,332 @@
+/*
+ * Memory mapped, HEALPix partitioned star catalogue.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "catfile.h"
+#include "app.h"
+
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace rts2catd;
+
+static bool starMagCompare (const struct catfile_star *s1, const struct catfile_star *s2)
+{
+	return s1->mag < s2->mag;
+}
+
+static bool starRecordMagCompare (const struct catfile_star &s1, const struct catfile_star &s2)
+{
+	return s1.mag < s2.mag;
+}
+
+CatFile::CatFile ()
+{
+	map = NULL;
+	mapSize = 0;
+	header = NULL;
+	cellStart = NULL;
+	stars = NULL;
+	healpix = NULL;
+}
+
+CatFile::~CatFile ()
+{
+	closeFile ();
+}
+
+int CatFile::openFile (const char *fn)
+{
+	closeFile ();
+
+	int fd = open (fn, O_RDONLY);
+	if (fd < 0)
+	{
+		logStream (MESSAGE_ERROR) << "cannot open catalogue file " << fn << ": " << strerror (errno) << sendLog;
+		return -1;
+	}
+
+	struct stat st;
+	if (fstat (fd, &st) || (size_t) st.st_size < sizeof (struct catfile_header))
+	{
+		logStream (MESSAGE_ERROR) << "invalid catalogue file " << fn << sendLog;
+		close (fd);
+		return -1;
+	}
+
+	map = mmap (NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close (fd);
+	if (map == MAP_FAILED)
+	{
+		logStream (MESSAGE_ERROR) << "cannot map catalogue file " << fn << ": " << strerror (errno) << sendLog;
+		map = NULL;
+		return -1;
+	}
+	mapSize = st.st_size;
+
+	header = (const struct catfile_header *) map;
+	if (strcmp (header->magic, CATFILE_MAGIC) || header->version != CATFILE_VERSION || header->nside == 0 || (header->nside & (header->nside - 1)))
+	{
+		logStream (MESSAGE_ERROR) << "file " << fn << " is not RTS2 catalogue file, or has unsupported version" << sendLog;
+		closeFile ();
+		return -1;
+	}
+
+	healpix = new rts2core::HealPix (header->nside);
+
+	size_t expected = sizeof (struct catfile_header) + (healpix->getNpix () + 1) * sizeof (uint64_t) + header->nstars * sizeof (struct catfile_star);
+	if (expected != mapSize)
+	{
+		logStream (MESSAGE_ERROR) << "size of catalogue file " << fn << " does not match its header, expected " << expected << " bytes, file has " << mapSize << " bytes" << sendLog;
+		closeFile ();
+		return -1;
+	}
+
+	cellStart = (const uint64_t *) (((const char *) map) + sizeof (struct catfile_header));
+	stars = (const struct catfile_star *) (cellStart + healpix->getNpix () + 1);
+
+	// queries are random
+	madvise (map, mapSize, MADV_RANDOM);
+
+	return 0;
+}
+
+void CatFile::closeFile ()
+{
+	if (map)
+		munmap (map, mapSize);
+	map = NULL;
+	mapSize = 0;
+	header = NULL;
+	cellStart = NULL;
+	stars = NULL;
+	delete healpix;
+	healpix = NULL;
+}
+
+void CatFile::coneSearch (struct ln_equ_posn *centre, double radius, float maxmag, size_t num, std::vector <const struct catfile_star *> &result)
+{
+	searchCells (centre, radius, maxmag, num, NULL, NULL, result);
+}
+
+void CatFile::boxSearch (struct ln_equ_posn *c1, struct ln_equ_posn *c2, float maxmag, size_t num, std::vector <const struct catfile_star *> &result)
+{
+	// cone enclosing the box - the most distant points of the box are its corners
+	double ra_width = c2->ra - c1->ra;
+	if (ra_width < 0)
+		ra_width += 360;
+
+	struct ln_equ_posn centre, corner;
+	centre.ra = ln_range_degrees (c1->ra + ra_width / 2.0);
+	centre.dec = (c1->dec + c2->dec) / 2.0;
+
+	double radius = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		corner.ra = (i & 1) ? c1->ra : c2->ra;
+		corner.dec = (i & 2) ? c1->dec : c2->dec;
+		radius = std::max (radius, ln_get_angular_separation (&centre, &corner));
+	}
+
+	searchCells (&centre, radius, maxmag, num, c1, c2, result);
+}
+
+void CatFile::searchCells (struct ln_equ_posn *centre, double radius, float maxmag, size_t num, struct ln_equ_posn *c1, struct ln_equ_posn *c2, std::vector <const struct catfile_star *> &result)
+{
+	result.clear ();
+	if (stars == NULL)
+		return;
+
+	std::vector <long> cells;
+	healpix->queryDisc (centre->ra, centre->dec, radius, -1, cells);
+
+	double cd = cos (centre->dec * M_PI / 180.0);
+	double cx = cd * cos (centre->ra * M_PI / 180.0);
+	double cy = cd * sin (centre->ra * M_PI / 180.0);
+	double cz = sin (centre->dec * M_PI / 180.0);
+	double cr = cos (radius * M_PI / 180.0);
+
+	double dec_min = 0, dec_max = 0, ra_width = 0;
+	if (c1)
+	{
+		dec_min = std::min (c1->dec, c2->dec);
+		dec_max = std::max (c1->dec, c2->dec);
+		ra_width = c2->ra - c1->ra;
+		if (ra_width < 0)
+			ra_width += 360;
+	}
+
+	for (std::vector <long>::iterator iter = cells.begin (); iter != cells.end (); iter++)
+	{
+		for (uint64_t i = cellStart[*iter]; i < cellStart[*iter + 1]; i++)
+		{
+			const struct catfile_star *star = stars + i;
+			// stars inside cell are sorted by magnitude
+			if (star->mag > maxmag)
+				break;
+			if (c1)
+			{
+				if (star->dec < dec_min || star->dec > dec_max)
+					continue;
+				double dra = star->ra - c1->ra;
+				if (dra < 0)
+					dra += 360;
+				if (dra > ra_width)
+					continue;
+			}
+			else
+			{
+				double sd = cos (star->dec * M_PI / 180.0);
+				if (sd * cos (star->ra * M_PI / 180.0) * cx + sd * sin (star->ra * M_PI / 180.0) * cy + sin (star->dec * M_PI / 180.0) * cz < cr)
+					continue;
+			}
+			result.push_back (star);
+		}
+	}
+
+	if (result.size () > num)
+	{
+		std::partial_sort (result.begin (), result.begin () + num, result.end (), starMagCompare);
+		result.resize (num);
+	}
+	else
+	{
+		std::sort (result.begin (), result.end (), starMagCompare);
+	}
+}
+
+CatFileWriter::CatFileWriter (int _nside):healpix (_nside), counts (), cursor ()
+{
+	counts.assign (healpix.getNpix (), 0);
+	nstars = 0;
+	fd = -1;
+	map = NULL;
+	mapSize = 0;
+	stars = NULL;
+}
+
+CatFileWriter::~CatFileWriter ()
+{
+	if (map)
+		munmap (map, mapSize);
+	if (fd >= 0)
+		close (fd);
+}
+
+void CatFileWriter::count (double ra, double dec)
+{
+	counts[healpix.ang2pix (ra, dec)]++;
+	nstars++;
+}
+
+int CatFileWriter::create (const char *fn)
+{
+	fd = open (fn, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+	{
+		logStream (MESSAGE_ERROR) << "cannot create catalogue file " << fn << ": " << strerror (errno) << sendLog;
+		return -1;
+	}
+
+	mapSize = sizeof (struct catfile_header) + (healpix.getNpix () + 1) * sizeof (uint64_t) + nstars * sizeof (struct catfile_star);
+	if (ftruncate (fd, mapSize))
+	{
+		logStream (MESSAGE_ERROR) << "cannot resize catalogue file " << fn << " to " << mapSize << " bytes: " << strerror (errno) << sendLog;
+		return -1;
+	}
+
+	map = mmap (NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED)
+	{
+		logStream (MESSAGE_ERROR) << "cannot map catalogue file " << fn << ": " << strerror (errno) << sendLog;
+		map = NULL;
+		return -1;
+	}
+
+	struct catfile_header *header = (struct catfile_header *) map;
+	memset (header, 0, sizeof (struct catfile_header));
+	strcpy (header->magic, CATFILE_MAGIC);
+	header->version = CATFILE_VERSION;
+	header->nside = healpix.getNside ();
+	header->nstars = nstars;
+
+	uint64_t *cellStart = (uint64_t *) (((char *) map) + sizeof (struct catfile_header));
+	cursor.resize (healpix.getNpix ());
+	uint64_t s = 0;
+	for (long c = 0; c < healpix.getNpix (); c++)
+	{
+		cellStart[c] = cursor[c] = s;
+		s += counts[c];
+	}
+	cellStart[healpix.getNpix ()] = s;
+
+	stars = (struct catfile_star *) (cellStart + healpix.getNpix () + 1);
+
+	return 0;
+}
+
+int CatFileWriter::add (uint64_t id, double ra, double dec, float mag)
+{
+	long c = healpix.ang2pix (ra, dec);
+	if (counts[c] == 0)
+		return -1;
+	counts[c]--;
+
+	struct catfile_star *star = stars + cursor[c];
+	star->ra = ra;
+	star->dec = dec;
+	star->mag = mag;
+	star->id = id;
+	cursor[c]++;
+	return 0;
+}
+
+int CatFileWriter::finish ()
+{
+	if (map == NULL)
+		return -1;
+
+	uint64_t *cellStart = (uint64_t *) (((char *) map) + sizeof (struct catfile_header));
+	int ret = 0;
+	for (long c = 0; c < healpix.getNpix (); c++)
+	{
+		if (counts[c] != 0)
+		{
+			logStream (MESSAGE_ERROR) << "second pass added " << counts[c] << " stars less than the first pass to cell " << c << sendLog;
+			ret = -1;
+		}
+		std::sort (stars + cellStart[c], stars + cellStart[c + 1], starRecordMagCompare);
+	}
+
+	if (msync (map, mapSize, MS_SYNC))
+	{
+		logStream (MESSAGE_ERROR) << "cannot write catalogue file: " << strerror (errno) << sendLog;
+		ret = -1;
+	}
+	munmap (map, mapSize);
+	map = NULL;
+	close (fd);
+	fd = -1;
+	return ret;
+}
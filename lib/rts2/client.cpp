@@ -144,6 +144,7 @@ Client::Client (int in_argc, char **in_argv, const char *_name):Block (in_argc,
 
 	addOption (OPT_PORT, "port", 1, "port of centrald server");
 	addOption (OPT_SERVER, "server", 1, "hostname of central server; default to localhost");
+	addOption (OPT_BINARY_VALUES, "binary-values", 0, "ask devices to send value updates in binary frames");
 }
 
 Client::~Client (void)
@@ -160,6 +161,9 @@ int Client::processOption (int in_opt)
 		case OPT_PORT:
 			central_port = optarg;
 			break;
+		case OPT_BINARY_VALUES:
+			setBinaryValues (true);
+			break;
 		default:
 			return Block::processOption (in_opt);
 	}
@@ -144,6 +144,19 @@ int CommandSendKey::send ()
 	return Command::send ();
 }
 
+int CommandSendKey::commandReturnOK (Connection * conn)
+{
+	connection->setConnState (CONN_AUTH_OK);
+	if (owner->getBinaryValues ())
+		connection->queCommand (new CommandBinaryValues (owner));
+	return -1;
+}
+
+CommandBinaryValues::CommandBinaryValues (Block * _master):Command (_master)
+{
+	setCommand (COMMAND_BINARY_VALUES);
+}
+
 CommandAuthorize::CommandAuthorize (Block * _master, int centralId, int key):Command (_master)
 {
 	std::ostringstream _os;
@@ -668,6 +681,29 @@ int CommandInfo::commandReturnFailed (int status, Connection * conn)
 	return Command::commandReturnFailed (status, conn);
 }
 
+CommandSubscribe::CommandSubscribe (Block * _master, double period, double deadband, const std::list <std::string> &names):Command (_master)
+{
+	std::ostringstream _os;
+	_os << COMMAND_SUBSCRIBE " " << period << " " << deadband;
+	for (std::list <std::string>::const_iterator iter = names.begin (); iter != names.end (); iter++)
+		_os << " " << *iter;
+	setCommand (_os);
+}
+
+int CommandSubscribe::commandReturnOK (Connection * conn)
+{
+	if (connection && connection->getOtherDevClient ())
+		connection->getOtherDevClient ()->subscribed ();
+	return Command::commandReturnOK (conn);
+}
+
+int CommandSubscribe::commandReturnFailed (int status, Connection * conn)
+{
+	if (connection && connection->getOtherDevClient ())
+		connection->getOtherDevClient ()->subscriptionFailed ();
+	return Command::commandReturnFailed (status, conn);
+}
+
 CommandStatusInfo::CommandStatusInfo (Block * master, Connection * _control_conn):Command(master)
 {
 	control_conn = _control_conn;
@@ -68,6 +68,9 @@ int Configuration::getSpecialValues ()
 
 	checker = new ObjectCheck (horizon_file.c_str ());
 	astrometryTimeout = getIntegerDefault ("imgproc", "astrometry_timeout", 3600);
+	astrometryMinSources = getIntegerDefault ("imgproc", "min_sources", 0);
+	getString ("imgproc", "catalogue", astrometryCatalogue, "");
+	astrometrySearchRadius = getDoubleDefault ("imgproc", "search_radius", 0.5);
 	calibrationAirmassDistance = getDoubleDefault ("calibration", "airmass_distance", 0.1);
 	calibrationLunarDist = getDoubleDefault ("calibration", "lunar_dist", 20);
 	calibrationValidTime = getIntegerDefault ("calibration", "valid_time", 3600);
@@ -96,6 +99,8 @@ Configuration::Configuration (bool defaultSection):IniParser (defaultSection)
 	checker = NULL;
 	// default to 120 seconds
 	astrometryTimeout = 120;
+	astrometryMinSources = 0;
+	astrometrySearchRadius = 0.5;
 	targetConstraintsWithName = false;
 	showMilliseconds = true;
 }
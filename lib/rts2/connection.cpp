@@ -21,8 +21,10 @@
 
 #include "connection.h"
 #include "centralstate.h"
+#include "binaryvalue.h"
 #include "block.h"
 #include "command.h"
+#include "protorecorder.h"
 
 #include "valuestat.h"
 #include "valueminmax.h"
@@ -95,6 +97,15 @@ Connection::Connection (Block * in_master):Object ()
 	activeReadData = -1;
 	dataConn = 0;
 
+	writeQueueSize = 0;
+	writeQueueLimit = 0;
+	writeStatStart = NAN;
+	writeStatBytes = 0;
+
+	binaryValues = false;
+	valueBatch = 0;
+	binaryValueRest = 0;
+
 	sharedReadMemory = NULL;
 }
 
@@ -137,6 +148,15 @@ Connection::Connection (int in_sock, Block * in_master):Object ()
 	activeReadData = -1;
 	dataConn = 0;
 
+	writeQueueSize = 0;
+	writeQueueLimit = 0;
+	writeStatStart = NAN;
+	writeStatBytes = 0;
+
+	binaryValues = false;
+	valueBatch = 0;
+	binaryValueRest = 0;
+
 	sharedReadMemory = NULL;
 }
 
@@ -144,12 +164,16 @@ Connection::~Connection (void)
 {
 	if (sock >= 0)
 		close (sock);
+	clearWriteQueue ();
 	delete serverState;
 	delete bopState;
 	queClear ();
 	delete[]buf;
 	delete sharedReadMemory;
 	delete otherDevice;
+	// values are deleted with the connection
+	if (master)
+		master->valuesDeleted ();
 }
 
 int Connection::add (Block *block)
@@ -157,7 +181,7 @@ int Connection::add (Block *block)
 	if (sock >= 0)
 	{
 		short events = POLLIN | POLLPRI;
-		if (isConnState (CONN_INPROGRESS))
+		if (isConnState (CONN_INPROGRESS) || !writeQueue.empty ())
 			events |= POLLOUT;
 		block->addPollFD (sock, events);
 	}
@@ -661,6 +685,9 @@ void Connection::processLine ()
 	// received
 	int ret;
 
+	if (ProtocolRecorder::recording)
+		ProtocolRecorder::instance ()->record (this, '<', command_start);
+
 	// find command parameters end
 
 	while (*command_buf_top && !isspace (*command_buf_top))
@@ -747,6 +774,19 @@ void Connection::processLine ()
 			ret = -1;
 		}
 	}
+	else if (isCommand (PROTO_PUSHED))
+	{
+		if (!paramEnd ())
+		{
+			ret = -2;
+		}
+		else
+		{
+			if (getOtherDevClient ())
+				getOtherDevClient ()->infoPushed ();
+			ret = -1;
+		}
+	}
 	else if (isCommand (PROTO_SELMETAINFO))
 	{
 		char *m_name;
@@ -792,6 +832,29 @@ void Connection::processLine ()
 			ret = -1;
 		}
 	}
+	else if (isCommand (PROTO_BINARY_VALUES))
+	{
+		long frameSize;
+		if (paramNextLong (&frameSize) || frameSize <= 0 || !paramEnd ())
+		{
+			// binary data follows, we cannot find end of the frame
+			connectionError (-2);
+			ret = -2;
+		}
+		else if (frameSize > MAX_BINARY_FRAME_SIZE)
+		{
+			logStream (MESSAGE_ERROR) << "binary value frame of " << frameSize << " bytes from connection '" << getName () << "' exceeds limit of " << MAX_BINARY_FRAME_SIZE << " bytes, dropping connection" << sendLog;
+			connectionError (-2);
+			ret = -2;
+		}
+		else
+		{
+			binaryValueRead.clear ();
+			binaryValueRead.reserve (frameSize);
+			binaryValueRest = frameSize;
+			ret = -1;
+		}
+	}
 	else if (isCommand (PROTO_DATA))
 	{
 		if (paramNextInteger (&activeReadData) || paramNextInteger (&activeReadChannel)
@@ -995,6 +1058,15 @@ void Connection::processBuffer ()
 				memmove (buf_top, buf_top + readSize, (full_data_end - buf_top) - readSize + 1);
 				full_data_end -= readSize;
 			}
+			else if (binaryValueRest > 0)
+			{
+				size_t readSize = full_data_end - buf_top;
+				if (readSize > binaryValueRest)
+					readSize = binaryValueRest;
+				addBinaryValueData (buf_top, readSize);
+				memmove (buf_top, buf_top + readSize, (full_data_end - buf_top) - readSize + 1);
+				full_data_end -= readSize;
+			}
 			command_start = buf_top;
 		}
 	}
@@ -1032,6 +1104,26 @@ int Connection::receive (Block *block)
 			dataReceived ();
 			return data_size;
 		}
+		// rest of binary value frame
+		if (binaryValueRest > 0)
+		{
+			size_t off = binaryValueRead.size ();
+			binaryValueRead.resize (off + binaryValueRest);
+			data_size = read (sock, &(binaryValueRead[off]), binaryValueRest);
+			binaryValueRead.resize (off + (data_size > 0 ? data_size : 0));
+			if (data_size == -1 && errno == EINTR)
+				return 0;
+			if (data_size <= 0)
+			{
+				connectionError (data_size);
+				return -1;
+			}
+			successfullRead ();
+			binaryValueRest -= data_size;
+			if (binaryValueRest == 0)
+				processBinaryValues ();
+			return data_size;
+		}
 		checkBufferSize ();
 		data_size = read (sock, buf_top, buf_size - (buf_top - buf));
 		// ignore EINTR
@@ -1088,6 +1180,10 @@ int Connection::writable (Block *block)
 			connConnected ();
 		}
 	}
+	else if (sock >= 0 && !writeQueue.empty () && (block->getPollEvents (sock) & POLLOUT))
+	{
+		flushWriteQueue (false);
+	}
 	return 0;
 }
 
@@ -1492,6 +1588,11 @@ int Connection::sendMsg (const char *msg)
 		#endif
 		return -1;
 	}
+	// binary values must be send before the message
+	if (!binaryValueFrame.empty () && flushBinaryValues ())
+		return -1;
+	if (ProtocolRecorder::recording)
+		ProtocolRecorder::instance ()->record (this, '>', msg);
 	len = strlen (msg) + 1;
 	char *mbuf = new char[len + 1];
 	strcpy (mbuf, msg);
@@ -1499,6 +1600,15 @@ int Connection::sendMsg (const char *msg)
 	std::cout << "Connection::sendMsg will send " << msg << std::endl;
 	#endif
 	strcat (mbuf, "\n");
+	// binary data are waiting, message must follow them
+	if (!writeQueue.empty ())
+	{
+		DataChunk *chunk = new DataChunk (mbuf, len);
+		delete[] mbuf;
+		queueWrite (chunk);
+		chunk->unref ();
+		return flushWriteQueue (false);
+	}
 	// ignore EINTR
 	do
 	{
@@ -1561,6 +1671,10 @@ int Connection::sendBinaryData (int data_conn, int chan, char *data, size_t data
 	binaryWriteTop = binaryWriteBuff = data;
 	char *binaryEnd = data + dataSize;
 
+	// queued data must be written first
+	if (!writeQueue.empty () && flushWriteQueue (true))
+		return -1;
+
 	std::ostringstream _os;
 	_os << PROTO_DATA " " << data_conn << " " << chan << " " << dataSize;
 	int ret;
@@ -1604,6 +1718,269 @@ int Connection::sendBinaryData (int data_conn, int chan, char *data, size_t data
 	return 0;
 }
 
+int Connection::queueBinaryData (int data_conn, int chan, DataChunk *chunk)
+{
+	size_t dataSize = chunk->getSize ();
+	if (dataSize > getWriteBinaryDataSize (data_conn, chan))
+	{
+		logStream (MESSAGE_ERROR) << "Attemp to queue too much data on channel " << chan << " - "
+			<< dataSize << " bytes, but there are only " << getWriteBinaryDataSize (data_conn, chan) << " bytes remain to be send" << sendLog;
+		return -1;
+	}
+
+	std::ostringstream _os;
+	_os << PROTO_DATA " " << data_conn << " " << chan << " " << dataSize;
+	if (sendMsg (_os))
+		return -1;
+
+	queueWrite (chunk);
+
+	// data are accounted when queued, so the caller knows how much remains to be queued
+	std::map <int, DataAbstractWrite *>::iterator iter = writeChannels.find (data_conn);
+	if (iter != writeChannels.end ())
+	{
+		((*iter).second)->dataWritten (chan, dataSize);
+		if (((*iter).second)->getDataSize () <= 0)
+		{
+			delete ((*iter).second);
+			writeChannels.erase (iter);
+		}
+	}
+
+	if (writeQueueLimit > 0 && writeQueueSize > writeQueueLimit)
+		return flushWriteQueue (true, writeQueueLimit / 2);
+	return flushWriteQueue (false);
+}
+
+double Connection::getWriteLag ()
+{
+	if (writeQueue.empty ())
+		return 0;
+	return getNow () - writeQueue.front ().queued;
+}
+
+double Connection::getWriteThroughput ()
+{
+	if (isnan (writeStatStart))
+		return NAN;
+	double dt = getNow () - writeStatStart;
+	if (dt <= 0)
+		return NAN;
+	return writeStatBytes / dt;
+}
+
+void Connection::resetWriteStatistics ()
+{
+	writeStatStart = getNow ();
+	writeStatBytes = 0;
+}
+
+void Connection::queueWrite (DataChunk *chunk)
+{
+	QueuedWrite qw;
+	qw.chunk = chunk;
+	qw.offset = 0;
+	qw.queued = getNow ();
+	chunk->ref ();
+	writeQueue.push_back (qw);
+	writeQueueSize += chunk->getSize ();
+}
+
+int Connection::flushWriteQueue (bool block, size_t target)
+{
+	while (!writeQueue.empty ())
+	{
+		if (block && writeQueueSize <= target)
+			return 0;
+		if (sock < 0)
+		{
+			clearWriteQueue ();
+			return -1;
+		}
+		QueuedWrite &qw = writeQueue.front ();
+		ssize_t ret = send (sock, qw.chunk->getData () + qw.offset, qw.chunk->getSize () - qw.offset, MSG_DONTWAIT);
+		if (ret == -1)
+		{
+			if (errno == EINTR)
+				continue;
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+			{
+				connectionError (ret);
+				return -1;
+			}
+			if (!block)
+				return 0;
+			struct pollfd pfd;
+			pfd.fd = sock;
+			pfd.events = POLLOUT;
+			pfd.revents = 0;
+			ret = poll (&pfd, 1, connectionTimeout * 1000);
+			if (ret == 0)
+			{
+				logStream (MESSAGE_ERROR) << "timeout writing binary data to " << getName () << sendLog;
+				connectionError (-1);
+				return -1;
+			}
+			if (ret == -1 && errno != EINTR)
+			{
+				connectionError (-1);
+				return -1;
+			}
+			continue;
+		}
+		qw.offset += ret;
+		writeQueueSize -= ret;
+		writeStatBytes += ret;
+		if (qw.offset >= qw.chunk->getSize ())
+		{
+			qw.chunk->unref ();
+			writeQueue.pop_front ();
+		}
+		successfullSend ();
+	}
+	return 0;
+}
+
+void Connection::clearWriteQueue ()
+{
+	for (std::list <QueuedWrite>::iterator iter = writeQueue.begin (); iter != writeQueue.end (); iter++)
+		iter->chunk->unref ();
+	writeQueue.clear ();
+	writeQueueSize = 0;
+}
+
+int Connection::sendBinaryValue (Value *value)
+{
+	if (!binaryValues || sock < 0)
+		return -1;
+	size_t start = binaryValueFrame.size ();
+	std::string name = value->getName ();
+	binaryAppendUInt16 (binaryValueFrame, name.length ());
+	binaryValueFrame.append (name);
+	binaryAppendUInt32 (binaryValueFrame, value->getValueType ());
+	// payload size is filled after the value is encoded
+	binaryAppendUInt32 (binaryValueFrame, 0);
+	size_t payload = binaryValueFrame.size ();
+	if (value->encodeBinary (binaryValueFrame) == false)
+	{
+		binaryValueFrame.resize (start);
+		return -1;
+	}
+	// too large value would be refused by the other side, send it as text
+	if (binaryValueFrame.size () > MAX_BINARY_FRAME_SIZE)
+	{
+		binaryValueFrame.resize (start);
+		return -1;
+	}
+	uint32_t psize = binaryValueFrame.size () - payload;
+	for (int i = 0; i < 4; i++)
+		binaryValueFrame[payload - 4 + i] = (char) (psize >> (8 * (3 - i)));
+	if (valueBatch > 0 && binaryValueFrame.size () < MAX_BINARY_VALUES_FRAME)
+		return 0;
+	return flushBinaryValues ();
+}
+
+int Connection::endValueBatch ()
+{
+	if (valueBatch > 0)
+		valueBatch--;
+	if (valueBatch == 0 && !binaryValueFrame.empty ())
+		return flushBinaryValues ();
+	return 0;
+}
+
+int Connection::flushBinaryValues ()
+{
+	std::ostringstream _os;
+	_os << PROTO_BINARY_VALUES " " << binaryValueFrame.size ();
+	if (ProtocolRecorder::recording)
+		ProtocolRecorder::instance ()->record (this, '>', _os.str ().c_str ());
+	_os << "\n";
+	std::string frame = _os.str ();
+	frame.append (binaryValueFrame);
+	binaryValueFrame.clear ();
+	return sendRawData (frame.data (), frame.size ());
+}
+
+int Connection::sendRawData (const char *data, size_t len)
+{
+	if (sock < 0)
+		return -1;
+	if (!writeQueue.empty ())
+	{
+		DataChunk *chunk = new DataChunk (data, len);
+		queueWrite (chunk);
+		chunk->unref ();
+		return flushWriteQueue (false);
+	}
+	size_t sent = 0;
+	while (sent < len)
+	{
+		ssize_t ret = send (sock, data + sent, len - sent, MSG_DONTWAIT);
+		if (ret == -1)
+		{
+			if (errno == EINTR)
+				continue;
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+			{
+				// rest is written when socket becomes writable
+				DataChunk *chunk = new DataChunk (data + sent, len - sent);
+				queueWrite (chunk);
+				chunk->unref ();
+				return 0;
+			}
+			connectionError (-1);
+			return -1;
+		}
+		sent += ret;
+	}
+	successfullSend ();
+	return 0;
+}
+
+void Connection::addBinaryValueData (const char *data, size_t len)
+{
+	binaryValueRead.insert (binaryValueRead.end (), data, data + len);
+	binaryValueRest -= len;
+	if (binaryValueRest == 0)
+		processBinaryValues ();
+}
+
+void Connection::processBinaryValues ()
+{
+	const char *p = &(binaryValueRead[0]);
+	const char *end = p + binaryValueRead.size ();
+	while (p < end)
+	{
+		if (end - p < 2)
+			break;
+		size_t nlen = binaryGetUInt16 (p);
+		p += 2;
+		if ((size_t) (end - p) < nlen + 8)
+			break;
+		std::string name (p, nlen);
+		p += nlen;
+		int vtype = binaryGetUInt32 (p);
+		size_t psize = binaryGetUInt32 (p + 4);
+		p += 8;
+		if ((size_t) (end - p) < psize)
+			break;
+		Value *value = getValue (name.c_str ());
+		if (value == NULL || value->getValueType () != vtype || value->decodeBinary (p, psize))
+		{
+			logStream (MESSAGE_ERROR) << "cannot set binary value " << name << " from connection '" << getName () << "'" << sendLog;
+		}
+		else if (getOtherDevClient ())
+		{
+			getOtherDevClient ()->valueChanged (value);
+		}
+		p += psize;
+	}
+	if (p != end)
+		logStream (MESSAGE_ERROR) << "truncated binary value frame from connection '" << getName () << "'" << sendLog;
+	binaryValueRead.clear ();
+}
+
 void Connection::endBinaryData (int data_conn)
 {
 	std::ostringstream _os;
@@ -1692,6 +2069,7 @@ void Connection::connectionError (int last_data_size)
 	if (sock >= 0)
 		close (sock);
 	sock = -1;
+	clearWriteQueue ();
 	if (strlen (getName ()))
 		master->deleteAddress (getCentraldNum (), getName ());
 }
@@ -2096,6 +2474,7 @@ int Connection::metaInfo (int rts2Type, std::string m_name, std::string desc)
 			return -1;
 		}
 		eiter = values.removeValue (m_name.c_str ());
+		master->valuesDeleted ();
 	}
 	else
 	{
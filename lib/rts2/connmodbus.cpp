@@ -24,6 +24,52 @@
 
 using namespace rts2core;
 
+ModbusTransaction::ModbusTransaction (const std::string &_request, char _func, TransactionCallback *_callback, double _timeout, int _id):Transaction (_request, _callback, _timeout, _id)
+{
+	func = _func;
+}
+
+size_t ModbusTransaction::frameLength (const char *buf, size_t len)
+{
+	if (len < 6)
+		return 0;
+	size_t flen = ntohs (*((uint16_t *) (buf + 4))) + 6;
+	return len >= flen ? flen : 0;
+}
+
+bool ModbusTransaction::isException ()
+{
+	return response.length () > 8 && (response[7] & 0x80);
+}
+
+bool ModbusTransaction::isValidReply ()
+{
+	return isDone () && response.length () >= 8 && response.substr (0, 2) == request.substr (0, 2) && response[7] == func;
+}
+
+std::string ModbusTransaction::getReplyData ()
+{
+	if (response.length () <= 8)
+		return std::string ();
+	return response.substr (8);
+}
+
+int ModbusTransaction::getRegisters (uint16_t *reply_data, int16_t qty)
+{
+	if (!isValidReply ())
+		return -1;
+	std::string rd = getReplyData ();
+	if (rd.length () != (size_t) (1 + qty * 2) || rd[0] != qty * 2)
+		return -1;
+	const char *rtop = rd.data () + 1;
+	for (int16_t i = 0; i < qty; i++)
+	{
+		reply_data[i] = ntohs (*((uint16_t *) rtop));
+		rtop += 2;
+	}
+	return 0;
+}
+
 ConnModbus::ConnModbus (Block * _master, const char *_hostname, int _port):ConnTCP (_master, _hostname, _port)
 {
 	transId = 1;
@@ -143,3 +189,45 @@ void ConnModbus::writeHoldingRegisterMask (int16_t reg, int16_t mask, int16_t va
 	old_value |= (val & mask);
 	writeHoldingRegister (reg, old_value);
 }
+
+std::string ConnModbus::createRequest (char func, const void *data, size_t data_size)
+{
+	char header[8];
+	*((uint16_t *) header) = htons (transId);
+	header[2] = 0;
+	header[3] = 0;
+	*((uint16_t *) (header + 4)) = htons (data_size + 2);
+	header[6] = unitId;
+	header[7] = func;
+	transId++;
+	return std::string (header, 8) + std::string ((const char *) data, data_size);
+}
+
+void ConnModbus::queueFunction (char func, const void *data, size_t data_size, TransactionCallback *callback, double timeout, int id)
+{
+	queueTransaction (new ModbusTransaction (createRequest (func, data, data_size), func, callback, timeout, id));
+}
+
+void ConnModbus::queueReadHoldingRegisters (int16_t start, int16_t qty, TransactionCallback *callback, double timeout, int id)
+{
+	int16_t req_data[2];
+	req_data[0] = htons (start);
+	req_data[1] = htons (qty);
+	queueFunction (0x03, req_data, 4, callback, timeout, id);
+}
+
+void ConnModbus::queueReadInputRegisters (int16_t start, int16_t qty, TransactionCallback *callback, double timeout, int id)
+{
+	int16_t req_data[2];
+	req_data[0] = htons (start);
+	req_data[1] = htons (qty);
+	queueFunction (0x04, req_data, 4, callback, timeout, id);
+}
+
+void ConnModbus::queueWriteHoldingRegister (int16_t reg, int16_t val, TransactionCallback *callback, double timeout, int id)
+{
+	int16_t req_data[2];
+	req_data[0] = htons (reg);
+	req_data[1] = htons (val);
+	queueFunction (0x06, req_data, 4, callback, timeout, id);
+}
@@ -46,7 +46,7 @@ void ConnSerial::flushError ()
 	}
 }
 
-ConnSerial::ConnSerial (const char *_devName, rts2core::Block * _master, bSpeedT _baudSpeed, cSizeT _cSize, parityT _parity, int _vTime, int _flushSleepTime):ConnNoSend (_master)
+ConnSerial::ConnSerial (const char *_devName, rts2core::Block * _master, bSpeedT _baudSpeed, cSizeT _cSize, parityT _parity, int _vTime, int _flushSleepTime):ConnTransaction (_master)
 {
 	sock = open (_devName, O_RDWR | O_NOCTTY | O_NDELAY);
 
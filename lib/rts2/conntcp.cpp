@@ -27,13 +27,13 @@
 
 using namespace rts2core;
 
-ConnTCP::ConnTCP (rts2core::Block *_master, const char *_hostname, int _port):ConnNoSend (_master), hostname (_hostname)
+ConnTCP::ConnTCP (rts2core::Block *_master, const char *_hostname, int _port):ConnTransaction (_master), hostname (_hostname)
 {
 	port = _port;
 	debug = false;
 }
 
-ConnTCP::ConnTCP (rts2core::Block *_master, int _port):ConnNoSend (_master), hostname ("")
+ConnTCP::ConnTCP (rts2core::Block *_master, int _port):ConnTransaction (_master), hostname ("")
 {
 	port = _port;
 	debug = false;
@@ -337,12 +337,12 @@ void ConnTCP::postEvent (Event *event)
 			}
 			break;
 	}
-	ConnNoSend::postEvent (event);
+	ConnTransaction::postEvent (event);
 }
 
 void ConnTCP::connectionError (int last_data_size)
 {
 	if (sock > 0)
 		getMaster()->addTimer (60, new Event (EVENT_TCP_RECONECT_TIMER, this));
-	ConnNoSend::connectionError (last_data_size);
+	ConnTransaction::connectionError (last_data_size);
 }
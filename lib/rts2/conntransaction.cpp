@@ -0,0 +1,474 @@
+/*
+ * Asynchronous request/response transactions on device connections.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "connection/transaction.h"
+#include "utilsfunc.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <iomanip>
+
+using namespace rts2core;
+
+Transaction::Transaction (const std::string &_request, TransactionCallback *_callback, double _timeout, int _id):request (_request), response (), endString ()
+{
+	callback = _callback;
+	timeout = _timeout;
+	id = _id;
+	retries = 0;
+	responseLength = 0;
+	state = TRANS_QUEUED;
+	queued = NAN;
+	sent = NAN;
+	finished = NAN;
+}
+
+size_t Transaction::frameLength (const char *buf, size_t len)
+{
+	if (responseLength > 0)
+		return len >= responseLength ? responseLength : 0;
+	if (endString.length () == 0)
+		return 0;
+	std::string data (buf, len);
+	size_t pos = data.find (endString);
+	if (pos == std::string::npos)
+		return 0;
+	return pos + endString.length ();
+}
+
+void LatencyHistogram::reset ()
+{
+	for (int i = 0; i < 17; i++)
+		buckets[i] = 0;
+	count = 0;
+	sum = 0;
+	max = 0;
+}
+
+void LatencyHistogram::add (double latency)
+{
+	int b;
+	for (b = 0; b < 16 && latency > bucketLimit (b); b++)
+		;
+	buckets[b]++;
+	count++;
+	sum += latency;
+	if (latency > max)
+		max = latency;
+}
+
+double LatencyHistogram::getPercentile (double p)
+{
+	if (count == 0)
+		return NAN;
+	unsigned long limit = ceil (p * count);
+	unsigned long c = 0;
+	for (int b = 0; b < 16; b++)
+	{
+		c += buckets[b];
+		if (c >= limit)
+			return bucketLimit (b);
+	}
+	return max;
+}
+
+std::ostream & rts2core::operator << (std::ostream &_os, LatencyHistogram &h)
+{
+	std::ios_base::fmtflags oldFlags = _os.flags ();
+	_os << "count " << h.count << " mean " << std::fixed << std::setprecision (4) << h.getMean () << " max " << h.getMax () << " buckets";
+	for (int b = 0; b < 17; b++)
+	{
+		if (h.buckets[b] == 0)
+			continue;
+		if (b < 16)
+			_os << " <" << LatencyHistogram::bucketLimit (b) << ":" << h.buckets[b];
+		else
+			_os << " >" << LatencyHistogram::bucketLimit (15) << ":" << h.buckets[b];
+	}
+	_os.flags (oldFlags);
+	return _os;
+}
+
+ConnTransaction::ConnTransaction (Block *_master):ConnNoSend (_master), waiting (), inProgress (), writeBuffer (), readBuffer (), latencies ()
+{
+	pipelineDepth = 1;
+	registered = false;
+	transactionDebug = false;
+	flushPending = false;
+	timerDeadline = NAN;
+	timeouts = 0;
+	failures = 0;
+	retried = 0;
+}
+
+ConnTransaction::ConnTransaction (int _sock, Block *_master):ConnNoSend (_sock, _master), waiting (), inProgress (), writeBuffer (), readBuffer (), latencies ()
+{
+	pipelineDepth = 1;
+	registered = false;
+	transactionDebug = false;
+	flushPending = false;
+	timerDeadline = NAN;
+	timeouts = 0;
+	failures = 0;
+	retried = 0;
+}
+
+ConnTransaction::~ConnTransaction ()
+{
+	for (std::deque <Transaction *>::iterator iter = waiting.begin (); iter != waiting.end (); iter++)
+		delete *iter;
+	for (std::deque <Transaction *>::iterator iter = inProgress.begin (); iter != inProgress.end (); iter++)
+		delete *iter;
+	if (registered)
+	{
+		// timer events carry pointer to this connection, and would be delivered to the deleted connection.
+		// Older timers can be pending even when timerDeadline was reset
+		getMaster ()->deleteTimers (EVENT_TRANSACTION_TIMEOUT, this);
+		getMaster ()->removeConnection (this);
+	}
+}
+
+void ConnTransaction::queueTransaction (Transaction *t)
+{
+	if (!registered)
+	{
+		getMaster ()->addConnection (this);
+		registered = true;
+	}
+	t->queued = getNow ();
+	t->state = TRANS_QUEUED;
+	if (sock < 0)
+	{
+		finishTransaction (t, TRANS_FAILED);
+		return;
+	}
+	waiting.push_back (t);
+	startTransactions ();
+	scheduleDeadline ();
+}
+
+int ConnTransaction::add (Block *block)
+{
+	if (!registered)
+		return ConnNoSend::add (block);
+	if (sock < 0)
+		return 0;
+	short events = POLLIN | POLLPRI;
+	if (writeBuffer.length () > 0 || isConnState (CONN_INPROGRESS))
+		events |= POLLOUT;
+	block->addPollFD (sock, events);
+	return 0;
+}
+
+int ConnTransaction::receive (Block *block)
+{
+	if (!registered)
+		return ConnNoSend::receive (block);
+	if (sock < 0 || !(block->getPollEvents (sock) & (POLLIN | POLLPRI)))
+		return 0;
+
+	char rbuf[1024];
+	ssize_t ret = read (sock, rbuf, sizeof (rbuf));
+	if (ret < 0)
+	{
+		if (errno == EINTR || errno == EAGAIN)
+			return 0;
+		logStream (MESSAGE_ERROR) << "error reading from " << getName () << ": " << strerror (errno) << sendLog;
+		connectionError (-1);
+		return -1;
+	}
+	if (ret == 0)
+	{
+		// serial ports can signal readable with no data; sockets are closed
+		if (isConnState (CONN_CONNECTED))
+		{
+			connectionError (0);
+			return -1;
+		}
+		return 0;
+	}
+
+	successfullRead ();
+
+	if (inProgress.empty () || flushPending)
+	{
+		if (transactionDebug)
+		{
+			LogStream ls = logStream (MESSAGE_DEBUG);
+			ls << "ignoring unexpected data from " << getName () << ": ";
+			ls.logArr (rbuf, ret);
+			ls << sendLog;
+		}
+		return 0;
+	}
+
+	readBuffer.append (rbuf, ret);
+
+	while (!inProgress.empty () && readBuffer.length () > 0)
+	{
+		Transaction *t = inProgress.front ();
+		size_t len = t->frameLength (readBuffer.data (), readBuffer.length ());
+		if (len == 0)
+			break;
+		t->response = readBuffer.substr (0, len);
+		readBuffer.erase (0, len);
+		inProgress.pop_front ();
+		finishTransaction (t, TRANS_DONE);
+	}
+
+	startTransactions ();
+	return 0;
+}
+
+int ConnTransaction::writable (Block *block)
+{
+	if (!registered)
+		return ConnNoSend::writable (block);
+	if (sock < 0 || !(block->getPollEvents (sock) & POLLOUT))
+		return 0;
+	if (isConnState (CONN_INPROGRESS))
+		return ConnNoSend::writable (block);
+	if (writeBuffer.length () == 0)
+		return 0;
+
+	// late response to timed out transaction must not be taken as response to the request being written
+	if (flushPending)
+	{
+		flushInput ();
+		flushPending = false;
+	}
+
+	ssize_t ret = write (sock, writeBuffer.data (), writeBuffer.length ());
+	if (ret < 0)
+	{
+		if (errno == EINTR || errno == EAGAIN)
+			return 0;
+		logStream (MESSAGE_ERROR) << "error writing to " << getName () << ": " << strerror (errno) << sendLog;
+		connectionError (-1);
+		return -1;
+	}
+	writeBuffer.erase (0, ret);
+
+	// transactions without response are done once they are written
+	if (writeBuffer.length () == 0)
+	{
+		while (!inProgress.empty () && !inProgress.front ()->expectsResponse ())
+		{
+			Transaction *t = inProgress.front ();
+			inProgress.pop_front ();
+			finishTransaction (t, TRANS_DONE);
+		}
+		startTransactions ();
+	}
+	return 0;
+}
+
+int ConnTransaction::idle ()
+{
+	if (registered)
+		checkDeadlines ();
+	return ConnNoSend::idle ();
+}
+
+void ConnTransaction::postEvent (Event *event)
+{
+	switch (event->getType ())
+	{
+		case EVENT_TRANSACTION_TIMEOUT:
+			if (event->getArg () != this)
+				break;
+			timerDeadline = NAN;
+			checkDeadlines ();
+			break;
+	}
+	ConnNoSend::postEvent (event);
+}
+
+void ConnTransaction::connectionError (int last_data_size)
+{
+	ConnNoSend::connectionError (last_data_size);
+	// socket is closed, so transactions queued from callbacks fail immediately
+	failTransactions (TRANS_FAILED);
+}
+
+void ConnTransaction::failTransactions (trans_state_t state)
+{
+	readBuffer.clear ();
+	writeBuffer.clear ();
+	while (!inProgress.empty ())
+	{
+		Transaction *t = inProgress.front ();
+		inProgress.pop_front ();
+		finishTransaction (t, state);
+	}
+	while (!waiting.empty ())
+	{
+		Transaction *t = waiting.front ();
+		waiting.pop_front ();
+		finishTransaction (t, state);
+	}
+}
+
+void ConnTransaction::startTransactions ()
+{
+	if (sock < 0 || isConnState (CONN_INPROGRESS))
+		return;
+	while (!waiting.empty () && inProgress.size () < pipelineDepth)
+	{
+		Transaction *t = waiting.front ();
+		waiting.pop_front ();
+		t->sent = getNow ();
+		t->state = TRANS_SENT;
+		writeBuffer.append (t->request);
+		inProgress.push_back (t);
+		if (transactionDebug)
+		{
+			LogStream ls = logStream (MESSAGE_DEBUG);
+			ls << "sending transaction " << t->getId () << " to " << getName () << ": ";
+			ls.logArr (t->request.data (), t->request.length ());
+			ls << sendLog;
+		}
+	}
+}
+
+void ConnTransaction::finishTransaction (Transaction *t, trans_state_t state)
+{
+	t->state = state;
+	t->finished = getNow ();
+	switch (state)
+	{
+		case TRANS_DONE:
+			latencies.add (t->getLatency ());
+			break;
+		case TRANS_TIMEOUT:
+			timeouts++;
+			break;
+		default:
+			failures++;
+			break;
+	}
+	if (t->callback)
+		t->callback->transactionFinished (t);
+	delete t;
+}
+
+void ConnTransaction::flushInput ()
+{
+	readBuffer.clear ();
+	if (sock < 0)
+		return;
+	// serial ports might be opened in blocking mode, read only what is available
+	struct pollfd pfd;
+	pfd.fd = sock;
+	pfd.events = POLLIN;
+	char rbuf[1024];
+	while (poll (&pfd, 1, 0) > 0 && (pfd.revents & POLLIN))
+	{
+		ssize_t ret = read (sock, rbuf, sizeof (rbuf));
+		if (ret <= 0)
+			break;
+		if (transactionDebug)
+		{
+			LogStream ls = logStream (MESSAGE_DEBUG);
+			ls << "dropping late data from " << getName () << ": ";
+			ls.logArr (rbuf, ret);
+			ls << sendLog;
+		}
+	}
+}
+
+void ConnTransaction::checkDeadlines ()
+{
+	double now = getNow ();
+	bool timedOut = false;
+	std::deque <Transaction *> retryQueue;
+	// transactions are queued in order, but can have different timeouts
+	for (std::deque <Transaction *>::iterator iter = inProgress.begin (); iter != inProgress.end ();)
+	{
+		if ((*iter)->getDeadline () <= now)
+		{
+			Transaction *t = *iter;
+			iter = inProgress.erase (iter);
+			logStream (MESSAGE_WARNING) << "transaction " << t->getId () << " on " << getName () << " timed out after " << (now - t->sent) << " seconds" << (t->retries > 0 ? ", retrying" : "") << sendLog;
+			// response might be partially received or arrive later, drop it so it will not be matched to the following transaction
+			flushInput ();
+			flushPending = true;
+			transactionTimeout (t);
+			timedOut = true;
+			if (t->retries > 0)
+			{
+				// retried transaction goes first, so replies keep the order of requests
+				t->retries--;
+				t->queued = now;
+				t->state = TRANS_QUEUED;
+				retried++;
+				retryQueue.push_back (t);
+			}
+			else
+			{
+				finishTransaction (t, TRANS_TIMEOUT);
+			}
+		}
+		else
+		{
+			iter++;
+		}
+	}
+	for (std::deque <Transaction *>::iterator iter = waiting.begin (); iter != waiting.end ();)
+	{
+		if ((*iter)->getDeadline () <= now)
+		{
+			Transaction *t = *iter;
+			iter = waiting.erase (iter);
+			finishTransaction (t, TRANS_TIMEOUT);
+		}
+		else
+		{
+			iter++;
+		}
+	}
+	waiting.insert (waiting.begin (), retryQueue.begin (), retryQueue.end ());
+	if (timedOut)
+		startTransactions ();
+	scheduleDeadline ();
+}
+
+void ConnTransaction::scheduleDeadline ()
+{
+	double deadline = NAN;
+	std::deque <Transaction *>::iterator iter;
+	for (iter = inProgress.begin (); iter != inProgress.end (); iter++)
+	{
+		if (isnan (deadline) || (*iter)->getDeadline () < deadline)
+			deadline = (*iter)->getDeadline ();
+	}
+	for (iter = waiting.begin (); iter != waiting.end (); iter++)
+	{
+		if (isnan (deadline) || (*iter)->getDeadline () < deadline)
+			deadline = (*iter)->getDeadline ();
+	}
+	if (isnan (deadline))
+		return;
+	// timer wakes up the main loop; do not add new one if already set to earlier time
+	if (!isnan (timerDeadline) && timerDeadline <= deadline)
+		return;
+	timerDeadline = deadline;
+	double now = getNow ();
+	getMaster ()->addTimer (deadline > now ? deadline - now : 0, new Event (EVENT_TRANSACTION_TIMEOUT, this));
+}
@@ -33,6 +33,7 @@
 #include <sys/wait.h>
 
 #include "daemon.h"
+#include "protorecorder.h"
 
 #ifndef LOCK_SH
 #define   LOCK_SH   1    /* shared lock */
@@ -51,6 +52,10 @@
 #endif
 
 #define OPT_AUTORESTART         OPT_LOCAL + 623
+#define OPT_RECORD_PROTOCOL     OPT_LOCAL + 624
+
+// interval (in seconds) over which info_rate is calculated
+#define INFO_RATE_WINDOW        60
 
 using namespace rts2core;
 
@@ -96,6 +101,25 @@ Daemon::Daemon (int _argc, char **_argv, int _init_state):rts2core::Block (_argc
 
 	info_time = new ValueTime (RTS2_VALUE_INFOTIME, "time of last update", false);
 
+	createValue (infoCalls, "info_calls", "number of hardware info calls", false);
+	infoCalls->setValueLong (0);
+	createValue (infoRate, "info_rate", "[1/s] hardware info calls per second", false);
+
+	lastInfoCall = NAN;
+	infoRateStart = getNow ();
+	infoRateCalls = 0;
+
+	// error and warning messages are never dropped
+	logDropped[LOG_LEVEL_ERROR] = NULL;
+	logDropped[LOG_LEVEL_WARNING] = NULL;
+	createValue (logDropped[LOG_LEVEL_INFO], "log_dropped_info", "number of dropped info log messages", false);
+	createValue (logDropped[LOG_LEVEL_DEBUG], "log_dropped_debug", "number of dropped debug log messages", false);
+	for (int i = LOG_LEVEL_INFO; i < LOG_LEVELS; i++)
+		logDropped[i]->setValueLong (0);
+
+	createValue (logRateLimit, "log_rate_limit", "[1/s] maximal number of info and debug messages per second, 0 for no limit", false, RTS2_VALUE_WRITABLE);
+	logRateLimit->setValueInteger (500);
+
 	idleInfoInterval = -1;
 
 	addOption ('i', NULL, 0, "run in interactive mode, don't loose console");
@@ -107,6 +131,7 @@ Daemon::Daemon (int _argc, char **_argv, int _init_state):rts2core::Block (_argc
 	addOption (OPT_MODEFILE, "modefile", 1, "file holding device modes");
 	addOption (OPT_AUTOSAVE, "autosave", 1, "autosave file");
 	addOption (OPT_DEFAULTS, "defaults", 1, "file with default values");
+	addOption (OPT_RECORD_PROTOCOL, "record-protocol", 1, "append all protocol lines to the given file (for rts2-protoreplay)");
 }
 
 Daemon::~Daemon (void)
@@ -118,6 +143,8 @@ Daemon::~Daemon (void)
 	delete info_time;
 	closelog ();
 	delete modeconf;
+	if (ProtocolRecorder::recording)
+		ProtocolRecorder::instance ()->close ();
 }
 
 int Daemon::processOption (int in_opt)
@@ -151,6 +178,13 @@ int Daemon::processOption (int in_opt)
 		case OPT_VALUEFILE:
 			valueFile = optarg;
 			break;
+		case OPT_RECORD_PROTOCOL:
+			if (ProtocolRecorder::instance ()->open (optarg))
+			{
+				std::cerr << "cannot open protocol recording file " << optarg << ": " << strerror (errno) << std::endl;
+				return -1;
+			}
+			break;
 		default:
 			return rts2core::Block::processOption (in_opt);
 	}
@@ -473,8 +507,10 @@ int Daemon::run ()
 	beforeRun ();
 	if (setupAutoRestart () != -1)
 		return 0;
+	startLogQueue ();
 	while (!getEndLoop ())
 		oneRunLoop ();
+	stopLogQueue ();
 	return 0;
 }
 
@@ -496,9 +532,35 @@ int Daemon::idle ()
 		doHupIdleLoop = false;
 	}
 
+	double now = getNow ();
+	if (now - infoRateStart >= INFO_RATE_WINDOW)
+	{
+		infoRate->setValueDouble ((infoCalls->getValueLong () - infoRateCalls) / (now - infoRateStart));
+		infoRateStart = now;
+		infoRateCalls = infoCalls->getValueLong ();
+	}
+
 	return rts2core::Block::idle ();
 }
 
+void Daemon::drainLogQueue ()
+{
+	LogQueue *lq = getLogQueue ();
+	if (lq == NULL)
+		return;
+	lq->setRateLimit (logRateLimit->getValueInteger ());
+	rts2core::Block::drainLogQueue ();
+	for (int i = LOG_LEVEL_INFO; i < LOG_LEVELS; i++)
+	{
+		long d = lq->getDropped (i);
+		if (d != logDropped[i]->getValueLong ())
+		{
+			logDropped[i]->setValueLong (d);
+			sendValueAll (logDropped[i]);
+		}
+	}
+}
+
 void Daemon::setInfoTime (struct tm *_date)
 {
 	static char p_tz[100];
@@ -643,6 +705,9 @@ void Daemon::addPollSocks ()
 {
 	rts2core::Block::addPollSocks ();
 	addPollFD (listen_sock, POLLIN | POLLPRI);
+	// wake up when other threads log
+	if (getLogQueue () != NULL && getLogQueue ()->getWakeFD () >= 0)
+		addPollFD (getLogQueue ()->getWakeFD (), POLLIN);
 }
 
 void Daemon::pollSuccess ()
@@ -663,6 +728,8 @@ void Daemon::pollSuccess ()
 			addConnectionSock (client);
 		}
 	}
+	if (getLogQueue () != NULL && getLogQueue ()->getWakeFD () >= 0 && isForRead (getLogQueue ()->getWakeFD ()))
+		getLogQueue ()->clearWake ();
 	rts2core::Block::pollSuccess ();
 }
 
@@ -951,13 +1018,14 @@ int Daemon::baseInfo (Connection * conn)
 
 int Daemon::sendBaseInfo (Connection * conn)
 {
+	conn->beginValueBatch ();
 	for (ValueVector::iterator iter = constValues.begin ();
 		iter != constValues.end (); iter++)
 	{
 		Value *val = *iter;
 		val->send (conn);
 	}
-	return 0;
+	return conn->endValueBatch ();
 }
 
 int Daemon::info ()
@@ -966,12 +1034,19 @@ int Daemon::info ()
 	return 0;
 }
 
+int Daemon::callInfo ()
+{
+	lastInfoCall = getNow ();
+	infoCalls->inc ();
+	return info ();
+}
+
 int Daemon::info (Connection * conn)
 {
 	int ret;
 	try
 	{
-		ret = info ();
+		ret = callInfo ();
 		if (ret)
 		{
 			conn->sendCommandEnd (DEVDEM_E_HW, "device not ready");
@@ -994,7 +1069,7 @@ int Daemon::infoAll ()
 	int ret;
 	try
 	{
-		ret = info ();
+		ret = callInfo ();
 		if (ret)
 			return -1;
 	}
@@ -1030,6 +1105,7 @@ int Daemon::sendInfo (Connection * conn, bool forceSend)
 {
 	if (!isRunning (conn))
 		return -1;
+	conn->beginValueBatch ();
 	for (CondValueVector::iterator iter = values.begin (); iter != values.end (); iter++)
 	{
 		Value *val = (*iter)->getValue ();
@@ -1040,7 +1116,7 @@ int Daemon::sendInfo (Connection * conn, bool forceSend)
 	}
 	if (info_time->needSend ())
 		info_time->send (conn);
-	return 0;
+	return conn->endValueBatch ();
 }
 
 void Daemon::sendValueAll (Value * value)
@@ -28,6 +28,70 @@
 
 using namespace rts2core;
 
+DataChunk::DataChunk (const char *_data, size_t _size)
+{
+	size = _size;
+	data = new char[size];
+	memcpy (data, _data, size);
+	refCount = 1;
+}
+
+DataPool *DataPool::pInstance = NULL;
+
+DataPool *DataPool::instance ()
+{
+	if (pInstance == NULL)
+		pInstance = new DataPool ();
+	return pInstance;
+}
+
+DataPool::DataPool ():freeBuffers ()
+{
+	freeSize = 0;
+	// buffers are kept only when asked for, as most processes receive only occasional data
+	maxFree = 0;
+}
+
+char *DataPool::allocate (size_t size)
+{
+	std::multimap <size_t, char *>::iterator iter = freeBuffers.find (size);
+	if (iter == freeBuffers.end ())
+		return new char[size];
+	char *ret = iter->second;
+	freeBuffers.erase (iter);
+	freeSize -= size;
+	return ret;
+}
+
+void DataPool::release (char *buf, size_t size)
+{
+	if (freeSize + size > maxFree)
+	{
+		delete[] buf;
+		return;
+	}
+	freeBuffers.insert (std::pair <size_t, char *> (size, buf));
+	freeSize += size;
+}
+
+void DataPool::preallocate (size_t size, int count)
+{
+	for (int i = 0; i < count; i++)
+		release (new char[size], size);
+}
+
+void DataPool::setMaxFree (size_t _maxFree)
+{
+	maxFree = _maxFree;
+	while (freeSize > maxFree && !freeBuffers.empty ())
+	{
+		std::multimap <size_t, char *>::iterator iter = freeBuffers.begin ();
+		freeSize -= iter->first;
+		delete[] iter->second;
+		freeBuffers.erase (iter);
+	}
+}
+
 int DataRead::readDataSize (Connection *conn)
 {
 	return conn->paramNextSSizeT (&binaryReadChunkSize);
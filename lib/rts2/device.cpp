@@ -29,6 +29,9 @@
 #define MINDATAPORT   5556
 #define MAXDATAPORT   5656
 
+// maximal size of single write of queued log messages
+#define MESSAGES_WRITE   4096
+
 using namespace rts2core;
 
 int DevConnection::command ()
@@ -46,6 +49,13 @@ int DevConnection::command ()
 		if (ret != -5)
 			return ret;
 	}
+	if (isCommand (COMMAND_BINARY_VALUES))
+	{
+		if (!paramEnd ())
+			return -2;
+		setBinaryValues (true);
+		return 0;
+	}
 	if (isCommand ("auth"))
 	{
 		int auth_id;
@@ -498,6 +508,7 @@ Device::Device (int in_argc, char **in_argv, int in_device_type, const char *def
 
 	// now add options..
 	addOption (OPT_NOAUTH, "noauth", 0, "allow unauthorized connections");
+	addOption (OPT_BINARY_VALUES, "binary-values", 0, "ask other devices to send value updates in binary frames");
 	addOption (OPT_NOTCHECKNULL, "notcheck", 0, "ignore if some recomended values are not set");
 	addOption (OPT_LOCALHOST, "localhost", 1, "hostname, if it different from return of gethostname()");
 	addOption (OPT_SERVER, "server", 1, "hostname (and possibly port number, separated by :) of central server");
@@ -506,6 +517,8 @@ Device::Device (int in_argc, char **in_argv, int in_device_type, const char *def
 
 Device::~Device (void)
 {
+	for (std::map <Connection *, Subscription *>::iterator iter = subscriptions.begin (); iter != subscriptions.end (); iter++)
+		delete iter->second;
 	delete[] last_weathermsg;
 	delete[] device_host;
 }
@@ -521,6 +534,18 @@ int Device::commandAuthorized (Connection * conn)
 	{
 		return info (conn);
 	}
+	else if (conn->isCommand (COMMAND_SUBSCRIBE))
+	{
+		return subscribe (conn);
+	}
+	else if (conn->isCommand (COMMAND_UNSUBSCRIBE))
+	{
+		if (!conn->paramEnd ())
+			return -2;
+		removeSubscription (conn);
+		scheduleSubscriptions ();
+		return 0;
+	}
 	else if (conn->isCommand ("base_info"))
 	{
 		return baseInfo (conn);
@@ -591,6 +616,160 @@ void Device::setWeatherState (bool good_weather, const char *msg)
 	}
 }
 
+void Device::postEvent (Event *event)
+{
+	switch (event->getType ())
+	{
+		case EVENT_SUBSCRIPTION_PUSH:
+			pushSubscriptions ();
+			break;
+	}
+	Daemon::postEvent (event);
+}
+
+void Device::connectionRemoved (Connection *conn)
+{
+	removeSubscription (conn);
+	Daemon::connectionRemoved (conn);
+}
+
+int Device::subscribe (Connection *conn)
+{
+	double period;
+	double deadband;
+	if (conn->paramNextDouble (&period) || conn->paramNextDouble (&deadband) || period <= 0 || deadband < 0)
+		return -2;
+
+	Subscription *sub = new Subscription (conn, period, deadband);
+	while (!conn->paramEnd ())
+	{
+		char *name;
+		if (conn->paramNextString (&name))
+		{
+			delete sub;
+			return -2;
+		}
+		Value *val = getOwnValue (name);
+		if (val == NULL)
+		{
+			delete sub;
+			conn->sendCommandEnd (DEVDEM_E_PARAMSVAL, (std::string ("unknown value ") + name).c_str ());
+			return -1;
+		}
+		sub->addValue (val);
+	}
+
+	removeSubscription (conn);
+	subscriptions[conn] = sub;
+
+	// refresh values if they are older than requested period
+	if (isnan (getLastInfoCall ()) || getNow () - getLastInfoCall () > period)
+	{
+		try
+		{
+			if (callInfo ())
+			{
+				conn->sendCommandEnd (DEVDEM_E_HW, "device not ready");
+				return -1;
+			}
+		}
+		catch (rts2core::Error &er)
+		{
+			conn->sendCommandEnd (DEVDEM_E_HW, er.what ());
+			return -1;
+		}
+	}
+	sendSubscription (sub, true);
+	sendInfoTime (conn);
+	scheduleSubscriptions ();
+	return 0;
+}
+
+void Device::removeSubscription (Connection *conn)
+{
+	std::map <Connection *, Subscription *>::iterator iter = subscriptions.find (conn);
+	if (iter == subscriptions.end ())
+		return;
+	delete iter->second;
+	subscriptions.erase (iter);
+}
+
+void Device::sendSubscription (Subscription *sub, bool force)
+{
+	for (CondValueVector::iterator iter = getValuesBegin (); iter != getValuesEnd (); iter++)
+	{
+		Value *val = (*iter)->getValue ();
+		if (sub->isSubscribed (val))
+			sub->pushValue (val, force);
+	}
+}
+
+void Device::pushSubscriptions ()
+{
+	double now = getNow ();
+	double minPeriod = NAN;
+	std::map <Connection *, Subscription *>::iterator iter;
+
+	for (iter = subscriptions.begin (); iter != subscriptions.end (); iter++)
+	{
+		if (iter->second->isDue (now) && (isnan (minPeriod) || iter->second->getPeriod () < minPeriod))
+			minPeriod = iter->second->getPeriod ();
+	}
+
+	if (!isnan (minPeriod))
+	{
+		// single info call serves all due subscriptions; result of recent info call is reused
+		bool infoOK = true;
+		if (isnan (getLastInfoCall ()) || now - getLastInfoCall () >= minPeriod / 2.0)
+		{
+			try
+			{
+				infoOK = (callInfo () == 0);
+			}
+			catch (rts2core::Error &er)
+			{
+				infoOK = false;
+			}
+		}
+
+		for (iter = subscriptions.begin (); iter != subscriptions.end (); iter++)
+		{
+			Subscription *sub = iter->second;
+			if (!sub->isDue (now))
+				continue;
+			if (infoOK && isRunning (iter->first))
+			{
+				sendSubscription (sub, false);
+				sendInfoTime (iter->first);
+				sub->endPush (now);
+			}
+			else
+			{
+				sub->skipPush (now);
+			}
+		}
+	}
+
+	scheduleSubscriptions ();
+}
+
+void Device::scheduleSubscriptions ()
+{
+	deleteTimers (EVENT_SUBSCRIPTION_PUSH);
+
+	double next = NAN;
+	for (std::map <Connection *, Subscription *>::iterator iter = subscriptions.begin (); iter != subscriptions.end (); iter++)
+	{
+		if (isnan (next) || iter->second->getNextPush () < next)
+			next = iter->second->getNextPush ();
+	}
+	if (isnan (next))
+		return;
+
+	double now = getNow ();
+	addTimer (next > now ? next - now : 0, new Event (EVENT_SUBSCRIPTION_PUSH));
+}
+
 int Device::processOption (int in_opt)
 {
 	switch (in_opt)
@@ -608,6 +787,9 @@ int Device::processOption (int in_opt)
 		case OPT_NOAUTH:
 			doAuth = false;
 			break;
+		case OPT_BINARY_VALUES:
+			setBinaryValues (true);
+			break;
 		case 'd':
 			device_name = optarg;
 			break;
@@ -799,6 +981,38 @@ void Device::sendMessage (messageType_t in_messageType, const char *in_messageSt
 	}
 }
 
+void Device::sendMessages (LogRecord **records, size_t n)
+{
+	// join messages to writes of at most MESSAGES_WRITE bytes
+	std::vector <std::string> writes;
+	std::string w;
+	for (size_t i = 0; i < n; i++)
+	{
+		Daemon::sendMessage (records[i]->type, records[i]->getText ());
+		Message msg = Message (records[i]->time, getDeviceName (), records[i]->type, std::string (records[i]->getText (), records[i]->len));
+		std::string m = msg.toConn ();
+		if (!w.empty () && w.length () + m.length () >= MESSAGES_WRITE)
+		{
+			writes.push_back (w);
+			w.clear ();
+		}
+		if (!w.empty ())
+			w += '\n';
+		w += m;
+	}
+	if (!w.empty ())
+		writes.push_back (w);
+
+	for (connections_t::iterator iter = getCentraldConns ()->begin (); iter != getCentraldConns ()->end (); iter++)
+	{
+		for (std::vector <std::string>::iterator wi = writes.begin (); wi != writes.end (); wi++)
+		{
+			if ((*iter)->sendMsg (*wi))
+				break;
+		}
+	}
+}
+
 int Device::killAll (bool callScriptEnd)
 {
 	// remove all queued changes - do not perform them
@@ -18,6 +18,7 @@
  */
 
 #include "expression.h"
+#include "bytecode.h"
 
 #include <ctype.h>
 
@@ -54,6 +55,22 @@ double ExpressionPair::evaluate ()
 	throw rts2core::Error ("unknow operand");
 }
 
+void ExpressionPair::compile (Bytecode &bc)
+{
+	exp1->compile (bc);
+	if (op == OR || op == AND)
+	{
+		bc.beginShortCircuit (op);
+		exp2->compile (bc);
+		bc.endShortCircuit ();
+	}
+	else
+	{
+		exp2->compile (bc);
+		bc.pushOperator (op);
+	}
+}
+
 Expression *ExpressionPair::add (op_t _op)
 {
 	if (_op < op)
@@ -79,6 +96,16 @@ double ExpressionValue::evaluate ()
 	throw ExpressionErrorValueMissing (deviceName.c_str (), valueName.c_str ());
 }
 
+void ExpressionConst::compile (Bytecode &bc)
+{
+	bc.pushConst (val);
+}
+
+void ExpressionValue::compile (Bytecode &bc)
+{
+	bc.pushValue ((rts2core::Block *) getMasterApp (), deviceName.c_str (), valueName.c_str ());
+}
+
 Expression * parseExpression (const char *str)
 {
 	Expression *new_exp = NULL;
@@ -96,6 +123,8 @@ Expression * parseExpression (const char *str)
 			char val[i - b + 1];
 			memcpy (val, str + b, i - b);
 			val[i - b] = '\0';
+			// loop increment moves to the character after the name
+			i--;
 			// keywords..
 			if (!strcasecmp (val, "or"))
 			{
@@ -121,10 +150,17 @@ Expression * parseExpression (const char *str)
 				new_exp = new ExpressionValue (val, sep);
 			}
 		}
-		else if (isdigit (str[i]))
+		// there is no subtraction, so minus before number is its sign
+		else if (isdigit (str[i]) || (str[i] == '-' && isdigit (str[i + 1])))
 		{
 			double v = 0;
 			long fraction = 0;
+			double sign = 1;
+			if (str[i] == '-')
+			{
+				sign = -1;
+				i++;
+			}
 			for (; str[i] && !isspace (str[i]); i++)
 			{
 				if (str[i] == '.')
@@ -137,7 +173,7 @@ Expression * parseExpression (const char *str)
 				{
 					if (fraction)
 					{
-						v += (str[i] - '0') / fraction;
+						v += (str[i] - '0') / (double) fraction;
 						fraction *= 10;
 					}
 					else
@@ -152,7 +188,8 @@ Expression * parseExpression (const char *str)
 					throw rts2core::Error ("number contains unallowed characters");
 				}
 			}
-			new_exp = new ExpressionConst (v);
+			i--;
+			new_exp = new ExpressionConst (sign * v);
 		}
 		else if (str[i] == '=' || str[i] == '>' || str[i] == '<' || str[i] == '!')
 		{
@@ -163,6 +200,7 @@ Expression * parseExpression (const char *str)
 			char val[i - b + 1];
 			memcpy (val, str + b, i - b);
 			val[i - b] = '\0';
+			i--;
 			if (!strcmp (val, "=="))
 			{
 				op = EQU;
@@ -197,6 +235,11 @@ Expression * parseExpression (const char *str)
 
 		if (op != -1)
 		{
+			if (root_exp == NULL)
+			{
+				delete new_exp;
+				throw rts2core::Error ("left side is missing");
+			}
 			root_exp = root_exp->add ((op_t) op);
 			op = -1;
 		}
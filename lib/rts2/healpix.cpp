@@ -0,0 +1,237 @@
+/*
+ * HEALPix sky tesselation.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "healpix.h"
+
+#include <math.h>
+
+using namespace rts2core;
+
+// face coordinates of the base cells
+static const int jrll[12] = { 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4 };
+static const int jpll[12] = { 1, 3, 5, 7, 0, 2, 4, 6, 1, 3, 5, 7 };
+
+/**
+ * Interleave bits of x with zeros.
+ */
+static long spreadBits (long x)
+{
+	long ret = 0;
+	for (int i = 0; x >> i; i++)
+		ret |= ((x >> i) & 1L) << (2 * i);
+	return ret;
+}
+
+/**
+ * Inverse to spreadBits - takes even bits.
+ */
+static long compressBits (long x)
+{
+	long ret = 0;
+	for (int i = 0; x >> (2 * i); i++)
+		ret |= ((x >> (2 * i)) & 1L) << i;
+	return ret;
+}
+
+HealPix::HealPix (int _nside)
+{
+	nside = _nside;
+}
+
+long HealPix::ang2pix (double ra, double dec)
+{
+	double z = sin (dec * M_PI / 180.0);
+	double za = fabs (z);
+	double tt = fmod (ra, 360.0);
+	if (tt < 0)
+		tt += 360.0;
+	// in [0,4)
+	tt /= 90.0;
+
+	long ix, iy;
+	int face;
+
+	if (za <= 2.0 / 3.0)
+	{
+		// equatorial region
+		double temp1 = nside * (0.5 + tt);
+		double temp2 = nside * z * 0.75;
+		long jp = (long) (temp1 - temp2);
+		long jm = (long) (temp1 + temp2);
+		long ifp = jp / nside;
+		long ifm = jm / nside;
+		if (ifp == ifm)
+			face = (ifp & 3) | 4;
+		else if (ifp < ifm)
+			face = ifp & 3;
+		else
+			face = (ifm & 3) + 8;
+		ix = jm & (nside - 1);
+		iy = nside - (jp & (nside - 1)) - 1;
+	}
+	else
+	{
+		// polar caps
+		int ntt = (int) tt;
+		if (ntt >= 4)
+			ntt = 3;
+		double tp = tt - ntt;
+		double tmp = nside * sqrt (3 * (1 - za));
+		long jp = (long) (tp * tmp);
+		long jm = (long) ((1.0 - tp) * tmp);
+		if (jp >= nside)
+			jp = nside - 1;
+		if (jm >= nside)
+			jm = nside - 1;
+		if (z >= 0)
+		{
+			face = ntt;
+			ix = nside - jm - 1;
+			iy = nside - jp - 1;
+		}
+		else
+		{
+			face = ntt + 8;
+			ix = jp;
+			iy = jm;
+		}
+	}
+	return (long) face * nside * nside + spreadBits (ix) + (spreadBits (iy) << 1);
+}
+
+/**
+ * Centre of the cell at given resolution.
+ */
+static void nestPix2ang (int nside, long pix, double &ra, double &dec)
+{
+	long npface = (long) nside * nside;
+	int face = pix / npface;
+	long ipf = pix % npface;
+	long ix = compressBits (ipf);
+	long iy = compressBits (ipf >> 1);
+
+	double fact2 = 4.0 / (12.0 * npface);
+	double fact1 = 2 * nside * fact2;
+
+	long jr = (long) jrll[face] * nside - ix - iy - 1;
+	long nr;
+	double z;
+	int kshift;
+
+	if (jr < nside)
+	{
+		nr = jr;
+		z = 1 - nr * nr * fact2;
+		kshift = 0;
+	}
+	else if (jr > 3 * nside)
+	{
+		nr = 4 * nside - jr;
+		z = nr * nr * fact2 - 1;
+		kshift = 0;
+	}
+	else
+	{
+		nr = nside;
+		z = (2 * nside - jr) * fact1;
+		kshift = (jr - nside) & 1;
+	}
+
+	long jp = (jpll[face] * nr + ix - iy + 1 + kshift) / 2;
+	if (jp > 4 * nside)
+		jp -= 4 * nside;
+	if (jp < 1)
+		jp += 4 * nside;
+
+	ra = (jp - (kshift + 1) * 0.5) * (90.0 / nr);
+	dec = asin (z) * 180.0 / M_PI;
+}
+
+/**
+ * Upper estimate of maximal distance of a point inside the cell from the cell centre.
+ */
+static double cellRadius (int nside)
+{
+	// distance of cell corners from the centre is close to the side of the square of the same area
+	return 1.1 * sqrt (4 * M_PI / (12.0 * nside * nside)) * 180.0 / M_PI;
+}
+
+void HealPix::pix2ang (long pix, double &ra, double &dec)
+{
+	nestPix2ang (nside, pix, ra, dec);
+}
+
+void HealPix::queryDisc (double ra, double dec, double radius, double margin, std::vector <long> &cells)
+{
+	if (margin < 0)
+		margin = maxCellRadius ();
+
+	cells.clear ();
+
+	double cd = cos (dec * M_PI / 180.0);
+	double x = cd * cos (ra * M_PI / 180.0);
+	double y = cd * sin (ra * M_PI / 180.0);
+	double z = sin (dec * M_PI / 180.0);
+
+	// descend from the base cells, cells are visited in the order of their indices
+	for (long pix = 0; pix < 12; pix++)
+		queryCell (1, pix, x, y, z, radius + margin, cells);
+}
+
+double HealPix::maxCellRadius ()
+{
+	return cellRadius (nside);
+}
+
+void HealPix::queryCell (int ns, long pix, double x, double y, double z, double r, std::vector <long> &cells)
+{
+	double cra, cdec;
+	nestPix2ang (ns, pix, cra, cdec);
+	double cd = cos (cdec * M_PI / 180.0);
+	double dot = cd * cos (cra * M_PI / 180.0) * x + cd * sin (cra * M_PI / 180.0) * y + sin (cdec * M_PI / 180.0) * z;
+	if (dot > 1)
+		dot = 1;
+	else if (dot < -1)
+		dot = -1;
+	double dist = acos (dot) * 180.0 / M_PI;
+
+	if (ns == nside)
+	{
+		if (dist <= r)
+			cells.push_back (pix);
+		return;
+	}
+
+	double cr = cellRadius (ns);
+	// centres of all subcells are farther than r
+	if (dist - cr > r)
+		return;
+
+	// whole cell is inside, add all subcells
+	if (dist + cr <= r)
+	{
+		long sub = (long) (nside / ns) * (nside / ns);
+		for (long i = pix * sub; i < (pix + 1) * sub; i++)
+			cells.push_back (i);
+		return;
+	}
+
+	for (long i = 0; i < 4; i++)
+		queryCell (ns * 2, pix * 4 + i, x, y, z, r, cells);
+}
@@ -0,0 +1,346 @@
+/*
+ * Lock-free queue of log records.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "logqueue.h"
+#include "app.h"
+
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <new>
+#include <string.h>
+#include <unistd.h>
+
+using namespace rts2core;
+
+/**
+ * Sort records by time, records from the same thread keep their order.
+ */
+class recordTimeSort
+{
+	public:
+		bool operator () (const LogRecord *r1, const LogRecord *r2) const
+		{
+			return timercmp (&(r1->time), &(r2->time), <);
+		}
+};
+
+LogQueue::LogQueue (App *_app)
+{
+	drainApp = _app;
+	pthread_key_create (&ringKey, LogQueue::releaseRing);
+	mainThread = pthread_self ();
+	draining = false;
+
+	pthread_mutex_init (&overflowMutex, NULL);
+	pthread_cond_init (&overflowCond, NULL);
+
+	rings = NULL;
+	ringsNum = 0;
+
+	if (pipe (wakePipe) == 0)
+	{
+		fcntl (wakePipe[0], F_SETFL, O_NONBLOCK);
+		fcntl (wakePipe[1], F_SETFL, O_NONBLOCK);
+	}
+	else
+	{
+		wakePipe[0] = wakePipe[1] = -1;
+	}
+	wakePending = 0;
+
+	rateLimit = 0;
+	rateSecond = 0;
+	for (int i = 0; i < LOG_LEVELS; i++)
+	{
+		rateCount[i] = 0;
+		rateDropped[i] = 0;
+	}
+}
+
+LogQueue::~LogQueue ()
+{
+	pthread_key_delete (ringKey);
+	while (rings != NULL)
+	{
+		LogRing *r = rings->next;
+		for (uint32_t t = rings->tail; t != rings->head; t++)
+			delete[] rings->records[t & (LOG_RING_SIZE - 1)].longText;
+		delete rings;
+		rings = r;
+	}
+	for (std::vector <LogRecord *>::iterator iter = overflow.begin (); iter != overflow.end (); iter++)
+	{
+		delete[] (*iter)->longText;
+		delete *iter;
+	}
+	pthread_cond_destroy (&overflowCond);
+	pthread_mutex_destroy (&overflowMutex);
+	if (wakePipe[0] >= 0)
+	{
+		close (wakePipe[0]);
+		close (wakePipe[1]);
+	}
+}
+
+void LogQueue::push (messageType_t type, const char *text)
+{
+	LogRing *ring = getRing ();
+	if (ring == NULL)
+		return;
+
+	bool isMain = pthread_equal (pthread_self (), mainThread);
+
+	uint32_t h = ring->head;
+	// main thread does not return to the main loop, drain its records in place
+	if (h - __atomic_load_n (&(ring->tail), __ATOMIC_ACQUIRE) >= LOG_RING_SIZE && isMain && drainApp != NULL && !draining)
+		drain (drainApp);
+
+	if (h - __atomic_load_n (&(ring->tail), __ATOMIC_ACQUIRE) >= LOG_RING_SIZE)
+	{
+		int l = getLevelIndex (type);
+		if (l >= LOG_LEVEL_INFO)
+		{
+			__atomic_store_n (&(ring->dropped[l]), ring->dropped[l] + 1, __ATOMIC_RELAXED);
+			return;
+		}
+		pushOverflow (type, ring->index, text, isMain);
+	}
+	else
+	{
+		fillRecord (ring->records + (h & (LOG_RING_SIZE - 1)), type, ring->index, text);
+		__atomic_store_n (&(ring->head), h + 1, __ATOMIC_RELEASE);
+	}
+
+	// wake up main loop, but only once until it drains the queue
+	if (wakePipe[1] >= 0 && !isMain && __atomic_exchange_n (&wakePending, 1, __ATOMIC_ACQ_REL) == 0)
+	{
+		int ret;
+		do
+		{
+			ret = write (wakePipe[1], "l", 1);
+		} while (ret == -1 && errno == EINTR);
+	}
+}
+
+void LogQueue::pushOverflow (messageType_t type, uint16_t thread, const char *text, bool isMain)
+{
+	LogRecord *rec = new LogRecord;
+	fillRecord (rec, type, thread, text);
+
+	pthread_mutex_lock (&overflowMutex);
+	// main thread cannot wait, it drains the list
+	if (!isMain && overflow.size () >= LOG_OVERFLOW_SIZE)
+	{
+		struct timespec until;
+		clock_gettime (CLOCK_REALTIME, &until);
+		until.tv_sec += LOG_OVERFLOW_WAIT;
+		while (overflow.size () >= LOG_OVERFLOW_SIZE)
+		{
+			if (pthread_cond_timedwait (&overflowCond, &overflowMutex, &until) == ETIMEDOUT)
+				break;
+		}
+	}
+	overflow.push_back (rec);
+	pthread_mutex_unlock (&overflowMutex);
+}
+
+size_t LogQueue::drain (App *app)
+{
+	if (draining)
+		return 0;
+	draining = true;
+
+	__atomic_store_n (&wakePending, 0, __ATOMIC_RELEASE);
+
+	batch.clear ();
+	LogRing *r;
+	for (r = __atomic_load_n (&rings, __ATOMIC_ACQUIRE); r != NULL; r = r->next)
+	{
+		r->drainHead = __atomic_load_n (&(r->head), __ATOMIC_ACQUIRE);
+		for (uint32_t t = r->tail; t != r->drainHead; t++)
+			batch.push_back (r->records + (t & (LOG_RING_SIZE - 1)));
+	}
+
+	pthread_mutex_lock (&overflowMutex);
+	overflowBatch.swap (overflow);
+	pthread_mutex_unlock (&overflowMutex);
+	batch.insert (batch.end (), overflowBatch.begin (), overflowBatch.end ());
+
+	if (batch.empty ())
+	{
+		draining = false;
+		return 0;
+	}
+
+	if (ringsNum > 1 || !overflowBatch.empty ())
+		std::stable_sort (batch.begin (), batch.end (), recordTimeSort ());
+
+	// rate limit info and debug records
+	if (rateLimit > 0)
+	{
+		std::vector <LogRecord *>::iterator out = batch.begin ();
+		for (std::vector <LogRecord *>::iterator iter = batch.begin (); iter != batch.end (); iter++)
+		{
+			if ((*iter)->time.tv_sec != rateSecond)
+			{
+				rateSecond = (*iter)->time.tv_sec;
+				for (int i = 0; i < LOG_LEVELS; i++)
+					rateCount[i] = 0;
+			}
+			int l = getLevelIndex ((*iter)->type);
+			if (l >= LOG_LEVEL_INFO && rateCount[l] >= rateLimit)
+			{
+				rateDropped[l]++;
+				continue;
+			}
+			rateCount[l]++;
+			*out = *iter;
+			out++;
+		}
+		batch.erase (out, batch.end ());
+	}
+
+	size_t ret = batch.size ();
+	if (ret > 0)
+		app->sendMessages (&(batch[0]), ret);
+
+	// release records only after they were processed
+	for (r = __atomic_load_n (&rings, __ATOMIC_ACQUIRE); r != NULL; r = r->next)
+	{
+		for (uint32_t t = r->tail; t != r->drainHead; t++)
+		{
+			LogRecord *rec = r->records + (t & (LOG_RING_SIZE - 1));
+			delete[] rec->longText;
+			rec->longText = NULL;
+		}
+		__atomic_store_n (&(r->tail), r->drainHead, __ATOMIC_RELEASE);
+	}
+
+	if (!overflowBatch.empty ())
+	{
+		for (std::vector <LogRecord *>::iterator iter = overflowBatch.begin (); iter != overflowBatch.end (); iter++)
+		{
+			delete[] (*iter)->longText;
+			delete *iter;
+		}
+		overflowBatch.clear ();
+		pthread_mutex_lock (&overflowMutex);
+		pthread_cond_broadcast (&overflowCond);
+		pthread_mutex_unlock (&overflowMutex);
+	}
+
+	draining = false;
+	return ret;
+}
+
+unsigned long LogQueue::getDropped (int level)
+{
+	unsigned long ret = rateDropped[level];
+	for (LogRing *r = __atomic_load_n (&rings, __ATOMIC_ACQUIRE); r != NULL; r = r->next)
+		ret += __atomic_load_n (&(r->dropped[level]), __ATOMIC_RELAXED);
+	return ret;
+}
+
+void LogQueue::fillRecord (LogRecord *rec, messageType_t type, uint16_t thread, const char *text)
+{
+	gettimeofday (&(rec->time), NULL);
+	rec->type = type;
+	rec->thread = thread;
+	size_t len = strlen (text);
+	rec->longText = NULL;
+	if (len >= LOG_RECORD_TEXT)
+		rec->longText = new (std::nothrow) char[len + 1];
+	if (rec->longText != NULL)
+	{
+		memcpy (rec->longText, text, len + 1);
+	}
+	else
+	{
+		if (len >= LOG_RECORD_TEXT)
+		{
+			// copy cannot be allocated, mark truncated text
+			len = LOG_RECORD_TEXT - 1;
+			memcpy (rec->text, text, len - 3);
+			memcpy (rec->text + len - 3, "...", 3);
+		}
+		else
+		{
+			memcpy (rec->text, text, len);
+		}
+		rec->text[len] = '\0';
+	}
+	rec->len = len;
+}
+
+void LogQueue::clearWake ()
+{
+	char buf[50];
+	while (read (wakePipe[0], buf, sizeof (buf)) > 0)
+		;
+}
+
+int LogQueue::getLevelIndex (messageType_t type)
+{
+	if (type & (MESSAGE_ERROR | MESSAGE_CRITICAL))
+		return LOG_LEVEL_ERROR;
+	if (type & MESSAGE_WARNING)
+		return LOG_LEVEL_WARNING;
+	if (type & MESSAGE_INFO)
+		return LOG_LEVEL_INFO;
+	return LOG_LEVEL_DEBUG;
+}
+
+LogRing * LogQueue::getRing ()
+{
+	LogRing *ring = (LogRing *) pthread_getspecific (ringKey);
+	if (ring != NULL)
+		return ring;
+
+	// reuse ring of finished thread
+	for (ring = __atomic_load_n (&rings, __ATOMIC_ACQUIRE); ring != NULL; ring = ring->next)
+	{
+		int expected = 0;
+		if (__atomic_compare_exchange_n (&(ring->inUse), &expected, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+		{
+			pthread_setspecific (ringKey, ring);
+			return ring;
+		}
+	}
+
+	ring = new LogRing;
+	ring->head = ring->tail = ring->drainHead = 0;
+	for (int i = 0; i < LOG_LEVELS; i++)
+		ring->dropped[i] = 0;
+	ring->inUse = 1;
+	ring->index = __atomic_fetch_add (&ringsNum, 1, __ATOMIC_RELAXED);
+
+	ring->next = __atomic_load_n (&rings, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange_n (&rings, &(ring->next), ring, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+		;
+
+	pthread_setspecific (ringKey, ring);
+	return ring;
+}
+
+void LogQueue::releaseRing (void *ring)
+{
+	// records still in the ring will be drained, new owner continues at its head
+	__atomic_store_n (&(((LogRing *) ring)->inUse), 0, __ATOMIC_RELEASE);
+}
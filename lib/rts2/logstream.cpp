@@ -58,7 +58,7 @@ void LogStream::logArrAsHex (const char *arr, int len)
 void LogStream::sendLog ()
 {
 	if (masterApp != NULL)
-		masterApp->sendMessage (messageType, ls.str ().c_str ());
+		masterApp->queueMessage (messageType, ls.str ().c_str ());
 	else
 		std::cerr << "log " << ls.str () << std::endl;
 }
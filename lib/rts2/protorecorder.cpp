@@ -0,0 +1,68 @@
+/*
+ * Recording of protocol lines.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "protorecorder.h"
+#include "connection.h"
+#include "utilsfunc.h"
+
+#include <iomanip>
+
+using namespace rts2core;
+
+ProtocolRecorder *ProtocolRecorder::pInstance = NULL;
+
+bool ProtocolRecorder::recording = false;
+
+ProtocolRecorder *ProtocolRecorder::instance ()
+{
+	if (!pInstance)
+		pInstance = new ProtocolRecorder ();
+	return pInstance;
+}
+
+int ProtocolRecorder::open (const char *filename)
+{
+	close ();
+	os.open (filename, std::ios_base::out | std::ios_base::app);
+	if (os.fail ())
+		return -1;
+	os << std::fixed << std::setprecision (6);
+	recording = true;
+	return 0;
+}
+
+void ProtocolRecorder::record (Connection *conn, char dir, const char *line)
+{
+	double now = getNow ();
+	const char *name = conn->getName ();
+	os << now << ' ' << dir << ' ' << (*name ? name : "-") << ' ' << line << '\n';
+	// flush at most once per second, so recording does not slow the daemon
+	if (now > lastFlush + 1)
+	{
+		os.flush ();
+		lastFlush = now;
+	}
+}
+
+void ProtocolRecorder::close ()
+{
+	recording = false;
+	if (os.is_open ())
+		os.close ();
+}
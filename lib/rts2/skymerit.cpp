@@ -0,0 +1,291 @@
+/*
+ * Sky brightness and photometric merit of observation targets.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "skymerit.h"
+
+#include <algorithm>
+#include <math.h>
+#include <string.h>
+#include <libnova/libnova.h>
+
+using namespace rts2core;
+
+// 0.4 * ln (10), converts magnitudes to natural exponent
+#define MAG_EXP     0.921034037
+
+// brightening of twilight sky, magnitudes per degree of Sun altitude above -18
+#define TWILIGHT_SLOPE   0.65
+
+// fraction of Gaussian PSF flux inside aperture of radius equal to FWHM
+#define APERTURE_FRACTION  0.9375
+
+/**
+ * Sort candidate indices by decreasing merit.
+ */
+class meritSort
+{
+	public:
+		meritSort (const std::vector <double> &_merit):merit (_merit) {}
+		bool operator () (int i1, int i2) { return merit[i1] > merit[i2]; }
+	private:
+		const std::vector <double> &merit;
+};
+
+SkyMerit::SkyMerit ()
+{
+	observer.lng = 0;
+	observer.lat = 0;
+	sinLat = 0;
+	cosLat = 1;
+
+	seeing = 2;
+	pixelScale = 1;
+	readNoise = 10;
+	darkCurrent = 0;
+
+	sunAlt = NAN;
+	moonAlt = NAN;
+	moonIllumination = NAN;
+}
+
+void SkyMerit::setObserver (struct ln_lnlat_posn *_observer)
+{
+	observer.lng = _observer->lng;
+	observer.lat = _observer->lat;
+	sinLat = sin (ln_deg_to_rad (observer.lat));
+	cosLat = cos (ln_deg_to_rad (observer.lat));
+}
+
+void SkyMerit::setDetector (double _seeing, double _pixelScale, double _readNoise, double _darkCurrent)
+{
+	seeing = _seeing;
+	pixelScale = _pixelScale;
+	readNoise = _readNoise;
+	darkCurrent = _darkCurrent;
+}
+
+int SkyMerit::addFilter (const char *name, double zeroPoint, double extinction, double darkSky)
+{
+	meritFilter f;
+	f.name = std::string (name);
+	f.zeroPoint = zeroPoint;
+	f.extinction = extinction;
+	f.darkSky = darkSky;
+	filters.push_back (f);
+	return filters.size () - 1;
+}
+
+int SkyMerit::findFilter (const char *name)
+{
+	for (size_t i = 0; i < filters.size (); i++)
+	{
+		if (filters[i].name == name)
+			return i;
+	}
+	return -1;
+}
+
+void SkyMerit::clearCandidates ()
+{
+	ra.clear ();
+	dec.clear ();
+	sinRa.clear ();
+	cosRa.clear ();
+	sinDec.clear ();
+	cosDec.clear ();
+	mag.clear ();
+	filter.clear ();
+	exposure.clear ();
+	overhead.clear ();
+	weight.clear ();
+}
+
+int SkyMerit::addCandidate (double _ra, double _dec, double _mag, int _filter, double _exposure, double _overhead, double _weight)
+{
+	ra.push_back (_ra);
+	dec.push_back (_dec);
+	sinRa.push_back (0);
+	cosRa.push_back (0);
+	sinDec.push_back (0);
+	cosDec.push_back (0);
+	// star flux is zeroPoint * mag, mag holds 10^(-0.4 m)
+	mag.push_back (exp (-MAG_EXP * _mag));
+	filter.push_back (_filter);
+	exposure.push_back (_exposure);
+	overhead.push_back (_overhead);
+	weight.push_back (_weight);
+
+	int i = ra.size () - 1;
+	setCandidatePosition (i, _ra, _dec);
+	return i;
+}
+
+void SkyMerit::setCandidatePosition (int i, double _ra, double _dec)
+{
+	ra[i] = _ra;
+	dec[i] = _dec;
+	sinRa[i] = sin (ln_deg_to_rad (_ra));
+	cosRa[i] = cos (ln_deg_to_rad (_ra));
+	sinDec[i] = sin (ln_deg_to_rad (_dec));
+	cosDec[i] = cos (ln_deg_to_rad (_dec));
+}
+
+void SkyMerit::compute (double JD)
+{
+	size_t n = ra.size ();
+
+	sinAltitude.resize (n);
+	airmass.resize (n);
+	cosMoonDistance.resize (n);
+	skyBrightness.resize (n);
+	snr.resize (n);
+	merit.resize (n);
+
+	// shared ephemerides
+	double lst = ln_deg_to_rad (ln_get_apparent_sidereal_time (JD) * 15.0 + observer.lng);
+	double sinLst = sin (lst);
+	double cosLst = cos (lst);
+
+	struct ln_equ_posn sun, moon;
+	struct ln_hrz_posn hrz;
+
+	ln_get_solar_equ_coords (JD, &sun);
+	ln_get_hrz_from_equ (&sun, &observer, JD, &hrz);
+	sunAlt = hrz.alt;
+
+	ln_get_lunar_equ_coords (JD, &moon);
+	ln_get_hrz_from_equ (&moon, &observer, JD, &hrz);
+	moonAlt = hrz.alt;
+	moonIllumination = ln_get_lunar_disk (JD);
+
+	double sinMoonDec = sin (ln_deg_to_rad (moon.dec));
+	double cosMoonDec = cos (ln_deg_to_rad (moon.dec));
+	double sinMoonRa = sin (ln_deg_to_rad (moon.ra));
+	double cosMoonRa = cos (ln_deg_to_rad (moon.ra));
+
+	// Moon illuminance and its airmass (Krisciunas & Schaefer, eq. 8 and 3)
+	double moonI = 0;
+	double moonX = NAN;
+	if (moonAlt > 0)
+	{
+		double alpha = ln_get_lunar_phase (JD);
+		moonI = exp (-MAG_EXP * (3.84 + 0.026 * fabs (alpha) + 4e-9 * pow (alpha, 4)));
+		double sz = cos (ln_deg_to_rad (moonAlt));
+		moonX = 1 / sqrt (1 - 0.96 * sz * sz);
+	}
+
+	// per filter terms - zenith dark sky and twilight in nanoLamberts, Moon term
+	size_t nf = filters.size ();
+	std::vector <double> darkNL (nf);
+	std::vector <double> twilightNL (nf);
+	std::vector <double> moonNL (nf);
+	std::vector <double> skyFlux (nf);
+	for (size_t f = 0; f < nf; f++)
+	{
+		darkNL[f] = 34.08 * exp (20.7233 - 0.92104 * filters[f].darkSky);
+		if (sunAlt > -18)
+			twilightNL[f] = darkNL[f] * (exp (MAG_EXP * TWILIGHT_SLOPE * (std::min (sunAlt, 0.0) + 18)) - 1);
+		else
+			twilightNL[f] = 0;
+		moonNL[f] = moonAlt > 0 ? moonI * exp (-MAG_EXP * filters[f].extinction * moonX) : 0;
+		// converts nanoLamberts to electrons per pixel per second
+		skyFlux[f] = filters[f].zeroPoint * pixelScale * pixelScale * exp (-20.7233) / 34.08;
+	}
+
+	double npixScale = M_PI * seeing * seeing / (pixelScale * pixelScale);
+	double pixelNoise = readNoise * readNoise;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		double cosH = cosLst * cosRa[i] + sinLst * sinRa[i];
+		double sinAlt = sinLat * sinDec[i] + cosLat * cosDec[i] * cosH;
+		sinAltitude[i] = sinAlt;
+
+		double cosRho = sinDec[i] * sinMoonDec + cosDec[i] * cosMoonDec * (cosRa[i] * cosMoonRa + sinRa[i] * sinMoonRa);
+		cosMoonDistance[i] = cosRho;
+
+		int f = filter[i];
+		if (sinAlt <= 0 || f < 0 || f >= (int) nf)
+		{
+			airmass[i] = NAN;
+			skyBrightness[i] = NAN;
+			snr[i] = 0;
+			merit[i] = 0;
+			continue;
+		}
+
+		// airmass of Krisciunas & Schaefer, eq. 3
+		double X = 1 / sqrt (1 - 0.96 * (1 - sinAlt * sinAlt));
+		airmass[i] = X;
+
+		double k = filters[f].extinction;
+		// 10^(-0.4 k X)
+		double ext = exp (-MAG_EXP * k * X);
+
+		double B = darkNL[f] * X * ext * exp (MAG_EXP * k) + twilightNL[f];
+		if (moonNL[f] > 0)
+		{
+			double rho = ln_rad_to_deg (acos (std::max (-1.0, std::min (1.0, cosRho))));
+			if (rho < 10)
+				rho = 10;
+			// scattering function, eq. 21
+			double fRho = 229086.77 * (1.06 + cosRho * cosRho) + exp (2.302585093 * (6.15 - rho / 40.0));
+			B += fRho * moonNL[f] * (1 - ext);
+		}
+		skyBrightness[i] = B;
+
+		double t = exposure[i];
+		double S = APERTURE_FRACTION * filters[f].zeroPoint * mag[i] * ext * t;
+		// seeing grows with airmass^0.6
+		double npix = npixScale * exp (0.6 * log (X));
+		double N = sqrt (S + npix * ((B * skyFlux[f] + darkCurrent) * t + pixelNoise));
+		snr[i] = N > 0 ? S / N : 0;
+
+		double tt = t + overhead[i];
+		merit[i] = tt > 0 ? weight[i] * 0.5 * log2 (1 + snr[i] * snr[i]) / tt : 0;
+	}
+}
+
+void SkyMerit::rank (double JD, std::vector <int> &order)
+{
+	compute (JD);
+	order.clear ();
+	for (size_t i = 0; i < merit.size (); i++)
+	{
+		if (sinAltitude[i] > 0)
+			order.push_back (i);
+	}
+	std::sort (order.begin (), order.end (), meritSort (merit));
+}
+
+double SkyMerit::getAltitude (int i)
+{
+	return ln_rad_to_deg (asin (sinAltitude[i]));
+}
+
+double SkyMerit::getMoonDistance (int i)
+{
+	return ln_rad_to_deg (acos (std::max (-1.0, std::min (1.0, cosMoonDistance[i]))));
+}
+
+double SkyMerit::getSkyBrightness (int i)
+{
+	// Krisciunas & Schaefer, eq. 1
+	return (20.7233 - log (skyBrightness[i] / 34.08)) / 0.92104;
+}
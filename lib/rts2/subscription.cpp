@@ -0,0 +1,96 @@
+/*
+ * Value subscriptions.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "subscription.h"
+#include "block.h"
+#include "utilsfunc.h"
+
+#include <math.h>
+
+using namespace rts2core;
+
+Subscription::Subscription (Connection *_conn, double _period, double _deadband):subscribed (), lastSent ()
+{
+	conn = _conn;
+	period = _period;
+	deadband = _deadband;
+	nextPush = getNow () + period;
+}
+
+bool Subscription::isSubscribed (Value *val)
+{
+	if (subscribed.empty ())
+		return true;
+	for (std::vector <Value *>::iterator iter = subscribed.begin (); iter != subscribed.end (); iter++)
+	{
+		if (*iter == val)
+			return true;
+	}
+	return false;
+}
+
+bool Subscription::pushValue (Value *val, bool force)
+{
+	std::string str (val->getValue ());
+	double dbl = val->getValueDouble ();
+
+	std::map <Value *, sentValue>::iterator iter = lastSent.find (val);
+	if (iter != lastSent.end () && !force)
+	{
+		switch (val->getValueBaseType ())
+		{
+			case RTS2_VALUE_INTEGER:
+			case RTS2_VALUE_DOUBLE:
+			case RTS2_VALUE_FLOAT:
+			case RTS2_VALUE_LONGINT:
+				// NaN changes are always reported
+				if (deadband > 0 && !isnan (dbl) && !isnan (iter->second.dbl))
+				{
+					if (fabs (dbl - iter->second.dbl) <= deadband)
+						return false;
+					break;
+				}
+				// without deadband, compare value strings
+			default:
+				if (str == iter->second.str)
+					return false;
+		}
+	}
+
+	val->send (conn);
+
+	sentValue &sv = lastSent[val];
+	sv.str = str;
+	sv.dbl = dbl;
+	return true;
+}
+
+void Subscription::endPush (double now)
+{
+	conn->sendMsg (PROTO_PUSHED);
+	skipPush (now);
+}
+
+void Subscription::skipPush (double now)
+{
+	nextPush += period;
+	// do not try to catch up with pushes missed when device was busy
+	if (nextPush < now)
+		nextPush = now + period;
+}
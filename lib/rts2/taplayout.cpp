@@ -0,0 +1,433 @@
+/*
+ * Readout layout of multi-tap cameras.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "taplayout.h"
+
+#include <algorithm>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sstream>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace rts2camd;
+
+/**
+ * Copy every step-th pixel of raw row to tap rows.
+ */
+template <typename T> static void gatherRow (const T *src, int taps, long w, T **dst)
+{
+	for (int t = 0; t < taps; t++)
+	{
+		T *d = dst[t];
+		if (d == NULL)
+			continue;
+		const T *s = src + t;
+		for (long i = 0; i < w; i++, s += taps)
+			d[i] = *s;
+	}
+}
+
+#ifdef __SSE2__
+static inline void transpose8 (__m128i *v)
+{
+	__m128i a0 = _mm_unpacklo_epi16 (v[0], v[1]);
+	__m128i a1 = _mm_unpackhi_epi16 (v[0], v[1]);
+	__m128i a2 = _mm_unpacklo_epi16 (v[2], v[3]);
+	__m128i a3 = _mm_unpackhi_epi16 (v[2], v[3]);
+	__m128i a4 = _mm_unpacklo_epi16 (v[4], v[5]);
+	__m128i a5 = _mm_unpackhi_epi16 (v[4], v[5]);
+	__m128i a6 = _mm_unpacklo_epi16 (v[6], v[7]);
+	__m128i a7 = _mm_unpackhi_epi16 (v[6], v[7]);
+
+	__m128i b0 = _mm_unpacklo_epi32 (a0, a2);
+	__m128i b1 = _mm_unpackhi_epi32 (a0, a2);
+	__m128i b2 = _mm_unpacklo_epi32 (a1, a3);
+	__m128i b3 = _mm_unpackhi_epi32 (a1, a3);
+	__m128i b4 = _mm_unpacklo_epi32 (a4, a6);
+	__m128i b5 = _mm_unpackhi_epi32 (a4, a6);
+	__m128i b6 = _mm_unpacklo_epi32 (a5, a7);
+	__m128i b7 = _mm_unpackhi_epi32 (a5, a7);
+
+	v[0] = _mm_unpacklo_epi64 (b0, b4);
+	v[1] = _mm_unpackhi_epi64 (b0, b4);
+	v[2] = _mm_unpacklo_epi64 (b1, b5);
+	v[3] = _mm_unpackhi_epi64 (b1, b5);
+	v[4] = _mm_unpacklo_epi64 (b2, b6);
+	v[5] = _mm_unpackhi_epi64 (b2, b6);
+	v[6] = _mm_unpacklo_epi64 (b3, b7);
+	v[7] = _mm_unpackhi_epi64 (b3, b7);
+}
+
+/**
+ * Deinterleave 16 bit pixels of 2, 4 or multiple of 8 taps, 8 pixels of each
+ * tap at once. Returns number of processed pixels, the rest must be
+ * processed by gatherRow.
+ */
+static long gatherRow16 (const uint16_t *src, int taps, long w, uint16_t **dst)
+{
+	long i = 0;
+	if (taps == 2)
+	{
+		for (; i + 8 <= w; i += 8, src += 16)
+		{
+			__m128i v0 = _mm_loadu_si128 ((const __m128i *) src);
+			__m128i v1 = _mm_loadu_si128 ((const __m128i *) (src + 8));
+			__m128i l = _mm_unpacklo_epi16 (v0, v1);
+			__m128i h = _mm_unpackhi_epi16 (v0, v1);
+			__m128i l2 = _mm_unpacklo_epi16 (l, h);
+			__m128i h2 = _mm_unpackhi_epi16 (l, h);
+			_mm_storeu_si128 ((__m128i *) (dst[0] + i), _mm_unpacklo_epi16 (l2, h2));
+			_mm_storeu_si128 ((__m128i *) (dst[1] + i), _mm_unpackhi_epi16 (l2, h2));
+		}
+	}
+	else if (taps == 4)
+	{
+		for (; i + 8 <= w; i += 8, src += 32)
+		{
+			__m128i v0 = _mm_loadu_si128 ((const __m128i *) src);
+			__m128i v1 = _mm_loadu_si128 ((const __m128i *) (src + 8));
+			__m128i v2 = _mm_loadu_si128 ((const __m128i *) (src + 16));
+			__m128i v3 = _mm_loadu_si128 ((const __m128i *) (src + 24));
+			__m128i l = _mm_unpacklo_epi16 (v0, v1);
+			__m128i h = _mm_unpackhi_epi16 (v0, v1);
+			__m128i lo = _mm_unpacklo_epi16 (l, h);
+			__m128i hi = _mm_unpackhi_epi16 (l, h);
+			l = _mm_unpacklo_epi16 (v2, v3);
+			h = _mm_unpackhi_epi16 (v2, v3);
+			__m128i lo2 = _mm_unpacklo_epi16 (l, h);
+			__m128i hi2 = _mm_unpackhi_epi16 (l, h);
+			_mm_storeu_si128 ((__m128i *) (dst[0] + i), _mm_unpacklo_epi64 (lo, lo2));
+			_mm_storeu_si128 ((__m128i *) (dst[1] + i), _mm_unpackhi_epi64 (lo, lo2));
+			_mm_storeu_si128 ((__m128i *) (dst[2] + i), _mm_unpacklo_epi64 (hi, hi2));
+			_mm_storeu_si128 ((__m128i *) (dst[3] + i), _mm_unpackhi_epi64 (hi, hi2));
+		}
+	}
+	else if (taps % 8 == 0)
+	{
+		__m128i v[8];
+		for (; i + 8 <= w; i += 8, src += 8 * taps)
+		{
+			for (int g = 0; g < taps; g += 8)
+			{
+				for (int k = 0; k < 8; k++)
+					v[k] = _mm_loadu_si128 ((const __m128i *) (src + k * taps + g));
+				transpose8 (v);
+				for (int t = 0; t < 8; t++)
+					_mm_storeu_si128 ((__m128i *) (dst[g + t] + i), v[t]);
+			}
+		}
+	}
+	return i;
+}
+#endif
+
+static void swapRow (unsigned char *d, long w, int pixelBytes)
+{
+	switch (pixelBytes)
+	{
+		case 2:
+			for (uint16_t *p = (uint16_t *) d; p < ((uint16_t *) d) + w; p++)
+				*p = (*p >> 8) | (*p << 8);
+			break;
+		case 4:
+			for (uint32_t *p = (uint32_t *) d; p < ((uint32_t *) d) + w; p++)
+				*p = (*p >> 24) | ((*p >> 8) & 0xff00) | ((*p << 8) & 0xff0000) | (*p << 24);
+			break;
+		case 8:
+			for (unsigned char *p = d; p < d + w * 8; p += 8)
+				std::reverse (p, p + 8);
+			break;
+	}
+}
+
+static void flipRow (unsigned char *d, long w, int pixelBytes)
+{
+	switch (pixelBytes)
+	{
+		case 1:
+			std::reverse (d, d + w);
+			break;
+		case 2:
+			std::reverse ((uint16_t *) d, ((uint16_t *) d) + w);
+			break;
+		case 4:
+			std::reverse ((uint32_t *) d, ((uint32_t *) d) + w);
+			break;
+		case 8:
+			std::reverse ((uint64_t *) d, ((uint64_t *) d) + w);
+			break;
+	}
+}
+
+static int parseList (const std::string &val, int taps, std::vector <int> &l)
+{
+	std::istringstream is (val);
+	std::string v;
+	while (std::getline (is, v, ','))
+	{
+		char *end;
+		long t = strtol (v.c_str (), &end, 10);
+		if (*end || v.empty () || t < 0 || t >= taps)
+			return -1;
+		l.push_back (t);
+	}
+	return 0;
+}
+
+TapLayout::TapLayout ()
+{
+	interleave = TAP_PIXEL;
+	pixelBytes = 2;
+	prescan = 0;
+	overscan = 0;
+	byteSwap = false;
+	setTaps (1);
+}
+
+void TapLayout::setTaps (int _taps)
+{
+	taps = _taps;
+	flipX.assign (taps, false);
+	flipY.assign (taps, false);
+	order.resize (taps);
+	for (int i = 0; i < taps; i++)
+		order[i] = i;
+}
+
+void TapLayout::setFlip (int tap, bool _flipX, bool _flipY)
+{
+	flipX[tap] = _flipX;
+	flipY[tap] = _flipY;
+}
+
+int TapLayout::parse (const char *spec)
+{
+	std::istringstream is (spec);
+	std::string tok;
+	// taps must be known before flips and order are parsed
+	std::vector <std::string> rest;
+	while (is >> tok)
+	{
+		size_t eq = tok.find ('=');
+		std::string key = tok.substr (0, eq);
+		std::string val = eq == std::string::npos ? "" : tok.substr (eq + 1);
+		if (key == "taps")
+		{
+			int t = atoi (val.c_str ());
+			if (t < 1)
+				return -1;
+			setTaps (t);
+		}
+		else if (key == "interleave")
+		{
+			if (val == "pixel")
+				interleave = TAP_PIXEL;
+			else if (val == "line")
+				interleave = TAP_LINE;
+			else if (val == "block")
+				interleave = TAP_BLOCK;
+			else
+				return -1;
+		}
+		else if (key == "bytes")
+		{
+			pixelBytes = atoi (val.c_str ());
+			if (pixelBytes != 1 && pixelBytes != 2 && pixelBytes != 4 && pixelBytes != 8)
+				return -1;
+		}
+		else if (key == "prescan")
+		{
+			prescan = atoi (val.c_str ());
+		}
+		else if (key == "overscan")
+		{
+			overscan = atoi (val.c_str ());
+		}
+		else if (key == "swap")
+		{
+			byteSwap = true;
+		}
+		else if (key == "flipx" || key == "flipy" || key == "order")
+		{
+			rest.push_back (tok);
+		}
+		else
+		{
+			return -1;
+		}
+	}
+
+	for (std::vector <std::string>::iterator iter = rest.begin (); iter != rest.end (); iter++)
+	{
+		size_t eq = iter->find ('=');
+		if (eq == std::string::npos)
+			return -1;
+		std::string key = iter->substr (0, eq);
+		std::vector <int> l;
+		if (parseList (iter->substr (eq + 1), taps, l))
+			return -1;
+		if (key == "order")
+		{
+			if ((int) l.size () != taps)
+				return -1;
+			// every raw tap must be used exactly once
+			std::vector <bool> used (taps, false);
+			for (std::vector <int>::iterator li = l.begin (); li != l.end (); li++)
+			{
+				if (used[*li])
+					return -1;
+				used[*li] = true;
+			}
+			order = l;
+		}
+		else
+		{
+			for (std::vector <int>::iterator li = l.begin (); li != l.end (); li++)
+			{
+				if (key == "flipx")
+					flipX[*li] = true;
+				else
+					flipY[*li] = true;
+			}
+		}
+	}
+	return 0;
+}
+
+long TapLayout::extract (const void *raw, size_t rawSize, long rawWidth, long height, int chan, void *dst)
+{
+	if (chan < 0 || chan >= taps)
+		return -1;
+	std::vector <void *> dsts (taps, (void *) NULL);
+	dsts[chan] = dst;
+	return extractAll (raw, rawSize, rawWidth, height, &(dsts[0]));
+}
+
+long TapLayout::extractAll (const void *raw, size_t rawSize, long rawWidth, long height, void **dst)
+{
+	long w = getDataWidth (rawWidth);
+	if (taps < 1 || w <= 0 || prescan < 0 || overscan < 0)
+		return -1;
+	if (pixelBytes != 1 && pixelBytes != 2 && pixelBytes != 4 && pixelBytes != 8)
+		return -1;
+
+	const unsigned char *rb = (const unsigned char *) raw;
+	size_t rowBytes = rawWidth * pixelBytes;
+	size_t dstRowBytes = w * pixelBytes;
+
+	// raw tap to destination
+	std::vector <unsigned char *> td (taps, (unsigned char *) NULL);
+	for (int c = 0; c < taps; c++)
+		td[order[c]] = (unsigned char *) dst[c];
+	bool all = true;
+	for (int t = 0; t < taps; t++)
+	{
+		if (td[t] == NULL)
+			all = false;
+	}
+
+	// number of rows fully inside the raw buffer
+	long rows = height;
+	switch (interleave)
+	{
+		case TAP_PIXEL:
+		case TAP_LINE:
+			rows = std::min (height, (long) (rawSize / (rowBytes * taps)));
+			break;
+		case TAP_BLOCK:
+			rows = std::min (height, (long) (rawSize / rowBytes) - (taps - 1) * height);
+			if (rows < 0)
+				rows = 0;
+			break;
+	}
+
+	std::vector <unsigned char *> rd (taps);
+	for (long r = 0; r < rows; r++)
+	{
+		for (int t = 0; t < taps; t++)
+			rd[t] = td[t] ? td[t] + (flipY[t] ? height - 1 - r : r) * dstRowBytes : NULL;
+
+		switch (interleave)
+		{
+			case TAP_PIXEL:
+			{
+				const unsigned char *s = rb + r * rowBytes * taps + prescan * taps * pixelBytes;
+				long done = 0;
+#ifdef __SSE2__
+				if (pixelBytes == 2 && all)
+					done = gatherRow16 ((const uint16_t *) s, taps, w, (uint16_t **) &(rd[0]));
+#endif
+				if (done < w)
+				{
+					std::vector <unsigned char *> rest (taps);
+					for (int t = 0; t < taps; t++)
+						rest[t] = rd[t] ? rd[t] + done * pixelBytes : NULL;
+					s += done * taps * pixelBytes;
+					switch (pixelBytes)
+					{
+						case 1:
+							gatherRow <uint8_t> (s, taps, w - done, &(rest[0]));
+							break;
+						case 2:
+							gatherRow <uint16_t> ((const uint16_t *) s, taps, w - done, (uint16_t **) &(rest[0]));
+							break;
+						case 4:
+							gatherRow <uint32_t> ((const uint32_t *) s, taps, w - done, (uint32_t **) &(rest[0]));
+							break;
+						case 8:
+							gatherRow <uint64_t> ((const uint64_t *) s, taps, w - done, (uint64_t **) &(rest[0]));
+							break;
+					}
+				}
+				break;
+			}
+			case TAP_LINE:
+				for (int t = 0; t < taps; t++)
+				{
+					if (rd[t])
+						memcpy (rd[t], rb + (r * taps + t) * rowBytes + prescan * pixelBytes, dstRowBytes);
+				}
+				break;
+			case TAP_BLOCK:
+				for (int t = 0; t < taps; t++)
+				{
+					if (rd[t])
+						memcpy (rd[t], rb + (t * height + r) * rowBytes + prescan * pixelBytes, dstRowBytes);
+				}
+				break;
+		}
+
+		// row is in cache, so swap and flip it now
+		for (int t = 0; t < taps; t++)
+		{
+			if (rd[t] == NULL)
+				continue;
+			if (byteSwap)
+				swapRow (rd[t], w, pixelBytes);
+			if (flipX[t])
+				flipRow (rd[t], w, pixelBytes);
+		}
+	}
+	return rows;
+}
@@ -22,6 +22,7 @@
 #include <sstream>
 
 #include "libnova_cpp.h"
+#include "binaryvalue.h"
 #include "block.h"
 #include "configuration.h"
 #include "value.h"
@@ -85,6 +86,8 @@ int Value::sendMetaInfo (Connection * connection)
 
 void Value::send (Connection * connection)
 {
+	if (connection->getBinaryValues () && connection->sendBinaryValue (this) == 0)
+		return;
 	connection->sendValueRaw (getName (), getValue ());
 }
 
@@ -187,6 +190,30 @@ int ValueInteger::setValue (Connection * connection)
 	return 0;
 }
 
+bool ValueInteger::encodeBinary (std::string &buf)
+{
+	switch (getValueType ())
+	{
+		case RTS2_VALUE_INTEGER:
+		case RTS2_VALUE_BOOL:
+		case RTS2_VALUE_SELECTION:
+			binaryAppendUInt32 (buf, (uint32_t) value);
+			return true;
+	}
+	return false;
+}
+
+int ValueInteger::decodeBinary (const char *data, size_t size)
+{
+	if (size != 4)
+		return -2;
+	int new_value = (int32_t) binaryGetUInt32 (data);
+	if (value != new_value)
+		changed ();
+	value = new_value;
+	return 0;
+}
+
 int ValueInteger::setValueCharArr (const char *in_value)
 {
 	return setValueInteger (atoi (in_value));
@@ -258,6 +285,29 @@ int ValueDouble::setValue (Connection * connection)
 	return 0;
 }
 
+bool ValueDouble::encodeBinary (std::string &buf)
+{
+	switch (getValueType ())
+	{
+		case RTS2_VALUE_DOUBLE:
+		case RTS2_VALUE_TIME:
+			binaryAppendDouble (buf, value);
+			return true;
+	}
+	return false;
+}
+
+int ValueDouble::decodeBinary (const char *data, size_t size)
+{
+	if (size != 8)
+		return -2;
+	double new_value = binaryGetDouble (data);
+	if (value != new_value)
+		changed ();
+	value = new_value;
+	return 0;
+}
+
 int ValueDouble::setValueCharArr (const char *in_value)
 {
 	setValueDouble (atof (in_value));
@@ -645,6 +695,25 @@ int ValueLong::setValue (Connection * connection)
 	return 0;
 }
 
+bool ValueLong::encodeBinary (std::string &buf)
+{
+	if (getValueType () != RTS2_VALUE_LONGINT)
+		return false;
+	binaryAppendUInt64 (buf, (uint64_t) value);
+	return true;
+}
+
+int ValueLong::decodeBinary (const char *data, size_t size)
+{
+	if (size != 8)
+		return -2;
+	long int new_value = (int64_t) binaryGetUInt64 (data);
+	if (value != new_value)
+		changed ();
+	value = new_value;
+	return 0;
+}
+
 int ValueLong::setValueCharArr (const char *in_value)
 {
 	return setValueLong (atol (in_value));
@@ -17,6 +17,7 @@
  * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
  */
 
+#include "binaryvalue.h"
 #include "connection.h"
 #include "valuearray.h"
 
@@ -142,6 +143,27 @@ int DoubleArray::setValue (Connection * connection)
 	return 0;
 }
 
+bool DoubleArray::encodeBinary (std::string &buf)
+{
+	if (getValueType () != (RTS2_VALUE_ARRAY | RTS2_VALUE_DOUBLE) && getValueType () != (RTS2_VALUE_ARRAY | RTS2_VALUE_TIME))
+		return false;
+	buf.reserve (buf.size () + value.size () * 8);
+	for (std::vector <double>::iterator iter = value.begin (); iter != value.end (); iter++)
+		binaryAppendDouble (buf, *iter);
+	return true;
+}
+
+int DoubleArray::decodeBinary (const char *data, size_t size)
+{
+	if (size % 8)
+		return -2;
+	value.resize (size / 8);
+	for (size_t i = 0; i < value.size (); i++, data += 8)
+		value[i] = binaryGetDouble (data);
+	changed ();
+	return 0;
+}
+
 int DoubleArray::setValues (std::vector <int> &index, Connection *conn)
 {
 	double val;
@@ -348,6 +370,27 @@ int IntegerArray::setValue (Connection * connection)
 	return 0;
 }
 
+bool IntegerArray::encodeBinary (std::string &buf)
+{
+	if (getValueType () != (RTS2_VALUE_ARRAY | RTS2_VALUE_INTEGER))
+		return false;
+	buf.reserve (buf.size () + value.size () * 4);
+	for (std::vector <int>::iterator iter = value.begin (); iter != value.end (); iter++)
+		binaryAppendUInt32 (buf, (uint32_t) *iter);
+	return true;
+}
+
+int IntegerArray::decodeBinary (const char *data, size_t size)
+{
+	if (size % 4)
+		return -2;
+	value.resize (size / 4);
+	for (size_t i = 0; i < value.size (); i++, data += 4)
+		value[i] = (int32_t) binaryGetUInt32 (data);
+	changed ();
+	return 0;
+}
+
 int IntegerArray::setValues (std::vector <int> &index, Connection *conn)
 {
 	int val;
@@ -20,6 +20,7 @@
 #include <algorithm>
 
 #include "valuestat.h"
+#include "binaryvalue.h"
 #include "connection.h"
 
 using namespace rts2core;
@@ -235,6 +236,46 @@ void ValueDoubleTimeserie::send (Connection * connection)
 	ValueDouble::send (connection);
 }
 
+bool ValueDoubleTimeserie::encodeBinary (std::string &buf)
+{
+	if (getValueType () != (RTS2_VALUE_TIMESERIE | RTS2_VALUE_DOUBLE))
+		return false;
+	binaryAppendDouble (buf, value);
+	binaryAppendUInt32 (buf, (uint32_t) numMes);
+	binaryAppendDouble (buf, mode);
+	binaryAppendDouble (buf, min);
+	binaryAppendDouble (buf, max);
+	binaryAppendDouble (buf, stdev);
+	binaryAppendDouble (buf, alpha);
+	binaryAppendDouble (buf, beta);
+	return true;
+}
+
+int ValueDoubleTimeserie::decodeBinary (const char *data, size_t size)
+{
+	if (size != 7 * 8 + 4)
+		return -2;
+	double new_value = binaryGetDouble (data);
+	int new_numMes = (int32_t) binaryGetUInt32 (data + 8);
+	double new_mode = binaryGetDouble (data + 12);
+	double new_min = binaryGetDouble (data + 20);
+	double new_max = binaryGetDouble (data + 28);
+	double new_stdev = binaryGetDouble (data + 36);
+	double new_alpha = binaryGetDouble (data + 44);
+	double new_beta = binaryGetDouble (data + 52);
+	if (value != new_value || numMes != new_numMes || mode != new_mode || min != new_min || max != new_max || stdev != new_stdev || alpha != new_alpha || beta != new_beta)
+		changed ();
+	value = new_value;
+	numMes = new_numMes;
+	mode = new_mode;
+	min = new_min;
+	max = new_max;
+	stdev = new_stdev;
+	alpha = new_alpha;
+	beta = new_beta;
+	return 0;
+}
+
 void ValueDoubleTimeserie::setFromValue (Value * newValue)
 {
 	ValueDouble::setFromValue (newValue);
@@ -0,0 +1,340 @@
+/*
+ * Parallel, resumable processing of large number of image files.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2fits/bulkprocessor.h"
+#include "rts2fits/parallel.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+using namespace rts2image;
+
+static double bulkNow ()
+{
+	struct timeval tv;
+	gettimeofday (&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+BulkProcessor::IOSlot::IOSlot (BulkProcessor *_bp)
+{
+	bp = _bp;
+	pthread_mutex_lock (&bp->ioMutex);
+	while (bp->ioFree <= 0)
+		pthread_cond_wait (&bp->ioCond, &bp->ioMutex);
+	bp->ioFree--;
+	pthread_mutex_unlock (&bp->ioMutex);
+}
+
+BulkProcessor::IOSlot::~IOSlot ()
+{
+	pthread_mutex_lock (&bp->ioMutex);
+	bp->ioFree++;
+	pthread_cond_signal (&bp->ioCond);
+	pthread_mutex_unlock (&bp->ioMutex);
+}
+
+BulkProcessor::BulkProcessor ()
+{
+	threads = 0;
+	ioSlots = 0;
+	batchSize = 100;
+	reportInterval = 10;
+
+	checkpointFile = NULL;
+
+	pthread_mutex_init (&ioMutex, NULL);
+	pthread_cond_init (&ioCond, NULL);
+	ioFree = 0;
+
+	pthread_mutex_init (&doneMutex, NULL);
+	pthread_cond_init (&doneCond, NULL);
+	runningWorkers = 0;
+}
+
+BulkProcessor::~BulkProcessor ()
+{
+	for (std::vector <BulkItem *>::iterator iter = items.begin (); iter != items.end (); iter++)
+		delete *iter;
+	if (checkpointFile != NULL)
+		fclose (checkpointFile);
+	pthread_mutex_destroy (&ioMutex);
+	pthread_cond_destroy (&ioCond);
+	pthread_mutex_destroy (&doneMutex);
+	pthread_cond_destroy (&doneCond);
+}
+
+int BulkProcessor::setCheckpoint (const char *filename)
+{
+	std::ifstream ifs (filename);
+	std::string line;
+	while (std::getline (ifs, line))
+	{
+		if (!line.empty ())
+			checkpointed.insert (line);
+	}
+
+	if (checkpointFile != NULL)
+		fclose (checkpointFile);
+	checkpointFile = fopen (filename, "a");
+	if (checkpointFile == NULL)
+	{
+		std::cerr << "cannot open checkpoint file " << filename << ": " << strerror (errno) << std::endl;
+		return -1;
+	}
+	return 0;
+}
+
+void BulkProcessor::addItem (const char *path, int id, const char *target, double size)
+{
+	items.push_back (new BulkItem (path, id, target, size));
+}
+
+int BulkProcessor::run ()
+{
+	std::vector <BulkItem *> todo;
+	for (std::vector <BulkItem *>::iterator iter = items.begin (); iter != items.end (); iter++)
+	{
+		if (checkpointed.find ((*iter)->path) == checkpointed.end ())
+			todo.push_back (*iter);
+	}
+
+	if (items.size () != todo.size ())
+		std::cout << "skipping " << (items.size () - todo.size ()) << " items already processed" << std::endl;
+
+	if (todo.empty ())
+		return 0;
+
+	int nth = parallelThreads (threads);
+	if ((size_t) nth > todo.size ())
+		nth = todo.size ();
+
+	ioFree = ioSlots > 0 ? ioSlots : nth;
+
+	// split items to continuous blocks, so workers process neighbouring files
+	queues.clear ();
+	queues.resize (nth);
+	queueMutex.resize (nth);
+	for (int w = 0; w < nth; w++)
+	{
+		pthread_mutex_init (&queueMutex[w], NULL);
+		size_t b = todo.size () * w / nth;
+		size_t e = todo.size () * (w + 1) / nth;
+		queues[w].insert (queues[w].end (), todo.begin () + b, todo.begin () + e);
+	}
+
+	std::vector <workerArg> args (nth);
+	std::vector <pthread_t> ths;
+	runningWorkers = 0;
+	for (int w = 0; w < nth; w++)
+	{
+		args[w].bp = this;
+		args[w].worker = w;
+		pthread_t th;
+		if (pthread_create (&th, NULL, BulkProcessor::workerThread, &args[w]))
+			break;
+		pthread_mutex_lock (&doneMutex);
+		runningWorkers++;
+		pthread_mutex_unlock (&doneMutex);
+		ths.push_back (th);
+	}
+
+	// run in this thread when threads cannot be created
+	if (ths.empty ())
+	{
+		std::cerr << "cannot create worker threads, processing serially" << std::endl;
+		for (std::vector <BulkItem *>::iterator iter = todo.begin (); iter != todo.end (); iter++)
+			processItem (*iter, 0);
+		done = todo;
+		for (int w = 0; w < nth; w++)
+			queues[w].clear ();
+	}
+
+	double start = bulkNow ();
+	double nextReport = start + reportInterval;
+	double lastCommit = start;
+	size_t processed = 0;
+	size_t failed = 0;
+	double bytes = 0;
+
+	std::vector <BulkItem *> batch;
+
+	while (true)
+	{
+		pthread_mutex_lock (&doneMutex);
+		while (done.size () < batchSize && runningWorkers > 0)
+		{
+			// wake up at least once per second for reports and commits
+			struct timespec ts;
+			double t = bulkNow () + 1;
+			ts.tv_sec = t;
+			ts.tv_nsec = (t - floor (t)) * 1e9;
+			if (pthread_cond_timedwait (&doneCond, &doneMutex, &ts) == ETIMEDOUT)
+				break;
+		}
+		batch.swap (done);
+		bool finished = runningWorkers == 0;
+		pthread_mutex_unlock (&doneMutex);
+
+		double now = bulkNow ();
+		if (batch.size () >= batchSize || (!batch.empty () && (finished || now - lastCommit >= 1)))
+		{
+			for (std::vector <BulkItem *>::iterator iter = batch.begin (); iter != batch.end (); iter++)
+				bytes += (*iter)->size;
+			processed += batch.size ();
+			// commit in batchSize chunks
+			for (size_t b = 0; b < batch.size (); b += batchSize)
+			{
+				std::vector <BulkItem *> chunk (batch.begin () + b, batch.begin () + std::min (batch.size (), b + batchSize));
+				commit (chunk, failed);
+			}
+			batch.clear ();
+			lastCommit = now;
+		}
+		else if (!batch.empty ())
+		{
+			// return items back for the next round
+			pthread_mutex_lock (&doneMutex);
+			done.insert (done.begin (), batch.begin (), batch.end ());
+			pthread_mutex_unlock (&doneMutex);
+			batch.clear ();
+		}
+
+		if (reportInterval > 0 && (now >= nextReport || finished))
+		{
+			report (processed, failed, todo.size (), bytes, now - start);
+			nextReport = now + reportInterval;
+		}
+
+		if (finished)
+			break;
+	}
+
+	for (std::vector <pthread_t>::iterator iter = ths.begin (); iter != ths.end (); iter++)
+		pthread_join (*iter, NULL);
+
+	for (int w = 0; w < nth; w++)
+		pthread_mutex_destroy (&queueMutex[w]);
+	queueMutex.clear ();
+	queues.clear ();
+
+	return failed;
+}
+
+void BulkProcessor::report (size_t done, size_t failed, size_t total, double bytes, double elapsed)
+{
+	std::ios_base::fmtflags flags = std::cout.flags ();
+	std::cout << std::fixed << std::setprecision (1) << "processed " << done << " of " << total << " (" << (100.0 * done / total) << "%)";
+	if (failed > 0)
+		std::cout << ", " << failed << " failed";
+	if (elapsed > 0)
+	{
+		std::cout << ", " << (done / elapsed) << " items/s, " << (bytes / elapsed / 1048576.0) << " MB/s";
+		if (done > 0 && done < total)
+		{
+			int eta = (total - done) * elapsed / done;
+			std::cout << ", ETA " << std::setfill ('0') << std::setw (2) << (eta / 3600) << ":" << std::setw (2) << ((eta / 60) % 60) << ":" << std::setw (2) << (eta % 60) << std::setfill (' ');
+		}
+	}
+	std::cout << std::endl;
+	std::cout.flags (flags);
+}
+
+BulkItem * BulkProcessor::nextItem (int worker)
+{
+	BulkItem *ret = NULL;
+	pthread_mutex_lock (&queueMutex[worker]);
+	if (!queues[worker].empty ())
+	{
+		ret = queues[worker].front ();
+		queues[worker].pop_front ();
+	}
+	pthread_mutex_unlock (&queueMutex[worker]);
+	if (ret != NULL)
+		return ret;
+
+	// steal from back of other queues
+	int n = queues.size ();
+	for (int i = 1; i < n && ret == NULL; i++)
+	{
+		int w = (worker + i) % n;
+		pthread_mutex_lock (&queueMutex[w]);
+		if (!queues[w].empty ())
+		{
+			ret = queues[w].back ();
+			queues[w].pop_back ();
+		}
+		pthread_mutex_unlock (&queueMutex[w]);
+	}
+	return ret;
+}
+
+void BulkProcessor::commit (std::vector <BulkItem *> &batch, size_t &failed)
+{
+	int ret = commitItems (batch);
+	for (std::vector <BulkItem *>::iterator iter = batch.begin (); iter != batch.end (); iter++)
+	{
+		if ((*iter)->status)
+		{
+			failed++;
+			std::cerr << (*iter)->path << ": " << (*iter)->message << std::endl;
+		}
+		else if (ret)
+		{
+			failed++;
+		}
+		else if (checkpointFile != NULL)
+		{
+			fprintf (checkpointFile, "%s\n", (*iter)->path.c_str ());
+		}
+	}
+	if (checkpointFile != NULL)
+		fflush (checkpointFile);
+}
+
+void *BulkProcessor::workerThread (void *arg)
+{
+	BulkProcessor *bp = ((workerArg *) arg)->bp;
+	int worker = ((workerArg *) arg)->worker;
+
+	BulkItem *item;
+	while ((item = bp->nextItem (worker)) != NULL)
+	{
+		bp->processItem (item, worker);
+		pthread_mutex_lock (&bp->doneMutex);
+		bp->done.push_back (item);
+		if (bp->done.size () >= bp->batchSize)
+			pthread_cond_signal (&bp->doneCond);
+		pthread_mutex_unlock (&bp->doneMutex);
+	}
+
+	pthread_mutex_lock (&bp->doneMutex);
+	bp->runningWorkers--;
+	pthread_cond_signal (&bp->doneCond);
+	pthread_mutex_unlock (&bp->doneMutex);
+	return NULL;
+}
@@ -0,0 +1,554 @@
+/*
+ * Combination of calibration frames.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2fits/calibcombine.h"
+#include "rts2fits/image.h"
+#include "rts2fits/parallel.h"
+
+#include "imghdr.h"
+
+#include <arpa/inet.h>
+#include <math.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include <algorithm>
+
+// number of pixels combined together
+#define COMBINE_BLOCK      256
+
+// padding (in floats) between frames in strip buffer, so pixels of different
+// frames do not map to the same cache sets
+#define STRIP_PAD          64
+
+// number of rows sampled to calculate frame median for normalization
+#define NORMALIZE_ROWS     32
+
+using namespace rts2image;
+
+static std::string fitsError (int status)
+{
+	char err[FLEN_STATUS];
+	fits_get_errstatus (status, err);
+	return std::string (err);
+}
+
+/**
+ * Combine block of pixels. buf holds len pixels of the first frame, pixels
+ * of other frames follow with stride. Values in buf are reordered by the
+ * network - median selection network for median, full sorting network for
+ * sigma clipping.
+ *
+ * NaN does not order in the networks, so NaN or infinite values are
+ * collected to mask before the networks run, and the mask is added to the
+ * output - pixels with such value in any frame are NaN in the master.
+ */
+static void combineBlock (float *buf, size_t stride, int n, const std::pair <int, int> *network, size_t networkSize, combine_method_t method, float sigmaLow, float sigmaHigh, int iterations, float *out, int len)
+{
+	if (method == COMBINE_MEAN)
+	{
+		float sum[COMBINE_BLOCK];
+		for (int x = 0; x < len; x++)
+			sum[x] = 0;
+		for (int f = 0; f < n; f++)
+		{
+			const float *w = buf + f * stride;
+			for (int x = 0; x < len; x++)
+				sum[x] += w[x];
+		}
+		for (int x = 0; x < len; x++)
+			out[x] = sum[x] / n;
+		return;
+	}
+
+	// 0 for finite values, NaN otherwise
+	float nanMask[COMBINE_BLOCK];
+	for (int x = 0; x < len; x++)
+		nanMask[x] = 0;
+	for (int f = 0; f < n; f++)
+	{
+		const float *w = buf + f * stride;
+		for (int x = 0; x < len; x++)
+			nanMask[x] += w[x] * 0;
+	}
+
+	for (size_t c = 0; c < networkSize; c++)
+	{
+		float *__restrict__ a = buf + network[c].first * stride;
+		float *__restrict__ b = buf + network[c].second * stride;
+		for (int x = 0; x < len; x++)
+		{
+			float va = a[x];
+			float vb = b[x];
+			// min and max forms, which map to vector instructions
+			a[x] = va < vb ? va : vb;
+			b[x] = vb < va ? va : vb;
+		}
+	}
+
+	// for odd number of frames both wires are the same
+	const float *lo = buf + ((n - 1) / 2) * stride;
+	const float *hi = buf + (n / 2) * stride;
+
+	if (method == COMBINE_MEDIAN)
+	{
+		for (int x = 0; x < len; x++)
+			out[x] = (lo[x] + hi[x]) / 2 + nanMask[x];
+		return;
+	}
+
+	// sigma clipped mean; values are sorted by the full network. Initial
+	// sigma is the smaller of distances of 15.9% and 84.1% quantiles from
+	// the median, so it is not inflated by outliers on one side. Sums are of differences from the centre to keep
+	// float precision.
+	float centre[COMBINE_BLOCK];
+	float lowLimit[COMBINE_BLOCK];
+	float highLimit[COMBINE_BLOCK];
+	float sumd[COMBINE_BLOCK];
+	float sumd2[COMBINE_BLOCK];
+	float cnt[COMBINE_BLOCK];
+	float lastCnt[COMBINE_BLOCK];
+
+	int q = floor (0.1587 * (n - 1) + 0.5);
+	const float *q16 = buf + q * stride;
+	const float *q84 = buf + (n - 1 - q) * stride;
+
+	for (int x = 0; x < len; x++)
+	{
+		centre[x] = out[x] = (lo[x] + hi[x]) / 2;
+		float s = std::min (centre[x] - q16[x], q84[x] - centre[x]);
+		lowLimit[x] = -sigmaLow * s;
+		highLimit[x] = sigmaHigh * s;
+		lastCnt[x] = n;
+	}
+
+	for (int i = 0; i < iterations; i++)
+	{
+		for (int x = 0; x < len; x++)
+		{
+			sumd[x] = 0;
+			sumd2[x] = 0;
+			cnt[x] = 0;
+		}
+		for (int f = 0; f < n; f++)
+		{
+			const float *w = buf + f * stride;
+			for (int x = 0; x < len; x++)
+			{
+				float d = w[x] - centre[x];
+				float k = (d >= lowLimit[x]) & (d <= highLimit[x]);
+				sumd[x] += k * d;
+				sumd2[x] += k * d * d;
+				cnt[x] += k;
+			}
+		}
+		int changed = 0;
+		for (int x = 0; x < len; x++)
+		{
+			// keep the last value if all values were rejected
+			if (cnt[x] == 0)
+				continue;
+			float m = sumd[x] / cnt[x];
+			float v = sumd2[x] / cnt[x] - m * m;
+			float s = sqrtf (v > 0 ? v : 0);
+			out[x] = centre[x] = centre[x] + m;
+			lowLimit[x] = -sigmaLow * s;
+			highLimit[x] = sigmaHigh * s;
+			changed += cnt[x] != lastCnt[x];
+			lastCnt[x] = cnt[x];
+		}
+		if (changed == 0)
+			break;
+	}
+
+	for (int x = 0; x < len; x++)
+		out[x] += nanMask[x];
+}
+
+CalibCombine::CalibCombine ()
+{
+	width = 0;
+	height = 0;
+
+	method = COMBINE_MEDIAN;
+	sigmaLow = 3;
+	sigmaHigh = 3;
+	iterations = 5;
+	threads = 0;
+	memoryLimit = 256 * 1024 * 1024;
+	normalize = false;
+
+	combineTime = NAN;
+
+	networkFrames = 0;
+
+	output = NULL;
+	stripRows = 0;
+	failed = false;
+
+	pthread_mutex_init (&readMutex, NULL);
+	pthread_mutex_init (&bufferMutex, NULL);
+}
+
+CalibCombine::~CalibCombine ()
+{
+	for (std::vector <frame>::iterator iter = frames.begin (); iter != frames.end (); iter++)
+	{
+		int status = 0;
+		fits_close_file (iter->fptr, &status);
+	}
+	pthread_mutex_destroy (&readMutex);
+	pthread_mutex_destroy (&bufferMutex);
+}
+
+int CalibCombine::addFrame (const char *filename)
+{
+	frame f;
+	int status = 0;
+	f.filename = std::string (filename);
+	f.scale = 1;
+	f.exposure = NAN;
+
+	// opens the first HDU with image data
+	fits_open_image (&f.fptr, filename, READONLY, &status);
+	if (status)
+	{
+		logStream (MESSAGE_ERROR) << "cannot open " << filename << ": " << fitsError (status) << sendLog;
+		return -1;
+	}
+
+	int naxis;
+	long sizes[2];
+	fits_get_img_dim (f.fptr, &naxis, &status);
+	if (status == 0 && naxis == 2)
+		fits_get_img_size (f.fptr, 2, sizes, &status);
+	if (status || naxis != 2)
+	{
+		logStream (MESSAGE_ERROR) << filename << " is not 2D image" << sendLog;
+		status = 0;
+		fits_close_file (f.fptr, &status);
+		return -1;
+	}
+
+	if (frames.empty ())
+	{
+		width = sizes[0];
+		height = sizes[1];
+	}
+	else if (sizes[0] != width || sizes[1] != height)
+	{
+		logStream (MESSAGE_ERROR) << filename << " size " << sizes[0] << "x" << sizes[1] << " differs from " << width << "x" << height << sendLog;
+		fits_close_file (f.fptr, &status);
+		return -1;
+	}
+
+	if (fits_read_key_dbl (f.fptr, (char *) "EXPTIME", &f.exposure, NULL, &status))
+	{
+		f.exposure = NAN;
+		status = 0;
+	}
+
+	frames.push_back (f);
+	return 0;
+}
+
+long CalibCombine::getStripRows ()
+{
+	if (frames.empty () || width == 0 || height == 0)
+		return 0;
+
+	long nth = parallelThreads (threads);
+	// floats available for strip of single frame
+	long frameFloats = memoryLimit / (nth * frames.size () * sizeof (float)) - STRIP_PAD;
+	long rows = frameFloats / width;
+	// give work to all threads
+	long maxRows = (height + nth - 1) / nth;
+	if (rows > maxRows)
+		rows = maxRows;
+	if (rows < 1)
+		rows = 1;
+	return rows;
+}
+
+int CalibCombine::combine (float *out)
+{
+	if (frames.empty ())
+	{
+		logStream (MESSAGE_ERROR) << "no frames to combine" << sendLog;
+		return -1;
+	}
+
+	struct timeval t0, t1;
+	gettimeofday (&t0, NULL);
+
+	for (std::vector <frame>::iterator iter = frames.begin (); iter != frames.end (); iter++)
+	{
+		iter->scale = 1;
+		if (normalize && normalizeFrame (*iter))
+			return -1;
+	}
+
+	buildNetwork ();
+
+	output = out;
+	stripRows = getStripRows ();
+	failed = false;
+
+	int strips = (height + stripRows - 1) / stripRows;
+	int nth = parallelThreads (threads);
+	if (nth > strips)
+		nth = strips;
+
+	size_t bufSize = frames.size () * (stripRows * width + STRIP_PAD);
+	for (int i = 0; i < nth; i++)
+		freeBuffers.push_back (new float[bufSize]);
+
+	parallelFor (this, &CalibCombine::processStrip, strips, nth);
+
+	for (std::vector <float *>::iterator iter = freeBuffers.begin (); iter != freeBuffers.end (); iter++)
+		delete[] *iter;
+	freeBuffers.clear ();
+	output = NULL;
+
+	gettimeofday (&t1, NULL);
+	combineTime = (t1.tv_sec - t0.tv_sec) + (t1.tv_usec - t0.tv_usec) / 1000000.0;
+
+	return failed ? -1 : 0;
+}
+
+int CalibCombine::combine (const char *filename, bool overwrite)
+{
+	if (frames.empty ())
+	{
+		logStream (MESSAGE_ERROR) << "no frames to combine" << sendLog;
+		return -1;
+	}
+
+	size_t dataSize = width * height * sizeof (float);
+	char *data = new char[sizeof (struct imghdr) + dataSize];
+
+	struct imghdr *im_h = (struct imghdr *) data;
+	memset (im_h, 0, sizeof (struct imghdr));
+	im_h->data_type = htons (RTS2_DATA_FLOAT);
+	im_h->naxes = htons (2);
+	im_h->sizes[0] = htonl (width);
+	im_h->sizes[1] = htonl (height);
+	im_h->binnings[0] = htons (1);
+	im_h->binnings[1] = htons (1);
+
+	if (combine ((float *) (data + sizeof (struct imghdr))))
+	{
+		delete[] data;
+		return -1;
+	}
+
+	struct timeval now;
+	gettimeofday (&now, NULL);
+
+	int ret = 0;
+	Image *image = new Image (filename, &now, overwrite, false, true);
+	if (image->getFitsFile () == NULL || image->writeData (data, data + sizeof (struct imghdr) + dataSize, 1))
+	{
+		logStream (MESSAGE_ERROR) << "cannot write combined frame to " << filename << sendLog;
+		ret = -1;
+	}
+	else
+	{
+		try
+		{
+			const char *methodName[] = {"median", "mean", "sigma clipped mean"};
+			image->setValue ("NCOMBINE", (int) frames.size (), "number of combined frames");
+			image->setValue ("COMBMETH", methodName[method], "combination method");
+			if (method == COMBINE_SIGMA)
+			{
+				image->setValue ("CLIPLOW", sigmaLow, "lower rejection limit (sigma)");
+				image->setValue ("CLIPHIGH", sigmaHigh, "upper rejection limit (sigma)");
+			}
+			if (normalize)
+				image->setValue ("NORMALIZ", true, "frames were normalized to unity median");
+
+			double exposure = 0;
+			for (std::vector <frame>::iterator iter = frames.begin (); iter != frames.end (); iter++)
+			{
+				exposure += iter->exposure;
+				image->writeHistory ((std::string ("combined from ") + iter->filename).c_str ());
+			}
+			if (!isnan (exposure))
+				image->setValue ("EXPTIME", exposure / frames.size (), "average exposure time of combined frames");
+		}
+		catch (rts2core::Error &er)
+		{
+			logStream (MESSAGE_ERROR) << "cannot write combination keys to " << filename << ": " << er << sendLog;
+			ret = -1;
+		}
+		if (image->saveImage ())
+			ret = -1;
+	}
+
+	// image channel references data
+	delete image;
+	delete[] data;
+
+	return ret;
+}
+
+void CalibCombine::processStrip (int strip)
+{
+	long y = strip * stripRows;
+	long rows = std::min (stripRows, height - y);
+
+	pthread_mutex_lock (&bufferMutex);
+	float *buf = freeBuffers.back ();
+	freeBuffers.pop_back ();
+	pthread_mutex_unlock (&bufferMutex);
+
+	if (readStrip (buf, y, rows))
+	{
+		failed = true;
+	}
+	else
+	{
+		size_t stride = rows * width + STRIP_PAD;
+		std::vector <std::pair <int, int> > &net = method == COMBINE_SIGMA ? sortNetwork : medianNetwork;
+		for (long r = 0; r < rows; r++)
+		{
+			for (long x = 0; x < width; x += COMBINE_BLOCK)
+			{
+				int len = std::min ((long) COMBINE_BLOCK, width - x);
+				combineBlock (buf + r * width + x, stride, frames.size (), net.empty () ? NULL : &net[0], net.size (), method, sigmaLow, sigmaHigh, iterations, output + (y + r) * width + x, len);
+			}
+		}
+	}
+
+	pthread_mutex_lock (&bufferMutex);
+	freeBuffers.push_back (buf);
+	pthread_mutex_unlock (&bufferMutex);
+}
+
+int CalibCombine::normalizeFrame (frame &f)
+{
+	long rows = std::min ((long) NORMALIZE_ROWS, height);
+	std::vector <float> values (rows * width);
+	int status = 0;
+	for (long i = 0; i < rows; i++)
+	{
+		long fpixel[2];
+		fpixel[0] = 1;
+		fpixel[1] = 1 + (2 * i + 1) * height / (2 * rows);
+		fits_read_pix (f.fptr, TFLOAT, fpixel, width, NULL, &values[i * width], NULL, &status);
+		if (status)
+		{
+			logStream (MESSAGE_ERROR) << "cannot read " << f.filename << ": " << fitsError (status) << sendLog;
+			return -1;
+		}
+	}
+	std::vector <float>::iterator mid = values.begin () + values.size () / 2;
+	std::nth_element (values.begin (), mid, values.end ());
+	if (!(*mid > 0))
+	{
+		logStream (MESSAGE_ERROR) << "cannot normalize " << f.filename << ", its median is " << *mid << sendLog;
+		return -1;
+	}
+	f.scale = 1 / *mid;
+	return 0;
+}
+
+int CalibCombine::readStrip (float *buf, long y, long rows)
+{
+	size_t stride = rows * width + STRIP_PAD;
+	long fpixel[2];
+	fpixel[0] = 1;
+	fpixel[1] = y + 1;
+
+	// cfitsio cannot be safely used from multiple threads
+	pthread_mutex_lock (&readMutex);
+	for (size_t i = 0; i < frames.size (); i++)
+	{
+		int status = 0;
+		fits_read_pix (frames[i].fptr, TFLOAT, fpixel, rows * width, NULL, buf + i * stride, NULL, &status);
+		if (status)
+		{
+			pthread_mutex_unlock (&readMutex);
+			logStream (MESSAGE_ERROR) << "cannot read rows " << y << " - " << (y + rows) << " of " << frames[i].filename << ": " << fitsError (status) << sendLog;
+			return -1;
+		}
+	}
+	pthread_mutex_unlock (&readMutex);
+
+	if (normalize)
+	{
+		for (size_t i = 0; i < frames.size (); i++)
+		{
+			float scale = frames[i].scale;
+			float *p = buf + i * stride;
+			for (long j = 0; j < rows * width; j++)
+				p[j] *= scale;
+		}
+	}
+	return 0;
+}
+
+void CalibCombine::buildNetwork ()
+{
+	int n = frames.size ();
+	if (networkFrames == (size_t) n)
+		return;
+	sortNetwork.clear ();
+	medianNetwork.clear ();
+	networkFrames = n;
+	if (n < 2)
+		return;
+
+	int p2 = 1;
+	while (p2 < n)
+		p2 <<= 1;
+
+	// Batcher odd-even merge sort for power of 2 wires. Missing wires are
+	// considered to hold +inf, so comparators touching them are not
+	// needed.
+	for (int p = 1; p < p2; p <<= 1)
+	{
+		for (int k = p; k >= 1; k >>= 1)
+		{
+			for (int j = k % p; j + k < p2; j += 2 * k)
+			{
+				for (int i = 0; i < k && i + j + k < n; i++)
+				{
+					if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+						sortNetwork.push_back (std::pair <int, int> (i + j, i + j + k));
+				}
+			}
+		}
+	}
+
+	// keep only comparators which influence the median wires
+	std::vector <bool> needed (n, false);
+	needed[(n - 1) / 2] = true;
+	needed[n / 2] = true;
+	for (std::vector <std::pair <int, int> >::reverse_iterator iter = sortNetwork.rbegin (); iter != sortNetwork.rend (); iter++)
+	{
+		if (needed[iter->first] || needed[iter->second])
+		{
+			needed[iter->first] = true;
+			needed[iter->second] = true;
+			medianNetwork.push_back (*iter);
+		}
+	}
+	std::reverse (medianNetwork.begin (), medianNetwork.end ());
+}
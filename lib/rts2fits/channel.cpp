@@ -18,6 +18,7 @@
  */
 
 #include "rts2fits/channel.h"
+#include "rts2fits/parallel.h"
 #include "error.h"
 #include "imghdr.h"
 #include "nan.h"
@@ -26,6 +27,7 @@
 #include <string.h>
 #include <math.h>
 #include <iostream>
+#include <limits>
 
 using namespace rts2image;
 
@@ -40,7 +42,7 @@ Channel::Channel (int16_t _dataType)
 	naxis = 0;
 	sizes = NULL;
 
-	pixelSum = average = stdev = NAN;
+	clearStatistics ();
 }
 
 Channel::Channel (int ch, char *_data, int _naxis, long *_sizes, int16_t _dataType, bool dealloc)
@@ -57,7 +59,7 @@ Channel::Channel (int ch, char *_data, int _naxis, long *_sizes, int16_t _dataTy
 	sizes = new long [naxis];
 	memcpy (sizes, _sizes, naxis * sizeof (long));
 
-	pixelSum = average = stdev = NAN;
+	clearStatistics ();
 }
 
 
@@ -76,7 +78,7 @@ Channel::Channel (int ch, char *_data, long dataSize, int _naxis, long *_sizes,
 	sizes = new long [naxis];
 	memcpy (sizes, _sizes, naxis * sizeof (long));
 
-	pixelSum = average = stdev = NAN;
+	clearStatistics ();
 }
 
 Channel::~Channel ()
@@ -86,38 +88,223 @@ Channel::~Channel ()
 	delete[] sizes;
 }
 
-template <typename pixel_type> void computeDataStatistics (pixel_type *data, long totalPixels, long double &pixelSum, double &average, double &stdev)
+/**
+ * Statistics of a continuous part of channel data.
+ */
+struct statPart
+{
+	size_t n;
+	// sums of pixel values minus shift, to keep precision of sum of squares
+	double sum;
+	double sum2;
+	double min;
+	double max;
+	std::vector <uint32_t> hist;
+};
+
+template <typename dt> dt lowestValue ()
+{
+	return std::numeric_limits <dt>::is_integer ? std::numeric_limits <dt>::min () : -std::numeric_limits <dt>::max ();
+}
+
+/**
+ * Fused pass computing sums, extremes and histogram of channel parts.
+ */
+template <typename dt> class StatJob
 {
-	// calculate average of all channels..
-	pixel_type *pixel = data;
-	pixel_type *fullTop = pixel + totalPixels;
+	public:
+		const dt *data;
+		size_t pixels;
+		double shift;
+		bool exact;
+		double low;
+		double invWidth;
+		std::vector <statPart> parts;
 
-	pixelSum = 0;
+		void step (int p)
+		{
+			size_t from = pixels * p / parts.size ();
+			size_t to = pixels * (p + 1) / parts.size ();
+
+			statPart &part = parts[p];
+			part.hist.assign (CHANNEL_HISTOGRAM_BINS, 0);
+			uint32_t *h = &(part.hist[0]);
+
+			size_t n = 0;
+			double s = 0;
+			double s2 = 0;
+			dt mn = std::numeric_limits <dt>::max ();
+			dt mx = lowestValue <dt> ();
+
+			if (exact)
+			{
+				// 8 and 16 bit integers, no NaNs
+				int l = (int) low;
+				for (size_t i = from; i < to; i++)
+				{
+					dt v = data[i];
+					double d = v - shift;
+					s += d;
+					s2 += d * d;
+					if (v < mn)
+						mn = v;
+					if (v > mx)
+						mx = v;
+					h[(int) v - l]++;
+				}
+				n = to - from;
+			}
+			else
+			{
+				for (size_t i = from; i < to; i++)
+				{
+					dt v = data[i];
+					if (v != v)
+						continue;
+					double d = v - shift;
+					s += d;
+					s2 += d * d;
+					if (v < mn)
+						mn = v;
+					if (v > mx)
+						mx = v;
+					double b = (v - low) * invWidth;
+					if (b < 0)
+						h[0]++;
+					else if (b >= CHANNEL_HISTOGRAM_BINS)
+						h[CHANNEL_HISTOGRAM_BINS - 1]++;
+					else
+						h[(int) b]++;
+					n++;
+				}
+			}
+
+			part.n = n;
+			part.sum = s;
+			part.sum2 = s2;
+			part.min = mn;
+			part.max = mx;
+		}
+};
 
-	while (pixel < fullTop)
+void Channel::clearStatistics ()
+{
+	pixelSum = average = stdev = min = max = median = NAN;
+	statPixels = 0;
+	histogram.clear ();
+	histLow = 0;
+	histWidth = 1;
+	histExact = false;
+	statValid = false;
+	statFrom = statSize = 0;
+}
+
+template <typename dt> void Channel::computeDataStatistics (const dt *data, size_t totalPixels)
+{
+	StatJob <dt> job;
+	job.data = data;
+	job.pixels = totalPixels;
+
+	clearStatistics ();
+
+	if (totalPixels == 0)
 	{
-		pixelSum += *pixel;
-		pixel++;
+		pixelSum = average = stdev = 0;
+		return;
 	}
-	if (totalPixels > 0)
+
+	// estimate histogram range from sparse sample, unless all values fit
+	if (std::numeric_limits <dt>::is_integer && sizeof (dt) <= 2)
+	{
+		job.exact = true;
+		job.low = std::numeric_limits <dt>::min ();
+		job.invWidth = 1;
+		histExact = true;
+		histLow = job.low;
+		histWidth = 1;
+	}
+	else
 	{
-		average = pixelSum / totalPixels;
-		// calculate stdev
-		pixel = data;
-		stdev = 0;
-		while (pixel < fullTop)
+		job.exact = false;
+		size_t stride = totalPixels / CHANNEL_HISTOGRAM_BINS + 1;
+		double smin = NAN;
+		double smax = NAN;
+		for (size_t i = 0; i < totalPixels; i += stride)
+		{
+			double v = data[i];
+			if (isnan (v))
+				continue;
+			if (!(v >= smin))
+				smin = v;
+			if (!(v <= smax))
+				smax = v;
+		}
+		if (isnan (smin))
 		{
-			long double tmp_s = *pixel - average;
-			long double tmp_ss = tmp_s * tmp_s;
-			stdev += tmp_ss;
-			pixel++;
+			smin = smax = 0;
 		}
-		stdev = sqrt (stdev / totalPixels);
+		histLow = smin;
+		histWidth = (smax - smin) / (CHANNEL_HISTOGRAM_BINS - 1);
+		if (std::numeric_limits <dt>::is_integer)
+		{
+			histLow = floor (smin);
+			histWidth = ceil (histWidth);
+		}
+		if (!(histWidth > 0))
+			histWidth = 1;
+		histExact = std::numeric_limits <dt>::is_integer && histWidth == 1;
+		job.low = histLow;
+		job.invWidth = 1 / histWidth;
+	}
+
+	job.shift = 0;
+	for (size_t i = 0; i < totalPixels; i++)
+	{
+		if (!isnan ((double) data[i]))
+		{
+			job.shift = data[i];
+			break;
+		}
+	}
+
+	// parts are large, to amortize histogram merge
+	int threads = parallelThreads (0);
+	size_t nparts = totalPixels / (1 << 18) + 1;
+	if (nparts > (size_t) threads)
+		nparts = threads;
+	job.parts.resize (nparts);
+
+	parallelFor (&job, &StatJob<dt>::step, nparts, threads);
+
+	histogram.assign (CHANNEL_HISTOGRAM_BINS, 0);
+	double s = 0;
+	double s2 = 0;
+	for (typename std::vector <statPart>::iterator iter = job.parts.begin (); iter != job.parts.end (); iter++)
+	{
+		if (iter->n == 0)
+			continue;
+		statPixels += iter->n;
+		s += iter->sum;
+		s2 += iter->sum2;
+		if (!(iter->min >= min))
+			min = iter->min;
+		if (!(iter->max <= max))
+			max = iter->max;
+		for (int i = 0; i < CHANNEL_HISTOGRAM_BINS; i++)
+			histogram[i] += iter->hist[i];
+	}
+
+	if (statPixels > 0)
+	{
+		pixelSum = (long double) job.shift * statPixels + s;
+		average = job.shift + s / statPixels;
+		double var = s2 / statPixels - (s / statPixels) * (s / statPixels);
+		stdev = var > 0 ? sqrt (var) : 0;
+		median = getQuantile (0.5);
 	}
 	else
 	{
-		average = 0;
-		stdev = 0;
+		pixelSum = average = stdev = 0;
 	}
 }
 
@@ -125,38 +312,71 @@ void Channel::computeStatistics (size_t _from, size_t _dataSize)
 {
 	if (_dataSize == 0)
 		_dataSize = getNPixels ();
+	if (statValid && statFrom == _from && statSize == _dataSize)
+		return;
 	switch (dataType)
 	{
 		case RTS2_DATA_BYTE:
-			computeDataStatistics ((unsigned char *) (getData ()) + _from, _dataSize, pixelSum, average, stdev);
+			computeDataStatistics ((unsigned char *) (getData ()) + _from, _dataSize);
 			break;
 		case RTS2_DATA_SHORT:
-			computeDataStatistics ((int16_t *) (getData ()) + _from, _dataSize, pixelSum, average, stdev);
+			computeDataStatistics ((int16_t *) (getData ()) + _from, _dataSize);
 			break;
 		case RTS2_DATA_LONG:
-			computeDataStatistics ((int32_t *) (getData ()) + _from, _dataSize, pixelSum, average, stdev);
+			computeDataStatistics ((int32_t *) (getData ()) + _from, _dataSize);
 			break;
 		case RTS2_DATA_LONGLONG:
-			computeDataStatistics ((int64_t *) (getData ()) + _from, _dataSize, pixelSum, average, stdev);
+			computeDataStatistics ((int64_t *) (getData ()) + _from, _dataSize);
 			break;
 		case RTS2_DATA_FLOAT:
-			computeDataStatistics ((float *) (getData ()) + _from, _dataSize, pixelSum, average, stdev);
+			computeDataStatistics ((float *) (getData ()) + _from, _dataSize);
 			break;
 		case RTS2_DATA_DOUBLE:
-			computeDataStatistics ((double *) (getData ()) + _from, _dataSize, pixelSum, average, stdev);
+			computeDataStatistics ((double *) (getData ()) + _from, _dataSize);
 			break;
 		case RTS2_DATA_SBYTE:
-			computeDataStatistics ((signed char *) (getData ()) + _from, _dataSize, pixelSum, average, stdev);
+			computeDataStatistics ((signed char *) (getData ()) + _from, _dataSize);
 			break;
 		case RTS2_DATA_USHORT:
-			computeDataStatistics ((uint16_t *) (getData ()) + _from, _dataSize, pixelSum, average, stdev);
+			computeDataStatistics ((uint16_t *) (getData ()) + _from, _dataSize);
 			break;
 		case RTS2_DATA_ULONG:
-			computeDataStatistics ((uint32_t *) (getData ()) + _from, _dataSize, pixelSum, average, stdev);
+			computeDataStatistics ((uint32_t *) (getData ()) + _from, _dataSize);
 			break;
 		default:
 			throw rts2core::Error ("unknow dataType");
 	}
+	statValid = allocated;
+	statFrom = _from;
+	statSize = _dataSize;
+}
+
+double Channel::getQuantile (double q)
+{
+	if (statPixels == 0 || histogram.empty ())
+		return NAN;
+	double target = q * statPixels;
+	double cum = 0;
+	double ret = max;
+	for (size_t b = 0; b < histogram.size (); b++)
+	{
+		if (histogram[b] == 0)
+			continue;
+		if (cum + histogram[b] > target)
+		{
+			if (histExact)
+				ret = histLow + b;
+			else
+				ret = histLow + (b + (target - cum) / histogram[b]) * histWidth;
+			break;
+		}
+		cum += histogram[b];
+	}
+	if (ret < min)
+		return min;
+	if (ret > max)
+		return max;
+	return ret;
 }
 
 Channels::Channels ()
@@ -25,6 +25,7 @@ DevClientCameraFoc::DevClientCameraFoc (rts2core::Connection * in_connection, co
 	}
 	isFocusing = 0;
 	focConn = NULL;
+	extractSources = false;
 }
 
 DevClientCameraFoc::~DevClientCameraFoc (void)
@@ -78,6 +79,15 @@ imageProceRes DevClientCameraFoc::processImage (Image * image)
 
 	//else if (darkImage)
 	//	image->substractDark (darkImage);
+	if (image->getShutter () == SHUT_OPENED && extractSources)
+	{
+		int num = image->extractSources ();
+		if (num >= 0)
+		{
+			image->writeSourcesStats ();
+			logStream (MESSAGE_INFO) << "detected " << num << " sources, median FWHM " << image->getSourcesFWHM () << sendLog;
+		}
+	}
 	if ((image->getShutter () == SHUT_OPENED) && exe)
 	{
 		focConn = new ConnFocus (getMaster (), image, exe, EVENT_CHANGE_FOCUS);
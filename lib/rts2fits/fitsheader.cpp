@@ -0,0 +1,189 @@
+/*
+ * Fast reader of FITS primary header.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2fits/fitsheader.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define FITS_BLOCK    2880
+#define FITS_CARD     80
+
+using namespace rts2image;
+
+int FitsHeader::load (const char *filename)
+{
+	cards.clear ();
+	headerSize = 0;
+
+	int fd = open (filename, O_RDONLY);
+	if (fd == -1)
+		return -1;
+
+	char block[FITS_BLOCK];
+	bool end = false;
+	while (!end)
+	{
+		size_t got = 0;
+		while (got < FITS_BLOCK)
+		{
+			ssize_t ret = read (fd, block + got, FITS_BLOCK - got);
+			if (ret < 0 && errno == EINTR)
+				continue;
+			if (ret <= 0)
+			{
+				int err = ret == 0 ? EINVAL : errno;
+				close (fd);
+				errno = err;
+				return -1;
+			}
+			got += ret;
+		}
+		// the first card must be SIMPLE
+		if (headerSize == 0 && strncmp (block, "SIMPLE  =", 9))
+		{
+			close (fd);
+			errno = EINVAL;
+			return -1;
+		}
+		headerSize += FITS_BLOCK;
+		for (const char *card = block; card < block + FITS_BLOCK; card += FITS_CARD)
+		{
+			if (!strncmp (card, "END     ", 8))
+			{
+				end = true;
+				break;
+			}
+			parseCard (card);
+		}
+	}
+	close (fd);
+	return 0;
+}
+
+const char *FitsHeader::getString (const char *key)
+{
+	std::map <std::string, std::string>::iterator iter = cards.find (key);
+	if (iter == cards.end ())
+		return NULL;
+	return iter->second.c_str ();
+}
+
+int FitsHeader::getInteger (const char *key, long &value)
+{
+	const char *v = getString (key);
+	if (v == NULL || *v == '\0')
+		return -1;
+	char *endp;
+	value = strtol (v, &endp, 10);
+	return *endp == '\0' ? 0 : -1;
+}
+
+int FitsHeader::getDouble (const char *key, double &value)
+{
+	const char *v = getString (key);
+	if (v == NULL || *v == '\0')
+		return -1;
+	std::string s (v);
+	// FITS allows D exponent
+	size_t d = s.find_first_of ("dD");
+	if (d != std::string::npos)
+		s[d] = 'E';
+	char *endp;
+	value = strtod (s.c_str (), &endp);
+	return *endp == '\0' ? 0 : -1;
+}
+
+size_t FitsHeader::getHDUSize ()
+{
+	if (headerSize == 0)
+		return 0;
+	long bitpix, naxis;
+	if (getInteger ("BITPIX", bitpix) || getInteger ("NAXIS", naxis))
+		return headerSize;
+	if (naxis == 0)
+		return headerSize;
+	size_t data = labs (bitpix) / 8;
+	for (long i = 1; i <= naxis; i++)
+	{
+		char k[10];
+		long n;
+		snprintf (k, 10, "NAXIS%ld", i);
+		if (getInteger (k, n))
+			return headerSize;
+		data *= n;
+	}
+	return headerSize + ((data + FITS_BLOCK - 1) / FITS_BLOCK) * FITS_BLOCK;
+}
+
+void FitsHeader::parseCard (const char *card)
+{
+	// only keyword = value cards; commentary keywords never have value
+	if (card[8] != '=' || card[9] != ' ' || !strncmp (card, "COMMENT ", 8) || !strncmp (card, "HISTORY ", 8))
+		return;
+
+	const char *ke = card + 8;
+	while (ke > card && ke[-1] == ' ')
+		ke--;
+	if (ke == card)
+		return;
+	std::string key (card, ke - card);
+
+	const char *v = card + 10;
+	const char *e = card + FITS_CARD;
+	while (v < e && *v == ' ')
+		v++;
+
+	std::string value;
+	if (v < e && *v == '\'')
+	{
+		// string value, '' is escaped quote
+		for (v++; v < e; v++)
+		{
+			if (*v == '\'')
+			{
+				if (v + 1 < e && v[1] == '\'')
+				{
+					value += '\'';
+					v++;
+					continue;
+				}
+				break;
+			}
+			value += *v;
+		}
+		// trailing spaces are not significant
+		size_t l = value.find_last_not_of (' ');
+		value.erase (l == std::string::npos ? 0 : l + 1);
+	}
+	else
+	{
+		const char *ve = v;
+		while (ve < e && *ve != '/')
+			ve++;
+		while (ve > v && ve[-1] == ' ')
+			ve--;
+		value = std::string (v, ve - v);
+	}
+	cards[key] = value;
+}
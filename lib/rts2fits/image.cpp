@@ -1050,6 +1050,7 @@ int Image::writeData (char *in_data, char *fullTop, int nchan)
 
 		setValue ("AVERAGE", ch->getAverage (), "average value of image");
 		setValue ("STDEV", ch->getStDev (), "standard deviation value of image");
+		setValue ("MEDIAN", ch->getMedian (), "median value of image");
 	}
 	return ret;
 }
@@ -1102,64 +1103,64 @@ void Image::getImgHeader (struct imghdr *im_h, int chan)
 
 void Image::getHistogram (long *histogram, long nbins)
 {
-	memset (histogram, 0, nbins * sizeof(int));
-	int bins;
+	memset (histogram, 0, nbins * sizeof (long));
 	if (channels.size () == 0)
 		loadChannels ();
 
-	switch (dataType)
+	for (Channels::iterator iter = channels.begin (); iter != channels.end (); iter++)
+		addChannelHistogram (*iter, histogram, nbins);
+}
+
+void Image::getChannelHistogram (int chan, long *histogram, long nbins)
+{
+	memset (histogram, 0, nbins * sizeof (long));
+	if (channels.size () == 0)
+		loadChannels ();
+
+	addChannelHistogram (channels[chan], histogram, nbins);
+}
+
+void Image::addChannelHistogram (Channel *ch, long *histogram, long nbins)
+{
+	ch->computeStatistics ();
+
+	const std::vector <long> &chh = ch->getHistogram ();
+	double bins = 65536.0 / nbins;
+	for (size_t i = 0; i < chh.size (); i++)
 	{
-		case RTS2_DATA_USHORT:
-			bins = 65536 / nbins;
-			for (Channels::iterator iter = channels.begin (); iter != channels.end (); iter++)
-			{
-				for (uint16_t *d = (uint16_t *)((*iter)->getData ()); d < ((uint16_t *)((*iter)->getData ())) + ((*iter)->getNPixels ()); d++)
-				{
-					histogram[*d / bins]++;
-				}
-			}
-			break;
-		case RTS2_DATA_FLOAT:
-			bins = 65536 / nbins;
-			for (Channels::iterator iter = channels.begin (); iter != channels.end (); iter++)
-			{
-				for (float *d = (float *)((*iter)->getData ()); d < ((float *)((*iter)->getData ())) + ((*iter)->getNPixels ()); d++)
-				{
-					histogram[((uint16_t)*d) / bins]++;
-				}
-			}
-			break;
-		default:
-			break;
+		if (chh[i] == 0)
+			continue;
+		// value of the bin centre
+		double v = ch->getHistogramLow () + (i + 0.5) * ch->getHistogramBinWidth ();
+		if (v < 0 || v >= 65536)
+			continue;
+		histogram[(long) (v / bins)] += chh[i];
 	}
 }
 
-void Image::getChannelHistogram (int chan, long *histogram, long nbins)
+template <typename dt> void Image::getChannelQuantiles (int chan, dt minval, dt mval, float quantiles, dt &low, dt &high)
 {
-	memset (histogram, 0, nbins * sizeof(int));
-	int bins;
 	if (channels.size () == 0)
 		loadChannels ();
 
-	switch (dataType)
+	Channel *ch = channels[chan];
+	ch->computeStatistics ();
+
+	double l = ch->getQuantile (quantiles);
+	double h = ch->getQuantile (1 - quantiles);
+	if (!(h > l))
 	{
-		case RTS2_DATA_USHORT:
-			bins = 65536 / nbins;
-			for (uint16_t *d = (uint16_t *)(channels[chan]->getData ()); d < ((uint16_t *)(channels[chan]->getData ()) + channels[chan]->getNPixels ()); d++)
-			{
-				histogram[*d / bins]++;
-			}
-			break;
-		case RTS2_DATA_FLOAT:
-			bins = 65536 / nbins;
-			for (float *d = (float *)(channels[chan]->getData ()); d < ((float *)(channels[chan]->getData ()) + channels[chan]->getNPixels ()); d++)
-			{
-				histogram[((uint16_t)*d) / bins]++;
-			}
-			break;
-		default:
-			break;
+		l = ch->getMin ();
+		h = ch->getMax ();
+	}
+	if (!(h > l))
+	{
+		low = minval;
+		high = mval;
+		return;
 	}
+	low = l <= minval ? minval : (dt) l;
+	high = h >= mval ? mval : (dt) h;
 }
 
 
@@ -1215,50 +1216,12 @@ template <typename bt, typename dt> void Image::getChannelGrayscaleByteBuffer (i
 
 template <typename bt, typename dt> void Image::getChannelGrayscaleBuffer (int chan, bt * &buf, bt black, dt minval, dt mval, float quantiles, size_t offset, bool invert_y)
 {
-	long hist[65536];
-	getChannelHistogram (chan, hist, 65536);
-
-	long psum = 0;
-	dt low = minval;
-	dt high = minval;
-
-	uint32_t i;
+	dt low;
+	dt high;
+	getChannelQuantiles (chan, minval, mval, quantiles, low, high);
 
 	long s = getChannelNPixels (chan);
 
-	// find quantiles
-	for (i = 0; (dt) i < mval; i++)
-	{
-		psum += hist[i];
-		if (psum > s * quantiles)
-		{
-			low = i;
-			break;
-		}
-	}
-
-	if (low == minval)
-	{
-		low = minval;
-		high = mval;
-	}
-	else
-	{
-		for (; (dt) i < mval; i++)
-		{
-			psum += hist[i];
-			if (psum > s * (1 - quantiles))
-			{
-				high = i;
-				break;
-			}
-		}
-		if (high == minval)
-		{
-			high = mval;
-		}
-	}
-
 	getChannelGrayscaleByteBuffer (chan, buf, black, low, high, s, offset, invert_y);
 }
 
@@ -1442,50 +1405,12 @@ template <typename bt, typename dt> void Image::getChannelPseudocolourByteBuffer
 
 template <typename bt, typename dt> void Image::getChannelPseudocolourBuffer (int chan, bt * &buf, bt black, dt minval, dt mval, float quantiles, size_t offset, bool invert_y, int colourVariant)
 {
-	long hist[65536];
-	getChannelHistogram (chan, hist, 65536);
-
-	long psum = 0;
-	dt low = minval;
-	dt high = minval;
-
-	uint32_t i;
+	dt low;
+	dt high;
+	getChannelQuantiles (chan, minval, mval, quantiles, low, high);
 
 	long s = getChannelNPixels (chan);
 
-	// find quantiles
-	for (i = 0; (dt) i < mval; i++)
-	{
-		psum += hist[i];
-		if (psum > s * quantiles)
-		{
-			low = i;
-			break;
-		}
-	}
-
-	if (low == minval)
-	{
-		low = minval;
-		high = mval;
-	}
-	else
-	{
-		for (; (dt) i < mval; i++)
-		{
-			psum += hist[i];
-			if (psum > s * (1 - quantiles))
-			{
-				high = i;
-				break;
-			}
-		}
-		if (high == minval)
-		{
-			high = mval;
-		}
-	}
-
 	getChannelPseudocolourByteBuffer (chan, buf, black, low, high, s, offset, invert_y, colourVariant);
 }
 
@@ -1867,14 +1792,19 @@ void Image::computeStatistics (size_t _from, size_t _dataSize)
 	long totalSize = 0;
 
 	avg_stdev = 0;
+	min = max = NAN;
 
 	for (Channels::iterator iter = channels.begin (); iter != channels.end (); iter++)
 	{
 		(*iter)->computeStatistics (_from, _dataSize);
 
-		totalSize += (*iter)->getNPixels ();
+		totalSize += (*iter)->getStatPixels ();
 		pixelSum += (*iter)->getPixelSum ();
 		avg_stdev += (*iter)->getStDev ();
+		if (!((*iter)->getMin () >= min))
+			min = (*iter)->getMin ();
+		if (!((*iter)->getMax () <= max))
+			max = (*iter)->getMax ();
 	}
 
 	if (totalSize > 0)
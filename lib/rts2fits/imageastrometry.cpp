@@ -151,3 +151,87 @@ void Image::getCoordMountRawBest (LibnovaRaDec & radec)
 	}
 }
 
+
+int Image::solveAstrometry (PlateSolver &solver, plateSolution &sol, int chan, bool write)
+{
+	if (sexResultNum == 0 && extractSources (chan) < 0)
+		return -1;
+
+	long w = getChannelWidth (chan);
+	long h = getChannelHeight (chan);
+
+	// prior from previous astrometry, or from telescope position
+	struct ln_equ_posn prior;
+	double crpix1 = (w + 1) / 2.0;
+	double crpix2 = (h + 1) / 2.0;
+	try
+	{
+		getCoordAstrometry (prior);
+		getValue ("CRPIX1", crpix1);
+		getValue ("CRPIX2", crpix2);
+	}
+	catch (rts2core::Error &er)
+	{
+		try
+		{
+			getCoordMount (prior);
+		}
+		catch (rts2core::Error &er)
+		{
+			logStream (MESSAGE_ERROR) << "cannot solve image without CRVAL or TELRA/TELDEC keywords" << sendLog;
+			return -1;
+		}
+	}
+
+	if (isnan (solver.getScale ()))
+	{
+		double cdelt1 = NAN;
+		getValue ("CDELT1", cdelt1);
+		if (isnan (cdelt1) || cdelt1 == 0)
+		{
+			logStream (MESSAGE_ERROR) << "pixel scale is not known, cannot solve image" << sendLog;
+			return -1;
+		}
+		solver.setScale (fabs (cdelt1) * 3600.0);
+	}
+
+	std::vector <stardata> sources (sexResults, sexResults + sexResultNum);
+	if (solver.solve (sources, w, h, &prior, crpix1, crpix2, sol))
+		return -1;
+
+	if (!write)
+		return 0;
+
+	// CD matrix to CDELT and CROTA2
+	double rot = ln_deg_to_rad (sol.rotation);
+	double cdelt2 = sqrt (sol.cd[1] * sol.cd[1] + sol.cd[3] * sol.cd[3]);
+	double cdelt1 = sol.cd[0] * cos (rot) + sol.cd[2] * sin (rot);
+
+	setValue ("CTYPE1", "RA---TAN", "TAN projection");
+	setValue ("CTYPE2", "DEC--TAN", "TAN projection");
+	setValue ("CRVAL1", sol.crval.ra, "reference value on 1st axis");
+	setValue ("CRVAL2", sol.crval.dec, "reference value on 2nd axis");
+	setValue ("CRPIX1", sol.crpix[0], "reference pixel of the 1st axis");
+	setValue ("CRPIX2", sol.crpix[1], "reference pixel of the 2nd axis");
+	setValue ("CDELT1", cdelt1, "delta along 1st axis");
+	setValue ("CDELT2", cdelt2, "delta along 2nd axis");
+	setValue ("CROTA2", sol.rotation, "rotational angle");
+	setValue ("ASTRNUM", sol.matched, "number of stars matched by astrometry");
+	setValue ("ASTRRMS", sol.rms, "[arcsec] RMS of astrometry fit");
+
+	// errors are relative to telescope position
+	try
+	{
+		getCoordMount (prior);
+	}
+	catch (rts2core::Error &er)
+	{
+	}
+	double dra = prior.ra - sol.crval.ra;
+	if (dra > 180)
+		dra -= 360;
+	else if (dra < -180)
+		dra += 360;
+	setAstroResults (sol.crval.ra, sol.crval.dec, cos (ln_deg_to_rad (prior.dec)) * dra, prior.dec - sol.crval.dec);
+	return 0;
+}
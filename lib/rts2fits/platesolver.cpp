@@ -0,0 +1,637 @@
+/*
+ * In-process plate solver.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2fits/platesolver.h"
+#include "rts2fits/image.h"
+#include "rts2fits/parallel.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+// number of brightest sources used to build triangles
+#define TRIANGLE_STARS     30
+// number of brightest neighbours used to build triangles around a star
+#define TRIANGLE_NEIGHBOURS 12
+// number of brightest sources used to verify candidate
+#define VERIFY_STARS       60
+// number of brightest sources used for the final fit
+#define FIT_STARS          300
+// maximal number of catalogue stars
+#define MAX_CATALOGUE      3000
+// bins of triangle side ratios
+#define RATIO_BINS         50
+// tolerance of triangle side ratios
+#define RATIO_TOLERANCE    0.01
+// minimal triangle side, in pixels
+#define MIN_SIDE           10.0
+// number of candidate verification jobs
+#define VERIFY_JOBS        64
+
+using namespace rts2image;
+
+namespace rts2image
+{
+
+struct solverPoint
+{
+	double x;
+	double y;
+};
+
+struct solverTriangle
+{
+	// vertices opposite the longest, middle and shortest side
+	int v[3];
+	// ratios of middle and shortest side to the longest side
+	double u;
+	double w;
+	// longest side
+	double a;
+	// orientation of the vertices
+	bool ccw;
+	int key;
+};
+
+/**
+ * Linear transformation from image pixels (relative to the reference pixel)
+ * to tangent plane (degrees).
+ */
+struct solverTransform
+{
+	double m[4];
+	double t[2];
+	int matched;
+
+	void apply (const solverPoint &p, solverPoint &r) const
+	{
+		r.x = m[0] * p.x + m[1] * p.y + t[0];
+		r.y = m[2] * p.x + m[3] * p.y + t[1];
+	}
+};
+
+class compareStarFlux
+{
+	public:
+		bool operator () (const stardata &a, const stardata &b) const
+		{
+			return a.F > b.F;
+		}
+};
+
+class compareTriangleKey
+{
+	public:
+		bool operator () (const solverTriangle &a, const solverTriangle &b) const
+		{
+			return a.key < b.key;
+		}
+};
+
+/**
+ * Data shared by verification threads.
+ */
+class SolveJob
+{
+	public:
+		std::vector <solverPoint> img;
+		std::vector <solverPoint> cat;
+
+		std::vector <solverTriangle> imgTriangles;
+		// sorted by key
+		std::vector <solverTriangle> catTriangles;
+		std::vector <size_t> keyStart;
+
+		// catalogue index grid
+		double gridCell;
+		double gridMin[2];
+		int gridSize[2];
+		std::vector <size_t> gridStart;
+		std::vector <int> gridStars;
+
+		double scale;
+		double scaleTolerance;
+		double matchRadius;
+		int goodMatches;
+		int minMatches;
+
+		std::vector <solverTransform> best;
+
+		pthread_mutex_t mutex;
+		bool found;
+
+		void buildGrid ();
+
+		// index of nearest catalogue star within match radius, -1 if there isn't any
+		int nearest (const solverPoint &p, double &dist);
+
+		int countMatches (const solverTransform &tr);
+
+		void verify (int job);
+};
+
+}
+
+static void project (const struct ln_equ_posn *c, double ra, double dec, solverPoint &p)
+{
+	double d0 = ln_deg_to_rad (c->dec);
+	double d = ln_deg_to_rad (dec);
+	double da = ln_deg_to_rad (ra - c->ra);
+	double cosc = sin (d0) * sin (d) + cos (d0) * cos (d) * cos (da);
+	p.x = ln_rad_to_deg (cos (d) * sin (da) / cosc);
+	p.y = ln_rad_to_deg ((cos (d0) * sin (d) - sin (d0) * cos (d) * cos (da)) / cosc);
+}
+
+static void deproject (const struct ln_equ_posn *c, const solverPoint &p, struct ln_equ_posn &r)
+{
+	double xi = ln_deg_to_rad (p.x);
+	double eta = ln_deg_to_rad (p.y);
+	double d0 = ln_deg_to_rad (c->dec);
+	double den = cos (d0) - eta * sin (d0);
+	r.ra = ln_range_degrees (c->ra + ln_rad_to_deg (atan2 (xi, den)));
+	r.dec = ln_rad_to_deg (atan2 (sin (d0) + eta * cos (d0), sqrt (xi * xi + den * den)));
+}
+
+static double distance (const solverPoint &a, const solverPoint &b)
+{
+	return sqrt ((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+}
+
+/**
+ * Build triangles from brightest points. Triangles are formed by a star
+ * and pairs of its brightest neighbours closer than maxSide.
+ */
+static void buildTriangles (std::vector <solverPoint> &pts, size_t num, double minSide, double maxSide, std::vector <solverTriangle> &triangles)
+{
+	if (num > pts.size ())
+		num = pts.size ();
+	for (size_t i = 0; i < num; i++)
+	{
+		std::vector <size_t> nb;
+		for (size_t j = 0; j < num && nb.size () < TRIANGLE_NEIGHBOURS; j++)
+		{
+			double d = distance (pts[i], pts[j]);
+			if (j != i && d >= minSide && d <= maxSide)
+				nb.push_back (j);
+		}
+		for (size_t j = 0; j < nb.size (); j++)
+		{
+			// each triangle is created only once, from its first vertex
+			if (nb[j] < i)
+				continue;
+			for (size_t k = j + 1; k < nb.size (); k++)
+			{
+				if (nb[k] < i)
+					continue;
+				int p[3] = {(int) i, (int) nb[j], (int) nb[k]};
+				// sides opposite to vertices
+				double s[3];
+				s[0] = distance (pts[p[1]], pts[p[2]]);
+				s[1] = distance (pts[p[0]], pts[p[2]]);
+				s[2] = distance (pts[p[0]], pts[p[1]]);
+				if (s[0] < minSide || s[0] > maxSide)
+					continue;
+				// sort by side length, longest first
+				for (int a = 0; a < 2; a++)
+				{
+					for (int b = 0; b < 2 - a; b++)
+					{
+						if (s[b] < s[b + 1])
+						{
+							std::swap (s[b], s[b + 1]);
+							std::swap (p[b], p[b + 1]);
+						}
+					}
+				}
+				solverTriangle t;
+				t.v[0] = p[0];
+				t.v[1] = p[1];
+				t.v[2] = p[2];
+				t.a = s[0];
+				t.u = s[1] / s[0];
+				t.w = s[2] / s[0];
+				// degenerated triangles do not provide reliable vertex order
+				if (t.u - t.w < RATIO_TOLERANCE || 1 - t.u < RATIO_TOLERANCE || t.w < 0.1)
+					continue;
+				const solverPoint &A = pts[p[0]], &B = pts[p[1]], &C = pts[p[2]];
+				t.ccw = ((B.x - A.x) * (C.y - A.y) - (B.y - A.y) * (C.x - A.x)) > 0;
+				t.key = ((int) (t.u * RATIO_BINS)) * (RATIO_BINS + 1) + (int) (t.w * RATIO_BINS);
+				triangles.push_back (t);
+			}
+		}
+	}
+}
+
+/**
+ * Fit similarity transformation (rotation, scale, shift, optional mirror)
+ * mapping points s to points d.
+ */
+static void fitSimilarity (const solverPoint *s, const solverPoint *d, int n, bool mirror, solverTransform &tr)
+{
+	double sx = 0, sy = 0, dx = 0, dy = 0;
+	for (int i = 0; i < n; i++)
+	{
+		sx += s[i].x;
+		sy += (mirror ? -s[i].y : s[i].y);
+		dx += d[i].x;
+		dy += d[i].y;
+	}
+	sx /= n;
+	sy /= n;
+	dx /= n;
+	dy /= n;
+
+	double num1 = 0, num2 = 0, den = 0;
+	for (int i = 0; i < n; i++)
+	{
+		double x = s[i].x - sx;
+		double y = (mirror ? -s[i].y : s[i].y) - sy;
+		double xi = d[i].x - dx;
+		double eta = d[i].y - dy;
+		num1 += x * xi + y * eta;
+		num2 += x * eta - y * xi;
+		den += x * x + y * y;
+	}
+	double a = num1 / den;
+	double b = num2 / den;
+
+	double my = mirror ? -1 : 1;
+	tr.m[0] = a;
+	tr.m[1] = -b * my;
+	tr.m[2] = b;
+	tr.m[3] = a * my;
+	tr.t[0] = dx - (a * sx - b * sy);
+	tr.t[1] = dy - (b * sx + a * sy);
+}
+
+/**
+ * Least squares fit of linear transformation.
+ *
+ * @return -1 if system is singular
+ */
+static int fitLinear (const std::vector <solverPoint> &s, const std::vector <solverPoint> &d, solverTransform &tr)
+{
+	size_t n = s.size ();
+	if (n < 3)
+		return -1;
+	// normal equations, same matrix for both coordinates
+	double sxx = 0, sxy = 0, syy = 0, sx = 0, sy = 0;
+	double bx[3] = {0, 0, 0}, by[3] = {0, 0, 0};
+	for (size_t i = 0; i < n; i++)
+	{
+		sxx += s[i].x * s[i].x;
+		sxy += s[i].x * s[i].y;
+		syy += s[i].y * s[i].y;
+		sx += s[i].x;
+		sy += s[i].y;
+		bx[0] += s[i].x * d[i].x;
+		bx[1] += s[i].y * d[i].x;
+		bx[2] += d[i].x;
+		by[0] += s[i].x * d[i].y;
+		by[1] += s[i].y * d[i].y;
+		by[2] += d[i].y;
+	}
+	double A[3][3] = {{sxx, sxy, sx}, {sxy, syy, sy}, {sx, sy, (double) n}};
+	double det = A[0][0] * (A[1][1] * A[2][2] - A[1][2] * A[2][1])
+		- A[0][1] * (A[1][0] * A[2][2] - A[1][2] * A[2][0])
+		+ A[0][2] * (A[1][0] * A[2][1] - A[1][1] * A[2][0]);
+	if (fabs (det) < 1e-12 * fabs (sxx * syy * n) || det == 0)
+		return -1;
+
+	// inverse by cofactors
+	double inv[3][3];
+	inv[0][0] = (A[1][1] * A[2][2] - A[1][2] * A[2][1]) / det;
+	inv[0][1] = (A[0][2] * A[2][1] - A[0][1] * A[2][2]) / det;
+	inv[0][2] = (A[0][1] * A[1][2] - A[0][2] * A[1][1]) / det;
+	inv[1][0] = (A[1][2] * A[2][0] - A[1][0] * A[2][2]) / det;
+	inv[1][1] = (A[0][0] * A[2][2] - A[0][2] * A[2][0]) / det;
+	inv[1][2] = (A[0][2] * A[1][0] - A[0][0] * A[1][2]) / det;
+	inv[2][0] = (A[1][0] * A[2][1] - A[1][1] * A[2][0]) / det;
+	inv[2][1] = (A[0][1] * A[2][0] - A[0][0] * A[2][1]) / det;
+	inv[2][2] = (A[0][0] * A[1][1] - A[0][1] * A[1][0]) / det;
+
+	double px[3], py[3];
+	for (int i = 0; i < 3; i++)
+	{
+		px[i] = inv[i][0] * bx[0] + inv[i][1] * bx[1] + inv[i][2] * bx[2];
+		py[i] = inv[i][0] * by[0] + inv[i][1] * by[1] + inv[i][2] * by[2];
+	}
+	tr.m[0] = px[0];
+	tr.m[1] = px[1];
+	tr.t[0] = px[2];
+	tr.m[2] = py[0];
+	tr.m[3] = py[1];
+	tr.t[1] = py[2];
+	return 0;
+}
+
+void SolveJob::buildGrid ()
+{
+	gridMin[0] = gridMin[1] = INFINITY;
+	double gridMax[2] = {-INFINITY, -INFINITY};
+	for (std::vector <solverPoint>::iterator iter = cat.begin (); iter != cat.end (); iter++)
+	{
+		gridMin[0] = std::min (gridMin[0], iter->x);
+		gridMin[1] = std::min (gridMin[1], iter->y);
+		gridMax[0] = std::max (gridMax[0], iter->x);
+		gridMax[1] = std::max (gridMax[1], iter->y);
+	}
+	gridCell = std::max (matchRadius, (gridMax[0] - gridMin[0] + gridMax[1] - gridMin[1]) / 1000.0);
+	gridSize[0] = (int) ((gridMax[0] - gridMin[0]) / gridCell) + 1;
+	gridSize[1] = (int) ((gridMax[1] - gridMin[1]) / gridCell) + 1;
+
+	std::vector <int> cells (cat.size ());
+	gridStart.assign (gridSize[0] * gridSize[1] + 1, 0);
+	for (size_t i = 0; i < cat.size (); i++)
+	{
+		int cx = (int) ((cat[i].x - gridMin[0]) / gridCell);
+		int cy = (int) ((cat[i].y - gridMin[1]) / gridCell);
+		cells[i] = cy * gridSize[0] + cx;
+		gridStart[cells[i] + 1]++;
+	}
+	for (size_t c = 1; c < gridStart.size (); c++)
+		gridStart[c] += gridStart[c - 1];
+	gridStars.resize (cat.size ());
+	std::vector <size_t> fill (gridStart.begin (), gridStart.end () - 1);
+	for (size_t i = 0; i < cat.size (); i++)
+		gridStars[fill[cells[i]]++] = i;
+}
+
+int SolveJob::nearest (const solverPoint &p, double &dist)
+{
+	int cx = (int) floor ((p.x - gridMin[0]) / gridCell);
+	int cy = (int) floor ((p.y - gridMin[1]) / gridCell);
+	int ret = -1;
+	dist = matchRadius;
+	for (int y = std::max (cy - 1, 0); y <= std::min (cy + 1, gridSize[1] - 1); y++)
+	{
+		for (int x = std::max (cx - 1, 0); x <= std::min (cx + 1, gridSize[0] - 1); x++)
+		{
+			int c = y * gridSize[0] + x;
+			for (size_t i = gridStart[c]; i < gridStart[c + 1]; i++)
+			{
+				double d = distance (p, cat[gridStars[i]]);
+				if (d < dist)
+				{
+					dist = d;
+					ret = gridStars[i];
+				}
+			}
+		}
+	}
+	return ret;
+}
+
+int SolveJob::countMatches (const solverTransform &tr)
+{
+	int matched = 0;
+	size_t n = std::min (img.size (), (size_t) VERIFY_STARS);
+	for (size_t i = 0; i < n; i++)
+	{
+		solverPoint p;
+		double d;
+		tr.apply (img[i], p);
+		if (nearest (p, d) >= 0)
+			matched++;
+	}
+	return matched;
+}
+
+void SolveJob::verify (int job)
+{
+	solverTransform &b = best[job];
+	b.matched = 0;
+
+	for (size_t it = job; it < imgTriangles.size (); it += VERIFY_JOBS)
+	{
+		pthread_mutex_lock (&mutex);
+		bool f = found;
+		pthread_mutex_unlock (&mutex);
+		if (f)
+			return;
+
+		const solverTriangle &ti = imgTriangles[it];
+		int iu = (int) (ti.u * RATIO_BINS);
+		int iw = (int) (ti.w * RATIO_BINS);
+		for (int u = std::max (iu - 1, 0); u <= std::min (iu + 1, RATIO_BINS); u++)
+		{
+			for (int w = std::max (iw - 1, 0); w <= std::min (iw + 1, RATIO_BINS); w++)
+			{
+				int key = u * (RATIO_BINS + 1) + w;
+				for (size_t c = keyStart[key]; c < keyStart[key + 1]; c++)
+				{
+					const solverTriangle &tc = catTriangles[c];
+					if (fabs (tc.u - ti.u) > RATIO_TOLERANCE || fabs (tc.w - ti.w) > RATIO_TOLERANCE)
+						continue;
+					double s = tc.a / ti.a;
+					if (fabs (s / scale - 1) > scaleTolerance)
+						continue;
+
+					solverPoint sp[3], dp[3];
+					for (int v = 0; v < 3; v++)
+					{
+						sp[v] = img[ti.v[v]];
+						dp[v] = cat[tc.v[v]];
+					}
+					solverTransform tr;
+					fitSimilarity (sp, dp, 3, ti.ccw != tc.ccw, tr);
+					tr.matched = countMatches (tr);
+					if (tr.matched > b.matched)
+					{
+						b = tr;
+						if (b.matched >= goodMatches)
+						{
+							pthread_mutex_lock (&mutex);
+							found = true;
+							pthread_mutex_unlock (&mutex);
+							return;
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+PlateSolver::PlateSolver (rts2catd::CatFile *_catalogue)
+{
+	catalogue = _catalogue;
+	scale = NAN;
+	scaleTolerance = 0.05;
+	searchRadius = 0.5;
+	magLimit = 99;
+	minMatches = 8;
+	threads = 0;
+}
+
+/**
+ * Match sources to catalogue with given transformation and refit it.
+ *
+ * @return number of matched stars, -1 if fit failed
+ */
+static int refine (SolveJob &job, solverTransform &tr, double &rms)
+{
+	std::vector <solverPoint> s, d;
+	std::vector <bool> used (job.cat.size (), false);
+	size_t n = std::min (job.img.size (), (size_t) FIT_STARS);
+	for (size_t i = 0; i < n; i++)
+	{
+		solverPoint p;
+		double dist;
+		tr.apply (job.img[i], p);
+		int c = job.nearest (p, dist);
+		if (c < 0 || used[c])
+			continue;
+		used[c] = true;
+		s.push_back (job.img[i]);
+		d.push_back (job.cat[c]);
+	}
+	if (fitLinear (s, d, tr))
+		return -1;
+
+	double sum = 0;
+	for (size_t i = 0; i < s.size (); i++)
+	{
+		solverPoint p;
+		tr.apply (s[i], p);
+		sum += (p.x - d[i].x) * (p.x - d[i].x) + (p.y - d[i].y) * (p.y - d[i].y);
+	}
+	rms = sqrt (sum / s.size ()) * 3600.0;
+	return s.size ();
+}
+
+int PlateSolver::solve (std::vector <stardata> &sources, long width, long height, struct ln_equ_posn *prior, double crpix1, double crpix2, plateSolution &sol)
+{
+	if (catalogue == NULL || isnan (scale) || scale <= 0 || sources.size () < 3)
+		return -1;
+
+	SolveJob job;
+	job.scale = scale / 3600.0;
+	job.scaleTolerance = scaleTolerance;
+	job.minMatches = minMatches;
+
+	// sources sorted by flux, relative to the reference pixel
+	std::vector <stardata> srt (sources);
+	std::sort (srt.begin (), srt.end (), compareStarFlux ());
+	for (std::vector <stardata>::iterator iter = srt.begin (); iter != srt.end (); iter++)
+	{
+		solverPoint p;
+		p.x = iter->X - crpix1;
+		p.y = iter->Y - crpix2;
+		job.img.push_back (p);
+	}
+
+	// catalogue stars around the prior position
+	double fieldRadius = sqrt ((double) width * width + (double) height * height) / 2.0 * job.scale;
+	double coneRadius = fieldRadius + searchRadius;
+	size_t catNum = (size_t) ceil (VERIFY_STARS * 2 * (coneRadius * coneRadius) / (fieldRadius * fieldRadius));
+	if (catNum > MAX_CATALOGUE)
+		catNum = MAX_CATALOGUE;
+
+	struct ln_equ_posn centre = *prior;
+	std::vector <const struct catfile_star *> stars;
+	catalogue->coneSearch (&centre, coneRadius, magLimit, catNum, stars);
+	if (stars.size () < 3)
+		return -1;
+	for (std::vector <const struct catfile_star *>::iterator iter = stars.begin (); iter != stars.end (); iter++)
+	{
+		solverPoint p;
+		project (&centre, (*iter)->ra, (*iter)->dec, p);
+		job.cat.push_back (p);
+	}
+
+	// match radius - 3 pixels, at least 2 arcsec
+	job.matchRadius = std::max (3 * job.scale, 2 / 3600.0);
+	job.goodMatches = std::max (2 * minMatches, (int) std::min (job.img.size (), (size_t) VERIFY_STARS) / 2);
+	job.buildGrid ();
+
+	// triangles are limited to field radius, so they fit inside the image
+	double maxSide = fieldRadius / job.scale;
+	buildTriangles (job.img, TRIANGLE_STARS, MIN_SIDE, maxSide, job.imgTriangles);
+	// catalogue covers larger area than the image, use more stars
+	size_t catTriangleStars = (size_t) ceil (TRIANGLE_STARS * (coneRadius * coneRadius) / (fieldRadius * fieldRadius));
+	buildTriangles (job.cat, catTriangleStars, MIN_SIDE * job.scale, fieldRadius, job.catTriangles);
+	// catalogue side lengths are in degrees, image in pixels
+	std::sort (job.catTriangles.begin (), job.catTriangles.end (), compareTriangleKey ());
+
+	int keys = (RATIO_BINS + 1) * (RATIO_BINS + 1);
+	job.keyStart.assign (keys + 1, 0);
+	for (std::vector <solverTriangle>::iterator iter = job.catTriangles.begin (); iter != job.catTriangles.end (); iter++)
+		job.keyStart[iter->key + 1]++;
+	for (int k = 1; k <= keys; k++)
+		job.keyStart[k] += job.keyStart[k - 1];
+
+	job.best.resize (VERIFY_JOBS);
+	job.found = false;
+	pthread_mutex_init (&job.mutex, NULL);
+	parallelFor (&job, &SolveJob::verify, VERIFY_JOBS, parallelThreads (threads));
+	pthread_mutex_destroy (&job.mutex);
+
+	solverTransform tr;
+	tr.matched = 0;
+	for (std::vector <solverTransform>::iterator iter = job.best.begin (); iter != job.best.end (); iter++)
+	{
+		if (iter->matched > tr.matched)
+			tr = *iter;
+	}
+	if (tr.matched < minMatches)
+		return -1;
+
+	double rms = NAN;
+	int matched = 0;
+	for (int it = 0; it < 3; it++)
+	{
+		matched = refine (job, tr, rms);
+		if (matched < minMatches)
+			return -1;
+	}
+
+	// move tangent point to the reference pixel, and refit there with
+	// fainter stars from the field
+	solverPoint zero = {0, 0}, rp;
+	tr.apply (zero, rp);
+	deproject (&centre, rp, centre);
+	stars.clear ();
+	catalogue->coneSearch (&centre, fieldRadius, magLimit, MAX_CATALOGUE, stars);
+	job.cat.resize (stars.size ());
+	for (size_t i = 0; i < stars.size (); i++)
+		project (&centre, stars[i]->ra, stars[i]->dec, job.cat[i]);
+	job.buildGrid ();
+	tr.t[0] = tr.t[1] = 0;
+	for (int it = 0; it < 2; it++)
+	{
+		matched = refine (job, tr, rms);
+		if (matched < minMatches)
+			return -1;
+	}
+	tr.apply (zero, rp);
+
+	deproject (&centre, rp, sol.crval);
+	sol.crpix[0] = crpix1;
+	sol.crpix[1] = crpix2;
+	for (int i = 0; i < 4; i++)
+		sol.cd[i] = tr.m[i];
+	double det = tr.m[0] * tr.m[3] - tr.m[1] * tr.m[2];
+	sol.scale = sqrt (fabs (det)) * 3600.0;
+	sol.rotation = ln_range_degrees (ln_rad_to_deg (atan2 (-tr.m[1], tr.m[3])));
+	sol.flip = det > 0;
+	sol.matched = matched;
+	sol.rms = rms;
+	return 0;
+}
@@ -0,0 +1,454 @@
+/*
+ * Synthetic sky image generator.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2fits/skygenerator.h"
+#include "rts2fits/parallel.h"
+#include "imghdr.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <limits>
+
+// rows generated in one job
+#define BAND_ROWS           32
+
+// size of normal deviates table; must be power of 2
+#define NORMALS_BITS        16
+
+// PSF is stamped up to this number of sigmas
+#define PSF_SIGMAS          4.0
+
+using namespace rts2image;
+
+/**
+ * xorshift64* generator. Fast enough to feed the noise table lookups.
+ */
+class skyRandom
+{
+	public:
+		skyRandom (uint64_t seed)
+		{
+			// splitmix64 to spread bad seeds
+			seed += 0x9e3779b97f4a7c15ULL;
+			seed = (seed ^ (seed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			seed = (seed ^ (seed >> 27)) * 0x94d049bb133111ebULL;
+			state = seed ^ (seed >> 31);
+			if (state == 0)
+				state = 1;
+		}
+
+		uint64_t next ()
+		{
+			state ^= state >> 12;
+			state ^= state << 25;
+			state ^= state >> 27;
+			return state * 0x2545f4914f6cdd1dULL;
+		}
+
+		/**
+		 * Uniform in [0,1).
+		 */
+		double uniform () { return (next () >> 11) * (1.0 / 9007199254740992.0); }
+
+	private:
+		uint64_t state;
+};
+
+struct skyCosmic
+{
+	double x;
+	double y;
+	double dx;
+	double dy;
+	int length;
+	float energy;
+};
+
+static bool compareStarY (const skyStar &a, const skyStar &b)
+{
+	return a.y < b.y;
+}
+
+/**
+ * Limits of the output type. Values are compared in double and limits are
+ * assigned directly, as float to integer conversion of out of range values
+ * is undefined (e.g. maximum of uint32_t rounds up in float).
+ */
+template <typename dt> void clampLimits (dt &lo, dt &hi)
+{
+	if (std::numeric_limits <dt>::is_integer)
+	{
+		lo = std::numeric_limits <dt>::min ();
+		hi = std::numeric_limits <dt>::max ();
+	}
+	else
+	{
+		lo = -std::numeric_limits <float>::max ();
+		hi = std::numeric_limits <float>::max ();
+	}
+}
+
+/**
+ * Renders bands of the frame.
+ */
+class SkyJob
+{
+	public:
+		long width;
+		long height;
+		float bias;
+		float sky;
+		float gradientX;
+		float gradientY;
+		float readNoise2;
+		float invGain;
+		float saturation;
+		double sigma;
+		int radius;
+		uint64_t seed;
+
+		const std::vector <skyStar> *stars;
+		std::vector <skyCosmic> cosmics;
+		const float *normals;
+
+		void *data;
+		int dataType;
+
+		void band (int b)
+		{
+			long y0 = b * BAND_ROWS;
+			long y1 = std::min (y0 + BAND_ROWS, height);
+			std::vector <float> sig (width * (y1 - y0));
+
+			// sky with gradient
+			for (long y = y0; y < y1; y++)
+			{
+				float *s = &(sig[(y - y0) * width]);
+				float v = sky + gradientY * (y - height / 2.0) - gradientX * (width / 2.0);
+				for (long x = 0; x < width; x++)
+					s[x] = v + gradientX * x;
+			}
+
+			stampStars (sig, y0, y1);
+			stampCosmics (sig, y0, y1);
+
+			switch (dataType)
+			{
+				case RTS2_DATA_BYTE:
+					noise <unsigned char> (sig, y0, y1, b);
+					break;
+				case RTS2_DATA_SBYTE:
+					noise <signed char> (sig, y0, y1, b);
+					break;
+				case RTS2_DATA_SHORT:
+					noise <int16_t> (sig, y0, y1, b);
+					break;
+				case RTS2_DATA_USHORT:
+					noise <uint16_t> (sig, y0, y1, b);
+					break;
+				case RTS2_DATA_LONG:
+					noise <int32_t> (sig, y0, y1, b);
+					break;
+				case RTS2_DATA_ULONG:
+					noise <uint32_t> (sig, y0, y1, b);
+					break;
+				case RTS2_DATA_LONGLONG:
+					noise <int64_t> (sig, y0, y1, b);
+					break;
+				case RTS2_DATA_FLOAT:
+					noise <float> (sig, y0, y1, b);
+					break;
+				case RTS2_DATA_DOUBLE:
+					noise <double> (sig, y0, y1, b);
+					break;
+			}
+		}
+
+	private:
+		/**
+		 * Stamps stars touching the band. PSF is separable, so it is
+		 * evaluated once per star for each axis.
+		 */
+		void stampStars (std::vector <float> &sig, long y0, long y1)
+		{
+			skyStar low;
+			low.y = y0 - radius - 1;
+			std::vector <skyStar>::const_iterator iter = std::lower_bound (stars->begin (), stars->end (), low, compareStarY);
+
+			int size = 2 * radius + 1;
+			std::vector <float> px (size);
+			std::vector <float> py (size);
+			double n = 1 / (2 * sigma * sigma);
+
+			for (; iter != stars->end () && iter->y < y1 + radius + 1; iter++)
+			{
+				long cx = (long) floor (iter->x + 0.5);
+				long cy = (long) floor (iter->y + 0.5);
+				long xs = std::max (cx - radius, 0L);
+				long xe = std::min (cx + radius + 1, width);
+				long ys = std::max (cy - radius, y0);
+				long ye = std::min (cy + radius + 1, y1);
+				if (xs >= xe || ys >= ye)
+					continue;
+
+				for (long x = xs; x < xe; x++)
+				{
+					double d = x - iter->x;
+					px[x - xs] = exp (-d * d * n);
+				}
+				float f = iter->flux * n / M_PI;
+				for (long y = ys; y < ye; y++)
+				{
+					double d = y - iter->y;
+					py[y - ys] = f * exp (-d * d * n);
+				}
+
+				for (long y = ys; y < ye; y++)
+				{
+					float *s = &(sig[(y - y0) * width]);
+					float fy = py[y - ys];
+					for (long x = xs; x < xe; x++)
+						s[x] += fy * px[x - xs];
+				}
+			}
+		}
+
+		void stampCosmics (std::vector <float> &sig, long y0, long y1)
+		{
+			for (std::vector <skyCosmic>::iterator iter = cosmics.begin (); iter != cosmics.end (); iter++)
+			{
+				for (int i = 0; i < iter->length; i++)
+				{
+					long x = (long) floor (iter->x + i * iter->dx + 0.5);
+					long y = (long) floor (iter->y + i * iter->dy + 0.5);
+					if (x >= 0 && x < width && y >= y0 && y < y1)
+						sig[(y - y0) * width + x] += iter->energy;
+				}
+			}
+		}
+
+		/**
+		 * Adds bias and noise, clamps and converts to the output type.
+		 */
+		template <typename dt> void noise (std::vector <float> &sig, long y0, long y1, int b)
+		{
+			dt lo, hi;
+			clampLimits <dt> (lo, hi);
+			if (!isnan (saturation) && saturation < (double) hi && saturation > (double) lo)
+				hi = (dt) saturation;
+			double dlo = lo;
+			double dhi = hi;
+			// round integers to nearest
+			float r = std::numeric_limits <dt>::is_integer ? 0.5 : 0;
+			const uint64_t mask = (1 << NORMALS_BITS) - 1;
+
+			skyRandom rnd (seed ^ ((uint64_t) b << 32));
+
+			dt *d = ((dt *) data) + y0 * width;
+			long len = (y1 - y0) * width;
+			const float *s = &(sig[0]);
+			long i = 0;
+			for (; i + 4 <= len; i += 4)
+			{
+				uint64_t rn = rnd.next ();
+				for (int j = 0; j < 4; j++)
+				{
+					float v = s[i + j];
+					float var = readNoise2 + (v > 0 ? v * invGain : 0);
+					v += bias + sqrtf (var) * normals[(rn >> (16 * j)) & mask] + r;
+					if (v <= dlo)
+						d[i + j] = lo;
+					else if (v >= dhi)
+						d[i + j] = hi;
+					else
+						d[i + j] = (dt) v;
+				}
+			}
+			uint64_t rn = rnd.next ();
+			for (; i < len; i++)
+			{
+				float v = s[i];
+				float var = readNoise2 + (v > 0 ? v * invGain : 0);
+				v += bias + sqrtf (var) * normals[rn & mask] + r;
+				rn >>= 16;
+				if (v <= dlo)
+					d[i] = lo;
+				else if (v >= dhi)
+					d[i] = hi;
+				else
+					d[i] = (dt) v;
+			}
+		}
+};
+
+SkyGenerator::SkyGenerator ()
+{
+	bias = 1000;
+	readNoise = 5;
+	gain = 1;
+	sky = 200;
+	gradientX = 0;
+	gradientY = 0;
+	fwhm = 3;
+	cosmics = 0;
+	saturation = NAN;
+	threads = 0;
+
+	// Box-Muller deviates; the table is large enough not to show its structure in noise statistics
+	int n = 1 << NORMALS_BITS;
+	normals.resize (n);
+	skyRandom rnd (n);
+	for (int i = 0; i < n; i += 2)
+	{
+		double u1 = 1 - rnd.uniform ();
+		double u2 = rnd.uniform ();
+		double m = sqrt (-2 * log (u1));
+		normals[i] = m * cos (2 * M_PI * u2);
+		normals[i + 1] = m * sin (2 * M_PI * u2);
+	}
+}
+
+void SkyGenerator::addStar (double x, double y, double flux)
+{
+	skyStar s;
+	s.x = x;
+	s.y = y;
+	s.flux = flux;
+	stars.push_back (s);
+}
+
+void SkyGenerator::addRandomStars (int num, long width, long height, double maxFlux, uint64_t seed)
+{
+	skyRandom rnd (seed);
+	for (int i = 0; i < num; i++)
+	{
+		double x = rnd.uniform () * width;
+		double y = rnd.uniform () * height;
+		// N(<m) grows ~ 10^(0.6 m), so flux is distributed as u^(1/1.5)
+		double u = 1 - rnd.uniform ();
+		addStar (x, y, maxFlux * pow (u, 1 / 1.5));
+	}
+}
+
+int SkyGenerator::addCatalogueStars (rts2catd::CatFile *catalogue, struct ln_equ_posn *centre, long width, long height, double scale, double rotation, double zeroPoint, double exposure, float magLimit)
+{
+	// radius of circle enclosing the frame
+	double radius = sqrt ((double) width * width + (double) height * height) / 2.0 * scale / 3600.0;
+	std::vector <const struct catfile_star *> cat;
+	catalogue->coneSearch (centre, radius, magLimit, std::numeric_limits <size_t>::max (), cat);
+
+	double d0 = ln_deg_to_rad (centre->dec);
+	double cr = cos (ln_deg_to_rad (rotation));
+	double sr = sin (ln_deg_to_rad (rotation));
+	double s = 3600.0 / scale;
+
+	int added = 0;
+	for (std::vector <const struct catfile_star *>::iterator iter = cat.begin (); iter != cat.end (); iter++)
+	{
+		double da = ln_deg_to_rad ((*iter)->ra - centre->ra);
+		double d = ln_deg_to_rad ((*iter)->dec);
+		double cosc = sin (d0) * sin (d) + cos (d0) * cos (d) * cos (da);
+		if (cosc <= 0)
+			continue;
+		// standard coordinates, in degrees
+		double xi = ln_rad_to_deg (cos (d) * sin (da) / cosc);
+		double eta = ln_rad_to_deg ((cos (d0) * sin (d) - sin (d0) * cos (d) * cos (da)) / cosc);
+		// east is left, north up
+		double x = width / 2.0 - s * (xi * cr + eta * sr);
+		double y = height / 2.0 + s * (eta * cr - xi * sr);
+		if (x < 0 || x >= width || y < 0 || y >= height)
+			continue;
+		addStar (x, y, exposure * pow (10, -0.4 * ((*iter)->mag - zeroPoint)));
+		added++;
+	}
+	return added;
+}
+
+int SkyGenerator::generate (void *data, int dataType, long width, long height, uint64_t seed)
+{
+	switch (dataType)
+	{
+		case RTS2_DATA_BYTE:
+		case RTS2_DATA_SBYTE:
+		case RTS2_DATA_SHORT:
+		case RTS2_DATA_USHORT:
+		case RTS2_DATA_LONG:
+		case RTS2_DATA_ULONG:
+		case RTS2_DATA_LONGLONG:
+		case RTS2_DATA_FLOAT:
+		case RTS2_DATA_DOUBLE:
+			break;
+		default:
+			return -1;
+	}
+
+	std::sort (stars.begin (), stars.end (), compareStarY);
+
+	SkyJob job;
+	job.width = width;
+	job.height = height;
+	job.bias = bias;
+	job.sky = sky;
+	job.gradientX = gradientX;
+	job.gradientY = gradientY;
+	job.readNoise2 = readNoise * readNoise;
+	job.invGain = gain > 0 ? 1 / gain : 0;
+	job.saturation = saturation;
+	job.sigma = std::max (fwhm, 0.5) / (2 * sqrt (2 * log (2)));
+	job.radius = (int) ceil (PSF_SIGMAS * job.sigma);
+	job.seed = seed;
+	job.stars = &stars;
+	job.normals = &(normals[0]);
+	job.data = data;
+	job.dataType = dataType;
+
+	// tracks are generated up front, so bands see the same cosmics
+	skyRandom rnd (seed ^ 0xc05a1c5ULL);
+	for (int i = 0; i < cosmics; i++)
+	{
+		skyCosmic c;
+		c.x = rnd.uniform () * width;
+		c.y = rnd.uniform () * height;
+		double a = rnd.uniform () * 2 * M_PI;
+		c.dx = cos (a);
+		c.dy = sin (a);
+		// most hits are short and steep, some graze along the chip
+		c.length = 1 + (int) (20 * pow (rnd.uniform (), 3));
+		c.energy = (500 + 4500 * rnd.uniform ()) / (gain > 0 ? gain : 1);
+		job.cosmics.push_back (c);
+	}
+
+	parallelFor (&job, &SkyJob::band, (height + BAND_ROWS - 1) / BAND_ROWS, parallelThreads (threads));
+	return 0;
+}
+
+int SkyGenerator::generateField (void *data, int dataType, long width, long height, rts2catd::CatFile *catalogue, struct ln_equ_posn *centre, double scale, double rotation, double zeroPoint, double exposure, float magLimit, int randomStars, double maxFlux, uint64_t seed)
+{
+	clearStars ();
+	if (catalogue)
+		addCatalogueStars (catalogue, centre, width, height, scale, rotation, zeroPoint, exposure, magLimit);
+	else
+		// the same seed keeps stars at the same positions
+		addRandomStars (randomStars, width, height, maxFlux, 1);
+
+	if (generate (data, dataType, width, height, seed))
+		return -1;
+	return stars.size ();
+}
@@ -0,0 +1,705 @@
+/*
+ * Native source extraction.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2fits/sourceextractor.h"
+#include "rts2fits/image.h"
+#include "rts2fits/parallel.h"
+
+#include "imghdr.h"
+
+#include <math.h>
+#include <stdint.h>
+
+#include <algorithm>
+
+// FWHM / sigma of Gaussian profile
+#define FWHM_SIGMA         2.35482
+
+// maximal number of windowed centroid iterations
+#define WIN_ITERATIONS     16
+
+using namespace rts2image;
+
+namespace rts2image
+{
+
+/**
+ * Run of pixels above threshold on single row.
+ */
+struct sourceRun
+{
+	int y;
+	int x0;
+	int x1;
+	bool saturated;
+};
+
+/**
+ * Pixels and parameters shared by all threads during extraction.
+ */
+class ExtractionJob
+{
+	public:
+		const void *data;
+		int dataType;
+		long width;
+		long height;
+
+		int meshSize;
+		double threshold;
+		int minArea;
+		double aperture;
+		double gain;
+		double saturation;
+		bool filter;
+
+		// background subtracted image
+		std::vector <float> pix;
+
+		// pixels above saturation level, empty if saturation is not checked
+		std::vector <char> saturated;
+
+		// background mesh
+		int meshX;
+		int meshY;
+		std::vector <float> meshBack;
+		std::vector <float> meshRms;
+
+		// runs above threshold for each band of rows
+		int bandRows;
+		std::vector < std::vector <sourceRun> > bandRuns;
+
+		// runs of all objects, first run of object i is objects[i]
+		std::vector <sourceRun> runs;
+		std::vector <size_t> objects;
+
+		std::vector <stardata> results;
+		std::vector <char> valid;
+
+		double rmsAt (double x, double y);
+
+		void convertRows (int band);
+		void estimateTile (int tile);
+		void subtractBand (int band);
+		void thresholdBand (int band);
+		void measureObject (int obj);
+};
+
+}
+
+template <typename dt> void convertData (const dt *data, float *pix, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		pix[i] = (float) data[i];
+}
+
+/**
+ * Interpolate mesh value at given pixel position.
+ */
+static double meshValue (const std::vector <float> &mesh, int meshX, int meshY, int meshSize, double x, double y)
+{
+	double mx = x / meshSize - 0.5;
+	double my = y / meshSize - 0.5;
+	if (mx < 0)
+		mx = 0;
+	if (my < 0)
+		my = 0;
+	if (mx > meshX - 1)
+		mx = meshX - 1;
+	if (my > meshY - 1)
+		my = meshY - 1;
+
+	int ix = (int) mx;
+	int iy = (int) my;
+	int ix1 = ix + 1 < meshX ? ix + 1 : ix;
+	int iy1 = iy + 1 < meshY ? iy + 1 : iy;
+	double fx = mx - ix;
+	double fy = my - iy;
+
+	return (1 - fy) * ((1 - fx) * mesh[iy * meshX + ix] + fx * mesh[iy * meshX + ix1])
+		+ fy * ((1 - fx) * mesh[iy1 * meshX + ix] + fx * mesh[iy1 * meshX + ix1]);
+}
+
+double ExtractionJob::rmsAt (double x, double y)
+{
+	return meshValue (meshRms, meshX, meshY, meshSize, x, y);
+}
+
+void ExtractionJob::convertRows (int band)
+{
+	size_t start = (size_t) band * bandRows * width;
+	size_t end = (size_t) (band + 1) * bandRows * width;
+	if (end > (size_t) width * height)
+		end = (size_t) width * height;
+	size_t n = end - start;
+
+	switch (dataType)
+	{
+		case RTS2_DATA_BYTE:
+			convertData ((const uint8_t *) data + start, &pix[start], n);
+			break;
+		case RTS2_DATA_SBYTE:
+			convertData ((const int8_t *) data + start, &pix[start], n);
+			break;
+		case RTS2_DATA_SHORT:
+			convertData ((const int16_t *) data + start, &pix[start], n);
+			break;
+		case RTS2_DATA_USHORT:
+			convertData ((const uint16_t *) data + start, &pix[start], n);
+			break;
+		case RTS2_DATA_LONG:
+			convertData ((const int32_t *) data + start, &pix[start], n);
+			break;
+		case RTS2_DATA_ULONG:
+			convertData ((const uint32_t *) data + start, &pix[start], n);
+			break;
+		case RTS2_DATA_LONGLONG:
+			convertData ((const int64_t *) data + start, &pix[start], n);
+			break;
+		case RTS2_DATA_FLOAT:
+			convertData ((const float *) data + start, &pix[start], n);
+			break;
+		case RTS2_DATA_DOUBLE:
+			convertData ((const double *) data + start, &pix[start], n);
+			break;
+	}
+}
+
+void ExtractionJob::estimateTile (int tile)
+{
+	int tx = tile % meshX;
+	int ty = tile / meshX;
+
+	long x0 = tx * meshSize;
+	long y0 = ty * meshSize;
+	long x1 = std::min (x0 + meshSize, width);
+	long y1 = std::min (y0 + meshSize, height);
+
+	std::vector <float> vals;
+	vals.reserve ((x1 - x0) * (y1 - y0));
+	for (long y = y0; y < y1; y++)
+	{
+		const float *p = &pix[y * width];
+		for (long x = x0; x < x1; x++)
+		{
+			if (!isnan (p[x]))
+				vals.push_back (p[x]);
+		}
+	}
+
+	if (vals.size () < 3)
+	{
+		meshBack[tile] = NAN;
+		meshRms[tile] = NAN;
+		return;
+	}
+
+	// iterative 3 sigma clipping around median
+	double lo = -INFINITY;
+	double hi = INFINITY;
+	double mean = 0, stdev = 0, med = 0;
+	size_t n = vals.size ();
+	for (int it = 0; it < 10; it++)
+	{
+		size_t k = 0;
+		double sum = 0, sum2 = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			if (vals[i] >= lo && vals[i] <= hi)
+			{
+				vals[k++] = vals[i];
+				sum += vals[i];
+				sum2 += (double) vals[i] * vals[i];
+			}
+		}
+		if (k < 3)
+			break;
+		bool converged = (k == n && it > 0);
+		n = k;
+		mean = sum / n;
+		stdev = sqrt (fabs (sum2 / n - mean * mean));
+
+		std::nth_element (vals.begin (), vals.begin () + n / 2, vals.begin () + n);
+		med = vals[n / 2];
+
+		if (converged || stdev == 0)
+			break;
+		lo = med - 3 * stdev;
+		hi = med + 3 * stdev;
+	}
+
+	// SExtractor mode estimate, median for crowded fields
+	if (stdev > 0 && fabs (mean - med) / stdev < 0.3)
+		meshBack[tile] = 2.5 * med - 1.5 * mean;
+	else
+		meshBack[tile] = med;
+	meshRms[tile] = stdev;
+}
+
+void ExtractionJob::subtractBand (int band)
+{
+	long y0 = band * bandRows;
+	long y1 = std::min (y0 + bandRows, height);
+
+	for (long y = y0; y < y1; y++)
+	{
+		float *p = &pix[y * width];
+		for (long x = 0; x < width; x++)
+		{
+			if (!saturated.empty ())
+				saturated[y * width + x] = p[x] >= saturation;
+			// NAN pixels are never part of the source
+			if (isnan (p[x]))
+				p[x] = 0;
+			else
+				p[x] -= meshValue (meshBack, meshX, meshY, meshSize, x + 0.5, y + 0.5);
+		}
+	}
+}
+
+void ExtractionJob::thresholdBand (int band)
+{
+	std::vector <sourceRun> &br = bandRuns[band];
+	long y0 = band * bandRows;
+	long y1 = std::min (y0 + bandRows, height);
+
+	std::vector <float> val (width);
+
+	for (long y = y0; y < y1; y++)
+	{
+		const float *p = &pix[y * width];
+		if (filter)
+		{
+			// 3x3 pyramidal kernel (SExtractor default.conv), edges are clamped
+			const float *pu = y > 0 ? p - width : p;
+			const float *pd = y < height - 1 ? p + width : p;
+			for (long x = 0; x < width; x++)
+			{
+				long xl = x > 0 ? x - 1 : x;
+				long xr = x < width - 1 ? x + 1 : x;
+				val[x] = (pu[xl] + 2 * pu[x] + pu[xr]
+					+ 2 * p[xl] + 4 * p[x] + 2 * p[xr]
+					+ pd[xl] + 2 * pd[x] + pd[xr]) / 16.0;
+			}
+		}
+		else
+		{
+			std::copy (p, p + width, val.begin ());
+		}
+
+		sourceRun r;
+		r.y = y;
+		r.x0 = -1;
+		r.saturated = false;
+		for (long x = 0; x < width; x++)
+		{
+			if (val[x] > threshold * rmsAt (x + 0.5, y + 0.5))
+			{
+				if (r.x0 < 0)
+				{
+					r.x0 = x;
+					r.saturated = false;
+				}
+				if (!saturated.empty () && saturated[y * width + x])
+					r.saturated = true;
+			}
+			else if (r.x0 >= 0)
+			{
+				r.x1 = x - 1;
+				br.push_back (r);
+				r.x0 = -1;
+			}
+		}
+		if (r.x0 >= 0)
+		{
+			r.x1 = width - 1;
+			br.push_back (r);
+		}
+	}
+}
+
+void ExtractionJob::measureObject (int obj)
+{
+	size_t first = objects[obj];
+	size_t last = objects[obj + 1];
+
+	stardata &sd = results[obj];
+	sd.flags = 0;
+
+	// isophotal moments
+	double sum = 0, sx = 0, sy = 0, sxx = 0, syy = 0;
+	for (size_t r = first; r < last; r++)
+	{
+		const sourceRun &run = runs[r];
+		if (run.saturated)
+			sd.flags |= SOURCE_SATURATED;
+		if (run.x0 == 0 || run.x1 == width - 1 || run.y == 0 || run.y == height - 1)
+			sd.flags |= SOURCE_TRUNCATED;
+		const float *p = &pix[run.y * width];
+		for (int x = run.x0; x <= run.x1; x++)
+		{
+			sum += p[x];
+			sx += p[x] * x;
+			sy += p[x] * run.y;
+			sxx += p[x] * x * x;
+			syy += p[x] * run.y * run.y;
+		}
+	}
+	if (sum <= 0)
+	{
+		valid[obj] = false;
+		return;
+	}
+
+	double xc = sx / sum;
+	double yc = sy / sum;
+	double var = (sxx / sum - xc * xc + syy / sum - yc * yc) / 2.0;
+	if (var < 1 / 12.0)
+		var = 1 / 12.0;
+
+	// windowed centroid, Gaussian window with isophotal FWHM
+	double sigw = sqrt (var);
+	if (sigw < 0.5)
+		sigw = 0.5;
+	double sig2 = sigw * sigw;
+	double winr = 4 * sigw;
+	double wvar = NAN;
+
+	for (int it = 0; it < WIN_ITERATIONS; it++)
+	{
+		long wx0 = std::max ((long) floor (xc - winr), 0L);
+		long wx1 = std::min ((long) ceil (xc + winr), width - 1);
+		long wy0 = std::max ((long) floor (yc - winr), 0L);
+		long wy1 = std::min ((long) ceil (yc + winr), height - 1);
+
+		double ws = 0, wdx = 0, wdy = 0, wd2 = 0;
+		for (long y = wy0; y <= wy1; y++)
+		{
+			const float *p = &pix[y * width];
+			double dy = y - yc;
+			for (long x = wx0; x <= wx1; x++)
+			{
+				double dx = x - xc;
+				double r2 = dx * dx + dy * dy;
+				if (r2 > winr * winr)
+					continue;
+				double w = exp (-r2 / (2 * sig2)) * p[x];
+				ws += w;
+				wdx += w * dx;
+				wdy += w * dy;
+				wd2 += w * r2;
+			}
+		}
+		if (ws <= 0)
+			break;
+		double shx = 2 * wdx / ws;
+		double shy = 2 * wdy / ws;
+		wvar = wd2 / ws / 2.0;
+		// do not let the window run away from the isophotal centroid
+		if (fabs (shx) > winr || fabs (shy) > winr)
+			break;
+		xc += shx;
+		yc += shy;
+		if (shx * shx + shy * shy < 4e-8)
+			break;
+	}
+
+	// deconvolve weighted variance from window
+	double srcvar = var;
+	if (!isnan (wvar) && wvar > 0 && wvar < sig2)
+		srcvar = wvar * sig2 / (sig2 - wvar);
+
+	// circular aperture
+	double flux = 0;
+	double noise = 0;
+	long ax0 = (long) floor (xc - aperture);
+	long ax1 = (long) ceil (xc + aperture);
+	long ay0 = (long) floor (yc - aperture);
+	long ay1 = (long) ceil (yc + aperture);
+	if (ax0 < 0 || ay0 < 0 || ax1 >= width || ay1 >= height)
+		sd.flags |= SOURCE_APER_INCOMPLETE;
+	ax0 = std::max (ax0, 0L);
+	ay0 = std::max (ay0, 0L);
+	ax1 = std::min (ax1, width - 1);
+	ay1 = std::min (ay1, height - 1);
+
+	for (long y = ay0; y <= ay1; y++)
+	{
+		const float *p = &pix[y * width];
+		for (long x = ax0; x <= ax1; x++)
+		{
+			if ((x - xc) * (x - xc) + (y - yc) * (y - yc) > aperture * aperture)
+				continue;
+			flux += p[x];
+			noise++;
+		}
+	}
+	double rms = rmsAt (xc + 0.5, yc + 0.5);
+	noise *= rms * rms;
+	if (gain > 0 && flux > 0)
+		noise += flux / gain;
+
+	sd.X = xc + 1;
+	sd.Y = yc + 1;
+	sd.F = flux;
+	sd.Fe = sqrt (noise);
+	sd.fwhm = FWHM_SIGMA * sqrt (srcvar);
+	valid[obj] = true;
+}
+
+static size_t findRoot (std::vector <size_t> &parent, size_t i)
+{
+	while (parent[i] != i)
+	{
+		parent[i] = parent[parent[i]];
+		i = parent[i];
+	}
+	return i;
+}
+
+class compareFlux
+{
+	public:
+		bool operator () (const stardata &a, const stardata &b) const
+		{
+			return a.F > b.F;
+		}
+};
+
+SourceExtractor::SourceExtractor ()
+{
+	meshSize = 64;
+	threshold = 1.5;
+	minArea = 5;
+	aperture = 5;
+	gain = 0;
+	saturation = NAN;
+	filter = true;
+	threads = 0;
+
+	background = NAN;
+	backgroundRms = NAN;
+}
+
+SourceExtractor::~SourceExtractor ()
+{
+}
+
+int SourceExtractor::extract (const void *data, int dataType, long width, long height, std::vector <stardata> &sources)
+{
+	switch (dataType)
+	{
+		case RTS2_DATA_BYTE:
+		case RTS2_DATA_SBYTE:
+		case RTS2_DATA_SHORT:
+		case RTS2_DATA_USHORT:
+		case RTS2_DATA_LONG:
+		case RTS2_DATA_ULONG:
+		case RTS2_DATA_LONGLONG:
+		case RTS2_DATA_FLOAT:
+		case RTS2_DATA_DOUBLE:
+			break;
+		default:
+			return -1;
+	}
+	if (data == NULL || width <= 0 || height <= 0 || meshSize <= 0)
+		return -1;
+
+	int nth = parallelThreads (threads);
+
+	ExtractionJob job;
+	job.data = data;
+	job.dataType = dataType;
+	job.width = width;
+	job.height = height;
+	job.meshSize = meshSize;
+	job.threshold = threshold;
+	job.minArea = minArea;
+	job.aperture = aperture;
+	job.gain = gain;
+	job.saturation = saturation;
+	job.filter = filter;
+
+	job.pix.resize ((size_t) width * height);
+
+	// bands of rows, aligned to mesh tiles
+	job.bandRows = meshSize;
+	int bands = (height + job.bandRows - 1) / job.bandRows;
+
+	parallelFor (&job, &ExtractionJob::convertRows, bands, nth);
+
+	job.meshX = (width + meshSize - 1) / meshSize;
+	job.meshY = (height + meshSize - 1) / meshSize;
+	int tiles = job.meshX * job.meshY;
+	job.meshBack.resize (tiles);
+	job.meshRms.resize (tiles);
+
+	parallelFor (&job, &ExtractionJob::estimateTile, tiles, nth);
+
+	// global medians, used to fill tiles without valid pixels
+	std::vector <float> gb, gr;
+	for (int i = 0; i < tiles; i++)
+	{
+		if (!isnan (job.meshBack[i]))
+		{
+			gb.push_back (job.meshBack[i]);
+			gr.push_back (job.meshRms[i]);
+		}
+	}
+	if (gb.empty ())
+		return 0;
+	std::nth_element (gb.begin (), gb.begin () + gb.size () / 2, gb.end ());
+	std::nth_element (gr.begin (), gr.begin () + gr.size () / 2, gr.end ());
+	background = gb[gb.size () / 2];
+	backgroundRms = gr[gr.size () / 2];
+
+	// 3x3 median filter of the mesh removes tiles affected by bright sources
+	std::vector <float> fb (tiles), fr (tiles);
+	for (int ty = 0; ty < job.meshY; ty++)
+	{
+		for (int tx = 0; tx < job.meshX; tx++)
+		{
+			std::vector <float> nb, nr;
+			for (int j = std::max (ty - 1, 0); j <= std::min (ty + 1, job.meshY - 1); j++)
+			{
+				for (int i = std::max (tx - 1, 0); i <= std::min (tx + 1, job.meshX - 1); i++)
+				{
+					if (isnan (job.meshBack[j * job.meshX + i]))
+						continue;
+					nb.push_back (job.meshBack[j * job.meshX + i]);
+					nr.push_back (job.meshRms[j * job.meshX + i]);
+				}
+			}
+			int t = ty * job.meshX + tx;
+			if (nb.empty ())
+			{
+				fb[t] = background;
+				fr[t] = backgroundRms;
+				continue;
+			}
+			std::nth_element (nb.begin (), nb.begin () + nb.size () / 2, nb.end ());
+			std::nth_element (nr.begin (), nr.begin () + nr.size () / 2, nr.end ());
+			fb[t] = nb[nb.size () / 2];
+			fr[t] = nr[nr.size () / 2];
+		}
+	}
+	job.meshBack.swap (fb);
+	job.meshRms.swap (fr);
+
+	if (!isnan (saturation))
+		job.saturated.resize ((size_t) width * height);
+	parallelFor (&job, &ExtractionJob::subtractBand, bands, nth);
+
+	job.bandRuns.resize (bands);
+	parallelFor (&job, &ExtractionJob::thresholdBand, bands, nth);
+
+	std::vector <sourceRun> allRuns;
+	for (int b = 0; b < bands; b++)
+		allRuns.insert (allRuns.end (), job.bandRuns[b].begin (), job.bandRuns[b].end ());
+	job.bandRuns.clear ();
+
+	// 8-connected components over runs; runs are sorted by row and column
+	std::vector <size_t> parent (allRuns.size ());
+	for (size_t i = 0; i < allRuns.size (); i++)
+		parent[i] = i;
+
+	size_t prevStart = 0, prevEnd = 0;
+	for (size_t i = 0; i < allRuns.size (); )
+	{
+		int y = allRuns[i].y;
+		size_t rowEnd = i;
+		while (rowEnd < allRuns.size () && allRuns[rowEnd].y == y)
+			rowEnd++;
+
+		if (prevEnd > prevStart && allRuns[prevStart].y == y - 1)
+		{
+			size_t p = prevStart;
+			for (size_t r = i; r < rowEnd; r++)
+			{
+				while (p < prevEnd && allRuns[p].x1 < allRuns[r].x0 - 1)
+					p++;
+				for (size_t q = p; q < prevEnd && allRuns[q].x0 <= allRuns[r].x1 + 1; q++)
+				{
+					size_t a = findRoot (parent, r);
+					size_t b = findRoot (parent, q);
+					if (a != b)
+						parent[std::max (a, b)] = std::min (a, b);
+				}
+			}
+		}
+		prevStart = i;
+		prevEnd = rowEnd;
+		i = rowEnd;
+	}
+
+	// group runs by component, drop small components
+	std::vector <size_t> area (allRuns.size (), 0);
+	std::vector <size_t> roots (allRuns.size ());
+	for (size_t i = 0; i < allRuns.size (); i++)
+	{
+		roots[i] = findRoot (parent, i);
+		area[roots[i]] += allRuns[i].x1 - allRuns[i].x0 + 1;
+	}
+
+	std::vector <size_t> objIndex (allRuns.size (), (size_t) -1);
+	std::vector <size_t> objRuns;
+	for (size_t i = 0; i < allRuns.size (); i++)
+	{
+		if (roots[i] == i && area[i] >= (size_t) minArea)
+		{
+			objIndex[i] = objRuns.size ();
+			objRuns.push_back (0);
+		}
+	}
+	for (size_t i = 0; i < allRuns.size (); i++)
+	{
+		if (objIndex[roots[i]] != (size_t) -1)
+			objRuns[objIndex[roots[i]]]++;
+	}
+
+	job.objects.resize (objRuns.size () + 1);
+	job.objects[0] = 0;
+	for (size_t o = 0; o < objRuns.size (); o++)
+		job.objects[o + 1] = job.objects[o] + objRuns[o];
+
+	job.runs.resize (job.objects.back ());
+	std::vector <size_t> fill (job.objects.begin (), job.objects.end () - 1);
+	for (size_t i = 0; i < allRuns.size (); i++)
+	{
+		size_t o = objIndex[roots[i]];
+		if (o != (size_t) -1)
+			job.runs[fill[o]++] = allRuns[i];
+	}
+
+	int nobj = objRuns.size ();
+	job.results.resize (nobj);
+	job.valid.resize (nobj);
+
+	parallelFor (&job, &ExtractionJob::measureObject, nobj, nth);
+
+	size_t before = sources.size ();
+	for (int o = 0; o < nobj; o++)
+	{
+		if (job.valid[o])
+			sources.push_back (job.results[o]);
+	}
+	std::sort (sources.begin () + before, sources.end (), compareFlux ());
+
+	return sources.size () - before;
+}
@@ -67,13 +67,39 @@ void AsyncAPI::postEvent (rts2core::Event *event)
 
 AsyncValueAPI::AsyncValueAPI (JSONRequest *_req, XmlRpc::XmlRpcServerConnection *_source, XmlRpc::HttpParams *params): AsyncAPI (_req, NULL, _source, false) 
 {
+	batch = false;
+	batchInterval = NAN;
+	lastFlush = 0;
+	resumeSeq = 0;
+	journalSeq = 0;
+	fullSnapshot = false;
+	master = NULL;
+
 	// chunked response
 	req->sendAsyncDataHeader (0, _source, "application/json");
 
 	for (XmlRpc::HttpParams::iterator iter = params->begin (); iter != params->end (); iter++)
 	{
+		// subscription parameters
+		if (strcmp (iter->getName (), "_rate") == 0)
+		{
+			batch = true;
+			double rate = atof (iter->getValue ());
+			if (rate > 0)
+				batchInterval = 1 / rate;
+		}
+		else if (strcmp (iter->getName (), "_seq") == 0)
+		{
+			batch = true;
+			resumeSeq = strtoul (iter->getValue (), NULL, 10);
+		}
+		else if (strcmp (iter->getName (), "_instance") == 0)
+		{
+			batch = true;
+			resumeInstance = iter->getValue ();
+		}
 	  	// handle special values - states,..
-		if (strcmp (iter->getValue (), "__S__") == 0)
+		else if (strcmp (iter->getValue (), "__S__") == 0)
 		{
 			states.push_back (AsyncState (iter->getName ()));
 		}
@@ -87,6 +113,14 @@ AsyncValueAPI::AsyncValueAPI (JSONRequest *_req, XmlRpc::XmlRpcServerConnection
 			values.push_back (std::pair <std::string, std::string> (iter->getName (), iter->getValue ()));
 		}
 	}
+
+	if (batch)
+	{
+		// 5 batches per second by default
+		if (isnan (batchInterval))
+			batchInterval = 0.2;
+		req->getServer ()->getValueJournal ()->enable ();
+	}
 }
 
 void AsyncValueAPI::stateChanged (rts2core::Connection *_conn)
@@ -108,6 +142,13 @@ void AsyncValueAPI::valueChanged (rts2core::Connection *_conn, rts2core::Value *
 	if (source == NULL)
 		return;
 
+	if (batch)
+	{
+		// value change is already in the journal
+		processJournal (req->getServer ()->getValueJournal ());
+		return;
+	}
+
 	for (std::vector <std::string>::iterator iter = devices.begin (); iter != devices.end (); iter++)
 	{
 		if (*iter == _conn->getName ())
@@ -128,7 +169,8 @@ void AsyncValueAPI::valueChanged (rts2core::Connection *_conn, rts2core::Value *
 
 void AsyncValueAPI::sendAll (rts2core::Device *device)
 {
-	rts2core::Value *val;
+	master = device;
+
 	rts2core::Connection *_conn;
 	for (std::list <AsyncState>::iterator iter = states.begin (); iter != states.end (); iter++)
 	{
@@ -144,6 +186,130 @@ void AsyncValueAPI::sendAll (rts2core::Device *device)
 			sendState (iter, _conn);
 		}
 	}
+
+	if (batch)
+	{
+		ValueJournal *journal = req->getServer ()->getValueJournal ();
+		// sequence numbers from other server instance are meaningless
+		if (resumeInstance == journal->getInstance () && journal->canResume (resumeSeq))
+		{
+			// client already knows values, send only what it missed
+			journalSeq = resumeSeq + 1;
+			processJournal (journal);
+		}
+		else
+		{
+			journalSeq = journal->lastSeq () + 1;
+			sendAllValues (device);
+			fullSnapshot = true;
+		}
+		flush ();
+		return;
+	}
+
+	sendAllValues (device);
+}
+
+int AsyncValueAPI::idle ()
+{
+	if (batch && source)
+	{
+		double nf = nextFlush ();
+		if (!isnan (nf) && nf <= getNow ())
+			flush ();
+	}
+	return AsyncAPI::idle ();
+}
+
+double AsyncValueAPI::nextFlush ()
+{
+	if (batch == false || source == NULL || (pendingValues.empty () && pendingStates.empty () && fullSnapshot == false))
+		return NAN;
+	return lastFlush + batchInterval;
+}
+
+bool AsyncValueAPI::isSubscribed (const std::string &device, const char *valueName)
+{
+	for (std::vector <std::string>::iterator iter = devices.begin (); iter != devices.end (); iter++)
+	{
+		if (*iter == device)
+			return true;
+	}
+	for (std::vector <std::pair <std::string, std::string> >::iterator iter = values.begin (); iter != values.end (); iter++)
+	{
+		if (iter->first == device && strcasecmp (iter->second.c_str (), valueName) == 0)
+			return true;
+	}
+	return false;
+}
+
+void AsyncValueAPI::sendState (std::list <AsyncState>::iterator astate, rts2core::Connection *_conn)
+{
+	if (astate->value == _conn->getState () && astate->status_start == _conn->getProgressStart () && astate->status_expected_end == _conn->getProgressEnd ())
+		return;
+
+	astate->value = _conn->getState ();
+	astate->status_start = _conn->getProgressStart ();
+	astate->status_expected_end = _conn->getProgressEnd ();
+
+	const char *name = (_conn->getOtherType () == DEVICE_TYPE_SERVERD ? "centrald" : _conn->getName ());
+
+	std::ostringstream os;
+	os << std::fixed << "{";
+	if (batch == false)
+		os << "\"d\":\"" << name << "\",\"t\":" << getNow () << ",";
+	os << "\"s\":" << _conn->getState ();
+	if (!isnan (_conn->getProgressStart ()))
+		os << ",\"sf\":" << _conn->getProgressStart ();
+	if (!isnan (_conn->getProgressEnd ()))
+		os << ",\"st\":" << _conn->getProgressEnd ();
+	os << "}";
+
+	if (batch)
+		pendingStates[name] = os.str ();
+	else
+		source->sendChunked (os.str ());
+}
+
+void AsyncValueAPI::sendValue (const std::string &device, rts2core::Value *_value)
+{
+	std::ostringstream os;
+	if (batch)
+	{
+		os << std::fixed;
+		rts2json::jsonValue (_value, true, os);
+		pendingValues[std::pair <std::string, std::string> (device, _value->getName ())] = std::pair <unsigned long, std::string> (0, os.str ());
+		return;
+	}
+	os << std::fixed << "{\"d\":\"" << device << "\",\"t\":" << getNow () << ",\"v\":{";
+	rts2json::jsonValue (_value, true, os);
+	os << "}}";
+	if (source == NULL || source->sendChunked (os.str ()) == false)
+		asyncFinished ();
+}
+
+void AsyncValueAPI::processJournal (ValueJournal *journal)
+{
+	if (journalSeq < journal->firstSeq ())
+	{
+		// journal was overrun before changes were processed
+		journalSeq = journal->lastSeq () + 1;
+		pendingValues.clear ();
+		fullSnapshot = true;
+		return;
+	}
+	for (; journalSeq <= journal->lastSeq (); journalSeq++)
+	{
+		const ValueChangeRecord *rec = journal->find (journalSeq);
+		if (isSubscribed (rec->device, rec->name.c_str ()))
+			pendingValues[std::pair <std::string, std::string> (rec->device, rec->name)] = std::pair <unsigned long, std::string> (journalSeq, std::string ());
+	}
+}
+
+void AsyncValueAPI::sendAllValues (rts2core::Device *device)
+{
+	rts2core::Value *val;
+	rts2core::Connection *_conn;
 	for (std::vector <std::string>::iterator iter = devices.begin (); iter != devices.end (); iter++)
 	{
 		if (*iter == "centrald")
@@ -182,32 +348,93 @@ void AsyncValueAPI::sendAll (rts2core::Device *device)
 	}
 }
 
-void AsyncValueAPI::sendState (std::list <AsyncState>::iterator astate, rts2core::Connection *_conn)
+void AsyncValueAPI::flush ()
 {
-	if (astate->value == _conn->getState () && astate->status_start == _conn->getProgressStart () && astate->status_expected_end == _conn->getProgressEnd ())
+	if (source == NULL)
 		return;
 
-	astate->value = _conn->getState ();
-	astate->status_start = _conn->getProgressStart ();
-	astate->status_expected_end = _conn->getProgressEnd ();
+	ValueJournal *journal = req->getServer ()->getValueJournal ();
+	processJournal (journal);
+
+	std::map <std::pair <std::string, std::string>, std::pair <unsigned long, std::string> >::iterator iter;
+
+	// records can be removed from the journal between the change and the flush
+	for (iter = pendingValues.begin (); iter != pendingValues.end (); iter++)
+	{
+		if (iter->second.first != 0 && journal->find (iter->second.first) == NULL)
+		{
+			pendingValues.clear ();
+			fullSnapshot = true;
+			break;
+		}
+	}
+
+	if (fullSnapshot && pendingValues.empty () && master != NULL)
+	{
+		try
+		{
+			sendAllValues (master);
+		}
+		catch (XmlRpc::JSONException &ex)
+		{
+			logStream (MESSAGE_WARNING) << "cannot resend values to push client: " << ex.getMessage () << sendLog;
+			asyncFinished ();
+			return;
+		}
+	}
 
 	std::ostringstream os;
-	os << std::fixed << "{\"d\":\"" << (_conn->getOtherType () == DEVICE_TYPE_SERVERD ? "centrald" : _conn->getName ()) << "\",\"s\":" << _conn->getState () << ",\"t\":" << getNow ();
-	if (!isnan (_conn->getProgressStart ()))
-		os << ",\"sf\":" << _conn->getProgressStart ();
-	if (!isnan (_conn->getProgressEnd ()))
-		os << ",\"st\":" << _conn->getProgressEnd ();
+	os << std::fixed << "{\"seq\":" << (journalSeq - 1) << ",\"instance\":\"" << journal->getInstance () << "\",\"t\":" << getNow ();
+	if (fullSnapshot)
+		os << ",\"full\":true";
+
+	if (!pendingStates.empty ())
+	{
+		os << ",\"s\":{";
+		for (std::map <std::string, std::string>::iterator siter = pendingStates.begin (); siter != pendingStates.end (); siter++)
+		{
+			if (siter != pendingStates.begin ())
+				os << ",";
+			os << "\"" << siter->first << "\":" << siter->second;
+		}
+		os << "}";
+	}
+
+	if (!pendingValues.empty ())
+	{
+		os << ",\"v\":{";
+		// values are sorted by device name
+		std::string lastDevice;
+		for (iter = pendingValues.begin (); iter != pendingValues.end (); iter++)
+		{
+			if (iter == pendingValues.begin ())
+			{
+				os << "\"" << iter->first.first << "\":{";
+			}
+			else if (iter->first.first != lastDevice)
+			{
+				os << "},\"" << iter->first.first << "\":{";
+			}
+			else
+			{
+				os << ",";
+			}
+			lastDevice = iter->first.first;
+			if (iter->second.first == 0)
+				os << iter->second.second;
+			else
+				os << journal->find (iter->second.first)->json;
+		}
+		os << "}}";
+	}
 	os << "}";
-	source->sendChunked (os.str ());
-}
 
-void AsyncValueAPI::sendValue (const std::string &device, rts2core::Value *_value)
-{
-	std::ostringstream os;
-	os << std::fixed << "{\"d\":\"" << device << "\",\"t\":" << getNow () << ",\"v\":{";
-	rts2json::jsonValue (_value, true, os);
-	os << "}}";
-	if (source == NULL || source->sendChunked (os.str ()) == false)
+	pendingValues.clear ();
+	pendingStates.clear ();
+	fullSnapshot = false;
+	lastFlush = getNow ();
+
+	if (source->sendChunked (os.str ()) == false)
 		asyncFinished ();
 }
 
@@ -0,0 +1,128 @@
+/*
+ * Bright Star catalogue index.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2json/bsc.h"
+
+#include <algorithm>
+#include <math.h>
+
+// about 3.7 deg cells, 3 stars per cell on average
+#define BSC_NSIDE    16
+
+using namespace rts2json;
+
+BSCIndex *BSCIndex::pInstance = NULL;
+
+static bool magCompare (const struct bsc_record *s1, const struct bsc_record *s2)
+{
+	return s1->mag < s2->mag;
+}
+
+BSCIndex *BSCIndex::instance ()
+{
+	if (!pInstance)
+		pInstance = new BSCIndex ();
+	return pInstance;
+}
+
+BSCIndex::BSCIndex ():healpix (BSC_NSIDE), byMag (), byCell (), cellStart (), hrzCache ()
+{
+	hrzMinute = -1;
+	hrzMag = NAN;
+	hrzLng = hrzLat = NAN;
+
+	for (struct bsc_record *star = bsc; star->hrn >= 0; star++)
+		byMag.push_back (star);
+
+	std::stable_sort (byMag.begin (), byMag.end (), magCompare);
+
+	// count sort by cell, keeping magnitude order inside cells
+	std::vector <long> cells (byMag.size ());
+	cellStart.assign (healpix.getNpix () + 1, 0);
+	for (size_t i = 0; i < byMag.size (); i++)
+	{
+		cells[i] = healpix.ang2pix (byMag[i]->ra, byMag[i]->dec);
+		cellStart[cells[i] + 1]++;
+	}
+	for (long c = 0; c < healpix.getNpix (); c++)
+		cellStart[c + 1] += cellStart[c];
+
+	std::vector <size_t> pos (cellStart.begin (), cellStart.end () - 1);
+	byCell.resize (byMag.size ());
+	for (size_t i = 0; i < byMag.size (); i++)
+		byCell[pos[cells[i]]++] = byMag[i];
+}
+
+void BSCIndex::coneSearch (double ra, double dec, double radius, float maxmag, std::vector <const struct bsc_record *> &result)
+{
+	std::vector <long> cells;
+	healpix.queryDisc (ra, dec, radius, -1, cells);
+
+	struct ln_equ_posn centre, pos;
+	centre.ra = ra;
+	centre.dec = dec;
+
+	result.clear ();
+	for (std::vector <long>::iterator iter = cells.begin (); iter != cells.end (); iter++)
+	{
+		for (size_t i = cellStart[*iter]; i < cellStart[*iter + 1]; i++)
+		{
+			const struct bsc_record *star = byCell[i];
+			// stars in cell are sorted by magnitude
+			if (star->mag > maxmag)
+				break;
+			pos.ra = star->ra;
+			pos.dec = star->dec;
+			if (ln_get_angular_separation (&centre, &pos) <= radius)
+				result.push_back (star);
+		}
+	}
+
+	std::stable_sort (result.begin (), result.end (), magCompare);
+}
+
+const std::vector <BSCHorizontal> &BSCIndex::horizontal (double JD, struct ln_lnlat_posn *observer, float maxmag)
+{
+	long minute = (long) floor (JD * 1440);
+	if (minute == hrzMinute && maxmag <= hrzMag && observer->lng == hrzLng && observer->lat == hrzLat)
+		return hrzCache;
+
+	hrzCache.clear ();
+
+	// sidereal time is the same for all stars
+	double sidereal = ln_get_apparent_sidereal_time (JD);
+
+	struct ln_equ_posn pos;
+	struct ln_hrz_posn hrz;
+
+	for (std::vector <const struct bsc_record *>::iterator iter = byMag.begin (); iter != byMag.end () && (*iter)->mag <= maxmag; iter++)
+	{
+		pos.ra = (*iter)->ra;
+		pos.dec = (*iter)->dec;
+		ln_get_hrz_from_equ_sidereal_time (&pos, observer, sidereal, &hrz);
+		hrzCache.push_back (BSCHorizontal (*iter, hrz));
+	}
+
+	hrzMinute = minute;
+	hrzMag = maxmag;
+	hrzLng = observer->lng;
+	hrzLat = observer->lat;
+
+	return hrzCache;
+}
@@ -0,0 +1,9124 @@
+/* 
+ * Bright Star catalogue data.
+ * Copyright (C) 2013 Petr Kubanek, Institute of Physics <kubanek@fzu.cz>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2json/bsc.h"
+
+/**
+ * Zero terminated star list. Downloaded
+ * from ftp://cdsarc.u-strasbg.fr/cats/V/50/,
+ * purged of 14 objects without mag value.
+ */
+struct bsc_record bsc[] ={
+{   1, NULL, 1.29125, 45.2291666666667,  6.70},
+{   2, NULL, 1.26583333333333, -0.503055555555556,  6.29},
+{   3, "33    Psc", 1.33375, -5.7075,  4.61},
+{   4, "86    Peg", 1.425, 13.3961111111111,  5.51},
+{   5, NULL, 1.56666666666667, 58.4366666666667,  5.96},
+{   6, NULL, 1.57916666666667, -49.075,  5.70},
+{   7, "10    Cas", 1.61041666666667, 64.1961111111111,  5.59},
+{   8, NULL, 1.65333333333333, 29.0213888888889,  6.13},
+{   9, NULL, 1.70875, -23.1075,  6.18},
+{  10, NULL, 1.82583333333333, -17.3863888888889,  6.19},
+{  11, NULL, 1.93375, -2.54888888888889,  6.43},
+{  12, NULL, 1.945, -22.5088888888889,  5.94},
+{  13, NULL, 2.01458333333333, -33.5294444444444,  5.68},
+{  14, NULL, 2.05041666666667, -2.44777777777778,  6.07},
+{  15, "21Alp And", 2.09708333333333, 29.0905555555556,  2.06},
+{  16, NULL, 2.0725, -8.82388888888889,  5.99},
+{  17, NULL, 2.17083333333333, 36.6266666666667,  6.19},
+{  18, NULL, 2.13916666666667, -17.5775,  6.06},
+{  19, NULL, 2.2175, 25.4627777777778,  6.23},
+{  20, NULL, 2.33416666666667, 79.7147222222222,  6.01},
+{  21, "11Bet Cas", 2.29458333333333, 59.1497222222222,  2.27},
+{  22, "87    Peg", 2.26, 18.2119444444444,  5.53},
+{  23, NULL, 2.26, -54.0019444444444,  6.33},
+{  24, "Kap1Scl", 2.3375, -27.9877777777778,  5.42},
+{  25, "Eps Phe", 2.35291666666667, -45.7475,  3.88},
+{  26, "34    Psc", 2.50958333333333, 11.1455555555556,  5.51},
+{  27, "22    And", 2.58041666666667, 46.0722222222222,  5.03},
+{  28, NULL, 2.62375, 57.1655555555556,  6.74},
+{  29, NULL, 2.57833333333333, -5.24861111111111,  5.84},
+{  30, "Gam3Oct", 2.50875, -82.2238888888889,  5.28},
+{  31, NULL, 2.67833333333333, -12.58,  5.85},
+{  32, NULL, 2.66083333333333, -73.2244444444444,  6.64},
+{  33, "6    Cet", 2.81625, -15.4680555555556,  4.89},
+{  34, "Kap2Scl", 2.89333333333333, -27.7997222222222,  5.41},
+{  35, "The Scl", 2.93333333333333, -35.1330555555556,  5.25},
+{  36, NULL, 2.99625, 48.1525,  6.16},
+{  37, NULL, 3.04166666666667, -17.9383333333333,  5.25},
+{  38, NULL, 3.21, 37.6933333333333,  6.73},
+{  39, "88Gam Peg", 3.30916666666667, 15.1836111111111,  2.83},
+{  40, NULL, 3.35, 26.9872222222222,  6.30},
+{  41, "23    And", 3.37833333333333, 41.0352777777778,  5.72},
+{  42, NULL, 3.42541666666667, -26.0219444444444,  5.94},
+{  43, NULL, 3.43416666666667, -26.2847222222222,  6.31},
+{  44, NULL, 3.50958333333333, 33.2061111111111,  6.25},
+{  45, "89Chi Peg", 3.65083333333333, 20.2066666666667,  4.80},
+{  46, NULL, 3.615, -7.78055555555556,  5.12},
+{  47, NULL, 3.33083333333333, -84.9941666666667,  5.77},
+{  48, "7    Cet", 3.66, -18.9327777777778,  4.44},
+{  49, NULL, 3.73375, 22.2841666666667,  6.24},
+{  50, "35    Psc", 3.745, 8.82083333333333,  5.79},
+{  51, NULL, 3.72708333333333, -9.56972222222222,  5.75},
+{  52, NULL, 3.77916666666667, 31.5358333333333,  6.45},
+{  53, NULL, 3.79416666666667, 27.2830555555556,  6.35},
+{  54, NULL, 3.7425, -34.9044444444444,  6.17},
+{  55, NULL, 4.05833333333333, 76.9508333333333,  6.35},
+{  56, NULL, 4.09, 43.5947222222222,  6.15},
+{  57, NULL, 4.03708333333333, -31.4463888888889,  5.67},
+{  58, NULL, 3.98, -75.9113888888889,  6.49},
+{  59, "36    Psc", 4.14208333333333, 8.24,  6.11},
+{  60, NULL, 4.23791666666667, 61.5333333333333,  5.74},
+{  61, NULL, 4.17708333333333, -20.2105555555556,  6.47},
+{  62, NULL, 4.28791666666667, 47.9475,  5.89},
+{  63, "24The And", 4.27291666666667, 38.6816666666667,  4.61},
+{  64, NULL, 4.20416666666667, -78.7805555555556,  6.77},
+{  65, NULL, 4.42916666666667, 51.4330555555556,  6.14},
+{  66, NULL, 4.38583333333333, -19.0511111111111,  6.45},
+{  67, NULL, 4.44875, 1.68888888888889,  6.17},
+{  68, "25Sig And", 4.58208333333333, 36.7852777777778,  4.52},
+{  69, NULL, 4.57166666666667, 11.2058333333333,  6.05},
+{  70, "26    And", 4.67541666666667, 43.7911111111111,  6.11},
+{  71, NULL, 4.65958333333333, 31.5172222222222,  5.87},
+{  72, NULL, 4.67416666666667, -8.05277777777778,  6.46},
+{  73, NULL, 4.6775, -43.2352777777778,  6.33},
+{  74, "8Iot Cet", 4.85708333333333, -8.82388888888889,  3.56},
+{  75, NULL, 4.92333333333333, 40.7297222222222,  6.33},
+{  76, NULL, 5.02166666666667, 48.8652777777778,  6.52},
+{  77, "Zet Tuc", 5.01791666666667, -64.8747222222222,  4.23},
+{  78, NULL, 5.10166666666667, 30.9358333333333,  5.90},
+{  79, NULL, 5.18958333333333, 32.9113888888889,  5.79},
+{  80, "41    Psc", 5.14958333333333, 8.19027777777778,  5.37},
+{  81, NULL, 5.22708333333333, 10.9769444444444,  6.56},
+{  82, "27Rho And", 5.28041666666667, 37.9686111111111,  5.18},
+{  83, "Pi  Tuc", 5.1625, -69.625,  5.51},
+{  84, "Iot Scl", 5.38, -28.9816666666667,  5.18},
+{  85, NULL, 5.44291666666667, -20.0577777777778,  5.12},
+{  86, "42    Psc", 5.60625, 13.4825,  6.23},
+{  87, NULL, 5.36916666666667, -77.4269444444444,  5.97},
+{  88, "9    Cet", 5.71583333333333, -12.2094444444444,  6.39},
+{  89, NULL, 5.8025, -31.0361111111111,  6.55},
+{  90, NULL, 6.00833333333333, 38.5772222222222,  7.39},
+{  91, NULL, 6.065, 52.02,  5.57},
+{  93, "12    Cas", 6.19791666666667, 61.8311111111111,  5.40},
+{  94, NULL, 6.12375, -2.21916666666667,  6.07},
+{  96, NULL, 6.27666666666667, 53.0469444444444,  5.74},
+{  97, "44    Psc", 6.35083333333333, 1.93972222222222,  5.77},
+{  98, "Bet Hyi", 6.43791666666667, -77.2541666666667,  2.80},
+{  99, "Alp Phe", 6.57083333333333, -42.3061111111111,  2.39},
+{ 100, "Kap Phe", 6.55083333333333, -43.68,  3.94},
+{ 101, "10    Cet", 6.65583333333333, -0.0497222222222222,  6.19},
+{ 102, NULL, 6.81125, -25.5472222222222,  5.98},
+{ 103, "47    Psc", 7.01208333333333, 17.8930555555556,  5.06},
+{ 104, NULL, 7.05708333333333, 44.3944444444444,  5.17},
+{ 105, "Eta Scl", 6.98208333333333, -33.0072222222222,  4.81},
+{ 106, "48    Psc", 7.05291666666667, 16.445,  6.06},
+{ 107, NULL, 7.08375, 10.1897222222222,  6.04},
+{ 108, NULL, 7.08791666666667, -20.335,  6.43},
+{ 109, NULL, 7.11, -39.915,  5.43},
+{ 110, NULL, 7.23583333333333, 36.9,  6.26},
+{ 111, NULL, 7.17958333333333, -50.5327777777778,  6.26},
+{ 112, NULL, 7.72916666666667, 77.0194444444444,  6.21},
+{ 113, NULL, 7.58291666666667, 59.9772222222222,  5.94},
+{ 114, "28    And", 7.53041666666667, 29.7516666666667,  5.23},
+{ 115, NULL, 7.46625, -14.8641666666667,  6.14},
+{ 116, NULL, 7.45375, -32.1166666666667,  6.57},
+{ 117, "12    Cet", 7.51, -3.95722222222222,  5.72},
+{ 118, NULL, 7.59458333333333, -23.7877777777778,  5.19},
+{ 119, NULL, 7.61583333333333, -40.9394444444444,  6.19},
+{ 120, NULL, 7.60875, -48.215,  5.69},
+{ 121, "13    Cas", 7.85541666666667, 66.5194444444444,  6.18},
+{ 122, NULL, 7.85666666666667, 33.5816666666667,  5.87},
+{ 123, "14Lam Cas", 7.94333333333333, 54.5222222222222,  4.73},
+{ 124, NULL, 7.92166666666667, 52.8394444444444,  5.60},
+{ 125, "Lam1Phe", 7.85416666666667, -48.8036111111111,  4.77},
+{ 126, "Bet1Tuc", 7.88625, -62.9580555555556,  4.37},
+{ 127, "Bet2Tuc", 7.89, -62.9658333333333,  4.54},
+{ 128, NULL, 8.11166666666667, 43.4947222222222,  6.70},
+{ 129, NULL, 8.33041666666667, 70.9816666666667,  6.42},
+{ 130, "15Kap Cas", 8.25, 62.9316666666667,  4.16},
+{ 131, "52    Psc", 8.14791666666667, 20.2944444444444,  5.38},
+{ 132, "51    Psc", 8.09916666666667, 6.95555555555556,  5.67},
+{ 133, NULL, 8.14375, 27.5805555555556,  6.67},
+{ 134, NULL, 8.20458333333333, 28.2802777777778,  6.30},
+{ 135, NULL, 8.29333333333333, 54.895,  5.93},
+{ 136, "Bet3Tuc", 8.1825, -63.0311111111111,  5.09},
+{ 137, "16    Cas", 8.60375, 66.7502777777778,  6.48},
+{ 138, NULL, 8.42125, -29.5583333333333,  5.55},
+{ 139, "The Tuc", 8.34708333333333, -71.2661111111111,  6.13},
+{ 140, NULL, 8.61583333333333, -52.3730555555556,  5.57},
+{ 141, NULL, 8.73041666666667, 13.3711111111111,  6.40},
+{ 142, "13    Cet", 8.81208333333333, -3.59277777777778,  5.20},
+{ 143, "14    Cet", 8.88666666666667, -0.505555555555556,  5.93},
+{ 144, NULL, 9.03458333333333, 54.1686111111111,  5.08},
+{ 145, NULL, 8.97791666666667, 13.2066666666667,  6.41},
+{ 146, NULL, 9.11375, 60.3261111111111,  5.79},
+{ 147, "Lam2Phe", 8.92125, -48.0008333333333,  5.51},
+{ 148, NULL, 8.88916666666667, -54.8219444444444,  6.06},
+{ 149, NULL, 9.08333333333333, 27.2547222222222,  6.50},
+{ 150, NULL, 9.0125, -14.9736111111111,  6.45},
+{ 151, NULL, 9.02875, -22.8425,  6.06},
+{ 152, NULL, 9.19416666666667, 44.4886111111111,  5.13},
+{ 153, "17Zet Cas", 9.24291666666667, 53.8969444444444,  3.66},
+{ 154, "29Pi  And", 9.22041666666667, 33.7194444444444,  4.36},
+{ 155, "53    Psc", 9.19708333333333, 15.2316666666667,  5.89},
+{ 156, NULL, 9.28, 24.0141666666667,  6.47},
+{ 157, NULL, 9.33791666666667, 35.3994444444444,  5.48},
+{ 158, NULL, 9.94708333333333, 82.4938888888889,  6.40},
+{ 159, NULL, 9.33625, -24.7672222222222,  5.57},
+{ 160, NULL, 9.15583333333333, -65.1247222222222,  6.42},
+{ 161, NULL, 9.37708333333333, 3.13527777777778,  6.39},
+{ 162, NULL, 9.32541666666667, -54.3941666666667,  6.41},
+{ 163, "30Eps And", 9.63875, 29.3116666666667,  4.37},
+{ 164, NULL, 9.79125, 49.3544444444444,  5.43},
+{ 165, "31Del And", 9.83208333333333, 30.8608333333333,  3.27},
+{ 166, "54    Psc", 9.84083333333333, 21.2505555555556,  5.87},
+{ 167, "55    Psc", 9.98166666666667, 21.4383333333333,  5.36},
+{ 168, "18Alp Cas", 10.1270833333333, 56.5372222222222,  2.23},
+{ 169, NULL, 9.67, -73.1372222222222,  6.85},
+{ 170, NULL, 9.99125, -33.9616666666667,  6.69},
+{ 171, NULL, 9.96666666666667, -44.7966666666667,  6.01},
+{ 172, NULL, 10.1191666666667, -16.5169444444444,  6.49},
+{ 173, NULL, 10.1370833333333, -23.8044444444444,  6.14},
+{ 174, NULL, 10.1766666666667, -4.35194444444444,  5.91},
+{ 175, "32    And", 10.28, 39.4586111111111,  5.33},
+{ 176, NULL, 10.11, -59.4544444444444,  5.89},
+{ 177, NULL, 10.5141666666667, 66.1475,  5.83},
+{ 178, NULL, 10.4, 24.6291666666667,  6.04},
+{ 179, "19Xi  Cas", 10.51625, 50.5125,  4.80},
+{ 180, "Mu  Phe", 10.3316666666667, -46.085,  4.59},
+{ 181, NULL, 10.6295833333333, 58.7533333333333,  6.17},
+{ 183, "Xi  Phe", 10.4433333333333, -56.5016666666667,  5.70},
+{ 184, "20Pi  Cas", 10.8670833333333, 47.0247222222222,  4.94},
+{ 185, "Lam1Scl", 10.67875, -38.4633333333333,  6.06},
+{ 186, NULL, 10.6741666666667, -60.2625,  5.98},
+{ 187, "Rho Tuc", 10.6183333333333, -65.4680555555556,  5.39},
+{ 188, "16Bet Cet", 10.8975, -17.9866666666667,  2.04},
+{ 189, NULL, 11.11, 47.8641666666667,  5.67},
+{ 190, NULL, 10.9591666666667, -12.0116666666667,  6.02},
+{ 191, "Eta Phe", 10.8383333333333, -57.4630555555556,  4.36},
+{ 192, "21    Cas", 11.4125, 74.9880555555556,  5.66},
+{ 193, "22Omi Cas", 11.18125, 48.2844444444444,  4.54},
+{ 194, "17Phi1Cet", 11.0475, -10.6094444444444,  4.76},
+{ 195, "Lam2Scl", 11.0504166666667, -38.4216666666667,  5.90},
+{ 196, NULL, 11.3216666666667, 55.2216666666667,  5.42},
+{ 197, NULL, 11.185, -22.0061111111111,  5.24},
+{ 198, NULL, 11.2379166666667, -42.6766666666667,  5.94},
+{ 199, NULL, 11.1345833333333, -62.4977777777778,  6.07},
+{ 200, NULL, 11.6625, 69.325,  6.33},
+{ 201, NULL, 11.3504166666667, -4.62916666666667,  6.15},
+{ 202, NULL, 11.25, -53.715,  6.15},
+{ 203, "18    Cet", 11.3695833333333, -12.8808333333333,  6.15},
+{ 204, NULL, 11.5629166666667, 55.3052777777778,  6.52},
+{ 205, NULL, 11.5454166666667, 44.8613888888889,  6.05},
+{ 206, NULL, 11.42375, -16.4241666666667,  6.47},
+{ 207, NULL, 11.6766666666667, 59.5744444444444,  6.39},
+{ 208, "23    Cas", 11.9420833333333, 74.8475,  5.41},
+{ 209, NULL, 11.44, -47.5516666666667,  5.80},
+{ 210, NULL, 11.5491666666667, -22.5219444444444,  5.50},
+{ 211, "57    Psc", 11.6375, 15.4755555555556,  5.38},
+{ 212, NULL, 12.0379166666667, 72.675,  5.87},
+{ 213, "58    Psc", 11.75625, 11.9738888888889,  5.50},
+{ 214, "59    Psc", 11.8066666666667, 19.5788888888889,  6.13},
+{ 215, "34Zet And", 11.8345833333333, 24.2672222222222,  4.06},
+{ 216, "60    Psc", 11.8483333333333, 6.74083333333333,  5.99},
+{ 217, "61    Psc", 11.9783333333333, 20.9252777777778,  6.54},
+{ 218, NULL, 11.9304166666667, -18.0613888888889,  5.70},
+{ 219, "24Eta Cas", 12.275, 57.8158333333333,  3.44},
+{ 220, NULL, 12.0045833333333, -21.7225,  5.57},
+{ 221, "62    Psc", 12.0725, 7.3,  5.93},
+{ 222, NULL, 12.0958333333333, 5.28055555555556,  5.75},
+{ 223, "25Nu  Cas", 12.20875, 50.9683333333333,  4.89},
+{ 224, "63Del Psc", 12.1708333333333, 7.585,  4.43},
+{ 225, "64    Psc", 12.2445833333333, 16.9405555555556,  5.07},
+{ 226, "35Nu  And", 12.4533333333333, 41.0788888888889,  4.53},
+{ 227, NULL, 12.3566666666667, -13.5613888888889,  5.59},
+{ 228, NULL, 12.3079166666667, -24.1363888888889,  5.90},
+{ 229, NULL, 12.23625, -46.6977777777778,  6.27},
+{ 230, "65    Psc", 12.47, 27.7108333333333,  7.0 },
+{ 231, "65    Psc", 12.4716666666667, 27.7102777777778,  7.1 },
+{ 232, NULL, 12.3891666666667, -23.3616666666667,  6.28},
+{ 233, NULL, 12.6816666666667, 64.2475,  5.39},
+{ 234, NULL, 12.57625, 45.0022222222222,  6.15},
+{ 235, "19Phi2Cet", 12.5316666666667, -10.6444444444444,  5.19},
+{ 236, "Lam Hyi", 12.1475, -74.9233333333333,  5.07},
+{ 237, NULL, 12.8183333333333, 61.8058333333333,  6.07},
+{ 238, NULL, 12.7391666666667, 51.5080555555556,  6.39},
+{ 239, NULL, 12.5154166666667, -43.3947222222222,  6.48},
+{ 240, NULL, 13.72125, 83.7072222222222,  5.62},
+{ 241, NULL, 12.8904166666667, 51.5711111111111,  6.21},
+{ 242, "Rho Phe", 12.6716666666667, -50.9869444444444,  5.22},
+{ 243, NULL, 12.82625, 3.385,  6.37},
+{ 244, NULL, 13.2670833333333, 61.1241666666667,  4.82},
+{ 245, NULL, 12.9670833333333, -43.7091666666667,  6.90},
+{ 246, NULL, 13.2225, 38.5486111111111,  6.69},
+{ 247, NULL, 13.1691666666667, -24.0058333333333,  5.46},
+{ 248, "20    Cet", 13.2520833333333, -1.14416666666667,  4.77},
+{ 249, NULL, 13.3675, 37.4180555555556,  6.06},
+{ 250, NULL, 13.4483333333333, 52.6891666666667,  6.27},
+{ 251, NULL, 13.3016666666667, -24.7769444444444,  6.46},
+{ 252, "Lam1Tuc", 13.10125, -69.5044444444444,  6.22},
+{ 253, "26Ups1Cas", 13.7504166666667, 58.9727777777778,  4.83},
+{ 254, "66    Psc", 13.6466666666667, 19.1883333333333,  5.74},
+{ 255, "21    Cet", 13.5733333333333, -8.74083333333333,  6.16},
+{ 256, NULL, 13.7716666666667, 48.6786111111111,  6.27},
+{ 257, NULL, 13.4079166666667, -62.8713888888889,  5.70},
+{ 258, "36    And", 13.7416666666667, 23.6283333333333,  5.47},
+{ 259, NULL, 13.81125, 24.5569444444444,  6.20},
+{ 260, NULL, 14.05375, 57.9966666666667,  6.21},
+{ 261, NULL, 14.2316666666667, 68.7761111111111,  6.37},
+{ 262, "67    Psc", 13.99375, 27.2094444444444,  6.09},
+{ 263, NULL, 13.9266666666667, -7.34722222222222,  5.85},
+{ 264, "27Gam Cas", 14.1770833333333, 60.7166666666667,  2.47},
+{ 265, "28Ups2Cas", 14.1658333333333, 59.1811111111111,  4.63},
+{ 266, NULL, 14.19625, 60.3627777777778,  5.55},
+{ 267, "22Phi3Cet", 14.00625, -11.2666666666667,  5.31},
+{ 268, NULL, 13.98125, -27.7755555555556,  6.10},
+{ 269, "37Mu  And", 14.1883333333333, 38.4994444444444,  3.87},
+{ 270, "Lam2Tuc", 13.75125, -69.5269444444444,  5.45},
+{ 271, "38Eta And", 14.3016666666667, 23.4175,  4.42},
+{ 272, NULL, 14.4154166666667, 45.8397222222222,  6.12},
+{ 273, NULL, 14.6295833333333, 66.3522222222222,  5.97},
+{ 274, "68    Psc", 14.4591666666667, 28.9922222222222,  5.42},
+{ 275, NULL, 14.5591666666667, 33.9508333333333,  5.98},
+{ 276, NULL, 14.4770833333333, 13.6958333333333,  6.32},
+{ 277, NULL, 14.57875, 21.4044444444444,  6.37},
+{ 278, NULL, 15.1291666666667, 70.9830555555556,  6.39},
+{ 279, "23Phi4Cet", 14.6829166666667, -11.38,  5.61},
+{ 280, "Alp Scl", 14.6516666666667, -29.3575,  4.31},
+{ 281, NULL, 14.5933333333333, -60.6963888888889,  6.23},
+{ 282, NULL, 15.0141666666667, 44.7111111111111,  6.84},
+{ 283, NULL, 15.015, 44.7133333333333,  6.04},
+{ 284, NULL, 14.9570833333333, 6.48305555555556,  6.11},
+{ 285, NULL, 17.18625, 86.2569444444444,  4.25},
+{ 286, NULL, 23.46, 89.0155555555556,  6.46},
+{ 287, NULL, 15.5766666666667, 51.035,  6.47},
+{ 288, "Xi  Scl", 15.32625, -38.9166666666667,  5.59},
+{ 289, NULL, 15.75625, 47.3761111111111,  6.45},
+{ 290, "39    And", 15.72625, 41.345,  5.98},
+{ 291, "69Sig Psc", 15.7045833333333, 31.8044444444444,  5.50},
+{ 292, NULL, 15.9041666666667, 61.075,  5.92},
+{ 293, "Sig Scl", 15.61, -31.5519444444444,  5.50},
+{ 294, "71Eps Psc", 15.7358333333333, 7.89,  4.28},
+{ 295, "Ome Phe", 15.5075, -57.0025,  6.11},
+{ 296, "25    Cet", 15.7608333333333, -4.83666666666667,  5.43},
+{ 297, NULL, 16.0816666666667, 61.5802777777778,  5.84},
+{ 298, NULL, 16.01, 52.5022222222222,  5.99},
+{ 299, NULL, 15.705, -46.3975,  5.36},
+{ 300, NULL, 15.8233333333333, -29.5258333333333,  6.29},
+{ 301, "26    Cet", 15.9541666666667, 1.36666666666667,  6.04},
+{ 302, NULL, 16.195, 51.01,  6.54},
+{ 303, NULL, 16.115, 29.6586111111111,  6.19},
+{ 304, NULL, 15.67875, -65.4561111111111,  6.21},
+{ 305, NULL, 16.1516666666667, 39.9911111111111,  6.72},
+{ 306, NULL, 19.05625, 87.1452777777778,  6.25},
+{ 307, "73    Psc", 16.2191666666667, 5.65638888888889,  6.00},
+{ 308, "72    Psc", 16.2725, 14.9461111111111,  5.68},
+{ 309, NULL, 16.595, 62.7616666666667,  6.54},
+{ 310, "74Psi1Psc", 16.4204166666667, 21.4733333333333,  5.34},
+{ 311, "74Psi1Psc", 16.42375, 21.4652777777778,  5.56},
+{ 312, NULL, 17.30125, 80.0116666666667,  6.29},
+{ 313, "77    Psc", 16.455, 4.90833333333333,  6.35},
+{ 314, "77    Psc", 16.4641666666667, 4.90944444444444,  7.25},
+{ 315, "27    Cet", 16.4033333333333, -9.97916666666667,  6.12},
+{ 316, NULL, 16.7508333333333, 56.935,  6.43},
+{ 317, "28    Cet", 16.52125, -9.83944444444444,  5.58},
+{ 318, NULL, 16.7895833333333, 53.4983333333333,  6.38},
+{ 319, "75    Psc", 16.64, 12.9561111111111,  6.12},
+{ 320, NULL, 16.5320833333333, -23.9925,  6.14},
+{ 321, "30Mu  Cas", 17.0683333333333, 54.9202777777778,  5.17},
+{ 322, "Bet Phe", 16.5208333333333, -46.7186111111111,  3.31},
+{ 323, NULL, 16.6104166666667, -35.6608333333333,  6.61},
+{ 324, "41    And", 17.00375, 43.9419444444444,  5.03},
+{ 325, NULL, 16.8045833333333, -23.9963888888889,  6.37},
+{ 326, NULL, 17.13875, 58.2636111111111,  5.79},
+{ 327, "78    Psc", 17.0054166666667, 32.0122222222222,  6.25},
+{ 328, "79Psi2Psc", 16.9883333333333, 20.7391666666667,  5.55},
+{ 329, "30    Cet", 16.9425, -9.78555555555556,  5.82},
+{ 330, "80    Psc", 17.0925, 5.64972222222222,  5.52},
+{ 331, "Ups Phe", 16.9495833333333, -41.4869444444444,  5.21},
+{ 332, "Iot Tuc", 16.8279166666667, -61.7752777777778,  5.37},
+{ 333, NULL, 18.0695833333333, 79.6738888888889,  5.64},
+{ 334, "31Eta Cet", 17.1475, -10.1822222222222,  3.45},
+{ 335, "42Phi And", 17.3758333333333, 47.2419444444444,  4.25},
+{ 336, "31    Cas", 17.66375, 68.7786111111111,  5.29},
+{ 337, "43Bet And", 17.4329166666667, 35.6205555555556,  2.06},
+{ 338, "Zet Phe", 17.09625, -55.2458333333333,  3.92},
+{ 339, "81Psi3Psc", 17.455, 19.6586111111111,  5.55},
+{ 340, "44    And", 17.5783333333333, 42.0813888888889,  5.65},
+{ 341, NULL, 17.5808333333333, 25.4577777777778,  5.80},
+{ 342, NULL, 17.8566666666667, 64.2027777777778,  5.55},
+{ 343, "33The Cas", 17.7758333333333, 55.1497222222222,  4.33},
+{ 344, NULL, 17.5479166666667, 15.6741666666667,  6.06},
+{ 345, "32    Cas", 17.9225, 65.0188888888889,  5.57},
+{ 346, "32    Cet", 17.55, -8.90611111111111,  6.40},
+{ 347, "33    Cet", 17.64, 2.44555555555556,  5.95},
+{ 348, "45    And", 17.7929166666667, 37.7241666666667,  5.81},
+{ 349, "82    Psc", 17.7783333333333, 31.4247222222222,  5.16},
+{ 350, NULL, 17.5308333333333, -57.6944444444444,  6.41},
+{ 351, "84Chi Psc", 17.8633333333333, 21.0347222222222,  4.66},
+{ 352, "83Tau Psc", 17.915, 30.0897222222222,  4.51},
+{ 353, "34    Cet", 17.93125, -2.25111111111111,  5.94},
+{ 354, NULL, 18.29125, 61.7058333333333,  6.41},
+{ 355, NULL, 18.1416666666667, 45.3377777777778,  6.11},
+{ 356, NULL, 18.2479166666667, 30.0641666666667,  6.19},
+{ 357, NULL, 19.1279166666667, 79.91,  6.26},
+{ 358, NULL, 18.0975, -30.8022222222222,  6.52},
+{ 359, NULL, 18.1891666666667, -37.8563888888889,  5.92},
+{ 360, "85Phi Psc", 18.4370833333333, 24.5836111111111,  4.65},
+{ 361, "86Zet Psc", 18.4329166666667, 7.57527777777778,  5.24},
+{ 362, "86Zet Psc", 18.43875, 7.57833333333333,  6.30},
+{ 363, NULL, 18.5208333333333, 28.5297222222222,  6.43},
+{ 364, "87    Psc", 18.5316666666667, 16.1336111111111,  5.98},
+{ 365, NULL, 19.0504166666667, 71.7438888888889,  7.83},
+{ 366, "37    Cet", 18.6, -7.92305555555556,  5.13},
+{ 367, "88    Psc", 18.6766666666667, 6.99527777777778,  6.03},
+{ 368, "38    Cet", 18.705, -0.973888888888889,  5.70},
+{ 369, NULL, 19.1020833333333, 48.0822222222222,  6.61},
+{ 370, "Nu  Phe", 18.79625, -45.5313888888889,  4.96},
+{ 371, NULL, 19.0783333333333, 33.1147222222222,  6.02},
+{ 372, NULL, 19.27125, 44.9019444444444,  6.34},
+{ 373, "39    Cet", 19.15125, -2.50027777777778,  5.41},
+{ 374, NULL, 19.3504166666667, 31.7447222222222,  6.73},
+{ 375, NULL, 20.08125, 77.5705555555556,  6.31},
+{ 376, NULL, 19.5425, 47.4197222222222,  6.25},
+{ 377, "Kap Tuc", 18.9420833333333, -68.8761111111111,  4.86},
+{ 378, "89    Psc", 19.45, 3.61444444444444,  5.16},
+{ 379, NULL, 19.6958333333333, 37.3861111111111,  6.46},
+{ 380, NULL, 19.265, -66.3980555555556,  6.24},
+{ 381, NULL, 20.49625, 76.2388888888889,  6.38},
+{ 382, "34Phi Cas", 20.0204166666667, 58.2316666666667,  4.98},
+{ 383, "90Ups Psc", 19.8666666666667, 27.2641666666667,  4.76},
+{ 384, "35    Cas", 20.2716666666667, 64.6583333333333,  6.34},
+{ 385, "42    Cet", 19.95125, -0.508888888888889,  5.87},
+{ 386, NULL, 20.945, 78.7258333333333,  6.07},
+{ 387, NULL, 20.14375, -3.24694444444444,  6.23},
+{ 388, NULL, 20.1158333333333, -11.2388888888889,  6.15},
+{ 389, "91    Psc", 20.2808333333333, 28.7380555555556,  5.23},
+{ 390, "46Xi  And", 20.585, 45.5288888888889,  4.88},
+{ 391, NULL, 20.84, 58.1430555555556,  6.45},
+{ 392, NULL, 20.6541666666667, 1.72638888888889,  6.20},
+{ 393, "43    Cet", 20.645, -0.449722222222222,  6.49},
+{ 394, NULL, 20.6270833333333, -19.0813888888889,  6.35},
+{ 395, "47    And", 20.9191666666667, 37.715,  5.58},
+{ 396, NULL, 20.90625, 34.2458333333333,  6.29},
+{ 397, NULL, 20.85375, 20.4688888888889,  5.97},
+{ 398, NULL, 21.44375, 70.98,  6.49},
+{ 399, "36Psi Cas", 21.4833333333333, 68.13,  4.74},
+{ 400, NULL, 20.8791666666667, -30.9455555555556,  5.84},
+{ 401, "44    Cet", 21.0104166666667, -8.0075,  6.21},
+{ 402, "45The Cet", 21.0058333333333, -8.18333333333333,  3.60},
+{ 403, "37Del Cas", 21.4541666666667, 60.2352777777778,  2.68},
+{ 404, NULL, 21.0858333333333, -6.91472222222222,  5.91},
+{ 405, NULL, 21.1658333333333, -15.6602777777778,  6.14},
+{ 406, NULL, 21.2029166666667, -2.84861111111111,  6.15},
+{ 407, NULL, 21.39875, 23.5116666666667,  6.18},
+{ 408, NULL, 21.17, -41.4925,  5.42},
+{ 409, NULL, 21.5775, 43.4577777777778,  5.96},
+{ 410, NULL, 21.53625, 34.5797222222222,  6.31},
+{ 411, NULL, 21.1745833333333, -44.5283333333333,  6.26},
+{ 412, "46    Cet", 21.405, -14.5988888888889,  4.90},
+{ 413, "93Rho Psc", 21.56375, 19.1722222222222,  5.38},
+{ 414, "94    Psc", 21.67375, 19.2402777777778,  5.50},
+{ 415, NULL, 21.7758333333333, 34.3775,  6.27},
+{ 416, NULL, 21.61375, -0.398611111111111,  6.41},
+{ 417, "48Ome And", 21.9141666666667, 45.4066666666667,  4.83},
+{ 418, NULL, 21.8608333333333, 41.1005555555556,  6.46},
+{ 419, NULL, 21.7229166666667, 3.53527777777778,  6.58},
+{ 420, NULL, 21.2720833333333, -64.3694444444444,  5.93},
+{ 421, "47    Cet", 21.715, -13.0566666666667,  5.66},
+{ 422, NULL, 21.9458333333333, 40.3355555555556,  6.60},
+{ 423, NULL, 21.7420833333333, -32.5430555555556,  5.79},
+{ 424, "1Alp UMi", 37.9529166666667, 89.2641666666667,  2.02},
+{ 425, NULL, 21.9441666666667, -10.9016666666667,  6.13},
+{ 426, NULL, 22.0954166666667, 7.96138888888889,  6.20},
+{ 427, "38    Cas", 22.8075, 70.2647222222222,  5.81},
+{ 428, NULL, 22.7179166666667, 66.0980555555555,  6.14},
+{ 429, "Gam Phe", 22.09125, -43.3183333333333,  3.41},
+{ 430, "49    And", 22.5258333333333, 47.0072222222222,  5.27},
+{ 431, NULL, 22.1804166666667, -33.7636111111111,  6.58},
+{ 432, "97    Psc", 22.4704166666667, 18.3555555555556,  6.02},
+{ 433, "48    Cet", 22.4004166666667, -21.6294444444444,  5.12},
+{ 434, "98Mu  Psc", 22.54625, 6.14388888888889,  4.84},
+{ 435, NULL, 22.3766666666667, -46.7563888888889,  6.31},
+{ 436, NULL, 22.5954166666667, -26.2077777777778,  5.93},
+{ 437, "99Eta Psc", 22.8708333333333, 15.3458333333333,  3.62},
+{ 438, NULL, 23.0316666666667, 34.8,  6.39},
+{ 439, NULL, 23.3575, 58.3275,  5.70},
+{ 440, "Del Phe", 22.8129166666667, -49.0727777777778,  3.95},
+{ 441, NULL, 22.9304166666667, -30.2833333333333,  5.82},
+{ 442, "39Chi Cas", 23.4829166666667, 59.2319444444444,  4.71},
+{ 443, NULL, 22.9129166666667, -45.5755555555556,  6.17},
+{ 444, NULL, 23.2645833333333, -9.01472222222222,  6.59},
+{ 445, NULL, 23.2333333333333, -36.8652777777778,  5.51},
+{ 446, NULL, 23.5691666666667, 37.2372222222222,  5.88},
+{ 447, NULL, 23.15125, -49.7277777777778,  6.28},
+{ 448, NULL, 23.42875, -7.02527777777778,  5.76},
+{ 449, NULL, 24.34375, 74.3008333333333,  6.58},
+{ 450, NULL, 23.7045833333333, 18.4605555555556,  5.89},
+{ 451, "49    Cet", 23.6575, -15.6761111111111,  5.63},
+{ 452, NULL, 23.96875, 41.0763888888889,  6.38},
+{ 453, NULL, 23.71125, -31.8922222222222,  6.12},
+{ 454, NULL, 24.1133333333333, 48.7227777777778,  5.92},
+{ 455, "101    Psc", 23.9433333333333, 14.6613888888889,  6.22},
+{ 456, "40    Cas", 24.62875, 73.04,  5.28},
+{ 457, NULL, 23.9783333333333, 17.4336111111111,  5.80},
+{ 458, "50Ups And", 24.1991666666667, 41.4055555555556,  4.09},
+{ 459, "50    Cet", 23.9958333333333, -15.4002777777778,  5.42},
+{ 460, NULL, 23.8133333333333, -58.1394444444444,  6.01},
+{ 461, NULL, 24.5316666666667, 57.9775,  5.56},
+{ 462, "Tau Scl", 24.035, -29.9075,  5.69},
+{ 463, "102Pi  Psc", 24.2745833333333, 12.1416666666667,  5.57},
+{ 464, "51    And", 24.4983333333333, 48.6283333333333,  3.57},
+{ 465, NULL, 24.6320833333333, 45.4,  6.36},
+{ 466, NULL, 24.4070833333333, -9.40388888888889,  6.24},
+{ 467, NULL, 23.4133333333333, -78.5047222222222,  6.11},
+{ 468, NULL, 24.1866666666667, -58.2708333333333,  6.18},
+{ 469, "52Chi And", 24.8375, 44.3861111111111,  4.98},
+{ 470, NULL, 25.0545833333333, 53.8683333333333,  6.39},
+{ 471, NULL, 24.6141666666667, -36.5283333333333,  5.94},
+{ 472, "Alp Eri", 24.42875, -57.2366666666667,  0.46},
+{ 473, NULL, 24.7158333333333, -21.2752777777778,  5.58},
+{ 474, NULL, 24.7083333333333, -25.0219444444444,  6.70},
+{ 475, "105    Psc", 24.92, 16.4058333333333,  5.97},
+{ 476, NULL, 25.1658333333333, 43.2977777777778,  5.61},
+{ 477, "53Tau And", 25.145, 40.5769444444445,  4.94},
+{ 478, "43    Cas", 25.5854166666667, 68.0430555555556,  5.59},
+{ 479, NULL, 24.7008333333333, -53.4388888888889,  6.84},
+{ 480, "42    Cas", 25.7329166666667, 70.6225,  5.18},
+{ 481, NULL, 25.5125, 61.0383333333333,  6.71},
+{ 482, NULL, 25.5741666666667, 58.6277777777778,  6.37},
+{ 483, NULL, 25.4466666666667, 42.6136111111111,  4.95},
+{ 484, NULL, 25.3266666666667, 25.7458333333333,  6.17},
+{ 485, NULL, 25.4133333333333, 30.0472222222222,  5.99},
+{ 486, NULL, 24.9475, -56.1980555555556,  5.87},
+{ 487, NULL, 24.9491666666667, -56.1947222222222,  5.76},
+{ 488, NULL, 25.7433333333333, 61.4216666666667,  6.34},
+{ 489, "106Nu  Psc", 25.3579166666667, 5.4875,  4.44},
+{ 490, NULL, 25.5145833333333, 35.2455555555556,  5.64},
+{ 491, "44    Cas", 25.8320833333333, 60.5511111111111,  5.78},
+{ 492, NULL, 25.43625, -11.3247222222222,  5.75},
+{ 493, "107    Psc", 25.6241666666667, 20.2686111111111,  5.24},
+{ 494, NULL, 25.36375, -38.1330555555556,  6.17},
+{ 495, NULL, 25.81875, 45.3222222222222,  6.34},
+{ 496, "Phi Per", 25.915, 50.6886111111111,  4.07},
+{ 497, "Pi  Scl", 25.5358333333333, -32.3269444444445,  5.25},
+{ 498, NULL, 25.5125, -36.8325,  5.72},
+{ 499, NULL, 26.0745833333333, 57.5363888888889,  6.21},
+{ 500, NULL, 25.68125, -3.69027777777778,  4.99},
+{ 501, NULL, 25.42125, -50.0388888888889,  6.64},
+{ 502, NULL, 26.1920833333333, 57.0891666666667,  6.25},
+{ 503, NULL, 25.9583333333333, 32.1916666666667,  6.34},
+{ 504, NULL, 26.1104166666667, 46.1397222222222,  6.35},
+{ 505, NULL, 25.45, -60.7894444444444,  5.71},
+{ 506, NULL, 25.6220833333333, -53.7405555555556,  5.52},
+{ 507, NULL, 25.9783333333333, -4.76555555555556,  6.19},
+{ 508, "109    Psc", 26.2325, 20.0830555555556,  6.27},
+{ 509, "52Tau Cet", 26.0170833333333, -15.9375,  3.50},
+{ 510, "110Omi Psc", 26.3483333333333, 9.15777777777778,  4.26},
+{ 511, NULL, 26.9366666666667, 63.8522222222222,  5.63},
+{ 512, NULL, 24.4816666666667, -82.975,  5.87},
+{ 513, NULL, 26.4970833333333, -5.73333333333333,  5.34},
+{ 514, "Eps Scl", 26.4116666666667, -25.0525,  5.31},
+{ 515, NULL, 26.6470833333333, 17.4130555555556,  6.55},
+{ 516, "Tau1Hyi", 25.33875, -79.1483333333333,  6.33},
+{ 517, NULL, 26.5041666666667, -27.3491666666667,  6.39},
+{ 518, NULL, 26.95, 46.2297222222222,  6.32},
+{ 519, NULL, 26.5241666666667, -50.8163888888889,  5.49},
+{ 520, NULL, 26.52625, -53.5219444444444,  5.04},
+{ 521, NULL, 27.1620833333333, 37.9527777777778,  5.94},
+{ 522, "4    Ari", 27.0454166666667, 16.9555555555556,  5.84},
+{ 523, NULL, 27.1733333333333, 32.6902777777778,  5.79},
+{ 524, NULL, 26.82, -41.76,  6.18},
+{ 525, NULL, 24.3666666666667, -84.7697222222222,  5.69},
+{ 526, NULL, 27.3154166666667, 47.8969444444444,  5.82},
+{ 527, NULL, 27.1083333333333, 3.68555555555556,  5.91},
+{ 528, NULL, 26.9491666666667, -37.1597222222222,  6.32},
+{ 529, NULL, 27.7379166666667, 51.9333333333333,  5.90},
+{ 530, "1    Ari", 27.5354166666667, 22.2752777777778,  5.86},
+{ 531, "53Chi Cet", 27.39625, -10.6863888888889,  4.67},
+{ 532, NULL, 27.33125, -31.0727777777778,  6.34},
+{ 533, "1    Per", 27.9970833333333, 55.1475,  5.52},
+{ 534, NULL, 27.7166666666667, 11.0433333333333,  5.94},
+{ 535, NULL, 27.4533333333333, -38.4038888888889,  6.37},
+{ 536, "2    Per", 28.0391666666667, 50.7927777777778,  5.79},
+{ 537, NULL, 27.5841666666667, -47.8163888888889,  6.14},
+{ 538, NULL, 28.2116666666667, 51.4747222222222,  6.26},
+{ 539, "55Zet Cet", 27.865, -10.335,  3.73},
+{ 540, NULL, 28.4520833333333, 55.5980555555556,  6.45},
+{ 541, NULL, 27.7270833333333, -50.2061111111111,  5.94},
+{ 542, "45Eps Cas", 28.59875, 63.67,  3.38},
+{ 543, "55    And", 28.3220833333333, 40.7297222222222,  5.40},
+{ 544, "2Alp Tri", 28.2704166666667, 29.5788888888889,  3.41},
+{ 545, "5Gam1Ari", 28.3825, 19.2958333333333,  4.83},
+{ 546, "5Gam2Ari", 28.3825, 19.2936111111111,  4.75},
+{ 547, NULL, 28.2170833333333, -16.9291666666667,  5.80},
+{ 548, "46Ome Cas", 29, 68.6852777777778,  4.99},
+{ 549, "111Xi  Psc", 28.38875, 3.1875,  4.62},
+{ 550, "Tau2Hyi", 26.94375, -80.1766666666667,  6.06},
+{ 551, NULL, 28.7241666666667, 40.7019444444445,  6.24},
+{ 552, NULL, 28.7395833333333, 37.1283333333333,  6.26},
+{ 553, "6Bet Ari", 28.66, 20.8080555555556,  2.64},
+{ 554, NULL, 28.3466666666667, -38.5947222222222,  6.10},
+{ 555, "Psi Phe", 28.4116666666667, -46.3025,  4.41},
+{ 556, NULL, 28.9766666666667, 37.2777777777778,  5.89},
+{ 557, "56    And", 29.03875, 37.2516666666667,  5.67},
+{ 558, "Phi Phe", 28.5916666666667, -42.4969444444444,  5.11},
+{ 559, "7    Ari", 28.9625, 23.5772222222222,  5.74},
+{ 560, NULL, 28.9741666666667, 1.84972222222222,  6.01},
+{ 561, NULL, 29.63875, 61.6980555555556,  6.02},
+{ 562, NULL, 29.485, 41.6944444444444,  6.78},
+{ 563, "8Iot Ari", 29.3379166666667, 17.8175,  5.10},
+{ 564, NULL, 29.4325, 27.8044444444444,  5.82},
+{ 565, "56    Cet", 29.1675, -22.5269444444444,  4.85},
+{ 566, "Chi Eri", 28.9895833333333, -51.6088888888889,  3.70},
+{ 567, NULL, 29.9083333333333, 64.6213888888889,  5.26},
+{ 568, "3    Per", 29.64, 49.2041666666667,  5.69},
+{ 569, "9Lam Ari", 29.4820833333333, 23.5961111111111,  4.79},
+{ 570, "Eta2Hyi", 28.73375, -67.6472222222222,  4.69},
+{ 571, NULL, 28.9433333333333, -60.8613888888889,  6.06},
+{ 572, NULL, 30.7383333333333, 77.9163888888889,  6.04},
+{ 573, NULL, 29.2504166666667, -51.7661111111111,  6.10},
+{ 574, NULL, 29.2916666666667, -47.385,  4.83},
+{ 575, "48    Cas", 30.4891666666667, 70.9069444444444,  4.54},
+{ 576, NULL, 29.61125, -33.0666666666667,  6.35},
+{ 577, NULL, 29.89875, 21.0583333333333,  5.87},
+{ 578, NULL, 29.8579166666667, 12.2947222222222,  6.09},
+{ 579, NULL, 30.79375, 73.8505555555555,  6.23},
+{ 580, "50    Cas", 30.85875, 72.4213888888889,  3.98},
+{ 581, "47    Cas", 31.2808333333333, 77.2813888888889,  5.38},
+{ 582, "112    Psc", 30.0383333333333, 3.09722222222222,  5.88},
+{ 583, "57    Cet", 29.9420833333333, -20.8244444444444,  5.41},
+{ 584, NULL, 29.4733333333333, -65.4247222222222,  6.37},
+{ 585, "59Ups Cet", 30.00125, -21.0777777777778,  4.00},
+{ 586, "52    Cas", 30.7195833333333, 64.9013888888889,  6.00},
+{ 587, NULL, 30.1120833333333, -8.52361111111111,  5.51},
+{ 588, NULL, 29.9116666666667, -42.0305555555556,  5.57},
+{ 589, "53    Cas", 30.75125, 64.39,  5.58},
+{ 590, "4    Per", 30.5754166666667, 54.4875,  5.04},
+{ 591, "Alp Hyi", 29.6925, -61.5697222222222,  2.86},
+{ 592, "49    Cas", 31.38, 76.115,  5.22},
+{ 593, "Sig Hyi", 28.9604166666667, -78.3483333333333,  6.16},
+{ 594, "Pi  For", 30.31125, -30.0016666666667,  5.35},
+{ 595, "113Alp Psc", 30.5116666666667, 2.76361111111111,  5.23},
+{ 596, "113Alp Psc", 30.5116666666667, 2.76361111111111,  4.33},
+{ 597, NULL, 32.3554166666667, 81.2958333333333,  6.05},
+{ 598, NULL, 31.1670833333333, 65.1033333333333,  6.52},
+{ 599, "3Eps Tri", 30.7416666666667, 33.2838888888889,  5.50},
+{ 600, NULL, 29.92125, -66.0663888888889,  6.10},
+{ 601, NULL, 30.6466666666667, 13.4766666666667,  5.94},
+{ 602, "Chi Phe", 30.4266666666667, -44.7136111111111,  5.14},
+{ 603, "57Gam1And", 30.975, 42.3297222222222,  2.26},
+{ 604, "57Gam2And", 30.9779166666667, 42.3308333333333,  4.84},
+{ 605, "10    Ari", 30.91375, 25.9355555555556,  5.63},
+{ 606, NULL, 30.6170833333333, -29.665,  6.42},
+{ 607, "60    Cet", 30.79875, 0.128333333333333,  5.43},
+{ 608, NULL, 30.7441666666667, -15.3058333333333,  5.86},
+{ 609, NULL, 30.9275, 18.2533333333333,  6.21},
+{ 610, "61    Cet", 30.9508333333333, -0.340277777777778,  5.93},
+{ 611, NULL, 30.91875, -4.10361111111111,  5.62},
+{ 612, "Nu  For", 31.1225, -29.2969444444444,  4.69},
+{ 613, "12Kap Ari", 31.64125, 22.6483333333333,  5.03},
+{ 614, NULL, 31.55125, 8.2475,  6.31},
+{ 615, "11    Ari", 31.705, 25.7047222222222,  6.15},
+{ 616, NULL, 31.6220833333333, 0.035,  6.28},
+{ 617, "13Alp Ari", 31.7933333333333, 23.4625,  2.00},
+{ 618, NULL, 32.16875, 58.4236111111111,  5.67},
+{ 619, NULL, 32.14, 44.4594444444445,  6.42},
+{ 620, "58    And", 32.1220833333333, 37.8591666666667,  4.82},
+{ 621, NULL, 32.5325, 53.8430555555556,  6.31},
+{ 622, "4Bet Tri", 32.3858333333333, 34.9872222222222,  3.00},
+{ 623, "14    Ari", 32.3554166666667, 25.9397222222222,  4.98},
+{ 624, NULL, 32.34625, 17.2244444444444,  6.43},
+{ 625, NULL, 32.1904166666667, -17.7794444444444,  6.10},
+{ 626, NULL, 33.3383333333333, 74.0277777777778,  6.29},
+{ 627, "5    Per", 32.8708333333333, 57.6458333333333,  6.36},
+{ 628, "59    And", 32.72, 39.0394444444444,  5.63},
+{ 629, "59    And", 32.72375, 39.0430555555556,  6.10},
+{ 630, NULL, 32.395, -24.3458333333333,  6.48},
+{ 631, "15    Ari", 32.6566666666667, 19.5002777777778,  5.70},
+{ 632, NULL, 32.28875, -43.5166666666667,  5.85},
+{ 633, "16    Ari", 32.8, 25.9369444444444,  6.02},
+{ 634, "5    Tri", 32.8541666666667, 31.5263888888889,  6.23},
+{ 635, "64    Cet", 32.8379166666667, 8.56972222222222,  5.63},
+{ 636, NULL, 32.5204166666667, -43.8155555555556,  6.32},
+{ 637, NULL, 32.6066666666667, -50.8244444444444,  6.12},
+{ 638, NULL, 32.8425, -10.0522222222222,  6.01},
+{ 639, "63    Cet", 32.8991666666667, -1.82527777777778,  5.93},
+{ 640, "55    Cas", 33.62125, 66.5244444444444,  6.07},
+{ 641, NULL, 33.4229166666667, 58.5611111111111,  6.44},
+{ 642, "6    Tri", 33.0929166666667, 30.3030555555556,  4.94},
+{ 643, "60    And", 33.3054166666667, 44.2316666666667,  4.83},
+{ 644, NULL, 33.15625, 24.1677777777778,  5.96},
+{ 645, NULL, 33.40125, 51.0658333333333,  5.31},
+{ 646, "17Eta Ari", 33.2004166666667, 21.2108333333333,  5.27},
+{ 647, NULL, 33.5108333333333, 47.4841666666667,  6.06},
+{ 648, "19    Ari", 33.26375, 15.2797222222222,  5.71},
+{ 649, "65Xi 1Cet", 33.25, 8.84666666666667,  4.37},
+{ 650, "66    Cet", 33.1979166666667, -2.39361111111111,  5.54},
+{ 651, NULL, 33.25375, -21.0002777777778,  5.86},
+{ 652, "Mu  For", 33.2270833333333, -30.7238888888889,  5.28},
+{ 653, NULL, 33.99125, 47.8113888888889,  6.33},
+{ 654, NULL, 34.2154166666667, 57.0552777777778,  6.48},
+{ 655, "7    Tri", 33.9841666666667, 33.3588888888889,  5.28},
+{ 656, "20    Ari", 33.9416666666667, 25.7830555555556,  5.79},
+{ 657, "21    Ari", 33.9283333333333, 25.0430555555556,  5.58},
+{ 658, NULL, 33.8679166666667, -9.46555555555556,  6.55},
+{ 659, NULL, 33.6333333333333, -41.1666666666667,  5.91},
+{ 660, "8Del Tri", 34.2633333333333, 34.2241666666667,  4.87},
+{ 661, "8    Per", 34.4995833333333, 57.8997222222222,  5.75},
+{ 662, "7    Per", 34.51875, 57.5166666666667,  5.98},
+{ 663, NULL, 34.3891666666667, 44.3069444444444,  6.7 },
+{ 664, "9Gam Tri", 34.32875, 33.8472222222222,  4.01},
+{ 665, NULL, 34.2933333333333, 23.7677777777778,  6.55},
+{ 666, "67    Cet", 34.2458333333333, -6.42222222222222,  5.51},
+{ 667, "Pi 1Hyi", 33.56125, -67.8416666666667,  5.55},
+{ 668, NULL, 35.05375, 64.3372222222222,  6.60},
+{ 669, "22The Ari", 34.53125, 19.9011111111111,  5.62},
+{ 670, "62    And", 34.82, 47.38,  5.30},
+{ 671, NULL, 34.7954166666667, 46.4725,  6.21},
+{ 672, NULL, 34.5058333333333, 1.75777777777778,  5.58},
+{ 673, NULL, 34.8445833333333, 48.9552777777778,  6.37},
+{ 674, "Phi Eri", 34.1275, -51.5122222222222,  3.56},
+{ 675, "10    Tri", 34.7375, 28.6425,  5.03},
+{ 676, NULL, 34.7416666666667, 23.1677777777778,  6.46},
+{ 677, NULL, 34.9054166666667, 39.835,  6.63},
+{ 678, "Pi 2Hyi", 33.86875, -67.7463888888889,  5.69},
+{ 679, NULL, 35.1725, 47.3108333333333,  6.11},
+{ 680, NULL, 35.0183333333333, 30.1883333333333,  6.47},
+{ 681, "68Omi Cet", 34.83625, -2.9775,  3.04},
+{ 682, "63    And", 35.2425, 50.1513888888889,  5.59},
+{ 683, NULL, 34.74375, -25.9455555555556,  6.34},
+{ 684, NULL, 34.92, -4.34555555555556,  6.50},
+{ 685, "9    Per", 35.5891666666667, 55.8455555555556,  5.17},
+{ 686, NULL, 34.8529166666667, -41.8483333333333,  6.37},
+{ 687, NULL, 35.7095833333333, 41.3963888888889,  5.82},
+{ 688, NULL, 34.97625, -55.9447222222222,  5.81},
+{ 689, "69    Cet", 35.4858333333333, 0.395833333333333,  5.28},
+{ 690, NULL, 35.9658333333333, 55.3644444444444,  6.28},
+{ 691, "70    Cet", 35.5516666666667, -0.885,  5.42},
+{ 692, NULL, 35.5058333333333, -10.7777777777778,  5.46},
+{ 693, NULL, 35.5208333333333, -17.6622222222222,  5.87},
+{ 694, "64    And", 36.10375, 50.0066666666667,  5.19},
+{ 695, "Kap For", 35.6358333333333, -23.8163888888889,  5.20},
+{ 696, "10    Per", 36.3166666666667, 56.61,  6.25},
+{ 697, NULL, 35.7408333333333, -18.3544444444444,  6.22},
+{ 698, NULL, 35.5491666666667, -43.2,  6.31},
+{ 699, "65    And", 36.4058333333333, 50.2786111111111,  4.71},
+{ 700, NULL, 35.7770833333333, -37.5763888888889,  6.53},
+{ 701, NULL, 35.7275, -51.0922222222222,  5.92},
+{ 702, "24Xi  Ari", 36.2041666666667, 10.6105555555556,  5.47},
+{ 703, NULL, 36.08375, -25.8475,  6.44},
+{ 704, "71    Cet", 36.2433333333333, -2.78,  6.33},
+{ 705, "Del Hyi", 35.4370833333333, -68.6594444444444,  4.09},
+{ 706, NULL, 36.1408333333333, -40.8405555555556,  6.18},
+{ 707, "Iot Cas", 37.2666666666667, 67.4025,  4.52},
+{ 708, "72Rho Cet", 36.4875, -12.2905555555556,  4.89},
+{ 709, "66    And", 36.9658333333333, 50.5697222222222,  6.12},
+{ 710, NULL, 36.50125, -15.3411111111111,  5.83},
+{ 711, NULL, 36.7791666666667, 27.0133333333333,  6.18},
+{ 712, "11    Tri", 36.8654166666667, 31.8013888888889,  5.54},
+{ 713, NULL, 36.6466666666667, -20.0427777777778,  5.88},
+{ 714, "Lam Hor", 36.2245833333333, -60.3119444444444,  5.35},
+{ 715, "Kap Hyi", 35.7179166666667, -73.6458333333333,  5.01},
+{ 716, NULL, 37.3541666666667, 55.5363888888889,  6.51},
+{ 717, "12    Tri", 37.0416666666667, 29.6694444444444,  5.29},
+{ 718, "73Xi 2Cet", 37.0395833333333, 8.46,  4.28},
+{ 719, NULL, 37, 1.96083333333333,  6.45},
+{ 720, "13    Tri", 37.2020833333333, 29.9319444444444,  5.89},
+{ 721, "Kap Eri", 36.74625, -47.7038888888889,  4.25},
+{ 722, NULL, 36.3595833333333, -66.4947222222222,  6.41},
+{ 723, NULL, 37.3066666666667, 23.4688888888889,  6.19},
+{ 724, "Phi For", 37.0070833333333, -33.8111111111111,  5.14},
+{ 725, NULL, 37.3970833333333, 9.56583333333333,  6.07},
+{ 726, NULL, 37.5691666666667, 33.8338888888889,  6.25},
+{ 727, NULL, 37.1475, -31.1025,  6.11},
+{ 728, NULL, 37.635, 25.235,  5.92},
+{ 729, "26    Ari", 37.66, 19.8552777777778,  6.15},
+{ 730, NULL, 37.4808333333333, -22.6827777777778,  6.77},
+{ 731, "27    Ari", 37.7266666666667, 17.7038888888889,  6.23},
+{ 732, NULL, 37.6883333333333, 0.255277777777778,  6.00},
+{ 733, NULL, 37.5575, -25.1863888888889,  6.51},
+{ 734, NULL, 37.0183333333333, -64.2997222222222,  6.37},
+{ 735, NULL, 37.6366666666667, -22.5455555555556,  6.10},
+{ 736, "14    Tri", 38.0258333333333, 36.1472222222222,  5.15},
+{ 737, NULL, 37.8754166666667, 2.26722222222222,  5.25},
+{ 738, NULL, 38.21875, 34.5425,  5.83},
+{ 739, "75    Cet", 38.0391666666667, -1.035,  5.35},
+{ 740, "76Sig Cet", 38.0216666666667, -15.2447222222222,  4.75},
+{ 741, "29    Ari", 38.2254166666667, 15.0347222222222,  6.04},
+{ 742, NULL, 38.0616666666667, -36.4275,  6.30},
+{ 743, NULL, 39.5083333333333, 72.8183333333333,  5.16},
+{ 744, "Lam1For", 38.2791666666667, -34.65,  5.90},
+{ 745, NULL, 38.4175, -20.0019444444444,  6.21},
+{ 746, NULL, 38.86625, 39.6644444444444,  6.36},
+{ 747, NULL, 39.4004166666667, 65.7455555555556,  5.78},
+{ 748, NULL, 38.9116666666667, 37.3122222222222,  5.71},
+{ 749, "Ome For", 38.46125, -28.2325,  4.90},
+{ 750, "15    Tri", 38.945, 34.6875,  5.35},
+{ 751, NULL, 38.7670833333333, 7.47138888888889,  6.18},
+{ 752, "77    Cet", 38.6779166666667, -7.85944444444444,  5.75},
+{ 753, NULL, 39.0204166666667, 6.88694444444444,  5.82},
+{ 754, "78Nu  Cet", 38.96875, 5.59333333333333,  4.86},
+{ 755, NULL, 38.4775, -51.0936111111111,  6.24},
+{ 756, NULL, 39.2383333333333, 38.7327777777778,  5.90},
+{ 757, NULL, 39.17875, 31.6075,  6.10},
+{ 758, NULL, 39.2604166666667, 34.2638888888889,  5.3 },
+{ 759, "80    Cet", 39, -7.83166666666667,  5.53},
+{ 760, NULL, 39.3366666666667, 39.8958333333333,  6.54},
+{ 761, NULL, 39.2766666666667, 32.8919444444444,  6.25},
+{ 762, NULL, 38.39, -62.5869444444444,  6.77},
+{ 763, "31    Ari", 39.1579166666667, 12.4475,  5.68},
+{ 764, "30    Ari", 39.2404166666667, 24.6483333333333,  7.09},
+{ 765, "30    Ari", 39.2520833333333, 24.6475,  6.50},
+{ 766, NULL, 39.14625, 7.72972222222222,  5.81},
+{ 767, "Iot1For", 39.03875, -30.0447222222222,  5.75},
+{ 768, NULL, 39.5741666666667, 37.7266666666667,  6.18},
+{ 769, NULL, 39.6158333333333, 38.0894444444444,  6.30},
+{ 770, NULL, 39.5033333333333, 7.69527777777778,  6.39},
+{ 771, "81    Cet", 39.4241666666667, -3.39611111111111,  5.65},
+{ 772, "Lam2For", 39.2441666666667, -34.5783333333333,  5.79},
+{ 773, "32Nu  Ari", 39.7041666666667, 21.9613888888889,  5.43},
+{ 774, NULL, 41.9483333333333, 81.4483333333333,  5.78},
+{ 775, NULL, 39.65375, 3.44305555555556,  6.21},
+{ 776, "Mu  Hyi", 37.91875, -79.1094444444444,  5.28},
+{ 777, "Iot2For", 39.5779166666667, -30.1941666666667,  5.83},
+{ 778, "Eta Hor", 39.3516666666667, -52.5430555555556,  5.31},
+{ 779, "82Del Cet", 39.8708333333333, 0.328611111111111,  4.07},
+{ 780, NULL, 39.6033333333333, -37.9905555555556,  6.49},
+{ 781, "83Eps Cet", 39.8908333333333, -11.8722222222222,  4.84},
+{ 782, "33    Ari", 40.17125, 27.0608333333333,  5.30},
+{ 783, NULL, 40.0654166666667, 6.11194444444444,  6.25},
+{ 784, NULL, 40.05125, -9.45305555555555,  5.78},
+{ 785, "11    Per", 40.7616666666667, 55.1058333333333,  5.77},
+{ 786, NULL, 40.0104166666667, -30.6338888888889,  6.52},
+{ 787, NULL, 40.74875, 53.5261111111111,  5.84},
+{ 788, "12    Per", 40.5620833333333, 40.1938888888889,  4.91},
+{ 789, NULL, 39.95, -42.8916666666667,  4.75},
+{ 790, "84    Cet", 40.3079166666667, -0.695833333333333,  5.71},
+{ 791, NULL, 41.2070833333333, 67.8247222222222,  5.95},
+{ 792, NULL, 40.7579166666667, 48.2655555555556,  6.48},
+{ 793, "34Mu  Ari", 40.5916666666667, 20.0116666666667,  5.69},
+{ 794, "Iot Eri", 40.1666666666667, -39.8555555555556,  4.11},
+{ 795, NULL, 40.45125, -3.21333333333333,  6.05},
+{ 796, NULL, 40.3916666666667, -14.5494444444444,  5.98},
+{ 797, NULL, 40.6204166666667, 10.7416666666667,  6.30},
+{ 798, NULL, 39.8820833333333, -64.2819444444444,  6.55},
+{ 799, "13The Per", 41.05, 49.2283333333333,  4.12},
+{ 800, "14    Per", 41.0216666666667, 44.2969444444444,  5.43},
+{ 801, "35    Ari", 40.8629166666667, 27.7072222222222,  4.66},
+{ 802, "Zet Hor", 40.165, -54.55,  5.21},
+{ 803, NULL, 40.9633333333333, 25.6380555555556,  6.35},
+{ 804, "86Gam Cet", 40.825, 3.23583333333333,  3.47},
+{ 805, NULL, 40.5275, -38.3838888888889,  6.01},
+{ 806, "Eps Hyi", 39.8975, -68.2669444444444,  4.11},
+{ 807, NULL, 40.5354166666667, -46.5244444444444,  6.10},
+{ 808, "36    Ari", 41.0795833333333, 17.7638888888889,  6.46},
+{ 809, "37Omi Ari", 41.1370833333333, 15.3116666666667,  5.77},
+{ 810, "Iot Hor", 40.6395833333333, -50.8002777777778,  5.41},
+{ 811, "89Pi  Cet", 41.0308333333333, -13.8586111111111,  4.25},
+{ 812, "38    Ari", 41.24, 12.4458333333333,  5.18},
+{ 813, "87Mu  Cet", 41.2354166666667, 10.1141666666667,  4.27},
+{ 814, NULL, 40.8345833333333, -40.5275,  6.36},
+{ 815, NULL, 42.23125, 69.6341666666667,  6.18},
+{ 816, NULL, 41.3370833333333, 4.71166666666667,  6.03},
+{ 817, NULL, 41.0854166666667, -32.525,  6.22},
+{ 818, "1Tau1Eri", 41.2758333333333, -18.5725,  4.47},
+{ 819, NULL, 41.7429166666667, 35.9836111111111,  6.25},
+{ 820, NULL, 41.7645833333333, 35.555,  6.30},
+{ 821, NULL, 41.0445833333333, -52.5705555555556,  6.15},
+{ 822, NULL, 41.31875, -46.2872222222222,  6.85},
+{ 823, NULL, 40.8608333333333, -66.7144444444445,  6.26},
+{ 824, "39    Ari", 41.9770833333333, 29.2472222222222,  4.51},
+{ 825, NULL, 42.3783333333333, 57.0841666666667,  6.25},
+{ 826, NULL, 41.6883333333333, -21.6397222222222,  6.49},
+{ 827, NULL, 41.7966666666667, -22.4855555555556,  6.47},
+{ 828, "40    Ari", 42.13375, 18.2836111111111,  5.82},
+{ 829, NULL, 42.9945833333333, 68.8886111111111,  5.80},
+{ 830, NULL, 42.19125, 25.1880555555556,  5.86},
+{ 831, NULL, 42.3629166666667, 37.3261111111111,  6.45},
+{ 832, NULL, 41.9833333333333, -12.4605555555556,  6.90},
+{ 833, "Gam Hor", 41.3645833333333, -63.7044444444444,  5.74},
+{ 834, "15Eta Per", 42.6741666666667, 55.8955555555556,  3.76},
+{ 835, "Eta1For", 41.8904166666667, -35.5508333333333,  6.51},
+{ 836, "42Pi  Ari", 42.3229166666667, 17.4641666666667,  5.22},
+{ 837, "Zet Hyi", 41.3858333333333, -67.6166666666667,  4.84},
+{ 838, "41    Ari", 42.4958333333333, 27.2605555555556,  3.63},
+{ 839, NULL, 42.9395833333333, 58.3147222222222,  6.45},
+{ 840, "16    Per", 42.64625, 38.3186111111111,  4.23},
+{ 841, "Bet For", 42.2725, -32.4058333333333,  4.46},
+{ 842, NULL, 42.92375, 46.8419444444444,  5.88},
+{ 843, "17    Per", 42.8783333333333, 35.0597222222222,  4.53},
+{ 844, "Gam1For", 42.4625, -24.5602777777778,  6.14},
+{ 845, "Gam2For", 42.4758333333333, -27.9416666666667,  5.39},
+{ 846, NULL, 43.2166666666667, 52.9977777777778,  6.36},
+{ 847, "43Sig Ari", 42.8733333333333, 15.0819444444444,  5.49},
+{ 848, "Eta2For", 42.5616666666667, -35.8436111111111,  5.92},
+{ 849, NULL, 43.3383333333333, 48.5694444444444,  6.26},
+{ 850, "2Tau2Eri", 42.7595833333333, -21.0041666666667,  4.75},
+{ 851, "Eta3For", 42.6683333333333, -35.6761111111111,  5.47},
+{ 852, "Nu  Hor", 42.25625, -62.8066666666667,  5.26},
+{ 853, NULL, 42.6995833333333, -39.9316666666667,  6.36},
+{ 854, "18Tau Per", 43.5645833333333, 52.7625,  3.95},
+{ 855, "20    Per", 43.4275, 38.3375,  5.33},
+{ 856, NULL, 43.29875, 16.4833333333333,  6.31},
+{ 857, NULL, 43.13375, -12.7694444444444,  6.04},
+{ 858, NULL, 42.9804166666667, -30.8144444444444,  6.40},
+{ 859, NULL, 43.2104166666667, -9.44111111111111,  6.32},
+{ 860, NULL, 43.9870833333333, 61.5211111111111,  5.59},
+{ 861, NULL, 44.1033333333333, 64.3325,  6.24},
+{ 862, NULL, 43.3970833333333, -22.3763888888889,  5.95},
+{ 863, "Psi For", 43.3933333333333, -38.4369444444444,  5.92},
+{ 864, NULL, 44.2108333333333, 51.2608333333333,  6.22},
+{ 865, NULL, 44.1391666666667, 47.1638888888889,  6.02},
+{ 866, NULL, 43.08, -62.9097222222222,  6.03},
+{ 867, "45Rho2Ari", 43.9520833333333, 18.3316666666667,  5.91},
+{ 868, NULL, 43.4704166666667, -49.8902777777778,  4.0 },
+{ 869, "46Rho3Ari", 44.10875, 18.0230555555556,  5.63},
+{ 870, NULL, 44.0575, 8.38166666666667,  5.97},
+{ 871, NULL, 43.5270833333333, -50.8713888888889,  6.21},
+{ 872, "Nu  Hyi", 42.61875, -75.0669444444444,  4.75},
+{ 873, "21    Per", 44.3220833333333, 31.9341666666667,  5.11},
+{ 874, "3Eta Eri", 44.1070833333333, -8.89805555555555,  3.89},
+{ 875, NULL, 44.1558333333333, -3.71222222222222,  5.17},
+{ 876, NULL, 44.5095833333333, 38.615,  6.04},
+{ 877, NULL, 44.2691666666667, 4.50111111111111,  6.11},
+{ 878, "47    Ari", 44.5216666666667, 20.6686111111111,  5.80},
+{ 879, "22Pi  Per", 44.6904166666667, 39.6627777777778,  4.70},
+{ 880, NULL, 43.5870833333333, -64.4355555555556,  6.56},
+{ 881, NULL, 46.5325, 79.4186111111111,  5.49},
+{ 882, "24    Per", 44.7654166666667, 35.1830555555556,  4.93},
+{ 883, "4    Eri", 44.34875, -23.8619444444444,  5.45},
+{ 884, NULL, 44.3045833333333, -29.8552777777778,  6.29},
+{ 885, NULL, 44.9579166666667, 47.2208333333333,  5.47},
+{ 886, NULL, 44.91625, 41.0330555555556,  5.89},
+{ 887, "48Eps Ari", 44.8029166666667, 21.3402777777778,  4.63},
+{ 888, "48Eps Ari", 44.8029166666667, 21.3402777777778,  4.63},
+{ 889, "6    Eri", 44.52375, -23.6061111111111,  5.84},
+{ 890, NULL, 45.2175, 52.3516666666667,  5.28},
+{ 891, NULL, 45.2225, 52.3522222222222,  6.74},
+{ 892, NULL, 44.675, -2.7825,  5.23},
+{ 893, NULL, 44.38625, -38.1911111111111,  6.41},
+{ 894, NULL, 45.0491666666667, 38.1316666666667,  6.11},
+{ 895, NULL, 44.6975, -9.77638888888889,  6.14},
+{ 896, "91Lam Cet", 44.92875, 8.9075,  4.70},
+{ 897, "The1Eri", 44.5654166666667, -40.3047222222222,  3.24},
+{ 898, "The2Eri", 44.5679166666667, -40.3044444444444,  4.35},
+{ 899, "5    Eri", 44.9216666666667, -2.465,  5.56},
+{ 900, NULL, 44.7775, -28.9069444444444,  6.14},
+{ 901, "Zet For", 44.9004166666667, -25.2741666666667,  5.71},
+{ 902, NULL, 45.18375, 10.8702777777778,  5.95},
+{ 903, NULL, 44.9095833333333, -32.5072222222222,  6.31},
+{ 904, "7    Eri", 45.2125, -2.87861111111111,  6.11},
+{ 905, "49    Ari", 45.4754166666667, 26.4622222222222,  5.90},
+{ 906, NULL, 47.9283333333333, 81.4705555555556,  5.95},
+{ 907, "8Rho1Eri", 45.2916666666667, -7.66277777777778,  5.75},
+{ 908, NULL, 45.4679166666667, 5.33611111111111,  6.25},
+{ 909, "Bet Hor", 44.6991666666667, -64.0713888888889,  4.99},
+{ 910, "93    Cet", 45.59375, 4.35277777777778,  5.61},
+{ 911, "92Alp Cet", 45.57, 4.08972222222222,  2.53},
+{ 912, NULL, 45.48375, -9.96138888888889,  5.83},
+{ 913, NULL, 45.53875, -6.49472222222222,  6.19},
+{ 914, "Eps For", 45.4070833333333, -28.0916666666667,  5.89},
+{ 915, "23Gam Per", 46.1991666666667, 53.5063888888889,  2.93},
+{ 916, NULL, 45.87625, 28.2697222222222,  6.36},
+{ 917, "9Rho2Eri", 45.67625, -7.68527777777778,  5.32},
+{ 918, NULL, 46.385, 56.7058333333333,  4.76},
+{ 919, "11Tau3Eri", 45.5979166666667, -23.6244444444444,  4.09},
+{ 920, NULL, 46.41625, 56.0686111111111,  6.11},
+{ 921, "25Rho Per", 46.2941666666667, 38.8402777777778,  3.39},
+{ 922, NULL, 46.8291666666667, 64.0577777777778,  5.89},
+{ 923, NULL, 46.3366666666667, 40.5825,  6.05},
+{ 924, NULL, 46.1695833333333, 15.8561111111111,  6.49},
+{ 925, "10Rho3Eri", 46.0683333333333, -7.60083333333333,  5.26},
+{ 926, NULL, 46.15875, 1.86361111111111,  6.05},
+{ 927, "52    Ari", 46.36125, 25.2552777777778,  6.8 },
+{ 928, "52    Ari", 46.36125, 25.2552777777778,  7.0 },
+{ 929, NULL, 45.7329166666667, -46.975,  5.82},
+{ 930, NULL, 47.01625, 52.2133333333333,  6.31},
+{ 931, NULL, 46.59875, 13.1872222222222,  5.62},
+{ 932, NULL, 47.9845833333333, 74.3936111111111,  4.87},
+{ 933, NULL, 46.9475, 47.3083333333333,  6.41},
+{ 934, "Mu  Hor", 45.9033333333333, -59.7377777777778,  5.11},
+{ 935, NULL, 46.6395833333333, -6.08861111111111,  5.27},
+{ 936, "26Bet Per", 47.0420833333333, 40.9555555555556,  2.12},
+{ 937, "Iot Per", 47.2666666666667, 49.6133333333333,  4.05},
+{ 938, "53    Ari", 46.8570833333333, 17.88,  6.11},
+{ 939, "The Hyi", 45.5641666666667, -71.9025,  5.53},
+{ 940, "54    Ari", 47.0883333333333, 18.795,  6.27},
+{ 941, "27Kap Per", 47.3741666666667, 44.8572222222222,  3.80},
+{ 942, NULL, 47.16125, 8.47083333333333,  6.28},
+{ 943, NULL, 46.9620833333333, -27.8311111111111,  6.19},
+{ 944, "55    Ari", 47.4029166666667, 29.0769444444444,  5.72},
+{ 945, NULL, 47.5366666666667, 27.82,  6.42},
+{ 946, NULL, 47.6125, 26.8963888888889,  6.02},
+{ 947, "28Ome Per", 47.8225, 39.6116666666667,  4.63},
+{ 948, NULL, 47.6620833333333, 11.8725,  5.98},
+{ 949, NULL, 48.11, 47.7258333333333,  6.33},
+{ 950, NULL, 48.04, 42.3761111111111,  6.15},
+{ 951, "57Del Ari", 47.9075, 19.7266666666667,  4.35},
+{ 952, NULL, 47.84125, 13.0477777777778,  6.12},
+{ 953, NULL, 47.6475, -23.7383333333333,  6.38},
+{ 954, "56    Ari", 48.0591666666667, 27.2569444444444,  5.79},
+{ 955, NULL, 47.8283333333333, -3.81166666666667,  6.05},
+{ 956, NULL, 48.35, 48.1769444444444,  5.90},
+{ 957, NULL, 47.82, -16.0252777777778,  6.26},
+{ 958, NULL, 48.11, 6.66083333333333,  5.56},
+{ 959, NULL, 46.955, -69.2655555555556,  6.15},
+{ 960, NULL, 47.6141666666667, -48.7341666666667,  6.12},
+{ 961, NULL, 50.0820833333333, 77.7347222222222,  5.45},
+{ 962, "94    Cet", 48.1933333333333, -1.19611111111111,  5.06},
+{ 963, "Alp For", 48.0179166666667, -28.9869444444444,  3.87},
+{ 964, NULL, 48.95, 57.1408333333333,  5.79},
+{ 965, NULL, 53.08375, 84.9111111111111,  5.61},
+{ 966, NULL, 48.73625, 42.5038888888889,  6.07},
+{ 967, NULL, 49.3816666666667, 65.6586111111111,  6.36},
+{ 968, NULL, 48.1075, -44.4197222222222,  5.93},
+{ 969, NULL, 49.0508333333333, 50.9377777777778,  5.03},
+{ 970, NULL, 48.25625, -35.9438888888889,  6.27},
+{ 971, NULL, 48.8354166666667, 30.5566666666667,  5.52},
+{ 972, "58Zet Ari", 48.7254166666667, 21.0444444444444,  4.89},
+{ 973, NULL, 49.0195833333333, 45.3458333333333,  6.16},
+{ 974, NULL, 48.4083333333333, -29.8041666666667,  6.16},
+{ 975, NULL, 48.9458333333333, 32.8563888888889,  6.31},
+{ 976, NULL, 49.0079166666667, 34.6886111111111,  6.25},
+{ 977, NULL, 48.1383333333333, -57.3216666666667,  5.74},
+{ 978, NULL, 49.14625, 32.1836111111111,  6.06},
+{ 979, NULL, 49.2975, 40.4833333333333,  6.45},
+{ 980, NULL, 48.7508333333333, -26.1002777777778,  6.25},
+{ 981, NULL, 46.8833333333333, -78.9894444444444,  5.57},
+{ 982, "30    Per", 49.4475, 44.025,  5.47},
+{ 983, NULL, 49.00375, -5.91861111111111,  6.17},
+{ 984, "13Zet Eri", 48.9583333333333, -8.81972222222222,  4.80},
+{ 985, NULL, 49.9975, 65.6522222222222,  4.84},
+{ 986, NULL, 49.4408333333333, 39.2833333333333,  5.96},
+{ 987, "29    Per", 49.6575, 50.2222222222222,  5.15},
+{ 988, "14    Eri", 49.14875, -9.15444444444445,  6.14},
+{ 989, "31    Per", 49.7816666666667, 50.095,  5.03},
+{ 990, NULL, 49.0470833333333, -30.8275,  6.65},
+{ 991, NULL, 49.6825, 34.2227777777778,  4.82},
+{ 992, "95    Cet", 49.5933333333333, -0.930277777777778,  5.38},
+{ 993, NULL, 49.5116666666667, -28.7969444444444,  5.91},
+{ 994, "15    Eri", 49.5920833333333, -22.5113888888889,  4.88},
+{ 995, "59    Ari", 49.9825, 27.0711111111111,  5.90},
+{ 996, "96Kap1Cet", 49.8404166666667, 3.37027777777778,  4.83},
+{ 997, NULL, 49.6716666666667, -18.5597222222222,  5.71},
+{ 998, NULL, 49.3608333333333, -47.7516666666667,  5.85},
+{ 999, NULL, 50.085, 29.0483333333333,  4.47},
+{1000, "60    Ari", 50.1066666666667, 25.6627777777778,  6.12},
+{1001, NULL, 50.4691666666667, 49.0708333333333,  5.93},
+{1002, "32    Per", 50.3604166666667, 43.3294444444444,  4.95},
+{1003, "16Tau4Eri", 49.8791666666667, -21.7577777777778,  3.69},
+{1004, NULL, 49.895, -24.1230555555556,  5.61},
+{1005, "61Tau1Ari", 50.3066666666667, 21.1469444444444,  5.28},
+{1006, "Zet1Ret", 49.4425, -62.5752777777778,  5.54},
+{1007, "97Kap2Cet", 50.2783333333333, 3.67555555555556,  5.69},
+{1008, NULL, 49.9820833333333, -43.0697222222222,  4.27},
+{1009, NULL, 51.16875, 64.5861111111111,  5.23},
+{1010, "Zet2Ret", 49.55375, -62.5063888888889,  5.24},
+{1011, NULL, 50.805, 49.2133333333333,  5.29},
+{1012, "62    Ari", 50.5495833333333, 27.6075,  5.52},
+{1013, NULL, 50.1883333333333, -26.6063888888889,  6.39},
+{1014, NULL, 49.4958333333333, -66.9269444444444,  6.05},
+{1015, "63Tau2Ari", 50.6883333333333, 20.7419444444444,  5.09},
+{1016, NULL, 50.35, -23.6352777777778,  5.52},
+{1017, "33Alp Per", 51.0808333333333, 49.8611111111111,  1.79},
+{1018, NULL, 50.5679166666667, -25.5877777777778,  6.35},
+{1019, NULL, 51.12375, 33.5358333333333,  5.61},
+{1020, NULL, 51.4516666666667, 53.9216666666667,  6.51},
+{1021, NULL, 50.38875, -47.7769444444444,  6.39},
+{1022, "64    Ari", 51.0770833333333, 24.7241666666667,  5.50},
+{1023, NULL, 50.9129166666667, 4.88194444444444,  6.38},
+{1024, NULL, 50.8241666666667, -7.79416666666667,  6.20},
+{1025, "Iot Hyi", 48.99, -77.3883333333333,  5.52},
+{1026, NULL, 51.2891666666667, 41.2572222222222,  6.51},
+{1027, "65    Ari", 51.10875, 20.8036111111111,  6.08},
+{1028, NULL, 51.0420833333333, 12.6294444444444,  6.04},
+{1029, NULL, 51.4891666666667, 49.1208333333333,  6.09},
+{1030, "1Omi Tau", 51.2033333333333, 9.02888888888889,  3.60},
+{1031, NULL, 50.9358333333333, -32.7072222222222,  6.50},
+{1032, NULL, 52.58125, 71.8638888888889,  6.32},
+{1033, NULL, 52.0983333333333, 60.2555555555556,  6.49},
+{1034, NULL, 52.0129166666667, 49.0627777777778,  4.98},
+{1035, NULL, 52.2670833333333, 59.9402777777778,  4.21},
+{1036, NULL, 51.7633333333333, 18.7563888888889,  6.57},
+{1037, NULL, 52.2183333333333, 49.8483333333333,  5.58},
+{1038, "2Xi  Tau", 51.7925, 9.73277777777778,  3.74},
+{1039, NULL, 51.8279166666667, 12.735,  6.28},
+{1040, NULL, 52.47875, 58.8786111111111,  4.54},
+{1041, NULL, 52.0866666666667, 33.8075,  5.61},
+{1042, "Chi1For", 51.4825, -35.9208333333333,  6.39},
+{1043, NULL, 52.5470833333333, 59.3661111111111,  6.13},
+{1044, "34    Per", 52.3420833333333, 49.5088888888889,  4.67},
+{1045, NULL, 51.59375, -27.3175,  5.93},
+{1046, NULL, 52.5008333333333, 55.4519444444445,  5.09},
+{1047, NULL, 52.3591666666667, 46.9377777777778,  6.24},
+{1048, "66    Ari", 52.1108333333333, 22.8041666666667,  6.03},
+{1049, NULL, 51.54875, -41.6369444444444,  6.32},
+{1050, NULL, 52.0041666666667, -11.2866666666667,  5.73},
+{1051, NULL, 52.6541666666667, 48.1036111111111,  5.82},
+{1052, "35Sig Per", 52.64375, 47.9952777777778,  4.36},
+{1053, NULL, 51.0104166666667, -69.6247222222222,  6.15},
+{1054, "Chi2For", 51.8891666666667, -35.6813888888889,  5.71},
+{1055, NULL, 53.8016666666667, 73.3469444444444,  6.57},
+{1056, NULL, 52.8725, 49.2097222222222,  6.29},
+{1058, "Chi3For", 52.0479166666667, -35.8533333333333,  6.50},
+{1059, NULL, 52.9545833333333, 49.4008333333333,  6.39},
+{1060, NULL, 52.4129166666667, -6.805,  5.99},
+{1061, "4    Tau", 52.6020833333333, 11.3363888888889,  5.14},
+{1062, NULL, 52.4, -12.6747222222222,  5.59},
+{1063, NULL, 53.0358333333333, 48.0236111111111,  5.47},
+{1064, NULL, 51.4008333333333, -69.3363888888889,  5.96},
+{1065, NULL, 52.8366666666667, 27.5719444444444,  5.96},
+{1066, "5    Tau", 52.7183333333333, 12.9366666666667,  4.11},
+{1067, NULL, 52.6891666666667, 6.18861111111111,  5.94},
+{1068, NULL, 53.38375, 58.765,  6.40},
+{1069, "36    Per", 53.1095833333333, 46.0569444444444,  5.31},
+{1070, "17    Eri", 52.6545833333333, -5.07527777777778,  4.73},
+{1071, NULL, 53.4216666666667, 57.8688888888889,  6.37},
+{1072, NULL, 53.1629166666667, 44.8555555555556,  6.41},
+{1073, NULL, 53.4125, 54.9747222222222,  5.98},
+{1074, NULL, 53.1666666666667, 35.4616666666667,  5.90},
+{1075, NULL, 52.4791666666667, -42.6341666666667,  5.78},
+{1076, NULL, 52.5566666666667, -41.37,  6.12},
+{1077, NULL, 53.7533333333333, 60.0411111111111,  6.46},
+{1078, NULL, 53.39625, 39.8994444444444,  5.81},
+{1079, "6    Tau", 53.15, 9.37361111111111,  5.77},
+{1080, NULL, 54.8533333333333, 75.7397222222222,  6.27},
+{1081, NULL, 52.6541666666667, -47.3752777777778,  5.99},
+{1082, NULL, 52.9745833333333, -25.6141666666667,  6.38},
+{1083, "Kap Ret", 52.3445833333333, -62.9375,  4.72},
+{1084, "18Eps Eri", 53.2325, -9.45833333333333,  3.73},
+{1085, NULL, 53.5345833333333, 17.8327777777778,  6.17},
+{1086, "7    Tau", 53.6108333333333, 24.4644444444444,  5.92},
+{1087, "37Psi Per", 54.1225, 48.1927777777778,  4.23},
+{1088, "19Tau5Eri", 53.4470833333333, -21.6327777777778,  4.27},
+{1089, NULL, 53.705, 6.41777777777778,  6.49},
+{1090, NULL, 53.145, -50.3786111111111,  5.68},
+{1091, NULL, 53.6558333333333, -9.86861111111111,  6.25},
+{1092, NULL, 52.715, -66.4897222222222,  5.83},
+{1093, NULL, 53.4866666666667, -31.0802777777778,  6.20},
+{1094, NULL, 54.5820833333333, 56.9327777777778,  6.30},
+{1095, NULL, 53.6395833333333, -31.8747222222222,  6.40},
+{1096, NULL, 53.215, -61.0169444444444,  6.41},
+{1097, NULL, 54.5008333333333, 42.5830555555556,  6.42},
+{1098, NULL, 53.9904166666667, -11.1936111111111,  5.57},
+{1099, NULL, 54.1970833333333, 0.587777777777778,  5.71},
+{1100, "20    Eri", 54.0725, -17.4669444444444,  5.23},
+{1101, "10    Tau", 54.2183333333333, 0.401666666666667,  4.28},
+{1102, NULL, 54.4491666666667, 15.4308333333333,  6.39},
+{1103, NULL, 54.7504166666667, 20.9158333333333,  6.50},
+{1104, NULL, 53.6029166666667, -65.7644444444445,  6.75},
+{1105, NULL, 55.53875, 63.2166666666667,  5.10},
+{1106, NULL, 54.27375, -40.2747222222222,  4.58},
+{1107, NULL, 62.50625, 86.6261111111111,  5.86},
+{1108, NULL, 54.6216666666667, -7.39166666666667,  5.85},
+{1109, NULL, 52.495, -78.3519444444444,  5.70},
+{1110, NULL, 54.8570833333333, 16.5366666666667,  6.16},
+{1111, "21    Eri", 54.7545833333333, -5.62611111111111,  5.96},
+{1112, NULL, 55.6779166666667, 59.9694444444444,  5.76},
+{1113, NULL, 55.2829166666667, 37.58,  5.57},
+{1114, "Tau For", 54.69875, -27.9430555555556,  6.01},
+{1115, "12    Tau", 54.9629166666667, 3.05694444444444,  5.57},
+{1116, NULL, 54.9095833333333, -3.39305555555556,  6.23},
+{1117, NULL, 54.8558333333333, -10.4372222222222,  6.19},
+{1118, "11    Tau", 55.1929166666667, 25.3294444444444,  6.11},
+{1119, NULL, 54.9979166666667, -1.12055555555556,  6.12},
+{1120, NULL, 55.0475, -15.2266666666667,  6.33},
+{1121, "22    Eri", 55.1595833333333, -5.21055555555556,  5.53},
+{1122, "39Del Per", 55.73125, 47.7875,  3.01},
+{1123, "40    Per", 55.59375, 33.965,  4.97},
+{1124, NULL, 56.50375, 67.2016666666667,  5.80},
+{1125, NULL, 55.3075, -11.8030555555556,  6.49},
+{1126, "13    Tau", 55.57875, 19.7002777777778,  5.69},
+{1127, NULL, 56.0266666666667, 48.5236111111111,  6.06},
+{1128, NULL, 55.3433333333333, -19.5847222222222,  6.59},
+{1129, NULL, 56.5095833333333, 63.345,  4.80},
+{1130, NULL, 56.1704166666667, 46.0997222222222,  6.11},
+{1131, "38Omi Per", 56.0795833333333, 32.2883333333333,  3.83},
+{1132, "14    Tau", 55.9466666666667, 19.665,  6.14},
+{1133, NULL, 56.1308333333333, 36.46,  5.59},
+{1134, "Del For", 55.5620833333333, -31.9383333333333,  5.00},
+{1135, "41Nu  Per", 56.2983333333333, 42.5786111111111,  3.77},
+{1136, "23Del Eri", 55.8120833333333, -9.76333333333333,  3.54},
+{1137, NULL, 56.1170833333333, 20.9286111111111,  6.10},
+{1138, NULL, 57.3075, 70.8711111111111,  5.44},
+{1139, NULL, 55.8908333333333, -10.4855555555556,  5.60},
+{1140, "16    Tau", 56.2008333333333, 24.2894444444444,  5.46},
+{1141, NULL, 56.4970833333333, 45.6819444444444,  5.66},
+{1142, "17    Tau", 56.21875, 24.1133333333333,  3.70},
+{1143, NULL, 55.70875, -37.3136111111111,  4.59},
+{1144, "18    Tau", 56.2904166666667, 24.8391666666667,  5.64},
+{1145, "19    Tau", 56.3020833333333, 24.4672222222222,  4.30},
+{1146, "24    Eri", 56.1270833333333, -1.16305555555556,  5.25},
+{1147, NULL, 56.8841666666667, 55.9225,  6.10},
+{1148, "Gam Cam", 57.5895833333333, 71.3322222222222,  4.63},
+{1149, "20    Tau", 56.4566666666667, 24.3677777777778,  3.87},
+{1150, "25    Eri", 56.2354166666667, -0.296666666666667,  5.55},
+{1151, "21    Tau", 56.4766666666667, 24.5547222222222,  5.76},
+{1152, "22    Tau", 56.5120833333333, 24.5280555555556,  6.43},
+{1153, "29    Tau", 56.4183333333333, 6.05,  5.35},
+{1154, NULL, 54.125, -78.3230555555556,  6.29},
+{1155, NULL, 57.38, 65.5261111111111,  4.47},
+{1156, "23    Tau", 56.5816666666667, 23.9483333333333,  4.18},
+{1157, NULL, 56.0258333333333, -40.6602777777778,  6.45},
+{1158, NULL, 57.4029166666667, 63.2972222222222,  5.85},
+{1159, NULL, 56.5395833333333, 6.80305555555555,  5.91},
+{1160, NULL, 57.07625, 50.7366666666667,  6.14},
+{1161, NULL, 57.3316666666667, 57.1180555555556,  6.46},
+{1162, "26Pi  Eri", 56.5354166666667, -12.1016666666667,  4.42},
+{1163, NULL, 56.9691666666667, 33.6,  6.57},
+{1164, NULL, 56.95375, 32.195,  6.25},
+{1165, "25Eta Tau", 56.87125, 24.105,  2.87},
+{1166, NULL, 57.9241666666667, 68.5075,  6.32},
+{1167, NULL, 56.2108333333333, -48.0613888888889,  6.49},
+{1168, NULL, 56.1408333333333, -54.2738888888889,  6.30},
+{1169, NULL, 56.3158333333333, -47.3597222222222,  5.73},
+{1170, NULL, 57.2841666666667, 43.9630555555556,  6.02},
+{1171, "Sig For", 56.6141666666667, -29.3380555555556,  5.90},
+{1172, NULL, 57.0870833333333, 23.4211111111111,  5.45},
+{1173, "27Tau6Eri", 56.7120833333333, -23.2497222222222,  4.23},
+{1174, "30    Tau", 57.0679166666667, 11.1433333333333,  5.07},
+{1175, "Bet Ret", 56.05, -64.8069444444444,  3.85},
+{1176, NULL, 57.51875, 44.9677777777778,  5.66},
+{1177, "42    Per", 57.3858333333333, 33.0913888888889,  5.11},
+{1178, "27    Tau", 57.2904166666667, 24.0533333333333,  3.63},
+{1179, NULL, 56.83375, -29.9019444444444,  6.55},
+{1180, "28    Tau", 57.2966666666667, 24.1366666666667,  5.09},
+{1181, "28Tau7Eri", 56.915, -23.8747222222222,  5.24},
+{1182, NULL, 57.1620833333333, 0.227777777777778,  5.91},
+{1183, NULL, 57.43125, 23.7116666666667,  6.17},
+{1184, "Rho For", 56.9833333333333, -30.1677777777778,  5.54},
+{1185, NULL, 57.4791666666667, 22.2444444444444,  6.07},
+{1186, NULL, 56.9566666666667, -36.1058333333333,  6.21},
+{1187, NULL, 57.1491666666667, -20.9030555555556,  5.81},
+{1188, NULL, 57.57875, 25.5794444444444,  5.26},
+{1189, NULL, 57.1475, -37.6222222222222,  5.40},
+{1190, NULL, 57.1495833333333, -37.6205555555556,  4.73},
+{1191, NULL, 57.97375, 34.3591666666667,  5.77},
+{1192, NULL, 58.4304166666667, 57.975,  5.80},
+{1193, NULL, 57.9025, 22.0316666666667,  6.83},
+{1194, NULL, 57.8158333333333, 13.0458333333333,  6.30},
+{1195, NULL, 57.36375, -36.2002777777778,  4.17},
+{1196, NULL, 59.1258333333333, 71.8216666666667,  6.34},
+{1197, NULL, 58.0179166666667, 31.1683333333333,  6.25},
+{1198, NULL, 58.41125, 48.6505555555556,  5.76},
+{1199, "31    Tau", 58.0008333333333, 6.53472222222222,  5.67},
+{1200, NULL, 57.6566666666667, -36.4252777777778,  6.86},
+{1201, NULL, 58.2916666666667, 17.3269444444444,  5.97},
+{1202, "30    Eri", 58.1733333333333, -5.36138888888889,  5.48},
+{1203, "44Zet Per", 58.5329166666667, 31.8836111111111,  2.85},
+{1204, NULL, 59.35625, 63.0722222222222,  5.03},
+{1205, NULL, 59.2845833333333, 61.1088888888889,  5.00},
+{1206, NULL, 58.3041666666667, -18.4344444444444,  6.22},
+{1207, NULL, 58.9925, 47.8713888888889,  5.37},
+{1208, "Gam Hyi", 56.8095833333333, -74.2388888888889,  3.24},
+{1209, NULL, 58.8458333333333, 31.0458333333333,  6.10},
+{1210, "43    Per", 59.1520833333333, 50.6952777777778,  5.28},
+{1211, "32    Eri", 58.5725, -2.95277777777778,  6.14},
+{1212, "32    Eri", 58.5729166666667, -2.95472222222222,  4.79},
+{1213, "33Tau8Eri", 58.4275, -24.6125,  4.65},
+{1214, NULL, 58.4120833333333, -34.7322222222222,  5.11},
+{1215, NULL, 59.1195833333333, 35.0811111111111,  5.49},
+{1216, NULL, 58.38875, -46.8936111111111,  5.93},
+{1217, NULL, 58.8179166666667, -12.0991666666667,  6.00},
+{1218, "32    Tau", 59.2170833333333, 22.4780555555556,  5.63},
+{1219, NULL, 58.5966666666667, -40.3572222222222,  5.71},
+{1220, "45Eps Per", 59.4633333333333, 40.0102777777778,  2.89},
+{1221, "33    Tau", 59.2658333333333, 23.1755555555556,  6.06},
+{1222, NULL, 59.36, 24.4619444444444,  6.16},
+{1223, NULL, 59.5129166666667, 34.8144444444444,  6.53},
+{1224, NULL, 59.2570833333333, 6.04,  6.09},
+{1225, NULL, 59.1579166666667, -9.75083333333333,  6.19},
+{1226, NULL, 59.62125, 38.8402777777778,  6.30},
+{1227, NULL, 58.6416666666667, -52.6905555555556,  6.46},
+{1228, "46Xi  Per", 59.74125, 35.7911111111111,  4.04},
+{1229, NULL, 59.9166666666667, 38.8205555555556,  6.38},
+{1230, NULL, 62.5116666666667, 80.6986111111111,  5.10},
+{1231, "34Gam Eri", 59.5075, -13.5086111111111,  2.95},
+{1232, NULL, 59.7179166666667, -5.47,  5.83},
+{1233, NULL, 59.9195833333333, 10.3308333333333,  6.37},
+{1234, NULL, 60.31125, 36.99,  6.41},
+{1235, NULL, 59.8754166666667, -12.5741666666667,  5.60},
+{1236, NULL, 59.0166666666667, -63.4636111111111,  6.14},
+{1237, NULL, 60.15375, 17.2966666666667,  6.32},
+{1238, NULL, 60.2033333333333, 18.1938888888889,  5.89},
+{1239, "35Lam Tau", 60.17, 12.4902777777778,  3.47},
+{1240, "36Tau9Eri", 59.98125, -24.0163888888889,  4.66},
+{1241, NULL, 61.5129166666667, 68.68,  5.87},
+{1242, NULL, 61.1133333333333, 59.1555555555556,  5.06},
+{1243, NULL, 60.4420833333333, 9.99777777777778,  5.67},
+{1244, "35    Eri", 60.3833333333333, -1.54972222222222,  5.28},
+{1245, NULL, 59.67875, -57.1025,  6.05},
+{1246, NULL, 60.1695833333333, -30.4908333333333,  5.93},
+{1247, "Del Ret", 59.68625, -61.4002777777778,  4.56},
+{1248, NULL, 61.6625, 65.5208333333333,  6.17},
+{1249, NULL, 60.6529166666667, -0.268888888888889,  5.38},
+{1250, NULL, 60.0654166666667, -51.5647222222222,  6.51},
+{1251, "38Nu  Tau", 60.7891666666667, 5.98916666666667,  3.91},
+{1252, "36    Tau", 61.0904166666667, 24.1058333333333,  5.47},
+{1253, "40    Tau", 60.9358333333333, 5.43555555555556,  5.33},
+{1254, NULL, 60.9858333333333, 8.19722222222222,  5.46},
+{1255, NULL, 61.6525, 54.0086111111111,  6.31},
+{1256, "37    Tau", 61.17375, 22.0819444444444,  4.36},
+{1257, NULL, 61.04125, 2.82694444444444,  5.36},
+{1258, NULL, 60.8529166666667, -20.1441666666667,  6.46},
+{1259, NULL, 60.9033333333333, -20.1583333333333,  7.01},
+{1260, NULL, 61.9629166666667, 62.33,  6.99},
+{1261, "47Lam Per", 61.6458333333333, 50.3513888888889,  4.29},
+{1262, "39    Tau", 61.3341666666667, 22.0088888888889,  5.90},
+{1263, NULL, 61.03625, -16.5888888888889,  6.39},
+{1264, "Gam Ret", 60.2241666666667, -62.1594444444444,  4.51},
+{1265, NULL, 61.0945833333333, -12.7925,  5.61},
+{1266, "Iot Ret", 60.3258333333333, -61.0788888888889,  4.97},
+{1267, NULL, 61.1708333333333, -20.3816666666667,  6.13},
+{1268, "41    Tau", 61.6516666666667, 27.6,  5.20},
+{1269, "42Psi Tau", 61.7520833333333, 29.0013888888889,  5.23},
+{1270, NULL, 62.365, 59.9080555555556,  6.28},
+{1271, NULL, 55.63375, -85.2622222222222,  6.41},
+{1272, NULL, 61.4854166666667, -8.85611111111111,  6.26},
+{1273, "48    Per", 62.1654166666667, 47.7125,  4.04},
+{1274, NULL, 61.4445833333333, -20.5122222222222,  6.34},
+{1275, NULL, 61.4058333333333, -27.6516666666667,  5.59},
+{1276, NULL, 62.3433333333333, 54.8288888888889,  6.18},
+{1277, "49    Per", 62.06375, 37.7277777777778,  6.09},
+{1278, "50    Per", 62.1525, 38.0397222222222,  5.51},
+{1279, NULL, 61.925, 15.1627777777778,  6.01},
+{1280, NULL, 61.9975, 17.3397222222222,  5.89},
+{1281, NULL, 63.4370833333333, 72.1263888888889,  6.03},
+{1282, NULL, 63.215, 68.5016666666667,  6.32},
+{1283, "43Ome1Tau", 62.2916666666667, 19.6091666666667,  5.50},
+{1284, NULL, 62.2566666666667, 13.3983333333333,  5.95},
+{1285, NULL, 61.8545833333333, -42.9169444444444,  6.59},
+{1286, NULL, 62.7458333333333, 33.5866666666667,  5.72},
+{1287, "44    Tau", 62.7079166666667, 26.4808333333333,  5.41},
+{1288, NULL, 62.3241666666667, -16.3858333333333,  5.37},
+{1289, NULL, 67.0541666666667, 83.8077777777778,  5.57},
+{1290, "37    Eri", 62.59375, -6.92388888888889,  5.44},
+{1291, NULL, 62.14125, -45.8647222222222,  6.59},
+{1292, "45    Tau", 62.8345833333333, 5.52305555555556,  5.72},
+{1293, NULL, 62.69875, -8.81972222222222,  5.70},
+{1294, NULL, 61.84, -64.2225,  6.38},
+{1295, NULL, 63.1308333333333, 17.2775,  6.09},
+{1296, NULL, 63.7575, 57.4602777777778,  6.08},
+{1297, NULL, 63.2133333333333, 22.4136111111111,  6.12},
+{1298, "38Omi1Eri", 62.96625, -6.8375,  4.04},
+{1299, NULL, 62.6908333333333, -35.2738888888889,  6.44},
+{1300, NULL, 62.9008333333333, -20.3561111111111,  5.79},
+{1301, NULL, 63.4983333333333, 37.9669444444444,  6.45},
+{1302, "Del Hor", 62.7108333333333, -41.9936111111111,  4.93},
+{1303, "51Mu  Per", 63.7245833333333, 48.4094444444444,  4.14},
+{1304, NULL, 67.5004166666667, 83.3405555555556,  5.46},
+{1305, NULL, 64.2233333333333, 61.8502777777778,  5.70},
+{1306, "52    Per", 63.7220833333333, 40.4836111111111,  4.71},
+{1307, NULL, 63.395, 10.2122222222222,  6.23},
+{1308, NULL, 63.3804166666667, 8.89055555555555,  6.51},
+{1309, "46    Tau", 63.3879166666667, 7.71611111111111,  5.29},
+{1310, NULL, 63.4579166666667, 12.7533333333333,  6.25},
+{1311, "47    Tau", 63.485, 9.26361111111111,  4.84},
+{1312, NULL, 63.4091666666667, -1.14972222222222,  6.44},
+{1313, NULL, 64.2841666666667, 57.8605555555556,  5.71},
+{1314, NULL, 64.1795833333333, 53.6119444444444,  5.19},
+{1315, NULL, 63.65125, 10.0111111111111,  5.22},
+{1316, NULL, 63.1316666666667, -44.3683333333333,  6.71},
+{1317, NULL, 66.7616666666667, 80.8241666666667,  5.43},
+{1318, "39    Eri", 63.59875, -10.2563888888889,  4.87},
+{1319, "48    Tau", 63.9429166666667, 15.4005555555556,  6.32},
+{1320, "49Mu  Tau", 63.88375, 8.89222222222222,  4.29},
+{1321, NULL, 63.8575, 6.19972222222222,  6.93},
+{1322, NULL, 63.8716666666667, 6.18666666666667,  6.31},
+{1323, NULL, 63.39875, -40.3577777777778,  6.37},
+{1324, NULL, 64.5608333333333, 50.2955555555556,  4.61},
+{1325, "40Omi2Eri", 63.8179166666667, -7.65277777777778,  4.43},
+{1326, "Alp Hor", 63.5004166666667, -42.2944444444444,  3.86},
+{1327, NULL, 65.1679166666667, 65.1405555555556,  5.27},
+{1328, NULL, 64.5341666666667, 42.1411111111111,  6.22},
+{1329, "50Ome2Tau", 64.315, 20.5786111111111,  4.94},
+{1330, NULL, 64.8054166666667, 50.0488888888889,  5.45},
+{1331, "51    Tau", 64.5966666666667, 21.5791666666667,  5.65},
+{1332, NULL, 64.33, -6.47194444444444,  5.94},
+{1333, NULL, 65.0479166666667, 50.9208333333333,  5.55},
+{1334, NULL, 64.6020833333333, 9.48666666666667,  6.54},
+{1335, NULL, 65.4483333333333, 60.7355555555556,  5.39},
+{1336, "Alp Ret", 63.60625, -62.4738888888889,  3.35},
+{1337, NULL, 65.06, 41.8080555555556,  5.92},
+{1338, "Gam Dor", 64.0066666666667, -51.4866666666667,  4.25},
+{1339, "53    Tau", 64.85875, 21.1422222222222,  5.35},
+{1340, NULL, 63.7029166666667, -62.1919444444444,  5.45},
+{1341, "56    Tau", 64.9029166666667, 21.7736111111111,  5.38},
+{1342, NULL, 65.4658333333333, 56.5066666666667,  5.88},
+{1343, "54    Per", 65.1025, 34.5666666666667,  4.93},
+{1344, NULL, 65.0416666666667, 31.9533333333333,  6.16},
+{1345, NULL, 64.56625, -20.7155555555556,  6.00},
+{1346, "54Gam Tau", 64.9483333333333, 15.6275,  3.65},
+{1347, "41Ups4Eri", 64.47375, -33.7983333333333,  3.56},
+{1348, "52Phi Tau", 65.08875, 27.3508333333333,  4.95},
+{1349, NULL, 64.90625, 10.1213888888889,  6.31},
+{1350, "53    Per", 65.3883333333333, 46.4988888888889,  4.85},
+{1351, "57    Tau", 64.9904166666667, 14.0352777777778,  5.59},
+{1352, NULL, 65.74125, 59.6163888888889,  6.19},
+{1353, NULL, 64.6558333333333, -22.9702777777778,  6.07},
+{1354, NULL, 65.1045833333333, 18.7425,  6.12},
+{1355, "Eps Ret", 64.1204166666667, -59.3019444444444,  4.44},
+{1356, "58    Tau", 65.15125, 15.0952777777778,  5.26},
+{1357, NULL, 64.0879166666667, -60.9486111111111,  6.37},
+{1358, NULL, 65.22, 13.8641666666667,  6.17},
+{1359, NULL, 64.7625, -33.905,  6.37},
+{1360, NULL, 65.1716666666667, 6.13083333333333,  5.77},
+{1361, NULL, 65.2041666666667, 9.22555555555556,  6.53},
+{1362, NULL, 65.16125, -6.24555555555556,  6.27},
+{1363, NULL, 65.1783333333333, -7.5925,  5.85},
+{1364, NULL, 64.8191666666667, -44.2680555555556,  5.34},
+{1365, NULL, 64.6666666666667, -52.86,  6.09},
+{1366, NULL, 65.3629166666667, -0.0980555555555555,  5.86},
+{1367, NULL, 65.1625, -20.6397222222222,  5.38},
+{1368, "60    Tau", 65.5145833333333, 14.0772222222222,  5.72},
+{1369, "59Chi Tau", 65.6454166666667, 25.6291666666667,  5.37},
+{1370, NULL, 65.595, 20.8213888888889,  5.91},
+{1371, NULL, 65.8995833333333, 42.4280555555556,  6.23},
+{1372, "The Ret", 64.4175, -63.2555555555556,  5.87},
+{1373, "61Del1Tau", 65.73375, 17.5425,  3.76},
+{1374, NULL, 65.3804166666667, -25.7283333333333,  6.01},
+{1375, NULL, 65.885, 20.9822222222222,  5.99},
+{1376, "63    Tau", 65.8541666666667, 16.7772222222222,  5.64},
+{1377, "55    Per", 66.1216666666667, 34.1305555555556,  5.73},
+{1378, "62    Tau", 65.9991666666667, 24.3011111111111,  6.36},
+{1379, "56    Per", 66.1558333333333, 33.9597222222222,  5.76},
+{1380, "64Del2Tau", 66.0241666666667, 17.4438888888889,  4.80},
+{1381, "66    Tau", 65.96625, 9.46083333333333,  5.12},
+{1382, NULL, 66.75375, 57.5852777777778,  6.32},
+{1383, "42Xi  Eri", 65.92, -3.74555555555556,  5.17},
+{1384, NULL, 65.77375, -24.8922222222222,  5.83},
+{1385, NULL, 66.2379166666667, 19.0416666666667,  5.98},
+{1386, NULL, 65.7820833333333, -35.545,  6.39},
+{1387, "65Kap1Tau", 66.3420833333333, 22.2938888888889,  4.22},
+{1388, "67Kap2Tau", 66.3541666666667, 22.1997222222222,  5.28},
+{1389, "68Del3Tau", 66.3725, 17.9280555555556,  4.29},
+{1390, NULL, 66.52625, 31.4388888888889,  5.28},
+{1391, "70    Tau", 66.4054166666667, 15.9408333333333,  6.46},
+{1392, "69Ups Tau", 66.5770833333333, 22.8136111111111,  4.28},
+{1393, "43    Eri", 66.0091666666667, -34.0169444444444,  3.96},
+{1394, "71    Tau", 66.5866666666667, 15.6183333333333,  4.49},
+{1395, "Eta Ret", 65.4720833333333, -63.3863888888889,  5.24},
+{1396, "73Pi  Tau", 66.6516666666667, 14.7136111111111,  4.69},
+{1397, NULL, 66.5879166666667, 8.59027777777778,  6.06},
+{1398, NULL, 66.235, -34.7577777777778,  6.55},
+{1399, "72    Tau", 66.8229166666667, 22.9963888888889,  5.53},
+{1400, NULL, 66.7529166666667, 2.07944444444444,  6.23},
+{1401, NULL, 68.3779166666667, 72.5286111111111,  5.94},
+{1402, NULL, 66.87, 11.2125,  5.88},
+{1403, NULL, 67.0033333333333, 21.62,  5.72},
+{1404, NULL, 66.3295833333333, -44.1608333333333,  6.39},
+{1405, NULL, 66.0508333333333, -57.0713888888889,  6.29},
+{1406, NULL, 67.21625, 30.3613888888889,  6.40},
+{1407, "75    Tau", 67.11, 16.3597222222222,  4.97},
+{1408, "76    Tau", 67.0975, 14.7408333333333,  5.90},
+{1409, "74Eps Tau", 67.1541666666667, 19.1802777777778,  3.53},
+{1410, NULL, 66.7375, -24.0813888888889,  6.11},
+{1411, "77The1Tau", 67.14375, 15.9622222222222,  3.84},
+{1412, "78The2Tau", 67.1654166666667, 15.8708333333333,  3.40},
+{1413, NULL, 67.015, 1.85861111111111,  6.15},
+{1414, "79    Tau", 67.2091666666667, 13.0475,  5.03},
+{1415, NULL, 67.13375, 1.38083333333333,  5.55},
+{1416, NULL, 66.2720833333333, -61.2383333333333,  5.94},
+{1417, "1    Cam", 68.0075, 53.9108333333333,  5.77},
+{1418, NULL, 66.775, -46.9475,  6.10},
+{1419, NULL, 67.6595833333333, 32.4580555555556,  6.21},
+{1420, NULL, 67.42875, 10.5216666666667,  6.79},
+{1421, NULL, 67.1625, -19.4583333333333,  5.96},
+{1422, "80    Tau", 67.5358333333333, 15.6380555555556,  5.58},
+{1423, NULL, 67.27875, -13.0483333333333,  5.60},
+{1424, NULL, 67.85, 40.0102777777778,  6.26},
+{1425, NULL, 67.51, 10.2625,  6.48},
+{1426, "Del Men", 64.49625, -80.2138888888889,  5.69},
+{1427, NULL, 67.6404166666667, 16.1938888888889,  4.78},
+{1428, "81    Tau", 67.6620833333333, 15.6919444444444,  5.48},
+{1429, NULL, 67.0391666666667, -41.96,  6.44},
+{1430, "83    Tau", 67.6554166666667, 13.7244444444444,  5.40},
+{1431, NULL, 67.5404166666667, -13.5922222222222,  6.24},
+{1432, "85    Tau", 67.9658333333333, 15.8516666666667,  6.02},
+{1433, NULL, 67.3333333333333, -46.5152777777778,  6.16},
+{1434, "57    Per", 68.35375, 43.0638888888889,  6.09},
+{1435, NULL, 66.94125, -62.5208333333333,  5.75},
+{1436, NULL, 68.02, 5.41,  6.39},
+{1437, "45    Eri", 67.9695833333333, -0.0438888888888889,  4.91},
+{1438, NULL, 67.8579166666667, -13.645,  6.21},
+{1439, NULL, 67.6679166666667, -35.6536111111111,  5.96},
+{1440, NULL, 69.1008333333333, 64.2616666666667,  5.94},
+{1441, NULL, 68.1558333333333, -3.20916666666667,  5.81},
+{1442, NULL, 68.3870833333333, 18.0166666666667,  6.25},
+{1443, "Del Cae", 67.70875, -44.9538888888889,  5.07},
+{1444, "86Rho Tau", 68.4620833333333, 14.8444444444444,  4.65},
+{1445, NULL, 68.6583333333333, 28.9611111111111,  5.88},
+{1446, NULL, 68.4504166666667, 9.41305555555556,  6.01},
+{1447, NULL, 68.3416666666667, -10.7858333333333,  6.06},
+{1448, NULL, 68.5345833333333, 5.56861111111111,  5.68},
+{1449, "46    Eri", 68.4783333333333, -6.73888888888889,  5.72},
+{1450, NULL, 68.5591666666667, -6.83777777777778,  6.09},
+{1451, "47    Eri", 68.5483333333333, -8.23138888888889,  5.11},
+{1452, NULL, 68.54875, -8.97027777777778,  5.26},
+{1453, "50Ups1Eri", 68.3775, -29.7666666666667,  4.51},
+{1454, "58    Per", 69.1725, 41.2647222222222,  4.25},
+{1455, NULL, 68.9279166666667, 19.8816666666667,  6.36},
+{1456, "Nu  Men", 65.24125, -81.58,  5.79},
+{1457, "87Alp Tau", 68.98, 16.5091666666667,  0.85},
+{1458, "88    Tau", 68.91375, 10.1608333333333,  4.25},
+{1459, NULL, 69.1216666666667, 23.3408333333333,  6.02},
+{1460, NULL, 68.8083333333333, -9.73666666666667,  6.37},
+{1461, NULL, 68.7520833333333, -19.9205555555556,  6.13},
+{1462, NULL, 69.0066666666667, -3.61194444444444,  6.33},
+{1463, "48Nu  Eri", 69.0795833333333, -3.3525,  3.93},
+{1464, "52Ups2Eri", 68.8875, -30.5622222222222,  3.82},
+{1465, "Alp Dor", 68.4991666666667, -55.045,  3.27},
+{1466, "2    Cam", 69.9920833333333, 53.4730555555556,  5.35},
+{1467, "3    Cam", 69.9779166666667, 53.0797222222222,  5.05},
+{1468, NULL, 71.50125, 76.6111111111111,  6.49},
+{1469, NULL, 69.3070833333333, 0.998333333333333,  5.31},
+{1470, NULL, 69.6233333333333, 26.94,  6.47},
+{1471, NULL, 69.5658333333333, 20.6847222222222,  5.92},
+{1472, "89    Tau", 69.5391666666667, 16.0333333333333,  5.79},
+{1473, "90    Tau", 69.5395833333333, 12.5108333333333,  4.27},
+{1474, "51    Eri", 69.4004166666667, -2.47333333333333,  5.23},
+{1475, NULL, 68.3916666666667, -62.8236111111111,  5.79},
+{1476, NULL, 69.2120833333333, -30.7166666666667,  6.30},
+{1477, NULL, 69.84625, 25.2183333333333,  6.22},
+{1478, "91Sig1Tau", 69.7883333333333, 15.7997222222222,  5.07},
+{1479, "92Sig2Tau", 69.81875, 15.9180555555556,  4.69},
+{1480, NULL, 69.7758333333333, 7.87083333333333,  5.39},
+{1481, "53    Eri", 69.545, -14.3038888888889,  3.87},
+{1482, NULL, 70.3504166666667, 48.3008333333333,  5.67},
+{1483, NULL, 69.7233333333333, -12.1230555555556,  5.01},
+{1484, "93    Tau", 70.0141666666667, 12.1977777777778,  5.46},
+{1485, NULL, 65.7120833333333, -82.8991666666667,  6.76},
+{1486, NULL, 70.8254166666667, 59.5208333333333,  6.50},
+{1487, NULL, 69.8320833333333, -14.3591666666667,  5.45},
+{1488, NULL, 69.9466666666667, -1.05277777777778,  6.10},
+{1489, NULL, 70.4595833333333, 38.2802777777778,  5.99},
+{1490, NULL, 70.3325, 28.615,  5.78},
+{1491, NULL, 72.2095833333333, 75.9411111111111,  6.06},
+{1492, NULL, 69.19, -62.0775,  5.40},
+{1493, NULL, 70.84, 49.9738888888889,  5.87},
+{1494, "59    Per", 70.72625, 43.365,  5.29},
+{1495, NULL, 70.0283333333333, -24.4825,  5.58},
+{1496, "54    Eri", 70.1104166666667, -19.6716666666667,  4.32},
+{1497, "94Tau Tau", 70.56125, 22.9569444444444,  4.28},
+{1498, NULL, 69.7679166666667, -51.6727777777778,  6.44},
+{1499, "95    Tau", 70.8075, 24.0888888888889,  6.13},
+{1500, NULL, 71.05375, 40.7869444444444,  6.08},
+{1501, NULL, 70.95125, 32.8652777777778,  6.45},
+{1502, "Alp Cae", 70.1404166666667, -41.8638888888889,  4.45},
+{1503, "Bet Cae", 70.5145833333333, -37.1444444444444,  5.05},
+{1504, NULL, 70.07625, -58.9436111111111,  6.53},
+{1505, "55    Eri", 70.8941666666667, -8.79361111111111,  6.82},
+{1506, "55    Eri", 70.89625, -8.79611111111111,  6.70},
+{1507, NULL, 71.1075, 11.1461111111111,  5.40},
+{1508, "56    Eri", 71.0220833333333, -8.50361111111111,  5.90},
+{1509, NULL, 70.78875, -30.7655555555556,  5.68},
+{1510, NULL, 72.6516666666667, 70.9416666666667,  6.37},
+{1511, "4    Cam", 72.00125, 56.7572222222222,  5.30},
+{1512, NULL, 71.4270833333333, 23.6280555555556,  6.35},
+{1513, NULL, 71.0333333333333, -18.6666666666667,  5.53},
+{1514, NULL, 71.685, 40.3127777777778,  5.97},
+{1515, NULL, 72.0291666666667, 55.6025,  6.26},
+{1516, "Lam Pic", 70.6933333333333, -50.4813888888889,  5.31},
+{1517, NULL, 71.57, 18.735,  6.01},
+{1518, NULL, 70.9341666666667, -41.0647222222222,  6.25},
+{1519, NULL, 71.5070833333333, 11.7055555555556,  5.37},
+{1520, "57Mu  Eri", 71.3754166666667, -3.25472222222222,  4.02},
+{1521, NULL, 71.2675, -21.2836111111111,  5.72},
+{1522, NULL, 71.6004166666667, -2.95444444444444,  6.33},
+{1523, NULL, 75.08625, 81.1938888888889,  5.07},
+{1524, NULL, 71.4566666666667, -34.005,  6.86},
+{1525, NULL, 71.6075, -28.0875,  6.19},
+{1526, NULL, 71.4808333333333, -39.3566666666667,  6.05},
+{1527, NULL, 73.0216666666667, 63.5052777777778,  5.44},
+{1528, NULL, 72.3291666666667, 32.5883333333333,  5.86},
+{1529, NULL, 72.3033333333333, 31.4372222222222,  5.58},
+{1530, "Kap Dor", 71.0879166666667, -59.7327777777778,  5.27},
+{1531, NULL, 69.5904166666667, -77.6561111111111,  6.05},
+{1532, "58    Eri", 71.90125, -16.9344444444444,  5.51},
+{1533, NULL, 72.4775, 37.4883333333333,  4.88},
+{1534, NULL, 72.1858333333333, 3.58833333333333,  6.03},
+{1535, NULL, 72.78875, 48.7408333333333,  5.66},
+{1536, NULL, 72.15125, -5.67388888888889,  5.78},
+{1537, "96    Tau", 72.43375, 15.9041666666667,  6.08},
+{1538, "59    Eri", 72.1354166666667, -16.3294444444444,  5.77},
+{1539, "Zet Cae", 71.9566666666667, -30.0202777777778,  6.37},
+{1540, NULL, 71.24125, -63.2297222222222,  6.46},
+{1541, "Mu  Men", 70.76625, -70.9311111111111,  5.54},
+{1542, "9Alp Cam", 73.5125, 66.3427777777778,  4.29},
+{1543, "1Pi 3Ori", 72.46, 6.96138888888889,  3.19},
+{1544, "2Pi 2Ori", 72.6529166666667, 8.90027777777778,  4.36},
+{1545, NULL, 72.4258333333333, -13.7697222222222,  6.26},
+{1546, NULL, 73.2908333333333, 52.8408333333333,  6.41},
+{1547, "97    Tau", 72.84375, 18.8397222222222,  5.10},
+{1548, NULL, 72.1408333333333, -43.98,  6.72},
+{1549, "60    Eri", 72.5483333333333, -16.2172222222222,  5.03},
+{1550, NULL, 73.1991666666667, 42.5866666666667,  5.71},
+{1551, "2    Aur", 73.1583333333333, 36.7030555555556,  4.78},
+{1552, "3Pi 4Ori", 72.8016666666667, 5.605,  3.69},
+{1553, NULL, 72.9308333333333, 9.975,  6.11},
+{1554, NULL, 73.19625, 27.8975,  5.97},
+{1555, "5    Cam", 73.7629166666667, 55.2591666666667,  5.52},
+{1556, "4Omi1Ori", 73.1333333333333, 14.2505555555556,  4.74},
+{1557, NULL, 72.5675, -41.3208333333333,  6.07},
+{1558, NULL, 73.71375, 44.0608333333333,  6.08},
+{1559, NULL, 72.8675, -34.9063888888889,  5.86},
+{1560, "61Ome Eri", 73.22375, -5.45277777777778,  4.39},
+{1561, NULL, 74.0295833333333, 52.8694444444444,  5.75},
+{1562, "5    Ori", 73.345, 2.50805555555556,  5.33},
+{1563, "Iot Pic", 72.73, -53.4613888888889,  5.61},
+{1564, "Iot Pic", 72.7345833333333, -53.4597222222222,  6.42},
+{1565, NULL, 73.4825, 1.56944444444444,  6.61},
+{1566, NULL, 73.7429166666667, 19.4852777777778,  6.37},
+{1567, "8Pi 5Ori", 73.5629166666667, 2.44055555555556,  3.72},
+{1568, "7    Cam", 74.3216666666667, 53.7522222222222,  4.47},
+{1569, "6    Ori", 73.6954166666667, 11.4261111111111,  5.19},
+{1570, "7Pi 1Ori", 73.7241666666667, 10.1508333333333,  4.65},
+{1571, NULL, 73.6991666666667, 7.77916666666667,  5.33},
+{1572, NULL, 75.58375, 74.2691666666667,  6.06},
+{1573, NULL, 74.0829166666667, 36.1688888888889,  6.07},
+{1574, NULL, 73.71125, 0.4675,  5.99},
+{1575, NULL, 74.065, 24.5922222222222,  6.37},
+{1576, NULL, 73.9595833333333, 15.04,  5.81},
+{1577, "3Iot Aur", 74.2483333333333, 33.1661111111111,  2.69},
+{1578, NULL, 73.9933333333333, 5.39916666666667,  6.50},
+{1579, NULL, 73.7783333333333, -16.7405555555556,  5.70},
+{1580, "9Omi2Ori", 74.0929166666667, 13.5144444444444,  4.07},
+{1581, NULL, 73.8275, -16.4177777777778,  5.72},
+{1582, "62    Eri", 74.1008333333333, -5.17138888888889,  5.51},
+{1583, NULL, 73.8758333333333, -25.7277777777778,  6.72},
+{1584, NULL, 73.7283333333333, -39.6286111111111,  6.10},
+{1585, NULL, 74.3429166666667, 17.1536111111111,  5.48},
+{1586, "99    Tau", 74.4529166666667, 23.9486111111111,  5.79},
+{1587, NULL, 76.0541666666667, 73.7638888888889,  6.66},
+{1588, "8    Cam", 74.9429166666667, 53.1555555555556,  6.08},
+{1589, NULL, 76.1658333333333, 74.0669444444444,  5.96},
+{1590, "98    Tau", 74.5391666666667, 25.0502777777778,  5.81},
+{1591, NULL, 74.3216666666667, -1.06722222222222,  6.23},
+{1592, "4Ome Aur", 74.8141666666667, 37.8902777777778,  4.94},
+{1593, NULL, 75.3995833333333, 61.0780555555556,  6.03},
+{1594, NULL, 75.71, 66.8227777777778,  6.19},
+{1595, NULL, 74.4366666666667, -14.2313888888889,  6.15},
+{1596, NULL, 74.545, -2.2125,  6.35},
+{1597, NULL, 73.7208333333333, -58.5472222222222,  6.12},
+{1598, NULL, 73.3770833333333, -66.6755555555556,  6.41},
+{1599, "5    Aur", 75.07625, 39.3947222222222,  5.95},
+{1600, NULL, 74.7475, 14.5427777777778,  6.09},
+{1601, "10Pi 6Ori", 74.6370833333333, 1.71416666666667,  4.47},
+{1602, "6    Aur", 75.0966666666667, 39.655,  6.58},
+{1603, "10Bet Cam", 75.8545833333333, 60.4422222222222,  4.03},
+{1604, NULL, 74.7554166666667, -16.3758333333333,  5.66},
+{1605, "7Eps Aur", 75.4920833333333, 43.8233333333333,  2.99},
+{1606, NULL, 73.2729166666667, -72.4075,  6.28},
+{1607, NULL, 74.9020833333333, -14.8058333333333,  7.71},
+{1608, "63    Eri", 74.96, -10.2633333333333,  5.38},
+{1609, NULL, 75.1358333333333, 3.61527777777778,  7.03},
+{1610, NULL, 75.14125, 3.61611111111111,  6.66},
+{1611, "64    Eri", 74.9825, -12.5375,  4.79},
+{1612, "8Zet Aur", 75.6195833333333, 41.0758333333333,  3.75},
+{1613, NULL, 75.1658333333333, -2.06555555555556,  6.32},
+{1614, NULL, 75.2041666666667, -5.75333333333333,  6.22},
+{1615, NULL, 75.8275, 41.4416666666667,  6.14},
+{1616, NULL, 82.95, 85.9386111111111,  6.51},
+{1617, "65Psi Eri", 75.3595833333333, -7.17388888888889,  4.81},
+{1618, NULL, 75.4595833333333, 0.722222222222222,  5.92},
+{1619, NULL, 75.5, 1.60888888888889,  6.24},
+{1620, "102Iot Tau", 75.77375, 21.59,  4.64},
+{1621, NULL, 75.3566666666667, -20.0519444444444,  4.91},
+{1622, "11    Cam", 76.5354166666667, 58.9725,  5.08},
+{1623, "12    Cam", 76.5508333333333, 59.0211111111111,  6.08},
+{1624, NULL, 76.62375, 61.17,  6.04},
+{1625, NULL, 75.6895833333333, -4.20972222222222,  5.85},
+{1626, NULL, 76.0604166666667, 30.4947222222222,  6.14},
+{1627, NULL, 76.15375, 32.3202777777778,  6.62},
+{1628, NULL, 75.5408333333333, -26.275,  5.02},
+{1629, "Eta Men", 73.7966666666667, -74.9369444444444,  5.47},
+{1630, NULL, 76.5916666666667, 54.4058333333333,  7.24},
+{1631, NULL, 75.39375, -39.7180555555556,  6.03},
+{1632, NULL, 76.1579166666667, 27.6961111111111,  6.60},
+{1633, NULL, 76.09, 21.2780555555556,  6.19},
+{1634, "1    Lep", 75.6870833333333, -22.795,  5.75},
+{1635, NULL, 75.595, -31.7713888888889,  5.94},
+{1636, NULL, 77.4029166666667, 69.6394444444445,  6.41},
+{1637, "9    Aur", 76.6691666666667, 51.5977777777778,  5.00},
+{1638, "11    Ori", 76.1420833333333, 15.4041666666667,  4.68},
+{1639, NULL, 76.50375, 35.9363888888889,  6.52},
+{1640, NULL, 75.9666666666667, -14.3694444444444,  6.41},
+{1641, "10Eta Aur", 76.62875, 41.2344444444444,  3.17},
+{1642, NULL, 76.38375, 19.8063888888889,  6.44},
+{1643, NULL, 78.0933333333333, 73.9466666666667,  5.43},
+{1644, NULL, 76.7066666666666, 43.1747222222222,  6.20},
+{1645, NULL, 75.9720833333333, -24.3877777777778,  5.61},
+{1646, NULL, 76.2270833333333, -3.03972222222222,  6.05},
+{1647, NULL, 77.4354166666667, 64.9194444444445,  6.41},
+{1648, NULL, 76.34875, 1.1775,  6.17},
+{1649, "Eta1Pic", 75.7025, -49.1513888888889,  5.38},
+{1650, NULL, 78.6483333333333, 76.4727777777778,  6.37},
+{1651, NULL, 75.975, -41.745,  6.31},
+{1652, "Gam1Cae", 76.1016666666667, -35.4833333333333,  4.55},
+{1653, "Gam2Cae", 76.10875, -35.7052777777778,  6.34},
+{1654, "2Eps Lep", 76.3654166666667, -22.3711111111111,  3.19},
+{1655, NULL, 76.3175, -26.1525,  5.73},
+{1656, "104    Tau", 76.8625, 18.645,  5.00},
+{1657, "66    Eri", 76.6904166666667, -4.655,  5.12},
+{1658, "106    Tau", 76.9516666666667, 20.4183333333333,  5.30},
+{1659, "103    Tau", 77.0275, 24.2652777777778,  5.50},
+{1660, "105    Tau", 76.98125, 21.7047222222222,  5.89},
+{1661, NULL, 76.6529166666667, -13.1219444444444,  6.05},
+{1662, "13    Ori", 76.9095833333333, 9.47194444444444,  6.17},
+{1663, "Eta2Pic", 76.2416666666667, -49.5777777777778,  5.03},
+{1664, "14    Ori", 76.9704166666667, 8.49833333333333,  5.34},
+{1665, NULL, 76.8541666666667, -12.4905555555556,  5.97},
+{1666, "67Bet Eri", 76.9625, -5.08638888888889,  2.79},
+{1667, NULL, 76.2525, -54.4075,  6.27},
+{1668, NULL, 77.67875, 46.9622222222222,  5.68},
+{1669, NULL, 77.57875, 37.3019444444444,  6.02},
+{1670, NULL, 77.4379166666667, 28.0305555555556,  6.01},
+{1671, NULL, 77.0841666666667, -8.665,  5.78},
+{1672, "16    Ori", 77.3316666666667, 9.82944444444444,  5.43},
+{1673, "68    Eri", 77.1816666666667, -4.45611111111111,  5.12},
+{1674, "Zet Dor", 76.3775, -57.4727777777778,  4.72},
+{1675, NULL, 78.2633333333333, 61.85,  6.17},
+{1676, "15    Ori", 77.425, 15.5972222222222,  4.82},
+{1677, "Bet Men", 75.6791666666667, -71.3144444444444,  5.31},
+{1678, "14    Cam", 78.3804166666667, 62.6913888888889,  6.50},
+{1679, "69Lam Eri", 77.2866666666667, -8.75416666666667,  4.27},
+{1680, NULL, 77.0616666666667, -35.7183333333333,  6.52},
+{1681, NULL, 77.5133333333333, -0.565277777777778,  6.10},
+{1682, NULL, 75.055, -78.3002777777778,  6.29},
+{1683, NULL, 79.5554166666667, 73.2680555555555,  5.74},
+{1684, NULL, 77.9233333333333, 16.0455555555556,  5.18},
+{1685, NULL, 77.7416666666667, -2.25388888888889,  6.25},
+{1686, NULL, 80.6395833333333, 79.2311111111111,  5.05},
+{1687, NULL, 77.83, -2.49083333333333,  5.90},
+{1688, NULL, 78.7970833333333, 59.4055555555556,  6.15},
+{1689, "11Mu  Aur", 78.3570833333333, 38.4844444444444,  4.86},
+{1690, NULL, 77.9225, 0.514722222222222,  6.67},
+{1691, NULL, 77.93875, 1.03694444444444,  5.89},
+{1692, NULL, 78.6845833333333, 53.2138888888889,  6.20},
+{1693, NULL, 77.845, -11.8491666666667,  5.68},
+{1694, NULL, 77.6854166666667, -25.9094444444444,  6.41},
+{1695, NULL, 76.8916666666667, -63.3997222222222,  5.2 },
+{1696, "3Iot Lep", 78.0745833333333, -11.8691666666667,  4.45},
+{1697, NULL, 78.2008333333333, -6.05722222222222,  5.91},
+{1698, "17Rho Ori", 78.3229166666667, 2.86111111111111,  4.46},
+{1699, NULL, 77.8995833333333, -37.3952777777778,  6.57},
+{1700, NULL, 76.53875, -73.0377777777778,  6.27},
+{1701, NULL, 78.3816666666667, 1.96805555555556,  6.09},
+{1702, "5Mu  Lep", 78.2329166666667, -16.2055555555556,  3.31},
+{1703, NULL, 78.4466666666667, 0.560277777777778,  6.32},
+{1704, NULL, 78.38875, -8.14777777777778,  6.37},
+{1705, "4Kap Lep", 78.3079166666667, -12.9413888888889,  4.36},
+{1706, "14    Aur", 78.8516666666667, 32.6877777777778,  5.02},
+{1707, NULL, 79.3241666666667, 53.5861111111111,  6.5 },
+{1708, "13Alp Aur", 79.1725, 45.9980555555556,  0.08},
+{1709, NULL, 78.68375, 5.15611111111111,  5.50},
+{1710, NULL, 78.4995833333333, -14.6066666666667,  6.21},
+{1711, "108    Tau", 78.8654166666667, 22.2847222222222,  6.27},
+{1712, NULL, 79.0758333333333, 34.3119444444444,  5.96},
+{1713, "19Bet Ori", 78.6345833333333, -8.20166666666667,  0.12},
+{1714, NULL, 85.9529166666667, 85.6680555555556,  6.60},
+{1715, NULL, 78.44375, -35.8255555555556,  6.98},
+{1716, "Xi  Men", 74.7120833333333, -82.4705555555556,  5.85},
+{1717, NULL, 78.8266666666667, -1.40916666666667,  6.15},
+{1718, "18    Ori", 79.0170833333333, 11.3413888888889,  5.56},
+{1719, "15    Cam", 79.8658333333333, 58.1172222222222,  6.13},
+{1720, NULL, 80.0941666666667, 62.6536111111111,  5.61},
+{1721, NULL, 78.62, -35.9772222222222,  5.76},
+{1722, NULL, 79.56625, 42.7922222222222,  5.48},
+{1723, NULL, 78.85125, -26.9433333333333,  5.07},
+{1724, NULL, 79.17125, 1.94722222222222,  6.42},
+{1725, NULL, 79.6683333333333, 40.465,  6.18},
+{1726, "16    Aur", 79.5445833333333, 33.3716666666667,  4.54},
+{1727, NULL, 78.4720833333333, -52.0311111111111,  6.05},
+{1728, "17    Aur", 79.57875, 33.7672222222222,  6.14},
+{1729, "15Lam Aur", 79.7854166666667, 40.0991666666667,  4.71},
+{1730, NULL, 78.9458333333333, -34.9266666666667,  6.66},
+{1731, NULL, 79.2004166666667, -17.1416666666667,  6.56},
+{1732, NULL, 79.75, 33.7483333333333,  5.41},
+{1733, NULL, 80.0095833333333, 44.4255555555556,  6.62},
+{1734, "18    Aur", 79.8483333333333, 33.9855555555556,  6.49},
+{1735, "20Tau Ori", 79.4016666666667, -6.84444444444444,  3.60},
+{1736, NULL, 80.16375, 46.9638888888889,  6.54},
+{1737, NULL, 79.4175, -13.5197222222222,  5.50},
+{1738, NULL, 80.0616666666667, 41.0861111111111,  5.52},
+{1739, "109    Tau", 79.8191666666667, 22.0963888888889,  4.94},
+{1740, "19    Aur", 80.00375, 33.9580555555556,  5.03},
+{1741, NULL, 79.81125, 20.1347222222222,  6.08},
+{1742, NULL, 78.9120833333333, -52.1819444444444,  6.49},
+{1743, "Omi Col", 79.37125, -34.8952777777778,  4.83},
+{1744, "The Dor", 78.4391666666667, -67.1852777777778,  4.83},
+{1745, NULL, 82.3570833333333, 77.9775,  6.56},
+{1746, "21    Ori", 79.7966666666667, 2.59583333333333,  5.34},
+{1747, NULL, 79.71, -18.13,  5.96},
+{1748, NULL, 79.8966666666667, -1.41222222222222,  6.34},
+{1749, "20Rho Aur", 80.4516666666667, 41.8044444444444,  5.23},
+{1750, NULL, 80.2470833333333, 27.9572222222222,  6.33},
+{1751, "16    Cam", 80.8658333333333, 57.5444444444444,  5.28},
+{1752, NULL, 80.3029166666667, 29.57,  5.76},
+{1753, NULL, 79.8229166666667, -18.52,  6.36},
+{1754, NULL, 79.82625, -18.5097222222222,  6.54},
+{1755, NULL, 80.2358333333333, 19.8141666666667,  6.18},
+{1756, "6Lam Lep", 79.89375, -13.1766666666667,  4.29},
+{1757, "7Nu  Lep", 79.99625, -12.3155555555556,  5.30},
+{1758, NULL, 79.84875, -27.3688888888889,  5.99},
+{1759, NULL, 80.11, -5.36666666666667,  6.39},
+{1760, NULL, 80.7095833333333, 41.0294444444444,  5.54},
+{1761, NULL, 80.3304166666667, 4.01194444444444,  6.57},
+{1762, NULL, 80.1120833333333, -21.2394444444444,  4.71},
+{1763, NULL, 80.4316666666667, 8.42861111111111,  5.80},
+{1764, NULL, 80.3825, -0.416388888888889,  5.68},
+{1765, "22    Ori", 80.4404166666667, -0.3825,  4.73},
+{1766, NULL, 80.0858333333333, -34.6988888888889,  6.34},
+{1767, "Zet Pic", 79.8420833333333, -50.6061111111111,  5.45},
+{1768, "22    Aur", 80.8454166666667, 28.9366666666667,  6.46},
+{1769, NULL, 80.4625, -13.7561111111111,  6.56},
+{1770, "23    Ori", 80.7083333333333, 3.54444444444444,  5.00},
+{1771, NULL, 80.4425, -24.7730555555556,  5.06},
+{1772, NULL, 80.3204166666667, -34.3452777777778,  6.09},
+{1773, "21Sig Aur", 81.1633333333333, 37.3855555555556,  4.99},
+{1774, "110    Tau", 80.9070833333333, 16.6994444444444,  6.08},
+{1775, NULL, 81.1595833333333, 31.2238888888889,  6.28},
+{1776, NULL, 81.1604166666667, 31.1430555555556,  5.94},
+{1777, NULL, 80.8795833333333, 5.3225,  6.35},
+{1778, NULL, 80.8270833333333, -8.41583333333333,  5.9 },
+{1779, NULL, 81.3041666666667, 34.8552777777778,  6.55},
+{1780, "111    Tau", 81.1058333333333, 17.3833333333333,  4.99},
+{1781, NULL, 80.92625, -0.159722222222222,  5.70},
+{1782, NULL, 80.9641666666667, -0.867222222222222,  6.11},
+{1783, "8    Lep", 80.8758333333333, -13.9272222222222,  5.25},
+{1784, "29    Ori", 80.9866666666667, -7.80805555555556,  4.14},
+{1785, NULL, 80.8, -26.7058333333333,  6.49},
+{1786, NULL, 81.1508333333333, 2.35277777777778,  6.32},
+{1787, "27    Ori", 81.1204166666667, -0.891388888888889,  5.08},
+{1788, "28Eta Ori", 81.1191666666667, -2.39694444444444,  3.36},
+{1789, "25Psi1Ori", 81.1866666666667, 1.84638888888889,  4.95},
+{1790, "24Gam Ori", 81.2829166666667, 6.34972222222222,  1.64},
+{1791, "112Bet Tau", 81.5729166666667, 28.6075,  1.65},
+{1792, NULL, 81.1183333333333, -16.9761111111111,  5.65},
+{1793, NULL, 80.85, -39.6786111111111,  5.71},
+{1794, NULL, 81.72625, 35.4572222222222,  6.15},
+{1795, NULL, 81.70375, 34.3916666666667,  5.94},
+{1796, NULL, 81.71375, 33.2627777777778,  6.15},
+{1797, NULL, 80.9125, -37.3366666666667,  6.82},
+{1798, "113    Tau", 81.52375, 16.7002777777778,  6.25},
+{1799, NULL, 81.2566666666667, -10.3291666666667,  5.61},
+{1800, NULL, 81.38, -0.544166666666667,  6.57},
+{1801, "Kap Pic", 80.5920833333333, -56.1344444444444,  6.11},
+{1802, "17    Cam", 82.5425, 63.0672222222222,  5.42},
+{1803, NULL, 81.4458333333333, 0.520833333333333,  6.16},
+{1804, NULL, 81.7845833333333, 30.2086111111111,  5.74},
+{1805, "24Phi Aur", 81.9120833333333, 34.4758333333333,  5.07},
+{1806, NULL, 81.51, -5.51833333333333,  6.23},
+{1807, NULL, 81.6616666666667, 6.86916666666667,  6.42},
+{1808, "115    Tau", 81.7920833333333, 17.9622222222222,  5.42},
+{1809, NULL, 81.8075, 15.2577777777778,  6.16},
+{1810, "114    Tau", 81.90875, 21.9369444444444,  4.88},
+{1811, "30Psi2Ori", 81.7091666666667, 3.09555555555556,  4.59},
+{1812, NULL, 81.4991666666667, -19.6955555555556,  5.89},
+{1813, NULL, 81.2316666666667, -44.2258333333333,  6.08},
+{1814, "116    Tau", 81.94, 15.8741666666667,  5.50},
+{1815, NULL, 78.1070833333333, -81.5416666666667,  6.51},
+{1816, "117    Tau", 82.0066666666667, 17.2388888888889,  5.77},
+{1817, NULL, 81.77, -11.9008333333333,  6.35},
+{1818, "The Pic", 81.1925, -52.3163888888889,  6.27},
+{1819, NULL, 82.145, 13.6788888888889,  6.35},
+{1820, NULL, 82.0066666666667, 1.29833333333333,  6.41},
+{1821, "118    Tau", 82.31875, 25.1505555555556,  5.47},
+{1822, NULL, 82.4191666666667, 29.1863888888889,  6.24},
+{1823, NULL, 81.9020833333333, -21.3755555555556,  6.07},
+{1824, NULL, 82.7025, 41.4619444444444,  6.00},
+{1825, NULL, 82.6879166666667, 39.8258333333333,  6.37},
+{1826, NULL, 82.23625, -3.3075,  6.39},
+{1827, NULL, 81.7720833333333, -40.9436111111111,  5.87},
+{1828, "18    Cam", 83.1408333333333, 57.2211111111111,  6.48},
+{1829, "9Bet Lep", 82.06125, -20.7594444444444,  2.84},
+{1830, NULL, 82.3483333333333, -3.44638888888889,  5.79},
+{1831, NULL, 82.6808333333333, 22.4625,  6.29},
+{1832, NULL, 82.60875, 15.3602777777778,  5.94},
+{1833, NULL, 82.4783333333333, 1.78916666666667,  5.78},
+{1834, "31    Ori", 82.4333333333333, -1.09222222222222,  4.71},
+{1835, NULL, 82.06375, -37.2305555555556,  5.57},
+{1836, "Lam Dor", 81.5804166666667, -58.9125,  5.14},
+{1837, NULL, 82.5825, 4.20416666666667,  6.21},
+{1838, NULL, 82.2779166666667, -30.1166666666667,  6.75},
+{1839, "32    Ori", 82.69625, 5.94805555555556,  4.20},
+{1840, NULL, 82.58625, -7.43472222222222,  6.33},
+{1842, "33    Ori", 82.8104166666667, 3.29222222222222,  5.46},
+{1843, "25Chi Aur", 83.1820833333333, 32.1919444444444,  4.76},
+{1844, NULL, 84.9320833333333, 75.0438888888889,  6.17},
+{1845, "119    Tau", 83.0533333333333, 18.5944444444444,  4.38},
+{1846, NULL, 83.3695833333333, 42.1088888888889,  6.55},
+{1847, NULL, 83.0591666666667, 17.0580555555556,  5.46},
+{1848, NULL, 82.8370833333333, -6.70833333333333,  6.22},
+{1849, "10    Lep", 82.7816666666667, -20.8636111111111,  5.55},
+{1850, NULL, 83.3645833333333, 32.8011111111111,  6.48},
+{1851, "34Del Ori", 83.0020833333333, -0.284444444444444,  6.85},
+{1852, "34Del Ori", 83.0016666666667, -0.299166666666667,  2.23},
+{1853, NULL, 84.3175, 66.6961111111111,  6.26},
+{1854, NULL, 83.4083333333333, 34.7258333333333,  6.27},
+{1855, "36Ups Ori", 82.9825, -7.30138888888889,  4.62},
+{1856, NULL, 82.5395833333333, -47.0777777777778,  5.46},
+{1857, "19    Cam", 84.3129166666667, 64.1547222222222,  6.15},
+{1858, "120    Tau", 83.3816666666667, 18.5402777777778,  5.69},
+{1859, NULL, 81.75, -68.6227777777778,  6.03},
+{1860, NULL, 83.4116666666667, 20.4741666666667,  6.18},
+{1861, NULL, 83.1720833333333, -1.59194444444444,  5.35},
+{1862, "Eps Col", 82.8029166666667, -35.4705555555556,  3.87},
+{1863, NULL, 83.28, -1.71833333333333,  6.46},
+{1864, "35    Ori", 83.47625, 14.3055555555556,  5.64},
+{1865, "11Alp Lep", 83.1825, -17.8222222222222,  2.58},
+{1866, NULL, 84.1466666666667, 54.4288888888889,  5.73},
+{1867, NULL, 82.3225, -62.3144444444444,  6.59},
+{1868, NULL, 83.3808333333333, -1.15611111111111,  5.34},
+{1869, NULL, 84.06625, 47.7152777777778,  6.11},
+{1870, NULL, 82.9004166666667, -45.9252777777778,  5.86},
+{1871, NULL, 83.49, 1.40777777777778,  6.59},
+{1872, "38    Ori", 83.5695833333333, 3.76694444444444,  5.36},
+{1873, NULL, 83.51625, -1.03555555555556,  6.22},
+{1874, NULL, 83.5166666666667, -1.47055555555556,  5.93},
+{1875, "121    Tau", 83.8629166666667, 24.0394444444444,  5.38},
+{1876, "37Phi1Ori", 83.705, 9.48944444444444,  4.41},
+{1877, NULL, 83.21375, -38.5130555555556,  5.48},
+{1878, NULL, 83.98125, 27.6622222222222,  6.27},
+{1879, "39Lam Ori", 83.7845833333333, 9.93416666666667,  3.54},
+{1880, "39Lam Ori", 83.7854166666667, 9.935,  5.61},
+{1881, NULL, 83.2808333333333, -35.1397222222222,  5.78},
+{1882, NULL, 82.56625, -63.9277777777778,  6.19},
+{1883, NULL, 83.8058333333333, 10.24,  5.60},
+{1884, NULL, 84.2183333333333, 40.1822222222222,  6.09},
+{1885, NULL, 90.3341666666667, 85.1822222222222,  6.11},
+{1886, NULL, 83.75375, -6.00916666666667,  5.67},
+{1887, NULL, 83.76125, -6.00194444444444,  4.78},
+{1888, NULL, 83.4670833333333, -29.8488888888889,  6.53},
+{1889, NULL, 84.1258333333333, 25.9394444444444,  6.49},
+{1890, NULL, 83.8408333333333, -4.49333333333333,  6.56},
+{1891, NULL, 83.84375, -4.42527777777778,  6.24},
+{1892, "42    Ori", 83.8466666666666, -4.83833333333333,  4.59},
+{1893, "41The1Ori", 83.81625, -5.38722222222222,  6.73},
+{1894, "41The1Ori", 83.8170833333333, -5.38527777777778,  7.96},
+{1895, "41The1Ori", 83.81875, -5.38972222222222,  5.13},
+{1896, "41The1Ori", 83.8220833333333, -5.38777777777778,  6.70},
+{1897, "43The2Ori", 83.8454166666667, -5.41611111111111,  5.08},
+{1898, NULL, 83.8795833333333, -4.36472222222222,  6.38},
+{1899, "44Iot Ori", 83.8583333333333, -5.91,  2.77},
+{1900, NULL, 83.8991666666667, -3.25277777777778,  6.40},
+{1901, "45    Ori", 83.9145833333333, -4.85583333333333,  5.26},
+{1902, NULL, 84.2866666666667, 26.9241666666667,  5.83},
+{1903, "46Eps Ori", 84.0533333333333, -1.20194444444444,  1.70},
+{1904, NULL, 84.4404166666667, 33.5591666666667,  6.33},
+{1905, "122    Tau", 84.2658333333333, 17.0402777777778,  5.54},
+{1906, NULL, 84.0625, -5.64805555555555,  6.54},
+{1907, "40Phi2Ori", 84.22625, 9.29055555555555,  4.09},
+{1908, NULL, 84.2683333333333, 11.035,  5.94},
+{1909, NULL, 83.8141666666667, -33.08,  5.78},
+{1910, "123Zet Tau", 84.41125, 21.1425,  3.00},
+{1911, NULL, 84.14875, -6.065,  5.72},
+{1912, NULL, 83.435, -54.9022222222222,  6.43},
+{1913, NULL, 84.3304166666667, 8.95194444444444,  6.12},
+{1914, "26    Aur", 84.65875, 30.4925,  5.40},
+{1915, NULL, 84.0429166666667, -28.7077777777778,  6.26},
+{1916, NULL, 85.61, 65.6977777777778,  5.60},
+{1917, NULL, 83.2483333333333, -64.2275,  5.34},
+{1918, NULL, 84.3641666666667, -5.93833333333333,  6.05},
+{1919, NULL, 84.2866666666667, -11.7755555555556,  6.11},
+{1920, NULL, 84.5045833333333, 7.54138888888889,  5.88},
+{1921, NULL, 84.7391666666666, 26.6177777777778,  6.37},
+{1922, "Bet Dor", 83.40625, -62.4897222222222,  3.76},
+{1923, NULL, 84.4725, -4.81361111111111,  6.19},
+{1924, NULL, 84.8266666666667, 29.2152777777778,  5.96},
+{1925, NULL, 85.3345833333333, 53.4811111111111,  6.23},
+{1926, "Nu 1Col", 84.31875, -27.8713888888889,  6.16},
+{1927, NULL, 84.01125, -47.3138888888889,  6.11},
+{1928, "125    Tau", 84.9341666666667, 25.8969444444444,  5.18},
+{1929, NULL, 84.8625, 21.7627777777778,  6.34},
+{1930, NULL, 83.76, -58.8711111111111,  6.75},
+{1931, "48Sig Ori", 84.6866666666667, -2.6,  3.81},
+{1932, NULL, 84.69625, -2.59416666666667,  6.65},
+{1933, NULL, 84.6575, -6.57388888888889,  5.96},
+{1934, "47Ome Ori", 84.79625, 4.12138888888889,  4.57},
+{1935, "Nu 2Col", 84.4358333333333, -28.6894444444444,  5.31},
+{1936, NULL, 83.74, -61.1758333333333,  6.32},
+{1937, "49    Ori", 84.72125, -7.21305555555556,  4.80},
+{1938, NULL, 85.1495833333333, 31.3580555555556,  6.04},
+{1939, NULL, 85.1754166666667, 31.9208333333333,  6.11},
+{1940, NULL, 84.88, -3.56472222222222,  6.00},
+{1941, "24    Cam", 85.7566666666667, 56.5816666666667,  6.05},
+{1942, NULL, 84.8783333333333, -9.70666666666667,  6.50},
+{1943, "23    Cam", 86.0358333333333, 61.4766666666667,  6.15},
+{1944, NULL, 84.8179166666667, -17.8494444444444,  6.38},
+{1945, NULL, 85.3375, 29.4875,  6.43},
+{1946, "126    Tau", 85.32375, 16.5338888888889,  4.86},
+{1947, NULL, 84.6816666666667, -40.7075,  5.82},
+{1948, "50Zet Ori", 85.1895833333333, -1.94277777777778,  2.05},
+{1949, "50Zet Ori", 85.19, -1.94277777777778,  4.21},
+{1950, NULL, 85.1554166666667, -2.825,  6.22},
+{1951, NULL, 85.4775, 23.3263888888889,  6.59},
+{1952, NULL, 85.2108333333333, -1.12888888888889,  4.95},
+{1953, "Gam Men", 82.9704166666667, -76.3411111111111,  5.19},
+{1954, NULL, 85.51625, 22.6602777777778,  6.36},
+{1955, NULL, 85.2733333333333, 0.337777777777778,  5.93},
+{1956, "Alp Col", 84.9120833333333, -34.0741666666667,  2.64},
+{1957, NULL, 85.1916666666667, -10.4094444444444,  6.52},
+{1958, NULL, 84.9575, -32.6291666666667,  5.45},
+{1959, NULL, 85.4179166666667, -2.89611111111111,  6.42},
+{1960, NULL, 84.2279166666667, -66.5602777777778,  6.31},
+{1961, NULL, 85.83125, 23.2041666666667,  6.21},
+{1962, NULL, 85.4229166666667, -16.7255555555556,  6.21},
+{1963, "51    Ori", 85.6191666666667, 1.47472222222222,  4.91},
+{1964, NULL, 83.68625, -73.7413888888889,  5.78},
+{1965, NULL, 85.5595833333333, -17.5302777777778,  6.15},
+{1966, NULL, 85.3625, -33.4005555555556,  6.34},
+{1967, NULL, 85.7241666666667, -6.79611111111111,  6.02},
+{1968, "12    Lep", 85.5579166666667, -22.3736111111111,  5.87},
+{1969, "26    Cam", 86.6266666666667, 56.1155555555556,  5.94},
+{1970, NULL, 85.78875, -1.61305555555556,  6.31},
+{1971, "27Omi Aur", 86.475, 49.8263888888889,  5.47},
+{1972, NULL, 85.5483333333333, -30.5355555555556,  6.19},
+{1973, NULL, 85.5629166666667, -34.6677777777778,  5.29},
+{1974, NULL, 86.45625, 40.5072222222222,  6.58},
+{1975, NULL, 85.84, -18.5575,  5.73},
+{1976, NULL, 87.2704166666667, 62.8080555555556,  6.13},
+{1977, NULL, 86.4141666666667, 20.695,  6.95},
+{1978, NULL, 86.2579166666667, 4.00805555555556,  6.09},
+{1979, NULL, 86.81125, 42.5266666666667,  6.29},
+{1980, NULL, 86.1183333333333, -20.1263888888889,  6.34},
+{1981, NULL, 85.8758333333333, -39.4069444444444,  6.25},
+{1982, NULL, 86.1104166666667, -22.4216666666667,  6.15},
+{1983, "13Gam Lep", 86.1158333333333, -22.4483333333333,  3.60},
+{1984, NULL, 85.92125, -45.8330555555556,  6.39},
+{1985, "129    Tau", 86.6895833333333, 15.8225,  6.00},
+{1986, NULL, 86.5116666666667, -4.26833333333333,  6.34},
+{1987, NULL, 86.7170833333333, 9.52222222222222,  5.79},
+{1988, NULL, 86.6458333333333, 1.16805555555556,  5.95},
+{1989, "131    Tau", 86.805, 14.4883333333333,  5.72},
+{1990, "130    Tau", 86.8591666666667, 17.7291666666667,  5.49},
+{1991, "Iot Men", 83.90125, -78.8208333333333,  6.05},
+{1992, "29    Cam", 87.6416666666667, 56.9188888888889,  6.54},
+{1993, "133    Tau", 86.92875, 13.8997222222222,  5.29},
+{1994, NULL, 88.23125, 68.4713888888889,  6.20},
+{1995, "29Tau Aur", 87.29375, 39.1811111111111,  4.52},
+{1996, "Mu  Col", 86.4995833333333, -32.3063888888889,  5.17},
+{1997, NULL, 87.0933333333333, 20.8694444444444,  6.07},
+{1998, "14Zet Lep", 86.73875, -14.8219444444444,  3.55},
+{1999, "52    Ori", 87.0008333333333, 6.45416666666667,  5.27},
+{2000, NULL, 86.7816666666667, -16.2377777777778,  6.17},
+{2001, NULL, 86.86125, -10.5330555555556,  6.03},
+{2002, "132    Tau", 87.2541666666667, 24.5675,  4.86},
+{2003, NULL, 87.735, 51.5147222222222,  6.29},
+{2004, "53Kap Ori", 86.9391666666667, -9.66972222222222,  2.06},
+{2005, NULL, 86.7695833333333, -28.6391666666667,  6.22},
+{2006, "30    Cam", 88.0725, 58.9641666666667,  6.14},
+{2007, NULL, 87.1454166666667, -4.09472222222222,  5.97},
+{2008, NULL, 86.6141666666667, -46.5972222222222,  5.31},
+{2009, NULL, 86.8275, -35.6747222222222,  6.32},
+{2010, "134    Tau", 87.3870833333333, 12.6511111111111,  4.91},
+{2011, "31Ups Aur", 87.76, 37.3055555555556,  4.74},
+{2012, "32Nu  Aur", 87.8725, 39.1486111111111,  3.97},
+{2013, NULL, 87.7420833333333, 27.9677777777778,  5.56},
+{2014, NULL, 87.5108333333333, 9.87111111111111,  5.80},
+{2015, "Del Dor", 86.1933333333333, -65.7355555555555,  4.35},
+{2016, "135    Tau", 87.6204166666667, 14.3055555555556,  5.52},
+{2017, NULL, 86.9920833333333, -40.6525,  6.61},
+{2018, NULL, 87.8570833333333, 32.125,  6.25},
+{2019, NULL, 87.5545833333333, 4.42333333333333,  5.97},
+{2020, "Bet Pic", 86.82125, -51.0663888888889,  3.85},
+{2021, NULL, 87.4020833333333, -14.4836111111111,  5.49},
+{2022, "Pi  Men", 84.2908333333333, -80.4691666666667,  5.65},
+{2023, NULL, 86.8041666666667, -54.3608333333333,  6.18},
+{2024, NULL, 87.625, 2.02444444444444,  5.98},
+{2025, NULL, 88.1645833333333, 39.5744444444444,  6.45},
+{2026, NULL, 87.4729166666667, -22.9716666666667,  5.87},
+{2027, "31    Cam", 88.7408333333333, 59.8883333333333,  5.20},
+{2028, NULL, 88.1670833333333, 33.9175,  5.98},
+{2029, "30Xi  Aur", 88.7116666666667, 55.7069444444444,  4.99},
+{2030, NULL, 88.0975, 19.8680555555556,  6.06},
+{2031, "55    Ori", 87.8416666666667, -7.51805555555556,  5.35},
+{2032, NULL, 87.3920833333333, -44.8752777777778,  6.38},
+{2033, "137    Tau", 88.0929166666667, 14.1716666666667,  5.59},
+{2034, "136    Tau", 88.3316666666667, 27.6122222222222,  4.58},
+{2035, "15Del Lep", 87.8304166666667, -20.8791666666667,  3.81},
+{2036, NULL, 87.8691666666667, -22.9261111111111,  6.17},
+{2037, "56    Ori", 88.11, 1.855,  4.78},
+{2038, NULL, 88.3295833333333, 20.2991666666667,  6.71},
+{2039, NULL, 88.0316666666667, -9.04138888888889,  5.97},
+{2040, "Bet Col", 87.74, -35.7683333333333,  3.12},
+{2041, NULL, 89.3958333333333, 66.0961111111111,  6.25},
+{2042, "Gam Pic", 87.4570833333333, -56.1666666666667,  4.51},
+{2043, NULL, 87.9979166666667, -29.4486111111111,  6.45},
+{2044, NULL, 87.6191666666667, -52.7677777777778,  6.35},
+{2045, NULL, 89.06, 51.8038888888889,  6.49},
+{2046, NULL, 88.7458333333333, 31.7016666666667,  5.90},
+{2047, "54Chi1Ori", 88.5954166666667, 20.2761111111111,  4.41},
+{2048, NULL, 88.5558333333333, 10.5869444444444,  6.12},
+{2049, NULL, 87.7216666666667, -52.1088888888889,  5.17},
+{2050, NULL, 88.6341666666667, 11.7625,  6.59},
+{2051, NULL, 88.5654166666667, 3.22527777777778,  6.31},
+{2052, "57    Ori", 88.73625, 19.7497222222222,  5.92},
+{2053, NULL, 88.1383333333333, -37.6311111111111,  5.63},
+{2054, NULL, 89.2704166666667, 49.0294444444444,  6.47},
+{2055, NULL, 88.19875, -38.5258333333333,  6.70},
+{2056, "Lam Col", 88.27875, -33.8013888888889,  4.87},
+{2057, NULL, 88.68375, 0.968333333333333,  6.00},
+{2058, NULL, 88.6445833333333, -4.06388888888889,  6.57},
+{2059, NULL, 82.5579166666667, -84.785,  6.20},
+{2060, NULL, 88.4891666666666, -19.6383333333333,  6.69},
+{2061, "58Alp Ori", 88.7929166666667, 7.40694444444444,  0.50},
+{2062, "Lam Men", 86.9504166666667, -72.7022222222222,  6.53},
+{2063, NULL, 88.9554166666667, 20.175,  5.4 },
+{2064, "Eps Dor", 87.4733333333333, -66.9011111111111,  5.11},
+{2065, NULL, 88.6816666666667, -11.7738888888889,  5.66},
+{2066, NULL, 89.1408333333333, 28.9422222222222,  6.32},
+{2067, NULL, 89.0145833333333, 13.9252777777778,  6.60},
+{2068, NULL, 88.55875, -29.1477777777778,  6.36},
+{2069, NULL, 88.3454166666667, -42.9213888888889,  6.55},
+{2070, NULL, 88.87625, -4.61638888888889,  5.87},
+{2071, NULL, 88.8975, -4.78833333333333,  6.28},
+{2072, NULL, 88.0845833333333, -57.1561111111111,  5.94},
+{2073, NULL, 87.8458333333333, -64.0336111111111,  6.36},
+{2074, NULL, 89.23375, 24.2497222222222,  6.02},
+{2075, NULL, 89.1166666666667, 9.50972222222222,  5.99},
+{2076, NULL, 89.20625, 11.5211111111111,  5.87},
+{2077, "33Del Aur", 89.8816666666667, 54.2847222222222,  3.72},
+{2078, NULL, 91.28875, 75.5858333333333,  6.40},
+{2079, NULL, 89.9404166666667, 55.3208333333333,  6.44},
+{2080, NULL, 89.9504166666667, 54.5472222222222,  6.14},
+{2081, NULL, 89.8408333333333, 49.9244444444444,  5.89},
+{2082, NULL, 88.71875, -39.9580555555556,  5.57},
+{2083, NULL, 88.5445833333333, -50.3619444444444,  6.52},
+{2084, "139    Tau", 89.49875, 25.9538888888889,  4.82},
+{2085, "16Eta Lep", 89.10125, -14.1677777777778,  3.71},
+{2086, NULL, 89.0595833333333, -22.8402777777778,  5.96},
+{2087, "Xi  Col", 88.8745833333333, -37.1208333333333,  4.97},
+{2088, "34Bet Aur", 89.8820833333333, 44.9475,  1.90},
+{2089, NULL, 88.67125, -49.6269444444444,  6.10},
+{2090, NULL, 89.14375, -23.2155555555556,  6.36},
+{2091, "35Pi  Aur", 89.98375, 45.9369444444444,  4.26},
+{2092, "Sig Col", 89.0870833333333, -31.3825,  5.50},
+{2093, NULL, 89.4758333333333, 1.22444444444444,  6.22},
+{2094, NULL, 88.7091666666667, -52.6352777777778,  5.29},
+{2095, "37The Aur", 89.9304166666667, 37.2125,  2.62},
+{2096, NULL, 90.0791666666667, 44.5919444444444,  6.22},
+{2097, NULL, 89.54875, -0.994166666666667,  6.22},
+{2098, NULL, 89.2041666666667, -31.9761111111111,  6.44},
+{2099, NULL, 89.7216666666667, 12.8086111111111,  5.70},
+{2100, "59    Ori", 89.6016666666667, 1.83694444444444,  5.90},
+{2101, "36    Aur", 90.2441666666667, 47.9019444444444,  5.73},
+{2102, NULL, 88.5254166666667, -63.09,  4.65},
+{2103, "60    Ori", 89.7066666666667, 0.553055555555556,  5.22},
+{2104, NULL, 88.5495833333333, -64.4822222222222,  6.63},
+{2105, NULL, 90.4295833333333, 48.9594444444445,  5.96},
+{2106, "Gam Col", 89.3841666666667, -35.2833333333333,  4.36},
+{2107, "1    Mon", 89.7541666666667, -9.38222222222222,  6.12},
+{2108, "2    Mon", 89.7679166666667, -9.55833333333333,  5.03},
+{2109, NULL, 89.9070833333333, -1.44444444444444,  6.63},
+{2110, NULL, 90.2925, 31.0347222222222,  5.98},
+{2111, NULL, 90.2516666666667, 27.5722222222222,  6.05},
+{2112, NULL, 90.7029166666667, 49.9055555555556,  6.05},
+{2113, NULL, 90.0141666666667, -3.07416666666667,  4.53},
+{2114, NULL, 89.31, -53.4261111111111,  6.45},
+{2115, NULL, 90.7233333333333, 43.3786111111111,  6.42},
+{2116, NULL, 90.4233333333333, 22.4008333333333,  6.37},
+{2117, NULL, 89.6566666666667, -44.0344444444444,  5.81},
+{2118, NULL, 90.07375, -12.8997222222222,  6.22},
+{2119, "38    Aur", 90.825, 42.9116666666667,  6.10},
+{2120, "Eta Col", 89.7866666666667, -42.8152777777778,  3.96},
+{2121, NULL, 91.2845833333333, 59.3930555555556,  6.34},
+{2122, NULL, 90.7295833333333, 32.6358333333333,  6.24},
+{2123, NULL, 91.12125, 51.5733333333333,  6.45},
+{2124, "61Mu  Ori", 90.5958333333333, 9.6475,  4.12},
+{2125, "Kap Men", 87.5695833333333, -79.3613888888889,  5.47},
+{2126, NULL, 91.6633333333333, 63.4536111111111,  6.39},
+{2127, NULL, 90.57125, 1.69444444444444,  6.59},
+{2128, "3    Mon", 90.46, -10.5980555555556,  4.95},
+{2129, NULL, 90.3045833333333, -25.4177777777778,  6.05},
+{2130, "64    Ori", 90.86375, 19.6905555555556,  5.14},
+{2131, NULL, 90.3183333333333, -33.9116666666667,  5.55},
+{2132, "39    Aur", 91.2641666666667, 42.9816666666667,  5.87},
+{2133, NULL, 90.8529166666667, 11.6808333333333,  6.08},
+{2134, "1    Gem", 91.03, 23.2633333333333,  4.16},
+{2135, "62Chi2Ori", 90.98, 20.1383333333333,  4.63},
+{2136, NULL, 90.6408333333333, -14.4972222222222,  6.20},
+{2137, NULL, 91.2608333333333, 37.9641666666667,  6.34},
+{2138, NULL, 90.205, -51.2163888888889,  5.67},
+{2139, NULL, 91.3916666666667, 33.5991666666667,  6.23},
+{2140, NULL, 90.8145833333333, -26.2844444444444,  5.04},
+{2141, NULL, 91.5354166666667, 35.3875,  6.12},
+{2142, NULL, 91.05625, -6.70916666666667,  5.21},
+{2143, "40    Aur", 91.64625, 38.4827777777778,  5.36},
+{2144, "63    Ori", 91.2425, 5.42,  5.67},
+{2145, "66    Ori", 91.2433333333333, 4.15861111111111,  5.63},
+{2146, NULL, 91.59375, 29.5125,  6.08},
+{2147, NULL, 91.8620833333333, 41.8541666666667,  6.12},
+{2148, "17    Lep", 91.24625, -16.4844444444444,  4.93},
+{2149, NULL, 91.0845833333333, -32.1725,  5.65},
+{2150, NULL, 91.3625, -10.2427777777778,  5.87},
+{2151, NULL, 90.5383333333333, -60.0969444444444,  6.45},
+{2152, "37    Cam", 92.49625, 58.9358333333333,  5.36},
+{2153, NULL, 92.0958333333333, 41.0555555555556,  6.36},
+{2154, NULL, 91.66125, -4.19388888888889,  5.38},
+{2155, "18The Lep", 91.53875, -14.9352777777778,  4.67},
+{2156, NULL, 91.4404166666667, -24.1955555555556,  6.95},
+{2157, NULL, 91.1183333333333, -45.0366666666667,  6.35},
+{2158, NULL, 91.1675, -45.0788888888889,  5.93},
+{2159, "67Nu  Ori", 91.8929166666667, 14.7683333333333,  4.42},
+{2160, NULL, 91.3629166666667, -35.5136111111111,  5.80},
+{2161, NULL, 91.71625, -11.1736111111111,  6.66},
+{2162, NULL, 91.1954166666667, -48.4586111111111,  6.58},
+{2163, NULL, 91.6333333333333, -23.1105555555556,  5.47},
+{2164, NULL, 91.5229166666667, -29.7586111111111,  5.81},
+{2165, "36    Cam", 93.2129166666667, 65.7183333333333,  5.32},
+{2166, NULL, 91.74, -21.8127777777778,  5.78},
+{2167, NULL, 92.1966666666667, 8.67,  6.55},
+{2168, "19    Lep", 91.9233333333333, -19.1658333333333,  5.31},
+{2169, NULL, 92.385, 22.19,  5.93},
+{2170, NULL, 91.7654166666667, -34.3119444444444,  5.83},
+{2171, "Pi 1Col", 91.6708333333333, -42.2986111111111,  6.12},
+{2172, NULL, 92.9416666666667, 52.6472222222222,  6.30},
+{2173, "3    Gem", 92.4333333333333, 23.1133333333333,  5.75},
+{2174, NULL, 92.24125, 2.49944444444444,  5.73},
+{2175, "41    Aur", 92.9020833333333, 48.7130555555556,  6.82},
+{2176, "41    Aur", 92.9025, 48.7111111111111,  6.09},
+{2177, "The Col", 91.8816666666667, -37.2530555555556,  5.02},
+{2178, NULL, 91.7579166666667, -45.0913888888889,  6.51},
+{2179, NULL, 92.4008333333333, -5.71111111111111,  6.17},
+{2180, NULL, 92.24125, -22.4275,  5.50},
+{2181, "Pi 2Col", 91.9704166666667, -42.1538888888889,  5.50},
+{2182, NULL, 92.3345833333333, -18.1261111111111,  6.35},
+{2183, NULL, 92.3929166666667, -14.5841666666667,  5.56},
+{2184, NULL, 92.7575, 18.1294444444444,  6.33},
+{2185, "5    Gem", 92.8845833333333, 24.4202777777778,  5.80},
+{2186, NULL, 92.4495833333333, -22.7741666666667,  5.71},
+{2187, NULL, 92.1441666666667, -44.3561111111111,  6.27},
+{2188, NULL, 93.43875, 51.1725,  6.04},
+{2189, NULL, 93.08375, 32.6933333333333,  5.78},
+{2190, NULL, 92.9641666666667, 21.8686111111111,  6.56},
+{2191, NULL, 92.86625, 13.6386111111111,  6.04},
+{2192, NULL, 92.4466666666667, -26.7008333333333,  6.27},
+{2193, "68    Ori", 93.0054166666667, 19.7905555555556,  5.75},
+{2194, "Eta1Dor", 91.5391666666667, -66.0397222222222,  5.71},
+{2195, NULL, 92.7554166666667, -6.75416666666667,  6.15},
+{2196, NULL, 91.7641666666667, -62.1547222222222,  5.05},
+{2197, "6    Gem", 93.0795833333333, 22.9083333333333,  6.39},
+{2198, "69    Ori", 93.01375, 16.1305555555556,  4.95},
+{2199, "70Xi  Ori", 92.985, 14.2088888888889,  4.48},
+{2200, NULL, 92.6441666666667, -27.1541666666667,  5.72},
+{2201, "40    Cam", 93.9191666666667, 59.9991666666667,  5.35},
+{2202, NULL, 92.9320833333333, -4.66555555555556,  6.18},
+{2203, NULL, 92.5429166666667, -40.3536111111111,  5.58},
+{2204, NULL, 92.3470833333333, -49.5627777777778,  6.49},
+{2205, NULL, 92.9658333333333, -6.55027777777778,  5.05},
+{2206, NULL, 92.80625, -26.4822222222222,  6.09},
+{2207, NULL, 93.3891666666667, 18.6802777777778,  6.58},
+{2208, NULL, 93.3025, 10.6275,  6.45},
+{2209, NULL, 94.7116666666667, 69.3197222222222,  4.80},
+{2210, NULL, 93.185, -2.50444444444444,  6.62},
+{2211, NULL, 92.66625, -45.2819444444444,  6.31},
+{2212, "Del Pic", 92.5745833333333, -54.9686111111111,  4.81},
+{2213, NULL, 93.1929166666667, -17.7630555555556,  6.52},
+{2214, NULL, 93.6191666666667, 17.9063888888889,  5.88},
+{2215, "1    Lyn", 94.4783333333333, 61.5152777777778,  4.98},
+{2216, "7Eta Gem", 93.7191666666667, 22.5066666666667,  3.28},
+{2217, NULL, 93.9125, 36.1486111111111,  6.92},
+{2218, NULL, 93.47625, -3.74138888888889,  5.83},
+{2219, "44Kap Aur", 93.8445833333333, 29.4980555555556,  4.35},
+{2220, "71    Ori", 93.7120833333333, 19.1563888888889,  5.20},
+{2221, "Nu  Dor", 92.1841666666667, -68.8433333333333,  5.06},
+{2222, NULL, 93.7854166666667, 13.8511111111111,  5.91},
+{2223, "72    Ori", 93.8545833333333, 16.1430555555556,  5.30},
+{2224, NULL, 93.6529166666667, -4.56833333333333,  5.83},
+{2225, NULL, 93.4379166666667, -23.8619444444444,  6.39},
+{2226, NULL, 93.38875, -29.3961111111111,  6.54},
+{2227, "5Gam Mon", 93.71375, -6.27472222222222,  3.98},
+{2228, "42    Aur", 94.3945833333333, 46.4241666666667,  6.52},
+{2229, "73    Ori", 93.9375, 12.5511111111111,  5.33},
+{2230, "8    Gem", 94.0791666666667, 23.97,  6.08},
+{2231, NULL, 93.9170833333333, 6.06611111111111,  6.07},
+{2232, NULL, 93.9458333333333, 4.28361111111111,  6.64},
+{2233, NULL, 93.8929166666667, -0.512222222222222,  5.65},
+{2234, NULL, 93.87375, -4.91527777777778,  5.99},
+{2235, NULL, 94.0991666666667, 17.1813888888889,  6.39},
+{2236, NULL, 93.975, 1.16916666666667,  6.37},
+{2237, NULL, 93.8583333333333, -9.03527777777778,  6.10},
+{2238, "2    Lyn", 94.9058333333333, 59.0108333333333,  4.48},
+{2239, "43    Aur", 94.5704166666667, 46.3605555555556,  6.38},
+{2240, "9    Gem", 94.2445833333333, 23.7408333333333,  6.25},
+{2241, "74    Ori", 94.1108333333333, 12.2722222222222,  5.04},
+{2242, NULL, 93.785, -20.2722222222222,  5.91},
+{2243, NULL, 93.8229166666667, -18.4766666666667,  5.99},
+{2244, NULL, 93.9370833333333, -13.7183333333333,  5.01},
+{2245, "Eta2Dor", 92.8125, -65.5894444444444,  5.01},
+{2246, NULL, 94.0883333333333, 1.08027777777778,  6.63},
+{2247, "75    Ori", 94.2775, 9.9425,  5.39},
+{2248, NULL, 94.2433333333333, 7.05305555555555,  6.57},
+{2249, NULL, 94.0320833333333, -16.6177777777778,  5.92},
+{2250, NULL, 94.38875, 14.0583333333333,  6.59},
+{2251, NULL, 94.3170833333333, 5.10027777777778,  5.71},
+{2252, NULL, 93.9883333333333, -29.7883333333333,  6.67},
+{2253, NULL, 94.5233333333333, 14.3827777777778,  6.16},
+{2254, NULL, 94.2645833333333, -22.715,  6.07},
+{2255, "6    Mon", 94.3966666666667, -10.7252777777778,  6.75},
+{2256, "Kap Col", 94.1379166666667, -35.1405555555556,  4.37},
+{2257, "4    Lyn", 95.515, 59.3722222222222,  5.94},
+{2258, NULL, 94.7575, 17.325,  6.32},
+{2259, NULL, 94.66875, 9.04722222222222,  6.24},
+{2260, NULL, 94.42375, -16.8158333333333,  5.14},
+{2261, "Alp Men", 92.56, -74.7530555555556,  5.09},
+{2262, NULL, 94.1483333333333, -39.2644444444444,  6.00},
+{2263, NULL, 94.255, -37.7375,  5.53},
+{2264, "45    Aur", 95.4420833333333, 53.4522222222222,  5.36},
+{2265, NULL, 94.2895833333333, -37.2530555555556,  5.87},
+{2266, NULL, 94.5570833333333, -19.9669444444444,  5.52},
+{2267, NULL, 94.7108333333333, -9.39027777777778,  5.36},
+{2268, NULL, 94.7033333333333, -15.0247222222222,  6.06},
+{2269, NULL, 95.0175, 14.6511111111111,  5.69},
+{2270, NULL, 94.7829166666667, -8.58638888888889,  6.22},
+{2271, NULL, 94.7458333333333, -20.9261111111111,  5.81},
+{2272, NULL, 95.3004166666667, 29.5411111111111,  6.43},
+{2273, "7    Mon", 94.9283333333333, -7.82305555555556,  5.27},
+{2274, NULL, 94.0770833333333, -59.2136111111111,  6.43},
+{2275, NULL, 94.9983333333333, -2.94444444444444,  4.90},
+{2276, NULL, 95.2179166666667, 11.7563888888889,  6.54},
+{2277, NULL, 95.3579166666667, 17.7636111111111,  6.35},
+{2278, NULL, 94.4654166666667, -52.7330555555556,  6.41},
+{2279, NULL, 94.9208333333333, -34.3966666666667,  5.78},
+{2280, NULL, 95.3575, 2.26861111111111,  6.31},
+{2281, NULL, 94.695, -50.3591666666667,  7.04},
+{2282, "1Zet CMa", 95.0783333333333, -30.0633333333333,  3.02},
+{2283, NULL, 93.7745833333333, -71.7027777777778,  6.64},
+{2284, NULL, 95.3529166666667, -11.7733333333333,  5.64},
+{2285, NULL, 97.0608333333333, 70.5355555555555,  5.97},
+{2286, "13Mu  Gem", 95.74, 22.5136111111111,  2.88},
+{2287, NULL, 95.6520833333333, 12.57,  6.00},
+{2288, NULL, 95.15125, -34.1438888888889,  5.53},
+{2289, "46Psi1Aur", 96.2245833333333, 49.2880555555556,  4.91},
+{2290, NULL, 95.0254166666667, -48.7411111111111,  6.60},
+{2291, NULL, 96.6075, 56.285,  5.64},
+{2292, NULL, 95.8270833333333, 3.76444444444444,  6.40},
+{2293, "5    Lyn", 96.70375, 58.4172222222222,  5.21},
+{2294, "2Bet CMa", 95.675, -17.9558333333333,  1.98},
+{2295, NULL, 95.8445833333333, -4.68722222222222,  6.67},
+{2296, "Del Col", 95.5283333333333, -33.4363888888889,  3.85},
+{2297, NULL, 96.2191666666667, 29.7072222222222,  6.71},
+{2298, "8Eps Mon", 95.9420833333333, 4.59277777777778,  4.44},
+{2299, NULL, 95.94375, 4.59555555555556,  6.72},
+{2300, NULL, 96.0095833333333, 8.88472222222222,  6.26},
+{2301, NULL, 95.9, -9.87444444444444,  6.19},
+{2302, NULL, 96.2204166666667, 16.0569444444444,  6.33},
+{2303, NULL, 95.9416666666667, -15.0716666666667,  6.24},
+{2304, NULL, 96.3870833333333, 23.3269444444444,  6.06},
+{2305, NULL, 96.0429166666667, -11.5302777777778,  5.22},
+{2306, NULL, 95.9483333333333, -19.7852777777778,  6.60},
+{2307, NULL, 95.81, -31.79,  6.34},
+{2308, NULL, 96.3670833333333, 14.7219444444444,  6.24},
+{2309, NULL, 96.0854166666667, -12.9625,  6.12},
+{2310, NULL, 96.3045833333333, 7.08583333333333,  5.98},
+{2311, NULL, 95.9829166666667, -25.5777777777778,  5.63},
+{2312, NULL, 96.3266666666667, 1.50111111111111,  6.66},
+{2313, NULL, 96.3183333333333, -0.946111111111111,  5.87},
+{2314, NULL, 96.9629166666667, 47.4052777777778,  6.56},
+{2315, NULL, 96.4441666666667, 2.27222222222222,  6.51},
+{2316, NULL, 96.0041666666667, -36.7077777777778,  5.62},
+{2317, NULL, 96.44625, -3.88916666666667,  6.35},
+{2318, NULL, 96.1829166666667, -28.78,  6.39},
+{2319, NULL, 96.8979166666667, 32.5630555555556,  6.43},
+{2320, "Nu  Pic", 95.7325, -56.37,  5.61},
+{2321, NULL, 96.495, -7.89416666666667,  6.40},
+{2322, NULL, 95.9070833333333, -52.1811111111111,  5.98},
+{2323, NULL, 96.1854166666667, -40.2841666666667,  6.31},
+{2324, NULL, 96.665, -1.50722222222222,  5.87},
+{2325, NULL, 96.64375, -4.59722222222222,  6.15},
+{2326, "Alp Car", 95.9879166666667, -52.6958333333333, -0.72},
+{2327, NULL, 96.7445833333333, 0.840833333333333,  6.71},
+{2328, NULL, 96.6870833333333, -7.51138888888889,  6.27},
+{2329, NULL, 96.3745833333333, -35.0638888888889,  6.25},
+{2330, "16    Gem", 96.9858333333333, 20.4961111111111,  6.22},
+{2331, "6    Lyn", 97.6966666666667, 58.1627777777778,  5.88},
+{2332, "48    Aur", 97.1420833333333, 30.4930555555556,  5.55},
+{2333, NULL, 96.835, 2.90805555555556,  5.55},
+{2334, NULL, 96.8075, 0.299166666666667,  5.20},
+{2335, NULL, 96.815, -0.276111111111111,  5.55},
+{2336, NULL, 95.9454166666667, -58.5438888888889,  6.48},
+{2337, NULL, 95.7554166666667, -63.6830555555556,  6.27},
+{2338, "47    Aur", 97.5125, 46.6855555555556,  5.90},
+{2339, NULL, 97.2358333333333, 26.9677777777778,  6.47},
+{2340, NULL, 97.1166666666667, 16.2383333333333,  6.23},
+{2341, NULL, 96.2008333333333, -52.8063888888889,  6.51},
+{2342, NULL, 97.0783333333333, 10.3038888888889,  6.15},
+{2343, "18Nu  Gem", 97.2408333333333, 20.2122222222222,  4.15},
+{2344, "10    Mon", 96.99, -4.76222222222222,  5.06},
+{2345, NULL, 96.0570833333333, -60.2811111111111,  5.80},
+{2346, NULL, 100.07, 79.5994444444444,  6.54},
+{2347, NULL, 97.07, 1.91222222222222,  6.48},
+{2348, NULL, 96.4316666666667, -48.1772222222222,  5.76},
+{2349, NULL, 96.7966666666667, -25.8566666666667,  6.07},
+{2350, NULL, 101.125833333333, 82.1152777777778,  6.65},
+{2351, NULL, 97.25, 11.0194444444444,  6.59},
+{2352, "Pi 1Dor", 95.6591666666667, -69.9841666666667,  5.56},
+{2353, NULL, 96.78125, -37.8955555555556,  6.48},
+{2354, NULL, 96.1095833333333, -63.4288888888889,  6.46},
+{2355, NULL, 97.3120833333333, 2.64611111111111,  6.16},
+{2356, "11Bet Mon", 97.2041666666667, -7.03277777777778,  4.60},
+{2357, "11Bet Mon", 97.20625, -7.03444444444444,  5.40},
+{2358, "11Bet Mon", 97.20625, -7.03444444444444,  5.60},
+{2359, NULL, 97.1554166666667, -17.4661111111111,  5.77},
+{2360, NULL, 96.2316666666667, -63.8277777777778,  6.27},
+{2361, "Lam CMa", 97.0420833333333, -32.58,  4.48},
+{2362, NULL, 97.5229166666667, 9.02916666666667,  6.57},
+{2363, NULL, 100.12, 77.9958333333333,  5.73},
+{2364, NULL, 97.1633333333333, -32.3711111111111,  5.74},
+{2365, NULL, 99.47875, 73.6955555555556,  6.24},
+{2366, NULL, 97.7920833333333, 16.9386111111111,  6.20},
+{2367, NULL, 97.5470833333333, -10.0813888888889,  5.93},
+{2368, NULL, 97.17625, -41.0744444444444,  6.32},
+{2369, NULL, 96.7666666666667, -58.0022222222222,  5.82},
+{2370, NULL, 97.7895833333333, 11.2508333333333,  6.14},
+{2371, "19    Gem", 97.9058333333333, 15.9033333333333,  6.40},
+{2372, NULL, 98.1133333333333, 32.4547222222222,  5.87},
+{2373, NULL, 97.6445833333333, -13.1480555555556,  6.16},
+{2374, NULL, 97.9133333333333, 11.7922222222222,  6.65},
+{2375, NULL, 97.95125, 11.5444444444444,  5.23},
+{2376, "7    Lyn", 98.6366666666667, 55.3530555555556,  6.45},
+{2377, "Pi 2Dor", 96.3691666666667, -69.6902777777778,  5.38},
+{2378, NULL, 98.0970833333333, 11.6736111111111,  6.03},
+{2379, NULL, 97.8458333333333, -12.3916666666667,  5.15},
+{2380, NULL, 97.6929166666667, -27.7694444444444,  5.93},
+{2381, NULL, 97.95875, -8.15805555555556,  5.43},
+{2382, "12    Mon", 98.08, 4.85583333333333,  5.84},
+{2383, NULL, 98.4279166666667, 33.0241666666667,  6.42},
+{2384, NULL, 97.4545833333333, -50.2391666666667,  5.27},
+{2385, "13    Mon", 98.2258333333333, 7.33305555555556,  4.50},
+{2386, NULL, 98.09625, -5.86888888888889,  5.60},
+{2387, "4Xi 1CMa", 97.96375, -23.4183333333333,  4.33},
+{2388, NULL, 97.8041666666667, -35.2591666666667,  5.84},
+{2389, NULL, 97.36875, -56.8527777777778,  5.22},
+{2390, NULL, 97.7491666666667, -40.9163888888889,  6.20},
+{2391, NULL, 98.4004166666667, 14.1552777777778,  5.53},
+{2392, NULL, 98.1954166666667, -11.1663888888889,  6.24},
+{2393, NULL, 97.8958333333333, -36.94,  6.34},
+{2394, "8    Lyn", 99.4225, 61.4811111111111,  5.94},
+{2395, NULL, 98.4079166666667, -1.22027777777778,  5.10},
+{2396, NULL, 100.134166666667, 71.7488888888889,  5.92},
+{2397, NULL, 98.1625, -32.0305555555556,  5.69},
+{2398, "49    Aur", 98.8004166666667, 28.0222222222222,  5.27},
+{2399, NULL, 98.08875, -37.6966666666667,  5.24},
+{2400, NULL, 97.82625, -51.8261111111111,  5.60},
+{2401, NULL, 101.55875, 79.5647222222222,  5.45},
+{2402, "11    Lyn", 99.4104166666667, 56.8575,  5.85},
+{2403, NULL, 98.3608333333333, -20.9238888888889,  6.40},
+{2404, "14    Mon", 98.6933333333333, 7.5725,  6.45},
+{2405, NULL, 99.1370833333333, 38.4452777777778,  5.29},
+{2406, NULL, 98.8233333333333, 9.98833333333333,  5.88},
+{2407, NULL, 98.2929166666667, -38.6252777777778,  6.44},
+{2408, NULL, 97.5125, -65.5683333333333,  6.29},
+{2409, NULL, 98.8158333333333, 0.89,  5.80},
+{2410, NULL, 97.7941666666667, -61.8797222222222,  6.15},
+{2411, NULL, 98.45625, -36.2322222222222,  5.42},
+{2412, "Mu  Pic", 97.9933333333333, -58.7541666666667,  5.70},
+{2413, NULL, 99, 4.4975,  6.55},
+{2414, "5Xi 2CMa", 98.7641666666667, -22.9647222222222,  4.54},
+{2415, NULL, 98.6470833333333, -32.7163888888889,  5.62},
+{2416, NULL, 98.35875, -52.3288888888889,  6.19},
+{2417, NULL, 99.3633333333333, 24.5908333333333,  6.44},
+{2418, NULL, 99.1470833333333, -5.21111111111111,  5.52},
+{2419, "51    Aur", 99.6645833333333, 39.3908333333333,  5.69},
+{2420, "52Psi3Aur", 99.705, 39.9025,  5.20},
+{2421, "24Gam Gem", 99.4279166666667, 16.3991666666667,  1.93},
+{2422, NULL, 99.3504166666667, 6.13527777777778,  6.06},
+{2423, "6Nu 1CMa", 99.095, -18.66,  5.70},
+{2424, NULL, 98.8504166666667, -36.78,  5.59},
+{2425, "53    Aur", 99.5958333333333, 28.9841666666667,  5.79},
+{2426, NULL, 99.40375, 10.8530555555556,  6.38},
+{2427, "50Psi2Aur", 99.8329166666667, 42.4888888888889,  4.79},
+{2428, NULL, 99.1945833333333, -13.3208333333333,  5.97},
+{2429, "7Nu 2CMa", 99.1708333333333, -19.2558333333333,  3.95},
+{2430, NULL, 99.4179166666667, 2.70416666666667,  6.17},
+{2431, NULL, 98.975, -36.0888888888889,  6.35},
+{2432, NULL, 99.4695833333333, 4.95722222222222,  6.15},
+{2433, NULL, 99.1704166666667, -22.615,  6.35},
+{2434, NULL, 99.9916666666667, 44.0138888888889,  6.41},
+{2435, NULL, 98.7441666666667, -52.9755555555556,  4.39},
+{2436, NULL, 99.7720833333333, 22.0308333333333,  6.04},
+{2437, NULL, 99.4204166666667, -12.985,  6.12},
+{2438, "54    Aur", 99.8879166666667, 28.2630555555556,  6.03},
+{2439, NULL, 99.8808333333333, 24.6,  6.38},
+{2440, NULL, 99.5854166666666, -2.54361111111111,  6.14},
+{2441, NULL, 99.70625, 4.70055555555556,  6.57},
+{2442, NULL, 99.65875, 1.61361111111111,  6.21},
+{2443, "8Nu 3CMa", 99.4725, -18.2375,  4.43},
+{2444, NULL, 99.2579166666667, -38.1466666666667,  6.04},
+{2445, NULL, 99.21375, -41.5569444444444,  6.34},
+{2446, NULL, 99.3075, -36.9905555555556,  5.71},
+{2447, NULL, 99.4483333333333, -32.3397222222222,  5.27},
+{2448, NULL, 99.6475, -16.8736111111111,  6.03},
+{2449, NULL, 99.9483333333333, 12.9830555555556,  5.97},
+{2450, NULL, 99.8195833333333, -14.1458333333333,  4.82},
+{2451, "Nu  Pup", 99.4404166666667, -43.1961111111111,  3.17},
+{2452, NULL, 100.407083333333, 35.9319444444444,  6.46},
+{2453, "25    Gem", 100.3375, 28.1963888888889,  6.42},
+{2454, NULL, 100.1325, 6.37166666666667,  6.51},
+{2455, NULL, 99.90125, -23.6955555555556,  6.05},
+{2456, "15    Mon", 100.244583333333, 9.89555555555556,  4.66},
+{2457, NULL, 100.340833333333, 16.3975,  6.28},
+{2458, NULL, 100.321666666667, 11.0033333333333,  6.11},
+{2459, "55Psi4Aur", 100.770833333333, 44.5244444444444,  5.02},
+{2460, NULL, 99.9279166666667, -30.4702777777778,  5.71},
+{2461, NULL, 100.2725, 0.495277777777778,  5.79},
+{2462, NULL, 99.6566666666667, -48.2202777777778,  4.93},
+{2463, NULL, 101.048333333333, 53.2963888888889,  6.27},
+{2464, NULL, 100.8075, 37.1469444444444,  6.19},
+{2465, NULL, 99.9870833333333, -38.1588888888889,  6.58},
+{2466, "26    Gem", 100.60125, 17.6452777777778,  5.21},
+{2467, NULL, 100.497083333333, 6.345,  6.37},
+{2468, NULL, 99.5025, -61.5330555555556,  6.18},
+{2469, NULL, 100.485, -9.16722222222222,  5.19},
+{2470, "12    Lyn", 101.55875, 59.4416666666667,  4.87},
+{2471, NULL, 101.0525, 36.1097222222222,  6.31},
+{2473, "27Eps Gem", 100.982916666667, 25.1311111111111,  2.98},
+{2474, NULL, 100.777083333333, 3.03333333333333,  6.19},
+{2475, NULL, 100.30875, -40.3497222222222,  6.12},
+{2476, NULL, 100.205416666667, -47.6747222222222,  6.65},
+{2477, "13    Lyn", 101.70625, 57.1691666666667,  5.35},
+{2478, "30    Gem", 100.997083333333, 13.2277777777778,  4.49},
+{2479, NULL, 100.91125, 3.93222222222222,  5.90},
+{2480, "28    Gem", 101.189583333333, 28.9708333333333,  5.44},
+{2481, NULL, 100.690833333333, -22.4491666666667,  6.13},
+{2482, NULL, 100.568333333333, -38.3986111111111,  6.29},
+{2483, "56Psi5Aur", 101.684583333333, 43.5775,  5.25},
+{2484, "31Xi  Gem", 101.3225, 12.8955555555556,  3.36},
+{2485, NULL, 102.05375, 55.7044444444444,  6.33},
+{2486, NULL, 102.05125, 55.7044444444444,  6.28},
+{2487, "57Psi6Aur", 101.915, 48.7894444444444,  5.22},
+{2488, NULL, 100.847083333333, -39.1933333333333,  6.30},
+{2489, "32    Gem", 101.475833333333, 12.6936111111111,  6.46},
+{2490, "42    Cam", 102.737916666667, 67.5719444444444,  5.14},
+{2491, "9Alp CMa", 101.287083333333, -16.7161111111111, -1.46},
+{2492, "10    CMa", 101.118333333333, -31.0705555555556,  5.20},
+{2493, NULL, 101.21625, -27.3413888888889,  6.45},
+{2494, "16    Mon", 101.635, 8.58722222222222,  5.93},
+{2495, NULL, 101.347083333333, -23.4619444444444,  6.05},
+{2497, NULL, 101.26, -30.5861111111111,  6.54},
+{2498, NULL, 101.497083333333, -14.7961111111111,  5.32},
+{2499, NULL, 101.847916666667, 18.1933333333333,  6.20},
+{2500, NULL, 101.345, -31.7936111111111,  5.92},
+{2501, NULL, 101.380416666667, -30.9488888888889,  5.80},
+{2502, NULL, 101.6625, -10.1072222222222,  5.66},
+{2503, "17    Mon", 101.8325, 8.03722222222222,  4.77},
+{2504, "11    CMa", 101.712916666667, -14.4258333333333,  5.29},
+{2505, NULL, 100.240833333333, -71.7755555555556,  6.51},
+{2506, "18    Mon", 101.965, 2.41222222222222,  4.47},
+{2507, NULL, 101.51375, -39.54,  6.62},
+{2508, NULL, 101.904583333333, -8.99833333333333,  5.07},
+{2509, "12    CMa", 101.75625, -21.0155555555556,  6.08},
+{2510, NULL, 101.550416666667, -37.7755555555556,  6.21},
+{2511, "43    Cam", 103.425833333333, 68.8883333333333,  5.12},
+{2512, NULL, 102.422083333333, 32.6066666666667,  5.71},
+{2513, NULL, 101.35875, -52.2011111111111,  6.57},
+{2514, NULL, 102.079166666667, -1.31916666666667,  5.75},
+{2515, NULL, 101.47375, -52.41,  5.80},
+{2516, "58Psi7Aur", 102.69125, 41.7813888888889,  5.02},
+{2517, NULL, 102.265416666667, 1.00194444444444,  6.15},
+{2518, NULL, 101.839166666667, -37.9297222222222,  5.26},
+{2519, "33    Gem", 102.4575, 16.2027777777778,  5.85},
+{2520, "14    Lyn", 103.27125, 59.4486111111111,  5.33},
+{2521, NULL, 102.318333333333, -2.27194444444444,  5.74},
+{2522, NULL, 102.240833333333, -15.1447222222222,  5.39},
+{2523, NULL, 101.72, -51.2658333333333,  5.40},
+{2524, NULL, 101.672916666667, -54.6947222222222,  6.46},
+{2525, "35    Gem", 102.60625, 13.4133333333333,  5.65},
+{2526, NULL, 101.827916666667, -55.54,  5.61},
+{2527, NULL, 105.016666666667, 76.9775,  4.55},
+{2528, NULL, 102.433333333333, -24.0758333333333,  6.33},
+{2529, "36    Gem", 102.8875, 21.7611111111111,  5.27},
+{2530, NULL, 102.707916666667, -0.540833333333333,  5.77},
+{2531, NULL, 100.903333333333, -73.1180555555555,  6.37},
+{2532, NULL, 103.281666666667, 44.8394444444444,  6.26},
+{2533, NULL, 103, 23.6016666666667,  5.65},
+{2534, NULL, 102.67625, -8.04111111111111,  6.29},
+{2535, NULL, 102.59125, -17.0838888888889,  5.79},
+{2536, NULL, 101.23375, -70.4338888888889,  6.11},
+{2537, NULL, 102.525, -27.3338888888889,  7.04},
+{2538, "13Kap CMa", 102.460416666667, -32.5086111111111,  3.96},
+{2539, "59    Aur", 103.25625, 38.8691666666667,  6.12},
+{2540, "34The Gem", 103.197083333333, 33.9611111111111,  3.60},
+{2541, "60    Aur", 103.305833333333, 38.4380555555556,  6.30},
+{2542, NULL, 103.264166666667, 35.7886111111111,  6.01},
+{2543, NULL, 102.91375, 3.04166666666667,  6.38},
+{2544, NULL, 102.65375, -25.7780555555556,  6.33},
+{2545, NULL, 102.597083333333, -31.7061111111111,  5.70},
+{2546, NULL, 102.490833333333, -45.45,  6.55},
+{2547, "61Psi8Aur", 103.4875, 38.505,  6.48},
+{2548, NULL, 102.4775, -46.6147222222222,  5.14},
+{2549, NULL, 102.718333333333, -34.3672222222222,  4.99},
+{2550, "Alp Pic", 102.0475, -61.9413888888889,  3.27},
+{2551, NULL, 103.205833333333, 8.38027777777778,  5.77},
+{2552, NULL, 103.095416666667, -5.31611111111111,  6.30},
+{2553, "Tau Pup", 102.484166666667, -50.6147222222222,  2.93},
+{2554, NULL, 102.46375, -53.6222222222222,  4.40},
+{2555, NULL, 103.34375, 10.9963888888889,  6.24},
+{2556, NULL, 103.813333333333, 45.8263888888889,  6.34},
+{2557, NULL, 103.81125, 43.91,  6.13},
+{2558, NULL, 102.92625, -36.2302777777778,  5.96},
+{2559, "Zet Men", 100.01125, -80.8136111111111,  5.64},
+{2560, "15    Lyn", 104.31875, 58.4225,  4.35},
+{2561, NULL, 104.305, 57.5633333333333,  6.05},
+{2562, NULL, 102.504583333333, -60.2491666666667,  6.11},
+{2563, NULL, 102.886666666667, -48.2925,  6.42},
+{2564, "38    Gem", 103.66125, 13.1777777777778,  4.65},
+{2565, NULL, 103.328333333333, -19.0327777777778,  5.64},
+{2566, NULL, 103.340416666667, -18.9333333333333,  6.14},
+{2567, NULL, 103.250416666667, -26.9575,  6.40},
+{2568, "Psi9Aur", 104.134583333333, 46.2741666666667,  5.87},
+{2569, "37    Gem", 103.8275, 25.3755555555556,  5.73},
+{2570, NULL, 103.535416666667, -5.8525,  6.41},
+{2571, "15    CMa", 103.387083333333, -20.2241666666667,  4.83},
+{2572, NULL, 103.6025, -1.12694444444444,  5.45},
+{2573, NULL, 104.233333333333, 46.705,  5.86},
+{2574, "14The CMa", 103.5475, -12.0386111111111,  4.07},
+{2575, NULL, 103.165416666667, -42.5044444444444,  6.52},
+{2576, NULL, 103.39125, -28.5397222222222,  6.04},
+{2577, NULL, 103.675416666667, -1.75638888888889,  6.21},
+{2578, NULL, 103.480416666667, -24.5391666666667,  6.21},
+{2579, NULL, 103.19625, -43.9758333333333,  6.46},
+{2580, "16Omi1CMa", 103.532916666667, -24.1838888888889,  3.87},
+{2581, NULL, 105.339583333333, 70.8080555555556,  5.68},
+{2582, NULL, 103.745, -2.80361111111111,  6.04},
+{2583, NULL, 103.554166666667, -23.9283333333333,  6.91},
+{2584, NULL, 103.894166666667, 8.32472222222222,  6.29},
+{2585, "16    Lyn", 104.404583333333, 45.0941666666667,  4.90},
+{2586, NULL, 104.252083333333, 33.6811111111111,  5.89},
+{2587, NULL, 103.195416666667, -54.09,  6.57},
+{2588, "17    CMa", 103.76125, -20.4047222222222,  5.74},
+{2589, NULL, 104.1075, 9.95638888888889,  5.92},
+{2590, "19Pi  CMa", 103.905833333333, -20.1363888888889,  4.68},
+{2591, NULL, 103.61125, -42.3655555555556,  6.32},
+{2592, NULL, 103.189166666667, -59.3411111111111,  6.41},
+{2593, "18Mu  CMa", 104.0275, -14.0436111111111,  5.00},
+{2594, NULL, 103.509583333333, -50.6116666666667,  6.26},
+{2595, NULL, 103.945, -22.9413888888889,  5.30},
+{2596, "20Iot CMa", 104.034166666667, -17.0541666666667,  4.37},
+{2597, NULL, 104.357083333333, 11.9075,  6.27},
+{2598, NULL, 103.978333333333, -31.79,  6.36},
+{2599, NULL, 104.250416666667, -8.17888888888889,  6.34},
+{2600, "62    Aur", 104.761666666667, 38.0522222222222,  6.00},
+{2601, "39    Gem", 104.6975, 26.0811111111111,  6.10},
+{2602, "Iot Vol", 102.8625, -70.9633333333333,  5.40},
+{2603, NULL, 104.311666666667, -22.2033333333333,  6.61},
+{2604, NULL, 104.190416666667, -35.3416666666667,  6.29},
+{2605, "40    Gem", 104.86625, 25.9141666666667,  6.40},
+{2606, NULL, 104.6625, 7.62194444444444,  6.27},
+{2607, NULL, 104.39125, -24.6305555555556,  5.46},
+{2608, NULL, 104.066666666667, -48.7211111111111,  4.95},
+{2609, NULL, 115.127083333333, 87.02,  5.07},
+{2610, NULL, 104.7375, 3.60222222222222,  5.97},
+{2611, NULL, 104.426666666667, -27.5375,  6.23},
+{2612, NULL, 104.323333333333, -35.5075,  6.23},
+{2613, NULL, 104.83375, 7.31694444444444,  6.35},
+{2614, NULL, 104.531666666667, -27.1647222222222,  6.37},
+{2615, "41    Gem", 105.065833333333, 16.0788888888889,  5.68},
+{2616, NULL, 104.649583333333, -25.4138888888889,  5.59},
+{2617, NULL, 106.465833333333, 70.7319444444445,  6.50},
+{2618, "21Eps CMa", 104.65625, -28.9722222222222,  1.50},
+{2619, NULL, 104.604583333333, -34.1116666666667,  5.06},
+{2620, NULL, 105.321666666667, 32.4144444444444,  6.59},
+{2621, NULL, 104.6825, -30.9977777777778,  6.42},
+{2622, NULL, 105.075, -5.36694444444444,  6.30},
+{2623, NULL, 104.91375, -21.6033333333333,  6.26},
+{2624, NULL, 105.09875, -8.40694444444444,  5.96},
+{2625, NULL, 105.03375, -20.1588888888889,  6.31},
+{2626, NULL, 104.674166666667, -45.7680555555556,  6.22},
+{2627, NULL, 105.16375, -9.20305555555555,  6.49},
+{2628, NULL, 105.080416666667, -22.1194444444444,  6.53},
+{2629, NULL, 105.4225, 4.81805555555556,  6.63},
+{2630, "42Ome Gem", 105.603333333333, 24.2152777777778,  5.18},
+{2631, NULL, 105.60625, 17.7555555555556,  5.94},
+{2632, NULL, 105.5725, 15.3361111111111,  5.74},
+{2633, NULL, 105.479166666667, 5.5575,  6.59},
+{2634, NULL, 104.665, -55.7294444444444,  6.27},
+{2635, NULL, 105.639583333333, 16.6741666666667,  5.82},
+{2636, NULL, 105.470416666667, -1.34555555555556,  6.17},
+{2637, NULL, 105.1775, -28.4894444444444,  6.27},
+{2638, NULL, 104.650833333333, -56.3947222222222,  6.45},
+{2639, NULL, 105.485, -5.72222222222222,  5.20},
+{2640, NULL, 105.274583333333, -25.2152777777778,  5.63},
+{2641, NULL, 105.2075, -33.4652777777778,  6.40},
+{2642, NULL, 106.505416666667, 59.8019444444444,  6.44},
+{2643, NULL, 105.876666666667, 29.3372222222222,  5.93},
+{2644, NULL, 106.415833333333, 52.7580555555556,  6.12},
+{2645, NULL, 106.2875, 47.775,  6.38},
+{2646, "22Sig CMa", 105.429583333333, -27.9347222222222,  3.47},
+{2647, NULL, 105.824583333333, 9.13833333333333,  5.97},
+{2648, "19    Mon", 105.728333333333, -4.23916666666667,  4.99},
+{2649, NULL, 105.908333333333, 10.9516666666667,  5.13},
+{2650, "43Zet Gem", 106.027083333333, 20.5702777777778,  3.79},
+{2651, NULL, 105.965, 12.5944444444444,  5.98},
+{2652, NULL, 105.214583333333, -51.4025,  5.14},
+{2653, "24Omi2CMa", 105.75625, -23.8333333333333,  3.02},
+{2654, NULL, 106.084166666667, 1.48833333333333,  6.57},
+{2655, NULL, 106.021666666667, -5.32361111111111,  5.62},
+{2656, NULL, 105.98875, -10.1241666666667,  6.45},
+{2657, "23Gam CMa", 105.939583333333, -15.6333333333333,  4.12},
+{2658, NULL, 105.565, -43.4041666666667,  6.43},
+{2659, "44    Gem", 106.326666666667, 22.6372222222222,  6.02},
+{2660, NULL, 106.548333333333, 34.4738888888889,  5.55},
+{2661, NULL, 105.27125, -58.94,  6.02},
+{2662, NULL, 104.960416666667, -67.9161111111111,  5.17},
+{2663, NULL, 106.412916666667, 9.18583333333333,  5.78},
+{2664, NULL, 106.19625, -22.0322222222222,  6.09},
+{2665, NULL, 106.842916666667, 34.0094444444444,  5.91},
+{2666, NULL, 106.011666666667, -42.3372222222222,  5.20},
+{2667, NULL, 105.98875, -43.6080555555556,  5.54},
+{2668, NULL, 105.995, -43.6116666666667,  6.79},
+{2669, NULL, 106.854166666667, 28.1772222222222,  6.48},
+{2670, NULL, 106.457083333333, -10.6611111111111,  6.49},
+{2671, NULL, 106.839166666667, 22.7036111111111,  7.68},
+{2672, NULL, 105.97375, -49.5838888888889,  4.93},
+{2673, NULL, 107.055416666667, 33.8322222222222,  6.28},
+{2674, NULL, 105.815, -59.1780555555556,  5.50},
+{2675, NULL, 107.15125, 37.445,  6.16},
+{2676, NULL, 106.776666666667, 4.91027777777778,  6.11},
+{2677, NULL, 106.383333333333, -34.7777777777778,  6.14},
+{2678, NULL, 106.669583333333, -11.2941666666667,  5.39},
+{2679, NULL, 106.649583333333, -12.3938888888889,  6.48},
+{2680, NULL, 106.5025, -30.6555555555556,  6.34},
+{2681, NULL, 108.492083333333, 71.8166666666667,  6.35},
+{2682, NULL, 106.95625, 7.47111111111111,  5.75},
+{2683, NULL, 106.07625, -56.7497222222222,  5.17},
+{2684, "45    Gem", 107.091666666667, 15.9308333333333,  5.44},
+{2685, NULL, 106.509583333333, -38.3827777777778,  6.11},
+{2686, NULL, 106.717916666667, -24.9605555555556,  6.08},
+{2687, NULL, 106.31875, -50.3602777777778,  6.46},
+{2688, NULL, 106.750416666667, -26.6577777777778,  6.62},
+{2689, "The Men", 104.143333333333, -79.4202777777778,  5.45},
+{2690, NULL, 106.844166666667, -23.8402777777778,  5.71},
+{2691, NULL, 106.779583333333, -40.8933333333333,  5.79},
+{2692, NULL, 107.527916666667, 21.2469444444444,  6.43},
+{2693, "25Del CMa", 107.097916666667, -26.3933333333333,  1.84},
+{2694, NULL, 107.334583333333, -10.3472222222222,  6.21},
+{2695, NULL, 107.205416666667, -24.0441666666667,  6.65},
+{2696, "63    Aur", 107.91375, 39.3205555555556,  4.90},
+{2697, "46Tau Gem", 107.785, 30.2452777777778,  4.41},
+{2698, NULL, 106.805416666667, -51.9677777777778,  5.96},
+{2699, NULL, 107.388333333333, -16.2347222222222,  6.03},
+{2700, "47    Gem", 107.84625, 26.8566666666667,  5.78},
+{2701, "20    Mon", 107.557083333333, -4.23722222222222,  4.92},
+{2702, NULL, 107.212916666667, -39.6558333333333,  4.83},
+{2703, NULL, 108.3475, 51.4288888888889,  5.47},
+{2704, NULL, 107.42875, -25.2311111111111,  5.69},
+{2705, NULL, 107.53875, -18.6852777777778,  6.23},
+{2706, "48    Gem", 108.11, 24.1283333333333,  5.85},
+{2707, "21    Mon", 107.848333333333, -0.301944444444444,  5.45},
+{2708, NULL, 107.580833333333, -27.4913888888889,  5.46},
+{2709, NULL, 111.34125, 81.2575,  6.31},
+{2710, NULL, 107.96375, 5.65472222222222,  6.09},
+{2711, NULL, 108.204166666667, 27.2247222222222,  6.43},
+{2712, NULL, 106.55875, -68.8372222222222,  6.47},
+{2713, NULL, 108.030833333333, 5.47472222222222,  6.16},
+{2714, "22Del Mon", 107.96625, -0.492777777777778,  4.15},
+{2715, "18    Lyn", 108.97875, 59.6375,  5.20},
+{2716, NULL, 107.923333333333, -20.8830555555556,  5.84},
+{2717, "51    Gem", 108.342916666667, 16.1588888888889,  5.00},
+{2718, "26    CMa", 108.050833333333, -25.9425,  5.92},
+{2719, NULL, 107.697916666667, -48.9322222222222,  5.14},
+{2720, NULL, 108.017083333333, -30.8216666666667,  6.10},
+{2721, NULL, 108.95875, 47.24,  5.58},
+{2722, NULL, 108.610833333333, 24.7108333333333,  6.89},
+{2723, NULL, 108.28, -11.2513888888889,  5.78},
+{2724, NULL, 108.100416666667, -27.4741666666667,  6.59},
+{2725, "52    Gem", 108.674583333333, 24.885,  5.82},
+{2726, NULL, 108.107083333333, -36.5444444444444,  5.96},
+{2727, NULL, 108.065833333333, -40.4988888888889,  5.31},
+{2728, NULL, 108.635833333333, 12.1158333333333,  5.62},
+{2729, NULL, 108.583333333333, 3.11138888888889,  5.35},
+{2730, NULL, 108.349583333333, -22.6733333333333,  6.01},
+{2731, NULL, 108.545833333333, -3.90138888888889,  5.75},
+{2732, NULL, 108.564583333333, -9.9475,  5.90},
+{2733, NULL, 108.45125, -22.9063888888889,  6.36},
+{2734, NULL, 108.40125, -27.3563888888889,  6.12},
+{2735, "Gam1Vol", 107.175833333333, -70.4972222222222,  5.69},
+{2736, "Gam2Vol", 107.187083333333, -70.4988888888889,  3.78},
+{2737, NULL, 109.390416666667, 52.1308333333333,  5.92},
+{2738, "53    Gem", 108.987916666667, 27.8975,  5.71},
+{2739, NULL, 108.6175, -10.3166666666667,  6.03},
+{2740, NULL, 108.14, -46.7594444444444,  4.49},
+{2741, NULL, 108.44625, -31.0838888888889,  6.60},
+{2742, NULL, 112.768333333333, 82.4113888888889,  4.96},
+{2743, NULL, 108.488333333333, -30.34,  6.33},
+{2744, "24    Mon", 108.830416666667, -0.161388888888889,  6.41},
+{2745, "27    CMa", 108.563333333333, -26.3525,  4.66},
+{2746, NULL, 108.305833333333, -45.1830555555556,  4.89},
+{2747, NULL, 108.914166666667, 7.97777777777778,  5.82},
+{2748, NULL, 108.385, -44.6397222222222,  5.10},
+{2749, "28Ome CMa", 108.702916666667, -26.7727777777778,  3.85},
+{2750, NULL, 108.712916666667, -27.0380555555556,  5.58},
+{2751, NULL, 109.632916666667, 49.465,  5.05},
+{2752, NULL, 108.929583333333, -10.5838888888889,  5.95},
+{2753, "64    Aur", 109.509166666667, 40.8833333333333,  5.78},
+{2754, NULL, 108.008333333333, -63.19,  6.02},
+{2755, NULL, 108.947916666667, -23.7405555555556,  6.32},
+{2756, NULL, 108.8375, -30.6863888888889,  5.36},
+{2757, NULL, 109.517083333333, 30.9558333333333,  6.24},
+{2758, NULL, 109.060416666667, -15.5858333333333,  5.46},
+{2759, NULL, 108.737916666667, -41.4258333333333,  5.94},
+{2760, NULL, 109.324166666667, 6.68055555555556,  6.65},
+{2761, NULL, 108.69125, -46.8497222222222,  5.72},
+{2762, NULL, 108.659166666667, -48.2716666666667,  4.76},
+{2763, "54Lam Gem", 109.523333333333, 16.5402777777778,  3.58},
+{2764, NULL, 109.153333333333, -23.3155555555556,  4.79},
+{2765, NULL, 109.382083333333, -6.68,  6.29},
+{2766, NULL, 109.145833333333, -27.8811111111111,  4.64},
+{2767, NULL, 108.8375, -52.4997222222222,  5.97},
+{2768, NULL, 109.238333333333, -30.8966666666667,  6.32},
+{2769, NULL, 109.1325, -38.3188888888889,  5.80},
+{2770, NULL, 109.20625, -36.5927777777778,  5.03},
+{2771, NULL, 109.064583333333, -46.7744444444444,  5.66},
+{2772, "47    Cam", 110.571666666667, 59.9019444444444,  6.35},
+{2773, "Pi  Pup", 109.285833333333, -37.0975,  2.70},
+{2774, NULL, 109.449583333333, -26.7975,  6.46},
+{2775, NULL, 110.262916666667, 42.6555555555556,  6.35},
+{2776, NULL, 110.322916666667, 45.2280555555556,  5.77},
+{2777, "55Del Gem", 110.030833333333, 21.9822222222222,  3.53},
+{2778, NULL, 109.843333333333, 2.74055555555556,  5.89},
+{2779, NULL, 109.948333333333, 7.14277777777778,  5.91},
+{2780, NULL, 110.02875, 15.1427777777778,  6.45},
+{2781, "29    CMa", 109.667916666667, -24.5588888888889,  4.98},
+{2782, "30Tau CMa", 109.676666666667, -24.9541666666667,  4.40},
+{2783, "19    Lyn", 110.712083333333, 55.2844444444444,  6.53},
+{2784, "19    Lyn", 110.717083333333, 55.2813888888889,  5.45},
+{2785, NULL, 109.758333333333, -19.2802777777778,  6.09},
+{2786, NULL, 109.713333333333, -26.5858333333333,  5.28},
+{2787, NULL, 109.576666666667, -36.7341666666667,  4.66},
+{2788, NULL, 109.867083333333, -16.395,  5.70},
+{2789, NULL, 109.5175, -43.9866666666667,  5.85},
+{2790, NULL, 109.659166666667, -36.7427777777778,  5.11},
+{2791, NULL, 109.64, -39.2102777777778,  5.25},
+{2792, NULL, 110.555833333333, 38.9961111111111,  6.40},
+{2793, "65    Aur", 110.510833333333, 36.7605555555556,  5.13},
+{2794, NULL, 109.807083333333, -33.7272222222222,  6.30},
+{2795, "56    Gem", 110.486666666667, 20.4436111111111,  5.10},
+{2796, NULL, 110.2425, -14.36,  5.45},
+{2797, NULL, 113.665416666667, 80.8966666666667,  6.41},
+{2798, NULL, 110.320416666667, -8.87833333333333,  6.55},
+{2799, NULL, 110.221666666667, -22.8516666666667,  6.61},
+{2800, NULL, 110.229166666667, -26.9636111111111,  6.01},
+{2801, NULL, 110.514583333333, 0.177222222222222,  5.99},
+{2802, NULL, 110.267916666667, -25.8913888888889,  5.87},
+{2803, "Del Vol", 109.2075, -67.9572222222222,  3.98},
+{2804, NULL, 111.238333333333, 51.8872222222222,  5.80},
+{2805, "66    Aur", 111.035416666667, 40.6722222222222,  5.19},
+{2806, NULL, 110.508333333333, -8.97916666666667,  6.43},
+{2807, NULL, 110.577083333333, -2.97888888888889,  6.23},
+{2808, "57    Gem", 110.86875, 25.0505555555556,  5.03},
+{2809, NULL, 111.8575, 66.3316666666667,  6.47},
+{2810, "58    Gem", 110.8675, 22.9452777777778,  6.02},
+{2811, NULL, 110.605833333333, -5.98277777777778,  5.82},
+{2812, NULL, 110.55625, -19.0166666666667,  4.96},
+{2813, NULL, 110.089166666667, -52.3116666666667,  6.05},
+{2814, NULL, 110.090416666667, -52.3097222222222,  6.60},
+{2815, NULL, 110.16125, -52.0861111111111,  5.39},
+{2816, "59    Gem", 111.139166666667, 27.6380555555556,  5.76},
+{2817, NULL, 111.115416666667, 15.5172222222222,  6.41},
+{2818, "21    Lyn", 111.678333333333, 49.2113888888889,  4.64},
+{2819, NULL, 110.7525, -31.9238888888889,  5.43},
+{2820, "1    CMi", 111.2425, 11.6697222222222,  5.30},
+{2821, "60Iot Gem", 111.431666666667, 27.7980555555556,  3.79},
+{2822, NULL, 110.87125, -27.8341666666667,  5.38},
+{2823, NULL, 110.882916666667, -32.2022222222222,  5.39},
+{2824, NULL, 110.97625, -30.2169444444444,  6.60},
+{2825, NULL, 111.167083333333, -16.2011111111111,  5.33},
+{2826, NULL, 111.071666666667, -22.9127777777778,  6.19},
+{2827, "31Eta CMa", 111.02375, -29.3030555555556,  2.45},
+{2828, "2Eps CMi", 111.412083333333, 9.27611111111111,  4.99},
+{2829, NULL, 110.992916666667, -35.8377777777778,  6.31},
+{2830, NULL, 112.719583333333, 68.4655555555556,  5.64},
+{2831, NULL, 111.21125, -19.0122222222222,  6.24},
+{2832, NULL, 111.284583333333, -13.7519444444444,  5.78},
+{2833, NULL, 111.4625, -5.775,  5.97},
+{2834, NULL, 111.1825, -31.8088888888889,  5.35},
+{2835, NULL, 111.709166666667, 21.5358333333333,  6.54},
+{2836, NULL, 111.61625, 10.6083333333333,  6.37},
+{2837, "61    Gem", 111.734583333333, 20.2572222222222,  5.93},
+{2838, NULL, 111.514583333333, -4.5375,  6.76},
+{2839, NULL, 111.332916666667, -21.9827777777778,  6.05},
+{2840, NULL, 111.672083333333, 11.0091666666667,  6.41},
+{2841, NULL, 111.355416666667, -25.2177777777778,  5.78},
+{2842, NULL, 111.196666666667, -37.29,  6.97},
+{2843, NULL, 111.197083333333, -37.2908333333333,  6.84},
+{2844, NULL, 112.215, 48.1838888888889,  5.72},
+{2845, "3Bet CMi", 111.7875, 8.28944444444444,  2.90},
+{2846, "63    Gem", 111.935, 21.445,  5.22},
+{2847, NULL, 111.429166666667, -31.7386111111111,  6.31},
+{2848, NULL, 101.744583333333, -87.025,  6.47},
+{2849, "22    Lyn", 112.483333333333, 49.6725,  5.36},
+{2850, NULL, 111.669583333333, -23.7122222222222,  6.56},
+{2851, "5Eta CMi", 112.00875, 6.94194444444444,  5.25},
+{2852, "62Rho Gem", 112.277916666667, 31.7844444444444,  4.18},
+{2853, NULL, 111.783333333333, -17.8644444444444,  5.63},
+{2854, "4Gam CMi", 112.040833333333, 8.92555555555555,  4.32},
+{2855, NULL, 111.7475, -23.0861111111111,  5.61},
+{2856, NULL, 111.67625, -34.1408333333333,  5.90},
+{2857, "64    Gem", 112.335, 28.1180555555556,  5.05},
+{2858, NULL, 112.197083333333, 15.1094444444444,  6.22},
+{2859, NULL, 111.965416666667, -11.5569444444444,  5.79},
+{2860, NULL, 111.92875, -22.8597222222222,  5.95},
+{2861, "65    Gem", 112.452916666667, 27.9161111111111,  5.01},
+{2862, NULL, 111.59125, -51.0183333333333,  5.10},
+{2863, NULL, 111.996666666667, -29.1558333333333,  5.54},
+{2864, "6    CMi", 112.449166666667, 12.0066666666667,  4.54},
+{2865, NULL, 112.327916666667, -1.90527777777778,  5.59},
+{2866, NULL, 112.357083333333, -7.55111111111111,  5.86},
+{2867, NULL, 112.342083333333, -10.3266666666667,  5.75},
+{2868, NULL, 112.34125, -14.9991666666667,  6.05},
+{2869, NULL, 112.095, -37.8102777777778,  6.58},
+{2870, NULL, 112.21375, -31.8483333333333,  6.38},
+{2871, NULL, 112.214583333333, -31.8469444444444,  7.13},
+{2872, NULL, 112.982083333333, 38.8963888888889,  6.54},
+{2873, NULL, 112.270416666667, -31.4563888888889,  5.77},
+{2874, NULL, 112.464166666667, -23.0244444444444,  4.85},
+{2875, NULL, 112.27375, -38.8122222222222,  5.43},
+{2876, NULL, 112.712916666667, -5.22638888888889,  6.24},
+{2877, NULL, 112.951666666667, 17.0861111111111,  5.42},
+{2878, "Sig Pup", 112.3075, -43.3013888888889,  3.25},
+{2879, NULL, 113.210833333333, 22.8877777777778,  6.54},
+{2880, "7Del1CMi", 113.024583333333, 1.91444444444444,  5.25},
+{2881, NULL, 112.677083333333, -30.9622222222222,  4.65},
+{2882, NULL, 112.676666666667, -37.3397222222222,  6.65},
+{2883, NULL, 113.024166666667, -8.88083333333333,  5.90},
+{2884, NULL, 112.498333333333, -52.6511111111111,  5.87},
+{2885, NULL, 112.8575, -36.1527777777778,  6.68},
+{2886, "68    Gem", 113.402083333333, 15.8266666666667,  5.25},
+{2887, "8Del2CMi", 113.298333333333, 3.29027777777778,  5.59},
+{2888, NULL, 112.21375, -64.51,  6.39},
+{2889, NULL, 112.928333333333, -35.8877777777778,  6.61},
+{2890, "66Alp Gem", 113.65, 31.8886111111111,  2.88},
+{2891, "66Alp Gem", 113.65, 31.8883333333333,  1.98},
+{2892, NULL, 112.62875, -54.3994444444444,  5.96},
+{2893, NULL, 113.52125, 10.5683333333333,  6.28},
+{2894, NULL, 114.195833333333, 55.7552777777778,  5.92},
+{2895, NULL, 113.092916666667, -35.9613888888889,  6.3 },
+{2896, NULL, 113.78625, 30.9611111111111,  5.33},
+{2897, NULL, 113.342083333333, -14.3383333333333,  6.21},
+{2898, NULL, 113.983333333333, 43.0311111111111,  6.30},
+{2899, NULL, 113.33125, -19.4125,  5.66},
+{2900, NULL, 113.290416666667, -24.7108333333333,  5.85},
+{2901, "9Del3CMi", 113.565833333333, 3.37138888888889,  5.81},
+{2902, NULL, 113.449583333333, -14.5238888888889,  4.97},
+{2903, NULL, 114.131666666667, 46.1802777777778,  5.65},
+{2904, NULL, 113.691666666667, 2.725,  6.55},
+{2905, "69Ups Gem", 113.980416666667, 26.8958333333333,  4.06},
+{2906, NULL, 113.513333333333, -22.2961111111111,  4.45},
+{2907, NULL, 113.30625, -40.0588888888889,  6.26},
+{2908, NULL, 113.305416666667, -43.0863888888889,  6.52},
+{2909, NULL, 113.5775, -23.4736111111111,  5.83},
+{2910, NULL, 113.579583333333, -23.4747222222222,  5.87},
+{2911, NULL, 113.4625, -36.3383333333333,  5.54},
+{2912, NULL, 113.62, -26.1166666666667,  6.65},
+{2913, NULL, 113.553333333333, -33.4633333333333,  6.11},
+{2914, NULL, 114.474583333333, 48.7736111111111,  5.92},
+{2915, NULL, 114.324166666667, 40.0252777777778,  6.38},
+{2916, NULL, 113.645416666667, -27.0119444444444,  5.77},
+{2917, NULL, 113.49375, -39.9058333333333,  6.76},
+{2918, NULL, 114.144583333333, 5.86166666666667,  5.91},
+{2919, "Eps Men", 111.408333333333, -79.0941666666667,  5.53},
+{2920, NULL, 114.069166666667, -8.31138888888889,  6.27},
+{2921, NULL, 114.01625, -14.4927777777778,  5.70},
+{2922, NULL, 113.845, -28.3694444444444,  4.64},
+{2923, NULL, 114.0325, -22.1605555555556,  6.34},
+{2924, "70    Gem", 114.636666666667, 35.0486111111111,  5.56},
+{2925, NULL, 113.664583333333, -51.4747222222222,  6.28},
+{2926, NULL, 114.560416666667, 24.3602777777778,  6.27},
+{2927, "25    Mon", 114.319583333333, -4.11111111111111,  5.13},
+{2928, NULL, 114.170833333333, -19.7022222222222,  5.74},
+{2929, "23    Lyn", 115.20625, 57.0827777777778,  6.06},
+{2930, "71Omi Gem", 114.79125, 34.5841666666667,  4.90},
+{2931, NULL, 114.799583333333, 24.2225,  6.17},
+{2932, NULL, 114.412083333333, -14.4411111111111,  6.53},
+{2933, NULL, 114.32, -23.775,  6.37},
+{2934, NULL, 113.915416666667, -52.5338888888889,  4.94},
+{2935, NULL, 115.060833333333, 38.3444444444444,  5.73},
+{2936, NULL, 114.975416666667, 32.0097222222222,  6.17},
+{2937, NULL, 114.342083333333, -34.9686111111111,  4.53},
+{2938, "74    Gem", 114.869166666667, 17.6747222222222,  5.05},
+{2939, NULL, 115.301666666667, 48.1316666666667,  5.56},
+{2940, NULL, 114.182916666667, -48.8302777777778,  5.72},
+{2941, NULL, 114.007083333333, -55.8875,  6.39},
+{2942, NULL, 114.436666666667, -35.2772222222222,  6.60},
+{2943, "10Alp CMi", 114.825416666667, 5.225,  0.38},
+{2944, NULL, 114.575, -25.3647222222222,  4.70},
+{2945, NULL, 114.438333333333, -38.0105555555556,  6.38},
+{2946, "24    Lyn", 115.751666666667, 58.7102777777778,  4.99},
+{2947, NULL, 114.779583333333, -18.6791666666667,  6.72},
+{2948, NULL, 114.705416666667, -26.8016666666667,  4.50},
+{2949, NULL, 114.7075, -26.8036111111111,  4.62},
+{2950, NULL, 115.029166666667, 5.23083333333333,  6.02},
+{2951, NULL, 115.24375, 23.0186111111111,  5.89},
+{2952, NULL, 114.600833333333, -39.9913888888889,  6.59},
+{2953, NULL, 115.197083333333, 13.7708333333333,  6.24},
+{2954, NULL, 114.682916666667, -36.4969444444444,  5.80},
+{2955, NULL, 114.635833333333, -38.7811111111111,  6.19},
+{2956, NULL, 114.862083333333, -26.8630555555556,  6.50},
+{2957, NULL, 114.575833333333, -48.6011111111111,  5.68},
+{2958, NULL, 115.147916666667, -8.18583333333333,  6.01},
+{2959, NULL, 115.096666666667, -15.2636111111111,  4.94},
+{2960, NULL, 115.056666666667, -19.6608333333333,  5.93},
+{2961, NULL, 114.864166666667, -38.3083333333333,  4.84},
+{2962, NULL, 115.68125, 34.0002777777778,  6.02},
+{2963, NULL, 114.9325, -38.1394444444444,  5.73},
+{2964, NULL, 114.949166666667, -38.2608333333333,  5.76},
+{2965, NULL, 115.465833333333, 13.4805555555556,  5.77},
+{2966, NULL, 115.396666666667, 3.62472222222222,  5.94},
+{2967, NULL, 115.513333333333, 14.2083333333333,  5.56},
+{2968, NULL, 114.991666666667, -37.5794444444444,  6.00},
+{2969, NULL, 116.0175, 50.4338888888889,  5.27},
+{2970, "26Alp Mon", 115.311666666667, -9.55111111111111,  3.93},
+{2971, NULL, 114.751666666667, -53.2733333333333,  6.06},
+{2972, NULL, 115.180833333333, -27.9458333333333,  6.76},
+{2973, "75Sig Gem", 115.827916666667, 28.8836111111111,  4.28},
+{2974, NULL, 115.219583333333, -31.6608333333333,  6.56},
+{2975, "51    Cam", 116.667083333333, 65.4558333333333,  5.92},
+{2976, NULL, 115.348333333333, -22.3372222222222,  6.18},
+{2977, "49    Cam", 116.614166666667, 62.8305555555556,  6.49},
+{2978, NULL, 115.8425, 22.3994444444444,  6.21},
+{2979, NULL, 113.840416666667, -74.2755555555556,  7.16},
+{2980, NULL, 113.840833333333, -74.2755555555556,  7.26},
+{2981, NULL, 115.315833333333, -38.5336111111111,  5.42},
+{2982, NULL, 115.7725, 0.189444444444444,  6.19},
+{2983, "76    Gem", 116.02875, 25.7841666666667,  5.31},
+{2984, NULL, 115.340833333333, -44.6322222222222,  6.41},
+{2985, "77Kap Gem", 116.111666666667, 24.3980555555556,  3.57},
+{2986, NULL, 115.491666666667, -38.5288888888889,  6.54},
+{2987, NULL, 116.058333333333, 12.8594444444444,  6.43},
+{2988, NULL, 115.700416666667, -26.3511111111111,  5.64},
+{2989, NULL, 116.030833333333, 2.405,  6.47},
+{2990, "78Bet Gem", 116.32875, 28.0261111111111,  1.14},
+{2991, "79    Gem", 116.28875, 20.3163888888889,  6.33},
+{2992, NULL, 115.912916666667, -25.5038888888889,  6.55},
+{2993, "1    Pup", 115.885, -28.4111111111111,  4.59},
+{2994, NULL, 115.8, -36.0502777777778,  5.60},
+{2995, NULL, 115.779166666667, -38.8641666666667,  6.89},
+{2996, "3    Pup", 115.952083333333, -28.9547222222222,  3.96},
+{2997, NULL, 119.072083333333, 80.2655555555556,  6.56},
+{2998, NULL, 115.738333333333, -45.1733333333333,  5.06},
+{2999, NULL, 116.66375, 37.5175,  5.18},
+{3000, NULL, 114.0175, -77.6341666666667,  6.18},
+{3001, NULL, 115.92875, -38.2019444444445,  6.40},
+{3002, NULL, 115.924583333333, -40.9338888888889,  5.17},
+{3003, "81    Gem", 116.530833333333, 18.51,  4.88},
+{3004, NULL, 116.141666666667, -24.6738888888889,  5.62},
+{3005, NULL, 115.77875, -49.9927777777778,  6.57},
+{3006, NULL, 115.5425, -58.6308333333333,  6.43},
+{3007, NULL, 116.04, -36.0627777777778,  5.80},
+{3008, "11    CMi", 116.5675, 10.7683333333333,  5.30},
+{3009, "2    Pup", 116.369583333333, -14.6861111111111,  6.89},
+{3010, "2    Pup", 116.37125, -14.6908333333333,  6.07},
+{3011, NULL, 116.1425, -37.9430555555556,  5.88},
+{3012, NULL, 115.722083333333, -58.23,  6.21},
+{3013, "80Pi  Gem", 116.87625, 33.4155555555556,  5.14},
+{3014, NULL, 116.509166666667, -6.7725,  5.49},
+{3015, "4    Pup", 116.487083333333, -14.5638888888889,  5.04},
+{3016, NULL, 116.269166666667, -37.8877777777778,  6.54},
+{3017, NULL, 116.31375, -37.9686111111111,  3.61},
+{3018, NULL, 116.395833333333, -34.1730555555555,  5.37},
+{3019, NULL, 116.687083333333, -12.6752777777778,  6.39},
+{3020, NULL, 116.325416666667, -43.7522222222222,  6.03},
+{3021, "82    Gem", 117.14, 23.1411111111111,  6.18},
+{3022, NULL, 116.543333333333, -37.9338888888889,  5.88},
+{3023, NULL, 116.802083333333, -22.5197222222222,  5.90},
+{3024, "Zet Vol", 115.455, -72.6061111111111,  3.95},
+{3025, NULL, 116.639166666667, -40.0597222222222,  6.57},
+{3026, NULL, 116.910416666667, -15.9908333333333,  6.34},
+{3027, NULL, 116.938333333333, -16.0144444444444,  6.43},
+{3028, NULL, 117.77375, 54.1291666666667,  6.02},
+{3029, "5    Pup", 116.98625, -12.1930555555556,  5.48},
+{3030, NULL, 117.258333333333, 13.3708333333333,  6.04},
+{3031, NULL, 116.398333333333, -56.7225,  6.12},
+{3032, NULL, 116.774166666667, -39.3313888888889,  6.31},
+{3033, NULL, 117.245416666667, 4.33277777777778,  6.53},
+{3034, "Omi Pup", 117.021666666667, -25.9372222222222,  4.50},
+{3035, NULL, 116.854166666667, -38.5111111111111,  5.08},
+{3036, NULL, 116.182916666667, -66.0719444444444,  6.38},
+{3037, NULL, 116.88125, -46.6086111111111,  5.23},
+{3038, NULL, 116.054166666667, -69.8213888888889,  6.18},
+{3039, NULL, 118.1525, 55.2094444444445,  6.38},
+{3040, NULL, 117.759583333333, 33.2336111111111,  6.03},
+{3041, NULL, 117.035416666667, -40.6522222222222,  6.14},
+{3042, NULL, 117.369166666667, -13.3533333333333,  6.23},
+{3043, NULL, 117.257083333333, -24.9122222222222,  5.33},
+{3044, "6    Pup", 117.421666666667, -17.2283333333333,  5.18},
+{3045, "7Xi  Pup", 117.32375, -24.8597222222222,  3.34},
+{3046, NULL, 117.084583333333, -47.0777777777778,  4.71},
+{3047, NULL, 117.544166666667, -9.18333333333333,  5.61},
+{3048, NULL, 117.438333333333, -20.2069444444444,  6.56},
+{3049, NULL, 117.31125, -35.2433333333333,  5.93},
+{3050, NULL, 117.6975, 3.27722222222222,  6.18},
+{3051, NULL, 117.52375, -19.5236111111111,  6.12},
+{3052, NULL, 117.3975, -33.2888888888889,  5.60},
+{3053, NULL, 117.98625, 19.3252777777778,  5.99},
+{3054, NULL, 117.73, -11.1286111111111,  6.16},
+{3055, NULL, 117.309583333333, -46.3733333333333,  4.11},
+{3056, NULL, 117.08, -56.4711111111111,  6.33},
+{3057, NULL, 117.3675, -44.7519444444444,  6.32},
+{3058, NULL, 117.30375, -46.8577777777778,  5.84},
+{3059, "13Zet CMi", 117.925, 1.76694444444444,  5.14},
+{3060, NULL, 117.75, -24.5283333333333,  6.45},
+{3061, NULL, 118.03, 3.27722222222222,  6.31},
+{3062, NULL, 117.277916666667, -56.4105555555556,  5.59},
+{3063, "8    Pup", 117.920416666667, -12.8194444444444,  6.36},
+{3064, "9    Pup", 117.942916666667, -13.8980555555556,  5.17},
+{3065, "25    Lyn", 118.622083333333, 47.3861111111111,  6.25},
+{3066, "26    Lyn", 118.677916666667, 47.5647222222222,  5.45},
+{3067, "83Phi Gem", 118.374166666667, 26.7658333333333,  4.97},
+{3068, NULL, 117.92875, -21.1738888888889,  5.63},
+{3069, NULL, 117.676666666667, -44.5797222222222,  6.45},
+{3070, NULL, 117.30375, -60.2836111111111,  5.78},
+{3071, NULL, 117.599583333333, -50.5097222222222,  5.91},
+{3072, NULL, 118.199583333333, -5.42805555555556,  5.76},
+{3073, "10    Pup", 118.07875, -14.8463888888889,  5.69},
+{3074, NULL, 117.835416666667, -43.0955555555556,  6.32},
+{3075, NULL, 120.04875, 73.9180555555556,  5.41},
+{3076, NULL, 117.478333333333, -60.0511111111111,  6.72},
+{3077, NULL, 119.111666666667, 56.5044444444444,  6.72},
+{3078, NULL, 117.917916666667, -42.8883333333333,  6.04},
+{3079, NULL, 118.065416666667, -34.7052777777778,  5.01},
+{3080, NULL, 118.054166666667, -40.5758333333333,  3.73},
+{3081, NULL, 117.420833333333, -66.1958333333333,  5.79},
+{3082, NULL, 121.19625, 79.4797222222222,  5.42},
+{3083, NULL, 118.92, 35.4127777777778,  6.23},
+{3084, NULL, 118.16125, -38.8630555555556,  4.49},
+{3085, NULL, 118.264583333333, -36.3638888888889,  5.43},
+{3086, "85    Gem", 118.91625, 19.8838888888889,  5.35},
+{3087, NULL, 118.880833333333, 8.86277777777778,  5.86},
+{3088, NULL, 118.12375, -54.3672222222222,  5.70},
+{3089, NULL, 118.265416666667, -49.6130555555556,  4.63},
+{3090, NULL, 118.325833333333, -48.1030555555556,  4.24},
+{3091, NULL, 118.545833333333, -35.8775,  5.49},
+{3092, NULL, 118.66625, -34.8469444444444,  6.15},
+{3093, NULL, 119.099583333333, 4.48583333333333,  6.17},
+{3094, NULL, 119.569166666667, 43.9775,  6.34},
+{3095, "1    Cnc", 119.2475, 15.7902777777778,  5.78},
+{3096, NULL, 118.807083333333, -30.9175,  6.44},
+{3097, NULL, 119.31625, 8.64138888888889,  6.05},
+{3098, NULL, 119.3175, 1.12694444444444,  6.35},
+{3099, NULL, 119.095, -30.2852777777778,  6.33},
+{3100, NULL, 118.752083333333, -52.5830555555556,  6.38},
+{3101, NULL, 118.94375, -43.845,  6.02},
+{3102, "11    Pup", 119.214583333333, -22.88,  4.20},
+{3103, NULL, 119.524166666667, 7.21361111111111,  6.41},
+{3104, NULL, 119.63125, 16.5186111111111,  5.99},
+{3105, NULL, 118.721666666667, -57.3030555555556,  5.63},
+{3106, NULL, 120.33625, 59.0475,  5.77},
+{3107, NULL, 119.10125, -40.7363888888889,  6.78},
+{3108, NULL, 124.224166666667, 84.0577777777778,  6.49},
+{3109, "53    Cam", 120.426666666667, 60.3244444444444,  6.01},
+{3110, "14    CMi", 119.585833333333, 2.22472222222222,  5.29},
+{3111, NULL, 119.24125, -42.4061111111111,  6.09},
+{3112, NULL, 120.628333333333, 63.0902777777778,  6.40},
+{3113, NULL, 119.417083333333, -30.3347222222222,  4.79},
+{3114, NULL, 119.24125, -43.5002777777778,  5.35},
+{3115, NULL, 119.89625, 13.2422222222222,  6.02},
+{3116, NULL, 119.326666666667, -44.1097222222222,  5.09},
+{3117, "Chi Car", 119.194583333333, -52.9822222222222,  3.47},
+{3118, NULL, 119.333333333333, -47.8902777777778,  6.22},
+{3119, NULL, 120.649166666667, 57.2736111111111,  6.49},
+{3120, NULL, 119.0775, -60.5263888888889,  5.74},
+{3121, NULL, 119.465833333333, -45.5777777777778,  5.17},
+{3122, "27    Mon", 119.93375, -3.67972222222222,  4.93},
+{3123, "12    Pup", 119.77375, -23.3105555555556,  5.11},
+{3124, "2Ome1Cnc", 120.232916666667, 25.3927777777778,  5.83},
+{3125, NULL, 120.2, 19.8161111111111,  6.25},
+{3126, NULL, 119.21125, -59.1263888888889,  6.25},
+{3127, NULL, 120.252916666667, 23.5830555555556,  6.34},
+{3128, "3    Cnc", 120.197083333333, 17.3086111111111,  5.55},
+{3129, NULL, 119.56, -49.245,  4.41},
+{3130, NULL, 120.479583333333, 35.4130555555556,  6.34},
+{3131, NULL, 119.966666666667, -18.3991666666667,  4.61},
+{3132, "4Ome2Cnc", 120.4325, 25.0897222222222,  6.31},
+{3133, NULL, 119.589166666667, -51.4486111111111,  6.44},
+{3134, "5    Cnc", 120.37625, 16.4552777777778,  5.99},
+{3135, NULL, 120.18375, -2.88166666666667,  6.51},
+{3136, NULL, 120.3075, 4.87972222222222,  5.65},
+{3137, NULL, 119.7575, -45.2161111111111,  5.99},
+{3138, NULL, 119.445416666667, -60.3033333333333,  5.60},
+{3139, NULL, 119.302083333333, -63.2969444444444,  6.14},
+{3140, NULL, 119.868333333333, -39.2972222222222,  5.24},
+{3141, "28    Mon", 120.305416666667, -1.3925,  4.68},
+{3142, NULL, 119.80125, -49.9766666666667,  6.32},
+{3143, NULL, 119.805833333333, -49.9736111111111,  6.34},
+{3144, NULL, 120.46125, 8.91388888888889,  6.22},
+{3145, NULL, 120.56625, 2.33444444444444,  4.39},
+{3146, NULL, 120.081666666667, -45.4569444444444,  6.61},
+{3147, NULL, 119.710416666667, -60.8244444444444,  5.81},
+{3148, NULL, 120.062083333333, -48.9813888888889,  6.02},
+{3149, "Chi Gem", 120.879583333333, 27.7941666666667,  4.94},
+{3150, NULL, 120.608333333333, -6.33722222222222,  6.33},
+{3151, NULL, 120.120416666667, -48.8713888888889,  6.12},
+{3152, NULL, 119.9175, -60.2075,  6.33},
+{3153, NULL, 119.906666666667, -60.5869444444444,  5.17},
+{3154, NULL, 120.405833333333, -37.2836111111111,  5.95},
+{3155, NULL, 120.525833333333, -37.0505555555556,  6.34},
+{3156, NULL, 120.207916666667, -54.1513888888889,  5.87},
+{3157, NULL, 120.345416666667, -54.515,  6.10},
+{3158, NULL, 121.188333333333, 18.8422222222222,  6.15},
+{3159, NULL, 120.083333333333, -63.5675,  4.82},
+{3160, NULL, 120.767083333333, -32.4638888888889,  5.82},
+{3161, NULL, 120.38125, -55.455,  6.28},
+{3162, NULL, 120.686666666667, -41.31,  5.52},
+{3163, "8    Cnc", 121.26875, 13.1180555555556,  5.12},
+{3164, NULL, 121.404166666667, 27.5297222222222,  6.21},
+{3165, "Zet Pup", 120.89625, -40.0033333333333,  2.25},
+{3166, NULL, 120.872916666667, -42.9486111111111,  6.29},
+{3167, "28    Lyn", 121.79125, 43.2602777777778,  6.26},
+{3168, "14    Pup", 121.172916666667, -19.7280555555556,  6.13},
+{3169, "9Mu 1Cnc", 121.576666666667, 22.6355555555556,  5.99},
+{3170, NULL, 121.0675, -32.675,  5.31},
+{3171, NULL, 119.817083333333, -73.2447222222222,  6.34},
+{3172, NULL, 121.456666666667, -0.573611111111111,  6.41},
+{3173, "27    Lyn", 122.114166666667, 51.5066666666667,  4.84},
+{3174, NULL, 121.614583333333, -9.245,  6.23},
+{3175, NULL, 122.515833333333, 58.2480555555556,  5.93},
+{3176, "10Mu 2Cnc", 121.940833333333, 21.5816666666667,  5.30},
+{3177, NULL, 121.437083333333, -33.5691666666667,  6.14},
+{3178, NULL, 121.176666666667, -50.5905555555556,  5.95},
+{3179, NULL, 121.335, -46.9788888888889,  6.19},
+{3180, NULL, 121.266666666667, -53.1080555555556,  5.53},
+{3181, NULL, 122.34625, 42.4305555555556,  6.27},
+{3182, NULL, 123.203333333333, 68.4741666666667,  5.32},
+{3183, NULL, 121.825, -20.5547222222222,  5.38},
+{3184, "12    Cnc", 122.176666666667, 13.6408333333333,  6.27},
+{3185, "15Rho Pup", 121.885833333333, -24.3041666666667,  2.81},
+{3186, NULL, 121.17875, -62.8361111111111,  6.30},
+{3187, NULL, 121.668333333333, -45.2663888888889,  5.05},
+{3188, "29Zet Mon", 122.148333333333, -2.98388888888889,  4.34},
+{3189, NULL, 122.237083333333, -11.3397222222222,  6.32},
+{3190, NULL, 122.18125, -20.3630555555556,  6.36},
+{3191, "14Psi Cnc", 122.613333333333, 25.5072222222222,  5.73},
+{3192, "16    Pup", 122.256666666667, -19.245,  4.40},
+{3193, NULL, 122.84, 38.7313888888889,  6.58},
+{3194, NULL, 122.36875, -16.2488888888889,  5.68},
+{3195, NULL, 122.156666666667, -37.6813888888889,  6.37},
+{3196, NULL, 122.277916666667, -30.3225,  6.65},
+{3197, NULL, 126.137083333333, 82.4308333333333,  6.32},
+{3198, NULL, 122.745, 14.6294444444444,  6.23},
+{3199, NULL, 122.2925, -35.455,  6.20},
+{3200, NULL, 123.459166666667, 56.4522222222222,  5.85},
+{3201, NULL, 122.819166666667, 9.82111111111111,  6.07},
+{3202, "18    Pup", 122.665833333333, -13.7991666666667,  5.54},
+{3203, NULL, 122.29, -48.6844444444444,  5.70},
+{3204, NULL, 122.399583333333, -44.1227777777778,  5.21},
+{3205, NULL, 122.44875, -42.6405555555556,  6.26},
+{3206, "Gam1Vel", 122.372083333333, -47.3458333333333,  4.27},
+{3207, "Gam2Vel", 122.383333333333, -47.3366666666667,  1.78},
+{3208, "16Zet1Cnc", 123.052916666667, 17.6477777777778,  5.63},
+{3209, "16Zet1Cnc", 123.052916666667, 17.6477777777778,  6.02},
+{3210, "16Zet2Cnc", 123.055416666667, 17.6477777777778,  6.20},
+{3211, "19    Pup", 122.817916666667, -12.9269444444444,  4.72},
+{3212, NULL, 122.8875, -7.7725,  5.36},
+{3213, NULL, 122.43, -47.9375,  5.23},
+{3214, NULL, 123.092083333333, 14.0038888888889,  6.54},
+{3215, "15    Cnc", 123.287083333333, 29.6566666666667,  5.64},
+{3216, NULL, 124.884166666667, 75.7569444444444,  5.54},
+{3217, NULL, 122.102083333333, -63.8011111111111,  6.28},
+{3218, NULL, 122.39, -56.0855555555556,  5.66},
+{3219, NULL, 122.756666666667, -37.2922222222222,  6.44},
+{3220, NULL, 122.252916666667, -61.3025,  4.76},
+{3221, NULL, 123.960416666667, 60.3805555555556,  6.45},
+{3222, NULL, 123.249166666667, 16.5141666666667,  6.01},
+{3223, "Eps Vol", 121.9825, -68.6172222222222,  4.35},
+{3224, NULL, 123.42375, 23.1377777777778,  6.56},
+{3225, NULL, 122.839583333333, -39.6186111111111,  4.45},
+{3226, NULL, 122.857916666667, -42.9872222222222,  4.75},
+{3227, NULL, 122.79625, -48.4619444444444,  5.82},
+{3228, NULL, 123.54625, 17.6758333333333,  6.47},
+{3229, "20    Pup", 123.333333333333, -15.7883333333333,  4.99},
+{3230, NULL, 123.191666666667, -29.9108333333333,  6.52},
+{3231, NULL, 123.5875, 13.0483333333333,  6.38},
+{3232, NULL, 123, -46.6441666666667,  5.76},
+{3233, NULL, 123.214583333333, -37.9244444444444,  6.43},
+{3234, NULL, 123.12875, -46.2641666666667,  6.03},
+{3235, "29    Lyn", 124.46, 59.5711111111111,  5.64},
+{3236, NULL, 125.167916666667, 72.4072222222222,  5.98},
+{3237, NULL, 123.373333333333, -35.8997222222222,  4.78},
+{3238, NULL, 123.42125, -33.5691666666667,  6.37},
+{3239, NULL, 123.545833333333, -32.1408333333333,  6.06},
+{3240, NULL, 123.493333333333, -36.3225,  5.08},
+{3241, NULL, 123.495, -36.3411111111111,  6.11},
+{3242, NULL, 123.555, -35.4905555555556,  5.78},
+{3243, NULL, 123.512083333333, -40.3480555555556,  4.44},
+{3244, NULL, 123.400833333333, -46.9919444444444,  5.13},
+{3245, NULL, 124.822083333333, 62.5072222222222,  5.71},
+{3246, NULL, 124.565833333333, 54.1436111111111,  6.27},
+{3247, NULL, 123.392083333333, -50.1961111111111,  5.51},
+{3248, NULL, 124.14125, 11.7263888888889,  7.13},
+{3249, "17Bet Cnc", 124.12875, 9.18555555555556,  3.52},
+{3250, NULL, 123.599583333333, -45.8344444444444,  5.83},
+{3251, NULL, 123.96875, -30.9258333333333,  6.21},
+{3252, NULL, 124.382083333333, 8.86611111111111,  6.29},
+{3253, NULL, 123.995416666667, -35.9027777777778,  6.16},
+{3254, "30    Lyn", 125.10875, 57.7433333333333,  5.89},
+{3255, NULL, 124.225833333333, -21.3202777777778,  6.60},
+{3256, NULL, 123.847083333333, -50.4494444444444,  6.44},
+{3257, "21    Pup", 124.34625, -16.285,  6.16},
+{3258, NULL, 125.12125, 53.5744444444444,  6.49},
+{3259, NULL, 124.599583333333, -12.6319444444444,  5.98},
+{3260, NULL, 123.81625, -62.9158333333333,  5.16},
+{3261, NULL, 124.492916666667, -30.0033333333333,  6.45},
+{3262, "18Chi Cnc", 125.01625, 27.2177777777778,  5.14},
+{3263, NULL, 125.68375, 60.6311111111111,  6.41},
+{3264, NULL, 125.0875, 20.7477777777778,  5.83},
+{3265, NULL, 124.812916666667, -10.1658333333333,  6.32},
+{3266, NULL, 124.5725, -35.4516666666667,  5.58},
+{3267, NULL, 124.5525, -37.3741666666667,  6.70},
+{3268, "19Lam Cnc", 125.13375, 24.0222222222222,  5.98},
+{3269, NULL, 124.957916666667, 3.94777777777778,  6.05},
+{3270, NULL, 124.63875, -36.6594444444444,  4.45},
+{3271, NULL, 125.054583333333, -0.909444444444444,  6.18},
+{3272, NULL, 125.07125, -5.32916666666667,  6.13},
+{3273, NULL, 124.8725, -34.5902777777778,  6.43},
+{3274, NULL, 124.4825, -59.1669444444444,  6.42},
+{3275, "31    Lyn", 125.70875, 43.1880555555556,  4.25},
+{3276, NULL, 125.114166666667, -22.9247222222222,  6.13},
+{3277, NULL, 125.952083333333, 53.2197222222222,  5.51},
+{3278, NULL, 125.334166666667, -1.60222222222222,  6.50},
+{3279, NULL, 125.338333333333, -20.0791666666667,  5.58},
+{3280, NULL, 124.57875, -65.6133333333333,  5.07},
+{3281, NULL, 125.4775, -17.5863888888889,  5.75},
+{3282, NULL, 125.345833333333, -33.0544444444444,  4.83},
+{3283, NULL, 125.3375, -36.4844444444444,  5.20},
+{3284, "20    Cnc", 125.840833333333, 18.3322222222222,  5.95},
+{3285, NULL, 125.625833333333, -6.17916666666667,  6.15},
+{3286, NULL, 125.350833333333, -39.6208333333333,  6.16},
+{3287, NULL, 126.178333333333, 42.005,  6.02},
+{3288, NULL, 125.725, -7.54333333333333,  5.96},
+{3289, "22    Pup", 125.695, -13.0547222222222,  6.11},
+{3290, "21    Cnc", 125.98, 10.6319444444444,  6.08},
+{3291, NULL, 125.707916666667, -26.3480555555556,  5.90},
+{3292, NULL, 126.270416666667, 35.0113888888889,  6.06},
+{3293, NULL, 125.3, -57.9730555555556,  5.97},
+{3294, NULL, 125.631666666667, -48.4902777777778,  4.82},
+{3295, NULL, 126.151666666667, -4.71694444444444,  6.01},
+{3296, NULL, 125.821666666667, -38.2858333333333,  6.32},
+{3297, "1    Hya", 126.145833333333, -3.75111111111111,  5.61},
+{3298, NULL, 125.282083333333, -64.1061111111111,  6.12},
+{3299, "25    Cnc", 126.457916666667, 17.0461111111111,  6.14},
+{3300, NULL, 125.73, -52.1238888888889,  5.85},
+{3301, "Kap1Vol", 124.954166666667, -71.515,  5.37},
+{3302, "Kap2Vol", 125.002916666667, -71.5052777777778,  5.65},
+{3303, NULL, 127.4425, 67.2975,  5.88},
+{3304, "22Phi1Cnc", 126.615416666667, 27.8936111111111,  5.57},
+{3305, NULL, 126.397916666667, 2.10222222222222,  5.73},
+{3306, NULL, 126.478333333333, 7.56444444444444,  5.13},
+{3307, "Eps Car", 125.628333333333, -59.5097222222222,  1.86},
+{3308, NULL, 126.229583333333, -23.1536111111111,  5.68},
+{3309, NULL, 126.903333333333, 45.6530555555556,  6.32},
+{3310, "23Phi2Cnc", 126.695, 26.9344444444444,  6.32},
+{3311, "23Phi2Cnc", 126.695833333333, 26.9352777777778,  6.30},
+{3312, "24    Cnc", 126.665833333333, 24.5341666666667,  7.02},
+{3313, "24    Cnc", 126.667083333333, 24.5352777777778,  7.81},
+{3314, NULL, 126.415, -3.90638888888889,  3.90},
+{3315, NULL, 126.265416666667, -24.0461111111111,  5.28},
+{3316, NULL, 126.329583333333, -21.0458333333333,  6.01},
+{3317, NULL, 126.414166666667, -17.4394444444444,  6.44},
+{3318, "Alp Cha", 124.631666666667, -76.9197222222222,  4.07},
+{3319, "27    Cnc", 126.682916666667, 12.6544444444444,  5.50},
+{3320, NULL, 126.481666666667, -14.9297222222222,  5.98},
+{3321, "2    Hya", 126.613333333333, -3.9875,  5.59},
+{3322, NULL, 126.238333333333, -42.7694444444444,  5.98},
+{3323, "1Omi UMa", 127.56625, 60.7180555555556,  3.36},
+{3324, NULL, 126.674583333333, -12.5344444444444,  5.54},
+{3325, NULL, 126.821666666667, -6.40972222222222,  6.59},
+{3326, NULL, 126.46625, -42.1533333333333,  5.47},
+{3327, NULL, 126.573333333333, -39.0594444444444,  6.53},
+{3328, NULL, 126.575833333333, -39.0602777777778,  7.25},
+{3329, "28    Cnc", 127.153333333333, 24.1447222222222,  6.10},
+{3330, NULL, 126.379166666667, -51.7280555555556,  5.17},
+{3331, NULL, 126.711666666667, -29.2152777777778,  6.73},
+{3332, NULL, 128.2225, 69.32,  6.31},
+{3333, "29    Cnc", 127.155416666667, 14.2108333333333,  5.95},
+{3334, "Eta Vol", 125.518333333333, -73.4,  5.29},
+{3335, NULL, 126.88875, -20.8438888888889,  6.56},
+{3336, NULL, 126.818333333333, -31.6730555555556,  6.33},
+{3337, NULL, 127.121666666667, -2.51722222222222,  6.39},
+{3338, NULL, 127.082083333333, -8.81611111111111,  6.43},
+{3339, NULL, 126.972916666667, -26.1325,  6.62},
+{3340, "The Cha", 125.160416666667, -77.4844444444444,  4.35},
+{3341, NULL, 126.605, -52.8075,  6.05},
+{3342, NULL, 127.212083333333, -9.74833333333333,  6.00},
+{3343, NULL, 126.997083333333, -35.1138888888889,  5.75},
+{3344, NULL, 127.149583333333, -23.0716666666667,  6.51},
+{3345, NULL, 127.222083333333, -20.9502777777778,  6.67},
+{3346, NULL, 126.465, -64.6008333333333,  5.97},
+{3347, "Bet Vol", 126.434166666667, -66.1369444444445,  3.77},
+{3348, NULL, 127.832916666667, 37.2658333333333,  6.18},
+{3349, NULL, 126.864166666667, -55.0116666666667,  6.53},
+{3350, NULL, 126.902083333333, -53.0886111111111,  5.09},
+{3351, NULL, 128.139583333333, 53.1147222222222,  6.24},
+{3352, NULL, 129.202916666667, 74.7236111111111,  6.31},
+{3353, NULL, 127.365, -27.3325,  6.70},
+{3354, "2    UMa", 128.650833333333, 65.145,  5.47},
+{3355, "30Ups1Cnc", 127.877083333333, 24.0811111111111,  5.75},
+{3356, NULL, 127.281666666667, -44.1605555555556,  5.79},
+{3357, "31The Cnc", 127.89875, 18.0944444444444,  5.35},
+{3358, NULL, 127.269583333333, -47.9291666666667,  5.33},
+{3359, NULL, 127.365, -44.725,  4.99},
+{3360, NULL, 128.229166666667, 38.0163888888889,  5.90},
+{3361, NULL, 127.9775, 9.81444444444445,  6.83},
+{3362, NULL, 127.619166666667, -32.1594444444444,  5.65},
+{3363, NULL, 127.44, -46.3319444444444,  5.99},
+{3364, NULL, 127.623333333333, -36.7211111111111,  6.69},
+{3365, "32    Lyn", 128.340833333333, 36.4363888888889,  6.24},
+{3366, "33Eta Cnc", 128.177083333333, 20.4411111111111,  5.33},
+{3367, NULL, 127.87875, -19.5775,  5.42},
+{3368, NULL, 127.40125, -55.1911111111111,  6.36},
+{3369, "32Ups2Cnc", 128.250416666667, 24.0847222222222,  6.36},
+{3370, NULL, 126.820416666667, -70.0933333333333,  5.53},
+{3371, NULL, 127.663333333333, -44.7372222222222,  6.30},
+{3372, "34    Cnc", 128.16625, 10.0661111111111,  6.46},
+{3373, NULL, 127.8525, -39.0641666666667,  6.31},
+{3374, NULL, 128.13875, -15.0294444444444,  6.38},
+{3375, NULL, 127.795, -47.8666666666667,  6.39},
+{3376, NULL, 128.437916666667, 13.2572222222222,  6.28},
+{3377, "33    Lyn", 128.6825, 36.4194444444444,  5.78},
+{3378, NULL, 128.43125, 4.75666666666667,  5.87},
+{3379, NULL, 129.9275, 73.6297222222222,  6.15},
+{3380, NULL, 128.555416666667, 8.45194444444444,  6.03},
+{3381, NULL, 128.27, -24.6063888888889,  6.19},
+{3382, NULL, 127.873333333333, -54.3941666666667,  6.34},
+{3383, NULL, 128.506666666667, -2.15166666666667,  5.81},
+{3384, NULL, 128.214583333333, -31.5008333333333,  6.38},
+{3385, NULL, 128.244166666667, -34.6338888888889,  6.36},
+{3386, NULL, 128.02, -53.2122222222222,  5.69},
+{3387, "35    Cnc", 128.830833333333, 19.59,  6.58},
+{3388, NULL, 128.332916666667, -38.3711111111111,  6.49},
+{3389, NULL, 128.409583333333, -38.8488888888889,  5.96},
+{3390, NULL, 128.376666666667, -46.9711111111111,  6.24},
+{3391, "3Pi 1UMa", 129.79875, 65.0208333333333,  5.64},
+{3392, NULL, 128.85375, 2.74361111111111,  6.33},
+{3393, NULL, 126.0825, -80.9141666666667,  5.69},
+{3394, NULL, 129.032083333333, 15.3136111111111,  6.32},
+{3395, NULL, 128.9625, 6.62,  5.99},
+{3396, NULL, 128.96375, 6.6225,  7.25},
+{3397, NULL, 128.632083333333, -32.5986111111111,  6.43},
+{3398, "3    Hya", 128.8675, -7.98222222222222,  5.72},
+{3399, NULL, 128.622083333333, -37.6113888888889,  6.30},
+{3400, NULL, 129.5925, 53.4013888888889,  5.66},
+{3401, NULL, 129.7925, 59.9394444444444,  6.48},
+{3402, NULL, 128.87, -26.8436111111111,  5.96},
+{3403, "4Pi 2UMa", 130.053333333333, 64.3277777777778,  4.60},
+{3404, NULL, 128.8025, -39.97,  6.47},
+{3405, NULL, 129.75, 52.925,  6.42},
+{3406, "36    Cnc", 129.274166666667, 9.65555555555556,  5.88},
+{3407, NULL, 128.681666666667, -49.9441666666667,  5.01},
+{3408, NULL, 129.823333333333, 52.7116666666667,  5.91},
+{3409, NULL, 129.579166666667, 32.8019444444444,  5.94},
+{3410, "4Del Hya", 129.414166666667, 5.70361111111111,  4.16},
+{3411, NULL, 129.362916666667, -4.93361111111111,  6.19},
+{3412, "37    Cnc", 129.521666666667, 9.57472222222222,  6.53},
+{3413, NULL, 128.967083333333, -50.97,  5.80},
+{3414, NULL, 128.831666666667, -58.0091666666667,  4.86},
+{3415, NULL, 128.814166666667, -58.225,  5.26},
+{3416, NULL, 129.584583333333, -6.6625,  6.51},
+{3417, NULL, 128.175833333333, -73.3566666666667,  6.12},
+{3418, "5Sig Hya", 129.689166666667, 3.34138888888889,  4.44},
+{3419, NULL, 129.37375, -33.7458333333333,  6.48},
+{3420, "Eta Pyx", 129.4675, -26.255,  5.27},
+{3421, NULL, 129.332916666667, -40.1475,  6.55},
+{3422, "34    Lyn", 130.254583333333, 45.8338888888889,  5.37},
+{3423, NULL, 130.07625, 31.9419444444444,  6.10},
+{3424, NULL, 129.8525, 8.01722222222222,  6.45},
+{3425, NULL, 129.667916666667, -19.7369444444444,  6.33},
+{3426, NULL, 129.41125, -42.9891666666667,  4.14},
+{3427, "39    Cnc", 130.026666666667, 20.0077777777778,  6.39},
+{3428, NULL, 130.092083333333, 19.67,  6.44},
+{3429, "41Eps Cnc", 130.1125, 19.545,  6.30},
+{3430, NULL, 129.783333333333, -22.6619444444444,  5.05},
+{3431, "6    Hya", 130.00625, -12.4752777777778,  4.98},
+{3432, NULL, 129.328333333333, -62.8536111111111,  5.47},
+{3433, "Zet Pyx", 129.927083333333, -29.5611111111111,  4.89},
+{3434, NULL, 129.842083333333, -36.6069444444444,  6.13},
+{3435, NULL, 129.687083333333, -53.0905555555556,  6.47},
+{3436, NULL, 130.750833333333, 46.9011111111111,  6.22},
+{3437, NULL, 130.256666666667, -9.05194444444444,  6.63},
+{3438, "Bet Pyx", 130.025833333333, -35.3083333333333,  3.97},
+{3439, NULL, 130.080416666667, -40.2641666666667,  5.20},
+{3440, NULL, 129.849166666667, -53.4397222222222,  5.48},
+{3441, "9    Hya", 130.430416666667, -15.9433333333333,  4.88},
+{3442, NULL, 129.99, -53.055,  5.19},
+{3443, NULL, 129.805, -60.3172222222222,  6.36},
+{3444, NULL, 130.147083333333, -45.1913888888889,  5.71},
+{3445, NULL, 130.156666666667, -46.6488888888889,  3.84},
+{3446, NULL, 130.540833333333, -11.9661111111111,  6.45},
+{3447, NULL, 130.073333333333, -52.9219444444444,  3.62},
+{3448, NULL, 130.0725, -53.0152777777778,  5.61},
+{3449, "43Gam Cnc", 130.82125, 21.4686111111111,  4.66},
+{3450, "45    Cnc", 130.80125, 12.6808333333333,  5.64},
+{3451, NULL, 131.042083333333, 36.9180555555556,  6.33},
+{3452, NULL, 130.304583333333, -47.3169444444444,  4.77},
+{3453, NULL, 130.272083333333, -48.9225,  5.90},
+{3454, "7Eta Hya", 130.80625, 3.39861111111111,  4.30},
+{3455, NULL, 130.181666666667, -57.5452777777778,  6.34},
+{3456, NULL, 130.487083333333, -45.4108333333333,  5.23},
+{3457, NULL, 130.154166666667, -59.7611111111111,  4.33},
+{3458, NULL, 130.99875, 4.33472222222222,  6.37},
+{3459, NULL, 130.918333333333, -7.23361111111111,  4.62},
+{3460, "The Vol", 129.771666666667, -70.3869444444445,  5.20},
+{3461, "47Del Cnc", 131.17125, 18.1541666666667,  3.94},
+{3462, NULL, 130.566666666667, -48.0991666666667,  5.51},
+{3463, NULL, 130.7375, -35.9433333333333,  6.42},
+{3464, "46    Cnc", 131.339166666667, 30.6977777777778,  6.13},
+{3465, "49    Cnc", 131.1875, 10.0816666666667,  5.66},
+{3466, NULL, 130.57875, -53.1,  5.52},
+{3467, NULL, 130.60625, -53.1138888888889,  4.86},
+{3468, "Alp Pyx", 130.897916666667, -33.1863888888889,  3.68},
+{3469, "10    Hya", 131.255416666667, 5.68055555555556,  6.13},
+{3470, NULL, 132.205833333333, 66.7080555555556,  6.20},
+{3471, NULL, 130.587083333333, -55.7741666666667,  6.29},
+{3472, NULL, 131.336666666667, -2.60083333333333,  6.41},
+{3473, NULL, 131.23, -21.1677777777778,  6.11},
+{3474, "48Iot Cnc", 131.666666666667, 28.7652777777778,  6.57},
+{3475, "48Iot Cnc", 131.674166666667, 28.76,  4.02},
+{3476, NULL, 130.917916666667, -49.8227777777778,  5.16},
+{3477, NULL, 131.1, -42.6491666666667,  4.07},
+{3478, NULL, 131.510416666667, -2.04888888888889,  5.70},
+{3479, NULL, 131.21625, -37.1472222222222,  5.76},
+{3480, NULL, 131.52875, -11.0063888888889,  6.25},
+{3481, "50    Cnc", 131.733333333333, 12.11,  5.87},
+{3482, "11Eps Hya", 131.694166666667, 6.41888888888889,  3.38},
+{3483, NULL, 131.455416666667, -25.3875,  6.10},
+{3484, "12    Hya", 131.59375, -13.5477777777778,  4.32},
+{3485, "Del Vel", 131.175833333333, -54.7083333333333,  1.96},
+{3486, NULL, 131.8125, -1.89722222222222,  5.29},
+{3487, NULL, 131.507083333333, -46.0416666666667,  3.91},
+{3488, NULL, 131.599166666667, -41.1255555555556,  6.21},
+{3489, NULL, 131.272083333333, -58.725,  6.21},
+{3490, NULL, 131.705, -34.6227777777778,  6.37},
+{3491, NULL, 130.97625, -68.2116666666667,  6.32},
+{3492, "13Rho Hya", 132.108333333333, 5.83777777777778,  4.36},
+{3493, NULL, 132.020416666667, -6.55861111111111,  6.09},
+{3494, NULL, 131.6275, -45.9127777777778,  5.46},
+{3495, NULL, 131.125, -65.8255555555556,  6.05},
+{3496, NULL, 131.82875, -46.1555555555556,  5.75},
+{3497, NULL, 131.91875, -41.7372222222222,  6.36},
+{3498, NULL, 131.677083333333, -56.7697222222222,  4.49},
+{3499, NULL, 132.634166666667, 33.2852777777778,  6.25},
+{3500, "14    Hya", 132.340416666667, -3.44305555555556,  5.31},
+{3501, NULL, 132.036666666667, -42.4638888888889,  6.43},
+{3502, "Eta Cha", 130.33125, -78.9633333333333,  5.47},
+{3503, NULL, 132.000833333333, -52.8505555555556,  6.30},
+{3504, NULL, 132.687916666667, 18.8322222222222,  6.16},
+{3505, "5    UMa", 133.344166666667, 61.9622222222222,  5.73},
+{3506, NULL, 133.274583333333, 59.0561111111111,  6.25},
+{3507, NULL, 132.437083333333, -21.0486111111111,  6.47},
+{3508, "35    Lyn", 132.986666666667, 43.7266666666667,  5.15},
+{3509, NULL, 133.048333333333, 45.3125,  5.99},
+{3510, "54    Cnc", 132.75625, 15.3505555555556,  6.38},
+{3511, NULL, 133.041666666667, 42.0025,  5.99},
+{3512, NULL, 132.464583333333, -32.7805555555556,  5.21},
+{3513, NULL, 132.509166666667, -29.4630555555556,  5.87},
+{3514, NULL, 132.413333333333, -40.3205555555556,  5.48},
+{3516, NULL, 132.59, -28.6180555555556,  6.17},
+{3517, NULL, 132.468333333333, -39.1416666666667,  6.39},
+{3518, "Gam Pyx", 132.632916666667, -27.71,  4.01},
+{3519, "51Sig1Cnc", 133.144166666667, 32.4741666666667,  5.66},
+{3520, NULL, 132.44875, -45.3080555555556,  4.93},
+{3521, "53    Cnc", 133.119166666667, 28.2591666666667,  6.23},
+{3522, "55Rho1Cnc", 133.149166666667, 28.3308333333333,  5.95},
+{3523, "15    Hya", 132.89375, -7.17722222222222,  5.54},
+{3524, NULL, 130.801666666667, -79.0697222222222,  6.05},
+{3525, NULL, 132.5875, -42.09,  6.00},
+{3526, NULL, 133.100833333333, 5.34,  6.33},
+{3527, NULL, 132.639583333333, -46.5291666666667,  5.10},
+{3528, NULL, 133.482083333333, 35.5383333333333,  6.14},
+{3529, NULL, 133.127916666667, -13.2336111111111,  6.13},
+{3530, NULL, 132.86625, -42.5044444444444,  6.55},
+{3531, "6    UMa", 134.15625, 64.6038888888889,  5.58},
+{3532, "57    Cnc", 133.56125, 30.5794444444444,  5.39},
+{3533, NULL, 133.10875, -32.5091666666667,  6.50},
+{3534, NULL, 133.160833333333, -36.5455555555556,  6.42},
+{3535, NULL, 133.2, -38.7241666666667,  5.82},
+{3536, NULL, 132.9025, -57.6336111111111,  5.59},
+{3537, NULL, 132.645, -66.7930555555556,  5.35},
+{3538, NULL, 133.574583333333, -5.43444444444444,  6.00},
+{3539, NULL, 133.160833333333, -48.3591666666667,  5.91},
+{3540, "58Rho2Cnc", 133.915416666667, 27.9275,  5.22},
+{3541, NULL, 133.845416666667, 17.2313888888889,  6.64},
+{3542, NULL, 133.17, -52.1291666666667,  6.39},
+{3543, NULL, 131.48, -79.5044444444444,  5.79},
+{3544, NULL, 132.459583333333, -72.5508333333333,  6.11},
+{3545, NULL, 134.208333333333, 45.6319444444444,  5.74},
+{3546, NULL, 134.127083333333, 40.2016666666667,  5.89},
+{3547, "16Zet Hya", 133.848333333333, 5.94555555555556,  3.11},
+{3548, NULL, 133.46125, -40.4475,  6.47},
+{3549, NULL, 133.265833333333, -56.6494444444444,  6.03},
+{3550, "60    Cnc", 133.981666666667, 11.6261111111111,  5.41},
+{3551, NULL, 133.46125, -47.5208333333333,  5.33},
+{3552, "17    Hya", 133.872916666667, -7.97027777777778,  6.91},
+{3553, "17    Hya", 133.873333333333, -7.97111111111111,  6.67},
+{3554, NULL, 133.801666666667, -18.2413888888889,  5.75},
+{3555, "59Sig2Cnc", 134.235833333333, 32.9102777777778,  5.45},
+{3556, "Del Pyx", 133.88125, -27.6819444444444,  4.89},
+{3557, NULL, 134.15375, 4.23666666666667,  6.14},
+{3558, NULL, 134.284166666667, 17.1438888888889,  6.17},
+{3559, NULL, 133.982916666667, -23.8183333333333,  6.39},
+{3560, NULL, 133.452916666667, -60.3541666666667,  5.78},
+{3561, "62Omi1Cnc", 134.312083333333, 15.3227777777778,  5.20},
+{3562, NULL, 133.830416666667, -45.0416666666667,  6.26},
+{3563, "61    Cnc", 134.494583333333, 30.2336111111111,  6.29},
+{3564, NULL, 134.142083333333, -16.7094444444444,  5.96},
+{3565, "63Omi2Cnc", 134.396666666667, 15.5813888888889,  5.67},
+{3566, NULL, 134.614583333333, 35.8025,  6.51},
+{3567, NULL, 134.425, 9.38777777777778,  6.19},
+{3568, NULL, 133.725, -58.24,  6.38},
+{3569, "9Iot UMa", 134.801666666667, 48.0416666666667,  3.14},
+{3570, NULL, 133.799583333333, -54.9655555555556,  5.71},
+{3571, NULL, 133.761666666667, -60.6447222222222,  3.84},
+{3572, "65Alp Cnc", 134.621666666667, 11.8577777777778,  4.25},
+{3573, NULL, 134.534166666667, 1.54166666666667,  6.59},
+{3574, NULL, 134.080833333333, -52.7236111111111,  4.69},
+{3575, "64Sig3Cnc", 134.885833333333, 32.4186111111111,  5.20},
+{3576, "8Rho UMa", 135.63625, 67.6297222222222,  4.76},
+{3577, NULL, 134.795, 18.1347222222222,  6.38},
+{3578, NULL, 134.682916666667, -16.1327777777778,  5.86},
+{3579, NULL, 135.16, 41.7827777777778,  3.97},
+{3580, NULL, 135.128333333333, 37.6044444444444,  6.44},
+{3581, NULL, 138.838333333333, 84.1811111111111,  6.33},
+{3582, NULL, 134.243333333333, -59.2294444444444,  4.92},
+{3583, NULL, 134.4825, -48.5733333333333,  5.87},
+{3584, NULL, 134.91625, -19.2080555555556,  6.18},
+{3585, NULL, 134.815416666667, -28.8061111111111,  6.25},
+{3586, NULL, 135.419166666667, 39.7133333333333,  6.36},
+{3587, "66    Cnc", 135.350416666667, 32.2525,  5.82},
+{3588, NULL, 134.717916666667, -47.2347222222222,  5.18},
+{3589, "67    Cnc", 135.45375, 27.9027777777778,  6.07},
+{3590, NULL, 135.380833333333, 5.64083333333333,  6.07},
+{3591, NULL, 135.0225, -41.2538888888889,  4.45},
+{3592, NULL, 136.001666666667, 54.2838888888889,  5.75},
+{3593, NULL, 135.0925, -43.1733333333333,  6.07},
+{3594, "12Kap UMa", 135.90625, 47.1566666666667,  3.60},
+{3595, "69Nu  Cnc", 135.684583333333, 24.4527777777778,  5.45},
+{3596, NULL, 135.491666666667, -0.482777777777778,  5.67},
+{3597, NULL, 135.2975, -26.6638888888889,  6.20},
+{3598, NULL, 134.850416666667, -59.0836111111111,  5.16},
+{3599, NULL, 135.686666666667, 7.29805555555556,  5.85},
+{3600, NULL, 135.336666666667, -41.8644444444444,  5.55},
+{3601, "70    Cnc", 136.04125, 27.8983333333333,  6.38},
+{3602, NULL, 135.526666666667, -39.4025,  6.27},
+{3603, NULL, 136.350416666667, 48.5302777777778,  5.95},
+{3604, NULL, 135.190416666667, -60.9638888888889,  5.79},
+{3605, NULL, 135.435833333333, -52.1883333333333,  5.23},
+{3606, NULL, 136.23, 32.3769444444444,  6.46},
+{3607, NULL, 135.786666666667, -25.5044444444444,  6.74},
+{3608, NULL, 136.679583333333, 59.3444444444444,  6.45},
+{3609, "11Sig1UMa", 137.098333333333, 66.8733333333333,  5.14},
+{3610, NULL, 135.285416666667, -68.6838888888889,  5.88},
+{3611, NULL, 135.771666666667, -53.5497222222222,  6.40},
+{3612, NULL, 136.6325, 38.4522222222222,  4.56},
+{3613, "18Ome Hya", 136.493333333333, 5.09222222222222,  4.97},
+{3614, NULL, 136.03875, -47.0977777777778,  3.75},
+{3615, "Alp Vol", 135.611666666667, -66.3961111111111,  4.00},
+{3616, "13Sig2UMa", 137.596666666667, 67.1347222222222,  4.80},
+{3617, NULL, 136.862083333333, 22.9811111111111,  6.40},
+{3618, NULL, 136.749583333333, 1.46277777777778,  6.17},
+{3619, "15    UMa", 137.217916666667, 51.6047222222222,  4.48},
+{3620, NULL, 137.017083333333, 32.5405555555556,  6.50},
+{3621, "72Tau Cnc", 137.000416666667, 29.6541666666667,  5.43},
+{3622, NULL, 136.2, -57.8525,  6.44},
+{3623, "76Kap Cnc", 136.936666666667, 10.6680555555556,  5.24},
+{3624, "14Tau UMa", 137.729583333333, 63.5136111111111,  4.67},
+{3625, NULL, 137.212916666667, 33.8822222222222,  5.93},
+{3626, "75    Cnc", 137.197083333333, 26.6291666666667,  5.98},
+{3627, "77Xi  Cnc", 137.339583333333, 22.0455555555556,  5.14},
+{3628, "Kap Pyx", 137.012083333333, -25.8583333333333,  4.58},
+{3629, NULL, 136.641666666667, -55.8033333333333,  6.11},
+{3630, "19    Hya", 137.175833333333, -8.58944444444444,  5.60},
+{3631, NULL, 136.81125, -51.2119444444444,  6.73},
+{3632, NULL, 136.531666666667, -64.4997222222222,  6.37},
+{3633, NULL, 138.513333333333, 71.6558333333333,  6.55},
+{3634, "Lam Vel", 136.999166666667, -43.4325,  2.21},
+{3635, NULL, 137.443333333333, 11.5644444444444,  6.48},
+{3636, NULL, 137.297916666667, -12.3577777777778,  5.77},
+{3637, NULL, 137.18125, -26.7677777777778,  6.15},
+{3638, NULL, 137.267916666667, -18.3286111111111,  5.73},
+{3639, NULL, 137.66125, 30.9630555555556,  5.95},
+{3640, "79    Cnc", 137.587083333333, 21.9963888888889,  6.01},
+{3641, "20    Hya", 137.397916666667, -8.78777777777778,  5.46},
+{3642, NULL, 136.409583333333, -70.5388888888889,  4.71},
+{3643, NULL, 136.286666666667, -72.6027777777778,  4.48},
+{3644, "Eps Pyx", 137.485, -30.3652777777778,  5.59},
+{3645, NULL, 138.969166666667, 72.9461111111111,  5.96},
+{3646, NULL, 137.595833333333, -23.1766666666667,  6.53},
+{3647, NULL, 137.437916666667, -49.4247222222222,  6.48},
+{3648, "16    UMa", 138.585833333333, 61.4233333333333,  5.13},
+{3649, NULL, 137.981666666667, 5.46833333333333,  6.35},
+{3650, "81Pi 1Cnc", 138.073333333333, 14.9961111111111,  6.51},
+{3651, NULL, 138.05375, 3.86722222222222,  6.14},
+{3652, "36    Lyn", 138.450833333333, 43.2177777777778,  5.32},
+{3653, NULL, 137.994583333333, -19.7477777777778,  5.73},
+{3654, NULL, 137.768333333333, -44.8680555555556,  5.00},
+{3655, "21    Hya", 138.108333333333, -7.10972222222222,  6.11},
+{3656, NULL, 137.920833333333, -39.2588888888889,  6.00},
+{3657, NULL, 138.405416666667, 21.2833333333333,  6.48},
+{3658, NULL, 137.888333333333, -46.5838888888889,  5.79},
+{3659, NULL, 137.741666666667, -58.9669444444444,  3.44},
+{3660, "17    UMa", 138.957916666667, 56.7413888888889,  5.27},
+{3661, NULL, 138.1275, -43.6136111111111,  5.57},
+{3662, "18    UMa", 139.047083333333, 54.0219444444444,  4.83},
+{3663, NULL, 137.819166666667, -62.3172222222222,  3.97},
+{3664, NULL, 138.809583333333, 34.6336111111111,  5.97},
+{3665, "22The Hya", 138.59125, 2.31416666666667,  3.88},
+{3666, NULL, 139.9825, 74.0163888888889,  6.50},
+{3667, NULL, 138.357916666667, -38.6163888888889,  6.31},
+{3668, NULL, 138.3275, -42.2736111111111,  6.29},
+{3669, "82Pi 2Cnc", 138.8075, 14.9413888888889,  5.34},
+{3670, NULL, 138.39375, -47.3386111111111,  5.92},
+{3672, NULL, 138.534166666667, -44.1458333333333,  5.85},
+{3673, NULL, 138.231666666667, -59.4144444444444,  5.54},
+{3674, NULL, 138.602083333333, -43.2275,  5.25},
+{3675, NULL, 138.85375, -15.0247222222222,  6.35},
+{3676, NULL, 139.38, 46.8172222222222,  5.97},
+{3677, NULL, 138.738333333333, -37.6025,  5.86},
+{3678, "Zet Oct", 134.17125, -85.6630555555556,  5.42},
+{3679, NULL, 138.575, -55.5697222222222,  5.27},
+{3680, NULL, 138.810833333333, -45.5555555555556,  6.25},
+{3681, "23    Hya", 139.17375, -6.35305555555555,  5.24},
+{3682, NULL, 138.902916666667, -38.57,  4.94},
+{3683, "24    Hya", 139.172083333333, -8.74472222222222,  5.47},
+{3684, NULL, 138.937916666667, -37.4133333333333,  4.62},
+{3685, "Bet Car", 138.3, -69.7172222222222,  1.68},
+{3686, NULL, 139.608333333333, 35.3641666666667,  5.75},
+{3687, NULL, 139.28125, -14.5736111111111,  5.84},
+{3688, NULL, 139.0175, -44.8986111111111,  6.04},
+{3689, NULL, 139.464166666667, 11.5011111111111,  6.41},
+{3690, "38    Lyn", 139.71125, 36.8025,  3.82},
+{3691, NULL, 138.822916666667, -58.3886111111111,  6.02},
+{3692, NULL, 139.09625, -44.2658333333333,  5.12},
+{3693, NULL, 138.895833333333, -57.5780555555556,  6.32},
+{3694, NULL, 139.238333333333, -39.4013888888889,  5.33},
+{3695, NULL, 138.05125, -76.6630555555556,  6.14},
+{3696, NULL, 139.050833333333, -57.5413888888889,  4.34},
+{3697, NULL, 140.1825, 51.2661111111111,  6.13},
+{3698, NULL, 140.430416666667, 56.6991666666667,  5.47},
+{3699, "Iot Car", 139.2725, -59.2752777777778,  2.25},
+{3700, NULL, 139.42625, -54.4952777777778,  6.33},
+{3701, NULL, 140.247083333333, 38.1883333333333,  6.12},
+{3702, NULL, 139.890416666667, -11.3141666666667,  6.62},
+{3703, NULL, 139.524166666667, -51.0511111111111,  5.26},
+{3704, NULL, 139.888333333333, -15.8344444444444,  5.78},
+{3705, "40Alp Lyn", 140.26375, 34.3925,  3.13},
+{3706, "26    Hya", 139.943333333333, -11.975,  4.79},
+{3707, NULL, 140.363333333333, 32.9019444444444,  6.16},
+{3708, NULL, 139.675833333333, -51.5605555555556,  5.87},
+{3709, "27    Hya", 140.120833333333, -9.55583333333333,  4.80},
+{3710, NULL, 139.949583333333, -34.1033333333333,  6.39},
+{3711, NULL, 140.314166666667, 15.3711111111111,  6.53},
+{3712, NULL, 139.321666666667, -68.6894444444444,  5.39},
+{3713, NULL, 139.465416666667, -67.0508333333333,  6.11},
+{3714, NULL, 140.23125, -15.6177777777778,  6.33},
+{3715, NULL, 140.184166666667, -31.7605555555556,  6.82},
+{3716, NULL, 140.123333333333, -37.5813888888889,  6.05},
+{3717, NULL, 139.885833333333, -55.1866666666667,  6.28},
+{3718, "The Pyx", 140.373333333333, -25.9655555555556,  4.72},
+{3719, NULL, 141.965, 75.0983333333333,  6.29},
+{3720, NULL, 139.355833333333, -74.8944444444444,  5.29},
+{3721, NULL, 139.364166666667, -74.7347222222222,  5.86},
+{3722, NULL, 141.434166666667, 63.9408333333333,  6.28},
+{3723, NULL, 140.8825, 25.1830555555556,  6.41},
+{3724, NULL, 140.712083333333, -9.83888888888889,  6.53},
+{3725, NULL, 141.232083333333, 51.5738888888889,  6.31},
+{3726, NULL, 140.462083333333, -42.195,  5.58},
+{3727, NULL, 141.09375, 36.5869444444444,  6.67},
+{3728, NULL, 140.236666666667, -62.4047222222222,  4.81},
+{3729, NULL, 140.652916666667, -39.7747222222222,  6.54},
+{3730, NULL, 140.6, -46.0475,  5.75},
+{3731, "1Kap Leo", 141.16375, 26.1822222222222,  4.46},
+{3732, NULL, 140.458333333333, -55.515,  5.63},
+{3733, "Lam Pyx", 140.80125, -28.8338888888889,  4.69},
+{3734, "Kap Vel", 140.528333333333, -55.0108333333333,  2.50},
+{3735, NULL, 140.936666666667, -37.7572222222222,  6.48},
+{3736, NULL, 141.385416666667, 16.5855555555556,  6.29},
+{3737, NULL, 141.067916666667, -39.4258333333333,  6.06},
+{3738, "28    Hya", 141.35, -5.1175,  5.59},
+{3739, NULL, 140.997916666667, -51.7372222222222,  6.08},
+{3740, NULL, 140.864166666667, -60.3025,  6.30},
+{3741, NULL, 141.592916666667, -1.46388888888889,  6.01},
+{3742, NULL, 141.02375, -61.6488888888889,  5.99},
+{3743, NULL, 142.166666666667, 45.6013888888889,  5.41},
+{3744, "29    Hya", 141.810833333333, -9.22361111111111,  6.54},
+{3745, NULL, 141.686666666667, -28.7875,  6.10},
+{3746, NULL, 141.61875, -40.5019444444444,  6.20},
+{3747, NULL, 142.448333333333, 55.7455555555556,  6.45},
+{3748, "30Alp Hya", 141.896666666667, -8.65861111111111,  1.98},
+{3749, NULL, 141.826666666667, -22.3438888888889,  4.69},
+{3750, NULL, 141.945, -6.07111111111111,  5.38},
+{3751, NULL, 144.271666666667, 81.3263888888889,  4.29},
+{3752, NULL, 141.362916666667, -61.9502777777778,  5.77},
+{3753, NULL, 141.575416666667, -53.3791666666667,  5.11},
+{3754, "2Ome Leo", 142.114583333333, 9.05666666666667,  5.41},
+{3755, "3    Leo", 142.121666666667, 8.18833333333333,  5.71},
+{3756, NULL, 141.91, -35.0077777777778,  6.65},
+{3757, "23    UMa", 142.882083333333, 63.0619444444444,  3.67},
+{3758, NULL, 142.259166666667, -1.25694444444444,  6.27},
+{3759, "31Tau1Hya", 142.287083333333, -2.76888888888889,  4.60},
+{3760, NULL, 142.352083333333, -2.20527777777778,  6.14},
+{3761, NULL, 141.684166666667, -64.9297222222222,  6.05},
+{3762, NULL, 142.385, -4.24722222222222,  6.26},
+{3763, NULL, 142.3025, -20.7486111111111,  5.66},
+{3764, "7    LMi", 142.68, 33.6555555555556,  5.85},
+{3765, "Eps Ant", 142.31125, -35.9513888888889,  4.51},
+{3766, NULL, 142.317916666667, -38.4038888888889,  6.19},
+{3767, NULL, 142.457916666667, -23.3452777777778,  6.24},
+{3768, "22    UMa", 143.723333333333, 72.2055555555556,  5.72},
+{3769, "8    LMi", 142.885, 35.1030555555556,  5.37},
+{3770, NULL, 142.477083333333, -26.5897222222222,  5.48},
+{3771, "24    UMa", 143.620416666667, 69.8302777777778,  4.56},
+{3772, NULL, 142.594166666667, -15.5772222222222,  5.85},
+{3773, "4Lam Leo", 142.93, 22.9680555555556,  4.31},
+{3774, NULL, 144.028333333333, 74.3177777777778,  6.46},
+{3775, "25The UMa", 143.214166666667, 51.6772222222222,  3.17},
+{3776, NULL, 142.195833333333, -62.2730555555556,  5.92},
+{3777, NULL, 141.776666666667, -71.6022222222222,  5.47},
+{3778, NULL, 143.28, 49.4386111111111,  6.76},
+{3779, "6    Leo", 142.99, 9.71583333333333,  5.07},
+{3780, "Zet1Ant", 142.689166666667, -31.8913888888889,  7.00},
+{3781, "Zet1Ant", 142.692083333333, -31.8894444444444,  6.18},
+{3782, "5Xi  Leo", 142.98625, 11.2997222222222,  4.97},
+{3783, NULL, 142.1275, -66.7019444444445,  5.91},
+{3784, NULL, 142.521666666667, -51.5172222222222,  5.45},
+{3785, NULL, 142.912083333333, -10.5522222222222,  6.14},
+{3786, "Psi Vel", 142.675, -40.4666666666667,  3.60},
+{3787, "32Tau2Hya", 142.995416666667, -1.185,  4.57},
+{3788, NULL, 142.9825, -10.3705555555556,  6.13},
+{3789, "Zet2Ant", 142.884166666667, -31.8719444444444,  5.93},
+{3790, NULL, 142.887083333333, -35.715,  5.87},
+{3791, "9    LMi", 143.37625, 36.4869444444444,  6.18},
+{3792, NULL, 143.32625, 28.3680555555556,  6.53},
+{3793, NULL, 142.5975, -58.3616666666667,  5.88},
+{3794, NULL, 143.1725, 1.86416666666667,  6.11},
+{3795, "Iot Cha", 141.037916666667, -80.7869444444444,  5.36},
+{3796, NULL, 143.085, -19.4002777777778,  5.74},
+{3797, NULL, 143.581666666667, 46.9022222222222,  6.52},
+{3798, NULL, 143.077083333333, -28.6280555555556,  6.46},
+{3799, "26    UMa", 143.70625, 52.0513888888889,  4.50},
+{3800, "10    LMi", 143.555833333333, 36.3975,  4.55},
+{3801, NULL, 143.25875, -8.50527777777778,  6.12},
+{3802, NULL, 143.2325, -13.5169444444444,  5.94},
+{3803, NULL, 142.805416666667, -57.0344444444444,  3.13},
+{3804, NULL, 143.49625, 23.4538888888889,  6.25},
+{3805, NULL, 143.33375, -7.19,  6.24},
+{3806, NULL, 144.484166666667, 73.0805555555555,  6.42},
+{3807, NULL, 143.080416666667, -40.6494444444444,  5.35},
+{3808, NULL, 143.302083333333, -21.1158333333333,  5.01},
+{3809, NULL, 143.765833333333, 39.6213888888889,  4.81},
+{3810, NULL, 143.359166666667, -22.8638888888889,  5.91},
+{3811, NULL, 143.843333333333, 39.9633333333333,  6.76},
+{3812, NULL, 143.2825, -39.1288888888889,  6.43},
+{3813, NULL, 142.887083333333, -66.7194444444444,  6.27},
+{3814, "33    Hya", 143.63625, -5.915,  5.56},
+{3815, "11    LMi", 143.915, 35.8102777777778,  5.41},
+{3816, NULL, 143.060833333333, -62.7888888888889,  6.10},
+{3817, NULL, 143.435416666667, -49.005,  5.12},
+{3818, "7    Leo", 143.970416666667, 14.3797222222222,  6.36},
+{3819, NULL, 143.536666666667, -51.2552777777778,  5.01},
+{3820, NULL, 144.17875, 31.1616666666667,  5.56},
+{3821, NULL, 142.90125, -73.0808333333333,  5.47},
+{3822, NULL, 143.890416666667, -19.5836111111111,  6.31},
+{3823, NULL, 143.799166666667, -35.8238888888889,  6.49},
+{3824, NULL, 144.86625, 67.2722222222222,  5.94},
+{3825, NULL, 143.61125, -59.2294444444444,  4.08},
+{3826, "8    Leo", 144.260833333333, 16.4377777777778,  5.69},
+{3827, "10    Leo", 144.302916666667, 6.83583333333333,  5.00},
+{3828, NULL, 144.140416666667, -24.7027777777778,  6.53},
+{3829, "42    Lyn", 144.590416666667, 40.2397222222222,  5.25},
+{3830, NULL, 144.250833333333, -25.2966666666667,  5.70},
+{3831, NULL, 144.105416666667, -48.7513888888889,  6.17},
+{3832, "34    Hya", 144.464583333333, -9.42444444444444,  6.40},
+{3833, NULL, 144.29125, -32.1786111111111,  5.63},
+{3834, NULL, 144.61375, 4.64916666666667,  4.68},
+{3835, NULL, 144.367916666667, -36.0958333333333,  5.98},
+{3836, NULL, 144.206666666667, -49.3552777777778,  4.35},
+{3837, NULL, 144.192916666667, -52.9441666666667,  6.19},
+{3838, NULL, 145.561666666667, 69.2375,  5.69},
+{3839, "27    UMa", 145.738333333333, 72.2525,  5.17},
+{3840, NULL, 144.30125, -53.6686111111111,  5.45},
+{3841, NULL, 144.02125, -64.9505555555556,  6.56},
+{3842, NULL, 144.50625, -43.1911111111111,  5.50},
+{3843, NULL, 146.378333333333, 78.1347222222222,  6.23},
+{3844, NULL, 144.669583333333, -39.6141666666667,  6.70},
+{3845, "35Iot Hya", 144.964166666667, -1.14277777777778,  3.91},
+{3846, "37    Hya", 144.9475, -10.5702777777778,  6.31},
+{3847, NULL, 146.825, 79.1366666666667,  6.17},
+{3848, NULL, 145.08375, -10.7691666666667,  6.37},
+{3849, "38Kap Hya", 145.076666666667, -14.3322222222222,  5.06},
+{3850, NULL, 145.396666666667, 31.2780555555556,  5.89},
+{3851, "43    Lyn", 145.50125, 39.7577777777778,  5.62},
+{3852, "14Omi Leo", 145.2875, 9.89222222222222,  3.52},
+{3853, "13    Leo", 145.410416666667, 25.9127777777778,  6.24},
+{3854, NULL, 145.679583333333, 48.4311111111111,  6.39},
+{3855, NULL, 145.779166666667, 54.3636111111111,  6.47},
+{3856, NULL, 144.8375, -61.3280555555556,  4.52},
+{3857, "13    LMi", 145.677916666667, 35.0933333333333,  6.14},
+{3858, NULL, 145.320833333333, -23.5916666666667,  4.77},
+{3859, NULL, 146.152916666667, 64.9838888888889,  6.17},
+{3860, "Zet Cha", 143.471666666667, -80.9413888888889,  5.11},
+{3861, "15    Leo", 145.88875, 29.9744444444444,  5.64},
+{3862, NULL, 145.56, -23.9155555555556,  4.94},
+{3863, NULL, 145.177083333333, -57.9836111111111,  5.32},
+{3864, NULL, 145.259166666667, -57.2597222222222,  5.80},
+{3865, "28    UMa", 146.480833333333, 63.6533333333333,  6.34},
+{3866, "16Psi Leo", 145.932916666667, 14.0216666666667,  5.35},
+{3867, NULL, 145.6725, -35.5016666666667,  6.41},
+{3868, NULL, 145.449166666667, -55.2141666666667,  6.00},
+{3869, NULL, 146.125, 18.8636111111111,  6.50},
+{3870, NULL, 146.632083333333, 57.1280555555556,  5.2 },
+{3871, "The Ant", 146.050416666667, -27.7694444444444,  4.79},
+{3872, NULL, 145.864583333333, -51.2283333333333,  6.15},
+{3873, "17Eps Leo", 146.462916666667, 23.7741666666667,  2.98},
+{3874, NULL, 146.065833333333, -39.5711111111111,  6.82},
+{3875, NULL, 145.925833333333, -53.8916666666667,  5.56},
+{3876, NULL, 146.541666666667, 6.70861111111111,  5.79},
+{3877, "18    Leo", 146.597083333333, 11.81,  5.63},
+{3878, NULL, 146.340833333333, -30.2027777777778,  6.45},
+{3879, NULL, 146.598333333333, 1.78555555555556,  5.65},
+{3880, "19    Leo", 146.857916666667, 11.5683333333333,  6.45},
+{3881, NULL, 147.1475, 46.0211111111111,  5.09},
+{3882, NULL, 146.889583333333, 11.4288888888889,  6.02},
+{3883, NULL, 146.41875, -57.1855555555556,  6.46},
+{3884, NULL, 146.311666666667, -62.5077777777778,  3.69},
+{3885, NULL, 147.59875, 65.5933333333333,  6.31},
+{3886, NULL, 146.626666666667, -44.755,  5.55},
+{3887, NULL, 146.480833333333, -58.7941666666667,  6.22},
+{3888, "29Ups UMa", 147.7475, 59.0386111111111,  3.80},
+{3889, "20    Leo", 147.45875, 21.1794444444444,  6.09},
+{3890, "Ups Car", 146.775416666667, -65.0719444444444,  3.01},
+{3891, "Ups Car", 146.777916666667, -65.0725,  6.26},
+{3892, NULL, 147.367083333333, -37.1863888888889,  5.97},
+{3893, "4    Sex", 147.625416666667, 4.34361111111111,  6.24},
+{3894, "30Phi UMa", 148.026666666667, 54.0644444444444,  4.59},
+{3895, NULL, 147.166666666667, -56.4119444444444,  6.06},
+{3896, "23    Leo", 147.758333333333, 13.0661111111111,  6.46},
+{3897, NULL, 147.46375, -36.2686111111111,  6.37},
+{3898, NULL, 147.487916666667, -45.7327777777778,  5.08},
+{3899, "6    Sex", 147.808333333333, -4.24333333333333,  6.01},
+{3900, "22    Leo", 147.970833333333, 24.3952777777778,  5.32},
+{3901, NULL, 147.84, -6.18166666666667,  6.42},
+{3902, "Nu  Cha", 146.585833333333, -76.7761111111111,  5.45},
+{3903, "39Ups1Hya", 147.869583333333, -14.8466666666667,  4.12},
+{3904, NULL, 147.675, -46.9344444444444,  5.73},
+{3905, "24Mu  Leo", 148.190833333333, 26.0069444444444,  3.88},
+{3906, "7    Sex", 148.050833333333, 2.45416666666667,  6.02},
+{3907, NULL, 148.05, 0.0755555555555556,  6.35},
+{3908, NULL, 147.998333333333, -16.5347222222222,  6.08},
+{3909, "8Gam Sex", 148.126666666667, -8.105,  5.05},
+{3910, NULL, 147.8325, -46.1938888888889,  5.62},
+{3911, NULL, 148.764166666667, 61.1161111111111,  6.27},
+{3912, NULL, 147.92, -46.5477777777778,  4.58},
+{3913, NULL, 147.800416666667, -59.4258333333333,  5.79},
+{3914, NULL, 147.732083333333, -62.7452777777778,  5.57},
+{3915, NULL, 148.42875, 5.95833333333333,  5.95},
+{3916, NULL, 148.241666666667, -27.3322222222222,  6.30},
+{3917, "31    UMa", 148.929166666667, 49.82,  5.27},
+{3918, NULL, 149.595, 72.8794444444444,  5.83},
+{3919, NULL, 148.55125, -25.9325,  4.88},
+{3920, NULL, 148.25, -55.3733333333333,  6.48},
+{3921, NULL, 148.632083333333, -22.4883333333333,  6.24},
+{3922, NULL, 149.306666666667, 57.4183333333333,  5.93},
+{3923, NULL, 148.7175, -19.0094444444444,  4.94},
+{3924, NULL, 148.459166666667, -51.1469444444444,  5.93},
+{3925, NULL, 148.573333333333, -45.2838888888889,  5.71},
+{3926, NULL, 149.108333333333, 8.93305555555555,  5.85},
+{3927, NULL, 148.71375, -50.2438888888889,  5.72},
+{3928, "19    LMi", 149.42125, 41.0555555555556,  5.14},
+{3929, NULL, 149.487083333333, 45.4144444444444,  6.30},
+{3930, NULL, 149.0225, -40.8247222222222,  6.41},
+{3931, NULL, 149.19375, -26.5502777777778,  6.28},
+{3932, NULL, 149.147916666667, -33.4186111111111,  5.84},
+{3933, NULL, 149.225, -27.475,  6.32},
+{3934, NULL, 152.142916666667, 83.9183333333333,  6.37},
+{3935, NULL, 149.09125, -51.3361111111111,  6.37},
+{3936, NULL, 149.60875, 27.7588888888889,  6.30},
+{3937, "27Nu  Leo", 149.555833333333, 12.4447222222222,  5.26},
+{3938, NULL, 149.531666666667, 8.31416666666667,  6.04},
+{3939, NULL, 149.965416666667, 56.8119444444444,  5.48},
+{3940, "Phi Vel", 149.215833333333, -54.5677777777778,  3.54},
+{3941, NULL, 149.295416666667, -52.6388888888889,  6.12},
+{3942, NULL, 149.900833333333, 29.6452777777778,  5.73},
+{3943, NULL, 149.427083333333, -48.4144444444444,  6.05},
+{3944, NULL, 149.040416666667, -71.3894444444445,  6.35},
+{3945, "12    Sex", 149.929583333333, 3.38472222222222,  6.70},
+{3946, NULL, 149.775416666667, -23.9502777777778,  6.21},
+{3947, "Eta Ant", 149.717916666667, -35.8911111111111,  5.23},
+{3948, NULL, 149.313333333333, -64.4894444444444,  6.58},
+{3949, NULL, 149.24875, -69.1019444444444,  6.20},
+{3950, "29Pi  Leo", 150.053333333333, 8.04416666666667,  4.70},
+{3951, "20    LMi", 150.252916666667, 31.9236111111111,  5.36},
+{3952, NULL, 150.70375, 21.9491666666667,  5.66},
+{3953, NULL, 150.143333333333, -56.9466666666667,  6.52},
+{3954, NULL, 151.15125, 53.8916666666667,  5.74},
+{3955, NULL, 150.41875, -53.3644444444444,  6.20},
+{3956, NULL, 150.705416666667, -30.5775,  6.54},
+{3957, NULL, 150.491666666667, -57.3497222222222,  6.20},
+{3958, NULL, 151.29375, 52.3708333333333,  6.14},
+{3959, NULL, 150.920833333333, -9.57388888888889,  6.12},
+{3960, NULL, 150.5, -60.4208333333333,  5.94},
+{3961, "13    Sex", 151.035, 3.20111111111111,  6.45},
+{3962, NULL, 150.9225, -25.3166666666667,  6.70},
+{3963, NULL, 151.012083333333, -18.1016666666667,  5.86},
+{3964, NULL, 150.835416666667, -46.6361111111111,  6.12},
+{3965, NULL, 151.0875, -24.2855555555556,  5.70},
+{3966, NULL, 150.749583333333, -60.1786111111111,  6.19},
+{3967, NULL, 150.705833333333, -62.1563888888889,  6.42},
+{3968, NULL, 151.0975, -39.9758333333333,  6.43},
+{3969, NULL, 151.420416666667, 15.7575,  6.37},
+{3970, "40Ups2Hya", 151.28125, -13.0647222222222,  4.60},
+{3971, NULL, 150.892916666667, -61.8838888888889,  6.14},
+{3972, NULL, 151.313333333333, -36.3838888888889,  6.27},
+{3973, "14    Sex", 151.6975, 5.61138888888889,  6.21},
+{3974, "21    LMi", 151.8575, 35.2447222222222,  4.48},
+{3975, "30Eta Leo", 151.833333333333, 16.7627777777778,  3.52},
+{3976, NULL, 151.547083333333, -47.37,  5.08},
+{3977, NULL, 151.789583333333, -17.1416666666667,  5.60},
+{3978, NULL, 151.529583333333, -52.1880555555556,  6.52},
+{3979, NULL, 152.06625, 31.6041666666667,  6.24},
+{3980, "31    Leo", 151.97625, 9.9975,  4.37},
+{3981, "15Alp Sex", 151.984583333333, -0.371666666666667,  4.49},
+{3982, "32Alp Leo", 152.092916666667, 11.9672222222222,  1.35},
+{3983, "Mu 1Cha", 150.182083333333, -82.2147222222222,  5.52},
+{3984, NULL, 152.007083333333, -37.3336111111111,  6.36},
+{3985, NULL, 152.190416666667, -10.8847222222222,  6.53},
+{3986, NULL, 152.147916666667, -15.6116666666667,  6.27},
+{3987, NULL, 152.745416666667, 40.6613888888889,  6.32},
+{3988, NULL, 152.485416666667, -12.0958333333333,  6.24},
+{3989, "17    Sex", 152.53125, -8.40833333333333,  5.91},
+{3990, NULL, 152.234583333333, -51.8111111111111,  4.86},
+{3991, NULL, 152.524583333333, -12.8161111111111,  5.31},
+{3992, NULL, 152.3825, -35.8566666666667,  6.13},
+{3993, NULL, 152.803333333333, 37.4019444444444,  5.85},
+{3994, "41Lam Hya", 152.647083333333, -12.3541666666667,  3.61},
+{3995, NULL, 152.1775, -65.8152777777778,  5.28},
+{3996, "18    Sex", 152.7325, -8.41833333333333,  5.65},
+{3997, "Mu 2Cha", 151.031666666667, -81.5658333333333,  6.60},
+{3998, "34    Leo", 152.909166666667, 13.355,  6.44},
+{3999, NULL, 152.34125, -61.5491666666667,  5.60},
+{4000, NULL, 152.824166666667, -7.31666666666667,  6.25},
+{4001, NULL, 152.657916666667, -41.715,  5.98},
+{4002, NULL, 152.377083333333, -68.6833333333333,  5.81},
+{4003, NULL, 153.012083333333, -28.6063888888889,  6.28},
+{4004, "19    Sex", 153.20125, 4.61472222222222,  5.77},
+{4005, NULL, 153.1575, -19.1536111111111,  6.44},
+{4006, NULL, 153.4575, 27.1358333333333,  6.04},
+{4007, NULL, 152.896666666667, -58.8280555555556,  6.40},
+{4008, NULL, 153.782083333333, 59.9855555555556,  6.25},
+{4009, NULL, 152.94375, -58.0605555555556,  5.72},
+{4010, NULL, 153.095833333333, -52.1633333333333,  6.16},
+{4011, NULL, 153.330833333333, -27.0288888888889,  6.25},
+{4012, NULL, 153.62375, 21.1677777777778,  6.02},
+{4013, NULL, 153.353333333333, -33.0319444444444,  6.38},
+{4014, "22    LMi", 153.77625, 31.4680555555556,  6.46},
+{4015, NULL, 153.44125, -40.3458333333333,  5.90},
+{4016, NULL, 154.504583333333, 73.0733333333333,  6.40},
+{4017, NULL, 153.345, -51.2333333333333,  5.28},
+{4018, NULL, 153.255416666667, -59.9180555555556,  6.10},
+{4019, NULL, 153.485833333333, -40.3105555555556,  6.35},
+{4020, NULL, 153.366666666667, -51.7561111111111,  5.78},
+{4021, NULL, 154.460833333333, 71.0605555555556,  6.66},
+{4022, NULL, 153.338333333333, -61.6588888888889,  6.41},
+{4023, NULL, 153.684166666667, -42.1219444444444,  3.85},
+{4024, "23    LMi", 154.06, 29.3105555555556,  5.35},
+{4025, NULL, 153.3775, -66.3730555555556,  5.16},
+{4026, "32    UMa", 154.508333333333, 65.1083333333333,  5.82},
+{4027, "24    LMi", 154.117083333333, 28.6825,  6.49},
+{4028, NULL, 154.067083333333, 17.7402777777778,  6.55},
+{4029, NULL, 153.837083333333, -36.5180555555556,  6.19},
+{4030, "35    Leo", 154.134583333333, 23.5030555555556,  5.97},
+{4031, "36Zet Leo", 154.1725, 23.4172222222222,  3.44},
+{4032, NULL, 154.174583333333, 25.3713888888889,  5.84},
+{4033, "33Lam UMa", 154.274166666667, 42.9144444444444,  3.45},
+{4034, NULL, 154.037916666667, -11.2033333333333,  6.08},
+{4035, "37    Leo", 154.169583333333, 13.7283333333333,  5.41},
+{4036, NULL, 153.88125, -43.1125,  5.60},
+{4037, "Ome Car", 153.434166666667, -70.0380555555556,  3.32},
+{4038, NULL, 153.819166666667, -54.9741666666667,  6.16},
+{4039, "39    Leo", 154.310833333333, 23.1061111111111,  5.82},
+{4040, NULL, 154.19, -20.6705555555556,  6.57},
+{4041, NULL, 154.542916666667, 27.4152777777778,  6.52},
+{4042, "22Eps Sex", 154.4075, -8.06888888888889,  5.24},
+{4043, NULL, 154.012916666667, -59.9033333333333,  6.22},
+{4044, NULL, 154.745833333333, 46.7608333333333,  6.43},
+{4045, NULL, 154.1675, -51.205,  6.30},
+{4046, NULL, 154.861666666667, 48.3969444444444,  6.00},
+{4047, NULL, 155.264166666667, 68.7475,  5.96},
+{4048, NULL, 154.752916666667, 24.7116666666667,  6.40},
+{4049, NULL, 154.531666666667, -28.9919444444444,  5.34},
+{4050, NULL, 154.270833333333, -61.3322222222222,  3.40},
+{4051, NULL, 155.061666666667, 53.7791666666667,  6.45},
+{4052, NULL, 155.13, 54.2169444444444,  6.00},
+{4053, NULL, 154.6575, -36.8047222222222,  6.30},
+{4054, "40    Leo", 154.93375, 19.4708333333333,  4.79},
+{4055, NULL, 154.82, -12.5280555555556,  6.00},
+{4056, NULL, 154.6175, -41.6683333333333,  5.96},
+{4057, "41Gam1Leo", 154.992916666667, 19.8416666666667,  2.61},
+{4058, "41Gam2Leo", 154.994166666667, 19.8405555555556,  3.80},
+{4059, NULL, 154.884166666667, -5.10583333333333,  6.37},
+{4060, NULL, 154.9975, -9.05888888888889,  6.32},
+{4061, NULL, 154.656666666667, -56.11,  5.81},
+{4062, NULL, 157.422916666667, 84.2522222222222,  5.50},
+{4063, NULL, 154.903333333333, -55.0294444444444,  4.57},
+{4064, "23    Sex", 155.258333333333, 2.28972222222222,  6.66},
+{4065, NULL, 154.77, -64.6763888888889,  5.67},
+{4066, NULL, 155.069583333333, -47.6991666666667,  5.65},
+{4067, NULL, 155.54375, 41.2294444444444,  5.76},
+{4068, NULL, 155.2825, -17.985,  6.51},
+{4069, "34Mu  UMa", 155.582083333333, 41.4994444444444,  3.05},
+{4070, "42    Leo", 155.459583333333, 14.9755555555556,  6.12},
+{4071, NULL, 155.369583333333, -23.7108333333333,  6.50},
+{4072, NULL, 156.032916666667, 65.5663888888889,  4.97},
+{4073, NULL, 155.4, -22.5283333333333,  6.51},
+{4074, NULL, 155.228333333333, -56.0430555555556,  4.50},
+{4075, "27    LMi", 155.77625, 33.9080555555556,  5.90},
+{4076, NULL, 155.55375, -19.8669444444444,  6.13},
+{4077, "43    Leo", 155.751666666667, 6.5425,  6.07},
+{4078, NULL, 155.924166666667, 29.6158333333333,  6.39},
+{4079, NULL, 155.810833333333, 5.69416666666667,  6.54},
+{4080, NULL, 155.581666666667, -41.65,  4.83},
+{4081, "28    LMi", 156.035833333333, 33.7186111111111,  5.50},
+{4082, "25    Sex", 155.860416666667, -4.07416666666667,  5.97},
+{4083, NULL, 155.804583333333, -30.1622222222222,  6.27},
+{4084, NULL, 157.769166666667, 82.5586111111111,  5.26},
+{4085, NULL, 156.054583333333, 2.36805555555556,  6.32},
+{4086, NULL, 155.872083333333, -38.01,  5.33},
+{4087, NULL, 155.918333333333, -41.9533333333333,  6.27},
+{4088, "44    Leo", 156.313333333333, 8.78472222222222,  5.61},
+{4089, NULL, 155.742083333333, -66.9016666666667,  4.99},
+{4090, "30    LMi", 156.47875, 33.7961111111111,  4.74},
+{4091, NULL, 155.962083333333, -57.9538888888889,  6.35},
+{4092, NULL, 156.434583333333, -7.05972222222222,  5.57},
+{4093, NULL, 156.321666666667, -42.4680555555556,  6.18},
+{4094, "42Mu  Hya", 156.5225, -16.8363888888889,  3.81},
+{4095, NULL, 156.2475, -58.5763888888889,  5.95},
+{4096, NULL, 156.866666666667, 41.6008333333333,  6.02},
+{4097, NULL, 156.752083333333, 19.3644444444444,  6.15},
+{4098, NULL, 157.015833333333, 48.7847222222222,  6.44},
+{4099, NULL, 156.539583333333, -42.7388888888889,  6.13},
+{4100, "31Bet LMi", 156.970833333333, 36.7072222222222,  4.21},
+{4101, "45    Leo", 156.9125, 9.7625,  6.04},
+{4102, NULL, 156.09875, -74.0316666666667,  4.00},
+{4103, NULL, 157.152083333333, 45.2122222222222,  6.35},
+{4104, "Alp Ant", 156.787916666667, -31.0677777777778,  4.25},
+{4105, NULL, 156.184583333333, -73.9716666666667,  6.19},
+{4106, "35    UMa", 157.47625, 65.6261111111111,  6.32},
+{4107, NULL, 156.704166666667, -54.8775,  5.58},
+{4108, NULL, 157.610833333333, 64.2575,  6.12},
+{4109, NULL, 157.183333333333, -3.7425,  6.05},
+{4110, NULL, 156.851666666667, -57.6388888888889,  4.66},
+{4111, NULL, 157.007916666667, -49.4055555555556,  6.10},
+{4112, "36    UMa", 157.656666666667, 55.9805555555556,  4.84},
+{4113, "32    LMi", 157.526666666667, 38.9252777777778,  5.77},
+{4114, NULL, 156.969583333333, -58.7394444444444,  3.82},
+{4115, NULL, 156.855416666667, -65.7047222222222,  6.01},
+{4116, "29Del Sex", 157.369583333333, -2.73916666666667,  5.21},
+{4117, NULL, 157.370833333333, -29.6636111111111,  5.58},
+{4118, "Del Ant", 157.3975, -30.6072222222222,  5.56},
+{4119, "30Bet Sex", 157.572916666667, -0.636944444444444,  5.09},
+{4120, NULL, 157.219166666667, -64.1722222222222,  5.29},
+{4121, NULL, 159.007083333333, 80.4944444444444,  6.52},
+{4122, NULL, 157.744583333333, -7.6375,  6.20},
+{4123, NULL, 157.749166666667, -13.5883333333333,  5.58},
+{4124, "33    LMi", 157.964166666667, 32.3794444444444,  5.90},
+{4125, NULL, 157.714166666667, -26.4838888888889,  6.51},
+{4126, NULL, 158.772916666667, 75.7130555555556,  4.84},
+{4127, "46    Leo", 158.049166666667, 14.1372222222222,  5.46},
+{4128, NULL, 157.663333333333, -61.3561111111111,  6.43},
+{4129, NULL, 157.53625, -66.985,  6.19},
+{4130, NULL, 157.9525, -28.2375,  6.05},
+{4131, NULL, 158.431666666667, 53.4975,  6.45},
+{4132, NULL, 158.307916666667, 40.4255555555556,  4.75},
+{4133, "47Rho Leo", 158.202916666667, 9.30666666666667,  3.85},
+{4134, NULL, 157.840833333333, -53.7155555555556,  4.89},
+{4135, NULL, 157.989583333333, -45.0666666666667,  5.74},
+{4136, NULL, 157.985833333333, -45.0694444444444,  6.09},
+{4137, "34    LMi", 158.37875, 34.9886111111111,  5.58},
+{4138, NULL, 157.58375, -71.9930555555556,  4.74},
+{4139, NULL, 158.14, -44.6188888888889,  5.91},
+{4140, NULL, 158.005833333333, -61.6852777777778,  3.32},
+{4141, "37    UMa", 158.790416666667, 57.0827777777778,  5.16},
+{4142, NULL, 157.758333333333, -73.2216666666667,  4.93},
+{4143, NULL, 158.237083333333, -47.0033333333333,  5.02},
+{4144, NULL, 158.198333333333, -58.6669444444444,  6.00},
+{4145, "44    Hya", 158.50375, -23.7452777777778,  5.08},
+{4146, "48    Leo", 158.7, 6.95361111111111,  5.08},
+{4147, NULL, 158.355416666667, -58.1902777777778,  6.14},
+{4148, "49    Leo", 158.759166666667, 8.65027777777778,  5.67},
+{4149, NULL, 158.740416666667, -23.1761111111111,  6.10},
+{4150, "35    LMi", 159.089166666667, 36.3269444444445,  6.28},
+{4151, NULL, 158.55375, -60.9877777777778,  6.23},
+{4152, NULL, 158.912083333333, -18.5691666666667,  6.49},
+{4153, NULL, 158.80375, -39.5627777777778,  5.38},
+{4154, NULL, 158.79375, -43.6647222222222,  6.08},
+{4155, NULL, 159.0725, -10.5833333333333,  6.57},
+{4156, "Phi2Hya", 159.069583333333, -16.3444444444444,  6.03},
+{4157, NULL, 159.019166666667, -26.675,  6.29},
+{4158, NULL, 159.135, -12.2302777777778,  5.70},
+{4159, NULL, 158.897083333333, -57.5577777777778,  4.45},
+{4160, NULL, 159.298333333333, -11.7486111111111,  6.52},
+{4161, NULL, 157.9625, -81.9211111111111,  7.07},
+{4162, NULL, 159.307083333333, -27.4125,  4.89},
+{4163, NULL, 159.388333333333, -13.3844444444444,  4.82},
+{4164, NULL, 159.084583333333, -59.5647222222222,  5.08},
+{4165, NULL, 159.77375, 53.6683333333333,  5.52},
+{4166, "37    LMi", 159.68, 31.9761111111111,  4.71},
+{4167, NULL, 159.325416666667, -48.2258333333333,  3.84},
+{4168, "38    LMi", 159.781666666667, 37.91,  5.85},
+{4169, NULL, 159.361666666667, -58.7333333333333,  5.45},
+{4170, NULL, 158.853333333333, -76.3091666666667,  6.30},
+{4171, "Phi3Hya", 159.645833333333, -16.8766666666667,  4.91},
+{4172, NULL, 159.71, -12.4436111111111,  6.04},
+{4173, NULL, 159.510416666667, -57.2563888888889,  5.91},
+{4174, "Gam Cha", 158.867083333333, -78.6077777777778,  4.11},
+{4175, NULL, 159.709583333333, -42.7536111111111,  6.11},
+{4176, NULL, 160.45125, 68.4433333333333,  5.75},
+{4177, NULL, 159.687916666667, -59.1830555555556,  4.66},
+{4178, "38    UMa", 160.485833333333, 65.7163888888889,  5.12},
+{4179, NULL, 159.7475, -58.8169444444444,  5.92},
+{4180, NULL, 159.826666666667, -55.6033333333333,  4.28},
+{4181, NULL, 160.767083333333, 69.0761111111111,  5.00},
+{4182, "33    Sex", 160.350833333333, -1.74166666666667,  6.26},
+{4183, NULL, 160.215, -35.7416666666667,  6.37},
+{4184, NULL, 160.547083333333, 31.6969444444444,  6.02},
+{4185, NULL, 160.047083333333, -65.1005555555555,  5.52},
+{4186, NULL, 159.819166666667, -74.4936111111111,  6.07},
+{4187, "39    UMa", 160.930416666667, 57.1991666666667,  5.80},
+{4188, NULL, 160.323333333333, -59.6769444444444,  6.42},
+{4189, "40    LMi", 160.7575, 26.3255555555556,  5.51},
+{4190, NULL, 160.630416666667, -13.975,  6.24},
+{4191, NULL, 160.887083333333, 46.2038888888889,  5.18},
+{4192, "41    LMi", 160.854166666667, 23.1883333333333,  5.08},
+{4193, "35    Sex", 160.837083333333, 4.74777777777778,  5.79},
+{4194, NULL, 160.68, -32.7158333333333,  5.64},
+{4195, NULL, 161.266666666667, 67.4113888888889,  6.00},
+{4196, NULL, 160.558333333333, -64.4663888888889,  4.82},
+{4197, NULL, 161.060416666667, 19.7586111111111,  6.27},
+{4198, NULL, 160.669166666667, -59.2158333333333,  5.38},
+{4199, "The Car", 160.739166666667, -64.3944444444444,  2.76},
+{4200, NULL, 160.88375, -60.5666666666667,  4.57},
+{4201, "36    Sex", 161.289166666667, 2.48805555555556,  6.28},
+{4202, "41    UMa", 161.59375, 57.3658333333333,  6.34},
+{4203, "42    LMi", 161.46625, 30.6822222222222,  5.24},
+{4204, NULL, 160.963333333333, -64.2488888888889,  5.77},
+{4205, NULL, 161.02875, -63.9611111111111,  4.82},
+{4206, NULL, 160.46375, -79.7833333333333,  5.97},
+{4207, NULL, 161.52375, 6.37305555555556,  6.37},
+{4208, "51    Leo", 161.602083333333, 18.8913888888889,  5.49},
+{4209, "52    Leo", 161.605416666667, 14.1947222222222,  5.48},
+{4210, "Eta Car", 161.265, -59.6841666666667,  6.21},
+{4211, NULL, 161.080833333333, -70.86,  6.26},
+{4212, NULL, 161.13375, -70.855,  6.46},
+{4213, NULL, 161.110416666667, -72.4438888888889,  6.27},
+{4214, NULL, 161.716666666667, -17.2966666666667,  5.42},
+{4215, NULL, 162.208333333333, 65.1322222222222,  6.39},
+{4216, "Mu  Vel", 161.6925, -49.42,  2.69},
+{4217, NULL, 161.57, -60.6033333333333,  6.25},
+{4218, NULL, 161.908333333333, -15.2619444444444,  6.67},
+{4219, NULL, 161.56875, -64.515,  5.34},
+{4220, NULL, 161.62375, -64.2633333333333,  5.23},
+{4221, NULL, 161.739583333333, -56.7572222222222,  5.23},
+{4222, NULL, 161.713333333333, -64.3833333333333,  4.85},
+{4223, "43    LMi", 162.238333333333, 29.4158333333333,  6.15},
+{4224, NULL, 162.169166666667, -1.95888888888889,  5.93},
+{4225, NULL, 162.059166666667, -31.6883333333333,  5.88},
+{4226, NULL, 161.91125, -57.4677777777778,  6.36},
+{4227, "53    Leo", 162.314166666667, 10.5452777777778,  5.34},
+{4228, NULL, 162.0225, -59.9191666666667,  6.00},
+{4229, "40    Sex", 162.322083333333, -4.02416666666667,  6.61},
+{4230, "44    LMi", 162.47375, 27.9738888888889,  6.04},
+{4231, "Del1Cha", 161.315416666667, -80.4697222222222,  5.47},
+{4232, "Nu  Hya", 162.40625, -16.1936111111111,  3.11},
+{4233, NULL, 162.43125, -9.85277777777778,  5.86},
+{4234, "Del2Cha", 161.445, -80.5402777777778,  4.45},
+{4235, "43    UMa", 162.79625, 56.5822222222222,  5.67},
+{4236, "42    UMa", 162.84875, 59.32,  5.58},
+{4237, "41    Sex", 162.575416666667, -8.89777777777778,  5.79},
+{4238, NULL, 162.4875, -34.0580555555556,  5.61},
+{4239, NULL, 162.350416666667, -59.3236111111111,  5.91},
+{4240, NULL, 162.7725, -3.0925,  5.95},
+{4241, NULL, 163.128333333333, 52.5652777777778,  6.65},
+{4242, NULL, 163.132916666667, 52.5036111111111,  6.44},
+{4243, NULL, 163.377916666667, 69.8538888888889,  5.93},
+{4244, NULL, 163.057083333333, 1.02527777777778,  6.38},
+{4245, NULL, 163.150416666667, -0.201388888888889,  6.31},
+{4246, "44    UMa", 163.39375, 54.585,  5.10},
+{4247, "46    LMi", 163.327916666667, 34.215,  3.83},
+{4248, "45Ome UMa", 163.494583333333, 43.19,  4.71},
+{4249, NULL, 163.35375, -2.25527777777778,  6.12},
+{4250, NULL, 163.12875, -57.2405555555556,  5.25},
+{4251, NULL, 163.372916666667, -20.1388888888889,  5.24},
+{4252, NULL, 163.387083333333, -15.4455555555556,  6.38},
+{4253, NULL, 163.432083333333, -2.12916666666667,  5.45},
+{4254, "48    LMi", 163.675833333333, 25.4908333333333,  6.20},
+{4255, NULL, 163.574166666667, -13.7580555555556,  5.66},
+{4256, NULL, 163.7425, 34.0347222222222,  5.72},
+{4257, NULL, 163.373333333333, -58.8533333333333,  3.78},
+{4258, "46    UMa", 163.935, 33.5069444444444,  5.03},
+{4259, "54    Leo", 163.903333333333, 24.7497222222222,  4.50},
+{4260, "54    Leo", 163.905416666667, 24.7488888888889,  6.30},
+{4261, NULL, 163.798333333333, -20.665,  6.44},
+{4262, NULL, 163.425, -70.7202777777778,  5.99},
+{4263, NULL, 163.754166666667, -42.2511111111111,  6.11},
+{4264, NULL, 164.060416666667, 42.0083333333333,  6.03},
+{4265, "55    Leo", 163.926666666667, 0.736944444444444,  5.91},
+{4266, NULL, 163.623333333333, -61.8266666666667,  5.93},
+{4267, "56    Leo", 164.00625, 6.18527777777778,  5.81},
+{4268, NULL, 163.114583333333, -79.5594444444444,  6.33},
+{4269, NULL, 164.070416666667, 22.3516666666667,  6.14},
+{4270, "50    LMi", 164.143333333333, 25.5,  6.35},
+{4271, NULL, 163.821666666667, -60.5169444444444,  5.92},
+{4272, NULL, 164.986666666667, 77.77,  6.20},
+{4273, "Iot Ant", 164.179583333333, -37.1377777777778,  4.60},
+{4274, NULL, 164.282916666667, -50.765,  5.91},
+{4275, NULL, 164.824583333333, 51.8822222222222,  6.17},
+{4276, NULL, 164.451666666667, -59.7319444444444,  6.11},
+{4277, "47    UMa", 164.866666666667, 40.4302777777778,  5.05},
+{4278, NULL, 164.886666666667, 36.0930555555556,  6.00},
+{4279, NULL, 164.315416666667, -75.0997222222222,  6.13},
+{4280, NULL, 165.06125, 45.5261111111111,  5.47},
+{4281, NULL, 164.92125, 11.7058333333333,  6.55},
+{4282, NULL, 164.807916666667, -33.7372222222222,  5.71},
+{4283, NULL, 165.106666666667, 51.5019444444444,  6.43},
+{4284, NULL, 164.87875, -16.3538888888889,  5.89},
+{4285, NULL, 165.085833333333, 42.9113888888889,  6.02},
+{4286, NULL, 165.274166666667, 63.4211111111111,  6.39},
+{4287, "7Alp Crt", 164.94375, -18.2988888888889,  4.08},
+{4288, "49    UMa", 165.21, 39.2122222222222,  5.08},
+{4289, NULL, 165.048333333333, -14.0833333333333,  5.88},
+{4290, NULL, 164.808333333333, -61.3202777777778,  6.16},
+{4291, "58    Leo", 165.14, 3.6175,  4.84},
+{4292, NULL, 164.9975, -43.8072222222222,  5.81},
+{4293, NULL, 165.03875, -42.2258333333333,  4.39},
+{4294, "59    Leo", 165.186666666667, 6.10138888888889,  4.99},
+{4295, "48Bet UMa", 165.460416666667, 56.3825,  2.37},
+{4296, NULL, 165.035833333333, -51.8177777777778,  6.15},
+{4297, NULL, 165.238333333333, -15.7927777777778,  6.34},
+{4298, NULL, 165.17, -31.8394444444444,  6.07},
+{4299, "61    Leo", 165.457083333333, -2.48472222222222,  4.74},
+{4300, "60    Leo", 165.5825, 20.1797222222222,  4.42},
+{4301, "50Alp UMa", 165.932083333333, 61.7508333333333,  1.79},
+{4302, NULL, 165.601666666667, -26.8313888888889,  6.23},
+{4303, NULL, 165.810833333333, -0.7525,  6.14},
+{4304, NULL, 164.80375, -81.5561111111111,  6.71},
+{4305, NULL, 165.812083333333, -11.3036111111111,  5.50},
+{4306, "62    Leo", 165.9025, -0.000833333333333333,  5.95},
+{4307, NULL, 165.817083333333, -31.9608333333333,  6.46},
+{4308, NULL, 165.902083333333, -13.4344444444444,  6.34},
+{4309, "51    UMa", 166.13, 38.2413888888889,  6.00},
+{4310, "63Chi Leo", 166.254166666667, 7.33611111111111,  4.63},
+{4311, NULL, 166.13, -47.6791666666667,  5.67},
+{4312, "Eta Oct", 164.8075, -84.5938888888889,  6.19},
+{4313, NULL, 166.225833333333, -35.8047222222222,  5.43},
+{4314, "Chi1Hya", 166.332916666667, -27.2936111111111,  4.94},
+{4315, NULL, 166.391666666667, -11.0888888888889,  6.09},
+{4316, NULL, 166.2675, -49.3925,  6.13},
+{4317, "Chi2Hya", 166.49, -27.2877777777778,  5.71},
+{4318, NULL, 166.524166666667, -51.2125,  6.30},
+{4319, "65    Leo", 166.725833333333, 1.95555555555556,  5.52},
+{4320, NULL, 166.66125, -28.7277777777778,  6.77},
+{4321, NULL, 166.614166666667, -50.9566666666667,  6.32},
+{4322, "64    Leo", 166.915416666667, 23.3236111111111,  6.46},
+{4323, NULL, 166.622083333333, -58.6752777777778,  6.02},
+{4324, NULL, 166.785, -32.5872222222222,  6.59},
+{4325, NULL, 166.635, -62.4241666666667,  4.61},
+{4326, NULL, 166.600833333333, -64.8397222222222,  6.41},
+{4327, NULL, 166.819166666667, -42.6386111111111,  5.15},
+{4328, NULL, 166.976666666667, -30.1747222222222,  6.54},
+{4329, NULL, 166.707916666667, -70.8780555555555,  5.57},
+{4330, NULL, 167.41625, 67.2102777777778,  6.06},
+{4331, NULL, 167.065833333333, -29.9727777777778,  6.49},
+{4332, "67    Leo", 167.204583333333, 24.6583333333333,  5.68},
+{4333, NULL, 167.329583333333, 36.3094444444444,  5.74},
+{4334, NULL, 167.182916666667, -28.0805555555556,  5.44},
+{4335, "52Psi UMa", 167.415833333333, 44.4986111111111,  3.01},
+{4336, NULL, 167.410416666667, 43.2075,  5.89},
+{4337, NULL, 167.1475, -58.975,  3.91},
+{4338, NULL, 167.141666666667, -61.9472222222222,  5.13},
+{4339, NULL, 167.4725, -32.3675,  5.81},
+{4340, NULL, 168.045833333333, 68.2719444444444,  6.40},
+{4341, NULL, 167.932083333333, 14.4002777777778,  6.30},
+{4342, NULL, 167.727916666667, -58.4552777777778,  6.88},
+{4343, "11Bet Crt", 167.914583333333, -22.8258333333333,  4.48},
+{4344, NULL, 168.185416666667, 54.8941666666667,  6.63},
+{4345, NULL, 168.134166666667, 35.8136111111111,  6.41},
+{4346, NULL, 168.061666666667, -32.4338888888889,  6.38},
+{4347, "Psi Crt", 168.126666666667, -18.5,  6.13},
+{4348, NULL, 168.144166666667, -21.7491666666667,  6.40},
+{4349, NULL, 167.872916666667, -71.4363888888889,  6.35},
+{4350, NULL, 168.137916666667, -49.1011111111111,  5.36},
+{4351, NULL, 168.4175, 41.0886111111111,  6.33},
+{4352, NULL, 168.15, -60.3175,  4.60},
+{4353, NULL, 168.237083333333, -49.7363888888889,  6.11},
+{4354, NULL, 168.31125, -44.3722222222222,  5.80},
+{4355, NULL, 168.188333333333, -64.1697222222222,  5.23},
+{4356, "69    Leo", 168.44, -0.0697222222222222,  5.42},
+{4357, "68Del Leo", 168.527083333333, 20.5236111111111,  2.56},
+{4358, NULL, 168.5075, 8.06055555555556,  5.79},
+{4359, "70The Leo", 168.56, 15.4294444444444,  3.34},
+{4360, NULL, 168.41375, -53.2316666666667,  5.76},
+{4361, NULL, 168.378333333333, -59.6194444444444,  5.74},
+{4362, "72    Leo", 168.800833333333, 23.0955555555556,  4.63},
+{4363, NULL, 169.016666666667, 52.7730555555556,  6.50},
+{4364, NULL, 168.725, -43.7341666666667,  6.21},
+{4365, "73    Leo", 168.96625, 13.3075,  5.32},
+{4366, NULL, 168.990833333333, 12.8447222222222,  6.67},
+{4367, NULL, 169.174583333333, 49.4763888888889,  5.88},
+{4368, "74Phi Leo", 169.165416666667, -3.65166666666667,  4.47},
+{4369, NULL, 169.2425, -7.13472222222222,  6.14},
+{4370, NULL, 169.115416666667, -45.88,  6.31},
+{4371, "75    Leo", 169.3225, 2.01055555555556,  5.18},
+{4372, NULL, 169.299166666667, -38.0144444444444,  6.27},
+{4373, NULL, 169.413333333333, -34.7372222222222,  6.45},
+{4374, "53Xi  UMa", 169.545416666667, 31.5291666666667,  4.87},
+{4375, "53Xi  UMa", 169.545833333333, 31.5291666666667,  4.41},
+{4376, NULL, 169.429166666667, -36.5344444444444,  6.68},
+{4377, "54Nu  UMa", 169.619583333333, 33.0941666666667,  3.48},
+{4378, NULL, 169.5875, 11.9847222222222,  6.66},
+{4379, NULL, 169.329166666667, -67.8236111111111,  6.06},
+{4380, "55    UMa", 169.782916666667, 38.1855555555556,  4.78},
+{4381, "76    Leo", 169.729166666667, 1.65055555555556,  5.91},
+{4382, "12Del Crt", 169.835416666667, -14.7786111111111,  3.56},
+{4383, NULL, 170.224166666667, 67.1005555555555,  6.21},
+{4384, NULL, 169.81875, -64.5825,  5.99},
+{4385, NULL, 169.642916666667, -79.6686111111111,  6.35},
+{4386, "77Sig Leo", 170.284166666667, 6.02944444444444,  4.05},
+{4387, NULL, 169.90125, -75.1425,  6.27},
+{4388, NULL, 170.455416666667, 57.075,  6.43},
+{4389, NULL, 170.01625, -71.9944444444444,  6.41},
+{4390, "Pi  Cen", 170.251666666667, -54.4911111111111,  3.89},
+{4391, NULL, 170.71375, 64.3305555555555,  6.02},
+{4392, "56    UMa", 170.706666666667, 43.4827777777778,  4.99},
+{4393, NULL, 170.59625, -44.6458333333333,  6.12},
+{4394, NULL, 170.825, 0.131666666666667,  6.05},
+{4395, "13Lam Crt", 170.84125, -18.78,  5.09},
+{4396, NULL, 170.802916666667, -36.1647222222222,  5.00},
+{4397, NULL, 170.487916666667, -77.6083333333333,  6.43},
+{4398, NULL, 170.78375, -56.7794444444444,  5.79},
+{4399, "78Iot Leo", 170.98125, 10.5291666666667,  3.94},
+{4400, "79    Leo", 171.009583333333, 1.40777777777778,  5.39},
+{4401, NULL, 170.840833333333, -64.955,  5.11},
+{4402, "14Eps Crt", 171.1525, -10.8594444444444,  4.83},
+{4403, NULL, 171.092083333333, -42.6691666666667,  6.12},
+{4404, NULL, 171.245416666667, 11.4302777777778,  5.80},
+{4405, "15Gam Crt", 171.220416666667, -17.6838888888889,  4.08},
+{4406, NULL, 171.04625, -72.2566666666667,  5.59},
+{4407, NULL, 171.487916666667, 55.8505555555556,  5.75},
+{4408, "81    Leo", 171.401666666667, 16.4563888888889,  5.57},
+{4409, NULL, 171.3725, -36.0630555555556,  5.22},
+{4410, "80    Leo", 171.458333333333, 3.86,  6.37},
+{4411, NULL, 171.387916666667, -37.7477777777778,  5.89},
+{4412, NULL, 171.60625, 33.4505555555556,  6.32},
+{4413, NULL, 171.43, -63.9727777777778,  5.17},
+{4414, "83    Leo", 171.68875, 3.01305555555556,  6.50},
+{4415, NULL, 171.647083333333, -61.1152777777778,  5.30},
+{4416, "16Kap Crt", 171.789583333333, -12.3566666666667,  5.94},
+{4417, NULL, 171.697083333333, -53.16,  5.81},
+{4418, "84Tau Leo", 171.984166666667, 2.85611111111111,  4.95},
+{4419, NULL, 171.97375, -1.7,  6.25},
+{4420, NULL, 171.99375, -35.3286111111111,  6.45},
+{4421, NULL, 172.269166666667, 61.7783333333333,  5.83},
+{4422, "57    UMa", 172.2675, 39.3369444444444,  5.31},
+{4423, NULL, 172.14625, -42.6741666666667,  5.08},
+{4424, NULL, 172.43125, 56.7375,  6.28},
+{4425, NULL, 172.075833333333, -72.4744444444444,  6.09},
+{4426, "85    Leo", 172.424583333333, 15.4133333333333,  5.74},
+{4427, NULL, 172.55375, 54.3616666666667,  6.41},
+{4428, NULL, 172.410833333333, -24.4633333333333,  5.76},
+{4429, NULL, 172.96, 81.1272222222222,  6.15},
+{4430, NULL, 172.604166666667, 46.6575,  6.35},
+{4431, "58    UMa", 172.629583333333, 43.1733333333333,  5.94},
+{4432, "87    Leo", 172.57875, -3.00361111111111,  4.77},
+{4433, "86    Leo", 172.620833333333, 18.4097222222222,  5.52},
+{4434, "1Lam Dra", 172.850833333333, 69.3311111111111,  3.84},
+{4435, NULL, 172.720416666667, 47.9291666666667,  6.42},
+{4436, NULL, 172.7925, 48.7891666666667,  6.56},
+{4437, "88    Leo", 172.937083333333, 14.3644444444444,  6.20},
+{4438, NULL, 172.8125, -61.2783333333333,  6.38},
+{4439, NULL, 173.086666666667, 61.0825,  5.48},
+{4440, NULL, 172.948333333333, -20.7766666666667,  6.24},
+{4441, "Omi1Cen", 172.942083333333, -59.4422222222222,  5.13},
+{4442, "Omi2Cen", 172.953333333333, -59.5158333333333,  5.15},
+{4443, NULL, 173.067083333333, -29.2633333333333,  5.81},
+{4444, NULL, 173.067916666667, -29.2611111111111,  5.64},
+{4445, NULL, 173.097083333333, -26.7466666666667,  6.16},
+{4446, NULL, 173.197916666667, -7.8275,  5.95},
+{4447, NULL, 173.200416666667, -40.4363888888889,  5.64},
+{4448, NULL, 173.082916666667, -66.9622222222222,  5.90},
+{4449, NULL, 173.225416666667, -31.0872222222222,  5.04},
+{4450, "Xi  Hya", 173.250416666667, -31.8577777777778,  3.54},
+{4451, NULL, 173.310833333333, -16.2805555555556,  6.05},
+{4452, NULL, 173.484583333333, 36.8155555555556,  6.40},
+{4453, NULL, 173.405416666667, -40.5869444444444,  5.39},
+{4454, NULL, 173.541666666667, 11.0236111111111,  6.55},
+{4455, "89    Leo", 173.591666666667, 3.06,  5.77},
+{4456, "90    Leo", 173.677083333333, 16.7969444444444,  5.95},
+{4457, NULL, 173.770416666667, 54.7852777777778,  5.63},
+{4458, NULL, 173.622916666667, -32.8313888888889,  5.98},
+{4459, NULL, 173.765833333333, 20.4413888888889,  6.45},
+{4460, NULL, 173.690416666667, -54.2641666666667,  4.62},
+{4461, "2    Dra", 174.011666666667, 69.3227777777778,  5.20},
+{4462, NULL, 173.736666666667, -49.1366666666667,  5.50},
+{4463, NULL, 173.805, -47.3725,  5.71},
+{4464, NULL, 173.930833333333, 10.9111111111111,  6.56},
+{4465, NULL, 174.074583333333, 27.7811111111111,  5.80},
+{4466, NULL, 173.981666666667, -47.6416666666667,  5.25},
+{4467, "Lam Cen", 173.945, -63.0197222222222,  3.13},
+{4468, "21The Crt", 174.170416666667, -9.80222222222222,  4.70},
+{4469, NULL, 174.145833333333, -33.57,  5.74},
+{4470, NULL, 174.17, -37.2377777777778,  6.31},
+{4471, "91Ups Leo", 174.237083333333, -0.823888888888889,  4.30},
+{4472, NULL, 174.092916666667, -61.0522222222222,  5.83},
+{4473, NULL, 174.255, -32.9880555555556,  6.29},
+{4474, NULL, 174.470833333333, 50.6183333333333,  6.14},
+{4475, NULL, 174.2525, -61.2833333333333,  5.15},
+{4476, NULL, 174.39125, -47.7472222222222,  5.44},
+{4477, "59    UMa", 174.585833333333, 43.6255555555556,  5.59},
+{4478, NULL, 174.540833333333, 8.88416666666667,  6.17},
+{4479, "Pi  Cha", 174.315, -75.8966666666667,  5.65},
+{4480, "60    UMa", 174.639583333333, 46.8341666666667,  6.10},
+{4481, NULL, 174.705, 64.3469444444444,  6.46},
+{4482, NULL, 174.634166666667, 33.6255555555556,  6.27},
+{4483, "1Ome Vir", 174.615, 8.13416666666667,  5.36},
+{4484, NULL, 174.600416666667, -2.43611111111111,  6.22},
+{4485, NULL, 174.451666666667, -67.6202777777778,  5.96},
+{4486, NULL, 174.687083333333, 45.1086111111111,  6.44},
+{4487, NULL, 174.530416666667, -61.8263888888889,  5.15},
+{4488, "24Iot Crt", 174.667083333333, -13.2019444444444,  5.48},
+{4489, NULL, 174.751666666667, -24.7211111111111,  6.42},
+{4490, NULL, 174.962916666667, -14.4686111111111,  6.21},
+{4491, NULL, 174.96, -16.6202777777778,  6.19},
+{4492, NULL, 174.8725, -65.3977777777778,  5.17},
+{4493, NULL, 175.114166666667, 57.9705555555556,  6.37},
+{4494, "Omi Hya", 175.053333333333, -34.7447222222222,  4.70},
+{4495, "92    Leo", 175.19625, 21.3527777777778,  5.26},
+{4496, "61    UMa", 175.2625, 34.2016666666667,  5.33},
+{4497, NULL, 175.1775, -53.9686111111111,  5.96},
+{4498, NULL, 175.285, -29.1963888888889,  6.44},
+{4499, NULL, 175.223333333333, -62.09,  4.94},
+{4500, NULL, 175.431666666667, 55.1725,  6.27},
+{4501, "62    UMa", 175.392916666667, 31.7461111111111,  5.73},
+{4502, NULL, 175.3325, -43.0958333333333,  5.55},
+{4503, NULL, 175.433333333333, -32.4997222222222,  5.22},
+{4504, "3    Dra", 175.618333333333, 66.745,  5.30},
+{4505, NULL, 175.521666666667, 22.2108333333333,  6.59},
+{4506, NULL, 175.514583333333, -20.2938888888889,  6.22},
+{4507, NULL, 175.255, -83.1,  6.33},
+{4508, NULL, 175.863333333333, -37.1902777777778,  5.98},
+{4509, NULL, 175.730833333333, -79.3063888888889,  6.39},
+{4510, NULL, 175.979583333333, -6.67722222222222,  6.07},
+{4511, NULL, 175.88, -62.4894444444444,  5.03},
+{4512, NULL, 176.055, 25.2183333333333,  6.02},
+{4513, NULL, 175.970416666667, -62.8783333333333,  6.10},
+{4514, "27Zet Crt", 176.190833333333, -18.3508333333333,  4.73},
+{4515, "2Xi  Vir", 176.32125, 8.25833333333333,  4.85},
+{4516, NULL, 176.3025, -49.0697222222222,  6.26},
+{4517, "3Nu  Vir", 176.465, 6.52944444444444,  4.03},
+{4518, "63Chi UMa", 176.5125, 47.7794444444444,  3.71},
+{4519, NULL, 176.432916666667, -45.69,  5.29},
+{4520, "Lam Mus", 176.401666666667, -66.7286111111111,  3.64},
+{4521, NULL, 176.731666666667, 55.6283333333333,  5.27},
+{4522, NULL, 176.628333333333, -61.1783333333333,  4.11},
+{4523, NULL, 176.629583333333, -40.5005555555556,  4.91},
+{4524, NULL, 176.779166666667, -35.9069444444444,  6.17},
+{4525, NULL, 176.815416666667, -30.2869444444444,  6.48},
+{4526, NULL, 176.829583333333, -57.6963888888889,  5.41},
+{4527, "93    Leo", 176.99625, 20.2188888888889,  4.53},
+{4528, "4    Vir", 176.97875, 8.24583333333333,  5.32},
+{4529, NULL, 177.097916666667, -10.3133333333333,  6.26},
+{4530, "Mu  Mus", 177.059583333333, -66.8147222222222,  4.72},
+{4531, NULL, 177.16125, 14.2841666666667,  5.88},
+{4532, NULL, 177.187916666667, -26.7497222222222,  5.11},
+{4533, NULL, 177.255, -0.318611111111111,  6.15},
+{4534, "94Bet Leo", 177.265, 14.5719444444444,  2.14},
+{4535, NULL, 177.312083333333, 16.2427777777778,  6.04},
+{4536, NULL, 177.42375, 34.9316666666667,  5.70},
+{4537, NULL, 177.42125, -63.7883333333333,  4.32},
+{4538, NULL, 177.485833333333, -70.2258333333333,  4.97},
+{4539, NULL, 177.58125, -15.8638888888889,  6.13},
+{4540, "5Bet Vir", 177.67375, 1.76472222222222,  3.61},
+{4541, NULL, 177.613333333333, -62.6494444444444,  5.70},
+{4542, NULL, 177.654583333333, -27.2777777777778,  6.48},
+{4543, NULL, 177.730416666667, 12.2788888888889,  6.35},
+{4544, NULL, 177.759166666667, -5.33333333333333,  5.64},
+{4545, NULL, 177.789166666667, 33.375,  6.27},
+{4546, NULL, 177.78625, -45.1736111111111,  4.46},
+{4547, NULL, 177.84125, -12.1877777777778,  6.35},
+{4548, NULL, 177.923333333333, -30.835,  5.85},
+{4549, NULL, 177.963333333333, -65.2061111111111,  4.90},
+{4550, NULL, 178.245, 37.7186111111111,  6.45},
+{4551, NULL, 178.042083333333, -56.9877777777778,  5.57},
+{4552, "Bet Hya", 178.2275, -33.9080555555556,  4.28},
+{4553, NULL, 178.361666666667, -35.0666666666667,  6.17},
+{4554, "64Gam UMa", 178.4575, 53.6947222222222,  2.44},
+{4555, NULL, 178.459583333333, 0.551944444444444,  6.30},
+{4556, NULL, 178.547916666667, -57.41,  6.06},
+{4557, NULL, 178.6075, -37.7488888888889,  6.46},
+{4558, NULL, 178.677083333333, -25.7138888888889,  5.30},
+{4559, "6    Vir", 178.762916666667, 8.44388888888889,  5.58},
+{4560, "65    UMa", 178.77375, 46.4769444444444,  6.54},
+{4561, "65    UMa", 178.796666666667, 46.4697222222222,  7.03},
+{4562, NULL, 178.80875, 36.7563888888889,  6.49},
+{4563, NULL, 178.749166666667, -63.2788888888889,  5.91},
+{4564, "95    Leo", 178.91875, 15.6466666666667,  5.53},
+{4565, NULL, 178.917083333333, -28.4769444444444,  5.93},
+{4566, "66    UMa", 178.993333333333, 56.5986111111111,  5.84},
+{4567, "30Eta Crt", 179.00375, -17.1508333333333,  5.18},
+{4568, NULL, 178.977916666667, -39.6891666666667,  6.13},
+{4569, NULL, 179.221666666667, 61.5491666666667,  6.22},
+{4570, NULL, 179.182916666667, -47.0725,  6.26},
+{4571, NULL, 179.265416666667, -33.3152777777778,  6.21},
+{4572, NULL, 179.310833333333, 40.3436111111111,  6.62},
+{4573, NULL, 179.417083333333, -62.4488888888889,  5.57},
+{4574, NULL, 179.53, 32.2738888888889,  6.42},
+{4575, NULL, 179.585833333333, 61.4647222222222,  6.76},
+{4576, NULL, 179.563333333333, -56.3172222222222,  5.44},
+{4577, NULL, 179.584583333333, -40.9472222222222,  6.79},
+{4578, NULL, 179.69875, -64.3391666666667,  5.61},
+{4579, NULL, 179.726666666667, -25.9088888888889,  6.43},
+{4580, NULL, 179.764166666667, 0.530555555555556,  6.17},
+{4581, NULL, 179.823333333333, 33.1675,  5.96},
+{4582, NULL, 179.795416666667, -51.6966666666667,  6.05},
+{4583, "Eps Cha", 179.905416666667, -78.2219444444444,  4.91},
+{4584, NULL, 179.988333333333, 34.035,  6.50},
+{4585, "7    Vir", 179.987083333333, 3.65527777777778,  5.37},
+{4586, NULL, 180.0775, 80.8530555555556,  6.17},
+{4587, NULL, 180.185416666667, -10.4461111111111,  5.55},
+{4588, NULL, 180.177083333333, -21.8372222222222,  6.28},
+{4589, "8Pi  Vir", 180.218333333333, 6.61416666666667,  4.66},
+{4590, NULL, 180.213333333333, -19.6588888888889,  5.26},
+{4591, NULL, 180.2575, -1.76805555555556,  6.31},
+{4592, NULL, 180.370833333333, -57.5036111111111,  6.16},
+{4593, NULL, 180.414583333333, 36.0419444444444,  5.59},
+{4594, "67    UMa", 180.528333333333, 43.0455555555556,  5.21},
+{4595, NULL, 180.58375, -85.6316666666667,  6.05},
+{4596, NULL, 180.619166666667, -71.4888888888889,  6.42},
+{4597, NULL, 180.657083333333, -69.1922222222222,  5.89},
+{4598, NULL, 180.715, -7.68361111111111,  6.22},
+{4599, "The1Cru", 180.75625, -63.3127777777778,  4.33},
+{4600, NULL, 180.915, -42.4341666666667,  5.15},
+{4601, NULL, 180.934583333333, -74.2138888888889,  6.44},
+{4602, "2    Com", 181.069166666667, 21.4591666666667,  5.87},
+{4603, "The2Cru", 181.08, -63.1655555555556,  4.72},
+{4604, NULL, 181.16125, -68.3291666666667,  5.35},
+{4605, "Kap Cha", 181.19375, -76.5191666666667,  5.04},
+{4606, NULL, 181.117083333333, 85.5872222222222,  6.27},
+{4607, NULL, 181.237916666667, -60.9691666666667,  5.96},
+{4608, "9Omi Vir", 181.302083333333, 8.73305555555556,  4.12},
+{4609, NULL, 181.312916666667, 76.9058333333333,  5.80},
+{4610, NULL, 181.415416666667, 62.9330555555556,  6.13},
+{4611, NULL, 181.471666666667, -65.5472222222222,  6.33},
+{4612, NULL, 181.48625, -35.6938888888889,  6.23},
+{4613, NULL, 181.499166666667, -3.13166666666667,  6.37},
+{4614, NULL, 181.5825, -68.6508333333333,  6.23},
+{4615, NULL, 181.59625, -65.7091666666667,  6.06},
+{4616, "Eta Cru", 181.720416666667, -64.6136111111111,  4.15},
+{4617, NULL, 181.9575, -75.3669444444444,  5.18},
+{4618, NULL, 182.021666666667, -50.6613888888889,  4.47},
+{4619, NULL, 182.02, -50.7633333333333,  6.37},
+{4620, NULL, 182.06125, -48.6927777777778,  5.34},
+{4621, "Del Cen", 182.089583333333, -50.7225,  2.60},
+{4622, NULL, 182.1025, -60.8472222222222,  6.22},
+{4623, "1Alp Crv", 182.103333333333, -24.7288888888889,  4.02},
+{4624, NULL, 182.224166666667, -44.3261111111111,  5.75},
+{4625, NULL, 182.227083333333, -41.2313888888889,  5.48},
+{4626, "10    Vir", 182.422083333333, 1.89777777777778,  5.95},
+{4627, NULL, 182.447083333333, 74.6613888888889,  6.35},
+{4628, NULL, 182.510416666667, -34.705,  6.17},
+{4629, "11    Vir", 182.514166666667, 5.80694444444444,  5.72},
+{4630, "2Eps Crv", 182.53125, -22.6197222222222,  3.00},
+{4631, NULL, 182.640833333333, -37.8702777777778,  6.06},
+{4632, "3    Com", 182.631666666667, 16.8091666666667,  6.39},
+{4633, NULL, 182.692083333333, 27.2813888888889,  6.01},
+{4634, NULL, 182.770416666667, -61.2775,  6.08},
+{4635, "3    Crv", 182.76625, -23.6025,  5.46},
+{4636, NULL, 182.762083333333, -45.4227777777778,  6.61},
+{4637, NULL, 182.880833333333, -51.3594444444444,  6.23},
+{4638, "Rho Cen", 182.912916666667, -52.3686111111111,  3.96},
+{4639, NULL, 182.75, 81.71,  6.00},
+{4640, "4    Com", 182.963333333333, 25.8702777777778,  5.66},
+{4641, "68    UMa", 182.937083333333, 57.0544444444444,  6.43},
+{4642, NULL, 183.005, 28.5361111111111,  6.49},
+{4643, "5    Com", 183.03875, 20.5419444444444,  5.57},
+{4644, NULL, 183.091666666667, -62.9508333333333,  5.92},
+{4645, NULL, 183.195, -70.1519444444445,  6.17},
+{4646, NULL, 183.049583333333, 77.6163888888889,  5.14},
+{4647, NULL, 183.304166666667, -34.1255555555556,  6.5 },
+{4648, NULL, 183.355416666667, -38.9291666666667,  5.76},
+{4649, NULL, 183.482083333333, -78.5736111111111,  6.35},
+{4650, "12    Vir", 183.357916666667, 10.2622222222222,  5.85},
+{4651, NULL, 183.402916666667, -33.7927777777778,  6.33},
+{4652, NULL, 183.510833333333, -45.7238888888889,  5.31},
+{4653, NULL, 183.57, -64.4086111111111,  6.22},
+{4654, NULL, 183.680833333333, 53.4347222222222,  6.16},
+{4655, NULL, 183.748333333333, -20.8441666666667,  5.83},
+{4656, "Del Cru", 183.78625, -58.7488888888889,  2.80},
+{4657, NULL, 183.794166666667, -10.3125,  6.11},
+{4658, NULL, 183.877083333333, -41.9130555555556,  6.26},
+{4659, NULL, 183.785416666667, 70.2,  5.71},
+{4660, "69Del UMa", 183.856666666667, 57.0325,  3.31},
+{4661, NULL, 183.945833333333, -23.3536111111111,  6.54},
+{4662, "4Gam Crv", 183.951666666667, -17.5419444444444,  2.59},
+{4663, "6    Com", 184.000833333333, 14.8988888888889,  5.10},
+{4664, NULL, 184.097916666667, -72.6147222222222,  6.22},
+{4665, NULL, 183.9225, 72.5508333333333,  6.29},
+{4666, "2    CVn", 184.031666666667, 40.6602777777778,  5.66},
+{4667, "7    Com", 184.085416666667, 23.9452777777778,  4.95},
+{4668, NULL, 184.125416666667, 33.0613888888889,  5.00},
+{4669, NULL, 184.275, -65.6927777777778,  6.06},
+{4670, NULL, 184.26375, -16.6936111111111,  6.05},
+{4671, "Eps Mus", 184.392083333333, -67.9608333333333,  4.11},
+{4672, NULL, 184.372916666667, 53.1911111111111,  5.81},
+{4673, NULL, 184.377083333333, 28.9372222222222,  5.70},
+{4674, "Bet Cha", 184.58625, -79.3122222222222,  4.26},
+{4675, NULL, 184.447083333333, -36.0938888888889,  6.15},
+{4676, NULL, 184.434583333333, 15.1441666666667,  6.34},
+{4677, NULL, 184.537916666667, -3.95444444444444,  6.99},
+{4678, NULL, 184.54, -3.94861111111111,  6.54},
+{4679, "Zet Cru", 184.60875, -64.0030555555556,  4.04},
+{4680, NULL, 184.631666666667, 30.2491666666667,  6.23},
+{4681, "13    Vir", 184.667916666667, -0.787222222222222,  5.90},
+{4682, NULL, 184.74875, -55.1430555555556,  5.00},
+{4683, NULL, 184.214166666667, 86.4361111111111,  6.33},
+{4684, NULL, 184.75875, 26.0077777777778,  6.48},
+{4685, "8    Com", 184.829583333333, 23.0347222222222,  6.27},
+{4686, NULL, 183.834583333333, 87.7,  6.28},
+{4687, NULL, 184.707916666667, 75.1605555555556,  5.38},
+{4688, "9    Com", 184.873333333333, 28.1569444444444,  6.33},
+{4689, "15Eta Vir", 184.976666666667, -0.666944444444444,  3.89},
+{4690, "3    CVn", 184.952916666667, 48.9841666666667,  5.29},
+{4691, NULL, 185.044583333333, -22.1755555555556,  5.97},
+{4692, NULL, 185.116666666667, -65.8427777777778,  6.21},
+{4693, NULL, 185.082083333333, 26.6194444444444,  5.54},
+{4694, NULL, 185.07375, 26.0019444444444,  6.15},
+{4695, "16    Vir", 185.0875, 3.3125,  4.96},
+{4696, "5Zet Crv", 185.140416666667, -22.2158333333333,  5.21},
+{4697, "11    Com", 185.179166666667, 17.7927777777778,  4.74},
+{4698, NULL, 185.172083333333, 27.0547222222222,  7.13},
+{4699, NULL, 185.232083333333, -13.5655555555556,  5.14},
+{4700, "Eps Cru", 185.34, -60.4011111111111,  3.59},
+{4701, "70    UMa", 185.211666666667, 57.8638888888889,  5.55},
+{4702, NULL, 185.489583333333, -56.3747222222222,  5.92},
+{4703, "Zet2Mus", 185.530416666667, -67.5219444444444,  5.15},
+{4704, "Zet1Mus", 185.549583333333, -68.3075,  5.74},
+{4705, NULL, 185.545, 24.7738888888889,  6.19},
+{4706, NULL, 185.705416666667, -57.6761111111111,  5.39},
+{4707, "12    Com", 185.62625, 25.8461111111111,  4.81},
+{4708, "17    Vir", 185.633333333333, 5.30555555555556,  6.40},
+{4709, NULL, 186.40625, -86.1505555555556,  6.33},
+{4710, NULL, 185.8075, -67.6316666666667,  6.36},
+{4711, "6    Crv", 185.84, -24.8405555555556,  5.68},
+{4712, NULL, 185.8975, -35.4127777777778,  5.32},
+{4713, NULL, 185.90375, -39.3030555555556,  6.40},
+{4714, NULL, 185.937083333333, -38.9111111111111,  5.79},
+{4715, "4    CVn", 185.945833333333, 42.5427777777778,  6.06},
+{4716, "5    CVn", 186.00625, 51.5622222222222,  4.80},
+{4717, "13    Com", 186.077083333333, 26.0986111111111,  5.18},
+{4718, NULL, 186.18625, -41.3841666666667,  6.25},
+{4719, NULL, 186.11125, 25.5827777777778,  6.42},
+{4720, NULL, 186.322083333333, -65.7705555555556,  6.30},
+{4721, NULL, 186.285416666667, -42.5144444444444,  6.11},
+{4722, NULL, 186.29875, -11.6102777777778,  5.95},
+{4723, NULL, 186.326666666667, -27.7491666666667,  6.09},
+{4724, NULL, 186.340833333333, -35.1863888888889,  5.73},
+{4725, NULL, 186.312916666667, 23.9261111111111,  6.03},
+{4726, "71    UMa", 186.263333333333, 56.7775,  5.81},
+{4727, NULL, 186.276666666667, 63.8027777777778,  6.32},
+{4728, "6    CVn", 186.462083333333, 39.0186111111111,  5.02},
+{4729, NULL, 186.62875, -63.1225,  4.86},
+{4730, "Alp1Cru", 186.649583333333, -63.0991666666667,  1.33},
+{4731, "Alp2Cru", 186.652083333333, -63.0994444444444,  1.73},
+{4732, NULL, 186.631666666667, -51.4508333333333,  4.82},
+{4733, "14    Com", 186.600416666667, 27.2683333333333,  4.95},
+{4734, NULL, 186.700833333333, -48.9133333333333,  6.26},
+{4735, NULL, 186.715416666667, -32.83,  5.55},
+{4736, NULL, 186.8525, -63.7891666666667,  6.00},
+{4737, "15Gam Com", 186.734583333333, 28.2683333333333,  4.36},
+{4738, "16    Com", 186.747083333333, 26.8255555555556,  5.00},
+{4739, NULL, 186.869583333333, -58.9919444444444,  5.50},
+{4740, NULL, 186.600833333333, 71.9297222222222,  6.24},
+{4741, NULL, 186.925416666667, 8.61027777777778,  6.37},
+{4742, NULL, 186.955833333333, -16.6319444444444,  6.35},
+{4743, "Sig Cen", 187.01, -50.2305555555556,  3.91},
+{4744, NULL, 187.07875, -64.3413888888889,  6.04},
+{4745, "73    UMa", 186.89625, 55.7127777777778,  5.70},
+{4746, NULL, 186.965, -4.61527777777778,  6.22},
+{4747, NULL, 187.10625, -61.7952777777778,  6.22},
+{4748, NULL, 187.09375, -39.0413888888889,  5.44},
+{4749, NULL, 187.139166666667, -56.4077777777778,  6.15},
+{4750, NULL, 187.15875, 26.2266666666667,  6.54},
+{4751, NULL, 187.185833333333, 25.8991666666667,  6.65},
+{4752, "17    Com", 187.227916666667, 25.9127777777778,  5.29},
+{4753, "18    Com", 187.362083333333, 24.1088888888889,  5.48},
+{4754, NULL, 187.474583333333, -56.5247222222222,  5.80},
+{4755, NULL, 187.49125, -41.7361111111111,  6.02},
+{4756, "20    Com", 187.43, 20.8961111111111,  5.69},
+{4757, "7Del Crv", 187.46625, -16.5155555555556,  2.95},
+{4758, NULL, 187.52, -13.3930555555556,  6.35},
+{4759, NULL, 187.572916666667, -23.6966666666667,  5.63},
+{4760, "74    UMa", 187.48875, 58.4058333333333,  5.35},
+{4761, "7    CVn", 187.512083333333, 51.5355555555556,  6.21},
+{4762, "75    UMa", 187.517916666667, 58.7675,  6.08},
+{4763, "Gam Cru", 187.79125, -57.1133333333333,  1.63},
+{4764, "Gam Cru", 187.819583333333, -57.0811111111111,  6.42},
+{4765, "4    Dra", 187.527916666667, 69.2011111111111,  4.95},
+{4766, "21    Com", 187.7525, 24.5672222222222,  5.46},
+{4767, NULL, 187.70875, 53.0766666666667,  6.21},
+{4768, NULL, 187.917916666667, -59.4238888888889,  5.48},
+{4769, NULL, 188.041666666667, -73.0016666666667,  5.88},
+{4770, NULL, 187.839166666667, 7.60416666666667,  6.05},
+{4771, NULL, 187.9825, -63.5061111111111,  5.95},
+{4772, NULL, 187.91125, -5.0525,  6.19},
+{4773, "Gam Mus", 188.116666666667, -72.1330555555555,  3.87},
+{4774, NULL, 188.01875, -32.5336111111111,  6.46},
+{4775, "8Eta Crv", 188.0175, -16.1961111111111,  4.31},
+{4776, NULL, 188.15, -13.8591666666667,  5.74},
+{4777, "20    Vir", 188.262083333333, 10.2955555555556,  6.26},
+{4778, NULL, 188.343333333333, -19.7919444444444,  6.26},
+{4779, NULL, 188.392916666667, -12.8302777777778,  5.58},
+{4780, "22    Com", 188.3925, 24.2830555555556,  6.29},
+{4781, "21    Vir", 188.445, -9.45194444444444,  5.48},
+{4782, NULL, 188.496666666667, -49.9094444444444,  6.38},
+{4783, NULL, 188.412083333333, 33.2475,  5.42},
+{4784, NULL, 188.4475, 33.3847222222222,  6.24},
+{4785, "8Bet CVn", 188.435416666667, 41.3575,  4.26},
+{4786, "9Bet Crv", 188.596666666667, -23.3966666666667,  2.65},
+{4787, "5Kap Dra", 188.370833333333, 69.7883333333333,  3.87},
+{4788, NULL, 188.67625, -44.6733333333333,  5.77},
+{4789, "23    Com", 188.712916666667, 22.6291666666667,  4.81},
+{4790, NULL, 188.870833333333, -61.8419444444444,  6.22},
+{4791, "24    Com", 188.77625, 18.3772222222222,  6.56},
+{4792, "24    Com", 188.7825, 18.3769444444444,  5.02},
+{4793, NULL, 188.78375, 21.8813888888889,  5.85},
+{4794, NULL, 188.939583333333, -41.0219444444444,  5.13},
+{4795, "6    Dra", 188.683333333333, 70.0219444444444,  4.94},
+{4796, NULL, 189.005, -39.87,  5.80},
+{4797, NULL, 188.994166666667, -20.5272222222222,  6.20},
+{4798, "Alp Mus", 189.295833333333, -69.1355555555556,  2.69},
+{4799, "25    Vir", 189.1975, -5.83194444444444,  5.87},
+{4800, NULL, 189.097083333333, 59.4869444444444,  5.5 },
+{4801, "25    Com", 189.242916666667, 17.0894444444444,  5.68},
+{4802, "Tau Cen", 189.425833333333, -48.5411111111111,  3.86},
+{4803, NULL, 189.425833333333, -27.1388888888889,  5.45},
+{4804, NULL, 189.810416666667, -75.3694444444444,  6.49},
+{4805, NULL, 189.518333333333, 3.2825,  6.33},
+{4806, NULL, 189.71875, -67.1930555555556,  6.25},
+{4807, NULL, 189.593333333333, 1.85472222222222,  5.71},
+{4808, NULL, 189.625, 6.98833333333333,  7.08},
+{4809, NULL, 189.685833333333, -18.2502777777778,  6.00},
+{4810, NULL, 189.764583333333, -30.4222222222222,  5.89},
+{4811, "9    CVn", 189.692916666667, 40.8744444444444,  6.37},
+{4812, NULL, 189.75875, 22.6594444444444,  6.38},
+{4813, "26Chi Vir", 189.811666666667, -7.99555555555556,  4.66},
+{4814, NULL, 189.981666666667, -66.5116666666667,  6.26},
+{4815, "26    Com", 189.780416666667, 21.0625,  5.46},
+{4816, NULL, 189.820416666667, 35.9519444444445,  6.45},
+{4817, NULL, 189.96875, -39.9875,  4.64},
+{4818, NULL, 190.345833333333, -46.1455555555556,  5.84},
+{4819, "Gam Cen", 190.379166666667, -48.9597222222222,  2.17},
+{4820, NULL, 190.52125, -69.4075,  6.33},
+{4821, NULL, 190.316666666667, -13.0136111111111,  6.08},
+{4822, NULL, 190.3175, -13.015,  5.98},
+{4823, NULL, 190.485833333333, -59.6858333333333,  4.93},
+{4824, "27    Vir", 190.393333333333, 10.4263888888889,  6.19},
+{4825, "29Gam Vir", 190.415, -1.44944444444444,  3.65},
+{4826, "29Gam Vir", 190.415, -1.44944444444444,  3.68},
+{4827, NULL, 190.455, -19.7586111111111,  6.03},
+{4828, "30Rho Vir", 190.47125, 10.2355555555556,  4.88},
+{4829, "31    Vir", 190.487916666667, 6.80666666666667,  5.59},
+{4830, NULL, 190.709583333333, -63.0586111111111,  5.31},
+{4831, NULL, 190.6475, -48.8130555555556,  4.66},
+{4832, NULL, 190.706666666667, -55.9472222222222,  6.08},
+{4833, "76    UMa", 190.39125, 62.7130555555556,  6.07},
+{4834, NULL, 190.787916666667, -56.1761111111111,  6.00},
+{4835, NULL, 190.8675, -58.9030555555556,  6.40},
+{4836, NULL, 190.859583333333, -40.1777777777778,  6.44},
+{4837, NULL, 190.90875, -1.57694444444444,  5.93},
+{4838, NULL, 190.994583333333, -36.3491666666667,  6.39},
+{4839, NULL, 191.002083333333, -28.3238888888889,  5.48},
+{4840, NULL, 190.7675, 61.1555555555556,  6.38},
+{4841, NULL, 191.257083333333, -68.8311111111111,  6.16},
+{4842, "Iot Cru", 191.407916666667, -60.9811111111111,  4.69},
+{4843, NULL, 191.112916666667, 44.1030555555556,  6.33},
+{4844, "Bet Mus", 191.570416666667, -68.1080555555556,  3.05},
+{4845, "10    CVn", 191.247916666667, 39.2788888888889,  5.95},
+{4846, NULL, 191.2825, 45.4402777777778,  4.99},
+{4847, "32    Vir", 191.404583333333, 7.67333333333333,  5.22},
+{4848, NULL, 191.594583333333, -56.4888888888889,  4.65},
+{4849, "33    Vir", 191.59375, 9.54,  5.67},
+{4850, NULL, 191.691666666667, -33.3155555555556,  5.86},
+{4851, "27    Com", 191.66125, 16.5775,  5.12},
+{4852, NULL, 191.108333333333, 80.6211111111111,  6.40},
+{4853, "Bet Cru", 191.93, -59.6886111111111,  1.25},
+{4854, NULL, 191.759583333333, 5.95083333333333,  6.34},
+{4855, "34    Vir", 191.806666666667, 11.9580555555556,  6.07},
+{4856, NULL, 191.889166666667, -6.30194444444444,  6.26},
+{4857, NULL, 191.97375, -24.8516666666667,  6.44},
+{4858, "35    Vir", 191.964166666667, 3.57277777777778,  6.41},
+{4859, NULL, 191.82875, 62.7808333333333,  5.89},
+{4860, NULL, 192.11, -27.5975,  5.66},
+{4861, "28    Com", 192.059583333333, 13.5530555555556,  6.56},
+{4862, NULL, 192.437083333333, -71.9863888888889,  5.55},
+{4863, "7    Dra", 191.893333333333, 66.7902777777778,  5.43},
+{4864, NULL, 192.195833333333, 24.8402777777778,  6.31},
+{4865, "29    Com", 192.225833333333, 14.1225,  5.70},
+{4866, "11    CVn", 192.174166666667, 48.4669444444444,  6.27},
+{4867, NULL, 192.164166666667, 60.32,  5.85},
+{4868, NULL, 192.55, -60.4008333333333,  6.75},
+{4869, "30    Com", 192.3225, 27.5522222222222,  5.78},
+{4870, "Iot Oct", 193.744166666667, -85.1233333333333,  5.46},
+{4871, NULL, 192.581666666667, -48.4597222222222,  6.24},
+{4872, NULL, 192.74125, -52.7875,  5.73},
+{4873, NULL, 192.5725, 22.8633333333333,  6.43},
+{4874, NULL, 192.671666666667, -33.9994444444444,  4.91},
+{4875, NULL, 192.544583333333, 37.5169444444444,  5.89},
+{4876, NULL, 192.824166666667, -60.3297222222222,  5.72},
+{4877, NULL, 192.845416666667, -10.3383333333333,  6.41},
+{4878, "37    Vir", 192.90375, 3.05666666666667,  6.02},
+{4879, NULL, 192.986666666667, -39.6808333333333,  5.98},
+{4880, NULL, 193.022083333333, -48.0941666666667,  6.33},
+{4881, NULL, 192.99125, -26.7380555555556,  6.15},
+{4882, NULL, 193.1025, -53.8294444444444,  6.24},
+{4883, "31    Com", 192.924583333333, 27.5405555555556,  4.94},
+{4884, "32    Com", 193.05125, 17.0738888888889,  6.32},
+{4885, NULL, 193.26625, -54.9525,  5.93},
+{4886, NULL, 193.115, 16.1225,  6.30},
+{4887, NULL, 193.340833333333, -60.3286111111111,  5.76},
+{4888, NULL, 193.27875, -48.9433333333333,  4.33},
+{4889, NULL, 193.359166666667, -40.1788888888889,  4.27},
+{4890, "Kap Cru", 193.454583333333, -60.3769444444444,  5.90},
+{4891, "38    Vir", 193.296666666667, -3.55305555555556,  6.11},
+{4892, NULL, 192.2775, 83.4180555555556,  5.85},
+{4893, NULL, 192.306666666667, 83.4127777777778,  5.28},
+{4894, "35    Com", 193.324166666667, 21.245,  4.90},
+{4895, NULL, 193.591666666667, -58.4305555555556,  6.58},
+{4896, NULL, 193.40875, -4.22388888888889,  6.44},
+{4897, "Lam Cru", 193.663333333333, -59.1466666666667,  4.62},
+{4898, "Mu 1Cru", 193.648333333333, -57.1777777777778,  4.03},
+{4899, "Mu 2Cru", 193.653333333333, -57.1683333333333,  5.17},
+{4900, "41    Vir", 193.457083333333, 12.4186111111111,  6.25},
+{4901, NULL, 193.577916666667, -11.6486111111111,  6.00},
+{4902, "40Psi Vir", 193.588333333333, -9.53888888888889,  4.79},
+{4903, NULL, 193.74375, -44.1519444444444,  5.89},
+{4904, NULL, 193.554583333333, 33.5344444444444,  6.26},
+{4905, "77Eps UMa", 193.507083333333, 55.9597222222222,  1.77},
+{4906, NULL, 193.830833333333, -42.9158333333333,  5.47},
+{4907, NULL, 194.13125, -72.1852777777778,  5.93},
+{4908, NULL, 193.9875, -56.8361111111111,  5.32},
+{4909, NULL, 193.735416666667, 47.1966666666667,  5.84},
+{4910, "43Del Vir", 193.900833333333, 3.3975,  3.38},
+{4911, NULL, 193.972083333333, -15.3269444444444,  6.17},
+{4912, NULL, 194.125416666667, -26.4602777777778,  6.62},
+{4913, NULL, 194.268333333333, -51.1986111111111,  5.16},
+{4914, "12Alp1CVn", 194.001666666667, 38.3147222222222,  5.60},
+{4915, "12Alp2CVn", 194.007083333333, 38.3183333333333,  2.90},
+{4916, "8    Dra", 193.86875, 65.4386111111111,  5.24},
+{4917, NULL, 194.073333333333, 54.0994444444444,  5.82},
+{4918, NULL, 194.388333333333, -22.7538888888889,  6.31},
+{4919, NULL, 194.282083333333, 46.1769444444444,  6.12},
+{4920, "36    Com", 194.730833333333, 17.4094444444444,  4.78},
+{4921, "44    Vir", 194.914583333333, -3.81194444444444,  5.79},
+{4922, NULL, 195.135833333333, -33.5052777777778,  6.02},
+{4923, "Del Mus", 195.5675, -71.5488888888889,  3.62},
+{4924, "37    Com", 195.06875, 30.785,  4.90},
+{4925, "46    Vir", 195.149583333333, -3.36861111111111,  5.99},
+{4926, NULL, 195.161666666667, 18.3730555555556,  6.20},
+{4927, NULL, 194.697083333333, 75.4725,  6.01},
+{4928, "9    Dra", 194.979583333333, 66.5972222222222,  5.32},
+{4929, "38    Com", 195.29, 17.1230555555556,  5.96},
+{4930, NULL, 195.771666666667, -71.4761111111111,  6.03},
+{4931, "78    UMa", 195.1825, 56.3663888888889,  4.93},
+{4932, "47Eps Vir", 195.544166666667, 10.9591666666667,  2.83},
+{4933, "Xi 1Cen", 195.888333333333, -49.5272222222222,  4.85},
+{4934, NULL, 195.445, 63.6102777777778,  6.00},
+{4935, NULL, 195.942083333333, -20.5830555555556,  5.58},
+{4936, NULL, 195.668333333333, 59.7161111111111,  6.53},
+{4937, "48    Vir", 195.976666666667, -3.66333333333333,  6.59},
+{4938, NULL, 196.200416666667, -41.1966666666667,  6.26},
+{4939, NULL, 196.378333333333, -52.115,  6.43},
+{4940, NULL, 196.569583333333, -48.4636111111111,  4.71},
+{4941, NULL, 196.64625, -41.5886111111111,  5.59},
+{4942, "Xi 2Cen", 196.7275, -49.9061111111111,  4.27},
+{4943, "14    CVn", 196.435416666667, 35.7988888888889,  5.25},
+{4944, NULL, 196.850833333333, -59.8605555555556,  5.99},
+{4945, NULL, 196.467916666667, 45.2686111111111,  5.63},
+{4946, "39    Com", 196.588333333333, 21.1533333333333,  5.99},
+{4947, NULL, 196.72625, -35.8619444444444,  6.54},
+{4948, NULL, 196.5425, 29.0294444444444,  6.54},
+{4949, "40    Com", 196.594166666667, 22.6161111111111,  5.60},
+{4950, NULL, 196.207083333333, 73.0252777777778,  6.31},
+{4951, NULL, 196.909583333333, -53.4597222222222,  5.71},
+{4952, "The Mus", 197.029166666667, -65.3063888888889,  5.51},
+{4953, NULL, 196.594583333333, 62.0419444444444,  6.14},
+{4954, "41    Com", 196.794583333333, 27.6247222222222,  4.80},
+{4955, "49    Vir", 196.974166666667, -10.7402777777778,  5.19},
+{4956, NULL, 196.973333333333, 27.5558333333333,  6.19},
+{4957, NULL, 197.135416666667, -8.98444444444444,  5.55},
+{4958, "45Psi Hya", 197.26375, -23.1180555555556,  4.95},
+{4959, NULL, 197.31, -9.53833333333333,  6.32},
+{4960, NULL, 197.301666666667, 10.0222222222222,  5.78},
+{4961, "50    Vir", 197.43875, -10.3294444444444,  5.94},
+{4962, NULL, 197.449166666667, 16.8486111111111,  5.91},
+{4963, "51The Vir", 197.4875, -5.53888888888889,  4.38},
+{4964, NULL, 197.41125, 37.4230555555555,  6.02},
+{4965, NULL, 197.743333333333, -52.5669444444444,  6.06},
+{4966, NULL, 197.965, -69.9419444444444,  5.91},
+{4967, "15    CVn", 197.425, 38.5338888888889,  6.28},
+{4968, "42Alp Com", 197.497083333333, 17.5294444444444,  5.22},
+{4969, "42Alp Com", 197.497083333333, 17.5294444444444,  5.22},
+{4970, NULL, 197.786666666667, -42.2330555555556,  5.79},
+{4971, "17    CVn", 197.513333333333, 38.4988888888889,  5.91},
+{4972, NULL, 197.97125, -63.3027777777778,  6.33},
+{4973, NULL, 197.846666666667, -43.3688888888889,  5.25},
+{4974, NULL, 197.459166666667, 62.2291666666667,  6.54},
+{4975, NULL, 198.0725, -59.9208333333333,  4.60},
+{4976, NULL, 198.571666666667, -78.4472222222222,  5.85},
+{4977, NULL, 198.20375, -66.2269444444444,  5.90},
+{4978, NULL, 197.913333333333, -26.5516666666667,  6.50},
+{4979, NULL, 198.013333333333, -37.8030555555556,  4.85},
+{4980, NULL, 198.233333333333, -59.8166666666667,  6.16},
+{4981, "53    Vir", 198.014583333333, -16.1986111111111,  5.04},
+{4982, NULL, 198.212083333333, -42.6997222222222,  6.22},
+{4983, "43Bet Com", 197.968333333333, 27.8780555555556,  4.26},
+{4984, NULL, 198.035, 24.2580555555556,  6.33},
+{4985, NULL, 198.347916666667, -50.7,  5.89},
+{4986, NULL, 198.137083333333, 11.5561111111111,  5.77},
+{4987, NULL, 198.149583333333, 18.7516666666667,  6.53},
+{4988, NULL, 198.550416666667, -58.6838888888889,  5.89},
+{4989, NULL, 198.561666666667, -59.1033333333333,  4.92},
+{4990, "54    Vir", 198.361666666667, -18.8266666666667,  6.28},
+{4991, NULL, 198.489583333333, -43.1388888888889,  6.16},
+{4992, NULL, 198.301666666667, 18.7269444444444,  6.11},
+{4993, "Eta Mus", 198.812083333333, -67.8944444444444,  4.80},
+{4994, NULL, 198.857083333333, -69.6797222222222,  6.37},
+{4995, "55    Vir", 198.545416666667, -19.9308333333333,  5.33},
+{4996, NULL, 198.679583333333, -48.9566666666667,  5.89},
+{4997, NULL, 198.429166666667, 40.1527777777778,  4.92},
+{4998, NULL, 198.630416666667, 11.3316666666667,  5.67},
+{4999, NULL, 198.790416666667, -36.3711111111111,  6.19},
+{5000, NULL, 199.186666666667, -65.1383333333333,  6.07},
+{5001, "57    Vir", 198.995, -19.9430555555556,  5.22},
+{5002, NULL, 199.304166666667, -66.7836111111111,  4.87},
+{5003, NULL, 198.383333333333, 72.7988888888889,  6.59},
+{5004, "19    CVn", 198.883333333333, 40.8552777777778,  5.79},
+{5005, NULL, 199.10625, -1.39055555555556,  6.68},
+{5006, NULL, 199.22125, -31.5061111111111,  5.10},
+{5007, NULL, 199.059583333333, 19.0516666666667,  6.45},
+{5008, NULL, 199.307916666667, -43.9794444444444,  5.84},
+{5009, NULL, 198.105833333333, 80.4713888888889,  6.25},
+{5010, NULL, 199.134583333333, 19.7852777777778,  6.45},
+{5011, "59    Vir", 199.19375, 9.42416666666667,  5.22},
+{5012, NULL, 199.82875, -72.0355555555555,  6.04},
+{5013, NULL, 199.315, 13.6755555555556,  5.33},
+{5014, NULL, 199.374583333333, -0.676666666666667,  6.37},
+{5015, "60Sig Vir", 199.40125, 5.46972222222222,  4.80},
+{5016, NULL, 199.644166666667, -51.2861111111111,  6.19},
+{5017, "20    CVn", 199.385416666667, 40.5725,  4.73},
+{5018, NULL, 199.119166666667, 68.4080555555556,  6.20},
+{5019, "61    Vir", 199.60125, -18.3113888888889,  4.74},
+{5020, "46Gam Hya", 199.730416666667, -23.1716666666667,  3.00},
+{5021, NULL, 199.712916666667, 3.68777777777778,  6.62},
+{5022, NULL, 199.615833333333, 34.0980555555556,  5.82},
+{5023, "21    CVn", 199.560416666667, 49.6819444444444,  5.15},
+{5024, NULL, 200.145416666667, -59.7733333333333,  6.18},
+{5025, NULL, 199.7675, 35.1280555555556,  6.02},
+{5026, NULL, 200.1575, -52.7480555555556,  5.48},
+{5027, NULL, 200.20125, -55.8005555555556,  6.02},
+{5028, "Iot Cen", 200.149166666667, -36.7122222222222,  2.75},
+{5029, NULL, 200.240416666667, -46.8805555555556,  5.77},
+{5030, NULL, 200.719166666667, -72.1466666666667,  6.05},
+{5031, NULL, 200.173333333333, 2.94166666666667,  6.26},
+{5032, "23    CVn", 200.079166666667, 40.1505555555556,  5.60},
+{5033, NULL, 200.374583333333, -19.4888888888889,  6.21},
+{5034, NULL, 200.64875, -60.9722222222222,  6.18},
+{5035, NULL, 200.657916666667, -60.9883333333333,  4.53},
+{5036, NULL, 200.5675, -52.1830555555556,  5.83},
+{5037, NULL, 200.423333333333, 2.08722222222222,  5.69},
+{5038, NULL, 200.719583333333, -47.9430555555556,  6.16},
+{5039, NULL, 200.760833333333, -48.5627777777778,  6.38},
+{5040, "64    Vir", 200.540416666667, 5.15472222222222,  5.87},
+{5041, NULL, 201.002083333333, -64.5358333333333,  4.53},
+{5042, "Iot1Mus", 201.279583333333, -74.8877777777778,  5.05},
+{5043, NULL, 200.78625, -33.19,  6.22},
+{5044, "63    Vir", 200.754583333333, -17.7352777777778,  5.37},
+{5045, NULL, 200.515833333333, 43.9030555555556,  6.35},
+{5046, NULL, 200.967916666667, -49.8230555555556,  6.48},
+{5047, "65    Vir", 200.82875, -4.92444444444445,  5.89},
+{5048, NULL, 201.307916666667, -64.4852777777778,  5.31},
+{5049, NULL, 201.45875, -70.6275,  5.67},
+{5050, "66    Vir", 201.138333333333, -5.16388888888889,  5.75},
+{5051, "Iot2Mus", 201.82625, -74.6919444444444,  6.63},
+{5052, NULL, 200.975, 37.0338888888889,  6.07},
+{5053, NULL, 201.127083333333, 12.4319444444444,  6.44},
+{5054, "79Zet UMa", 200.98125, 54.9252777777778,  2.27},
+{5055, "79Zet UMa", 200.985, 54.9216666666667,  3.95},
+{5056, "67Alp Vir", 201.298333333333, -11.1613888888889,  0.98},
+{5057, NULL, 201.277916666667, 23.8544444444444,  5.78},
+{5058, NULL, 201.5325, -39.7552777777778,  5.09},
+{5059, NULL, 201.5475, -1.1925,  5.97},
+{5060, NULL, 201.73375, -41.4980555555556,  5.69},
+{5061, NULL, 201.77625, -49.1438888888889,  6.31},
+{5062, "80    UMa", 201.30625, 54.9880555555556,  4.01},
+{5063, NULL, 201.836666666667, -49.3808333333333,  6.28},
+{5064, "68    Vir", 201.68, -12.7077777777778,  5.25},
+{5065, NULL, 201.81125, -40.1630555555556,  6.40},
+{5066, NULL, 202.193333333333, -69.6280555555555,  6.20},
+{5067, NULL, 201.569166666667, 46.0280555555556,  5.88},
+{5068, "69    Vir", 201.863333333333, -15.9736111111111,  4.76},
+{5069, NULL, 202.281666666667, -64.6758333333333,  6.11},
+{5070, NULL, 201.499583333333, 63.2611111111111,  6.50},
+{5071, NULL, 202.355, -51.1652777777778,  5.06},
+{5072, "70    Vir", 202.1075, 13.7788888888889,  4.98},
+{5073, NULL, 201.53375, 72.3913888888889,  5.79},
+{5074, NULL, 201.769166666667, 64.7355555555555,  6.66},
+{5075, NULL, 201.794583333333, 64.7194444444444,  7.04},
+{5076, NULL, 201.997916666667, 52.7458333333333,  6.34},
+{5077, NULL, 202.109166666667, 40.7297222222222,  6.47},
+{5078, NULL, 202.312083333333, -1.36444444444444,  6.43},
+{5079, NULL, 202.04875, 50.5872222222222,  6.80},
+{5080, NULL, 202.428333333333, -23.2813888888889,  4.97},
+{5081, "71    Vir", 202.304166666667, 10.8183333333333,  5.65},
+{5082, NULL, 203.311666666667, -77.5683333333333,  6.48},
+{5083, NULL, 202.190416666667, 50.7183333333333,  6.43},
+{5084, "Kap Oct", 205.23125, -85.7861111111111,  5.58},
+{5085, NULL, 202.112916666667, 59.9458333333333,  5.40},
+{5086, NULL, 202.500416666667, 7.17888888888889,  6.17},
+{5087, NULL, 202.49, 6.01333333333333,  6.51},
+{5088, "72    Vir", 202.607083333333, -6.47027777777778,  6.09},
+{5089, NULL, 202.76125, -39.4075,  3.88},
+{5090, NULL, 202.88875, -28.1127777777778,  6.47},
+{5091, NULL, 201.73625, 78.6438888888889,  5.77},
+{5092, NULL, 203.022083333333, -38.3991666666667,  6.16},
+{5093, NULL, 203.39875, -65.6325,  6.37},
+{5094, "73    Vir", 203.011666666667, -18.7288888888889,  6.01},
+{5095, "74    Vir", 202.99125, -6.25583333333333,  4.69},
+{5096, NULL, 202.815833333333, 42.1061111111111,  6.08},
+{5097, NULL, 203.149583333333, -28.6927777777778,  5.69},
+{5098, NULL, 203.14375, -29.5652777777778,  6.45},
+{5099, "75    Vir", 203.215416666667, -15.3630555555556,  5.55},
+{5100, "76    Vir", 203.242083333333, -10.165,  5.21},
+{5101, NULL, 203.252916666667, -7.195,  6.68},
+{5102, NULL, 203.200416666667, 24.3463888888889,  6.11},
+{5103, NULL, 203.620416666667, -48.2722222222222,  6.33},
+{5104, NULL, 203.681666666667, -33.3108333333333,  6.44},
+{5105, "78    Vir", 203.532916666667, 3.65888888888889,  4.94},
+{5106, NULL, 203.66875, -13.2144444444444,  5.91},
+{5107, "79Zet Vir", 203.673333333333, -0.595833333333333,  3.37},
+{5108, NULL, 203.590833333333, 38.7891666666667,  6.37},
+{5109, "81    UMa", 203.530416666667, 55.3486111111111,  5.60},
+{5110, NULL, 203.699166666667, 37.1825,  4.98},
+{5111, "80    Vir", 203.880416666667, -5.39611111111111,  5.73},
+{5112, "24    CVn", 203.61375, 49.0161111111111,  4.70},
+{5113, NULL, 204.300833333333, -61.6919444444444,  5.63},
+{5114, NULL, 203.88875, 10.2047222222222,  6.49},
+{5115, NULL, 204.799583333333, -75.6838888888889,  6.34},
+{5116, NULL, 203.80875, 44.1969444444444,  6.84},
+{5117, NULL, 204.210416666667, -34.4677777777778,  6.50},
+{5118, NULL, 204.275, -44.1433333333333,  5.98},
+{5119, NULL, 204.690416666667, -70.445,  6.10},
+{5120, NULL, 204.201666666667, -26.495,  5.78},
+{5121, NULL, 204.34875, -46.4283333333333,  5.90},
+{5122, NULL, 204.531666666667, -58.415,  6.42},
+{5123, NULL, 204.24625, 24.6133333333333,  5.74},
+{5124, NULL, 204.704583333333, -57.6230555555556,  6.01},
+{5125, NULL, 205.0025, -70.7883333333333,  6.59},
+{5126, NULL, 204.165833333333, 49.4866666666667,  6.49},
+{5127, "25    CVn", 204.365, 36.295,  4.82},
+{5128, NULL, 204.675, -29.5608333333333,  5.83},
+{5129, NULL, 204.532916666667, 14.3016666666667,  6.52},
+{5130, NULL, 205.045416666667, -64.5769444444444,  5.79},
+{5131, NULL, 203.678333333333, 76.5466666666667,  6.57},
+{5132, "Eps Cen", 204.971666666667, -53.4663888888889,  2.30},
+{5133, NULL, 204.429166666667, 50.7147222222222,  6.48},
+{5134, NULL, 204.99875, -49.9502777777778,  6.00},
+{5135, NULL, 204.92, -39.7480555555556,  6.27},
+{5136, NULL, 204.9525, -40.0519444444444,  5.60},
+{5137, NULL, 204.759583333333, 18.2652777777778,  6.48},
+{5138, NULL, 204.894166666667, 10.7461111111111,  5.57},
+{5139, NULL, 204.295833333333, 71.2422222222222,  5.50},
+{5140, NULL, 205.504583333333, -58.7872222222222,  5.38},
+{5141, NULL, 205.43625, -54.56,  5.01},
+{5142, "82    UMa", 204.876666666667, 52.9213888888889,  5.46},
+{5143, NULL, 205.065, 31.0119444444444,  6.21},
+{5144, "1    Boo", 205.16875, 19.9555555555556,  5.75},
+{5145, NULL, 205.162916666667, 28.0652777777778,  6.23},
+{5146, NULL, 205.37875, -23.4497222222222,  6.59},
+{5147, NULL, 205.440416666667, -33.5969444444444,  6.05},
+{5148, NULL, 205.096666666667, 50.5194444444444,  6.32},
+{5149, "2    Boo", 205.259583333333, 22.4958333333333,  5.62},
+{5150, "82    Vir", 205.403333333333, -8.70305555555555,  5.01},
+{5151, NULL, 205.73375, -56.7680555555556,  6.00},
+{5152, NULL, 205.7275, -50.7905555555556,  6.41},
+{5153, NULL, 205.08875, 57.2075,  6.29},
+{5154, "83    UMa", 205.184583333333, 54.6816666666667,  4.66},
+{5155, NULL, 205.729166666667, -41.4011111111111,  5.98},
+{5156, NULL, 205.552916666667, 8.38833333333333,  6.16},
+{5157, NULL, 205.916666666667, -42.0675,  5.98},
+{5158, NULL, 206.06625, -51.0130555555556,  6.47},
+{5159, "84    Vir", 205.765416666667, 3.53805555555556,  5.36},
+{5160, NULL, 205.62, 41.6741666666667,  6.30},
+{5161, NULL, 205.680833333333, 34.9888888888889,  5.98},
+{5162, NULL, 205.374583333333, 64.8225,  5.85},
+{5163, NULL, 205.97625, -5.49888888888889,  6.51},
+{5164, NULL, 205.938333333333, 22.7002777777778,  6.13},
+{5165, "83    Vir", 206.124166666667, -16.1791666666667,  5.60},
+{5166, NULL, 206.190416666667, -25.5008333333333,  6.21},
+{5167, NULL, 206.40375, -26.1161111111111,  5.81},
+{5168, "1    Cen", 206.421666666667, -33.0438888888889,  4.23},
+{5169, NULL, 205.977916666667, 52.0644444444444,  6.02},
+{5170, "85    Vir", 206.39625, -15.7675,  6.19},
+{5171, NULL, 206.794583333333, -62.59,  6.51},
+{5172, NULL, 206.66375, -51.4327777777778,  4.65},
+{5173, "86    Vir", 206.484583333333, -12.4266666666667,  5.51},
+{5174, NULL, 206.735, -36.2519444444444,  5.15},
+{5175, NULL, 206.865, -50.2494444444444,  5.91},
+{5176, NULL, 206.91, -50.3211111111111,  5.45},
+{5177, NULL, 206.305, 55.8794444444444,  6.50},
+{5178, NULL, 206.80625, -9.70916666666667,  6.05},
+{5179, NULL, 206.55625, 41.0886111111111,  5.87},
+{5180, NULL, 206.579166666667, 38.5038888888889,  5.94},
+{5181, "87    Vir", 206.855833333333, -17.86,  5.43},
+{5182, "3    Boo", 206.680416666667, 25.7022222222222,  5.95},
+{5183, NULL, 206.737916666667, 6.35055555555556,  6.33},
+{5184, NULL, 205.66375, 78.0644444444444,  5.91},
+{5185, "4Tau Boo", 206.815416666667, 17.4566666666667,  4.50},
+{5186, NULL, 206.749166666667, 38.5427777777778,  5.50},
+{5187, "84    UMa", 206.64875, 54.4327777777778,  5.70},
+{5188, NULL, 208.91125, -82.6661111111111,  5.95},
+{5189, NULL, 207.229583333333, -35.7038888888889,  6.53},
+{5190, "Nu  Cen", 207.37625, -41.6877777777778,  3.41},
+{5191, "85Eta UMa", 206.885, 49.3133333333333,  1.86},
+{5192, "2    Cen", 207.36125, -34.4508333333333,  4.19},
+{5193, "Mu  Cen", 207.404166666667, -42.4738888888889,  3.04},
+{5194, NULL, 207.9475, -69.4013888888889,  5.75},
+{5195, NULL, 207.16125, 31.1902777777778,  5.62},
+{5196, "89    Vir", 207.467916666667, -18.1341666666667,  4.97},
+{5197, NULL, 207.527083333333, -29.0813888888889,  6.18},
+{5198, NULL, 207.580833333333, -39.9011111111111,  6.44},
+{5199, NULL, 207.238333333333, 39.5427777777778,  7.4 },
+{5200, "5Ups Boo", 207.369166666667, 15.7977777777778,  4.07},
+{5201, "6    Boo", 207.428333333333, 21.2641666666667,  4.91},
+{5202, NULL, 207.64375, -19.8972222222222,  6.53},
+{5203, NULL, 205.59625, 82.7525,  5.98},
+{5204, NULL, 207.4375, 36.6327777777778,  6.38},
+{5205, NULL, 207.602916666667, 5.49722222222222,  6.01},
+{5206, NULL, 207.946666666667, -46.8991666666667,  5.77},
+{5207, NULL, 208.02, -52.8116666666667,  5.25},
+{5208, NULL, 207.9025, -36.4333333333333,  6.35},
+{5209, NULL, 207.835, -24.3908333333333,  6.45},
+{5210, "3    Cen", 207.956666666667, -32.9944444444444,  4.56},
+{5211, "3    Cen", 207.95875, -32.9947222222222,  6.06},
+{5212, NULL, 208.00375, -31.6194444444444,  6.12},
+{5213, NULL, 207.439583333333, 61.4891666666667,  5.96},
+{5214, NULL, 207.76875, 34.7725,  6.65},
+{5215, NULL, 207.788333333333, 34.6644444444444,  5.87},
+{5216, NULL, 207.615416666667, 58.5394444444444,  6.46},
+{5217, NULL, 208.429583333333, -53.3736111111111,  5.89},
+{5218, NULL, 208.70375, -67.6525,  5.71},
+{5219, NULL, 207.947916666667, 34.4441666666667,  4.74},
+{5220, NULL, 208.076666666667, 12.1652777777778,  6.04},
+{5221, "4    Cen", 208.302083333333, -31.9277777777778,  4.73},
+{5222, NULL, 208.386666666667, -35.6641666666667,  5.54},
+{5223, NULL, 208.487083333333, -47.1280555555556,  6.10},
+{5224, NULL, 208.4675, -35.3144444444444,  6.19},
+{5225, "7    Boo", 208.30375, 17.9327777777778,  5.70},
+{5226, "10    Dra", 207.857916666667, 64.7233333333333,  4.65},
+{5227, NULL, 207.746666666667, 68.3152777777778,  6.40},
+{5228, NULL, 208.569166666667, -28.5697222222222,  6.04},
+{5229, NULL, 208.292916666667, 28.6480555555556,  5.90},
+{5230, NULL, 208.800833333333, -52.1611111111111,  5.71},
+{5231, "Zet Cen", 208.885, -47.2883333333333,  2.55},
+{5232, "90    Vir", 208.675416666667, -1.50305555555556,  5.15},
+{5233, NULL, 208.7425, -8.05888888888889,  6.19},
+{5234, NULL, 209.0825, -54.1319444444444,  6.14},
+{5235, "8Eta Boo", 208.67125, 18.3977777777778,  2.68},
+{5236, NULL, 209.1375, -54.7044444444444,  6.00},
+{5237, NULL, 208.935416666667, -31.285,  6.51},
+{5238, "86    UMa", 208.4625, 53.7286111111111,  5.70},
+{5239, NULL, 209.08125, -46.5925,  5.83},
+{5240, NULL, 210.136666666667, -78.59,  6.09},
+{5241, NULL, 209.412083333333, -63.6866666666667,  4.71},
+{5242, NULL, 209.63, -65.8005555555555,  6.20},
+{5243, NULL, 208.958333333333, 14.0563888888889,  6.16},
+{5244, "92    Vir", 209.11625, 1.05055555555556,  5.91},
+{5245, NULL, 209.04375, 32.0325,  6.32},
+{5246, NULL, 209.365416666667, -23.0227777777778,  6.14},
+{5247, "9    Boo", 209.1425, 27.4919444444444,  5.01},
+{5248, "Phi Cen", 209.567916666667, -42.1008333333333,  3.83},
+{5249, "Ups1Cen", 209.67, -44.8036111111111,  3.87},
+{5250, "47    Hya", 209.629583333333, -24.9722222222222,  5.15},
+{5251, NULL, 209.822083333333, -50.37,  5.91},
+{5252, NULL, 210.072083333333, -61.4813888888889,  6.49},
+{5253, NULL, 210.2175, -66.2686111111111,  5.97},
+{5254, NULL, 209.66625, 14.6494444444444,  6.00},
+{5255, "10    Boo", 209.662083333333, 21.6961111111111,  5.76},
+{5256, NULL, 209.38375, 61.4927777777778,  6.37},
+{5257, "48    Hya", 210.000416666667, -25.0102777777778,  5.77},
+{5258, NULL, 209.955416666667, -3.54972222222222,  6.40},
+{5259, NULL, 210.329166666667, -40.2222222222222,  6.13},
+{5260, "Ups2Cen", 210.430833333333, -45.6036111111111,  4.34},
+{5261, "The Aps", 211.3325, -76.7966666666667,  5.5 },
+{5262, NULL, 210.335, 8.89472222222222,  5.99},
+{5263, "11    Boo", 210.29375, 27.3866666666667,  6.23},
+{5264, "93Tau Vir", 210.411666666667, 1.54444444444444,  4.26},
+{5265, NULL, 210.595, -27.43,  5.48},
+{5266, NULL, 210.859166666667, -56.2136111111111,  5.92},
+{5267, "Bet Cen", 210.955833333333, -60.3730555555556,  0.61},
+{5268, NULL, 210.757083333333, -31.6838888888889,  6.18},
+{5269, NULL, 210.864583333333, -41.4233333333333,  6.11},
+{5270, NULL, 210.6325, 9.68638888888889,  6.20},
+{5271, NULL, 210.550833333333, 45.7536111111111,  6.27},
+{5272, NULL, 210.97125, -22.4216666666667,  6.30},
+{5273, NULL, 210.884583333333, 10.7866666666667,  6.30},
+{5274, NULL, 210.903333333333, 7.54638888888889,  6.26},
+{5275, NULL, 210.9825, 4.90083333333333,  6.24},
+{5276, NULL, 211.060833333333, -5.38138888888889,  6.39},
+{5277, NULL, 211.1125, -14.9716666666667,  6.28},
+{5278, NULL, 211.44375, -54.6694444444444,  6.17},
+{5279, NULL, 212.112916666667, -74.8502777777778,  6.02},
+{5280, NULL, 210.74875, 50.9719444444444,  6.15},
+{5281, NULL, 211.604583333333, -59.7155555555556,  6.42},
+{5282, NULL, 210.460833333333, 68.6786111111111,  6.34},
+{5283, NULL, 211.15625, 2.2975,  6.28},
+{5284, NULL, 211.308333333333, -16.3358333333333,  6.56},
+{5285, "Chi Cen", 211.511666666667, -41.1797222222222,  4.36},
+{5286, NULL, 211.545416666667, -43.0919444444444,  6.20},
+{5287, "49Pi  Hya", 211.592916666667, -26.6825,  3.27},
+{5288, "5The Cen", 211.670833333333, -36.37,  2.06},
+{5289, NULL, 212.059583333333, -63.2080555555556,  6.40},
+{5290, "95    Vir", 211.678333333333, -9.31333333333333,  5.46},
+{5291, "11Alp Dra", 211.097083333333, 64.3758333333333,  3.65},
+{5292, NULL, 212.234583333333, -59.2766666666667,  6.34},
+{5293, NULL, 212.62875, -70.3055555555556,  6.05},
+{5294, NULL, 212.21625, -43.4711111111111,  6.17},
+{5295, NULL, 212.757916666667, -69.7197222222222,  6.06},
+{5296, NULL, 212.395833333333, -51.5047222222222,  6.00},
+{5297, NULL, 212.478333333333, -53.4391666666667,  4.75},
+{5298, "96    Vir", 212.2525, -10.3344444444444,  6.47},
+{5299, NULL, 211.9825, 43.8544444444444,  5.27},
+{5300, "13    Boo", 212.072083333333, 49.4580555555556,  5.25},
+{5301, NULL, 212.710416666667, -16.3019444444444,  4.91},
+{5302, NULL, 212.191666666667, 59.3377777777778,  6.46},
+{5303, "Eta Aps", 214.5575, -81.0077777777778,  4.91},
+{5304, "12    Boo", 212.599583333333, 25.0916666666667,  4.83},
+{5305, "3    UMi", 211.735, 74.5936111111111,  6.45},
+{5306, NULL, 214.22875, -77.6638888888889,  6.47},
+{5307, NULL, 212.88, 1.36222222222222,  6.43},
+{5308, NULL, 213.318333333333, -53.6658333333333,  5.56},
+{5309, NULL, 213.102083333333, -24.3641666666667,  6.34},
+{5310, NULL, 212.812916666667, 32.2955555555556,  6.11},
+{5311, NULL, 213.41625, -54.6258333333333,  6.11},
+{5312, "50    Hya", 213.191666666667, -27.2611111111111,  5.08},
+{5313, NULL, 213.065833333333, 2.40944444444444,  5.01},
+{5314, NULL, 213.305, -26.6122222222222,  6.24},
+{5315, "98Kap Vir", 213.224166666667, -10.2736111111111,  4.19},
+{5316, NULL, 213.7375, -57.0858333333333,  5.07},
+{5317, NULL, 213.42, -0.845555555555556,  5.91},
+{5318, NULL, 213.6775, -41.8375,  5.61},
+{5319, NULL, 213.838333333333, -53.5097222222222,  6.39},
+{5320, NULL, 214.160833333333, -66.5877777777778,  5.75},
+{5321, "4    UMi", 212.212083333333, 77.5475,  4.82},
+{5322, NULL, 213.58875, -5.9475,  6.36},
+{5323, "14    Boo", 213.521666666667, 12.9594444444444,  5.54},
+{5324, NULL, 213.755416666667, -29.2819444444444,  6.08},
+{5325, NULL, 213.911666666667, -45.0008333333333,  6.31},
+{5326, NULL, 214.1425, -59.9138888888889,  6.39},
+{5327, NULL, 216.097083333333, -82.8486111111111,  6.42},
+{5328, "17Kap1Boo", 213.365416666667, 51.7877777777778,  6.69},
+{5329, "17Kap2Boo", 213.370833333333, 51.7902777777778,  4.54},
+{5330, "15    Boo", 213.711666666667, 10.1005555555556,  5.29},
+{5331, NULL, 213.720833333333, 3.33611111111111,  6.45},
+{5332, NULL, 213.850416666667, -18.2008333333333,  5.43},
+{5333, NULL, 213.670833333333, 21.8733333333333,  6.39},
+{5334, NULL, 213.016666666667, 69.4325,  5.24},
+{5335, NULL, 213.597916666667, 41.5188888888889,  6.24},
+{5336, "Eps Aps", 215.594583333333, -80.1088888888889,  5.06},
+{5337, NULL, 214.07625, -33.2413888888889,  6.55},
+{5338, "99Iot Vir", 214.00375, -6.00055555555556,  4.08},
+{5339, "Del Oct", 216.72875, -83.6677777777778,  4.32},
+{5340, "16Alp Boo", 213.915416666667, 19.1825, -0.04},
+{5341, NULL, 214.089583333333, -6.62194444444444,  6.44},
+{5342, NULL, 214.125416666667, -3.19638888888889,  6.15},
+{5343, NULL, 214.0175, 18.9119444444444,  5.98},
+{5344, NULL, 214.265833333333, -18.5852777777778,  6.22},
+{5345, NULL, 213.820416666667, 52.5358333333333,  6.58},
+{5346, NULL, 214.136666666667, 20.1213888888889,  6.25},
+{5347, NULL, 214.100833333333, 39.7447222222222,  6.38},
+{5348, NULL, 214.599166666667, -33.2205555555556,  6.54},
+{5349, NULL, 214.964583333333, -61.2730555555556,  5.23},
+{5350, "21Iot Boo", 214.04125, 51.3672222222222,  4.75},
+{5351, "19Lam Boo", 214.095833333333, 46.0883333333333,  4.18},
+{5352, NULL, 214.368333333333, 15.2633333333333,  5.80},
+{5353, NULL, 214.5025, -7.5425,  6.47},
+{5354, "Iot Lup", 214.850833333333, -46.0577777777778,  3.55},
+{5355, NULL, 214.659583333333, -18.7161111111111,  5.90},
+{5356, NULL, 214.753333333333, -25.8155555555556,  5.87},
+{5357, NULL, 214.849583333333, -37.0036111111111,  5.94},
+{5358, NULL, 215.08125, -56.3866666666667,  4.33},
+{5359, "100Lam Vir", 214.7775, -13.3711111111111,  4.52},
+{5360, NULL, 214.337916666667, 51.3072222222222,  6.20},
+{5361, NULL, 214.499166666667, 35.5094444444444,  4.81},
+{5362, NULL, 215.040416666667, -43.0588888888889,  5.56},
+{5363, NULL, 214.455, 48.0016666666667,  6.32},
+{5364, NULL, 215.177083333333, -45.1872222222222,  4.77},
+{5365, "18    Boo", 214.817916666667, 13.0041666666667,  5.41},
+{5366, "102Ups Vir", 214.885416666667, -2.26555555555556,  5.14},
+{5367, "Psi Cen", 215.139166666667, -37.8852777777778,  4.05},
+{5368, NULL, 214.920416666667, 0.384166666666667,  6.19},
+{5369, NULL, 214.732083333333, 38.7675,  6.86},
+{5370, "20    Boo", 214.938333333333, 16.3069444444444,  4.86},
+{5371, NULL, 215.654166666667, -58.4594444444445,  4.92},
+{5372, NULL, 214.7325, 54.8641666666667,  6.53},
+{5373, NULL, 214.94875, 38.7938888888889,  6.33},
+{5374, NULL, 215.03625, 30.4291666666667,  6.44},
+{5375, NULL, 215.66125, -48.3202777777778,  6.09},
+{5376, NULL, 215.582083333333, -34.7869444444444,  5.56},
+{5377, NULL, 215.834583333333, -50.7722222222222,  6.02},
+{5378, NULL, 215.759166666667, -39.5122222222222,  4.42},
+{5379, NULL, 216.27625, -68.1952777777778,  5.61},
+{5380, NULL, 215.951666666667, -53.1766666666667,  6.00},
+{5381, "51    Hya", 215.774166666667, -27.7538888888889,  4.77},
+{5382, NULL, 216.414583333333, -66.1733333333333,  6.36},
+{5383, "2    Lib", 215.856666666667, -11.7141666666667,  6.21},
+{5384, NULL, 215.81375, 1.24166666666667,  6.27},
+{5385, NULL, 215.844166666667, 8.445,  6.86},
+{5386, NULL, 215.844583333333, 8.44666666666667,  5.12},
+{5387, NULL, 215.778333333333, 25.3380555555556,  6.22},
+{5388, NULL, 216.00375, 8.24361111111111,  5.95},
+{5389, NULL, 217.403333333333, -76.7291666666667,  6.07},
+{5390, NULL, 216.2025, -24.8063888888889,  5.32},
+{5391, NULL, 216.779583333333, -65.8216666666667,  5.85},
+{5392, NULL, 216.047083333333, 5.82,  5.10},
+{5393, NULL, 216.170416666667, -11.6697222222222,  6.49},
+{5394, NULL, 216.07625, 8.085,  6.19},
+{5395, "Tau1Lup", 216.534166666667, -45.2213888888889,  4.56},
+{5396, "Tau2Lup", 216.545, -45.3794444444444,  4.35},
+{5397, NULL, 216.374166666667, -19.9697222222222,  6.61},
+{5398, NULL, 216.555833333333, -42.3191666666667,  6.32},
+{5399, NULL, 216.44875, -26.8525,  6.48},
+{5400, NULL, 216.707916666667, -39.8738888888889,  6.35},
+{5401, NULL, 216.800833333333, -46.1344444444444,  5.83},
+{5402, NULL, 216.371666666667, 38.3930555555556,  6.27},
+{5403, NULL, 217.18125, -59.1977777777778,  6.45},
+{5404, "23The Boo", 216.299166666667, 51.8508333333333,  4.05},
+{5405, "22    Boo", 216.614166666667, 19.2269444444444,  5.39},
+{5406, "104    Vir", 216.851666666667, -6.12027777777778,  6.17},
+{5407, "52    Hya", 217.043333333333, -29.4916666666667,  4.97},
+{5408, NULL, 217.81875, -67.7172222222222,  5.83},
+{5409, "105Phi Vir", 217.050416666667, -2.22805555555556,  4.81},
+{5410, "106    Vir", 217.17375, -6.90055555555556,  5.42},
+{5411, NULL, 216.86375, 41.025,  6.63},
+{5412, NULL, 217.535833333333, -45.3216666666667,  5.50},
+{5413, NULL, 217.587083333333, -49.5191666666667,  5.37},
+{5414, NULL, 217.13125, 28.2891666666667,  7.62},
+{5415, NULL, 217.13875, 28.2908333333333,  7.12},
+{5416, NULL, 217.068333333333, 36.1969444444444,  6.10},
+{5417, NULL, 217.735416666667, -40.845,  6.39},
+{5418, NULL, 217.460416666667, 0.828888888888889,  5.94},
+{5419, NULL, 217.795, -38.8697222222222,  5.97},
+{5420, "24    Boo", 217.1575, 49.8447222222222,  5.59},
+{5421, NULL, 218.137083333333, -56.8877777777778,  6.93},
+{5422, NULL, 217.457083333333, 31.7911111111111,  6.06},
+{5423, NULL, 217.403333333333, 41.7958333333333,  6.35},
+{5424, NULL, 217.689166666667, 4.77222222222222,  6.02},
+{5425, "Sig Lup", 218.15375, -50.4569444444444,  4.42},
+{5426, NULL, 218.385, -54.9983333333333,  5.87},
+{5427, NULL, 218.374583333333, -52.68,  5.87},
+{5428, NULL, 218.29, -30.7141666666667,  6.09},
+{5429, "25Rho Boo", 217.9575, 30.3713888888889,  3.58},
+{5430, "5    UMi", 216.88125, 75.6961111111111,  4.25},
+{5431, NULL, 218.533333333333, -42.0997222222222,  6.60},
+{5432, NULL, 218.821666666667, -60.0158333333333,  6.40},
+{5433, NULL, 218.084166666667, 26.6772222222222,  6.01},
+{5434, "26    Boo", 218.135416666667, 22.26,  5.92},
+{5435, "27Gam Boo", 218.019583333333, 38.3083333333333,  3.03},
+{5436, NULL, 217.692083333333, 63.1855555555556,  6.09},
+{5437, NULL, 217.928333333333, 60.2255555555556,  6.27},
+{5438, NULL, 218.71125, -20.4391666666667,  6.50},
+{5439, NULL, 218.88125, -41.5172222222222,  5.87},
+{5440, "Eta Cen", 218.876666666667, -42.1577777777778,  2.31},
+{5441, NULL, 218.334583333333, 36.9594444444445,  6.43},
+{5442, NULL, 218.12875, 55.3977777777778,  5.76},
+{5443, NULL, 219.442916666667, -67.9322222222222,  6.04},
+{5444, NULL, 219.079166666667, -46.2452777777778,  5.55},
+{5445, NULL, 218.54875, 32.5344444444444,  6.33},
+{5446, NULL, 219.100833333333, -39.5972222222222,  6.13},
+{5447, "28Sig Boo", 218.67, 29.745,  4.46},
+{5448, NULL, 218.660416666667, 36.6258333333333,  6.03},
+{5449, NULL, 219.184166666667, -40.2116666666667,  5.74},
+{5450, NULL, 219.33375, -46.1338888888889,  5.41},
+{5451, NULL, 218.56625, 57.0652777777778,  6.48},
+{5452, NULL, 218.665, 49.3683333333333,  5.74},
+{5453, "Rho Lup", 219.471666666667, -49.4258333333333,  4.05},
+{5454, NULL, 219.02875, 23.2502777777778,  6.38},
+{5455, NULL, 219.249166666667, -12.3052777777778,  6.20},
+{5456, NULL, 219.581666666667, -38.7941666666667,  6.02},
+{5457, NULL, 219.795833333333, -46.5841666666667,  6.07},
+{5458, NULL, 219.852916666667, -49.0555555555556,  6.39},
+{5459, "Alp1Cen", 219.899583333333, -60.8352777777778, -0.01},
+{5460, "Alp2Cen", 219.900416666667, -60.8355555555556,  1.33},
+{5461, NULL, 220.136666666667, -56.4408333333333,  6.30},
+{5462, NULL, 219.558333333333, 18.2983333333333,  5.91},
+{5463, "Alp Cir", 220.626666666667, -64.9752777777778,  3.19},
+{5464, NULL, 219.552083333333, 43.6419444444444,  5.70},
+{5465, NULL, 220.482083333333, -58.6161111111111,  6.22},
+{5466, NULL, 220.255833333333, -36.135,  5.67},
+{5467, NULL, 219.563333333333, 54.0233333333333,  5.85},
+{5468, "33    Boo", 219.709166666667, 44.4044444444444,  5.39},
+{5469, "Alp Lup", 220.4825, -47.3883333333333,  2.30},
+{5470, "Alp Aps", 221.965, -79.0447222222222,  3.83},
+{5471, NULL, 220.49, -37.7936111111111,  4.00},
+{5472, NULL, 220.09125, 21.9755555555556,  6.10},
+{5473, NULL, 220.176666666667, 13.5341666666667,  5.91},
+{5474, NULL, 220.462916666667, -30.9333333333333,  6.37},
+{5475, "29Pi 1Boo", 220.181666666667, 16.4183333333333,  4.94},
+{5476, "29Pi 2Boo", 220.182916666667, 16.4177777777778,  5.88},
+{5477, "30Zet Boo", 220.287083333333, 13.7283333333333,  4.83},
+{5478, "30Zet Boo", 220.287083333333, 13.7283333333333,  4.43},
+{5479, NULL, 218.409583333333, 79.6602777777778,  6.26},
+{5480, "31    Boo", 220.411666666667, 8.16166666666667,  4.86},
+{5481, "32    Boo", 220.43125, 11.6605555555556,  5.56},
+{5482, NULL, 221.322083333333, -62.8758333333333,  5.36},
+{5483, NULL, 220.475833333333, 21.1236111111111,  6.38},
+{5484, "4    Lib", 220.806666666667, -24.9975,  5.73},
+{5485, NULL, 220.914166666667, -35.1736111111111,  4.05},
+{5486, NULL, 221.23125, -58.4777777777778,  6.11},
+{5487, "107Mu  Vir", 220.765, -5.65833333333333,  3.88},
+{5488, NULL, 221.295416666667, -55.6019444444444,  6.10},
+{5489, NULL, 221.246666666667, -35.1919444444444,  4.92},
+{5490, "34    Boo", 220.855833333333, 26.5277777777778,  4.81},
+{5491, NULL, 232.079583333333, -88.1330555555555,  6.48},
+{5492, NULL, 220.513333333333, 61.2619444444444,  6.25},
+{5493, NULL, 220.935, 40.4591666666667,  5.73},
+{5494, NULL, 221.62125, -47.4411111111111,  5.74},
+{5495, NULL, 221.755416666667, -52.3836111111111,  5.21},
+{5496, NULL, 221.29875, -1.41777777777778,  6.07},
+{5497, "54    Hya", 221.500416666667, -25.4430555555556,  4.94},
+{5498, NULL, 221.80125, -52.2055555555556,  6.07},
+{5499, NULL, 221.528333333333, -23.1530555555556,  5.81},
+{5500, NULL, 222.185, -66.5938888888889,  5.91},
+{5501, "108    Vir", 221.375833333333, 0.717222222222222,  5.69},
+{5502, "35Omi Boo", 221.310416666667, 16.9644444444444,  4.60},
+{5503, "5    Lib", 221.490833333333, -15.4597222222222,  6.33},
+{5504, NULL, 221.545416666667, -21.1761111111111,  6.40},
+{5505, "36Eps Boo", 221.246666666667, 27.075,  5.12},
+{5506, "36Eps Boo", 221.246666666667, 27.0741666666667,  2.70},
+{5507, NULL, 221.33625, 18.8847222222222,  6.13},
+{5508, NULL, 221.77125, -38.2908333333333,  5.94},
+{5509, NULL, 221.88375, -43.5575,  6.30},
+{5510, NULL, 221.307083333333, 32.7883333333333,  6.28},
+{5511, "109    Vir", 221.562083333333, 1.89277777777778,  3.72},
+{5512, NULL, 221.525, 15.1319444444444,  5.63},
+{5513, NULL, 221.807083333333, -21.3247222222222,  6.06},
+{5514, "55    Hya", 221.84375, -25.6244444444444,  5.63},
+{5515, NULL, 222.27875, -56.6677777777778,  6.23},
+{5516, "56    Hya", 221.936666666667, -26.0875,  5.24},
+{5517, "57    Hya", 221.989583333333, -26.6463888888889,  5.77},
+{5518, NULL, 221.97875, -12.8397222222222,  6.35},
+{5519, NULL, 222.15875, -36.6347222222222,  6.04},
+{5520, NULL, 223.307083333333, -73.19,  5.60},
+{5521, NULL, 222.327916666667, -24.2516666666667,  5.68},
+{5522, NULL, 222.225416666667, -0.847777777777778,  6.14},
+{5523, "7Mu  Lib", 222.329583333333, -14.1488888888889,  5.31},
+{5524, NULL, 222.097083333333, 24.3666666666667,  6.14},
+{5525, "Pi 1Oct", 225.461666666667, -83.2277777777778,  5.65},
+{5526, "58    Hya", 222.572083333333, -27.9602777777778,  4.41},
+{5527, NULL, 223.145833333333, -63.81,  5.87},
+{5528, "Omi Lup", 222.91, -43.5755555555556,  4.32},
+{5529, NULL, 222.277916666667, 37.8111111111111,  6.16},
+{5530, "8Alp1Lib", 222.671666666667, -15.9972222222222,  5.15},
+{5531, "9Alp2Lib", 222.719583333333, -16.0416666666667,  2.75},
+{5532, NULL, 222.493333333333, 28.6158333333333,  5.80},
+{5533, "38    Boo", 222.327916666667, 46.1161111111111,  5.74},
+{5534, NULL, 222.565833333333, 23.9119444444444,  5.85},
+{5535, "11    Lib", 222.754166666667, -2.29916666666667,  4.94},
+{5536, NULL, 222.750416666667, -0.257222222222222,  6.18},
+{5537, NULL, 222.384583333333, 51.3747222222222,  6.51},
+{5538, "39    Boo", 222.422083333333, 48.7205555555556,  5.69},
+{5539, "Zet Cir", 223.676666666667, -65.9913888888889,  6.09},
+{5540, NULL, 224.470416666667, -76.6627777777778,  5.34},
+{5541, NULL, 222.623333333333, 37.2719444444444,  5.48},
+{5542, NULL, 223.137916666667, -30.5769444444444,  6.29},
+{5543, NULL, 223.212916666667, -37.8033333333333,  5.03},
+{5544, "37Xi  Boo", 222.847083333333, 19.1011111111111,  4.55},
+{5545, "Pi 2Oct", 226.194583333333, -83.0383333333333,  5.65},
+{5546, NULL, 223.894166666667, -60.1141666666667,  5.20},
+{5547, NULL, 225.049166666667, -77.1602777777778,  5.93},
+{5548, "12    Lib", 223.58375, -24.6422222222222,  5.30},
+{5549, NULL, 223.658333333333, -33.3005555555556,  5.82},
+{5550, NULL, 223.347083333333, 15.7044444444444,  6.40},
+{5551, "The Cir", 224.183333333333, -62.7808333333333,  5.11},
+{5552, NULL, 222.86, 59.2938888888889,  5.46},
+{5553, NULL, 223.34875, 19.1527777777778,  6.01},
+{5554, "13Xi 1Lib", 223.595416666667, -11.8983333333333,  5.80},
+{5555, NULL, 224.983333333333, -75.0325,  6.20},
+{5556, NULL, 224.072083333333, -52.8097222222222,  5.38},
+{5557, "Ome Oct", 227.784583333333, -84.7875,  5.91},
+{5558, NULL, 223.93625, -33.8558333333333,  5.32},
+{5559, NULL, 224.133333333333, -47.8791666666667,  5.64},
+{5560, NULL, 224.255833333333, -51.4469444444444,  6.64},
+{5561, NULL, 224.149166666667, -39.4161111111111,  6.36},
+{5562, NULL, 224.12875, -32.6366666666667,  6.06},
+{5563, "7Bet UMi", 222.67625, 74.1555555555556,  2.08},
+{5564, "15Xi 2Lib", 224.192083333333, -11.4097222222222,  5.46},
+{5565, NULL, 224.306666666667, -29.1577777777778,  6.29},
+{5566, NULL, 224.536666666667, -48.8630555555556,  6.35},
+{5567, NULL, 224.055, 14.4463888888889,  5.77},
+{5568, NULL, 224.366666666667, -21.4155555555556,  5.74},
+{5569, NULL, 223.994583333333, 32.3002777777778,  6.12},
+{5570, "16    Lib", 224.295833333333, -4.34638888888889,  4.49},
+{5571, "Bet Lup", 224.632916666667, -43.1338888888889,  2.68},
+{5572, NULL, 224.653333333333, -39.9066666666667,  6.15},
+{5573, NULL, 224.38875, -0.1675,  5.53},
+{5574, NULL, 224.265, 21.5552777777778,  6.49},
+{5575, NULL, 224.29875, 16.3883333333333,  5.71},
+{5576, "Kap Cen", 224.790416666667, -42.1041666666667,  3.13},
+{5577, "59    Hya", 224.663333333333, -27.6572222222222,  5.65},
+{5578, "17    Lib", 224.555833333333, -11.155,  6.60},
+{5579, NULL, 224.807916666667, -37.8813888888889,  6.47},
+{5580, NULL, 224.862916666667, -43.16,  6.10},
+{5581, NULL, 224.095833333333, 49.6286111111111,  5.63},
+{5582, "18    Lib", 224.723333333333, -11.1441666666667,  5.87},
+{5583, NULL, 224.72, -4.98916666666667,  6.09},
+{5584, NULL, 224.84625, 4.56777777777778,  5.93},
+{5585, NULL, 225.304166666667, -38.0583333333333,  5.89},
+{5586, "19Del Lib", 225.243333333333, -8.51888888888889,  4.92},
+{5587, NULL, 225.492083333333, -34.3588888888889,  6.22},
+{5588, "40    Boo", 224.90375, 39.2652777777778,  5.64},
+{5589, NULL, 224.395833333333, 65.9325,  4.60},
+{5590, NULL, 225.3325, -2.755,  5.52},
+{5591, "60    Hya", 225.526666666667, -28.0605555555556,  5.85},
+{5592, NULL, 225.218333333333, 22.0455555555556,  6.38},
+{5593, "Eta Cir", 226.200833333333, -64.0316666666667,  5.17},
+{5594, NULL, 225.45375, -0.140555555555556,  5.71},
+{5595, NULL, 225.747083333333, -32.6433333333333,  5.44},
+{5596, NULL, 222.585, 82.5119444444444,  5.64},
+{5597, NULL, 225.16125, 47.2777777777778,  6.37},
+{5598, NULL, 226.78625, -71.9052777777778,  6.52},
+{5599, NULL, 225.687083333333, -3.03138888888889,  6.61},
+{5600, "41Ome Boo", 225.527083333333, 25.0080555555556,  4.81},
+{5601, "110    Vir", 225.725, 2.09138888888889,  4.40},
+{5602, "42Bet Boo", 225.486666666667, 40.3905555555556,  3.50},
+{5603, "20Sig Lib", 226.0175, -25.2819444444444,  3.29},
+{5604, NULL, 226.17875, -40.8613888888889,  6.41},
+{5605, "Pi  Lup", 226.28, -47.0511111111111,  4.72},
+{5606, "Pi  Lup", 226.28, -47.0511111111111,  4.82},
+{5607, NULL, 226.329583333333, -41.0672222222222,  5.15},
+{5608, NULL, 225.362916666667, 60.2044444444444,  5.93},
+{5609, NULL, 225.775416666667, 35.2058333333333,  5.51},
+{5610, NULL, 226.026666666667, 5.4925,  6.50},
+{5611, NULL, 226.986666666667, -65.2755555555556,  6.17},
+{5612, NULL, 225.7775, 44.6444444444444,  6.65},
+{5613, NULL, 225.902083333333, 34.5661111111111,  6.59},
+{5614, NULL, 226.44875, -25.7897222222222,  6.67},
+{5615, NULL, 226.557916666667, -36.2641666666667,  6.27},
+{5616, "43Psi Boo", 226.11125, 26.9475,  4.54},
+{5617, NULL, 226.857916666667, -49.0883333333333,  5.77},
+{5618, "44    Boo", 225.9475, 47.6544444444444,  4.76},
+{5619, NULL, 226.63875, -30.9188888888889,  5.96},
+{5620, NULL, 226.612916666667, -22.0319444444444,  6.17},
+{5621, NULL, 227.374583333333, -67.0841666666667,  5.76},
+{5622, "21Nu  Lib", 226.656666666667, -16.2569444444444,  5.20},
+{5623, NULL, 227.35625, -63.6427777777778,  6.28},
+{5624, NULL, 227.050416666667, -40.5838888888889,  5.79},
+{5625, NULL, 227.162916666667, -42.8677777777778,  5.85},
+{5626, "Lam Lup", 227.210833333333, -45.2797222222222,  4.05},
+{5627, "47    Boo", 226.3575, 48.1511111111111,  5.57},
+{5628, NULL, 228.140833333333, -72.7702777777778,  6.01},
+{5629, NULL, 225.990833333333, 65.9197222222222,  6.13},
+{5630, NULL, 226.64625, 36.4555555555556,  6.35},
+{5631, NULL, 226.917916666667, 5.49805555555556,  6.16},
+{5632, NULL, 227.685833333333, -61.4225,  6.30},
+{5633, NULL, 226.835, 18.4416666666667,  6.02},
+{5634, "45    Boo", 226.825416666667, 24.8691666666667,  4.93},
+{5635, NULL, 226.569583333333, 54.5563888888889,  5.25},
+{5636, NULL, 227.53125, -38.7925,  5.98},
+{5637, NULL, 227.816666666667, -55.3461111111111,  5.54},
+{5638, "46    Boo", 227.099166666667, 26.3011111111111,  5.67},
+{5639, NULL, 227.2225, 13.235,  6.10},
+{5640, NULL, 227.147916666667, 25.1086111111111,  5.81},
+{5641, NULL, 227.5775, -26.3327777777778,  5.76},
+{5642, NULL, 227.895416666667, -45.2775,  6.44},
+{5643, NULL, 227.882916666667, -45.2794444444444,  7.39},
+{5644, NULL, 228.579583333333, -70.0794444444444,  5.81},
+{5645, NULL, 228.254166666667, -61.7438888888889,  6.32},
+{5646, "Kap1Lup", 227.98375, -48.7377777777778,  3.87},
+{5647, "Kap2Lup", 227.99, -48.7436111111111,  5.69},
+{5648, NULL, 227.08125, 50.055,  6.39},
+{5649, "Zet Lup", 228.07125, -52.0991666666667,  3.41},
+{5650, NULL, 228.130416666667, -48.2186111111111,  6.33},
+{5651, NULL, 228.20625, -44.5005555555556,  4.82},
+{5652, "24Iot1Lib", 228.055416666667, -19.7916666666667,  4.54},
+{5653, NULL, 228.280833333333, -36.0913888888889,  6.10},
+{5654, NULL, 228.017916666667, 18.9758333333333,  5.89},
+{5655, NULL, 228.322916666667, -24.0083333333333,  6.47},
+{5656, "25Iot2Lib", 228.33, -19.6475,  6.08},
+{5657, "23    Lib", 228.369583333333, -25.3091666666667,  6.45},
+{5658, NULL, 228.472083333333, -26.1936111111111,  5.84},
+{5659, NULL, 228.18125, 19.2858333333333,  6.68},
+{5660, "1    Lup", 228.655416666667, -31.5191666666667,  4.91},
+{5661, NULL, 229.151666666667, -60.9038888888889,  5.73},
+{5662, "26    Lib", 228.640416666667, -17.7686111111111,  6.17},
+{5663, NULL, 228.974166666667, -48.0741666666667,  5.95},
+{5664, "Del Cir", 229.23625, -60.9575,  5.09},
+{5665, NULL, 228.382916666667, 22.9833333333333,  6.30},
+{5666, "Eps Cir", 229.412083333333, -63.6105555555556,  4.86},
+{5667, NULL, 229.016666666667, -41.4911111111111,  5.16},
+{5668, NULL, 229.04375, -43.4847222222222,  6.04},
+{5669, NULL, 228.71125, -5.50277777777778,  6.28},
+{5670, "Bet Cir", 229.378333333333, -58.8011111111111,  4.07},
+{5671, "Gam TrA", 229.7275, -68.6794444444444,  2.89},
+{5672, NULL, 227.68375, 67.7813888888889,  6.17},
+{5673, NULL, 228.398333333333, 38.2647222222222,  6.20},
+{5674, NULL, 228.525416666667, 31.7880555555556,  5.99},
+{5675, "3    Ser", 228.7975, 4.93944444444444,  5.33},
+{5676, "48Chi Boo", 228.621666666667, 29.1641666666667,  5.26},
+{5677, NULL, 228.542916666667, 42.1713888888889,  6.13},
+{5678, NULL, 229.095833333333, -22.3994444444444,  5.50},
+{5679, "4    Ser", 228.954583333333, 0.372222222222222,  5.63},
+{5680, NULL, 229.70375, -60.4963888888889,  5.46},
+{5681, "49Del Boo", 228.875833333333, 33.3147222222222,  3.47},
+{5682, NULL, 229.539166666667, -41.0608333333333,  6.28},
+{5683, "Mu  Lup", 229.633333333333, -47.875,  4.27},
+{5684, NULL, 230.169583333333, -67.4813888888889,  6.28},
+{5685, "27Bet Lib", 229.251666666667, -9.38305555555556,  2.61},
+{5686, "2    Lup", 229.457916666667, -30.1488888888889,  4.34},
+{5687, NULL, 229.735, -40.7883333333333,  5.59},
+{5688, NULL, 229.672083333333, -31.2094444444444,  6.18},
+{5689, NULL, 229.881666666667, -37.0966666666667,  6.20},
+{5690, NULL, 229.609166666667, -0.461388888888889,  5.89},
+{5691, NULL, 228.659583333333, 67.3466666666667,  5.13},
+{5692, NULL, 229.602083333333, 20.5727777777778,  5.70},
+{5693, NULL, 228.71625, 68.9452777777778,  6.51},
+{5694, "5    Ser", 229.828333333333, 1.76527777777778,  5.06},
+{5695, "Del Lup", 230.342916666667, -40.6475,  3.22},
+{5696, NULL, 230.397083333333, -40.7497222222222,  6.20},
+{5697, NULL, 230.375416666667, -38.2191666666667,  6.48},
+{5698, "Nu 1Lup", 230.534583333333, -47.9277777777778,  5.00},
+{5699, "Nu 2Lup", 230.450833333333, -48.3177777777778,  5.65},
+{5700, NULL, 230.793333333333, -60.6569444444444,  5.67},
+{5701, "28    Lib", 230.22375, -18.1586111111111,  6.17},
+{5702, NULL, 229.875833333333, 32.5152777777778,  6.32},
+{5703, "29Omi Lib", 230.255833333333, -15.5483333333333,  6.30},
+{5704, "Gam Cir", 230.844583333333, -59.3208333333333,  4.51},
+{5705, "Phi1Lup", 230.451666666667, -36.2613888888889,  3.56},
+{5706, NULL, 230.19625, -2.41333333333333,  6.35},
+{5707, NULL, 230.281666666667, -5.82472222222222,  5.54},
+{5708, "Eps Lup", 230.670416666667, -44.6894444444444,  3.37},
+{5709, "1Omi CrB", 230.035416666667, 29.6161111111111,  5.51},
+{5710, "6    Ser", 230.258333333333, 0.715277777777778,  5.35},
+{5711, NULL, 230.27875, 24.9577777777778,  6.39},
+{5712, "Phi2Lup", 230.789166666667, -36.8586111111111,  4.54},
+{5713, NULL, 231.56125, -68.3091666666667,  5.89},
+{5714, "11    UMi", 229.274583333333, 71.8238888888889,  5.02},
+{5715, NULL, 230.021666666667, 51.9586111111111,  5.66},
+{5716, NULL, 230.173333333333, 44.4341666666667,  6.19},
+{5717, "7    Ser", 230.596666666667, 12.5675,  6.28},
+{5718, "50    Boo", 230.4525, 32.9338888888889,  5.37},
+{5719, "Ups Lup", 231.187083333333, -39.7102777777778,  5.37},
+{5720, NULL, 230.9675, -12.3694444444444,  5.72},
+{5721, "8    Ser", 230.932083333333, -1.0225,  6.12},
+{5722, NULL, 231.2775, -38.1694444444444,  7.03},
+{5723, "31Eps Lib", 231.049583333333, -10.3222222222222,  4.94},
+{5724, NULL, 231.334166666667, -38.7336111111111,  4.60},
+{5725, NULL, 231.887916666667, -64.5313888888889,  5.71},
+{5726, NULL, 230.655833333333, 39.5813888888889,  5.50},
+{5727, "2Eta CrB", 230.80125, 30.2877777777778,  5.58},
+{5728, "2Eta CrB", 230.80125, 30.2877777777778,  6.08},
+{5729, "Rho Oct", 235.82, -84.4652777777778,  5.57},
+{5730, "Kap1Aps", 232.878333333333, -73.3894444444445,  5.49},
+{5731, NULL, 230.655416666667, 62.0472222222222,  5.98},
+{5732, NULL, 231.02125, 45.2711111111111,  6.01},
+{5733, "51Mu 1Boo", 231.1225, 37.3772222222222,  4.31},
+{5734, "51Mu 2Boo", 231.12875, 37.3477777777778,  6.50},
+{5735, "13Gam UMi", 230.182083333333, 71.8338888888889,  3.05},
+{5736, NULL, 231.825833333333, -36.7677777777778,  5.45},
+{5737, NULL, 230.66, 63.3413888888889,  5.79},
+{5738, NULL, 232.113333333333, -51.5975,  6.10},
+{5739, "9Tau1Ser", 231.4475, 15.4280555555556,  5.17},
+{5740, NULL, 231.472083333333, 19.4808333333333,  6.27},
+{5741, NULL, 231.5725, 34.3358333333333,  5.46},
+{5742, NULL, 232.35125, -46.7327777777778,  5.24},
+{5743, "32Zet1Lib", 232.064166666667, -16.7163888888889,  5.64},
+{5744, "12Iot Dra", 231.2325, 58.9661111111111,  3.29},
+{5745, NULL, 231.912083333333, 25.1016666666667,  6.02},
+{5746, "10    Ser", 232.159166666667, 1.84222222222222,  5.17},
+{5747, "3Bet CrB", 231.957083333333, 29.1058333333333,  3.68},
+{5748, NULL, 231.635416666667, 54.02,  6.45},
+{5749, NULL, 232.65125, -20.7283333333333,  6.22},
+{5750, "34Zet3Lib", 232.668333333333, -16.6094444444444,  5.82},
+{5751, NULL, 233.018333333333, -38.6230555555556,  6.25},
+{5752, NULL, 232.185416666667, 47.2013888888889,  6.15},
+{5753, NULL, 232.959583333333, -32.8811111111111,  6.46},
+{5754, NULL, 231.92, 62.2755555555556,  6.50},
+{5755, NULL, 231.964166666667, 60.6702777777778,  5.90},
+{5756, NULL, 232.930833333333, -20.1647222222222,  6.22},
+{5757, NULL, 234.82625, -77.9180555555556,  6.18},
+{5758, NULL, 232.730833333333, 8.57916666666667,  6.57},
+{5759, NULL, 232.236666666667, 55.195,  6.43},
+{5760, NULL, 232.594583333333, 31.2861111111111,  6.46},
+{5761, NULL, 232.61625, 36.8041666666667,  6.37},
+{5762, NULL, 233.152916666667, -19.6705555555556,  5.52},
+{5763, "52Nu 1Boo", 232.7325, 40.8330555555556,  5.02},
+{5764, "35Zet4Lib", 233.23, -16.8527777777778,  5.50},
+{5765, NULL, 233.287916666667, -24.4894444444444,  7.00},
+{5766, NULL, 234.0725, -65.6133333333333,  6.51},
+{5767, NULL, 233.506666666667, -40.0661111111111,  5.82},
+{5768, NULL, 232.338333333333, 62.0997222222222,  6.38},
+{5769, NULL, 232.843333333333, 36.6163888888889,  6.38},
+{5770, "12Tau2Ser", 233.040416666667, 16.0561111111111,  6.22},
+{5771, "Eps TrA", 234.18, -66.3169444444444,  4.11},
+{5772, "11    Ser", 233.24125, -1.18638888888889,  5.51},
+{5773, NULL, 233.587083333333, -39.3494444444444,  6.36},
+{5774, "53Nu 2Boo", 232.945833333333, 40.8994444444444,  5.02},
+{5775, "36    Lib", 233.655416666667, -28.0469444444444,  5.15},
+{5776, "Gam Lup", 233.785416666667, -41.1669444444444,  2.78},
+{5777, "37    Lib", 233.544583333333, -10.0644444444444,  4.62},
+{5778, "4The CrB", 233.2325, 31.3591666666667,  4.14},
+{5779, NULL, 233.586666666667, -5.695,  6.51},
+{5780, NULL, 233.610833333333, -9.18333333333333,  5.17},
+{5781, NULL, 233.971666666667, -44.9586111111111,  4.54},
+{5782, "Kap2Aps", 235.088333333333, -73.4466666666667,  5.65},
+{5783, NULL, 233.47, 17.1377777777778,  6.45},
+{5784, NULL, 234.050416666667, -44.3969444444444,  5.43},
+{5785, NULL, 232.732083333333, 64.2086111111111,  5.79},
+{5786, NULL, 235.4775, -76.0819444444444,  5.95},
+{5787, "38Gam Lib", 233.881666666667, -14.7894444444444,  3.91},
+{5788, "13Del Ser", 233.700416666667, 10.5375,  3.80},
+{5789, "13Del Ser", 233.700416666667, 10.5391666666667,  3.80},
+{5790, NULL, 234.0475, -33.0927777777778,  6.24},
+{5791, NULL, 233.769166666667, 1.66888888888889,  6.56},
+{5792, NULL, 235.047916666667, -70.2277777777778,  6.44},
+{5793, "5Alp CrB", 233.672083333333, 26.7147222222222,  2.23},
+{5794, "39Ups Lib", 234.25625, -28.135,  3.58},
+{5795, "15Tau3Ser", 233.888333333333, 17.6555555555556,  6.12},
+{5796, NULL, 233.9725, 11.2655555555556,  6.07},
+{5797, "Ome Lup", 234.513333333333, -42.5675,  4.33},
+{5798, NULL, 234.70625, -52.3727777777778,  5.44},
+{5799, "14    Ser", 234.140416666667, -0.561666666666667,  6.51},
+{5800, "6Mu  CrB", 233.8125, 39.01,  5.11},
+{5801, NULL, 234.36875, -26.28,  6.19},
+{5802, "16    Ser", 234.123333333333, 10.01,  5.26},
+{5803, NULL, 234.985416666667, -59.9083333333333,  5.95},
+{5804, "18Tau5Ser", 234.122083333333, 16.1188888888889,  5.93},
+{5805, NULL, 234.63625, -39.1608333333333,  6.57},
+{5806, NULL, 234.450416666667, -23.1416666666667,  5.78},
+{5807, NULL, 234.67625, -39.1280555555556,  6.04},
+{5808, NULL, 233.955416666667, 38.3738888888889,  6.42},
+{5809, NULL, 234.565416666667, -28.2066666666667,  6.32},
+{5810, NULL, 234.567916666667, -21.0161111111111,  5.84},
+{5811, NULL, 233.817916666667, 53.9219444444444,  5.97},
+{5812, "40Tau Lib", 234.664166666667, -29.7777777777778,  3.66},
+{5813, NULL, 234.2225, 29.9911111111111,  6.52},
+{5814, "41    Lib", 234.727083333333, -19.3019444444444,  5.38},
+{5815, NULL, 234.666666666667, -8.79444444444444,  6.50},
+{5816, NULL, 234.667083333333, -8.79111111111111,  6.48},
+{5817, NULL, 234.017083333333, 52.0697222222222,  6.74},
+{5818, NULL, 233.987916666667, 54.6305555555556,  5.74},
+{5819, NULL, 234.83875, -23.1502777777778,  6.34},
+{5820, "3Psi1Lup", 234.941666666667, -34.4119444444444,  4.67},
+{5821, NULL, 235.242916666667, -47.7355555555556,  6.23},
+{5822, NULL, 235.064166666667, -31.2136111111111,  6.34},
+{5823, "54Phi Boo", 234.456666666667, 40.3533333333333,  5.24},
+{5824, "42    Lib", 235.070416666667, -23.8180555555556,  4.96},
+{5825, NULL, 235.297083333333, -44.6611111111111,  4.64},
+{5826, "15The UMi", 232.85375, 77.3494444444444,  4.96},
+{5827, NULL, 234.70375, 34.675,  6.11},
+{5828, NULL, 234.383333333333, 54.5088888888889,  5.87},
+{5829, NULL, 232.295833333333, 80.4486111111111,  6.58},
+{5830, NULL, 234.5675, 46.7977777777778,  5.75},
+{5831, NULL, 235.043333333333, 12.0530555555556,  6.25},
+{5832, NULL, 235.655, -49.4894444444444,  6.04},
+{5833, "7Zet1CrB", 234.8425, 36.6366666666667,  6.00},
+{5834, "7Zet2CrB", 234.844583333333, 36.6358333333333,  5.07},
+{5835, NULL, 234.642916666667, 50.4233333333333,  5.84},
+{5836, NULL, 235.979583333333, -60.2872222222222,  6.48},
+{5837, NULL, 235.659583333333, -37.425,  5.24},
+{5838, "43Kap Lib", 235.486666666667, -19.6788888888889,  4.74},
+{5839, "4Psi2Lup", 235.670833333333, -34.7105555555556,  4.75},
+{5840, "19Tau6Ser", 235.246666666667, 16.0247222222222,  6.01},
+{5841, NULL, 234.789583333333, 57.9244444444444,  6.45},
+{5842, "21Iot Ser", 235.387916666667, 19.6702777777778,  4.52},
+{5843, "20Chi Ser", 235.4475, 12.8475,  5.33},
+{5844, NULL, 234.412916666667, 69.2833333333333,  5.62},
+{5845, "22Tau7Ser", 235.477916666667, 18.4638888888889,  5.81},
+{5846, NULL, 236.094166666667, -41.8194444444444,  5.94},
+{5847, NULL, 235.85375, -15.0433333333333,  6.31},
+{5848, "44Eta Lib", 236.018333333333, -15.6727777777778,  5.41},
+{5849, "8Gam CrB", 235.685833333333, 26.2955555555556,  3.84},
+{5850, NULL, 235.794166666667, 13.6677777777778,  6.48},
+{5851, NULL, 236.973333333333, -65.4425,  6.18},
+{5852, NULL, 236.97375, -65.4425,  6.39},
+{5853, "23Psi Ser", 236.0075, 2.515,  5.88},
+{5854, "24Alp Ser", 236.067083333333, 6.42555555555556,  2.65},
+{5855, "9Pi  CrB", 235.997083333333, 32.5158333333333,  5.56},
+{5856, NULL, 236.553333333333, -28.0616666666667,  6.51},
+{5857, NULL, 235.71125, 52.3608333333333,  5.51},
+{5858, "26Tau8Ser", 236.175416666667, 17.2641666666667,  6.14},
+{5859, NULL, 236.347916666667, 5.44694444444445,  5.58},
+{5860, NULL, 236.684166666667, -34.6825,  5.61},
+{5861, NULL, 236.415416666667, 0.891388888888889,  6.33},
+{5862, NULL, 236.855833333333, -40.1941666666667,  6.42},
+{5863, "25    Ser", 236.523333333333, -1.80444444444444,  5.40},
+{5864, NULL, 236.870833333333, -37.9163888888889,  6.01},
+{5865, NULL, 237.209583333333, -52.4380555555556,  6.07},
+{5866, NULL, 236.689166666667, -6.12027777777778,  6.24},
+{5867, "28Bet Ser", 236.547083333333, 15.4219444444444,  3.67},
+{5868, "27Lam Ser", 236.610833333333, 7.35305555555555,  4.43},
+{5869, NULL, 237.52875, -53.2094444444445,  5.77},
+{5870, "31Ups Ser", 236.822083333333, 14.1152777777778,  5.71},
+{5871, NULL, 237.489583333333, -48.9119444444444,  5.84},
+{5872, NULL, 237.567916666667, -45.4016666666667,  6.12},
+{5873, NULL, 237.778333333333, -55.0558333333333,  5.73},
+{5874, NULL, 237.055416666667, 13.7886111111111,  6.00},
+{5875, NULL, 237.236666666667, -3.81861111111111,  5.53},
+{5876, NULL, 238.23625, -65.1525,  6.54},
+{5877, NULL, 237.008333333333, 31.7358333333333,  6.44},
+{5878, NULL, 236.645, 55.4747222222222,  5.92},
+{5879, "35Kap Ser", 237.185, 18.1416666666667,  4.09},
+{5880, NULL, 237.143333333333, 28.1566666666667,  5.85},
+{5881, "32Mu  Ser", 237.405, -3.43027777777778,  3.53},
+{5882, NULL, 237.88125, -47.0605555555556,  6.01},
+{5883, "5Chi Lup", 237.739583333333, -33.6272222222222,  3.95},
+{5884, NULL, 238.345, -62.6069444444444,  6.19},
+{5885, "1    Sco", 237.744583333333, -25.7513888888889,  4.64},
+{5886, NULL, 236.666666666667, 62.5994444444444,  5.19},
+{5887, NULL, 236.908333333333, 55.3766666666667,  5.86},
+{5888, "34Ome Ser", 237.572916666667, 2.19638888888889,  5.23},
+{5889, "10Del CrB", 237.39875, 26.0683333333333,  4.63},
+{5890, NULL, 238.214583333333, -50.6152777777778,  6.60},
+{5891, "Kap TrA", 238.873333333333, -68.6030555555556,  5.09},
+{5892, "37Eps Ser", 237.704166666667, 4.47777777777778,  3.71},
+{5893, NULL, 238.053333333333, -29.8866666666667,  6.40},
+{5894, NULL, 237.67375, 15.1336111111111,  5.2 },
+{5895, "36    Ser", 237.815, -3.09055555555556,  5.11},
+{5896, NULL, 237.91, -14.1336111111111,  6.19},
+{5897, "Bet TrA", 238.785416666667, -63.4305555555556,  2.85},
+{5898, NULL, 238.719166666667, -60.7433333333333,  6.15},
+{5899, "38Rho Ser", 237.81625, 20.9777777777778,  4.76},
+{5900, NULL, 238.884583333333, -60.1777777777778,  5.77},
+{5901, "11Kap CrB", 237.807916666667, 35.6575,  4.82},
+{5902, "45Lam Lib", 238.33375, -20.1672222222222,  5.03},
+{5903, "16Zet UMi", 236.014583333333, 77.7944444444444,  4.32},
+{5904, "2    Sco", 238.402916666667, -25.3272222222222,  4.59},
+{5905, NULL, 239.025, -60.4827777777778,  5.76},
+{5906, NULL, 238.474166666667, -24.5330555555556,  5.39},
+{5907, NULL, 238.4825, -23.9780555555556,  5.42},
+{5908, "46The Lib", 238.45625, -16.7294444444444,  4.15},
+{5909, NULL, 238.234166666667, 17.4036111111111,  6.36},
+{5910, NULL, 238.625, -27.3386111111111,  6.14},
+{5911, "39    Ser", 238.300416666667, 13.1966666666667,  6.10},
+{5912, "3    Sco", 238.664583333333, -25.2436111111111,  5.87},
+{5913, NULL, 238.395416666667, 16.075,  6.09},
+{5914, "1Chi Her", 238.16875, 42.4516666666667,  4.62},
+{5915, "47    Lib", 238.75125, -19.3830555555556,  5.94},
+{5916, NULL, 238.876666666667, -31.0836111111111,  6.21},
+{5917, "4    Sco", 238.875416666667, -26.2658333333333,  5.62},
+{5918, NULL, 239.027083333333, -39.8641666666667,  6.03},
+{5919, "40    Ser", 238.667916666667, 8.58027777777778,  6.29},
+{5920, NULL, 239.742083333333, -65.0377777777778,  5.75},
+{5921, NULL, 239.265833333333, -48.1622222222222,  6.31},
+{5922, NULL, 238.069166666667, 55.8266666666667,  5.81},
+{5923, NULL, 239.057916666667, -31.7858333333333,  6.29},
+{5924, NULL, 238.644166666667, 20.3108333333333,  5.44},
+{5925, "Xi 1Lup", 239.222916666667, -33.9663888888889,  5.12},
+{5926, "Xi 2Lup", 239.225833333333, -33.9641666666667,  5.62},
+{5927, NULL, 239.06, -14.3994444444444,  6.37},
+{5928, "5Rho Sco", 239.22125, -29.2141666666667,  3.88},
+{5929, NULL, 239.33875, -36.185,  5.80},
+{5930, NULL, 239.139166666667, -14.8291666666667,  6.13},
+{5931, NULL, 238.915833333333, 18.6205555555556,  6.26},
+{5932, "2    Her", 238.657916666667, 43.1386111111111,  5.37},
+{5933, "41Gam Ser", 239.113333333333, 15.6616666666667,  3.85},
+{5934, NULL, 239.418333333333, -20.9830555555556,  5.85},
+{5935, NULL, 239.627916666667, -37.5030555555556,  6.31},
+{5936, "12Lam CrB", 238.948333333333, 37.9469444444444,  5.45},
+{5937, NULL, 239.975, -54.0211111111111,  6.10},
+{5938, "4    Her", 238.8775, 42.5661111111111,  5.75},
+{5939, NULL, 240.294583333333, -63.7766666666667,  6.41},
+{5940, "Phi Ser", 239.310833333333, 14.4144444444444,  5.54},
+{5941, "48    Lib", 239.5475, -14.2794444444444,  4.88},
+{5942, NULL, 239.645, -24.8313888888889,  5.43},
+{5943, NULL, 239.87625, -41.7444444444444,  4.99},
+{5944, "6Pi  Sco", 239.712916666667, -26.1141666666667,  2.89},
+{5945, NULL, 239.991666666667, -40.6527777777778,  6.49},
+{5946, NULL, 240.276666666667, -54.5777777777778,  6.13},
+{5947, "13Eps CrB", 239.397083333333, 26.8777777777778,  4.15},
+{5948, "Eta Lup", 240.030416666667, -38.3969444444444,  3.41},
+{5949, NULL, 238.957083333333, 58.9116666666667,  6.31},
+{5950, NULL, 239.374583333333, 39.6952777777778,  6.31},
+{5951, NULL, 240.718333333333, -62.5416666666667,  6.25},
+{5952, NULL, 240.22375, -40.4352777777778,  6.21},
+{5953, "7Del Sco", 240.083333333333, -22.6216666666667,  2.32},
+{5954, "49    Lib", 240.081666666667, -16.5333333333333,  5.47},
+{5955, NULL, 241.4825, -72.4008333333333,  5.70},
+{5956, NULL, 240.33125, -31.8894444444444,  6.33},
+{5957, NULL, 239.740416666667, 36.6438888888889,  5.62},
+{5958, NULL, 239.875833333333, 25.9202777777778,  2.0 },
+{5959, "50    Lib", 240.198333333333, -8.41138888888889,  5.55},
+{5960, NULL, 239.4475, 54.7497222222222,  4.95},
+{5961, "Iot1Nor", 240.882916666667, -57.7752777777778,  4.63},
+{5962, "Eta Nor", 240.80375, -49.2297222222222,  4.65},
+{5963, NULL, 240.212916666667, 4.4275,  5.83},
+{5964, NULL, 239.768333333333, 49.8811111111111,  6.05},
+{5965, NULL, 240.664166666667, -29.1358333333333,  6.03},
+{5966, "5    Her", 240.309583333333, 17.8183333333333,  5.12},
+{5967, NULL, 240.850833333333, -38.6025,  4.89},
+{5968, "15Rho CrB", 240.26125, 33.3036111111111,  5.41},
+{5969, NULL, 240.835833333333, -25.8652777777778,  5.00},
+{5970, NULL, 240.892916666667, -32.0005555555556,  6.01},
+{5971, "14Iot CrB", 240.360833333333, 29.8511111111111,  4.99},
+{5972, "44Pi  Ser", 240.57375, 22.8044444444444,  4.83},
+{5973, NULL, 240.977916666667, -24.7263888888889,  6.21},
+{5974, NULL, 241.074166666667, -33.2144444444444,  6.10},
+{5975, NULL, 241.152916666667, -37.8630555555556,  5.90},
+{5976, "43    Ser", 240.940416666667, 4.98666666666667,  6.08},
+{5977, "Xi  Sco", 241.092083333333, -11.3730555555556,  5.07},
+{5978, "Xi  Sco", 241.092083333333, -11.3730555555556,  4.77},
+{5979, NULL, 241.85, -56.1913888888889,  6.16},
+{5980, "Del Nor", 241.6225, -45.1733333333333,  4.72},
+{5981, NULL, 240.522916666667, 52.9158333333333,  5.93},
+{5982, "6Ups Her", 240.699583333333, 46.0366666666667,  4.76},
+{5983, NULL, 240.830833333333, 36.6316666666667,  5.83},
+{5984, "8Bet1Sco", 241.359166666667, -19.8055555555556,  2.62},
+{5985, "8Bet2Sco", 241.360416666667, -19.8019444444444,  4.92},
+{5986, "13The Dra", 240.472083333333, 58.5652777777778,  4.01},
+{5987, "The Lup", 241.647916666667, -36.8022222222222,  4.23},
+{5988, NULL, 241.52625, -23.6063888888889,  5.92},
+{5989, NULL, 241.435416666667, -6.29166666666667,  6.53},
+{5990, NULL, 241.499166666667, -6.13944444444444,  6.41},
+{5991, NULL, 241.818333333333, -36.7555555555556,  5.73},
+{5992, NULL, 241.4075, 8.09611111111111,  6.29},
+{5993, "9Ome1Sco", 241.701666666667, -20.6691666666667,  3.96},
+{5994, "Iot2Nor", 242.3275, -57.9344444444444,  5.57},
+{5995, NULL, 240.78875, 59.4108333333333,  6.19},
+{5996, NULL, 241.764166666667, -14.0708333333333,  6.32},
+{5997, "10Ome2Sco", 241.85125, -20.8686111111111,  4.32},
+{5998, NULL, 241.96625, -24.4619444444444,  6.33},
+{5999, NULL, 242.1425, -39.1052777777778,  7.05},
+{6000, NULL, 242.143333333333, -39.0930555555556,  6.65},
+{6001, NULL, 242.031666666667, -26.3266666666667,  5.38},
+{6002, "11    Sco", 241.901666666667, -12.7455555555556,  5.78},
+{6003, NULL, 242.182083333333, -23.6855555555556,  5.88},
+{6004, "45    Ser", 241.90625, 9.89166666666667,  5.63},
+{6005, NULL, 241.8425, 21.8225,  6.14},
+{6006, NULL, 242.382083333333, -32.6497222222222,  6.19},
+{6007, NULL, 242.469166666667, -33.5458333333333,  5.54},
+{6008, "7Kap Her", 242.01875, 17.0469444444444,  5.00},
+{6009, "7Kap Her", 242.020416666667, 17.0544444444444,  6.25},
+{6010, "47    Ser", 242.116666666667, 8.53416666666667,  5.73},
+{6011, NULL, 242.245416666667, 3.45444444444444,  5.91},
+{6012, NULL, 242.48, -18.3408333333333,  6.47},
+{6013, "8    Her", 242.194166666667, 17.2058333333333,  6.14},
+{6014, NULL, 242.296666666667, 6.37888888888889,  5.97},
+{6015, NULL, 242.82375, -41.1197222222222,  5.86},
+{6016, NULL, 242.460416666667, -3.46694444444444,  5.37},
+{6017, NULL, 242.758333333333, -29.4163888888889,  5.13},
+{6018, "16Tau CrB", 242.242916666667, 36.4908333333333,  4.76},
+{6019, "Zet Nor", 243.344166666667, -55.5408333333333,  5.81},
+{6020, "Del1Aps", 245.086666666667, -78.6958333333333,  4.68},
+{6021, "Del2Aps", 245.111666666667, -78.6672222222222,  5.27},
+{6022, NULL, 243.32, -53.6716666666667,  5.83},
+{6023, "11Phi Her", 242.1925, 44.935,  4.26},
+{6024, "Kap Nor", 243.369583333333, -54.6305555555556,  4.94},
+{6025, NULL, 241.582083333333, 67.8102777777778,  5.44},
+{6026, "14Nu  Sco", 242.994166666667, -19.4497222222222,  6.30},
+{6027, "14Nu  Sco", 242.99875, -19.4605555555556,  4.01},
+{6028, "13    Sco", 243.075833333333, -27.9263888888889,  4.59},
+{6029, "12    Sco", 243.06625, -28.4175,  5.67},
+{6030, "Del TrA", 243.859583333333, -63.6855555555556,  3.85},
+{6031, "15Psi Sco", 243, -10.0641666666667,  4.94},
+{6032, NULL, 242.87375, 9.7125,  6.53},
+{6033, "16    Sco", 243.030416666667, -8.5475,  5.43},
+{6034, NULL, 240.880416666667, 76.7936111111111,  5.56},
+{6035, NULL, 242.869583333333, 16.6655555555556,  6.08},
+{6036, NULL, 242.262083333333, 57.9377777777778,  6.33},
+{6037, NULL, 244.272916666667, -67.9413888888889,  5.75},
+{6038, NULL, 242.358333333333, 55.8288888888889,  6.49},
+{6039, "10    Her", 242.908333333333, 23.4947222222222,  5.70},
+{6040, NULL, 243.957083333333, -57.9122222222222,  5.63},
+{6041, NULL, 243.235416666667, -4.22083333333333,  6.25},
+{6042, NULL, 243.440416666667, -24.4219444444444,  6.41},
+{6043, NULL, 242.915416666667, 33.3425,  6.29},
+{6044, NULL, 243.592916666667, -33.0113888888889,  5.92},
+{6045, "The Nor", 243.81375, -47.3722222222222,  5.14},
+{6046, NULL, 242.95, 36.425,  5.63},
+{6047, "9    Her", 243.314166666667, 5.02111111111111,  5.48},
+{6048, "17Chi Sco", 243.462083333333, -11.8375,  5.22},
+{6049, NULL, 243.85, -42.8997222222222,  6.14},
+{6050, NULL, 242.948333333333, 42.3744444444444,  5.87},
+{6051, NULL, 243.62, -21.1075,  6.41},
+{6052, NULL, 243.18875, 26.6708333333333,  6.50},
+{6053, NULL, 243.662916666667, -18.5352777777778,  6.32},
+{6054, NULL, 243.723333333333, -25.4769444444444,  6.05},
+{6055, NULL, 244.179583333333, -53.8111111111111,  5.44},
+{6056, "1Del Oph", 243.58625, -3.69444444444444,  2.74},
+{6057, NULL, 243.55625, 5.90194444444445,  6.31},
+{6058, "Gam1Nor", 244.25375, -50.0683333333333,  4.99},
+{6059, NULL, 244.337083333333, -53.0866666666667,  6.33},
+{6060, "18    Sco", 243.905416666667, -8.36944444444445,  5.50},
+{6061, NULL, 243.964583333333, -14.8491666666667,  6.09},
+{6062, NULL, 244.71625, -57.8997222222222,  6.49},
+{6063, "17Sig CrB", 243.67, 33.8586111111111,  5.64},
+{6064, "17Sig CrB", 243.67, 33.8583333333333,  6.66},
+{6065, "16    Her", 243.869583333333, 18.8083333333333,  5.69},
+{6066, NULL, 244.245, -21.3038888888889,  6.61},
+{6067, NULL, 244.230416666667, -3.95333333333333,  6.18},
+{6068, NULL, 243.9475, 27.4222222222222,  6.14},
+{6069, NULL, 243.104583333333, 67.1441666666667,  6.21},
+{6070, NULL, 244.574583333333, -28.6138888888889,  4.78},
+{6071, "Lam Nor", 244.82375, -42.6738888888889,  5.45},
+{6072, "Gam2Nor", 244.96, -50.1555555555556,  4.02},
+{6073, NULL, 245.105, -55.14,  5.77},
+{6074, "18Ups CrB", 244.186666666667, 29.1502777777778,  5.78},
+{6075, "2Eps Oph", 244.580416666667, -4.6925,  3.24},
+{6076, NULL, 244.782083333333, -20.2177777777778,  6.29},
+{6077, NULL, 244.88625, -30.9066666666667,  5.49},
+{6078, NULL, 244.751666666667, -14.8725,  5.94},
+{6079, "19    UMi", 242.70625, 75.8775,  5.48},
+{6080, NULL, 245.135833333333, -39.4308333333333,  6.12},
+{6081, "19Omi Sco", 245.159166666667, -24.1694444444444,  4.55},
+{6082, "20    UMi", 243.134166666667, 75.2105555555556,  6.39},
+{6083, NULL, 245.616666666667, -49.5722222222222,  5.33},
+{6084, "20Sig Sco", 245.297083333333, -25.5927777777778,  2.89},
+{6085, NULL, 245.620416666667, -43.9122222222222,  5.88},
+{6086, NULL, 244.31375, 59.755,  5.40},
+{6087, NULL, 245.017916666667, 21.1325,  6.05},
+{6088, NULL, 243.639583333333, 73.395,  5.98},
+{6089, NULL, 246.341666666667, -63.1247222222222,  6.15},
+{6090, NULL, 244.796666666667, 49.0380555555556,  5.91},
+{6091, NULL, 244.979583333333, 39.7086111111111,  5.46},
+{6092, "22Tau Her", 244.935, 46.3133333333333,  3.89},
+{6093, "50Sig Ser", 245.518333333333, 1.02916666666667,  4.82},
+{6094, NULL, 246.005416666667, -39.1930555555556,  5.40},
+{6095, "20Gam Her", 245.48, 19.1530555555556,  3.75},
+{6096, NULL, 245.662083333333, -2.07972222222222,  6.23},
+{6097, NULL, 245.98625, -33.1994444444444,  6.47},
+{6098, "Zet TrA", 247.117083333333, -70.0844444444444,  4.91},
+{6099, NULL, 246.225833333333, -45.3491666666667,  6.33},
+{6100, NULL, 246.132083333333, -37.5658333333333,  5.42},
+{6101, NULL, 244.539166666667, 68.5544444444444,  6.41},
+{6102, "Gam Aps", 248.3625, -78.8972222222222,  3.89},
+{6103, "19Xi  CrB", 245.524166666667, 30.8919444444444,  4.85},
+{6104, "4Psi Oph", 246.025833333333, -20.0375,  4.50},
+{6105, NULL, 246.165, -29.7033333333333,  6.63},
+{6106, NULL, 246.165416666667, -29.7047222222222,  5.84},
+{6107, "20Nu 1CrB", 245.589166666667, 33.7991666666667,  5.20},
+{6108, "21Nu 2CrB", 245.621666666667, 33.7036111111111,  5.39},
+{6109, "Iot TrA", 246.98875, -64.0580555555556,  5.27},
+{6110, NULL, 245.735416666667, 32.3330555555556,  6.40},
+{6111, "21    Her", 246.045, 6.94805555555556,  5.85},
+{6112, "5Rho Oph", 246.396666666667, -23.4472222222222,  5.02},
+{6113, "5Rho Oph", 246.39625, -23.4461111111111,  5.92},
+{6114, NULL, 247.063333333333, -58.5997222222222,  5.69},
+{6115, "Eps Nor", 246.79625, -47.555,  4.47},
+{6116, "21Eta UMi", 244.37625, 75.7552777777778,  4.95},
+{6117, "24Ome Her", 246.354166666667, 14.0333333333333,  4.57},
+{6118, "7Chi Oph", 246.755833333333, -18.4563888888889,  4.42},
+{6119, NULL, 246.44875, 18.8925,  6.7 },
+{6120, NULL, 247.4375, -57.7558333333333,  6.06},
+{6121, NULL, 246.547916666667, 11.4075,  6.11},
+{6122, NULL, 247.06125, -37.1794444444444,  5.79},
+{6123, "25    Her", 246.350833333333, 37.3938888888889,  5.54},
+{6124, NULL, 246.70875, 2.3475,  6.07},
+{6125, NULL, 247.705833333333, -61.6336111111111,  5.20},
+{6126, NULL, 245.452916666667, 69.1094444444444,  5.25},
+{6127, NULL, 246.105416666667, 55.205,  5.74},
+{6128, NULL, 246.93125, -7.59805555555555,  5.23},
+{6129, "3Ups Oph", 246.950416666667, -8.37166666666667,  4.63},
+{6130, NULL, 245.945833333333, 61.6966666666667,  5.67},
+{6131, NULL, 247.42625, -46.2433333333333,  5.35},
+{6132, "14Eta Dra", 245.997916666667, 61.5141666666667,  2.74},
+{6133, NULL, 258.997083333333, -87.5663888888889,  6.57},
+{6134, "21Alp Sco", 247.351666666667, -26.4319444444444,  0.96},
+{6135, NULL, 248.580416666667, -70.9880555555556,  5.50},
+{6136, NULL, 247.141666666667, 0.665,  5.39},
+{6137, NULL, 247.20375, -8.12888888888889,  6.48},
+{6138, NULL, 251.473333333333, -83.2388888888889,  6.57},
+{6139, NULL, 255.24375, -86.3644444444444,  6.04},
+{6140, NULL, 247.445416666667, -14.5508333333333,  5.68},
+{6141, "22    Sco", 247.551666666667, -25.115,  4.79},
+{6142, NULL, 247.92375, -41.8169444444444,  5.33},
+{6143, NULL, 247.845416666667, -34.7044444444444,  4.23},
+{6144, NULL, 247.624583333333, -7.515,  6.50},
+{6145, NULL, 247.845, -26.5377777777778,  6.10},
+{6146, "30    Her", 247.160416666667, 41.8816666666667,  5.04},
+{6147, "8Phi Oph", 247.784583333333, -16.6127777777778,  4.28},
+{6148, "27Bet Her", 247.555, 21.4897222222222,  2.77},
+{6149, "10Lam Oph", 247.728333333333, 1.98388888888889,  3.82},
+{6150, NULL, 247.180833333333, 51.4077777777778,  6.29},
+{6151, "The TrA", 248.936666666667, -65.4952777777778,  5.52},
+{6152, NULL, 247.64, 20.4791666666667,  5.25},
+{6153, "9Ome Oph", 248.034166666667, -21.4663888888889,  4.45},
+{6154, NULL, 247.805833333333, 22.1952777777778,  5.76},
+{6155, "Mu  Nor", 248.520833333333, -44.0452777777778,  4.94},
+{6156, "34    Her", 247.525, 48.9608333333333,  6.45},
+{6157, NULL, 247.761666666667, 35.225,  6.25},
+{6158, "28    Her", 248.14875, 5.52111111111111,  5.63},
+{6159, "29    Her", 248.15125, 11.4880555555556,  4.84},
+{6160, NULL, 248.782916666667, -45.2447222222222,  6.46},
+{6161, "15    Dra", 246.995833333333, 68.7680555555555,  5.00},
+{6162, NULL, 247.947083333333, 45.5983333333333,  5.65},
+{6163, "Bet Aps", 250.769166666667, -77.5175,  4.24},
+{6164, NULL, 249.09375, -42.8588888888889,  5.47},
+{6165, "23Tau Sco", 248.970833333333, -28.2161111111111,  2.82},
+{6166, NULL, 249.09375, -35.2555555555556,  4.16},
+{6167, NULL, 249.719583333333, -60.9902777777778,  6.18},
+{6168, "35Sig Her", 248.525833333333, 42.4369444444444,  4.20},
+{6169, NULL, 248.859583333333, 17.0572222222222,  6.41},
+{6170, NULL, 248.107083333333, 60.8233333333333,  5.94},
+{6171, "12    Oph", 249.089583333333, -2.32472222222222,  5.75},
+{6172, "Eta1TrA", 250.347083333333, -68.2961111111111,  5.91},
+{6173, NULL, 246.429583333333, 78.9638888888889,  5.56},
+{6174, NULL, 249.609166666667, -43.3986111111111,  5.83},
+{6175, "13Zet Oph", 249.289583333333, -10.5672222222222,  2.56},
+{6176, NULL, 249.179166666667, 15.4980555555556,  6.30},
+{6177, NULL, 250.210416666667, -60.4461111111111,  6.18},
+{6178, NULL, 249.771666666667, -37.2175,  5.91},
+{6179, NULL, 249.506666666667, -6.53805555555556,  6.09},
+{6180, NULL, 247.867083333333, 72.6119444444444,  6.30},
+{6181, NULL, 249.45, 13.6869444444444,  6.31},
+{6182, NULL, 250.842083333333, -67.4325,  6.03},
+{6183, NULL, 249.046666666667, 46.6133333333333,  5.79},
+{6184, "16    Dra", 249.047916666667, 52.9002777777778,  5.53},
+{6185, "17    Dra", 249.057083333333, 52.9244444444444,  5.08},
+{6186, "17    Dra", 249.05875, 52.9241666666667,  6.53},
+{6187, NULL, 250.334583333333, -48.7630555555556,  5.65},
+{6188, NULL, 250.4175, -49.6516666666667,  5.65},
+{6189, NULL, 249.912916666667, -9.55444444444445,  6.35},
+{6190, NULL, 250.14375, -20.4086111111111,  6.26},
+{6191, NULL, 247.661666666667, 77.4466666666667,  6.34},
+{6192, NULL, 250.439583333333, -33.1463888888889,  5.87},
+{6193, NULL, 250.400833333333, -24.4680555555556,  6.09},
+{6194, "36    Her", 250.14625, 4.20722222222222,  6.93},
+{6195, "37    Her", 250.16125, 4.21972222222222,  5.77},
+{6196, NULL, 250.393333333333, -17.7422222222222,  4.96},
+{6197, NULL, 250.764166666667, -46.0705555555556,  6.23},
+{6198, NULL, 249.229166666667, 63.0727777777778,  6.16},
+{6199, NULL, 249.501666666667, 56.0155555555556,  5.29},
+{6200, "42    Her", 249.687083333333, 48.9283333333333,  4.90},
+{6201, NULL, 250.297916666667, -1.00055555555556,  6.24},
+{6202, NULL, 250.47375, -19.9244444444444,  5.57},
+{6203, NULL, 250.214166666667, 12.395,  6.08},
+{6204, NULL, 251.666666666667, -67.1097222222222,  5.13},
+{6205, "14    Oph", 250.427083333333, 1.18111111111111,  5.74},
+{6206, NULL, 250.939583333333, -41.1188888888889,  6.20},
+{6207, NULL, 251.165833333333, -53.1525,  5.96},
+{6208, NULL, 250.2525, 24.8586111111111,  6.06},
+{6209, NULL, 250.974583333333, -41.1130555555556,  6.12},
+{6210, NULL, 250.948333333333, -38.1566666666667,  6.05},
+{6211, NULL, 250.91125, -32.1061111111111,  6.46},
+{6212, "40Zet Her", 250.321666666667, 31.6030555555556,  2.81},
+{6213, "39    Her", 250.402916666667, 26.9169444444444,  5.92},
+{6214, NULL, 251.1775, -40.8397222222222,  5.71},
+{6215, NULL, 251.588333333333, -58.5036111111111,  5.74},
+{6216, NULL, 251.072083333333, -27.4561111111111,  6.58},
+{6217, "Alp TrA", 252.16625, -69.0277777777778,  1.92},
+{6218, NULL, 251.250833333333, -28.5097222222222,  6.02},
+{6219, NULL, 251.83125, -58.3413888888889,  5.58},
+{6220, "44Eta Her", 250.724166666667, 38.9222222222222,  3.53},
+{6221, NULL, 251.699166666667, -39.3772222222222,  5.48},
+{6222, NULL, 250.965416666667, 34.0388888888889,  5.99},
+{6223, "18    Dra", 250.229583333333, 64.5891666666667,  4.83},
+{6224, "16    Oph", 251.37375, 1.02027777777778,  6.03},
+{6225, "25    Sco", 251.71375, -25.5286111111111,  6.71},
+{6226, NULL, 250.743333333333, 55.6902777777778,  6.16},
+{6227, NULL, 251.34375, 15.7452777777778,  5.56},
+{6228, "43    Her", 251.457916666667, 8.5825,  5.15},
+{6229, "Eta Ara", 252.44625, -59.0413888888889,  3.76},
+{6230, NULL, 251.29875, 43.2172222222222,  6.05},
+{6231, NULL, 253.0725, -67.6819444444445,  6.32},
+{6232, "19    Oph", 251.790833333333, 2.06444444444444,  6.10},
+{6233, NULL, 252.974583333333, -65.3755555555556,  6.13},
+{6234, "45    Her", 251.943333333333, 5.24666666666667,  5.24},
+{6235, NULL, 252.1125, -14.9094444444444,  6.03},
+{6236, NULL, 252.649583333333, -50.0455555555556,  6.47},
+{6237, NULL, 251.324166666667, 56.7819444444444,  4.85},
+{6238, NULL, 249.470416666667, 78.9183333333333,  6.32},
+{6239, NULL, 252.037083333333, 13.5905555555556,  6.35},
+{6240, NULL, 252.365833333333, -15.6675,  6.10},
+{6241, "26Eps Sco", 252.540833333333, -34.2933333333333,  2.29},
+{6242, NULL, 251.8325, 42.2388888888889,  5.87},
+{6243, "20    Oph", 252.458333333333, -10.7830555555556,  4.65},
+{6244, NULL, 252.749166666667, -37.5144444444444,  6.11},
+{6245, NULL, 252.890416666667, -41.2305555555556,  5.22},
+{6246, NULL, 252.394166666667, 13.2613888888889,  5.91},
+{6247, "Mu 1Sco", 252.9675, -38.0475,  3.08},
+{6248, NULL, 252.592916666667, -2.65388888888889,  6.32},
+{6249, NULL, 253.079583333333, -41.8544444444444,  6.49},
+{6250, "47    Her", 252.580833333333, 7.24777777777778,  5.49},
+{6251, NULL, 253.502083333333, -57.9094444444444,  5.94},
+{6252, "Mu 2Sco", 253.08375, -38.0175,  3.57},
+{6253, NULL, 253.852916666667, -63.2697222222222,  6.02},
+{6254, "52    Her", 252.309166666667, 45.9833333333333,  4.82},
+{6255, "21    Oph", 252.85375, 1.21611111111111,  5.51},
+{6256, NULL, 252.41875, 43.4305555555556,  6.13},
+{6257, NULL, 253.427083333333, -43.0508333333333,  5.96},
+{6258, "50    Her", 252.6625, 29.8066666666667,  5.72},
+{6259, NULL, 252.679583333333, 32.5536111111111,  6.13},
+{6260, NULL, 253.5075, -41.8063888888889,  5.45},
+{6261, NULL, 253.495, -41.9947222222222,  6.32},
+{6262, "Zet1Sco", 253.49875, -42.3622222222222,  4.73},
+{6263, NULL, 253.549166666667, -41.8502777777778,  6.45},
+{6264, NULL, 252.650416666667, 41.8966666666667,  6.29},
+{6265, NULL, 253.581666666667, -41.82,  6.59},
+{6266, NULL, 253.612083333333, -42.4788888888889,  5.88},
+{6267, NULL, 250.775, 77.5141666666667,  5.98},
+{6268, "49    Her", 253.020416666667, 14.9741666666667,  6.52},
+{6269, NULL, 253.355, -20.4155555555556,  5.88},
+{6270, "51    Her", 252.93875, 24.6563888888889,  5.04},
+{6271, "Zet2Sco", 253.645833333333, -42.3613888888889,  3.62},
+{6272, NULL, 253.743333333333, -41.1511111111111,  5.77},
+{6273, NULL, 253.65, -30.5872222222222,  6.35},
+{6274, NULL, 254.037083333333, -50.675,  6.33},
+{6275, NULL, 254.119583333333, -52.2838888888889,  5.94},
+{6276, NULL, 254.890833333333, -69.2683333333333,  5.79},
+{6277, NULL, 253.544166666667, -1.61222222222222,  6.25},
+{6278, NULL, 253.667916666667, -11.7925,  6.57},
+{6279, "53    Her", 253.242083333333, 31.7016666666667,  5.32},
+{6280, "23    Oph", 253.64875, -6.15388888888889,  5.25},
+{6281, "25Iot Oph", 253.502083333333, 10.1652777777778,  4.38},
+{6282, NULL, 253.990833333333, -33.5072222222222,  6.37},
+{6283, NULL, 254.15, -40.8236111111111,  6.15},
+{6284, NULL, 254.0075, -16.8061111111111,  6.37},
+{6285, "Zet Ara", 254.655, -55.9902777777778,  3.13},
+{6286, NULL, 253.323333333333, 47.4169444444444,  6.00},
+{6287, NULL, 253.73, 20.9586111111111,  5.41},
+{6288, "27    Sco", 254.29625, -33.2594444444444,  5.48},
+{6289, NULL, 254.575, -50.6411111111111,  5.55},
+{6290, NULL, 253.816666666667, 13.6197222222222,  6.34},
+{6291, "24    Oph", 254.2, -23.15,  5.58},
+{6292, "56    Her", 253.75875, 25.7305555555556,  6.08},
+{6293, "54    Her", 253.8425, 18.4333333333333,  5.35},
+{6294, NULL, 254.266666666667, -19.54,  6.27},
+{6295, "Eps1Ara", 254.89625, -53.1605555555556,  4.06},
+{6296, NULL, 254.35875, -10.9633333333333,  6.19},
+{6297, NULL, 255.025833333333, -54.5969444444444,  5.65},
+{6298, NULL, 254.718333333333, -37.6211111111111,  6.09},
+{6299, "27Kap Oph", 254.417083333333, 9.375,  3.20},
+{6300, NULL, 255.112916666667, -48.6477777777778,  6.00},
+{6301, NULL, 254.383333333333, 13.8841666666667,  6.37},
+{6302, NULL, 254.673333333333, -14.8697222222222,  6.59},
+{6303, NULL, 255.134583333333, -45.4516666666667,  6.65},
+{6304, NULL, 255.4475, -58.9583333333333,  6.11},
+{6305, "57    Her", 254.379166666667, 25.3527777777778,  6.28},
+{6306, NULL, 254.026666666667, 50.0388888888889,  6.56},
+{6307, NULL, 254.42625, 24.3813888888889,  6.32},
+{6308, NULL, 254.99, -25.0919444444444,  5.86},
+{6310, "26    Oph", 255.039583333333, -24.9891666666667,  5.75},
+{6311, NULL, 255.15375, -35.9341666666667,  5.97},
+{6312, NULL, 255.442083333333, -51.1308333333333,  6.45},
+{6313, NULL, 254.459166666667, 42.5125,  6.34},
+{6314, "Eps2Ara", 255.786666666667, -53.2369444444444,  5.29},
+{6315, "19    Dra", 254.007083333333, 65.1347222222222,  4.89},
+{6316, NULL, 255.469583333333, -32.1436111111111,  5.03},
+{6317, NULL, 255.1225, 6.58361111111111,  6.59},
+{6318, "30    Oph", 255.265, -4.2225,  4.82},
+{6319, "20    Dra", 254.105, 65.0391666666667,  6.41},
+{6320, NULL, 256.102916666667, -57.7122222222222,  5.73},
+{6321, "29    Oph", 255.463333333333, -18.8855555555556,  6.26},
+{6322, "22Eps UMi", 251.492083333333, 82.0372222222222,  4.23},
+{6323, NULL, 255.92375, -47.16,  6.06},
+{6324, "58Eps Her", 255.0725, 30.9263888888889,  3.92},
+{6325, NULL, 255.242083333333, 22.6322222222222,  5.65},
+{6326, NULL, 255.3875, 14.9494444444444,  6.31},
+{6327, NULL, 255.961666666667, -38.1522222222222,  5.91},
+{6328, NULL, 255.29, 27.1963888888889,  6.55},
+{6329, NULL, 255.49625, 8.45055555555555,  6.33},
+{6330, NULL, 254.839583333333, 56.6886111111111,  6.03},
+{6331, NULL, 256.272083333333, -45.5016666666667,  6.28},
+{6332, "59    Her", 255.401666666667, 33.5683333333333,  5.25},
+{6333, NULL, 255.577916666667, 25.5055555555556,  5.75},
+{6334, NULL, 256.205833333333, -34.1227777777778,  4.87},
+{6335, NULL, 254.07, 73.1277777777778,  6.30},
+{6336, NULL, 255.571666666667, 31.8847222222222,  6.36},
+{6337, NULL, 255.7825, 14.0919444444444,  4.98},
+{6338, NULL, 256.4525, -44.105,  6.19},
+{6339, NULL, 255.793333333333, 14.5111111111111,  6.52},
+{6340, NULL, 256.18875, -20.4947222222222,  6.30},
+{6341, NULL, 255.91375, 13.6052777777778,  5.93},
+{6342, NULL, 255.991666666667, 13.5675,  6.08},
+{6343, NULL, 255.969583333333, 19.6905555555556,  6.35},
+{6344, NULL, 256.584583333333, -37.2275,  5.98},
+{6345, NULL, 254.760833333333, 69.1863888888889,  6.40},
+{6346, "61    Her", 255.875833333333, 35.4141666666667,  6.69},
+{6347, NULL, 256.618333333333, -35.4511111111111,  6.13},
+{6348, NULL, 255.319583333333, 60.6491666666667,  6.13},
+{6349, NULL, 256.320416666667, 0.7025,  6.01},
+{6350, NULL, 256.549166666667, -21.5647222222222,  6.30},
+{6351, NULL, 255.972916666667, 34.7902777777778,  6.04},
+{6352, NULL, 256.172083333333, 19.5991666666667,  6.17},
+{6353, NULL, 256.384583333333, -0.891944444444444,  5.64},
+{6354, NULL, 256.721666666667, -26.5130555555556,  6.29},
+{6355, "60    Her", 256.344583333333, 12.7408333333333,  4.91},
+{6356, NULL, 257.52625, -61.6755555555556,  6.39},
+{6357, NULL, 258.0825, -70.7211111111111,  6.22},
+{6358, NULL, 256.540416666667, 9.73333333333333,  6.37},
+{6359, NULL, 256.554583333333, 10.4541666666667,  6.37},
+{6360, NULL, 255.56375, 64.6005555555555,  6.10},
+{6361, NULL, 256.720416666667, -1.65638888888889,  6.38},
+{6362, NULL, 256.270833333333, 43.8122222222222,  6.43},
+{6363, NULL, 256.2075, 48.8041666666667,  6.09},
+{6364, NULL, 256.575416666667, 22.0841666666667,  5.56},
+{6365, NULL, 257.062083333333, -17.6091666666667,  5.99},
+{6366, NULL, 257.197916666667, -30.4036111111111,  5.97},
+{6367, NULL, 257.056666666667, -1.07944444444444,  6.06},
+{6368, NULL, 258.322916666667, -67.1966666666667,  5.89},
+{6369, "21Mu  Dra", 256.3325, 54.4702777777778,  5.83},
+{6370, "21Mu  Dra", 256.332083333333, 54.4702777777778,  5.80},
+{6371, NULL, 257.67625, -44.5575,  5.08},
+{6372, NULL, 257.227083333333, -3.88277777777778,  6.36},
+{6373, NULL, 259.148333333333, -74.5330555555555,  6.25},
+{6374, NULL, 257.912083333333, -48.8741666666667,  5.84},
+{6375, NULL, 257.45, -10.5233333333333,  5.56},
+{6376, NULL, 256.944583333333, 40.5161111111111,  6.34},
+{6377, NULL, 257.008333333333, 35.9352777777778,  5.39},
+{6378, "35Eta Oph", 257.594583333333, -15.7247222222222,  2.43},
+{6379, NULL, 255.4175, 75.2972222222222,  6.21},
+{6380, "Eta Sco", 258.038333333333, -43.2391666666667,  3.33},
+{6381, NULL, 258.0675, -39.5069444444444,  5.67},
+{6382, NULL, 258.06875, -38.8222222222222,  6.30},
+{6383, NULL, 257.07125, 50.8422222222222,  6.46},
+{6384, NULL, 258.555, -56.8883333333333,  6.09},
+{6385, NULL, 257.690833333333, 12.4672222222222,  6.57},
+{6386, NULL, 258.056666666667, -25.2547222222222,  6.54},
+{6387, NULL, 258.104166666667, -27.7619444444444,  6.14},
+{6388, NULL, 257.38875, 40.7772222222222,  5.08},
+{6389, NULL, 258.244583333333, -32.4386111111111,  6.01},
+{6390, NULL, 257.938333333333, 7.89472222222222,  6.33},
+{6391, "63    Her", 257.763333333333, 24.2377777777778,  6.19},
+{6392, NULL, 258.615416666667, -39.7669444444444,  6.60},
+{6393, "37    Oph", 258.115833333333, 10.5852777777778,  5.33},
+{6394, NULL, 258.226666666667, 0.351944444444444,  6.65},
+{6395, NULL, 257.6275, 52.4088888888889,  6.29},
+{6396, "22Zet Dra", 257.196666666667, 65.7147222222222,  3.17},
+{6397, NULL, 258.830416666667, -33.5483333333333,  5.53},
+{6398, NULL, 258.899583333333, -38.5938888888889,  5.96},
+{6399, NULL, 257.9175, 49.7466666666667,  6.04},
+{6400, NULL, 260.053333333333, -70.0455555555556,  6.53},
+{6401, "36    Oph", 258.8375, -26.6027777777778,  5.11},
+{6402, "36    Oph", 258.836666666667, -26.6013888888889,  5.07},
+{6403, NULL, 258.964583333333, -30.2105555555556,  6.21},
+{6404, NULL, 258.834583333333, -14.5838888888889,  5.99},
+{6405, NULL, 259.089583333333, -35.7494444444444,  6.12},
+{6406, "64Alp1Her", 258.662083333333, 14.3902777777778,  3.48},
+{6407, "64Alp2Her", 258.663333333333, 14.39,  5.39},
+{6408, NULL, 259.801666666667, -59.6944444444444,  5.91},
+{6409, NULL, 259.265416666667, -32.6627777777778,  5.55},
+{6410, "65Del Her", 258.757916666667, 24.8391666666667,  3.14},
+{6411, "Iot Aps", 260.524583333333, -70.1233333333333,  5.41},
+{6412, NULL, 259.059166666667, 2.18611111111111,  6.17},
+{6413, NULL, 259.178333333333, -6.245,  6.09},
+{6414, NULL, 259.132083333333, 1.21055555555556,  5.88},
+{6415, "41    Oph", 259.152916666667, -0.445277777777778,  4.73},
+{6416, NULL, 259.763333333333, -46.6338888888889,  5.48},
+{6417, "Zet Aps", 260.4975, -67.7705555555556,  4.78},
+{6418, "67Pi  Her", 258.761666666667, 36.8091666666667,  3.16},
+{6419, NULL, 258.923333333333, 23.7427777777778,  5.96},
+{6420, NULL, 259.7, -44.1297222222222,  5.76},
+{6421, NULL, 258.135833333333, 62.8744444444444,  5.56},
+{6422, NULL, 259.585, -32.5533333333333,  6.36},
+{6423, NULL, 259.87625, -50.0633333333333,  6.27},
+{6424, "39Omi Oph", 259.502916666667, -24.2869444444444,  5.20},
+{6425, "39Omi Oph", 259.502083333333, -24.2841666666667,  6.80},
+{6426, NULL, 259.738333333333, -34.9897222222222,  5.91},
+{6427, NULL, 259.852083333333, -44.2230555555556,  6.65},
+{6428, NULL, 259.58, -16.3119444444444,  6.43},
+{6429, NULL, 262.86375, -80.8591666666667,  5.88},
+{6430, NULL, 259.399583333333, 23.0908333333333,  6.45},
+{6431, "68    Her", 259.33125, 33.1,  4.82},
+{6432, NULL, 259.520833333333, 17.3180555555556,  6.00},
+{6433, NULL, 259.654166666667, 10.8644444444444,  5.03},
+{6434, NULL, 259.72, 6.08527777777778,  6.51},
+{6435, NULL, 259.972083333333, -17.7563888888889,  6.02},
+{6436, "69    Her", 259.417916666667, 37.2916666666667,  4.65},
+{6437, NULL, 259.2025, 49.6911111111111,  7.48},
+{6438, NULL, 260.729166666667, -58.0102777777778,  5.88},
+{6439, NULL, 259.997916666667, -5.91722222222222,  6.32},
+{6440, NULL, 261.004583333333, -62.8641666666667,  5.70},
+{6441, NULL, 260.1425, -19.3327777777778,  6.52},
+{6442, NULL, 260.77875, -56.5252777777778,  5.80},
+{6443, NULL, 259.702083333333, 28.8230555555556,  5.65},
+{6444, NULL, 259.597083333333, 38.8113888888889,  5.94},
+{6445, "40Xi  Oph", 260.250833333333, -21.1127777777778,  4.39},
+{6446, "53Nu  Ser", 260.207083333333, -12.8469444444444,  4.33},
+{6447, NULL, 261.077916666667, -60.6736111111111,  5.77},
+{6448, NULL, 259.1225, 60.6705555555556,  6.32},
+{6449, NULL, 260.219583333333, -10.6961111111111,  6.46},
+{6450, NULL, 260.664166666667, -37.805,  6.41},
+{6451, "Iot Ara", 260.817083333333, -47.4683333333333,  5.25},
+{6452, NULL, 260.07875, 18.0572222222222,  5.00},
+{6453, "42The Oph", 260.5025, -24.9994444444444,  3.27},
+{6454, NULL, 260.658333333333, -35.91,  6.47},
+{6455, NULL, 260.040833333333, 25.5375,  5.38},
+{6456, NULL, 260.72875, -37.2205555555556,  5.93},
+{6457, "70    Her", 260.225833333333, 24.4994444444444,  5.12},
+{6458, "72    Her", 260.165, 32.4677777777778,  5.39},
+{6459, "43    Oph", 260.84, -28.1430555555556,  5.35},
+{6460, NULL, 261.054166666667, -44.1625,  5.12},
+{6461, "Bet Ara", 261.325, -55.53,  2.85},
+{6462, "Gam Ara", 261.348333333333, -56.3775,  3.34},
+{6463, NULL, 260.389166666667, 16.7308333333333,  6.35},
+{6464, "74    Her", 260.087916666667, 46.2408333333333,  5.59},
+{6465, NULL, 260.71375, -2.38833333333333,  6.29},
+{6466, NULL, 260.38, 28.7580555555556,  6.35},
+{6467, NULL, 260.14, 48.1883333333333,  6.43},
+{6468, "Kap Ara", 261.5, -50.6336111111111,  5.23},
+{6469, NULL, 260.431666666667, 39.9744444444444,  5.51},
+{6470, NULL, 261.26125, -34.6963888888889,  6.16},
+{6471, NULL, 262.032083333333, -63.0363888888889,  6.24},
+{6472, NULL, 261.175, -21.4416666666667,  5.85},
+{6473, NULL, 261.154583333333, -18.4458333333333,  6.21},
+{6474, NULL, 261.275833333333, -24.2436111111111,  6.19},
+{6475, NULL, 261.734583333333, -51.9491666666667,  6.19},
+{6476, NULL, 260.99, 8.85277777777778,  5.77},
+{6477, NULL, 261.714583333333, -45.8436111111111,  5.29},
+{6478, NULL, 261.801666666667, -50.6302777777778,  5.92},
+{6479, NULL, 260.439166666667, 53.4205555555556,  5.67},
+{6480, "73    Her", 261.0275, 22.9602777777778,  5.74},
+{6481, NULL, 261.13125, 16.3011111111111,  5.71},
+{6482, NULL, 261.140833333333, 15.6061111111111,  6.35},
+{6483, NULL, 261.99, -52.2972222222222,  5.75},
+{6484, "75Rho Her", 260.919583333333, 37.1466666666667,  5.47},
+{6485, "75Rho Her", 260.920833333333, 37.1458333333333,  4.52},
+{6486, "44    Oph", 261.5925, -24.1752777777778,  4.17},
+{6487, NULL, 262.16125, -55.1697222222222,  5.94},
+{6488, NULL, 261.009166666667, 38.5827777777778,  6.49},
+{6489, NULL, 261.49125, -1.65166666666667,  6.44},
+{6490, NULL, 261.73, -25.9433333333333,  6.44},
+{6491, NULL, 261.112916666667, 36.9519444444445,  6.28},
+{6492, "45    Oph", 261.83875, -29.8669444444444,  4.29},
+{6493, NULL, 261.657916666667, -5.08666666666667,  4.54},
+{6494, NULL, 261.90625, -29.7244444444444,  6.00},
+{6495, NULL, 261.476666666667, 16.9175,  5.98},
+{6496, NULL, 261.75875, -12.5125,  6.21},
+{6497, NULL, 261.579166666667, 7.59555555555556,  6.06},
+{6498, "49Sig Oph", 261.62875, 4.14027777777778,  4.34},
+{6499, NULL, 261.50375, 26.8788888888889,  6.41},
+{6500, "Del Ara", 262.774583333333, -60.6838888888889,  3.62},
+{6501, NULL, 262.23375, -36.7783333333333,  6.02},
+{6502, NULL, 261.704583333333, 20.0808333333333,  5.54},
+{6503, NULL, 262.357083333333, -38.5166666666667,  6.39},
+{6504, NULL, 262.009583333333, -8.20833333333333,  6.37},
+{6505, NULL, 262.845833333333, -56.9205555555556,  5.95},
+{6506, NULL, 261.6925, 34.6958333333333,  5.94},
+{6507, NULL, 262.207083333333, 0.330555555555556,  5.44},
+{6508, "34Ups Sco", 262.690833333333, -37.2958333333333,  2.69},
+{6509, "77    Her", 261.684166666667, 48.26,  5.85},
+{6510, "Alp Ara", 262.960416666667, -49.8761111111111,  2.95},
+{6511, NULL, 261.422083333333, 60.0483333333333,  5.65},
+{6512, NULL, 262.4475, -5.91972222222222,  6.37},
+{6513, NULL, 262.954583333333, -46.0363888888889,  6.03},
+{6514, NULL, 261.520416666667, 58.6519444444444,  6.51},
+{6516, NULL, 262.599166666667, -1.0625,  5.31},
+{6517, NULL, 262.9475, -33.7027777777778,  6.44},
+{6518, NULL, 261.250833333333, 67.3063888888889,  6.43},
+{6519, "51    Oph", 262.854166666667, -23.9627777777778,  4.81},
+{6520, NULL, 262.935, -26.2697222222222,  6.05},
+{6521, NULL, 262.593333333333, 11.925,  6.39},
+{6522, NULL, 263.102083333333, -34.2797222222222,  6.17},
+{6523, NULL, 263.280833333333, -41.1736111111111,  5.84},
+{6524, NULL, 262.83875, 2.72444444444444,  5.59},
+{6525, NULL, 263.895416666667, -59.8461111111111,  6.28},
+{6526, "76Lam Her", 262.684583333333, 26.1105555555556,  4.41},
+{6527, "35Lam Sco", 263.402083333333, -37.1038888888889,  1.63},
+{6528, NULL, 262.730833333333, 31.1583333333333,  5.61},
+{6529, NULL, 259.904166666667, 80.1363888888889,  5.72},
+{6530, NULL, 263.833333333333, -53.3527777777778,  6.10},
+{6531, NULL, 262.667916666667, 38.8822222222222,  6.43},
+{6532, NULL, 263.0625, 11.9302777777778,  6.42},
+{6533, "78    Her", 262.956666666667, 28.4075,  5.62},
+{6534, NULL, 263.374583333333, -5.74472222222222,  5.62},
+{6535, NULL, 263.677083333333, -32.5816666666667,  5.70},
+{6536, "23Bet Dra", 262.608333333333, 52.3013888888889,  2.79},
+{6537, "1Sig Ara", 263.915, -46.5055555555556,  4.59},
+{6538, NULL, 263.004583333333, 34.2708333333333,  6.56},
+{6539, NULL, 263.929166666667, -37.44,  6.48},
+{6540, NULL, 262.6825, 57.8763888888889,  6.40},
+{6541, NULL, 263.345, 19.2566666666667,  5.64},
+{6542, NULL, 263.414166666667, 16.3175,  5.69},
+{6543, NULL, 263.428333333333, 14.8416666666667,  6.48},
+{6544, NULL, 263.693333333333, -11.2419444444444,  5.55},
+{6545, "52    Oph", 263.827083333333, -22.0438888888889,  6.57},
+{6546, NULL, 264.136666666667, -38.6352777777778,  4.29},
+{6547, NULL, 264.363333333333, -50.06,  5.93},
+{6548, "53    Oph", 263.652916666667, 9.58666666666667,  5.81},
+{6549, "Pi  Ara", 264.523333333333, -54.5002777777778,  5.25},
+{6550, NULL, 263.280416666667, 41.2436111111111,  5.74},
+{6551, NULL, 263.613333333333, 16.5038888888889,  6.40},
+{6552, NULL, 270.392083333333, -85.2147222222222,  6.45},
+{6553, "The Sco", 264.33, -42.9977777777778,  1.87},
+{6554, "24Nu 1Dra", 263.044166666667, 55.1841666666667,  4.88},
+{6555, "25Nu 2Dra", 263.066666666667, 55.1730555555555,  4.87},
+{6556, "55Alp Oph", 263.73375, 12.56,  2.08},
+{6557, NULL, 264.361666666667, -38.0655555555556,  6.26},
+{6558, NULL, 264.535416666667, -42.8805555555556,  6.10},
+{6559, NULL, 263.998333333333, 20.9961111111111,  6.10},
+{6560, NULL, 263.382083333333, 57.5588888888889,  6.17},
+{6561, "55Xi  Ser", 264.396666666667, -15.3986111111111,  3.54},
+{6562, NULL, 264.400833333333, -15.5711111111111,  5.94},
+{6563, NULL, 263.926666666667, 37.3016666666667,  6.10},
+{6564, NULL, 264.032916666667, 28.1847222222222,  6.38},
+{6565, NULL, 266.082083333333, -72.2208333333333,  6.49},
+{6566, "27    Dra", 262.99125, 68.135,  5.05},
+{6567, "57Mu  Oph", 264.46125, -8.11888888888889,  4.62},
+{6568, NULL, 264.539583333333, -10.9263888888889,  5.75},
+{6569, "Lam Ara", 265.098333333333, -49.4155555555556,  4.77},
+{6570, NULL, 264.152916666667, 30.7852777777778,  6.02},
+{6571, "79    Her", 264.379583333333, 24.31,  5.77},
+{6572, NULL, 265.317916666667, -46.9219444444444,  5.79},
+{6573, "26    Dra", 263.747916666667, 61.875,  5.23},
+{6574, "82    Her", 264.156666666667, 48.5855555555556,  5.37},
+{6575, NULL, 264.785416666667, 2.02805555555556,  6.26},
+{6576, NULL, 265.51625, -50.5105555555556,  6.24},
+{6577, NULL, 264.740833333333, 13.3291666666667,  6.12},
+{6578, NULL, 265.049166666667, -2.1525,  6.19},
+{6579, NULL, 264.707083333333, 32.7394444444444,  6.37},
+{6580, "Kap Sco", 265.622083333333, -39.03,  2.41},
+{6581, "56Omi Ser", 265.35375, -12.8752777777778,  4.26},
+{6582, "Eta Pav", 266.433333333333, -64.7238888888889,  3.62},
+{6583, NULL, 265.7125, -36.9458333333333,  5.54},
+{6584, NULL, 264.989583333333, 31.2025,  6.03},
+{6585, "Mu  Ara", 266.03625, -51.8341666666667,  5.15},
+{6586, NULL, 266.2325, -57.5452777777778,  6.01},
+{6587, NULL, 265.77875, -33.0511111111111,  6.40},
+{6588, "85Iot Her", 264.86625, 46.0063888888889,  3.80},
+{6589, NULL, 265.295833333333, 15.1780555555556,  6.34},
+{6590, NULL, 265.384583333333, 6.31277777777778,  5.95},
+{6591, NULL, 265.171666666667, 31.2875,  6.28},
+{6592, NULL, 265.272916666667, 24.5133333333333,  6.36},
+{6593, NULL, 265.824166666667, -27.8841666666667,  6.36},
+{6594, NULL, 265.494583333333, 15.9519444444444,  5.52},
+{6595, "58    Oph", 265.8575, -21.6833333333333,  4.87},
+{6596, "28Ome Dra", 264.237916666667, 68.7580555555556,  4.80},
+{6597, NULL, 266.175, -42.7288888888889,  5.87},
+{6598, NULL, 264.165416666667, 69.5708333333333,  6.42},
+{6599, NULL, 265.156666666667, 43.4708333333333,  6.59},
+{6600, NULL, 265.9525, -13.5086111111111,  6.39},
+{6601, NULL, 265.945833333333, -7.07944444444444,  6.30},
+{6602, "83    Her", 265.618333333333, 24.5641666666667,  5.52},
+{6603, "60Bet Oph", 265.868333333333, 4.56722222222222,  2.77},
+{6604, NULL, 265.841666666667, 14.295,  6.24},
+{6605, NULL, 265.150833333333, 57.3102777777778,  6.77},
+{6606, NULL, 264.286666666667, 72.4558333333333,  5.86},
+{6607, NULL, 265.340833333333, 51.8180555555556,  5.99},
+{6608, "84    Her", 265.84, 24.3277777777778,  5.71},
+{6609, "61    Oph", 266.141666666667, 2.57944444444444,  6.17},
+{6610, NULL, 266.1475, 2.57888888888889,  6.56},
+{6611, NULL, 266.072083333333, 14.4102777777778,  6.19},
+{6612, NULL, 265.773333333333, 44.0844444444444,  6.34},
+{6613, NULL, 266.780416666667, -38.1116666666667,  6.43},
+{6614, NULL, 267.15875, -55.4016666666667,  6.11},
+{6615, "Iot1Sco", 266.89625, -40.1269444444444,  3.03},
+{6616, "3    Sgr", 266.89, -27.8308333333333,  4.54},
+{6617, NULL, 266.94, -22.4780555555556,  6.18},
+{6618, NULL, 265.997083333333, 53.8016666666667,  5.75},
+{6619, NULL, 266.417916666667, 31.5047222222222,  6.23},
+{6620, NULL, 266.903333333333, -14.7258333333333,  5.94},
+{6621, NULL, 267.115833333333, -26.975,  6.35},
+{6622, NULL, 267.6175, -53.6122222222222,  5.92},
+{6623, "86Mu  Her", 266.614583333333, 27.7205555555556,  3.42},
+{6624, NULL, 267.897916666667, -60.1644444444444,  5.78},
+{6625, NULL, 266.47375, 38.8813888888889,  6.52},
+{6626, NULL, 266.49375, 39.3225,  6.68},
+{6627, NULL, 266.783333333333, 17.6972222222222,  5.72},
+{6628, NULL, 267.29375, -31.7033333333333,  4.83},
+{6629, "62Gam Oph", 266.973333333333, 2.70722222222222,  3.75},
+{6630, NULL, 267.464583333333, -37.0433333333333,  3.21},
+{6631, "Iot2Sco", 267.546666666667, -40.0905555555556,  4.81},
+{6632, NULL, 267.795833333333, -53.1305555555556,  6.09},
+{6633, NULL, 267.084166666667, 3.80416666666667,  6.22},
+{6634, NULL, 268.326666666667, -65.4891666666667,  6.49},
+{6635, NULL, 269.424166666667, -76.1775,  6.07},
+{6636, "31Psi1Dra", 265.484583333333, 72.1488888888889,  4.58},
+{6637, "31Psi1Dra", 265.491666666667, 72.1569444444444,  5.79},
+{6638, NULL, 267.103333333333, 20.5655555555556,  5.69},
+{6639, NULL, 267.32875, 1.96111111111111,  6.47},
+{6640, NULL, 267.935416666667, -45.6005555555556,  6.11},
+{6641, NULL, 266.78375, 47.6122222222222,  6.43},
+{6642, NULL, 267.199583333333, 19.2552777777778,  6.12},
+{6643, NULL, 267.886666666667, -40.7725,  5.96},
+{6644, "87    Her", 267.205, 25.6227777777778,  5.12},
+{6645, NULL, 267.802083333333, -30.5572222222222,  6.66},
+{6646, NULL, 271.36125, -81.4863888888889,  6.35},
+{6647, NULL, 268.056666666667, -34.7991666666667,  5.90},
+{6648, NULL, 268.082083333333, -34.4166666666667,  5.84},
+{6649, NULL, 268.219583333333, -41.9966666666667,  6.20},
+{6650, NULL, 267.68125, 11.9466666666667,  6.17},
+{6651, NULL, 268.205, -34.1141666666667,  6.06},
+{6652, NULL, 268.232916666667, -35.0186111111111,  6.45},
+{6653, NULL, 268.24125, -35.6241666666667,  6.03},
+{6654, NULL, 267.595416666667, 29.3222222222222,  5.50},
+{6655, NULL, 267.701666666667, 22.3163888888889,  5.98},
+{6656, "30    Dra", 267.267916666667, 50.7811111111111,  5.02},
+{6657, NULL, 268.331666666667, -34.7305555555556,  6.17},
+{6658, NULL, 268.347083333333, -34.8952777777778,  5.60},
+{6659, NULL, 267.997916666667, -1.23666666666667,  6.35},
+{6660, NULL, 268.439583333333, -34.7858333333333,  6.38},
+{6661, NULL, 268.161666666667, -6.14361111111111,  6.21},
+{6662, NULL, 268.47875, -34.7525,  5.96},
+{6663, NULL, 268.492083333333, -34.8316666666667,  6.42},
+{6664, "88    Her", 267.51375, 48.3941666666667,  6.68},
+{6665, NULL, 267.99375, 15.3258333333333,  6.46},
+{6666, NULL, 268.265, -10.8997222222222,  6.18},
+{6667, NULL, 268.1475, 1.305,  5.95},
+{6668, NULL, 268.613333333333, -34.4663888888889,  5.96},
+{6669, NULL, 267.808333333333, 40.0725,  6.46},
+{6670, NULL, 268.309166666667, 6.10138888888889,  5.77},
+{6671, NULL, 268.782916666667, -36.4758333333333,  6.06},
+{6672, NULL, 268.725, -24.8872222222222,  6.20},
+{6673, NULL, 268.019583333333, 39.9822222222222,  6.04},
+{6674, NULL, 268.004166666667, 46.6433333333333,  6.38},
+{6675, NULL, 269.1975, -44.3422222222222,  4.86},
+{6676, NULL, 268.559166666667, 11.1305555555556,  6.38},
+{6677, "90    Her", 268.325416666667, 40.0080555555556,  5.16},
+{6678, NULL, 269.2325, -40.3055555555556,  6.43},
+{6679, NULL, 268.979166666667, -18.8022222222222,  6.52},
+{6680, NULL, 269.174583333333, -28.0652777777778,  5.80},
+{6681, NULL, 269.079166666667, -15.8125,  5.89},
+{6682, NULL, 269.44875, -41.7161111111111,  4.88},
+{6683, NULL, 269.490833333333, -39.1369444444444,  6.29},
+{6684, NULL, 269.076666666667, 0.670277777777778,  5.82},
+{6685, "89    Her", 268.855, 26.05,  5.46},
+{6686, NULL, 269.19875, -4.08194444444444,  5.47},
+{6687, NULL, 268.961666666667, 22.4641666666667,  5.58},
+{6688, "32Xi  Dra", 268.382083333333, 56.8727777777778,  3.75},
+{6689, NULL, 269.267916666667, 0.0663888888888889,  5.97},
+{6690, NULL, 269.233333333333, 6.48777777777778,  6.29},
+{6691, NULL, 269.731666666667, -36.8583333333333,  5.74},
+{6692, NULL, 269.662916666667, -28.7591666666667,  6.01},
+{6693, NULL, 269.771666666667, -30.2530555555556,  5.16},
+{6694, NULL, 269.772916666667, -30.2533333333333,  7.04},
+{6695, "91The Her", 269.063333333333, 37.2505555555556,  3.86},
+{6696, NULL, 269.362083333333, 11.0441666666667,  6.36},
+{6697, NULL, 269.309583333333, 23.9958333333333,  6.30},
+{6698, "64Nu  Oph", 269.756666666667, -9.77361111111111,  3.34},
+{6699, NULL, 268.84875, 55.9713888888889,  6.10},
+{6700, "4    Sgr", 269.948333333333, -23.8161111111111,  4.76},
+{6701, "35    Dra", 267.3625, 76.9627777777778,  5.04},
+{6702, NULL, 269.201666666667, 45.3508333333333,  6.02},
+{6703, "92Xi  Her", 269.44125, 29.2477777777778,  3.70},
+{6704, NULL, 270.000416666667, -20.3391666666667,  6.21},
+{6705, "33Gam Dra", 269.151666666667, 51.4888888888889,  2.23},
+{6706, NULL, 269.902916666667, -4.82138888888889,  5.87},
+{6707, "94Nu  Her", 269.625833333333, 30.1894444444444,  4.41},
+{6708, NULL, 270.45125, -36.3777777777778,  6.30},
+{6709, NULL, 270.064583333333, 0.629444444444444,  6.37},
+{6710, "57Zet Ser", 270.120833333333, -3.69027777777778,  4.62},
+{6711, NULL, 269.67625, 36.2877777777778,  6.00},
+{6712, "66    Oph", 270.065833333333, 4.36861111111111,  4.64},
+{6713, "93    Her", 270.014166666667, 16.7508333333333,  4.67},
+{6714, "67    Oph", 270.16125, 2.93166666666667,  3.97},
+{6715, "6    Sgr", 270.34625, -17.1569444444444,  6.28},
+{6716, NULL, 270.476666666667, -22.7805555555556,  5.77},
+{6717, NULL, 267.54375, 78.3066666666667,  6.24},
+{6718, NULL, 269.717916666667, 45.4761111111111,  6.48},
+{6719, NULL, 270.220416666667, 6.26833333333333,  6.34},
+{6720, NULL, 270.115416666667, 19.5058333333333,  6.50},
+{6721, "Chi Oct", 283.695416666667, -87.6058333333333,  5.28},
+{6722, NULL, 270.238333333333, 15.0933333333333,  6.26},
+{6723, "68    Oph", 270.438333333333, 1.30527777777778,  4.45},
+{6724, "7    Sgr", 270.712916666667, -24.2822222222222,  5.34},
+{6725, "34Psi2Dra", 268.796666666667, 72.005,  5.45},
+{6726, NULL, 270.151666666667, 33.2138888888889,  5.99},
+{6727, NULL, 270.757083333333, -22.7183333333333,  6.74},
+{6728, NULL, 269.984166666667, 45.5013888888889,  5.67},
+{6729, "95    Her", 270.374583333333, 21.5952777777778,  5.18},
+{6730, "95    Her", 270.376666666667, 21.5955555555556,  4.96},
+{6731, NULL, 272.815416666667, -75.8913888888889,  5.86},
+{6732, NULL, 270.692916666667, -5.35861111111111,  6.76},
+{6733, "69Tau Oph", 270.770833333333, -8.18027777777778,  5.94},
+{6734, "69Tau Oph", 270.770416666667, -8.18055555555556,  5.24},
+{6735, NULL, 268.610833333333, 75.1708333333333,  6.36},
+{6736, "9    Sgr", 270.968333333333, -24.3605555555556,  5.97},
+{6737, NULL, 270.399583333333, 33.3113888888889,  6.15},
+{6738, "96    Her", 270.59625, 20.8336111111111,  5.28},
+{6739, NULL, 271.21, -35.9013888888889,  6.00},
+{6740, NULL, 271.95125, -64.55,  6.41},
+{6741, "97    Her", 270.625416666667, 22.9230555555556,  6.21},
+{6742, "Gam1Sgr", 271.255416666667, -29.58,  4.69},
+{6743, "The Ara", 271.657916666667, -50.0916666666667,  3.66},
+{6744, NULL, 270.81125, 19.6130555555556,  6.50},
+{6745, "Pi  Pav", 272.145, -63.6683333333333,  4.35},
+{6746, "10Gam2Sgr", 271.452083333333, -30.4241666666667,  2.99},
+{6747, NULL, 271.155416666667, 1.91916666666667,  6.14},
+{6748, NULL, 271.59875, -36.0197222222222,  5.95},
+{6749, NULL, 271.7075, -43.4247222222222,  5.77},
+{6750, NULL, 271.7075, -43.4247222222222,  5.77},
+{6751, NULL, 273.14375, -73.6716666666667,  5.85},
+{6752, "70    Oph", 271.36375, 2.49944444444444,  4.03},
+{6753, NULL, 270.7875, 48.4644444444444,  6.21},
+{6754, NULL, 271.1675, 23.9425,  6.34},
+{6755, NULL, 271.530833333333, -8.32388888888889,  5.85},
+{6756, NULL, 271.563333333333, -4.75138888888889,  5.77},
+{6757, NULL, 271.530833333333, -0.446666666666667,  6.34},
+{6758, NULL, 271.430416666667, 12.0038888888889,  7.04},
+{6759, NULL, 272.125416666667, -45.7672222222222,  6.15},
+{6760, NULL, 272.49, -59.04,  6.38},
+{6761, "Iot Pav", 272.60875, -62.0022222222222,  5.49},
+{6762, NULL, 271.7975, -21.4438888888889,  6.28},
+{6763, NULL, 271.375833333333, 21.6469444444444,  6.15},
+{6764, NULL, 271.18, 40.0841666666667,  6.52},
+{6765, "98    Her", 271.507916666667, 22.2188888888889,  5.06},
+{6766, NULL, 272.020833333333, -28.4572222222222,  4.57},
+{6767, NULL, 271.253333333333, 41.9466666666667,  6.34},
+{6768, NULL, 271.456666666667, 32.2305555555556,  5.71},
+{6769, NULL, 271.951666666667, -17.1541666666667,  5.52},
+{6770, "71    Oph", 271.826666666667, 8.73388888888889,  4.64},
+{6771, "72    Oph", 271.8375, 9.56388888888889,  3.73},
+{6772, NULL, 272.343333333333, -36.6725,  6.58},
+{6773, NULL, 272.225416666667, -25.4725,  6.61},
+{6774, NULL, 273.600416666667, -70.7513888888889,  6.73},
+{6775, "99    Her", 271.75625, 30.5619444444444,  5.04},
+{6776, NULL, 271.951666666667, 13.0711111111111,  6.63},
+{6777, NULL, 272.499583333333, -32.7197222222222,  6.43},
+{6778, NULL, 272.76875, -47.5130555555556,  6.07},
+{6779, "103Omi Her", 271.885833333333, 28.7625,  3.83},
+{6780, NULL, 272.52375, -30.7286111111111,  5.53},
+{6781, "100    Her", 271.95625, 26.1013888888889,  5.86},
+{6782, "100    Her", 271.95625, 26.0975,  5.90},
+{6783, "Eps Tel", 272.8075, -45.9544444444444,  4.53},
+{6784, NULL, 272.140416666667, 14.2847222222222,  6.37},
+{6785, NULL, 272.430833333333, -13.9344444444444,  6.39},
+{6786, NULL, 272.773333333333, -41.3591666666667,  5.86},
+{6787, "102    Her", 272.189583333333, 20.8144444444444,  4.36},
+{6788, NULL, 272.73, -33.7997222222222,  6.16},
+{6789, "23Del UMi", 263.05375, 86.5863888888889,  4.36},
+{6790, NULL, 271.722916666667, 50.8227777777778,  6.29},
+{6791, NULL, 271.87, 43.4616666666667,  5.00},
+{6792, NULL, 271.77625, 49.7105555555556,  6.32},
+{6793, NULL, 272.009166666667, 36.4013888888889,  5.48},
+{6794, "101    Her", 272.220416666667, 20.0452777777778,  5.10},
+{6795, "73    Oph", 272.390833333333, 3.99333333333333,  5.73},
+{6796, NULL, 273.5675, -63.6894444444444,  6.47},
+{6797, NULL, 272.475, 3.11972222222222,  5.69},
+{6798, NULL, 272.811666666667, -19.8422222222222,  6.36},
+{6799, NULL, 272.2925, 30.4694444444444,  6.38},
+{6800, NULL, 272.667916666667, 3.32416666666667,  5.51},
+{6801, "11    Sgr", 272.930833333333, -23.7011111111111,  4.98},
+{6802, NULL, 272.9925, -28.9013888888889,  6.51},
+{6803, NULL, 272.53625, 16.4766666666667,  6.09},
+{6804, NULL, 273.3025, -41.3361111111111,  5.47},
+{6805, NULL, 273.920416666667, -63.0555555555556,  5.60},
+{6806, NULL, 272.40625, 38.4575,  6.40},
+{6807, NULL, 272.495833333333, 36.4663888888889,  5.58},
+{6808, NULL, 274.50375, -68.2291666666667,  6.33},
+{6809, "40    Dra", 270.014166666667, 80.0008333333333,  6.04},
+{6810, "41    Dra", 270.038333333333, 80.0041666666667,  5.68},
+{6811, "24    UMi", 262.7, 86.9680555555556,  5.79},
+{6812, "13Mu  Sgr", 273.440833333333, -21.0588888888889,  3.86},
+{6813, NULL, 273.291666666667, -4.01166666666667,  6.59},
+{6814, NULL, 272.937916666667, 33.4469444444444,  5.88},
+{6815, "104    Her", 272.975833333333, 31.4052777777778,  4.97},
+{6816, "14    Sgr", 273.56625, -21.7130555555556,  5.44},
+{6817, NULL, 272.631666666667, 54.2866666666667,  5.95},
+{6818, NULL, 273.969583333333, -44.2066666666667,  5.46},
+{6819, NULL, 274.28125, -56.0233333333333,  5.33},
+{6820, NULL, 273.31875, 21.8802777777778,  6.12},
+{6821, NULL, 274.25375, -51.0683333333333,  6.06},
+{6822, "15    Sgr", 273.80375, -20.7283333333333,  5.38},
+{6823, "16    Sgr", 273.80375, -20.3880555555556,  5.95},
+{6824, NULL, 273.1775, 41.1469444444444,  6.36},
+{6825, NULL, 273.878333333333, -18.6613888888889,  6.07},
+{6826, NULL, 273.27, 38.7736111111111,  6.04},
+{6827, NULL, 272.779583333333, 60.4094444444444,  6.49},
+{6828, NULL, 274.9175, -63.8869444444444,  6.18},
+{6829, "Phi Oct", 275.900416666667, -75.0441666666667,  5.47},
+{6830, NULL, 273.991666666667, -3.6175,  6.36},
+{6831, NULL, 273.683333333333, 29.2072222222222,  6.56},
+{6832, "Eta Sgr", 274.406666666667, -36.7616666666667,  3.11},
+{6833, NULL, 274.400416666667, -34.1072222222222,  6.16},
+{6834, NULL, 274.023333333333, 2.37777777777778,  6.01},
+{6835, NULL, 274.35, -28.6525,  6.19},
+{6836, NULL, 274.34875, -28.2891666666667,  6.40},
+{6837, NULL, 277.33125, -80.2327777777778,  5.95},
+{6838, NULL, 274.298333333333, -17.3738888888889,  5.75},
+{6839, NULL, 274.666666666667, -42.2883333333333,  6.30},
+{6840, NULL, 274.22125, -3.00722222222222,  6.00},
+{6841, NULL, 274.36875, -18.4633333333333,  6.54},
+{6842, NULL, 274.513333333333, -27.0425,  4.65},
+{6843, NULL, 274.350833333333, -9.75861111111111,  6.31},
+{6844, NULL, 274.27, 1.00583333333333,  6.63},
+{6845, NULL, 273.911666666667, 42.1594444444444,  5.59},
+{6846, NULL, 274.67375, -25.6047222222222,  6.51},
+{6847, NULL, 273.885833333333, 45.2094444444445,  6.29},
+{6848, NULL, 274.680416666667, -18.6194444444444,  6.84},
+{6849, NULL, 273.67125, 56.5883333333333,  6.37},
+{6850, "36    Dra", 273.474166666667, 64.3972222222222,  5.03},
+{6851, NULL, 274.512083333333, 13.7769444444444,  6.30},
+{6852, NULL, 274.532083333333, 18.1313888888889,  5.99},
+{6853, NULL, 274.278333333333, 40.9366666666667,  6.11},
+{6854, NULL, 274.532083333333, 23.2966666666667,  6.63},
+{6855, "Xi  Pav", 275.806666666667, -61.4938888888889,  4.36},
+{6856, NULL, 275.230416666667, -37.4875,  6.45},
+{6857, NULL, 274.789583333333, 7.25972222222222,  5.39},
+{6858, NULL, 275.036666666667, -15.8316666666667,  5.39},
+{6859, "19Del Sgr", 275.24875, -29.8280555555556,  2.70},
+{6860, "105    Her", 274.794583333333, 24.4461111111111,  5.27},
+{6861, NULL, 275.380833333333, -24.915,  6.25},
+{6862, NULL, 275.5775, -38.6569444444444,  5.10},
+{6863, NULL, 275.34625, -18.86,  5.75},
+{6864, NULL, 275.500833333333, -28.43,  6.16},
+{6865, "37    Dra", 273.820833333333, 68.7558333333333,  5.95},
+{6866, "74    Oph", 275.217083333333, 3.37722222222222,  4.86},
+{6867, NULL, 274.967083333333, 29.6661111111111,  5.99},
+{6868, "106    Her", 275.074583333333, 21.9613888888889,  4.95},
+{6869, "58Eta Ser", 275.3275, -2.89888888888889,  3.26},
+{6870, NULL, 275.72125, -36.6694444444444,  5.34},
+{6871, NULL, 276.38125, -63.0213888888889,  6.14},
+{6872, "1Kap Lyr", 274.965416666667, 36.0644444444444,  4.33},
+{6873, NULL, 275.36875, 5.43583333333333,  6.13},
+{6874, NULL, 275.870416666667, -36.2383333333333,  5.55},
+{6875, NULL, 276.075833333333, -44.1102777777778,  5.25},
+{6876, "108    Her", 275.237916666667, 29.8588888888889,  5.63},
+{6877, "107    Her", 275.254166666667, 28.87,  5.12},
+{6878, NULL, 275.759166666667, -10.2186111111111,  6.33},
+{6879, "20Eps Sgr", 276.042916666667, -34.3847222222222,  1.85},
+{6880, NULL, 274.98375, 51.3477777777778,  6.30},
+{6881, NULL, 275.800833333333, -12.0147222222222,  5.73},
+{6882, NULL, 275.53625, 23.2852777777778,  5.41},
+{6883, NULL, 275.647083333333, 12.0288888888889,  5.89},
+{6884, "Zet Sct", 275.914583333333, -8.93416666666667,  4.68},
+{6885, NULL, 275.704166666667, 17.8266666666667,  5.25},
+{6886, NULL, 275.279583333333, 49.7255555555556,  6.40},
+{6887, NULL, 275.762083333333, 16.6880555555556,  6.22},
+{6888, "18    Sgr", 276.25625, -30.7566666666667,  5.60},
+{6889, NULL, 276.340416666667, -35.9916666666667,  6.15},
+{6890, NULL, 276.014583333333, -3.58333333333333,  6.38},
+{6891, NULL, 275.38625, 49.1216666666667,  5.05},
+{6892, NULL, 276.175416666667, -7.07527777777778,  6.31},
+{6893, NULL, 276.4775, -33.9452777777778,  6.30},
+{6894, NULL, 276.724583333333, -48.1169444444444,  5.46},
+{6895, "109    Her", 275.924583333333, 21.7697222222222,  3.84},
+{6896, "21    Sgr", 276.3375, -20.5416666666667,  4.81},
+{6897, "Alp Tel", 276.743333333333, -45.9683333333333,  3.51},
+{6898, NULL, 276.2375, -1.57944444444444,  6.15},
+{6899, NULL, 278.230416666667, -73.9655555555556,  5.89},
+{6900, NULL, 276.286666666667, 5.08472222222222,  6.74},
+{6901, NULL, 275.989166666667, 38.7391666666667,  6.36},
+{6902, NULL, 276.411666666667, 8.03194444444444,  5.65},
+{6903, "2Mu  Lyr", 276.0575, 39.5072222222222,  5.12},
+{6904, NULL, 276.24375, 27.3952777777778,  6.27},
+{6905, "Zet Tel", 277.207916666667, -49.0708333333333,  4.13},
+{6906, NULL, 276.480833333333, 14.9666666666667,  6.37},
+{6907, NULL, 276.95625, -29.8163888888889,  5.92},
+{6908, NULL, 277.48625, -57.5230555555556,  5.76},
+{6909, NULL, 276.9325, -26.6347222222222,  6.31},
+{6910, NULL, 277.112916666667, -38.9955555555556,  5.64},
+{6911, NULL, 275.949166666667, 53.3008333333333,  6.32},
+{6912, NULL, 280.55875, -81.8077777777778,  6.27},
+{6913, "22Lam Sgr", 276.9925, -25.4216666666667,  2.81},
+{6914, NULL, 277.025833333333, -26.7572222222222,  6.27},
+{6915, NULL, 277.30375, -43.8458333333333,  6.36},
+{6916, "Nu  Pav", 277.843333333333, -62.2783333333333,  4.64},
+{6917, NULL, 276.495, 29.8288888888889,  5.83},
+{6918, "59    Ser", 276.802083333333, 0.196111111111111,  5.21},
+{6919, NULL, 276.985416666667, -17.8,  6.20},
+{6920, "43Phi Dra", 275.189583333333, 71.3377777777778,  4.22},
+{6921, NULL, 277.32, -38.8511111111111,  6.63},
+{6922, NULL, 277.4825, -47.2202777777778,  5.70},
+{6923, "39    Dra", 275.977083333333, 58.8005555555556,  4.98},
+{6924, NULL, 276.670416666667, 26.4494444444444,  6.53},
+{6925, NULL, 276.959583333333, 3.74861111111111,  6.07},
+{6926, NULL, 277.239166666667, -26.5816666666667,  6.5 },
+{6927, "44Chi Dra", 275.264166666667, 72.7327777777778,  3.57},
+{6928, NULL, 276.995, 6.19416666666667,  5.73},
+{6929, NULL, 277.341666666667, -25.2563888888889,  6.59},
+{6930, "Gam Sct", 277.299583333333, -14.5658333333333,  4.70},
+{6931, NULL, 277.7625, -41.9136111111111,  6.04},
+{6932, NULL, 277.445, -14.5816666666667,  5.96},
+{6933, NULL, 277.549583333333, -18.7288888888889,  5.66},
+{6934, "Del1Tel", 277.939166666667, -45.915,  4.96},
+{6935, "60    Ser", 277.420833333333, -1.98527777777778,  5.39},
+{6936, NULL, 277.77, -32.9891666666667,  5.34},
+{6937, NULL, 277.984166666667, -43.5077777777778,  5.72},
+{6938, "Del2Tel", 278.008333333333, -45.7572222222222,  5.07},
+{6939, NULL, 278.372916666667, -58.7091666666667,  6.44},
+{6940, NULL, 277.559583333333, -5.72416666666667,  6.28},
+{6941, NULL, 277.52125, 4.06527777777778,  6.69},
+{6942, NULL, 278.089166666667, -39.7038888888889,  5.16},
+{6943, NULL, 277.39875, 23.8661111111111,  5.90},
+{6944, NULL, 277.859583333333, -18.4027777777778,  5.14},
+{6945, "42    Dra", 276.49625, 65.5636111111111,  4.82},
+{6946, NULL, 277.857083333333, -10.7958333333333,  5.72},
+{6947, NULL, 277.972083333333, -19.125,  6.68},
+{6948, NULL, 278.25375, -39.8922222222222,  6.22},
+{6949, NULL, 276.92625, 59.5491666666667,  6.43},
+{6950, NULL, 277.673333333333, 20.8152777777778,  6.50},
+{6951, "The CrA", 278.375833333333, -42.3125,  4.64},
+{6952, "Kap1CrA", 278.347083333333, -38.7202777777778,  6.32},
+{6953, "Kap2CrA", 278.34625, -38.7261111111111,  5.65},
+{6954, NULL, 278.63, -52.8919444444444,  6.22},
+{6955, NULL, 277.768333333333, 16.9286111111111,  5.77},
+{6956, NULL, 278.086666666667, -14.6441666666667,  6.37},
+{6957, "61    Ser", 277.9875, -1.00305555555556,  5.94},
+{6958, NULL, 278.029166666667, 3.65972222222222,  6.43},
+{6959, NULL, 278.180416666667, -14.8655555555556,  5.50},
+{6960, NULL, 278.490833333333, -33.0166666666667,  5.28},
+{6961, "24    Sgr", 278.472916666667, -24.0325,  5.49},
+{6962, NULL, 278.4125, -14.8536111111111,  5.76},
+{6963, NULL, 278.345416666667, -5.91138888888889,  6.36},
+{6964, NULL, 282.99125, -83.3163888888889,  7.16},
+{6965, "25    Sgr", 278.636666666667, -24.2225,  6.51},
+{6966, NULL, 278.1925, 23.6169444444444,  5.84},
+{6967, NULL, 278.347083333333, 8.26833333333333,  6.42},
+{6968, NULL, 278.207916666667, 30.5541666666667,  5.48},
+{6969, NULL, 278.83875, -20.8408333333333,  6.48},
+{6970, NULL, 278.76, -10.9772222222222,  5.14},
+{6971, NULL, 278.34625, 30.8925,  6.59},
+{6972, NULL, 278.99875, -29.6991666666667,  6.37},
+{6973, "Alp Sct", 278.801666666667, -8.24416666666667,  3.85},
+{6974, NULL, 278.0475, 52.1155555555556,  6.56},
+{6975, NULL, 278.581666666667, 20.4663888888889,  6.57},
+{6976, NULL, 278.697916666667, 10.8916666666667,  6.40},
+{6977, NULL, 278.8025, 18.2033333333333,  5.78},
+{6978, "45    Dra", 278.14375, 57.0455555555556,  4.77},
+{6979, NULL, 277.811666666667, 65.4361111111111,  6.59},
+{6980, NULL, 278.876666666667, 23.6055555555556,  5.61},
+{6981, NULL, 278.971666666667, 16.9755555555556,  6.21},
+{6982, "Zet Pav", 280.75875, -71.4280555555556,  4.01},
+{6983, NULL, 278.48625, 52.3536111111111,  5.36},
+{6984, NULL, 278.80625, 34.4577777777778,  6.10},
+{6985, NULL, 279.115833333333, 9.1225,  5.39},
+{6986, NULL, 279.809583333333, -47.9097222222222,  5.86},
+{6987, NULL, 279.162916666667, 6.67194444444444,  5.45},
+{6988, NULL, 279.476666666667, -21.3977777777778,  5.94},
+{6989, NULL, 279.519166666667, -14.0047222222222,  6.47},
+{6990, NULL, 279.627916666667, -23.505,  5.81},
+{6991, NULL, 279.895833333333, -43.1861111111111,  5.37},
+{6992, NULL, 279.3025, 11.4216666666667,  6.42},
+{6993, NULL, 279.4, -0.309444444444444,  5.75},
+{6994, NULL, 281.955833333333, -77.8672222222222,  6.39},
+{6995, NULL, 279.2875, 16.1983333333333,  6.29},
+{6996, NULL, 280.59375, -64.6430555555556,  6.37},
+{6997, NULL, 279.155, 33.4688888888889,  5.42},
+{6998, NULL, 279.7225, -21.0519444444444,  5.86},
+{6999, NULL, 279.59875, -3.19361111111111,  6.49},
+{7000, NULL, 279.579583333333, -1.11333333333333,  6.66},
+{7001, "3Alp Lyr", 279.234583333333, 38.7836111111111,  0.03},
+{7002, NULL, 279.5875, 8.83388888888889,  6.4 },
+{7003, NULL, 279.19, 43.2219444444444,  6.20},
+{7004, NULL, 280.905, -64.5511111111111,  5.78},
+{7005, NULL, 280.3775, -48.095,  6.49},
+{7006, NULL, 277.437083333333, 77.5469444444444,  5.64},
+{7007, NULL, 280.002083333333, -7.79055555555556,  5.84},
+{7008, NULL, 279.90375, 5.26416666666667,  6.38},
+{7009, NULL, 279.527083333333, 39.6680555555556,  6.04},
+{7010, NULL, 279.965, 7.35833333333333,  6.28},
+{7011, "26    Sgr", 280.465, -23.8333333333333,  6.23},
+{7012, NULL, 281.362083333333, -64.8713888888889,  4.79},
+{7013, NULL, 279.055416666667, 65.4886111111111,  6.06},
+{7014, NULL, 280.427083333333, -14.5641666666667,  6.42},
+{7015, NULL, 281.297916666667, -61.095,  6.04},
+{7016, NULL, 280.008333333333, 30.8494444444444,  6.36},
+{7017, NULL, 279.887916666667, 40.935,  6.25},
+{7018, NULL, 279.389583333333, 62.5266666666667,  5.74},
+{7019, NULL, 280.050833333333, 38.3672222222222,  6.45},
+{7020, "Del Sct", 280.568333333333, -9.0525,  4.72},
+{7021, "Lam CrA", 280.945416666667, -38.3236111111111,  5.13},
+{7022, NULL, 281.34875, -56.8816666666667,  6.22},
+{7023, NULL, 280.73, -19.2838888888889,  6.35},
+{7024, NULL, 280.650416666667, -7.07333333333333,  6.15},
+{7025, NULL, 276.038333333333, 83.1752777777778,  6.17},
+{7026, NULL, 281.032083333333, -36.7186111111111,  6.32},
+{7027, NULL, 282.43125, -72.9947222222222,  6.06},
+{7028, NULL, 279.97, 52.1961111111111,  6.00},
+{7029, NULL, 281.080833333333, -35.6419444444444,  4.87},
+{7030, NULL, 280.422083333333, 31.6177777777778,  6.41},
+{7031, NULL, 281.238333333333, -39.6863888888889,  5.43},
+{7032, "Eps Sct", 280.880416666667, -8.27527777777778,  4.90},
+{7033, NULL, 280.53375, 34.7466666666667,  6.47},
+{7034, NULL, 280.964166666667, -6.81861111111111,  6.31},
+{7035, NULL, 281.206666666667, -25.0111111111111,  5.83},
+{7036, "The Pav", 282.1575, -65.0777777777778,  5.73},
+{7037, NULL, 281.74625, -50.0944444444444,  6.54},
+{7038, NULL, 281.327916666667, -21.0013888888889,  6.36},
+{7039, "27Phi Sgr", 281.414166666667, -26.9908333333333,  3.17},
+{7040, "4    Aql", 281.207916666667, 2.06,  5.02},
+{7041, NULL, 280.819583333333, 39.3002777777778,  6.45},
+{7042, NULL, 280.234583333333, 62.7497222222222,  6.09},
+{7043, NULL, 280.900416666667, 36.5566666666667,  6.01},
+{7044, NULL, 280.965, 31.9266666666667,  5.70},
+{7045, NULL, 281.505, -19.6063888888889,  6.42},
+{7046, "28    Sgr", 281.585833333333, -22.3922222222222,  5.37},
+{7047, NULL, 281.1675, 23.5897222222222,  6.31},
+{7048, NULL, 281.368333333333, 5.49972222222222,  5.83},
+{7049, "46    Dra", 280.657916666667, 55.5394444444444,  5.04},
+{7050, "Mu  CrA", 281.935833333333, -40.4061111111111,  5.24},
+{7051, "4Eps1Lyr", 281.085, 39.67,  5.06},
+{7052, "4Eps1Lyr", 281.084583333333, 39.6711111111111,  6.02},
+{7053, "5Eps2Lyr", 281.095416666667, 39.6130555555556,  5.14},
+{7054, "5Eps2Lyr", 281.095416666667, 39.6127777777778,  5.37},
+{7055, NULL, 281.680416666667, -10.125,  5.71},
+{7056, "6Zet1Lyr", 281.193333333333, 37.605,  4.36},
+{7057, "7Zet2Lyr", 281.200833333333, 37.5944444444444,  5.73},
+{7058, NULL, 281.39875, 21.985,  6.51},
+{7059, "5    Aql", 281.61875, -0.961666666666667,  5.90},
+{7060, NULL, 280.870833333333, 53.8719444444444,  6.11},
+{7061, "110    Her", 281.415416666667, 20.5463888888889,  4.19},
+{7062, "Eta1CrA", 282.210416666667, -43.68,  5.49},
+{7063, "Bet Sct", 281.79375, -4.74777777777778,  4.22},
+{7064, NULL, 281.51875, 26.6622222222222,  4.83},
+{7065, NULL, 282.364166666667, -45.8102777777778,  5.81},
+{7066, NULL, 281.870833333333, -5.705,  5.20},
+{7067, NULL, 281.6725, 18.7058333333333,  6.17},
+{7068, "Eta2CrA", 282.395833333333, -43.4338888888889,  5.61},
+{7069, "111    Her", 281.755416666667, 18.1813888888889,  4.36},
+{7070, NULL, 282.321666666667, -34.7486111111111,  6.62},
+{7071, NULL, 281.230833333333, 54.8966666666667,  6.23},
+{7072, NULL, 282.18875, -18.6013888888889,  6.47},
+{7073, NULL, 281.554166666667, 41.4416666666667,  6.07},
+{7074, "Lam Pav", 283.054166666667, -62.1875,  4.22},
+{7075, NULL, 281.075833333333, 61.0480555555556,  5.99},
+{7076, NULL, 282.01125, 4.24138888888889,  6.21},
+{7077, NULL, 282.397916666667, -19.1422222222222,  6.75},
+{7078, "29    Sgr", 282.417083333333, -20.3247222222222,  5.24},
+{7079, NULL, 282.068333333333, 23.5141666666667,  6.15},
+{7080, NULL, 281.745833333333, 46.315,  6.52},
+{7081, NULL, 281.989583333333, 31.7569444444444,  6.06},
+{7082, NULL, 280.7925, 70.7927777777778,  6.44},
+{7083, NULL, 282.420833333333, -5.91277777777778,  5.99},
+{7084, NULL, 281.679583333333, 52.9880555555556,  5.88},
+{7085, NULL, 282.404583333333, 0.835833333333333,  6.25},
+{7086, NULL, 282.2225, 19.3286111111111,  5.88},
+{7087, "Kap Tel", 283.165, -52.1075,  5.17},
+{7088, "30    Sgr", 282.710416666667, -22.1622222222222,  6.61},
+{7089, NULL, 282.583333333333, -7.9075,  6.80},
+{7090, NULL, 281.916666666667, 49.075,  6.40},
+{7091, NULL, 282.31, 25.0463888888889,  6.59},
+{7092, NULL, 283.112916666667, -46.5952777777778,  5.54},
+{7093, NULL, 283.300416666667, -51.9311111111111,  6.31},
+{7094, NULL, 282.74375, -9.77416666666667,  5.83},
+{7095, NULL, 283.260416666667, -48.36,  6.19},
+{7096, NULL, 282.067083333333, 48.7675,  6.12},
+{7097, NULL, 283.248333333333, -46.5858333333333,  6.19},
+{7098, NULL, 282.433333333333, 31.6291666666667,  6.64},
+{7099, NULL, 282.69, 10.9763888888889,  6.55},
+{7100, "8Nu 1Lyr", 282.44125, 32.8127777777778,  5.91},
+{7101, "8    Aql", 282.842083333333, -3.31777777777778,  6.10},
+{7102, "9Nu 2Lyr", 282.470416666667, 32.5508333333333,  5.25},
+{7103, NULL, 283.11875, -26.6502777777778,  6.29},
+{7104, NULL, 283.154166666667, -29.3794444444444,  6.13},
+{7105, NULL, 283.17375, -30.7341666666667,  6.63},
+{7106, "10Bet Lyr", 282.52, 33.3627777777778,  3.45},
+{7107, "Kap Pav", 284.2375, -67.2336111111111,  4.44},
+{7108, NULL, 283.634583333333, -49.8786111111111,  6.60},
+{7109, NULL, 283.007916666667, 13.9655555555556,  6.14},
+{7110, NULL, 283.257916666667, -9.57611111111111,  6.34},
+{7111, NULL, 284.227916666667, -62.8011111111111,  6.48},
+{7112, NULL, 282.899583333333, 28.7836111111111,  6.18},
+{7113, "112    Her", 283.068333333333, 21.4252777777778,  5.48},
+{7114, "33    Sgr", 283.500416666667, -21.3597222222222,  5.69},
+{7115, NULL, 282.902083333333, 36.5386111111111,  6.09},
+{7116, "32Nu 1Sgr", 283.5425, -22.745,  4.83},
+{7117, NULL, 281.444583333333, 74.0855555555555,  5.27},
+{7118, NULL, 283.029583333333, 41.3833333333333,  6.28},
+{7119, NULL, 283.679583333333, -15.6030555555556,  5.10},
+{7120, "35Nu 2Sgr", 283.779583333333, -22.6713888888889,  4.99},
+{7121, "34Sig Sgr", 283.81625, -26.2966666666667,  2.02},
+{7122, NULL, 284.070416666667, -42.7105555555556,  5.36},
+{7123, NULL, 282.895833333333, 52.975,  5.51},
+{7124, "50    Dra", 281.5925, 75.4338888888889,  5.35},
+{7125, "47Omi Dra", 282.800416666667, 59.3883333333333,  4.66},
+{7126, NULL, 283.879166666667, -16.3766666666667,  5.79},
+{7127, "Ome Pav", 284.651666666667, -60.2005555555556,  5.14},
+{7128, NULL, 284.0025, -23.1736111111111,  5.93},
+{7129, NULL, 284.16875, -37.3433333333333,  5.38},
+{7130, NULL, 285.014583333333, -66.6533333333333,  6.01},
+{7131, "11Del1Lyr", 283.431666666667, 36.9716666666667,  5.58},
+{7132, NULL, 283.555, 27.9094444444444,  5.62},
+{7133, "113    Her", 283.687083333333, 22.645,  4.59},
+{7134, "Lam Tel", 284.615416666667, -52.9386111111111,  4.87},
+{7135, NULL, 283.864583333333, 6.61527777777778,  5.57},
+{7136, NULL, 284.394583333333, -39.8233333333333,  6.31},
+{7137, NULL, 283.306666666667, 50.7083333333333,  4.92},
+{7138, NULL, 283.559583333333, 41.2255555555556,  7.30},
+{7139, "12Del2Lyr", 283.625833333333, 36.8988888888889,  4.30},
+{7140, NULL, 283.71875, 33.9686111111111,  6.02},
+{7141, "63The1Ser", 284.055, 4.20361111111111,  4.62},
+{7142, "63The2Ser", 284.060833333333, 4.20194444444444,  4.98},
+{7143, NULL, 284.094583333333, -1.8,  6.22},
+{7144, NULL, 284.106666666667, 2.47111111111111,  6.15},
+{7145, "36Xi 1Sgr", 284.335416666667, -20.6563888888889,  5.08},
+{7146, NULL, 283.7175, 41.6027777777778,  5.44},
+{7147, NULL, 284.01625, 17.995,  6.63},
+{7148, NULL, 284.025833333333, 18.1052777777778,  5.69},
+{7149, "Eta Sct", 284.265416666667, -5.84611111111111,  4.83},
+{7150, "37Xi 2Sgr", 284.4325, -21.1066666666667,  3.51},
+{7151, NULL, 284.58875, -31.0361111111111,  6.12},
+{7152, "Eps CrA", 284.680833333333, -37.1075,  4.87},
+{7153, NULL, 283.442916666667, 57.4869444444444,  6.22},
+{7154, NULL, 283.69625, 48.8597222222222,  5.77},
+{7155, NULL, 284.585416666667, -24.8766666666667,  6.62},
+{7156, NULL, 284.79625, -39.5347222222222,  6.49},
+{7157, "13    Lyr", 283.83375, 43.9461111111111,  4.04},
+{7158, "64    Ser", 284.319166666667, 2.53527777777778,  5.57},
+{7159, NULL, 284.6025, -22.5294444444444,  6.14},
+{7160, NULL, 281.40875, 79.9425,  6.39},
+{7161, NULL, 285.87375, -68.7552777777778,  5.88},
+{7162, NULL, 284.256666666667, 32.9013888888889,  5.22},
+{7163, NULL, 284.599166666667, 6.24027777777778,  6.21},
+{7164, NULL, 284.861666666667, -18.5669444444444,  6.37},
+{7165, NULL, 284.56125, 17.3608333333333,  5.38},
+{7166, NULL, 284.849166666667, -12.8405555555556,  5.53},
+{7167, "10    Aql", 284.695416666667, 13.9066666666667,  5.89},
+{7168, NULL, 285.103333333333, -24.9422222222222,  6.36},
+{7169, NULL, 285.263333333333, -37.0608333333333,  6.69},
+{7170, NULL, 285.267916666667, -37.0619444444444,  6.40},
+{7171, NULL, 284.687916666667, 19.7941666666667,  6.50},
+{7172, "11    Aql", 284.77375, 13.6225,  5.23},
+{7173, NULL, 284.822916666667, 10.1408333333333,  6.75},
+{7174, NULL, 284.507916666667, 38.2661111111111,  5.89},
+{7175, "48    Dra", 284.1875, 57.815,  5.66},
+{7176, "13Eps Aql", 284.905833333333, 15.0683333333333,  4.02},
+{7177, NULL, 285.53625, -41.91,  6.23},
+{7178, "14Gam Lyr", 284.735833333333, 32.6894444444444,  3.24},
+{7179, NULL, 284.694166666667, 40.6791666666667,  6.22},
+{7180, "52Ups Dra", 283.599583333333, 71.2972222222222,  4.82},
+{7181, NULL, 284.939583333333, 26.2305555555556,  5.27},
+{7182, NULL, 285.4075, -22.6955555555556,  6.24},
+{7183, NULL, 284.992083333333, 22.8147222222222,  6.29},
+{7184, NULL, 284.368333333333, 58.2252777777778,  6.46},
+{7185, NULL, 284.80125, 39.2177777777778,  6.41},
+{7186, NULL, 285.389583333333, -15.2825,  6.32},
+{7187, NULL, 284.106666666667, 65.2580555555556,  5.63},
+{7188, "Zet CrA", 285.77875, -42.0952777777778,  4.75},
+{7190, NULL, 285.989166666667, -51.0186111111111,  5.93},
+{7191, NULL, 284.3225, 62.3966666666667,  6.45},
+{7192, "15Lam Lyr", 285.00375, 32.1455555555556,  4.93},
+{7193, "12    Aql", 285.42, -5.73888888888889,  4.02},
+{7194, "38Zet Sgr", 285.652916666667, -29.8802777777778,  2.60},
+{7195, NULL, 285.615416666667, -24.8469444444444,  5.65},
+{7196, NULL, 284.748333333333, 50.8094444444444,  6.30},
+{7197, NULL, 285.82375, -38.2533333333333,  5.74},
+{7198, NULL, 285.272916666667, 19.3097222222222,  6.39},
+{7199, NULL, 283.388333333333, 75.7875,  6.22},
+{7200, NULL, 285.344166666667, 20.8336111111111,  6.69},
+{7201, NULL, 285.079166666667, 40.6841666666667,  6.65},
+{7202, NULL, 285.3225, 26.2913888888889,  5.69},
+{7203, NULL, 285.765833333333, -19.2452777777778,  6.05},
+{7204, NULL, 285.23, 33.8022222222222,  6.01},
+{7205, NULL, 285.779166666667, -19.1033333333333,  6.37},
+{7206, NULL, 285.395416666667, 25.0258333333333,  6.72},
+{7207, NULL, 285.45625, 22.2638888888889,  6.40},
+{7208, NULL, 285.59, 8.37416666666667,  6.30},
+{7209, "14    Aql", 285.727083333333, -3.69888888888889,  5.42},
+{7210, NULL, 285.057083333333, 50.5336111111111,  5.38},
+{7211, NULL, 286.104583333333, -31.0469444444444,  5.50},
+{7212, NULL, 285.45125, 33.6213888888889,  6.39},
+{7213, "Rho Tel", 286.582916666667, -52.3408333333333,  5.16},
+{7214, NULL, 285.884166666667, 1.81888888888889,  5.83},
+{7215, "16    Lyr", 285.36, 46.9347222222222,  5.01},
+{7216, NULL, 285.719166666667, 19.6611111111111,  6.09},
+{7217, "39Omi Sgr", 286.170833333333, -21.7416666666667,  3.77},
+{7218, "49    Dra", 285.180833333333, 55.6583333333333,  5.48},
+{7219, NULL, 286.044583333333, 3.33055555555556,  6.73},
+{7220, NULL, 286.100833333333, -5.685,  6.90},
+{7221, NULL, 287.469583333333, -68.4247222222222,  5.33},
+{7222, NULL, 285.927083333333, 21.2677777777778,  6.52},
+{7223, NULL, 286.731666666667, -48.2991666666667,  5.97},
+{7224, NULL, 284.719166666667, 69.5311111111111,  6.52},
+{7225, "15    Aql", 286.24, -4.03138888888889,  5.42},
+{7226, "Gam CrA", 286.604583333333, -37.0633333333333,  4.93},
+{7227, "Gam CrA", 286.604583333333, -37.0633333333333,  4.99},
+{7228, "Sig Oct", 317.1925, -88.9563888888889,  5.47},
+{7229, NULL, 285.529166666667, 52.2611111111111,  6.31},
+{7230, NULL, 286.421666666667, -15.6602777777778,  5.97},
+{7231, NULL, 286.3275, -1.51277777777778,  6.53},
+{7232, NULL, 286.71875, -37.8102777777778,  6.16},
+{7233, NULL, 287.217083333333, -55.7202777777778,  6.49},
+{7234, "40Tau Sgr", 286.735, -27.6705555555556,  3.32},
+{7235, "17Zet Aql", 286.3525, 13.8633333333333,  2.99},
+{7236, "16Lam Aql", 286.562083333333, -4.8825,  3.44},
+{7237, NULL, 286.24125, 31.7444444444444,  5.56},
+{7238, NULL, 286.242916666667, 30.7333333333333,  6.06},
+{7239, NULL, 286.717916666667, -16.2288888888889,  6.03},
+{7240, NULL, 286.87875, -28.6369444444444,  6.04},
+{7241, NULL, 286.785416666667, -18.7377777777778,  6.29},
+{7242, "Del CrA", 287.087083333333, -40.4966666666667,  4.59},
+{7243, NULL, 286.5925, 8.23,  6.09},
+{7244, NULL, 286.44625, 29.9216666666667,  6.31},
+{7245, NULL, 286.787916666667, 0.641666666666667,  6.56},
+{7246, NULL, 287.060833333333, -24.6569444444444,  6.30},
+{7247, NULL, 284.488333333333, 77.0508333333333,  6.54},
+{7248, "18    Aql", 286.744166666667, 11.0713888888889,  5.09},
+{7249, NULL, 287.069583333333, -19.29,  5.54},
+{7250, NULL, 286.66, 24.2508333333333,  5.77},
+{7251, "51    Dra", 286.23, 53.3966666666667,  5.38},
+{7252, NULL, 286.29125, 49.9233333333333,  6.43},
+{7253, NULL, 286.657083333333, 28.6286111111111,  5.55},
+{7254, "Alp CrA", 287.367916666667, -37.9044444444444,  4.11},
+{7255, NULL, 287.415416666667, -39.8280555555556,  6.46},
+{7256, NULL, 287.401666666667, -36.1647222222222,  6.56},
+{7257, NULL, 287.490833333333, -41.8925,  5.88},
+{7258, NULL, 286.570833333333, 41.4138888888889,  6.49},
+{7259, "Bet CrA", 287.507083333333, -39.3408333333333,  4.11},
+{7260, NULL, 286.98875, 16.8533333333333,  6.07},
+{7261, "17    Lyr", 286.856666666667, 32.5016666666667,  5.23},
+{7262, "18Iot Lyr", 286.825416666667, 36.1002777777778,  5.28},
+{7263, NULL, 287.015, 21.6988888888889,  6.23},
+{7264, "41Pi  Sgr", 287.440833333333, -21.0236111111111,  2.89},
+{7265, NULL, 287.450416666667, -19.8036111111111,  6.13},
+{7266, "19    Aql", 287.249583333333, 6.07333333333333,  5.22},
+{7267, NULL, 287.1675, 16.8513888888889,  6.48},
+{7268, NULL, 287.7575, -39.005,  6.36},
+{7269, NULL, 287.465, -0.428055555555556,  6.34},
+{7270, NULL, 287.82875, -29.5022222222222,  6.30},
+{7271, NULL, 288.192083333333, -50.4863888888889,  6.13},
+{7272, NULL, 287.268333333333, 34.6005555555556,  6.74},
+{7273, NULL, 288.040833333333, -37.5827777777778,  6.57},
+{7274, "Tau Pav", 289.11875, -69.1905555555556,  6.27},
+{7275, NULL, 287.1075, 52.4255555555556,  5.81},
+{7276, NULL, 288.116666666667, -21.6580555555556,  6.41},
+{7277, NULL, 288.307083333333, -25.9066666666667,  5.80},
+{7278, NULL, 289.3, -66.6613888888889,  5.53},
+{7279, "20    Aql", 288.169583333333, -7.93944444444444,  5.34},
+{7280, NULL, 287.87875, 26.7358333333333,  6.36},
+{7281, NULL, 288.665416666667, -45.1933333333333,  5.92},
+{7282, NULL, 288.314583333333, -12.2825,  5.51},
+{7283, "19    Lyr", 287.941666666667, 31.2833333333333,  5.98},
+{7284, NULL, 287.84625, 40.4291666666667,  6.18},
+{7285, NULL, 288.143333333333, 16.8463888888889,  6.73},
+{7286, NULL, 288.152916666667, 21.5544444444444,  5.93},
+{7287, "21    Aql", 288.427916666667, 2.29361111111111,  5.15},
+{7288, NULL, 288.43375, 5.51583333333333,  6.49},
+{7289, NULL, 289.090416666667, -45.4663888888889,  5.40},
+{7290, "55    Dra", 287.440833333333, 65.9786111111111,  6.25},
+{7291, NULL, 288.888333333333, -24.1791666666667,  6.25},
+{7292, "42Psi Sgr", 288.885, -25.2566666666667,  4.85},
+{7293, NULL, 288.019166666667, 49.8541666666667,  6.75},
+{7294, NULL, 288.020833333333, 49.8561111111111,  6.57},
+{7295, "53    Dra", 287.91875, 56.8591666666667,  5.12},
+{7296, NULL, 289.136666666667, -33.5216666666667,  6.25},
+{7297, NULL, 289.539166666667, -53.3866666666667,  6.38},
+{7298, "20Eta Lyr", 288.439583333333, 39.1461111111111,  4.39},
+{7299, NULL, 288.760833333333, 20.2033333333333,  6.00},
+{7300, NULL, 288.83375, 15.0836111111111,  5.57},
+{7301, "1    Sge", 288.8225, 21.2322222222222,  5.64},
+{7302, NULL, 288.853333333333, 30.5263888888889,  5.85},
+{7303, "22    Aql", 289.129166666667, 4.83472222222222,  5.59},
+{7304, "43    Sgr", 289.40875, -18.9530555555556,  4.96},
+{7305, NULL, 288.9875, 27.4555555555556,  6.54},
+{7306, "1    Vul", 289.054166666667, 21.3902777777778,  4.77},
+{7307, NULL, 289.111666666667, 14.5447222222222,  5.63},
+{7308, NULL, 288.9975, 27.9269444444444,  6.16},
+{7309, "54    Dra", 288.48, 57.705,  4.99},
+{7310, "57Del Dra", 288.13875, 67.6616666666667,  3.07},
+{7311, NULL, 288.830416666667, 50.0708333333333,  6.27},
+{7312, "59    Dra", 287.290833333333, 76.5605555555556,  5.13},
+{7313, NULL, 289.450833333333, 2.03166666666667,  6.19},
+{7314, "21The Lyr", 289.092083333333, 38.1336111111111,  4.36},
+{7315, "25Ome1Aql", 289.454166666667, 11.5952777777778,  5.28},
+{7316, NULL, 289.916666666667, -35.4213888888889,  5.59},
+{7317, NULL, 289.750416666667, -15.5363888888889,  6.06},
+{7318, "2    Vul", 289.431666666667, 23.0255555555556,  5.43},
+{7319, "23    Aql", 289.635416666667, 1.08527777777778,  5.10},
+{7320, NULL, 291.0225, -68.3711111111111,  6.34},
+{7321, "24    Aql", 289.712083333333, 0.339166666666667,  6.41},
+{7322, NULL, 289.214166666667, 46.9991666666667,  6.00},
+{7323, NULL, 290.109166666667, -31.8177777777778,  6.58},
+{7324, NULL, 289.503333333333, 31.0222222222222,  6.68},
+{7325, NULL, 289.719583333333, 9.61805555555556,  6.32},
+{7326, NULL, 289.702083333333, 19.6105555555556,  6.58},
+{7327, NULL, 290.15875, -22.4025,  5.58},
+{7328, "1Kap Cyg", 289.275833333333, 53.3686111111111,  3.77},
+{7329, "Eta Tel", 290.712916666667, -54.4236111111111,  5.05},
+{7330, NULL, 290.374583333333, -34.9838888888889,  6.48},
+{7331, "28    Aql", 289.91375, 12.3747222222222,  5.53},
+{7332, "29Ome2Aql", 289.970833333333, 11.535,  6.02},
+{7333, "26    Aql", 290.137083333333, -5.41583333333333,  5.01},
+{7334, NULL, 290.54, -42.0161111111111,  6.34},
+{7335, NULL, 289.765833333333, 33.3888888888889,  6.60},
+{7336, "27    Aql", 290.14875, -0.892222222222222,  5.49},
+{7337, "Bet1Sgr", 290.659583333333, -44.4588888888889,  4.01},
+{7338, NULL, 289.755, 37.4452777777778,  6.22},
+{7339, NULL, 290.404583333333, -19.2341666666667,  6.26},
+{7340, "44Rho1Sgr", 290.418333333333, -17.8472222222222,  3.93},
+{7341, NULL, 289.657083333333, 49.5697222222222,  6.31},
+{7342, "46Ups Sgr", 290.431666666667, -15.955,  4.61},
+{7343, "Bet2Sgr", 290.805, -44.7997222222222,  4.29},
+{7344, "45Rho2Sgr", 290.462083333333, -18.3083333333333,  5.87},
+{7345, NULL, 289.912083333333, 37.3305555555556,  6.31},
+{7346, NULL, 290.137916666667, 35.1861111111111,  6.31},
+{7347, NULL, 290.58625, -8.20111111111111,  6.31},
+{7348, "Alp Sgr", 290.971666666667, -40.6161111111111,  3.97},
+{7349, NULL, 290.589583333333, -0.2525,  5.83},
+{7350, NULL, 291.089166666667, -43.7230555555556,  6.17},
+{7351, NULL, 289.902083333333, 54.3761111111111,  6.26},
+{7352, "60Tau Dra", 288.8875, 73.3555555555556,  4.45},
+{7353, NULL, 290.769166666667, -7.40027777777778,  6.32},
+{7354, NULL, 290.701666666667, 9.91305555555556,  6.35},
+{7355, NULL, 291.125416666667, -27.8655555555556,  6.04},
+{7356, NULL, 290.067083333333, 57.6452777777778,  5.91},
+{7357, NULL, 290.784166666667, 14.9211111111111,  6.64},
+{7358, "3    Vul", 290.712083333333, 26.2625,  5.18},
+{7359, NULL, 290.639166666667, 33.5180555555556,  6.06},
+{7360, NULL, 291.267083333333, -29.3091666666667,  5.93},
+{7361, NULL, 289.942083333333, 64.3908333333333,  6.52},
+{7362, "47Chi1Sgr", 291.31875, -24.5086111111111,  5.03},
+{7363, "49Chi3Sgr", 291.37375, -23.9622222222222,  5.43},
+{7364, NULL, 290.945416666667, 20.2644444444444,  6.40},
+{7365, NULL, 290.355833333333, 57.7669444444444,  6.43},
+{7366, NULL, 291.256666666667, -4.88416666666667,  6.52},
+{7367, NULL, 291.34, -13.8969444444444,  5.69},
+{7368, NULL, 290.891666666667, 33.2222222222222,  6.37},
+{7369, "2    Sge", 291.092083333333, 16.9377777777778,  6.25},
+{7370, NULL, 291.950416666667, -54.3252777777778,  5.69},
+{7371, "58Pi  Dra", 290.167083333333, 65.7147222222222,  4.59},
+{7372, "2    Cyg", 291.031666666667, 29.6213888888889,  4.97},
+{7373, "31    Aql", 291.2425, 11.9444444444444,  5.16},
+{7374, NULL, 291.093333333333, 28.0877777777778,  6.53},
+{7375, "50    Sgr", 291.58, -21.7766666666667,  5.59},
+{7376, NULL, 291.025416666667, 36.4519444444445,  6.36},
+{7377, "30Del Aql", 291.374583333333, 3.11472222222222,  3.36},
+{7378, NULL, 291.54625, -15.0530555555556,  5.72},
+{7379, NULL, 291.6025, -14.5511111111111,  6.70},
+{7380, NULL, 291.735416666667, -29.7433333333333,  5.67},
+{7381, NULL, 290.849166666667, 50.2713888888889,  6.51},
+{7382, NULL, 290.985416666667, 43.3880555555556,  5.84},
+{7383, NULL, 292.795416666667, -68.4338888888889,  5.96},
+{7384, NULL, 291.343333333333, 20.2713888888889,  6.31},
+{7385, "4    Vul", 291.369166666667, 19.7986111111111,  5.16},
+{7386, NULL, 291.3575, 24.9127777777778,  6.19},
+{7387, "32Nu  Aql", 291.629583333333, 0.338611111111111,  4.66},
+{7388, NULL, 292.469166666667, -55.4413888888889,  6.13},
+{7389, NULL, 291.600416666667, 13.0238888888889,  5.74},
+{7390, "5    Vul", 291.555, 20.0977777777778,  5.63},
+{7391, NULL, 291.619583333333, 19.8913888888889,  5.81},
+{7392, NULL, 292.349583333333, -43.4458333333333,  5.71},
+{7393, "Mu  Tel", 292.64375, -55.11,  6.30},
+{7394, "Lam UMi", 259.236666666667, 89.0377777777778,  6.38},
+{7395, "4    Cyg", 291.537916666667, 36.3177777777778,  5.15},
+{7396, NULL, 291.89125, 14.2825,  6.32},
+{7397, NULL, 292.086666666667, 2.93027777777778,  5.85},
+{7398, NULL, 292.4675, -26.9855555555556,  5.52},
+{7399, NULL, 292.56125, -32.0922222222222,  6.60},
+{7400, "35    Aql", 292.254166666667, 1.95027777777778,  5.80},
+{7401, NULL, 291.444583333333, 58.0272222222222,  6.60},
+{7402, NULL, 292.339583333333, -7.04388888888889,  6.61},
+{7403, NULL, 291.902083333333, 37.9411111111111,  6.34},
+{7404, NULL, 292.325, 0.246111111111111,  6.25},
+{7405, "6Alp Vul", 292.17625, 24.665,  4.44},
+{7406, "8    Vul", 292.2375, 24.7686111111111,  5.81},
+{7407, NULL, 292.342083333333, 14.5958333333333,  5.56},
+{7408, "7Iot1Cyg", 291.857916666667, 52.3205555555556,  5.75},
+{7409, "7    Vul", 292.337083333333, 20.2797222222222,  6.33},
+{7410, NULL, 292.725, -21.3122222222222,  6.13},
+{7411, NULL, 293.224166666667, -53.1858333333333,  5.75},
+{7412, NULL, 292.54375, 2.90416666666667,  6.09},
+{7413, NULL, 291.610416666667, 62.5572222222222,  6.38},
+{7414, "36    Aql", 292.665833333333, -2.78888888888889,  5.03},
+{7415, NULL, 292.637916666667, 3.44444444444444,  6.05},
+{7416, NULL, 293.34, -45.2719444444444,  5.61},
+{7417, "6Bet1Cyg", 292.680416666667, 27.9597222222222,  3.08},
+{7418, "6Bet2Cyg", 292.68875, 27.9652777777778,  5.11},
+{7419, NULL, 292.695416666667, 36.2286111111111,  6.25},
+{7420, "10Iot2Cyg", 292.42625, 51.7297222222222,  3.79},
+{7421, NULL, 292.840833333333, 26.6172222222222,  5.87},
+{7422, NULL, 293.535416666667, -40.0347222222222,  5.89},
+{7423, NULL, 290.4175, 79.6027777777778,  6.05},
+{7424, "Iot Tel", 293.804166666667, -48.0991666666667,  4.90},
+{7425, NULL, 288.7825, 83.4627777777778,  6.53},
+{7426, "8    Cyg", 292.942916666667, 34.4530555555556,  4.74},
+{7427, NULL, 292.830416666667, 50.3066666666667,  5.53},
+{7428, NULL, 292.806666666667, 55.7319444444444,  6.37},
+{7429, "38Mu  Aql", 293.5225, 7.37888888888889,  4.45},
+{7430, "37    Aql", 293.780416666667, -10.5602777777778,  5.12},
+{7431, "51    Sgr", 294.007083333333, -24.7191666666667,  5.65},
+{7432, NULL, 293.874166666667, -7.46027777777778,  6.34},
+{7433, NULL, 293.89, -12.2527777777778,  6.27},
+{7434, NULL, 294.607916666667, -57.9833333333333,  6.18},
+{7435, NULL, 294.967083333333, -66.6855555555556,  6.39},
+{7436, NULL, 293.401666666667, 38.7622222222222,  6.61},
+{7437, "9    Vul", 293.645416666667, 19.7733333333333,  5.00},
+{7438, NULL, 293.855, 2.91333333333333,  6.38},
+{7439, NULL, 294.10875, -18.8527777777778,  6.11},
+{7440, "52    Sgr", 294.176666666667, -24.8836111111111,  4.60},
+{7441, "9    Cyg", 293.712083333333, 29.4630555555556,  5.38},
+{7442, NULL, 293.423333333333, 49.2625,  5.96},
+{7443, NULL, 294.26375, -18.2311111111111,  5.64},
+{7444, NULL, 293.671666666667, 42.4127777777778,  5.35},
+{7445, NULL, 294.033333333333, 11.15,  6.68},
+{7446, "39Kap Aql", 294.222916666667, -7.0275,  4.95},
+{7447, "41Iot Aql", 294.180416666667, -1.28638888888889,  4.36},
+{7448, NULL, 293.292083333333, 60.1586111111111,  6.29},
+{7449, NULL, 294.065833333333, 14.3916666666667,  6.38},
+{7450, NULL, 292.750833333333, 70.9894444444444,  6.07},
+{7451, NULL, 293.5825, 51.2366666666667,  5.73},
+{7452, NULL, 294.034583333333, 22.5858333333333,  6.32},
+{7453, NULL, 293.66625, 48.1647222222222,  6.67},
+{7454, NULL, 294.393333333333, -14.3016666666667,  5.47},
+{7455, NULL, 295.40625, -65.8541666666667,  6.09},
+{7456, NULL, 294.21875, 11.2733333333333,  5.98},
+{7457, "11    Cyg", 293.95125, 36.9444444444444,  6.05},
+{7458, NULL, 294.157083333333, 20.3327777777778,  7.14},
+{7459, NULL, 295.07625, -54.4175,  6.26},
+{7460, "42    Aql", 294.447083333333, -4.6475,  5.46},
+{7461, NULL, 294.925, -45.2780555555556,  6.25},
+{7462, "61Sig Dra", 293.09, 69.6611111111111,  4.68},
+{7463, "4Eps Sge", 294.3225, 16.4627777777778,  5.66},
+{7464, NULL, 294.982083333333, -39.4333333333333,  6.61},
+{7465, NULL, 293.982916666667, 50.2386111111111,  6.52},
+{7466, NULL, 294.289166666667, 29.3336111111111,  6.43},
+{7467, NULL, 294.235833333333, 38.3838888888889,  6.50},
+{7468, NULL, 294.157916666667, 44.695,  5.17},
+{7469, "13The Cyg", 294.110416666667, 50.2211111111111,  4.48},
+{7470, "53    Sgr", 294.955833333333, -23.4277777777778,  6.34},
+{7471, NULL, 294.704166666667, 3.38166666666667,  6.35},
+{7472, NULL, 294.572916666667, 20.7827777777778,  6.48},
+{7473, NULL, 295.029583333333, -23.4286111111111,  5.97},
+{7474, "44Sig Aql", 294.798333333333, 5.39777777777778,  5.17},
+{7475, NULL, 294.855833333333, 16.5713888888889,  6.38},
+{7476, "54    Sgr", 295.180833333333, -16.2933333333333,  6.2 },
+{7477, NULL, 294.48625, 49.2844444444444,  6.47},
+{7478, "12Phi Cyg", 294.844166666667, 30.1533333333333,  4.69},
+{7479, "5Alp Sge", 295.024166666667, 18.0138888888889,  4.37},
+{7480, "45    Aql", 295.180416666667, -0.621111111111111,  5.67},
+{7481, NULL, 294.9375, 33.9791666666667,  6.10},
+{7482, NULL, 295.117916666667, 20.4766666666667,  6.50},
+{7483, "14    Cyg", 294.860416666667, 42.8183333333333,  5.40},
+{7484, NULL, 294.671666666667, 54.9738888888889,  5.82},
+{7485, NULL, 295.165416666667, 23.7175,  6.64},
+{7486, NULL, 295.272916666667, 13.8155555555556,  6.01},
+{7487, NULL, 294.893333333333, 45.9580555555556,  6.20},
+{7488, "6Bet Sge", 295.262083333333, 17.4761111111111,  4.37},
+{7489, "55    Sgr", 295.629583333333, -16.1238888888889,  5.06},
+{7490, NULL, 295.312083333333, 22.4527777777778,  6.36},
+{7491, NULL, 295.906666666667, -37.5388888888889,  6.16},
+{7492, NULL, 295.171666666667, 43.0777777777778,  6.16},
+{7493, "46    Aql", 295.553333333333, 12.1933333333333,  6.34},
+{7494, NULL, 299.00625, -81.3497222222222,  6.39},
+{7495, NULL, 295.209166666667, 45.525,  5.06},
+{7496, NULL, 295.889583333333, -15.47,  5.49},
+{7497, "47Chi Aql", 295.641666666667, 11.8266666666667,  5.27},
+{7498, NULL, 297.355416666667, -72.5033333333333,  5.41},
+{7499, NULL, 295.489583333333, 40.2538888888889,  6.23},
+{7500, NULL, 295.054166666667, 60.5072222222222,  6.51},
+{7501, NULL, 295.704583333333, 29.3316666666667,  6.49},
+{7502, NULL, 295.685833333333, 32.4266666666667,  5.94},
+{7503, "16    Cyg", 295.45375, 50.5252777777778,  5.96},
+{7504, NULL, 295.466666666667, 50.5175,  6.20},
+{7505, NULL, 295.789583333333, 30.6786111111111,  6.05},
+{7506, "10    Vul", 295.92875, 25.7719444444444,  5.49},
+{7507, NULL, 296.505, -31.9086111111111,  5.52},
+{7508, NULL, 295.982916666667, 27.1355555555556,  6.28},
+{7509, NULL, 295.517083333333, 55.4633333333333,  6.48},
+{7510, "Nu  Tel", 297.005, -56.3625,  5.35},
+{7511, "48Psi Aql", 296.142083333333, 13.3027777777778,  6.26},
+{7512, NULL, 295.964166666667, 34.1625,  6.05},
+{7513, NULL, 297.472083333333, -66.8127777777778,  6.45},
+{7514, NULL, 295.9375, 41.7730555555556,  5.84},
+{7515, "56    Sgr", 296.590416666667, -19.7611111111111,  4.86},
+{7516, NULL, 296.4675, -2.88333333333333,  6.48},
+{7517, "15    Cyg", 296.069166666667, 37.3544444444444,  4.89},
+{7518, NULL, 296.202916666667, 29.2647222222222,  6.82},
+{7519, "49Ups Aql", 296.41625, 7.61333333333333,  5.91},
+{7520, NULL, 296.159166666667, 34.4138888888889,  6.57},
+{7521, NULL, 297.229583333333, -52.8880555555556,  6.25},
+{7522, NULL, 295.810833333333, 58.0163888888889,  6.22},
+{7523, NULL, 296.204166666667, 40.7166666666667,  6.34},
+{7524, NULL, 297.755416666667, -65.605,  6.05},
+{7525, "50Gam Aql", 296.565, 10.6133333333333,  2.72},
+{7526, NULL, 295.915, 57.0425,  6.27},
+{7527, NULL, 297.590416666667, -61.0613888888889,  6.21},
+{7528, "18Del Cyg", 296.24375, 45.1308333333333,  2.87},
+{7529, NULL, 296.415, 36.0911111111111,  6.43},
+{7530, NULL, 296.464166666667, 35.0127777777778,  6.09},
+{7531, NULL, 297.686666666667, -59.1930555555556,  5.42},
+{7532, NULL, 297.0125, -13.7033333333333,  6.11},
+{7533, NULL, 296.664583333333, 25.1338888888889,  6.62},
+{7534, "17    Cyg", 296.606666666667, 33.7277777777778,  4.99},
+{7535, NULL, 296.645833333333, 32.8886111111111,  6.18},
+{7536, "7Del Sge", 296.847083333333, 18.5341666666667,  3.82},
+{7537, NULL, 297.5575, -47.5572222222222,  5.94},
+{7538, NULL, 297.298333333333, -28.7888888888889,  6.05},
+{7540, NULL, 296.9525, 25.3838888888889,  5.95},
+{7541, NULL, 297.259166666667, -10.8708333333333,  6.04},
+{7542, NULL, 297.126666666667, 10.6941666666667,  6.44},
+{7543, NULL, 296.865833333333, 38.4075,  5.77},
+{7544, "52Pi  Aql", 297.175416666667, 11.8158333333333,  5.72},
+{7545, NULL, 296.077083333333, 69.3369444444444,  5.92},
+{7546, "8Zet Sge", 297.244583333333, 19.1422222222222,  5.00},
+{7547, NULL, 296.861666666667, 47.9077777777778,  6.12},
+{7548, NULL, 298.156666666667, -54.9711111111111,  5.74},
+{7549, NULL, 298.1625, -54.9766666666667,  6.50},
+{7550, NULL, 297.182916666667, 35.3113888888889,  6.53},
+{7551, NULL, 297.210833333333, 33.4372222222222,  6.44},
+{7552, NULL, 297.960833333333, -39.8744444444444,  5.33},
+{7553, "51    Aql", 297.695, -10.7636111111111,  5.39},
+{7554, NULL, 297.572916666667, 7.9025,  6.51},
+{7555, NULL, 297.364583333333, 38.71,  6.11},
+{7556, NULL, 297.4775, 28.4405555555556,  6.38},
+{7557, "53Alp Aql", 297.695833333333, 8.86833333333333,  0.77},
+{7558, NULL, 298.668333333333, -61.1708333333333,  6.24},
+{7559, NULL, 297.79625, -2.46083333333333,  6.13},
+{7560, "54Omi Aql", 297.756666666667, 10.4155555555556,  5.11},
+{7561, "57    Sgr", 298.05, -19.045,  5.92},
+{7562, NULL, 297.82375, 9.63027777777778,  6.25},
+{7563, NULL, 296.68625, 68.4383333333333,  6.34},
+{7564, "Chi Cyg", 297.64125, 32.9141666666667,  4.23},
+{7565, "12    Vul", 297.767083333333, 22.61,  4.95},
+{7566, "19    Cyg", 297.641666666667, 38.7225,  5.12},
+{7567, NULL, 297.655416666667, 40.5997222222222,  5.69},
+{7568, NULL, 297.695833333333, 37.8263888888889,  6.06},
+{7569, NULL, 298.014583333333, 11.6288888888889,  6.13},
+{7570, "55Eta Aql", 298.118333333333, 1.00555555555556,  3.90},
+{7571, NULL, 298.276666666667, -14.6030555555556,  6.48},
+{7572, NULL, 298.065, 10.3513888888889,  6.54},
+{7573, NULL, 298.006666666667, 24.9922222222222,  5.57},
+{7574, "9    Sge", 298.090833333333, 18.6719444444444,  6.23},
+{7575, NULL, 298.327916666667, -3.11444444444444,  5.65},
+{7576, "20    Cyg", 297.657083333333, 52.9880555555556,  5.03},
+{7577, NULL, 297.830833333333, 47.3772222222222,  6.20},
+{7578, NULL, 298.57375, -23.9411111111111,  6.18},
+{7579, NULL, 299.672083333333, -69.1638888888889,  5.75},
+{7580, NULL, 298.344166666667, 4.40055555555556,  6.53},
+{7581, "Iot Sgr", 298.815416666667, -41.8683333333333,  4.13},
+{7582, "63Eps Dra", 297.043333333333, 70.2677777777778,  3.83},
+{7583, NULL, 298.067916666667, 36.4322222222222,  6.10},
+{7584, "56    Aql", 298.534166666667, -8.57416666666667,  5.79},
+{7585, NULL, 298.77125, -33.0463888888889,  6.46},
+{7586, NULL, 299.240416666667, -57.9255555555556,  6.53},
+{7587, NULL, 299.275833333333, -58.9013888888889,  5.26},
+{7588, NULL, 299.720833333333, -68.7622222222222,  6.39},
+{7589, NULL, 297.99625, 47.0275,  5.62},
+{7590, "Eps Pav", 300.147916666667, -72.9105555555556,  3.96},
+{7591, NULL, 298.03, 47.9319444444444,  5.91},
+{7592, "13    Vul", 298.365416666667, 24.0797222222222,  4.58},
+{7593, "57    Aql", 298.656666666667, -8.22722222222222,  5.71},
+{7594, "57    Aql", 298.65875, -8.23722222222222,  6.49},
+{7595, "59Xi  Aql", 298.562083333333, 8.46138888888889,  4.71},
+{7596, "58    Aql", 298.686666666667, 0.273611111111111,  5.61},
+{7597, "58Ome Sgr", 298.96, -26.2994444444444,  4.70},
+{7598, NULL, 298.667916666667, 7.14027777777778,  6.15},
+{7599, NULL, 298.831666666667, -6.73416666666667,  6.51},
+{7600, NULL, 298.255, 47.8075,  6.29},
+{7601, NULL, 298.629583333333, 24.3194444444444,  5.52},
+{7602, "60Bet Aql", 298.828333333333, 6.40666666666667,  3.71},
+{7603, "Mu 1Pav", 300.095833333333, -66.9494444444445,  5.76},
+{7604, "59    Sgr", 299.236666666667, -27.17,  4.52},
+{7605, NULL, 299.422083333333, -38.0583333333333,  6.55},
+{7606, NULL, 298.70125, 36.9961111111111,  5.76},
+{7607, NULL, 298.777083333333, 30.1952777777778,  6.57},
+{7608, "23    Cyg", 298.3225, 57.5236111111111,  5.14},
+{7609, "10    Sge", 299.005416666667, 16.6347222222222,  5.36},
+{7610, "61Phi Aql", 299.059583333333, 11.4238888888889,  5.28},
+{7611, NULL, 298.3975, 59.7088888888889,  6.06},
+{7612, "Mu 2Pav", 300.468333333333, -66.9441666666667,  5.31},
+{7613, "22    Cyg", 298.965416666667, 38.4866666666667,  4.94},
+{7614, "61    Sgr", 299.4875, -15.4913888888889,  5.02},
+{7615, "21Eta Cyg", 299.076666666667, 35.0833333333333,  3.89},
+{7616, NULL, 299.250833333333, 20.9980555555556,  6.48},
+{7617, NULL, 299.735, -30.5380555555556,  6.28},
+{7618, "60    Sgr", 299.738333333333, -26.1955555555556,  4.83},
+{7619, "24Psi Cyg", 298.9075, 52.4388888888889,  4.92},
+{7620, NULL, 299.184166666667, 36.2508333333333,  6.02},
+{7621, NULL, 300.105416666667, -49.3511111111111,  6.17},
+{7622, "11    Sge", 299.439166666667, 16.7891666666667,  5.53},
+{7623, "The1Sgr", 299.934166666667, -35.2763888888889,  4.37},
+{7624, "The2Sgr", 299.96375, -34.6977777777778,  5.30},
+{7625, NULL, 300.43625, -59.3761111111111,  5.13},
+{7626, NULL, 298.842083333333, 58.2502777777778,  6.09},
+{7627, NULL, 300.110416666667, -43.0433333333333,  6.14},
+{7628, NULL, 299.307916666667, 40.3680555555556,  5.45},
+{7629, NULL, 300.06625, -37.7022222222222,  5.95},
+{7630, NULL, 300.20125, -45.1130555555556,  5.81},
+{7631, NULL, 300.084583333333, -33.7038888888889,  5.66},
+{7632, NULL, 299.187916666667, 50.9025,  6.43},
+{7633, NULL, 298.980833333333, 58.8461111111111,  4.96},
+{7634, NULL, 299.079166666667, 56.6869444444444,  6.12},
+{7635, "12Gam Sge", 299.689166666667, 19.4922222222222,  3.47},
+{7636, NULL, 299.844583333333, 1.37777777777778,  6.17},
+{7637, NULL, 299.9475, -9.95833333333333,  5.88},
+{7638, NULL, 299.484166666667, 42.2608333333333,  6.43},
+{7639, NULL, 300.36, -40.8141666666667,  6.29},
+{7640, NULL, 299.658333333333, 30.9836111111111,  5.49},
+{7641, "14    Vul", 299.79375, 23.1013888888889,  5.67},
+{7642, NULL, 299.643333333333, 38.1055555555556,  6.32},
+{7643, NULL, 300.349583333333, -22.7372222222222,  6.01},
+{7644, NULL, 301.386666666667, -67.3208333333333,  6.07},
+{7645, "13    Sge", 300.01375, 17.5166666666667,  5.37},
+{7646, NULL, 299.835416666667, 45.7722222222222,  5.92},
+{7647, "25    Cyg", 299.98, 37.0427777777778,  5.19},
+{7648, NULL, 300.245416666667, 8.55805555555556,  5.91},
+{7649, "63    Sgr", 300.494166666667, -13.6369444444444,  5.71},
+{7650, "62    Sgr", 300.664583333333, -27.7097222222222,  4.58},
+{7651, NULL, 299.814166666667, 52.0558333333333,  6.15},
+{7652, NULL, 300.889583333333, -37.9408333333333,  4.77},
+{7653, "15    Vul", 300.275416666667, 27.7536111111111,  4.64},
+{7654, NULL, 299.619583333333, 63.5341666666667,  5.96},
+{7655, NULL, 300.31375, 37.0988888888889,  6.20},
+{7656, NULL, 300.43625, 24.8002777777778,  5.88},
+{7657, "16    Vul", 300.505833333333, 24.9380555555556,  5.22},
+{7658, NULL, 300.934583333333, -22.5955555555556,  6.45},
+{7659, NULL, 301.081666666667, -32.0563888888889,  4.99},
+{7660, "26    Cyg", 300.34, 50.1047222222222,  5.05},
+{7661, NULL, 301.005, -7.46972222222222,  6.72},
+{7662, NULL, 300.818333333333, 18.5005555555556,  5.96},
+{7663, NULL, 302.085416666667, -66.3547222222222,  6.45},
+{7664, NULL, 300.875, 16.0313888888889,  5.67},
+{7665, "Del Pav", 302.181666666667, -66.1819444444445,  3.56},
+{7666, NULL, 299.674583333333, 70.3669444444444,  6.33},
+{7667, "62    Aql", 301.096666666667, -0.709444444444444,  5.68},
+{7668, NULL, 301.38375, -33,  6.53},
+{7669, "63Tau Aql", 301.034583333333, 7.27805555555556,  5.52},
+{7670, NULL, 300.905833333333, 29.8966666666667,  5.71},
+{7671, NULL, 301.2725, -11.5994444444444,  6.34},
+{7672, "15    Sge", 301.025833333333, 17.07,  5.80},
+{7673, "Xi  Tel", 301.846666666667, -52.8808333333333,  4.94},
+{7674, NULL, 301.89625, -55.0163888888889,  6.26},
+{7675, "65    Sgr", 301.36, -12.6652777777778,  6.55},
+{7676, "64    Dra", 300.36875, 64.8211111111111,  5.27},
+{7677, NULL, 301.244166666667, 23.2102777777778,  6.45},
+{7678, NULL, 301.150416666667, 32.2186111111111,  5.64},
+{7679, "16Eta Sge", 301.289583333333, 19.9911111111111,  5.10},
+{7680, NULL, 301.360416666667, 15.5002777777778,  6.34},
+{7681, NULL, 301.550833333333, -4.07833333333333,  6.47},
+{7682, "65    Dra", 300.584583333333, 64.6344444444445,  6.57},
+{7683, NULL, 301.290833333333, 38.4783333333333,  6.19},
+{7684, NULL, 301.12, 48.2297222222222,  6.16},
+{7685, "67Rho Dra", 300.704583333333, 67.8736111111111,  4.51},
+{7686, "69    Dra", 299.9025, 76.4813888888889,  6.20},
+{7687, NULL, 301.277916666667, 51.8394444444444,  6.14},
+{7688, "17    Vul", 301.7225, 23.6144444444444,  5.07},
+{7689, "27    Cyg", 301.590833333333, 35.9725,  5.36},
+{7690, "64    Aql", 302.0075, -0.678333333333333,  5.99},
+{7691, NULL, 302.78, -57.5238888888889,  6.37},
+{7692, NULL, 301.339583333333, 56.3413888888889,  6.21},
+{7693, NULL, 301.959583333333, 9.39972222222222,  6.43},
+{7694, NULL, 302.130416666667, -10.0627777777778,  6.18},
+{7695, NULL, 301.185833333333, 63.8905555555556,  6.26},
+{7696, NULL, 302.027083333333, 16.6641666666667,  6.42},
+{7697, NULL, 301.5575, 53.1658333333333,  5.85},
+{7698, NULL, 306.226666666667, -83.3105555555556,  6.17},
+{7699, NULL, 301.9225, 34.4230555555555,  6.11},
+{7700, NULL, 302.159583333333, 10.7258333333333,  6.31},
+{7701, "66    Dra", 301.386666666667, 61.9955555555556,  5.39},
+{7702, NULL, 301.797916666667, 50.2291666666667,  6.54},
+{7703, NULL, 302.799583333333, -36.1011111111111,  5.32},
+{7704, NULL, 301.222083333333, 68.0272222222222,  6.28},
+{7705, "17The Sge", 302.485833333333, 20.9152777777778,  6.48},
+{7706, NULL, 303.099583333333, -42.7805555555556,  6.22},
+{7707, NULL, 303.612083333333, -63.4158333333333,  6.09},
+{7708, "28    Cyg", 302.356666666667, 36.8397222222222,  4.93},
+{7709, NULL, 302.792083333333, -8.84222222222222,  6.49},
+{7710, "65The Aql", 302.82625, -0.821388888888889,  3.23},
+{7711, "18    Vul", 302.639583333333, 26.9041666666667,  5.52},
+{7712, "1Xi 1Cap", 302.99125, -12.3925,  6.34},
+{7713, NULL, 302.764583333333, 21.1347222222222,  6.22},
+{7714, NULL, 303.579166666667, -52.4455555555556,  5.65},
+{7715, "2Xi 2Cap", 303.107916666667, -12.6175,  5.85},
+{7716, NULL, 302.837916666667, 21.8755555555556,  6.26},
+{7717, NULL, 303.146666666667, 0.8675,  6.27},
+{7718, "19    Vul", 302.95, 26.8088888888889,  5.49},
+{7719, "20    Vul", 303.002916666667, 26.4788888888889,  5.92},
+{7720, "66    Aql", 303.307916666667, -1.00944444444444,  5.47},
+{7721, NULL, 303.015833333333, 47.7369444444444,  6.92},
+{7722, NULL, 303.8225, -27.0327777777778,  5.73},
+{7723, NULL, 303.419166666667, 24.2388888888889,  6.56},
+{7724, "67Rho Aql", 303.569166666667, 15.1975,  4.95},
+{7725, NULL, 303.960833333333, -30.0052777777778,  6.30},
+{7726, NULL, 303.1325, 51.4636111111111,  6.01},
+{7727, "68    Dra", 302.895416666667, 62.0786111111111,  5.75},
+{7728, NULL, 304.09875, -36.4544444444444,  6.39},
+{7729, NULL, 304.110416666667, -35.1977777777778,  6.53},
+{7730, "30    Cyg", 303.325, 46.8158333333333,  4.83},
+{7731, "21    Vul", 303.560416666667, 28.6947222222222,  5.18},
+{7732, NULL, 304.7625, -63.2311111111111,  6.27},
+{7733, NULL, 303.428333333333, 43.3791666666667,  6.14},
+{7734, NULL, 303.520833333333, 36.6052777777778,  6.45},
+{7735, "31    Cyg", 303.407916666667, 46.7413888888889,  3.79},
+{7736, "29    Cyg", 303.633333333333, 36.8063888888889,  4.97},
+{7737, NULL, 303.59, 42.1036111111111,  6.71},
+{7738, "3    Cap", 304.095, -12.3369444444444,  6.32},
+{7739, NULL, 303.81625, 25.5919444444444,  4.78},
+{7740, "33    Cyg", 303.349583333333, 56.5677777777778,  4.30},
+{7741, "22    Vul", 303.875833333333, 23.5086111111111,  5.15},
+{7742, NULL, 303.365416666667, 60.6405555555556,  5.79},
+{7743, NULL, 303.84875, 33.7294444444444,  5.66},
+{7744, "23    Vul", 303.942083333333, 27.8141666666667,  4.52},
+{7745, NULL, 304.733333333333, -47.7108333333333,  6.31},
+{7746, "18    Sge", 304.082083333333, 21.5986111111111,  6.13},
+{7747, "5Alp1Cap", 304.412083333333, -12.5083333333333,  4.24},
+{7748, "4    Cap", 304.505833333333, -21.81,  5.87},
+{7749, NULL, 304.824583333333, -47.5802777777778,  6.13},
+{7750, "1Kap Cep", 302.222083333333, 77.7113888888889,  4.39},
+{7751, "32    Cyg", 303.867916666667, 47.7144444444444,  3.98},
+{7752, NULL, 304.014166666667, 38.8977777777778,  6.27},
+{7753, "24    Vul", 304.19625, 24.6711111111111,  5.32},
+{7754, "6Alp2Cap", 304.51375, -12.5447222222222,  3.57},
+{7755, NULL, 303.930833333333, 50.2327777777778,  6.31},
+{7756, NULL, 304.0025, 45.5794444444444,  5.91},
+{7757, NULL, 304.1175, 37.0563888888889,  6.48},
+{7758, NULL, 305.134583333333, -55.0508333333333,  6.27},
+{7759, NULL, 304.230416666667, 40.365,  5.24},
+{7760, NULL, 304.38125, 29.1480555555556,  6.22},
+{7761, "7Sig Cap", 304.848333333333, -19.1186111111111,  5.28},
+{7762, NULL, 304.37125, 42.7219444444444,  6.29},
+{7763, "34    Cyg", 304.446666666667, 38.0330555555556,  4.81},
+{7764, NULL, 305.117083333333, -29.1972222222222,  6.30},
+{7765, NULL, 305.21625, -35.6736111111111,  6.46},
+{7766, NULL, 305.420833333333, -49.9994444444444,  6.27},
+{7767, NULL, 304.529166666667, 40.7322222222222,  5.84},
+{7768, NULL, 304.930416666667, -1.07861111111111,  6.06},
+{7769, "36    Cyg", 304.619166666667, 37,  5.58},
+{7770, "35    Cyg", 304.662916666667, 34.9827777777778,  5.17},
+{7771, NULL, 304.871666666667, 13.2169444444444,  6.21},
+{7772, NULL, 305.10875, -6.36166666666667,  6.63},
+{7773, "8Nu  Cap", 305.165833333333, -12.7591666666667,  4.76},
+{7774, NULL, 305.000833333333, 13.5480555555556,  5.95},
+{7775, NULL, 305.194166666667, -14.785,  6.10},
+{7776, "9Bet Cap", 305.252916666667, -14.7813888888889,  3.08},
+{7777, NULL, 304.706666666667, 46.3227777777778,  6.45},
+{7778, NULL, 305.085416666667, 14.5691666666667,  6.13},
+{7779, "Kap1Sgr", 305.614583333333, -42.0497222222222,  5.59},
+{7780, NULL, 305.089166666667, 17.7930555555556,  5.80},
+{7781, NULL, 304.603333333333, 55.3972222222222,  5.76},
+{7782, NULL, 304.95125, 37.1325,  6.57},
+{7783, NULL, 304.380416666667, 66.8538888888889,  5.93},
+{7784, NULL, 305.063333333333, 39.4033333333333,  6.23},
+{7785, NULL, 308.322916666667, -80.965,  5.77},
+{7786, NULL, 304.98375, 46.8375,  6.50},
+{7787, "Kap2Sgr", 305.971666666667, -42.4227777777778,  5.64},
+{7788, NULL, 305.753333333333, -9.65472222222222,  6.30},
+{7789, "25    Vul", 305.514166666667, 24.4461111111111,  5.54},
+{7790, "Alp Pav", 306.412083333333, -56.735,  1.94},
+{7791, NULL, 305.126666666667, 53.5961111111111,  6.18},
+{7792, "71    Dra", 304.902916666667, 62.2575,  5.72},
+{7793, NULL, 305.717916666667, 14.5513888888889,  6.17},
+{7794, NULL, 305.794583333333, 5.34305555555556,  5.31},
+{7795, NULL, 305.5125, 41.1313888888889,  6.39},
+{7796, "37Gam Cyg", 305.557083333333, 40.2566666666667,  2.20},
+{7797, NULL, 305.655833333333, 31.265,  6.09},
+{7798, NULL, 305.5225, 45.795,  5.58},
+{7799, NULL, 306.449583333333, -40.7963888888889,  6.09},
+{7800, NULL, 305.68875, 41.0261111111111,  5.93},
+{7801, NULL, 306.361666666667, -28.6633333333333,  5.85},
+{7802, NULL, 305.73125, 42.9833333333333,  6.20},
+{7803, NULL, 306.15625, 1.06861111111111,  6.15},
+{7804, NULL, 305.025, 68.8802777777778,  5.55},
+{7805, NULL, 305.2975, 63.9802777777778,  5.69},
+{7806, "39    Cyg", 305.965416666667, 32.19,  4.43},
+{7807, NULL, 305.935, 37.4763888888889,  5.90},
+{7808, NULL, 306.720833333333, -37.4030555555556,  6.25},
+{7809, NULL, 306.427083333333, -2.80027777777778,  6.11},
+{7810, NULL, 306.433333333333, 10.0563888888889,  6.33},
+{7811, NULL, 306.41875, 21.4097222222222,  5.66},
+{7812, NULL, 309.5775, -81.2888888888889,  5.91},
+{7813, NULL, 306.505, 19.865,  6.41},
+{7814, "10Pi  Cap", 306.83, -18.2116666666667,  5.25},
+{7815, NULL, 306.135, 53.5519444444444,  6.51},
+{7816, NULL, 306.596666666667, 17.3155555555556,  6.22},
+{7817, NULL, 307.194583333333, -35.5958333333333,  6.10},
+{7818, NULL, 306.27125, 59.6,  6.44},
+{7819, NULL, 307.181666666667, -15.7416666666667,  6.41},
+{7820, NULL, 307.03125, 8.4375,  6.25},
+{7821, "68    Aql", 307.10375, -3.35777777777778,  6.13},
+{7822, "11Rho Cap", 307.215, -17.8136111111111,  4.78},
+{7823, NULL, 306.782083333333, 34.3288888888889,  6.39},
+{7824, NULL, 307.07, 2.93694444444444,  6.21},
+{7825, NULL, 307.380416666667, -22.3916666666667,  6.16},
+{7826, "40    Cyg", 306.892916666667, 38.4402777777778,  5.62},
+{7827, NULL, 306.597916666667, 56.6388888888889,  6.36},
+{7828, "43    Cyg", 306.759583333333, 49.3833333333333,  5.69},
+{7829, "12Omi Cap", 307.46875, -18.5866666666667,  6.74},
+{7830, "12Omi Cap", 307.474583333333, -18.5833333333333,  5.94},
+{7831, "69    Aql", 307.4125, -2.88555555555556,  4.91},
+{7832, NULL, 307.736666666667, -29.1125,  6.39},
+{7833, NULL, 307.337916666667, 20.0877777777778,  6.55},
+{7834, "41    Cyg", 307.34875, 30.3686111111111,  4.01},
+{7835, "42    Cyg", 307.335, 36.4547222222222,  5.88},
+{7836, "1    Del", 307.575, 10.8958333333333,  6.08},
+{7837, NULL, 307.767916666667, -15.0563888888889,  6.12},
+{7838, NULL, 308.965416666667, -69.6111111111111,  6.11},
+{7839, NULL, 307.742083333333, 20.6058333333333,  6.18},
+{7840, NULL, 307.804166666667, 11.2605555555556,  7.11},
+{7841, NULL, 307.499583333333, 45.9286111111111,  6.41},
+{7842, NULL, 308.218333333333, -24.9438888888889,  6.36},
+{7843, NULL, 307.362916666667, 56.0680555555556,  5.91},
+{7844, "45Ome1Cyg", 307.514583333333, 48.9516666666667,  4.95},
+{7845, NULL, 308.09875, -9.85333333333333,  5.65},
+{7846, "Nu  Mic", 308.479583333333, -44.5161111111111,  5.11},
+{7847, "44    Cyg", 307.746666666667, 36.9358333333333,  6.19},
+{7848, "Phi1Pav", 308.895, -60.5816666666667,  4.76},
+{7849, NULL, 307.9925, 25.8044444444444,  6.34},
+{7850, "2The Cep", 307.395416666667, 62.9941666666667,  4.22},
+{7851, "46Ome2Cyg", 307.828333333333, 49.2202777777778,  5.44},
+{7852, "2Eps Del", 308.303333333333, 11.3033333333333,  4.03},
+{7853, NULL, 308.73125, -38.0897222222222,  6.44},
+{7854, NULL, 307.837916666667, 52.3097222222222,  6.18},
+{7855, NULL, 308.54875, -13.7211111111111,  6.13},
+{7856, NULL, 308.6975, -30.4736111111111,  6.40},
+{7857, NULL, 308.473333333333, 10.0597222222222,  6.56},
+{7858, "3Eta Del", 308.4875, 13.0272222222222,  5.38},
+{7859, "Rho Pav", 309.397083333333, -61.53,  4.88},
+{7860, NULL, 307.94375, 56.78,  6.14},
+{7861, NULL, 308.217916666667, 43.1916666666667,  6.60},
+{7862, NULL, 308.541666666667, 20.9852777777778,  6.48},
+{7863, "Mu 1Oct", 310.512083333333, -76.1805555555556,  6.00},
+{7864, "Mu 2Oct", 310.432083333333, -75.3505555555555,  6.55},
+{7865, NULL, 308.884166666667, -16.5258333333333,  6.19},
+{7866, "47    Cyg", 308.475833333333, 35.2508333333333,  4.61},
+{7867, NULL, 308.451666666667, 41.7722222222222,  6.49},
+{7868, NULL, 307.502916666667, 72.5316666666667,  6.27},
+{7869, "Alp Ind", 309.391666666667, -47.2913888888889,  3.11},
+{7870, NULL, 308.47875, 46.6938888888889,  5.78},
+{7871, "4Zet Del", 308.827083333333, 14.6741666666667,  4.68},
+{7872, NULL, 309.964166666667, -62.9077777777778,  6.22},
+{7873, "70    Aql", 309.181666666667, -2.55,  4.89},
+{7874, "26    Vul", 309.034583333333, 25.8825,  6.41},
+{7875, "Phi2Pav", 310.010833333333, -60.5488888888889,  5.12},
+{7876, NULL, 308.71, 51.8541666666667,  6.11},
+{7877, NULL, 309.467083333333, -25.1088888888889,  6.36},
+{7878, NULL, 309.32625, 0.0969444444444444,  6.22},
+{7879, "73    Dra", 307.876666666667, 74.9547222222222,  5.20},
+{7880, "27    Vul", 309.269583333333, 26.4619444444444,  5.59},
+{7881, "Ups Pav", 310.487916666667, -66.7608333333333,  5.15},
+{7882, "6Bet Del", 309.3875, 14.5952777777778,  3.63},
+{7883, "5Iot Del", 309.454583333333, 11.3777777777778,  5.43},
+{7884, "71    Aql", 309.584583333333, -1.10527777777778,  4.32},
+{7885, "48    Cyg", 309.3825, 31.5725,  6.32},
+{7886, NULL, 309.4775, 18.2691666666667,  6.25},
+{7887, NULL, 309.385833333333, 31.5219444444444,  6.49},
+{7888, NULL, 309.348333333333, 38.3286111111111,  6.20},
+{7889, "14Tau Cap", 309.818333333333, -14.9547222222222,  5.22},
+{7890, NULL, 309.805, -2.41277777777778,  6.22},
+{7891, "29    Vul", 309.630416666667, 21.2011111111111,  4.82},
+{7892, "8The Del", 309.682916666667, 13.315,  5.72},
+{7893, NULL, 310.0825, -33.4319444444444,  5.47},
+{7894, "28    Vul", 309.632916666667, 24.1161111111111,  5.04},
+{7895, NULL, 309.64625, 23.6805555555556,  5.91},
+{7896, "7Kap Del", 309.7825, 10.0861111111111,  5.05},
+{7897, "1    Aqr", 309.85375, 0.486388888888889,  5.16},
+{7898, NULL, 310.04875, -23.7738888888889,  6.37},
+{7899, NULL, 309.770833333333, 15.8380555555556,  5.97},
+{7900, "15Ups Cap", 310.0125, -18.1386111111111,  5.10},
+{7901, "75    Dra", 307.060833333333, 81.4227777777778,  5.46},
+{7902, NULL, 310.15, -26.645,  6.51},
+{7903, NULL, 309.794166666667, 21.8172222222222,  6.08},
+{7904, NULL, 309.747916666667, 30.3344444444444,  5.68},
+{7905, NULL, 310.135416666667, -16.1241666666667,  5.80},
+{7906, "9Alp Del", 309.909583333333, 15.9119444444444,  3.77},
+{7907, NULL, 309.965833333333, 11.2497222222222,  6.42},
+{7908, "74    Dra", 307.364583333333, 81.0913888888889,  5.96},
+{7909, NULL, 310.34875, -31.5983333333333,  5.76},
+{7910, NULL, 310.350416666667, -26,  6.28},
+{7911, NULL, 309.88875, 40.5794444444444,  6.06},
+{7912, NULL, 309.84625, 45.6669444444444,  6.58},
+{7913, "Bet Pav", 311.239583333333, -66.2030555555556,  3.42},
+{7914, NULL, 310.188333333333, 19.9352777777778,  6.45},
+{7915, NULL, 310.720833333333, -39.5586111111111,  6.29},
+{7916, NULL, 309.750833333333, 56.005,  6.48},
+{7917, NULL, 310.150833333333, 29.8052777777778,  6.08},
+{7918, "10    Del", 310.3175, 14.5830555555556,  5.99},
+{7919, NULL, 310.012916666667, 43.4586111111111,  5.95},
+{7920, "Eta Ind", 311.009583333333, -51.9211111111111,  4.51},
+{7921, "49    Cyg", 310.260833333333, 32.3072222222222,  5.51},
+{7922, NULL, 310.251666666667, 39.0822222222222,  6.51},
+{7923, NULL, 310.4925, 17.5213888888889,  6.22},
+{7924, "50Alp Cyg", 310.357916666667, 45.2802777777778,  1.25},
+{7925, NULL, 310.074583333333, 60.5052777777778,  6.01},
+{7926, NULL, 310.485416666667, 41.7169444444444,  5.67},
+{7927, NULL, 310.5925, 35.4561111111111,  6.66},
+{7928, "11Del Del", 310.864583333333, 15.0744444444444,  4.43},
+{7929, "51    Cyg", 310.5525, 50.34,  5.39},
+{7930, NULL, 307.262916666667, 83.6255555555556,  6.19},
+{7931, NULL, 311.305, -27.2472222222222,  6.50},
+{7932, NULL, 310.850833333333, 35.5877777777778,  6.47},
+{7933, NULL, 311.58375, -39.1991666666667,  5.50},
+{7934, "Sig Pav", 312.325416666667, -68.7763888888889,  5.41},
+{7935, NULL, 311.5775, -36.1202777777778,  6.49},
+{7936, "16Psi Cap", 311.52375, -25.2708333333333,  4.14},
+{7937, "17    Cap", 311.541666666667, -21.5141666666667,  5.93},
+{7938, NULL, 310.665416666667, 60.6013888888889,  6.15},
+{7939, "30    Vul", 311.21875, 25.2705555555556,  4.91},
+{7940, NULL, 310.80625, 57.1141666666667,  6.32},
+{7941, NULL, 311.3675, 18.0902777777778,  6.38},
+{7942, "52    Cyg", 311.415416666667, 30.7197222222222,  4.22},
+{7943, "Iot Mic", 312.121666666667, -43.9886111111111,  5.11},
+{7944, NULL, 311.091666666667, 56.4880555555556,  5.78},
+{7945, "4    Cep", 310.795833333333, 66.6575,  5.58},
+{7946, NULL, 311.765, -2.48666666666667,  6.27},
+{7947, "12Gam1Del", 311.66125, 16.1244444444444,  5.14},
+{7948, "12Gam2Del", 311.664583333333, 16.1241666666667,  4.27},
+{7949, "53Eps Cyg", 311.552916666667, 33.9702777777778,  2.46},
+{7950, "2Eps Aqr", 311.919166666667, -9.49583333333333,  3.77},
+{7951, "3    Aqr", 311.934166666667, -5.02777777777778,  4.42},
+{7952, "Zet Ind", 312.370833333333, -46.2269444444444,  4.89},
+{7953, "13    Del", 311.95125, 6.00833333333333,  5.58},
+{7954, NULL, 311.949166666667, 3.30666666666667,  6.40},
+{7955, NULL, 311.337916666667, 57.5797222222222,  4.51},
+{7956, NULL, 311.795, 34.3741666666667,  4.92},
+{7957, "3Eta Cep", 311.3225, 61.8388888888889,  3.43},
+{7958, NULL, 311.660416666667, 46.5316666666667,  6.30},
+{7959, NULL, 312.909583333333, -62.4291666666667,  6.28},
+{7960, NULL, 312.911666666667, -62.4291666666667,  6.59},
+{7961, NULL, 312.323333333333, -25.7813888888889,  5.86},
+{7962, NULL, 311.588333333333, 52.9952777777778,  6.33},
+{7963, "54Lam Cyg", 311.852083333333, 36.4908333333333,  4.53},
+{7964, NULL, 312.335416666667, -18.0358333333333,  6.21},
+{7965, "Alp Mic", 312.492083333333, -33.7797222222222,  4.90},
+{7966, NULL, 311.836666666667, 45.5797222222222,  6.40},
+{7967, NULL, 311.137916666667, 69.7519444444444,  6.41},
+{7968, "Iot Ind", 312.875416666667, -51.6083333333333,  5.05},
+{7969, NULL, 311.955416666667, 47.8319444444444,  5.57},
+{7970, NULL, 312.69625, -32.0544444444444,  6.36},
+{7971, NULL, 312.752916666667, -37.9133333333333,  5.52},
+{7972, NULL, 311.97, 52.4072222222222,  6.27},
+{7973, "15    Del", 312.4075, 12.5452777777778,  5.98},
+{7974, "14    Del", 312.45125, 7.86416666666667,  6.33},
+{7975, NULL, 312.49625, 5.54472222222222,  6.21},
+{7976, NULL, 312.674166666667, -12.545,  5.88},
+{7977, "55    Cyg", 312.234583333333, 46.1141666666667,  4.84},
+{7978, NULL, 312.177916666667, 51.9105555555556,  6.29},
+{7979, "Bet Mic", 312.995, -33.1772222222222,  6.04},
+{7980, "18Ome Cap", 312.955416666667, -26.9191666666667,  4.11},
+{7981, NULL, 312.654166666667, 18.0513888888889,  6.52},
+{7982, "4    Aqr", 312.857083333333, -5.62638888888889,  5.99},
+{7983, NULL, 312.477916666667, 46.6611111111111,  6.33},
+{7984, "56    Cyg", 312.520416666667, 44.0594444444444,  5.04},
+{7985, "5    Aqr", 313.03625, -5.50694444444444,  5.55},
+{7986, "Bet Ind", 313.7025, -58.4541666666667,  3.65},
+{7987, NULL, 313.4175, -39.81,  5.35},
+{7988, NULL, 312.8675, 28.2505555555556,  5.77},
+{7989, NULL, 313.255, -23.7830555555556,  6.33},
+{7990, "6Mu  Aqr", 313.163333333333, -8.98333333333333,  4.73},
+{7991, NULL, 313.354166666667, -30.7186111111111,  6.35},
+{7992, NULL, 313.645833333333, -50.7277777777778,  6.24},
+{7993, NULL, 312.3225, 64.0422222222222,  6.45},
+{7994, NULL, 313.273333333333, -11.5736111111111,  6.38},
+{7995, "31    Vul", 313.032083333333, 27.0969444444444,  4.59},
+{7996, NULL, 313.00125, 32.8491666666667,  6.44},
+{7997, NULL, 313.528333333333, -27.9255555555556,  6.41},
+{7998, NULL, 313.493333333333, -6.88972222222222,  6.44},
+{7999, NULL, 313.280833333333, 29.6494444444444,  6.34},
+{8000, "19    Cap", 313.699583333333, -17.9230555555556,  5.78},
+{8001, "57    Cyg", 313.311666666667, 44.3872222222222,  4.78},
+{8002, "76    Dra", 310.646666666667, 82.5311111111111,  5.75},
+{8003, NULL, 313.3275, 45.1819444444444,  5.45},
+{8004, NULL, 313.36, 42.4102777777778,  6.66},
+{8005, NULL, 313.474583333333, 33.4377777777778,  5.47},
+{8006, NULL, 313.78375, -1.37333333333333,  6.55},
+{8007, NULL, 313.593333333333, 28.5219444444444,  6.56},
+{8008, "32    Vul", 313.64, 28.0575,  5.01},
+{8009, NULL, 313.592916666667, 40.7030555555556,  6.70},
+{8010, NULL, 313.919583333333, 4.53277777777778,  6.05},
+{8011, "17    Del", 313.902916666667, 13.7213888888889,  5.17},
+{8012, "16    Del", 313.910833333333, 12.5686111111111,  5.58},
+{8013, NULL, 314.197083333333, -26.2963888888889,  5.70},
+{8014, NULL, 314.07625, -3.56138888888889,  6.57},
+{8015, "7    Aqr", 314.225, -9.6975,  5.51},
+{8016, NULL, 311.889166666667, 80.5522222222222,  5.39},
+{8017, NULL, 314.294166666667, 0.463611111111111,  6.05},
+{8018, NULL, 314.419166666667, -16.0316666666667,  5.87},
+{8019, NULL, 315.367083333333, -68.2097222222222,  6.37},
+{8020, NULL, 313.9575, 47.4177777777778,  5.67},
+{8021, "Alp Oct", 316.179166666667, -77.0238888888889,  5.15},
+{8022, NULL, 314.05375, 51.075,  6.63},
+{8023, NULL, 314.144583333333, 44.925,  5.96},
+{8024, NULL, 314.674583333333, -14.4827777777778,  6.01},
+{8025, NULL, 314.10625, 50.7286111111111,  5.81},
+{8026, NULL, 314.107916666667, 49.1958333333333,  5.90},
+{8027, NULL, 315.089583333333, -51.2652777777778,  5.76},
+{8028, "58Nu  Cyg", 314.293333333333, 41.1672222222222,  3.94},
+{8029, NULL, 314.070833333333, 56.8875,  6.23},
+{8030, "18    Del", 314.607916666667, 10.8391666666667,  5.48},
+{8031, NULL, 314.99875, -36.1297222222222,  6.11},
+{8032, "33    Vul", 314.568333333333, 22.3258333333333,  5.31},
+{8033, "20    Cap", 314.900416666667, -19.0352777777778,  6.25},
+{8034, "1Eps Equ", 314.768333333333, 4.29361111111111,  5.23},
+{8035, NULL, 314.58125, 44.4716666666667,  5.55},
+{8036, NULL, 314.628333333333, 41.9402777777778,  6.16},
+{8037, NULL, 314.961666666667, 16.8241666666667,  6.66},
+{8038, NULL, 315.01625, 7.51638888888889,  5.99},
+{8039, "Gam Mic", 315.322916666667, -32.2577777777778,  4.67},
+{8040, NULL, 314.625416666667, 50.4622222222222,  5.61},
+{8041, "11    Aqr", 315.140833333333, -4.73027777777778,  6.21},
+{8042, NULL, 315.5525, -43.0019444444444,  6.64},
+{8043, NULL, 313.684583333333, 75.9255555555556,  6.05},
+{8044, NULL, 315.115416666667, 19.3294444444444,  5.65},
+{8045, NULL, 315.43875, -26.8811111111111,  6.05},
+{8046, NULL, 315.613333333333, -38.5305555555556,  5.94},
+{8047, "59    Cyg", 314.956666666667, 47.5211111111111,  4.74},
+{8048, "Zet Mic", 315.741666666667, -38.6316666666667,  5.30},
+{8049, NULL, 314.855833333333, 59.4386111111111,  5.51},
+{8050, NULL, 315.7925, -27.7319444444444,  6.25},
+{8051, NULL, 315.30375, 36.0261111111111,  5.97},
+{8052, NULL, 317.199583333333, -76.2125,  6.58},
+{8053, "60    Cyg", 315.295416666667, 46.1558333333333,  5.37},
+{8054, NULL, 315.748333333333, -0.924722222222222,  6.50},
+{8055, "Mu  Ind", 316.309166666667, -54.7272222222222,  5.16},
+{8056, NULL, 315.7625, 1.53194444444444,  6.25},
+{8057, NULL, 315.7575, 14.73,  6.31},
+{8058, "12    Aqr", 316.019166666667, -5.82333333333333,  7.31},
+{8059, "12    Aqr", 316.019583333333, -5.82305555555556,  5.89},
+{8060, "22Eta Cap", 316.10125, -19.855,  4.84},
+{8061, NULL, 317.342916666667, -73.1730555555556,  5.68},
+{8062, NULL, 315.600416666667, 44.7911111111111,  6.19},
+{8063, NULL, 315.77, 38.6575,  6.07},
+{8064, NULL, 315.702083333333, 45.8488888888889,  6.48},
+{8065, NULL, 315.537916666667, 56.6697222222222,  5.83},
+{8066, "3    Equ", 316.144583333333, 5.50277777777778,  5.61},
+{8067, NULL, 316.17375, 2.94194444444444,  6.42},
+{8068, NULL, 316.189166666667, 2.26972222222222,  6.33},
+{8069, "Eta Mic", 316.60625, -41.3861111111111,  5.53},
+{8070, "Del Mic", 316.505, -30.125,  5.68},
+{8071, NULL, 315.967083333333, 41.6280555555556,  6.33},
+{8072, NULL, 315.858333333333, 50.3519444444444,  6.37},
+{8073, NULL, 317.137083333333, -63.9288888888889,  5.76},
+{8074, NULL, 315.930416666667, 46.8619444444444,  6.32},
+{8075, "23The Cap", 316.486666666667, -17.2327777777778,  4.07},
+{8076, NULL, 316.602916666667, -32.3416666666667,  5.18},
+{8077, "4    Equ", 316.36125, 5.95833333333333,  5.94},
+{8078, NULL, 315.948333333333, 53.2861111111111,  5.90},
+{8079, "62Xi  Cyg", 316.232916666667, 43.9277777777778,  3.72},
+{8080, "24    Cap", 316.782083333333, -25.0058333333333,  4.50},
+{8081, NULL, 317.83625, -72.5441666666667,  6.20},
+{8082, NULL, 316.597916666667, 26.9244444444444,  6.12},
+{8083, NULL, 316.935833333333, -17.4552777777778,  6.17},
+{8084, NULL, 316.62625, 31.1847222222222,  5.82},
+{8085, "61    Cyg", 316.7275, 38.7458333333333,  5.21},
+{8086, "61    Cyg", 316.730416666667, 38.7433333333333,  6.03},
+{8087, "25Chi Cap", 317.14, -21.1936111111111,  5.30},
+{8088, NULL, 316.89, 15.6586111111111,  6.34},
+{8089, "63    Cyg", 316.650416666667, 47.6483333333333,  4.55},
+{8090, NULL, 317.1175, 6.98944444444444,  6.15},
+{8091, "27    Cap", 317.3875, -20.5563888888889,  6.25},
+{8092, "Omi Pav", 318.335416666667, -70.1263888888889,  5.02},
+{8093, "13Nu  Aqr", 317.39875, -11.3716666666667,  4.51},
+{8094, NULL, 317.162083333333, 30.2058333333333,  5.59},
+{8095, NULL, 317.492916666667, 2.94333333333333,  6.45},
+{8096, NULL, 317.695416666667, -9.35388888888889,  6.27},
+{8097, "5Gam Equ", 317.585416666667, 10.1316666666667,  4.69},
+{8098, "6    Equ", 317.63, 10.0488888888889,  6.07},
+{8099, NULL, 316.597083333333, 71.4319444444445,  5.87},
+{8100, NULL, 318.056666666667, -40.2694444444444,  5.83},
+{8101, NULL, 317.633333333333, 22.4547222222222,  6.68},
+{8102, NULL, 317.922083333333, -14.4722222222222,  6.48},
+{8103, NULL, 317.494166666667, 45.5025,  6.63},
+{8104, NULL, 318.262916666667, -39.4252777777778,  5.26},
+{8105, NULL, 317.76625, 36.2991666666667,  6.54},
+{8106, NULL, 317.565, 53.5633333333333,  5.73},
+{8107, NULL, 317.629166666667, 47.6919444444444,  6.46},
+{8108, NULL, 318.32875, -36.4238888888889,  5.96},
+{8109, NULL, 317.370416666667, 63.2955555555556,  6.54},
+{8110, NULL, 318.322083333333, -27.6194444444444,  5.42},
+{8111, NULL, 319.567083333333, -75.3466666666667,  6.63},
+{8112, NULL, 316.372083333333, 78.1263888888889,  5.91},
+{8113, NULL, 317.383333333333, 68.4902777777778,  7.33},
+{8114, NULL, 318.94125, -53.2630555555556,  5.75},
+{8115, "64Zet Cyg", 318.234166666667, 30.2269444444444,  3.20},
+{8116, NULL, 318.37, 15.9825,  6.27},
+{8117, NULL, 318.81125, -40.5063888888889,  6.21},
+{8118, NULL, 318.569583333333, -10.6052777777778,  6.77},
+{8119, NULL, 317.950833333333, 59.9863888888889,  5.64},
+{8120, NULL, 318.359583333333, 36.6336111111111,  6.05},
+{8121, NULL, 318.654166666667, 0.0922222222222222,  6.38},
+{8122, NULL, 318.7775, -17.345,  6.04},
+{8123, "7Del Equ", 318.620416666667, 10.0069444444444,  4.49},
+{8124, NULL, 318.945, -36.2108333333333,  6.12},
+{8125, NULL, 319.50125, -64.6816666666667,  6.31},
+{8126, NULL, 318.542916666667, 29.9011111111111,  6.17},
+{8127, "28Phi Cap", 318.907916666667, -20.6516666666667,  5.24},
+{8128, "29    Cap", 318.937083333333, -15.1713888888889,  5.28},
+{8129, NULL, 323.0175, -84.81,  6.45},
+{8130, "65Tau Cyg", 318.697916666667, 38.0455555555556,  3.72},
+{8131, "8Alp Equ", 318.955833333333, 5.24777777777778,  3.92},
+{8132, NULL, 319.165, -1.60777777777778,  6.48},
+{8133, NULL, 318.4275, 64.4038888888889,  6.39},
+{8134, NULL, 319.30625, -13.2788888888889,  6.40},
+{8135, "Eps Mic", 319.484583333333, -32.1725,  4.71},
+{8136, NULL, 318.903333333333, 47.9736111111111,  6.46},
+{8137, "30    Cap", 319.48875, -17.9852777777778,  5.43},
+{8138, NULL, 319.123333333333, 42.2513888888889,  6.43},
+{8139, "31    Cap", 319.565416666667, -17.4622222222222,  7.05},
+{8140, "The Ind", 319.966666666667, -53.4497222222222,  4.39},
+{8141, "15    Aqr", 319.54625, -4.51944444444444,  5.82},
+{8142, NULL, 319.726666666667, -28.7655555555556,  6.40},
+{8143, "67Sig Cyg", 319.354166666667, 39.3947222222222,  4.23},
+{8144, NULL, 319.346666666667, 42.6833333333333,  6.19},
+{8145, NULL, 320.039583333333, -45.0222222222222,  6.00},
+{8146, "66Ups Cyg", 319.479583333333, 34.8969444444444,  4.43},
+{8147, NULL, 319.258333333333, 53.9975,  6.13},
+{8148, NULL, 319.940833333333, -26.3530555555556,  6.56},
+{8149, NULL, 319.716666666667, 11.2033333333333,  5.96},
+{8150, NULL, 319.309583333333, 55.7980555555556,  5.98},
+{8151, "The1Mic", 320.19, -40.8097222222222,  4.82},
+{8152, NULL, 320.318333333333, -49.9377777777778,  6.38},
+{8153, NULL, 319.328333333333, 58.6116666666667,  6.42},
+{8154, "68    Cyg", 319.613333333333, 43.9458333333333,  5.00},
+{8155, NULL, 319.730416666667, 41.0408333333333,  6.15},
+{8156, NULL, 321.069583333333, -69.7341666666667,  6.41},
+{8157, NULL, 319.8425, 38.2375,  5.83},
+{8158, NULL, 320.058333333333, 22.0263888888889,  6.29},
+{8159, NULL, 321.325416666667, -71.7994444444444,  6.09},
+{8160, "16    Aqr", 320.267916666667, -4.56,  5.87},
+{8161, NULL, 319.87, 49.5102777777778,  5.76},
+{8162, "5Alp Cep", 319.645, 62.5855555555556,  2.44},
+{8163, "9    Equ", 320.27, 7.35444444444444,  5.82},
+{8164, NULL, 319.815833333333, 58.6236111111111,  5.66},
+{8165, NULL, 320.268333333333, 23.8558333333333,  5.57},
+{8166, NULL, 320.20875, 32.4527777777778,  5.68},
+{8167, "32Iot Cap", 320.561666666667, -16.8344444444444,  4.28},
+{8168, NULL, 318.925833333333, 77.0122222222222,  5.95},
+{8169, NULL, 320.341666666667, 32.6127777777778,  6.04},
+{8170, NULL, 320.255833333333, 40.3455555555556,  6.40},
+{8171, "6    Cep", 319.8425, 64.8719444444444,  5.18},
+{8172, NULL, 320.752083333333, -22.6688888888889,  5.60},
+{8173, "1    Peg", 320.521666666667, 19.8044444444444,  4.08},
+{8174, NULL, 318.339583333333, 81.2308333333333,  6.15},
+{8175, "17    Aqr", 320.734583333333, -9.31944444444444,  5.99},
+{8176, NULL, 323.476666666667, -82.6830555555556,  6.38},
+{8177, NULL, 321.086666666667, -46.615,  6.31},
+{8178, "10Bet Equ", 320.723333333333, 6.81111111111111,  5.16},
+{8179, NULL, 320.139583333333, 60.7569444444444,  6.11},
+{8180, "The2Mic", 321.103333333333, -41.0066666666667,  5.77},
+{8181, "Gam Pav", 321.610833333333, -65.3661111111111,  4.22},
+{8182, NULL, 320.674583333333, 30.3097222222222,  6.05},
+{8183, "33    Cap", 321.04, -20.8519444444444,  5.41},
+{8184, NULL, 321.032916666667, -22.7469444444444,  6.38},
+{8185, NULL, 320.501666666667, 49.3888888888889,  5.69},
+{8186, NULL, 320.695416666667, 38.6341666666667,  6.63},
+{8187, "18    Aqr", 321.047916666667, -12.8780555555556,  5.49},
+{8188, "Gam Ind", 321.564166666667, -54.6605555555556,  6.12},
+{8189, NULL, 320.845833333333, 37.4066666666667,  6.58},
+{8190, NULL, 320.995, 24.2741666666667,  5.71},
+{8191, NULL, 321.1025, 10.1741666666667,  6.35},
+{8192, "20    Aqr", 321.215416666667, -3.39833333333333,  6.36},
+{8193, NULL, 320.95125, 37.3513888888889,  6.47},
+{8194, NULL, 321.030833333333, 25.3122222222222,  6.15},
+{8195, "19    Aqr", 321.304583333333, -9.74861111111111,  5.70},
+{8196, NULL, 322.187083333333, -69.5052777777778,  5.34},
+{8197, NULL, 321.09625, 24.5288888888889,  6.32},
+{8198, NULL, 321.141666666667, 26.1744444444444,  5.68},
+{8199, "21    Aqr", 321.320833333333, -3.55666666666667,  5.49},
+{8200, NULL, 321.595416666667, -37.8294444444444,  5.63},
+{8201, NULL, 323.335833333333, -80.0391666666667,  6.47},
+{8202, NULL, 321.756666666667, -42.5477777777778,  5.51},
+{8203, NULL, 321.464583333333, 0.534444444444444,  6.46},
+{8204, "34Zet Cap", 321.666666666667, -22.4113888888889,  3.74},
+{8205, NULL, 321.617083333333, 1.10333333333333,  6.13},
+{8206, NULL, 321.23125, 49.3233333333333,  6.58},
+{8207, "35    Cap", 321.811666666667, -21.1961111111111,  5.78},
+{8208, NULL, 321.331666666667, 46.7144444444444,  5.60},
+{8209, "69    Cyg", 321.445833333333, 36.6675,  5.94},
+{8210, NULL, 321.61125, 19.3755555555556,  6.07},
+{8211, NULL, 322.25125, -53.7058333333333,  6.39},
+{8212, NULL, 322.057916666667, -11.5683333333333,  6.61},
+{8213, "36    Cap", 322.180833333333, -21.8072222222222,  4.51},
+{8214, "5    PsA", 322.265833333333, -31.2386111111111,  6.50},
+{8215, "70    Cyg", 321.839166666667, 37.1166666666667,  5.31},
+{8216, NULL, 321.715, 48.835,  5.31},
+{8217, "35    Vul", 321.917083333333, 27.6086111111111,  5.41},
+{8218, NULL, 321.6875, 52.8986111111111,  6.03},
+{8219, NULL, 322.103333333333, 8.19555555555556,  6.40},
+{8220, NULL, 322.034583333333, 32.2252777777778,  5.80},
+{8221, NULL, 322.249583333333, 17.9058333333333,  6.44},
+{8222, NULL, 322.498333333333, -19.1477777777778,  6.57},
+{8223, NULL, 322.249583333333, 22.1794444444444,  5.93},
+{8224, NULL, 321.855416666667, 59.75,  6.10},
+{8225, "2    Peg", 322.487083333333, 23.6388888888889,  4.57},
+{8226, NULL, 322.219583333333, 55.4186111111111,  6.12},
+{8227, "7    Cep", 321.942083333333, 66.8091666666667,  5.44},
+{8228, "71    Cyg", 322.3625, 46.5405555555556,  5.24},
+{8229, "Xi  Gru", 323.024583333333, -41.1791666666667,  5.29},
+{8230, "6    PsA", 323.060833333333, -33.9447222222222,  5.97},
+{8231, NULL, 322.79, 12.1375,  6.08},
+{8232, "22Bet Aqr", 322.889583333333, -5.57111111111111,  2.91},
+{8233, NULL, 323.32375, -52.7375,  6.41},
+{8234, NULL, 324.734166666667, -79.4425,  6.18},
+{8235, NULL, 323.13875, -24.5905555555556,  6.43},
+{8236, NULL, 323.347916666667, -44.8486111111111,  5.57},
+{8237, NULL, 322.585, 52.9580555555556,  6.02},
+{8238, "8Bet Cep", 322.165, 70.5608333333333,  3.23},
+{8239, NULL, 321.207083333333, 80.5247222222222,  5.97},
+{8240, NULL, 323.112916666667, 23.3944444444444,  6.70},
+{8241, NULL, 323.570833333333, -42.925,  6.32},
+{8242, NULL, 322.864583333333, 52.62,  6.16},
+{8243, NULL, 322.747083333333, 60.4594444444445,  5.53},
+{8244, NULL, 323.720833333333, -29.6961111111111,  6.41},
+{8245, "37    Cap", 323.7125, -20.0844444444444,  5.69},
+{8246, NULL, 323.235833333333, 49.9777777777778,  5.75},
+{8247, NULL, 323.81625, -23.4541666666667,  6.40},
+{8248, NULL, 323.324583333333, 45.8541666666667,  6.25},
+{8249, NULL, 324.512083333333, -64.8241666666667,  6.20},
+{8250, NULL, 323.641666666667, 22.7547222222222,  6.47},
+{8251, NULL, 323.823333333333, -3.98305555555556,  5.77},
+{8252, "73Rho Cyg", 323.495416666667, 45.5919444444444,  4.02},
+{8253, "8    PsA", 324.045833333333, -26.1713888888889,  5.73},
+{8254, "Nu  Oct", 325.36875, -77.39,  3.76},
+{8255, "72    Cyg", 323.694166666667, 38.5341666666667,  4.90},
+{8256, "7    PsA", 324.20375, -33.0480555555556,  6.11},
+{8257, NULL, 323.829166666667, 28.1972222222222,  6.31},
+{8258, NULL, 323.8625, 24.4522222222222,  6.11},
+{8259, NULL, 323.614583333333, 51.6983333333333,  6.15},
+{8260, "39Eps Cap", 324.27, -19.4661111111111,  4.68},
+{8261, NULL, 324.057916666667, 30.0555555555556,  6.36},
+{8262, NULL, 324.01, 45.3747222222222,  5.53},
+{8263, NULL, 324.390833333333, -0.390277777777778,  6.25},
+{8264, "23Xi  Aqr", 324.437916666667, -7.85416666666667,  4.69},
+{8265, "3    Peg", 324.432083333333, 6.61833333333333,  6.18},
+{8266, "74    Cyg", 324.2375, 40.4136111111111,  5.01},
+{8267, "5    Peg", 324.439166666667, 19.3186111111111,  5.45},
+{8268, NULL, 324.775416666667, -33.6791666666667,  6.28},
+{8269, NULL, 324.99875, -52.3591666666667,  6.21},
+{8270, "4    Peg", 324.632916666667, 5.77166666666667,  5.67},
+{8271, NULL, 325.14, -55.7375,  6.33},
+{8272, NULL, 324.36625, 44.6966666666667,  6.20},
+{8273, NULL, 324.867083333333, -10.5769444444444,  6.08},
+{8274, NULL, 324.6875, 25.4988888888889,  6.16},
+{8275, NULL, 324.41125, 54.0422222222222,  6.15},
+{8276, NULL, 324.754583333333, 20.2652777777778,  5.85},
+{8277, "25    Aqr", 324.88875, 2.24361111111111,  5.10},
+{8278, "40Gam Cap", 325.022916666667, -16.6622222222222,  3.68},
+{8279, "9    Cep", 324.48, 62.0819444444444,  4.73},
+{8280, "Lam Oct", 327.72625, -82.7191666666667,  5.29},
+{8281, NULL, 324.74, 57.4891666666667,  5.62},
+{8282, NULL, 325.442083333333, -25.1019444444444,  6.49},
+{8283, "42    Cap", 325.387083333333, -14.0475,  5.18},
+{8284, "75    Cyg", 325.04625, 43.2738888888889,  5.11},
+{8285, "41    Cap", 325.503333333333, -23.2627777777778,  5.24},
+{8286, NULL, 326.37, -71.0088888888889,  6.01},
+{8287, "26    Aqr", 325.542083333333, 1.28527777777778,  5.67},
+{8288, "43Kap Cap", 325.664583333333, -18.8663888888889,  4.73},
+{8289, "7    Peg", 325.564583333333, 5.68,  5.30},
+{8290, NULL, 325.180416666667, 54.8722222222222,  6.20},
+{8291, "76    Cyg", 325.392916666667, 40.8052777777778,  6.11},
+{8292, NULL, 325.6375, 10.8247222222222,  6.09},
+{8293, NULL, 325.80625, -19.6208333333333,  6.22},
+{8294, NULL, 341.369166666667, -88.8183333333333,  6.57},
+{8295, "44    Cap", 325.768333333333, -14.3997222222222,  5.88},
+{8297, NULL, 325.504583333333, 35.5102777777778,  6.07},
+{8298, NULL, 325.535, 45.7658333333333,  6.17},
+{8299, NULL, 326.122916666667, -38.5525,  6.30},
+{8300, "77    Cyg", 325.595416666667, 41.0772222222222,  5.69},
+{8301, "80Pi 1Cyg", 325.52375, 51.1897222222222,  4.67},
+{8302, "45    Cap", 326.004166666667, -14.7494444444444,  5.99},
+{8303, NULL, 326.329166666667, -49.4986111111111,  6.45},
+{8304, NULL, 325.662083333333, 49.6002777777778,  6.09},
+{8305, "9Iot PsA", 326.236666666667, -33.0258333333333,  4.34},
+{8306, NULL, 325.776666666667, 41.155,  5.49},
+{8307, "79    Cyg", 325.857083333333, 38.2838888888889,  5.65},
+{8308, "8Eps Peg", 326.046666666667, 9.875,  2.39},
+{8309, "78Mu 1Cyg", 326.035833333333, 28.7427777777778,  4.73},
+{8310, "78Mu 2Cyg", 326.034583333333, 28.7430555555556,  6.08},
+{8311, "46    Cap", 326.25125, -9.0825,  5.09},
+{8312, NULL, 325.689166666667, 59.2711111111111,  6.08},
+{8313, "9    Peg", 326.127916666667, 17.35,  4.34},
+{8314, NULL, 326.130416666667, 14.7719444444444,  5.94},
+{8315, "10Kap Peg", 326.16125, 25.645,  4.13},
+{8316, "Mu  Cep", 325.876666666667, 58.78,  4.08},
+{8317, "11    Cep", 325.480416666667, 71.3113888888889,  4.56},
+{8318, "47    Cap", 326.567916666667, -9.27583333333333,  6.00},
+{8319, "48Lam Cap", 326.63375, -11.3658333333333,  5.58},
+{8320, NULL, 326.435416666667, 35.8572222222222,  6.40},
+{8321, "12    Peg", 326.518333333333, 22.9488888888889,  5.29},
+{8322, "49Del Cap", 326.76, -16.1272222222222,  2.87},
+{8323, NULL, 327.065833333333, -47.3036111111111,  5.58},
+{8324, NULL, 325.766666666667, 72.3202777777778,  5.17},
+{8325, NULL, 326.6, 25.5633333333333,  6.28},
+{8326, "10The PsA", 326.934166666667, -30.8983333333333,  5.01},
+{8327, NULL, 326.222083333333, 62.4605555555556,  5.95},
+{8328, "11    Peg", 326.808333333333, 2.68611111111111,  5.64},
+{8329, NULL, 326.569166666667, 43.0608333333333,  6.54},
+{8330, NULL, 326.769583333333, 17.1941666666667,  6.21},
+{8331, NULL, 327.500416666667, -64.7125,  5.62},
+{8332, NULL, 326.90875, -5.91722222222222,  6.17},
+{8333, "Omi Ind", 327.69625, -69.6294444444444,  5.53},
+{8334, "10Nu  Cep", 326.362083333333, 61.1208333333333,  4.29},
+{8335, "81Pi 2Cyg", 326.698333333333, 49.3094444444444,  4.23},
+{8336, NULL, 327.034583333333, 36.5805555555556,  6.47},
+{8337, NULL, 327.42125, -12.7230555555556,  6.31},
+{8338, NULL, 327.1225, 38.6486111111111,  6.12},
+{8339, "12    Cep", 326.855416666667, 60.6927777777778,  5.52},
+{8340, NULL, 327.554583333333, -16.8447222222222,  6.38},
+{8341, NULL, 327.362083333333, 20.4625,  6.29},
+{8342, NULL, 326.754166666667, 70.1508333333333,  6.29},
+{8343, "14    Peg", 327.46125, 30.1741666666667,  5.04},
+{8344, "13    Peg", 327.53625, 17.2855555555556,  5.29},
+{8345, NULL, 327.417083333333, 41.1488888888889,  6.48},
+{8346, NULL, 327.924166666667, -18.6230555555556,  6.16},
+{8347, NULL, 327.329166666667, 61.2727777777778,  6.17},
+{8348, NULL, 327.8925, 19.8266666666667,  5.77},
+{8349, NULL, 327.770416666667, 39.5366666666667,  6.17},
+{8350, NULL, 328.075833333333, 21.2730555555556,  6.89},
+{8351, "51Mu  Cap", 328.324166666667, -13.5516666666667,  5.08},
+{8352, NULL, 328.797916666667, -61.8863888888889,  5.90},
+{8353, "Gam Gru", 328.482083333333, -37.365,  3.01},
+{8354, "15    Peg", 328.124583333333, 28.7933333333333,  5.53},
+{8355, NULL, 328.4, -10.3116666666667,  6.59},
+{8356, "16    Peg", 328.265833333333, 25.925,  5.08},
+{8357, NULL, 328.004166666667, 55.7969444444444,  5.71},
+{8358, NULL, 328.405833333333, 19.6683333333333,  5.68},
+{8359, NULL, 328.490833333333, 6.86444444444444,  6.15},
+{8360, NULL, 328.543333333333, -4.27611111111111,  5.71},
+{8361, NULL, 327.905416666667, 65.7527777777778,  6.37},
+{8362, "Pi  Ind", 329.058333333333, -57.8994444444444,  6.19},
+{8363, NULL, 328.649583333333, -3.30111111111111,  6.20},
+{8364, NULL, 328.5725, 19.7183333333333,  6.39},
+{8365, NULL, 328.981666666667, -30.6063888888889,  6.41},
+{8366, NULL, 329.095, -37.2536111111111,  5.46},
+{8367, NULL, 329.259166666667, -37.7469444444444,  6.18},
+{8368, "Del Ind", 329.479583333333, -54.9925,  4.40},
+{8369, "Kap1Ind", 329.625416666667, -59.0122222222222,  6.12},
+{8370, NULL, 330.467083333333, -77.6625,  6.41},
+{8371, "13    Cep", 328.721666666667, 56.6113888888889,  5.80},
+{8372, NULL, 329.1, 21.2397222222222,  6.40},
+{8373, "17    Peg", 329.235, 12.0763888888889,  5.54},
+{8374, NULL, 328.83625, 61.5419444444444,  6.13},
+{8375, NULL, 328.879583333333, 65.3208333333333,  5.86},
+{8376, NULL, 329.555416666667, -5.42472222222222,  6.33},
+{8377, NULL, 329.259166666667, 48.6686111111111,  6.42},
+{8378, NULL, 329.6825, -21.1827777777778,  6.12},
+{8379, NULL, 329.824583333333, -38.3952777777778,  5.50},
+{8380, NULL, 330.765833333333, -76.1186111111111,  5.95},
+{8381, NULL, 330.100416666667, -55.8827777777778,  6.01},
+{8382, NULL, 329.729166666667, -4.37305555555556,  6.22},
+{8383, NULL, 329.162916666667, 63.6255555555556,  4.91},
+{8384, NULL, 329.29625, 66.1561111111111,  6.43},
+{8385, "18    Peg", 330.032916666667, 6.7175,  6.00},
+{8386, "12Eta PsA", 330.209166666667, -28.4536111111111,  5.42},
+{8387, "Eps Ind", 330.84, -56.7861111111111,  4.69},
+{8388, NULL, 329.7225, 62.6983333333333,  5.93},
+{8389, NULL, 329.845833333333, 57.6583333333333,  6.59},
+{8390, "28    Aqr", 330.270833333333, 0.605,  5.58},
+{8391, NULL, 330.111666666667, 33.0061111111111,  6.46},
+{8392, "20    Peg", 330.2725, 13.1197222222222,  5.60},
+{8393, "19    Peg", 330.288333333333, 8.25722222222222,  5.65},
+{8394, NULL, 330.549583333333, -17.9036111111111,  6.28},
+{8395, NULL, 329.4625, 74.9966666666667,  6.35},
+{8396, "29    Aqr", 330.610833333333, -16.9641666666667,  6.37},
+{8397, NULL, 330.505833333333, 10.9738888888889,  6.37},
+{8398, NULL, 330.821666666667, -29.9041666666667,  7.10},
+{8399, NULL, 330.16375, 62.4880555555556,  6.66},
+{8400, "16    Cep", 329.8125, 73.18,  5.03},
+{8401, "30    Aqr", 330.818333333333, -6.5225,  5.54},
+{8402, "31Omi Aqr", 330.82875, -2.15527777777778,  4.69},
+{8403, NULL, 330.460833333333, 52.8822222222222,  5.78},
+{8404, "21    Peg", 330.829166666667, 11.3863888888889,  5.80},
+{8405, "13    PsA", 331.099583333333, -29.9166666666667,  6.47},
+{8406, "14    Cep", 330.519166666667, 58.0005555555556,  5.56},
+{8407, NULL, 330.73625, 44.65,  5.60},
+{8408, NULL, 331.153333333333, -26.8225,  5.96},
+{8409, "Kap2Ind", 331.462083333333, -59.6361111111111,  5.62},
+{8410, "32    Aqr", 331.1975, -0.906666666666667,  5.30},
+{8411, "Lam Gru", 331.52875, -39.5433333333333,  4.46},
+{8412, NULL, 331.143333333333, 32.9419444444444,  6.38},
+{8413, "22Nu  Peg", 331.42, 5.05861111111111,  4.84},
+{8414, "34Alp Aqr", 331.445833333333, -0.319722222222222,  2.96},
+{8415, NULL, 331.2975, 26.6738888888889,  5.78},
+{8416, "18    Cep", 330.970416666667, 63.1197222222222,  5.29},
+{8417, "17Xi  Cep", 330.9475, 64.6277777777778,  4.29},
+{8418, "33Iot Aqr", 331.609166666667, -13.8697222222222,  4.27},
+{8419, "23    Peg", 331.394583333333, 28.9638888888889,  5.70},
+{8420, NULL, 332.677083333333, -75.8805555555555,  6.55},
+{8421, NULL, 331.318333333333, 46.7447222222222,  6.13},
+{8422, NULL, 331.460833333333, 45.1122222222222,  6.44},
+{8423, NULL, 329.552916666667, 82.8697222222222,  6.98},
+{8424, NULL, 331.508333333333, 45.0144444444444,  5.14},
+{8425, "Alp Gru", 332.058333333333, -46.9611111111111,  1.74},
+{8426, "20    Cep", 331.252083333333, 62.7855555555556,  5.27},
+{8427, NULL, 331.463333333333, 48.2316666666667,  6.27},
+{8428, "19    Cep", 331.287083333333, 62.28,  5.11},
+{8429, NULL, 331.551666666667, 45.2486111111111,  6.19},
+{8430, "24Iot Peg", 331.752916666667, 25.345,  3.76},
+{8431, "14Mu  PsA", 332.095833333333, -32.9886111111111,  4.50},
+{8432, NULL, 332.980416666667, -76.1161111111111,  6.15},
+{8433, "Ups PsA", 332.108333333333, -34.0438888888889,  4.99},
+{8434, NULL, 331.55625, 56.3430555555556,  6.39},
+{8435, NULL, 331.869166666667, 19.4755555555556,  5.75},
+{8436, NULL, 331.875, 18.0005555555556,  6.35},
+{8437, NULL, 332.177916666667, -33.1255555555556,  6.37},
+{8438, "25    Peg", 331.959583333333, 21.7027777777778,  5.78},
+{8439, "35    Aqr", 332.245833333333, -18.5197222222222,  5.81},
+{8440, NULL, 332.491666666667, -48.1072222222222,  6.43},
+{8441, NULL, 332.071666666667, 25.5436111111111,  6.11},
+{8442, NULL, 331.79, 58.8408333333333,  6.32},
+{8443, NULL, 331.85625, 53.3072222222222,  6.14},
+{8444, NULL, 332.482083333333, -34.0147222222222,  5.37},
+{8445, NULL, 332.06875, 49.7963888888889,  6.42},
+{8446, NULL, 332.500416666667, -28.2925,  6.44},
+{8447, "15Tau PsA", 332.536666666667, -32.5483333333333,  4.92},
+{8448, NULL, 332.170833333333, 45.7419444444444,  6.11},
+{8449, "27Pi 1Peg", 332.306666666667, 33.1722222222222,  5.58},
+{8450, "26The Peg", 332.55, 6.19777777777778,  3.53},
+{8451, NULL, 332.587916666667, -3.89416666666667,  6.27},
+{8452, "38    Aqr", 332.65625, -11.565,  5.46},
+{8453, NULL, 332.640833333333, -4.26722222222222,  6.01},
+{8454, "29Pi 2Peg", 332.496666666667, 33.1783333333333,  4.29},
+{8455, NULL, 332.579166666667, 19.6169444444444,  6.18},
+{8456, NULL, 332.5925, 14.63,  6.33},
+{8457, NULL, 332.76, -21.2325,  6.09},
+{8458, NULL, 332.655833333333, 11.6244444444444,  5.78},
+{8459, "28    Peg", 332.625833333333, 20.9780555555556,  6.46},
+{8460, NULL, 332.715, 30.5530555555556,  6.32},
+{8461, NULL, 332.96375, 16.0405555555556,  5.95},
+{8462, "39    Aqr", 333.1075, -14.1938888888889,  6.03},
+{8463, NULL, 332.79125, 50.8233333333333,  5.40},
+{8464, NULL, 333.239583333333, -26.3277777777778,  6.17},
+{8465, "21Zet Cep", 332.71375, 58.2011111111111,  3.35},
+{8466, NULL, 333.033333333333, 24.95,  5.92},
+{8467, NULL, 333.1825, -4.72083333333333,  6.39},
+{8468, "24    Cep", 332.451666666667, 72.3411111111111,  4.79},
+{8469, "22Lam Cep", 332.877916666667, 59.4144444444444,  5.04},
+{8470, NULL, 333.435, -25.1808333333333,  5.58},
+{8471, "Psi Oct", 334.460416666667, -77.5116666666667,  5.51},
+{8472, NULL, 332.953333333333, 56.8394444444444,  5.24},
+{8473, NULL, 332.56375, 72.1111111111111,  6.37},
+{8474, NULL, 332.662083333333, 70.1327777777778,  5.50},
+{8475, NULL, 333.199166666667, 34.6047222222222,  5.33},
+{8476, NULL, 332.987083333333, 59.0847222222222,  6.30},
+{8477, NULL, 333.660833333333, -41.3816666666667,  6.23},
+{8478, "16Lam PsA", 333.578333333333, -27.7669444444444,  5.43},
+{8479, NULL, 333.007916666667, 60.7594444444444,  5.35},
+{8480, "41    Aqr", 333.575, -21.0741666666667,  5.32},
+{8481, "Eps Oct", 335.00625, -80.4397222222222,  5.10},
+{8482, NULL, 333.410833333333, 28.6083333333333,  5.89},
+{8483, NULL, 333.092916666667, 63.2913888888889,  5.79},
+{8484, NULL, 333.89625, -44.4519444444445,  6.10},
+{8485, NULL, 333.469583333333, 39.715,  4.49},
+{8486, "Mu 1Gru", 333.90375, -41.3466666666667,  4.79},
+{8487, NULL, 333.455416666667, 45.4408333333333,  5.53},
+{8488, "Mu 2Gru", 334.110833333333, -41.6275,  5.10},
+{8489, NULL, 333.685, 42.9538888888889,  5.71},
+{8490, NULL, 333.45625, 63.1625,  6.11},
+{8491, NULL, 333.999166666667, 8.54944444444445,  6.21},
+{8492, NULL, 334.155833333333, -25.8983333333333,  6.15},
+{8493, NULL, 333.220416666667, 73.3072222222222,  6.08},
+{8494, "23Eps Cep", 333.758333333333, 57.0436111111111,  4.19},
+{8495, NULL, 334.14, -1.59638888888889,  6.15},
+{8496, "42    Aqr", 334.200416666667, -12.8313888888889,  5.34},
+{8497, NULL, 334.249166666667, -23.14,  6.17},
+{8498, "1    Lac", 333.9925, 37.7488888888889,  4.13},
+{8499, "43The Aqr", 334.208333333333, -7.78333333333333,  4.16},
+{8500, NULL, 334.219166666667, -9.04,  5.79},
+{8501, NULL, 334.565, -53.6277777777778,  5.37},
+{8502, "Alp Tuc", 334.625416666667, -60.2597222222222,  2.86},
+{8503, NULL, 334.12375, 27.8041666666667,  6.37},
+{8504, "44    Aqr", 334.277083333333, -5.38722222222222,  5.75},
+{8505, "Ups Oct", 337.905833333333, -85.9672222222222,  5.77},
+{8506, NULL, 334.110416666667, 57.2202777777778,  5.88},
+{8507, NULL, 334.517916666667, -0.237777777777778,  6.39},
+{8508, "45    Aqr", 334.753333333333, -13.305,  5.95},
+{8509, NULL, 335.150833333333, -57.51,  6.34},
+{8510, NULL, 334.734166666667, 37.7694444444444,  6.17},
+{8511, "25    Cep", 334.552916666667, 62.8044444444444,  5.75},
+{8512, "46Rho Aqr", 335.049583333333, -7.82111111111111,  5.37},
+{8513, "30    Peg", 335.115, 5.78944444444444,  5.37},
+{8514, NULL, 335.2325, 8.18666666666667,  6.17},
+{8515, "Nu  Ind", 336.153333333333, -72.2555555555556,  5.29},
+{8516, "47    Aqr", 335.398333333333, -21.5983333333333,  5.13},
+{8517, NULL, 335.250416666667, 26.9352777777778,  6.47},
+{8518, "48Gam Aqr", 335.414166666667, -1.38722222222222,  3.84},
+{8519, NULL, 335.165, 50.9808333333333,  6.42},
+{8520, "31    Peg", 335.379583333333, 12.2052777777778,  5.01},
+{8521, "Pi 1Gru", 335.682916666667, -45.9477777777778,  6.62},
+{8522, "32    Peg", 335.330416666667, 28.3305555555556,  4.81},
+{8523, "2    Lac", 335.256666666667, 46.5366666666667,  4.57},
+{8524, "Pi 2Gru", 335.783333333333, -45.9286111111111,  5.62},
+{8525, NULL, 334.585, 76.4880555555556,  6.66},
+{8526, NULL, 336.4625, -75.0155555555556,  6.04},
+{8527, NULL, 336.29375, -70.4316666666667,  5.78},
+{8528, NULL, 335.462083333333, 42.0783333333333,  6.41},
+{8529, "49    Aqr", 335.87875, -24.7625,  5.53},
+{8530, NULL, 335.88375, -7.19444444444444,  5.93},
+{8531, NULL, 336.235, -57.7972222222222,  5.32},
+{8532, "33    Peg", 335.915, 20.8483333333333,  6.04},
+{8533, "51    Aqr", 336.02875, -4.83694444444444,  5.78},
+{8534, "50    Aqr", 336.112916666667, -13.5294444444444,  5.76},
+{8535, NULL, 335.750833333333, 57.2844444444444,  6.16},
+{8536, NULL, 335.975833333333, 38.5736111111111,  6.22},
+{8537, NULL, 335.750833333333, 62.42,  6.04},
+{8538, "3Bet Lac", 335.89, 52.2291666666667,  4.43},
+{8539, "52Pi  Aqr", 336.319166666667, 1.3775,  4.66},
+{8540, "Del Tuc", 336.833333333333, -64.9663888888889,  4.48},
+{8541, "4    Lac", 336.129166666667, 49.4763888888889,  4.57},
+{8542, NULL, 336.544583333333, -23.6825,  6.29},
+{8543, NULL, 336.419583333333, 18.4444444444444,  6.26},
+{8544, "53    Aqr", 336.6425, -16.7413888888889,  6.57},
+{8545, "53    Aqr", 336.643333333333, -16.7425,  6.35},
+{8546, NULL, 333.294166666667, 86.1080555555556,  5.27},
+{8547, NULL, 337.157083333333, -67.4891666666667,  5.55},
+{8548, "34    Peg", 336.655833333333, 4.39361111111111,  5.75},
+{8549, NULL, 336.690416666667, 37.4438888888889,  6.46},
+{8550, NULL, 335.922083333333, 78.2433333333333,  6.76},
+{8551, "35    Peg", 336.964583333333, 4.69555555555556,  4.79},
+{8552, "Nu  Gru", 337.163333333333, -39.1319444444444,  5.47},
+{8553, NULL, 336.860416666667, 39.8097222222222,  6.14},
+{8554, NULL, 336.746666666667, 56.4333333333333,  6.57},
+{8555, NULL, 336.9425, 31.8402777777778,  5.98},
+{8556, "Del1Gru", 337.3175, -43.4955555555556,  3.97},
+{8557, NULL, 336.503333333333, 70.7708333333333,  5.47},
+{8558, "55Zet1Aqr", 337.207083333333, -0.0202777777777778,  4.59},
+{8559, "55Zet2Aqr", 337.20875, -0.02,  4.42},
+{8560, "Del2Gru", 337.439583333333, -43.7494444444444,  4.11},
+{8561, "26    Cep", 336.772083333333, 65.1322222222222,  5.46},
+{8562, "36    Peg", 337.283333333333, 9.12888888888889,  5.58},
+{8563, NULL, 337.441666666667, -27.1072222222222,  5.95},
+{8564, NULL, 337.2925, 26.7630555555556,  5.79},
+{8565, NULL, 337.50625, -12.915,  6.40},
+{8566, "37    Peg", 337.491666666667, 4.43166666666667,  5.48},
+{8567, "56    Aqr", 337.5725, -14.5858333333333,  6.37},
+{8568, NULL, 337.082083333333, 64.0855555555555,  6.29},
+{8569, NULL, 337.432916666667, 35.7255555555556,  6.56},
+{8570, "Zet PsA", 337.72375, -26.0736111111111,  6.43},
+{8571, "27Del Cep", 337.292916666667, 58.4152777777778,  3.75},
+{8572, "5    Lac", 337.3825, 47.7069444444444,  4.36},
+{8573, "57Sig Aqr", 337.661666666667, -10.6780555555556,  4.82},
+{8574, "38    Peg", 337.5075, 32.5725,  5.65},
+{8575, NULL, 337.527083333333, 49.3561111111111,  6.40},
+{8576, "17Bet PsA", 337.87625, -32.3461111111111,  4.29},
+{8577, NULL, 338.86, -78.7716666666667,  6.15},
+{8578, "28Rho1Cep", 336.677083333333, 78.7858333333333,  5.83},
+{8579, "6    Lac", 337.622083333333, 43.1233333333333,  4.51},
+{8580, NULL, 337.826666666667, -2.91111111111111,  6.16},
+{8581, NULL, 337.826666666667, -6.555,  6.14},
+{8582, "Nu  Tuc", 338.250416666667, -61.9822222222222,  4.81},
+{8583, "58    Aqr", 337.922083333333, -10.9055555555556,  6.38},
+{8584, NULL, 337.8925, 29.5427777777778,  6.35},
+{8585, "7Alp Lac", 337.822916666667, 50.2825,  3.77},
+{8586, "39    Peg", 338.147916666667, 20.23,  6.42},
+{8587, NULL, 338.195416666667, 15.8633333333333,  6.32},
+{8588, NULL, 338.11, 39.7797222222222,  5.88},
+{8589, NULL, 338.078333333333, 54.0375,  6.35},
+{8590, "60    Aqr", 338.512083333333, -1.57416666666667,  5.89},
+{8591, "29Rho2Cep", 337.470416666667, 78.8241666666667,  5.50},
+{8592, "59Ups Aqr", 338.673333333333, -20.7083333333333,  5.20},
+{8593, NULL, 338.970416666667, -57.8836111111111,  6.23},
+{8594, NULL, 338.419166666667, 56.625,  5.71},
+{8595, NULL, 338.262083333333, 69.9136111111111,  6.6 },
+{8596, NULL, 338.902083333333, -23.9911111111111,  5.97},
+{8597, "62Eta Aqr", 338.839166666667, -0.1175,  4.02},
+{8598, NULL, 338.320833333333, 70.3738888888889,  6.34},
+{8599, NULL, 338.0675, 76.2263888888889,  5.68},
+{8600, "Sig1Gru", 339.122083333333, -40.5827777777778,  6.28},
+{8601, NULL, 339.1475, -31.6638888888889,  5.82},
+{8602, "Sig2Gru", 339.245, -40.5911111111111,  5.86},
+{8603, "8    Lac", 338.967916666667, 39.6341666666667,  5.73},
+{8604, NULL, 339.032916666667, 35.5772222222222,  6.10},
+{8605, NULL, 339.151666666667, 11.6969444444444,  6.40},
+{8606, NULL, 338.9725, 50.0711111111111,  6.29},
+{8607, NULL, 338.965833333333, 56.07,  6.38},
+{8608, NULL, 339.269583333333, 12.5772222222222,  6.30},
+{8609, NULL, 339.202916666667, 35.6525,  6.30},
+{8610, "63Kap Aqr", 339.439166666667, -4.22805555555556,  5.03},
+{8611, NULL, 339.785, -52.6922222222222,  6.65},
+{8612, NULL, 339.5925, -7.89777777777778,  6.23},
+{8613, "9    Lac", 339.343333333333, 51.5452777777778,  4.63},
+{8614, NULL, 339.68625, -28.7477777777778,  6.47},
+{8615, "31    Cep", 338.942083333333, 73.6430555555556,  5.08},
+{8616, NULL, 339.714583333333, -33.0813888888889,  5.66},
+{8617, NULL, 339.572916666667, 45.1830555555556,  6.40},
+{8618, "40    Peg", 339.719166666667, 19.5222222222222,  5.82},
+{8619, NULL, 339.933333333333, -28.3252777777778,  6.31},
+{8620, NULL, 340.20375, -57.4222222222222,  5.97},
+{8621, NULL, 339.657916666667, 56.7958333333333,  5.21},
+{8622, "10    Lac", 339.815416666667, 39.0502777777778,  4.88},
+{8623, NULL, 340.092916666667, -30.6588888888889,  5.87},
+{8624, "41    Peg", 339.945833333333, 19.6811111111111,  6.21},
+{8625, NULL, 339.304166666667, 75.3716666666667,  5.79},
+{8626, NULL, 339.892916666667, 37.5927777777778,  6.03},
+{8627, "30    Cep", 339.6625, 63.5844444444444,  5.19},
+{8628, "18Eps PsA", 340.164166666667, -27.0436111111111,  4.17},
+{8629, NULL, 340.2, -3.55416666666667,  6.31},
+{8630, "Bet Oct", 341.51375, -81.3816666666667,  4.15},
+{8631, NULL, 340.219583333333, 14.5494444444444,  5.71},
+{8632, "11    Lac", 340.12875, 44.2763888888889,  4.46},
+{8633, NULL, 340.076666666667, 53.8461111111111,  5.93},
+{8634, "42Zet Peg", 340.365416666667, 10.8313888888889,  3.40},
+{8635, NULL, 340.65375, -47.2105555555556,  5.98},
+{8636, "Bet Gru", 340.667083333333, -46.8847222222222,  2.10},
+{8637, "19    PsA", 340.592083333333, -29.3608333333333,  6.17},
+{8638, NULL, 340.380833333333, 30.9658333333333,  6.34},
+{8639, NULL, 340.679583333333, -44.2477777777778,  6.07},
+{8640, "12    Lac", 340.369166666667, 40.2255555555556,  5.25},
+{8641, "43Omi Peg", 340.439166666667, 29.3075,  4.79},
+{8642, NULL, 340.489166666667, 14.5163888888889,  5.90},
+{8643, NULL, 340.400416666667, 41.5494444444444,  5.94},
+{8644, "Rho Gru", 340.875, -41.4144444444444,  4.85},
+{8645, NULL, 340.764583333333, -8.31166666666667,  6.45},
+{8646, NULL, 341.06875, -60.4994444444444,  6.30},
+{8647, "67    Aqr", 340.809583333333, -6.96277777777778,  6.41},
+{8648, NULL, 340.586666666667, 53.9088888888889,  6.12},
+{8649, "66    Aqr", 340.897083333333, -18.8302777777778,  4.69},
+{8650, "44Eta Peg", 340.750416666667, 30.2213888888889,  2.94},
+{8651, NULL, 340.73125, 37.8027777777778,  6.43},
+{8652, NULL, 340.76875, 47.1686111111111,  6.39},
+{8653, NULL, 340.927916666667, 10.9391666666667,  6.51},
+{8654, NULL, 341.021666666667, 39.4655555555556,  5.95},
+{8655, "Eta Gru", 341.407916666667, -53.5002777777778,  4.85},
+{8656, "13    Lac", 341.022916666667, 41.8191666666667,  5.08},
+{8657, NULL, 341.419583333333, -46.5475,  5.51},
+{8658, NULL, 341.533333333333, -48.9788888888889,  6.62},
+{8659, NULL, 341.617916666667, -49.6858333333333,  6.48},
+{8660, "45    Peg", 341.3675, 19.3666666666667,  6.25},
+{8661, NULL, 341.205, 52.5172222222222,  6.55},
+{8662, NULL, 341.682083333333, -46.9394444444444,  6.56},
+{8663, "Xi  Oct", 342.595416666667, -80.1241666666667,  5.35},
+{8664, NULL, 342.420416666667, -77.0505555555555,  6.73},
+{8665, "46Xi  Peg", 341.673333333333, 12.1727777777778,  4.19},
+{8666, NULL, 341.5425, 44.5461111111111,  5.76},
+{8667, "47Lam Peg", 341.632916666667, 23.5655555555556,  3.95},
+{8668, NULL, 341.829583333333, -34.1611111111111,  6.28},
+{8669, NULL, 342.089166666667, -61.6841666666667,  6.37},
+{8670, "68    Aqr", 341.887916666667, -19.6133333333333,  5.26},
+{8671, NULL, 341.94625, -38.2219444444444,  6.71},
+{8672, NULL, 342.3225, -70.3477777777778,  6.34},
+{8673, "69Tau1Aqr", 341.928333333333, -14.0563888888889,  5.66},
+{8674, NULL, 341.984166666667, -25.9119444444444,  6.30},
+{8675, "Eps Gru", 342.13875, -51.3169444444444,  3.49},
+{8676, "70    Aqr", 342.125833333333, -10.5555555555556,  6.19},
+{8677, NULL, 341.846666666667, 58.4827777777778,  6.36},
+{8678, NULL, 342.045416666667, 37.4166666666667,  5.90},
+{8679, "71Tau2Aqr", 342.397916666667, -13.5925,  4.01},
+{8680, NULL, 342.49625, -32.8052777777778,  6.33},
+{8681, NULL, 342.384583333333, 10.4788888888889,  6.54},
+{8682, NULL, 342.199166666667, 54.415,  6.12},
+{8683, NULL, 342.184166666667, 62.9383333333333,  6.06},
+{8684, "48Mu  Peg", 342.500833333333, 24.6016666666667,  3.48},
+{8685, NULL, 342.759166666667, -39.1569444444444,  5.42},
+{8686, NULL, 342.937083333333, -59.8813888888889,  6.46},
+{8687, NULL, 342.252916666667, 68.5702777777778,  6.19},
+{8688, NULL, 342.4425, 55.9027777777778,  5.43},
+{8689, NULL, 343.04125, -63.1886111111111,  6.12},
+{8690, "14    Lac", 342.590833333333, 41.9536111111111,  5.92},
+{8691, NULL, 342.662916666667, 19.1408333333333,  6.40},
+{8692, NULL, 342.5425, 50.6769444444444,  6.21},
+{8693, "21    PsA", 342.837083333333, -29.5361111111111,  5.97},
+{8694, "32Iot Cep", 342.42, 66.2005555555556,  3.52},
+{8695, "22Gam PsA", 343.131666666667, -32.8755555555556,  4.46},
+{8696, NULL, 342.845, 61.6969444444444,  5.60},
+{8697, "49Sig Peg", 343.100416666667, 9.83555555555556,  5.16},
+{8698, "73Lam Aqr", 343.15375, -7.57972222222222,  3.74},
+{8699, "15    Lac", 343.008333333333, 43.3125,  4.94},
+{8700, "Tau1Gru", 343.407916666667, -48.5980555555556,  6.04},
+{8701, "Rho Ind", 343.664166666667, -70.0736111111111,  6.05},
+{8702, NULL, 341.870833333333, 83.1538888888889,  4.74},
+{8703, NULL, 343.259583333333, 16.8411111111111,  5.64},
+{8704, "74    Aqr", 343.369583333333, -11.6166666666667,  5.80},
+{8705, NULL, 343.217916666667, 50.4119444444444,  6.46},
+{8706, NULL, 343.297083333333, 40.1672222222222,  6.34},
+{8707, NULL, 343.265833333333, 60.1011111111111,  6.01},
+{8708, NULL, 343.417083333333, 44.7491666666667,  5.81},
+{8709, "76Del Aqr", 343.6625, -15.8208333333333,  3.27},
+{8710, "78    Aqr", 343.642083333333, -7.20472222222222,  6.19},
+{8711, "77    Aqr", 343.689583333333, -16.2719444444444,  5.56},
+{8712, NULL, 343.529166666667, 40.3769444444444,  5.81},
+{8713, NULL, 343.812083333333, -36.3886111111111,  6.40},
+{8714, NULL, 343.64875, 16.9416666666667,  6.12},
+{8715, "1    Psc", 343.747916666667, 1.06472222222222,  6.11},
+{8716, NULL, 343.795833333333, -4.98777777777778,  5.72},
+{8717, "50Rho Peg", 343.807083333333, 8.81583333333333,  4.90},
+{8718, NULL, 343.760833333333, 37.0769444444445,  5.91},
+{8719, NULL, 343.964166666667, -31.6330555555556,  6.10},
+{8720, "23Del PsA", 343.987083333333, -32.5397222222222,  4.21},
+{8721, NULL, 344.1, -31.5655555555556,  6.48},
+{8722, "Tau3Gru", 344.199166666667, -47.9691666666667,  5.70},
+{8723, NULL, 343.935416666667, 36.3516666666667,  5.74},
+{8724, NULL, 344.214583333333, 11.8483333333333,  6.51},
+{8725, "16    Lac", 344.098333333333, 41.6038888888889,  5.59},
+{8726, NULL, 344.108333333333, 49.7336111111111,  4.95},
+{8727, NULL, 344.321666666667, -4.81,  6.31},
+{8728, "24Alp PsA", 344.412916666667, -29.6222222222222,  1.16},
+{8729, "51    Peg", 344.36625, 20.7688888888889,  5.49},
+{8730, NULL, 344.386666666667, 3.81027777777778,  6.28},
+{8731, NULL, 344.26875, 48.6841666666667,  5.43},
+{8732, NULL, 344.645833333333, -35.5230555555556,  6.13},
+{8733, NULL, 344.419583333333, 39.3088888888889,  6.18},
+{8734, NULL, 344.564583333333, -2.39527777777778,  6.16},
+{8735, NULL, 344.59875, -1.41027777777778,  6.37},
+{8736, NULL, 342.759166666667, 85.3736111111111,  5.90},
+{8737, NULL, 344.64625, 9.35694444444444,  6.43},
+{8738, NULL, 344.6775, 7.33972222222222,  6.33},
+{8739, "52    Peg", 344.799166666667, 11.7288888888889,  5.75},
+{8740, NULL, 344.899166666667, -29.4622222222222,  5.51},
+{8741, NULL, 344.89875, -13.0708333333333,  6.07},
+{8742, "2    Psc", 344.864166666667, 0.962777777777778,  5.43},
+{8743, NULL, 345.024166666667, -25.1641666666667,  5.65},
+{8744, NULL, 344.792916666667, 52.6544444444444,  6.29},
+{8745, NULL, 344.7875, 59.8147222222222,  6.43},
+{8746, NULL, 345.1025, -25.6266666666667,  6.29},
+{8747, "Zet Gru", 345.22, -52.7541666666667,  4.12},
+{8748, NULL, 343.603333333333, 84.3461111111111,  4.71},
+{8749, NULL, 345.28125, -50.95,  5.68},
+{8750, "3    Psc", 345.157916666667, 0.185833333333333,  6.21},
+{8751, NULL, 345.17875, 3.01166666666667,  5.83},
+{8752, NULL, 345.02125, 56.9452777777778,  5.00},
+{8753, NULL, 345.177083333333, 31.0830555555556,  6.60},
+{8754, NULL, 345.330833333333, -28.8536111111111,  5.55},
+{8755, NULL, 345.143333333333, 45.375,  6.50},
+{8756, NULL, 345.345833333333, -22.7908333333333,  6.28},
+{8757, "81    Aqr", 345.348333333333, -7.06111111111111,  6.21},
+{8758, NULL, 345.227916666667, 38.7080555555556,  6.54},
+{8759, NULL, 345.382083333333, -4.71138888888889,  5.94},
+{8760, NULL, 345.641666666667, -36.4208333333333,  6.47},
+{8761, NULL, 345.377916666667, 57.1055555555556,  6.20},
+{8762, "1Omi And", 345.480416666667, 42.3261111111111,  3.62},
+{8763, "82    Aqr", 345.635833333333, -6.57416666666667,  6.15},
+{8764, NULL, 345.684583333333, -20.8705555555556,  5.97},
+{8765, NULL, 345.637916666667, 31.7805555555556,  6.57},
+{8766, "2    And", 345.65125, 42.7577777777778,  5.10},
+{8767, "Pi  PsA", 345.874166666667, -34.7494444444444,  5.11},
+{8768, NULL, 345.688333333333, 44.0588888888889,  6.39},
+{8769, NULL, 346.2175, -68.8202777777778,  5.52},
+{8770, NULL, 345.6825, 55.2363888888889,  6.50},
+{8771, NULL, 345.997916666667, -41.4783333333333,  5.79},
+{8772, NULL, 345.98875, -4.79527777777778,  6.68},
+{8773, "4Bet Psc", 345.969166666667, 3.82,  4.53},
+{8774, "Kap Gru", 346.165, -53.965,  5.37},
+{8775, "53Bet Peg", 345.94375, 28.0827777777778,  2.42},
+{8776, NULL, 346.004166666667, 6.61666666666667,  6.41},
+{8777, NULL, 345.84875, 60.4452777777778,  6.74},
+{8778, NULL, 345.84, 58.5647222222222,  6.43},
+{8779, NULL, 345.887083333333, 67.2091666666667,  5.24},
+{8780, "3    And", 346.045833333333, 50.0522222222222,  4.65},
+{8781, "54Alp Peg", 346.190416666667, 15.2052777777778,  2.49},
+{8782, "83    Aqr", 346.290833333333, -7.69361111111111,  5.43},
+{8783, NULL, 346.303333333333, -17.0791666666667,  6.14},
+{8784, NULL, 346.27625, 16.5630555555556,  6.44},
+{8785, NULL, 346.323333333333, 1.30694444444444,  6.39},
+{8786, NULL, 347.09875, -79.4808333333333,  6.12},
+{8787, "The Gru", 346.72, -43.5205555555556,  4.28},
+{8788, NULL, 346.575833333333, 18.5175,  6.13},
+{8789, "86    Aqr", 346.670416666667, -23.7430555555556,  4.47},
+{8790, "Ups Gru", 346.723333333333, -38.8922222222222,  5.61},
+{8791, NULL, 346.789583333333, -49.6066666666667,  6.33},
+{8792, NULL, 346.632916666667, 19.9108333333333,  6.30},
+{8793, NULL, 346.81125, -50.6863888888889,  5.83},
+{8794, NULL, 347.14875, -73.5863888888889,  6.15},
+{8795, "55    Peg", 346.75125, 9.40944444444444,  4.52},
+{8796, "56    Peg", 346.778333333333, 25.4683333333333,  4.76},
+{8797, "1    Cas", 346.65375, 59.4197222222222,  4.85},
+{8798, NULL, 346.865416666667, 32.8258333333333,  6.02},
+{8799, NULL, 346.869583333333, 21.1341666666667,  5.99},
+{8800, NULL, 346.825416666667, 46.0680555555556,  6.66},
+{8801, NULL, 346.792083333333, 52.8163888888889,  6.11},
+{8802, NULL, 347.0875, -28.8233333333333,  5.60},
+{8803, NULL, 346.793333333333, 59.7275,  6.40},
+{8804, "4    And", 346.91375, 46.3872222222222,  5.33},
+{8805, "5    And", 346.939166666667, 49.2958333333333,  5.70},
+{8806, NULL, 347.05125, 44.5616666666667,  6.56},
+{8807, "5    Psc", 347.170416666667, 2.12777777777778,  5.40},
+{8808, NULL, 346.94875, 63.6333333333333,  6.26},
+{8809, NULL, 347.54875, -66.8575,  6.47},
+{8810, NULL, 348.05, -80.9127777777778,  6.41},
+{8811, NULL, 346.988333333333, 64.2225,  6.21},
+{8812, "88    Aqr", 347.361666666667, -21.1725,  3.66},
+{8813, NULL, 347.435833333333, -28.0886111111111,  5.87},
+{8814, NULL, 347.48875, -42.8605555555556,  5.81},
+{8815, "57    Peg", 347.38125, 8.67722222222222,  5.12},
+{8816, NULL, 347.456666666667, -14.5105555555556,  6.42},
+{8817, "89    Aqr", 347.478333333333, -22.4575,  4.69},
+{8818, NULL, 347.540833333333, -40.5916666666667,  5.83},
+{8819, "33Pi  Cep", 346.974583333333, 75.3875,  4.41},
+{8820, "Iot Gru", 347.59, -45.2466666666667,  3.90},
+{8821, "58    Peg", 347.50625, 9.82194444444444,  5.39},
+{8822, "2    Cas", 347.43375, 59.3330555555556,  5.70},
+{8823, NULL, 347.694166666667, -29.525,  6.51},
+{8824, NULL, 347.6775, 17.5944444444444,  5.71},
+{8825, "6    And", 347.613333333333, 43.5441666666667,  5.94},
+{8826, "59    Peg", 347.934166666667, 8.72,  5.16},
+{8827, "60    Peg", 347.955, 26.8472222222222,  6.17},
+{8828, NULL, 348.3125, -49.6188888888889,  6.80},
+{8829, NULL, 348.5275, -62.7,  6.12},
+{8830, "7    And", 348.1375, 49.4063888888889,  4.52},
+{8831, NULL, 348.266666666667, 29.4416666666667,  6.35},
+{8832, NULL, 348.320833333333, 57.1683333333333,  5.56},
+{8833, NULL, 348.360416666667, 11.065,  5.82},
+{8834, "90Phi Aqr", 348.580833333333, -6.04888888888889,  4.22},
+{8835, NULL, 348.744166666667, -41.1055555555556,  5.77},
+{8836, NULL, 348.6675, -10.6886111111111,  6.12},
+{8837, NULL, 348.559583333333, 50.6177777777778,  6.31},
+{8838, NULL, 348.590416666667, 29.7716666666667,  6.41},
+{8839, NULL, 348.652083333333, 24.1030555555556,  6.36},
+{8840, NULL, 348.892916666667, -3.49638888888889,  5.55},
+{8841, "91Psi1Aqr", 348.972916666667, -9.08777777777778,  4.21},
+{8842, "61    Peg", 348.942916666667, 28.2477777777778,  6.49},
+{8843, NULL, 349.240416666667, -62.0011111111111,  5.66},
+{8844, NULL, 348.655416666667, 74.2311111111111,  5.84},
+{8845, NULL, 348.99125, 24.7711111111111,  6.60},
+{8846, NULL, 349.165416666667, -44.4891666666667,  5.92},
+{8847, NULL, 349.2075, -41.1944444444444,  6.47},
+{8848, "Gam Tuc", 349.3575, -58.2358333333333,  3.99},
+{8849, NULL, 349.78375, -79.4727777777778,  6.33},
+{8850, "92Chi Aqr", 349.212083333333, -7.72666666666667,  5.06},
+{8851, NULL, 348.9075, 70.8880555555556,  5.56},
+{8852, "6Gam Psc", 349.29125, 3.28222222222222,  3.69},
+{8853, NULL, 349.17625, 53.2136111111111,  5.54},
+{8854, NULL, 349.111666666667, 61.9630555555556,  6.53},
+{8855, NULL, 349.583333333333, -67.4711111111111,  6.13},
+{8856, NULL, 349.416666666667, -11.7130555555556,  6.34},
+{8857, NULL, 349.319166666667, 45.1641666666667,  6.43},
+{8858, "93Psi2Aqr", 349.475833333333, -9.1825,  4.39},
+{8859, "Phi Gru", 349.54125, -40.8244444444444,  5.53},
+{8860, "8    And", 349.43625, 49.0152777777778,  4.85},
+{8861, NULL, 349.48375, 45.4888888888889,  6.48},
+{8862, "Tau Oct", 352.015416666667, -87.4822222222222,  5.49},
+{8863, "Gam Scl", 349.705833333333, -32.5319444444444,  4.41},
+{8864, "9    And", 349.5975, 41.7736111111111,  6.02},
+{8865, "95Psi3Aqr", 349.740416666667, -9.61083333333333,  4.98},
+{8866, "94    Aqr", 349.777916666667, -13.4588888888889,  5.08},
+{8867, NULL, 349.32875, 75.2991666666667,  6.38},
+{8868, "96    Aqr", 349.85, -5.12444444444444,  5.55},
+{8869, NULL, 349.850416666667, -18.0752777777778,  5.93},
+{8870, NULL, 349.76, 45.1372222222222,  6.50},
+{8871, NULL, 349.93, -33.7080555555556,  6.37},
+{8872, "34Omi Cep", 349.65625, 68.1116666666667,  4.75},
+{8873, NULL, 349.864166666667, 34.7933333333333,  6.32},
+{8874, "11    And", 349.874166666667, 48.6252777777778,  5.44},
+{8875, NULL, 349.923333333333, 48.3808333333333,  6.32},
+{8876, "10    And", 349.968333333333, 42.0780555555556,  5.79},
+{8877, NULL, 350.208333333333, -50.3066666666667,  6.05},
+{8878, "7    Psc", 350.085833333333, 5.38138888888889,  5.05},
+{8879, NULL, 350.170416666667, -5.90805555555556,  6.17},
+{8880, "62Tau Peg", 350.159166666667, 23.7402777777778,  4.60},
+{8881, NULL, 350.059583333333, 61.97,  6.45},
+{8882, "63    Peg", 350.206666666667, 30.415,  5.59},
+{8883, NULL, 350.314583333333, -26.9866666666667,  5.64},
+{8884, NULL, 350.183333333333, 44.1163888888889,  6.13},
+{8885, "12    And", 350.222083333333, 38.1822222222222,  5.77},
+{8886, NULL, 350.144166666667, 62.2130555555556,  6.39},
+{8887, "64    Peg", 350.47875, 31.8125,  5.32},
+{8888, NULL, 350.4925, 26.6088888888889,  6.62},
+{8889, NULL, 350.737083333333, -60.0558333333333,  6.09},
+{8890, "97    Aqr", 350.663333333333, -15.0391666666667,  5.20},
+{8891, "65    Peg", 350.66875, 20.8286111111111,  6.29},
+{8892, "98    Aqr", 350.7425, -20.1005555555556,  3.97},
+{8893, "66    Peg", 350.769166666667, 12.3138888888889,  5.08},
+{8894, NULL, 350.635416666667, 60.1336111111111,  5.56},
+{8895, NULL, 350.97625, -53.8083333333333,  6.15},
+{8896, NULL, 350.939166666667, -43.1244444444444,  6.10},
+{8897, NULL, 350.882916666667, 0.291388888888889,  6.31},
+{8898, NULL, 351.054583333333, -51.8913888888889,  5.75},
+{8899, NULL, 350.947916666667, 32.5313888888889,  6.69},
+{8900, NULL, 351.0325, -18.6875,  6.19},
+{8901, NULL, 351.330833333333, -56.8491666666667,  5.59},
+{8902, NULL, 351.145833333333, 41.1127777777778,  6.72},
+{8903, "67    Peg", 351.211666666667, 32.385,  5.57},
+{8904, "4    Cas", 351.209583333333, 62.2827777777778,  4.98},
+{8905, "68Ups Peg", 351.345, 23.4041666666667,  4.40},
+{8906, "99    Aqr", 351.511666666667, -20.6419444444444,  4.39},
+{8907, "Omi Gru", 351.6525, -52.7216666666667,  5.52},
+{8908, NULL, 351.78, -66.5811111111111,  6.45},
+{8909, NULL, 351.8125, -58.4761111111111,  5.63},
+{8910, NULL, 351.787916666667, -50.1572222222222,  6.20},
+{8911, "8Kap Psc", 351.733333333333, 1.25555555555556,  4.94},
+{8912, "9    Psc", 351.811666666667, 1.1225,  6.25},
+{8913, "13    And", 351.780833333333, 42.9119444444444,  5.75},
+{8914, NULL, 352.002916666667, -35.5444444444444,  6.32},
+{8915, "69    Peg", 351.918333333333, 25.1672222222222,  5.98},
+{8916, "10The Psc", 351.992083333333, 6.37888888888889,  4.28},
+{8917, NULL, 352.021666666667, -11.4497222222222,  6.37},
+{8918, NULL, 351.819166666667, 70.3597222222222,  5.60},
+{8919, NULL, 352.254166666667, -63.1108333333333,  5.68},
+{8920, NULL, 352.253333333333, -44.4977777777778,  6.43},
+{8921, NULL, 352.2525, -9.26611111111111,  6.18},
+{8922, NULL, 352.273333333333, 23.0477777777778,  6.35},
+{8923, "70    Peg", 352.28875, 12.7605555555556,  4.55},
+{8924, NULL, 352.38375, -4.53277777777778,  6.25},
+{8925, NULL, 352.530833333333, 49.1330555555556,  6.17},
+{8926, NULL, 352.508333333333, 58.5488888888889,  4.91},
+{8927, NULL, 352.665416666667, 38.6619444444444,  6.05},
+{8928, NULL, 352.754583333333, -6.28833333333333,  6.39},
+{8929, NULL, 352.8625, -44.8436111111111,  6.02},
+{8930, "14    And", 352.8225, 39.2363888888889,  5.22},
+{8931, NULL, 352.88125, -4.08722222222222,  6.49},
+{8932, "100    Aqr", 352.925416666667, -21.3694444444444,  6.29},
+{8933, NULL, 352.929583333333, 28.4036111111111,  6.41},
+{8934, "13    Psc", 352.99, -1.08583333333333,  6.38},
+{8935, NULL, 353.33125, -77.3852777777778,  5.81},
+{8936, NULL, 353.1025, 34.9525,  6.65},
+{8937, "Bet Scl", 353.242916666667, -37.8183333333333,  4.37},
+{8938, NULL, 351.753333333333, 87.3075,  5.58},
+{8939, "101    Aqr", 353.319166666667, -20.9144444444444,  4.71},
+{8940, "71    Peg", 353.367083333333, 22.4988888888889,  5.32},
+{8941, NULL, 353.427916666667, 45.0580555555556,  6.24},
+{8942, NULL, 353.48125, 20.8408333333333,  6.06},
+{8943, "72    Peg", 353.488333333333, 31.3252777777778,  4.98},
+{8944, "14    Psc", 353.5375, -1.2475,  5.87},
+{8945, NULL, 353.802916666667, -64.6894444444444,  7.4 },
+{8946, NULL, 353.705833333333, -15.2458333333333,  5.96},
+{8947, "15    And", 353.65625, 40.2363888888889,  5.59},
+{8948, "73    Peg", 353.659166666667, 33.4972222222222,  5.63},
+{8949, "Iot Phe", 353.769166666667, -42.615,  4.71},
+{8950, NULL, 353.694583333333, 38.0238888888889,  6.18},
+{8951, NULL, 353.88375, -7.46444444444444,  6.39},
+{8952, NULL, 353.745833333333, 71.6422222222222,  5.84},
+{8953, NULL, 353.982916666667, 24.5611111111111,  6.45},
+{8954, "16    Psc", 354.097083333333, 2.10222222222222,  5.68},
+{8955, NULL, 354.127083333333, 32.9041666666667,  6.35},
+{8956, NULL, 354.2725, -31.8708333333333,  6.52},
+{8957, NULL, 354.600416666667, -76.87,  6.00},
+{8958, NULL, 354.415, -13.0602777777778,  5.65},
+{8959, NULL, 354.4625, -45.4925,  4.74},
+{8960, "74    Peg", 354.415833333333, 16.8255555555556,  6.26},
+{8961, "16Lam And", 354.39125, 46.4580555555556,  3.82},
+{8962, NULL, 354.383333333333, 44.4291666666667,  5.80},
+{8963, "75    Peg", 354.486666666667, 18.4005555555556,  5.53},
+{8964, NULL, 354.494166666667, 46.1997222222222,  6.58},
+{8965, "17Iot And", 354.534166666667, 43.2680555555556,  4.29},
+{8966, "The Phe", 354.866666666667, -46.6377777777778,  6.09},
+{8967, "18    And", 354.784583333333, 50.4716666666667,  5.30},
+{8968, "102Ome1Aqr", 354.94625, -14.2216666666667,  5.00},
+{8969, "17Iot Psc", 354.9875, 5.62638888888889,  4.13},
+{8970, NULL, 354.979583333333, 9.67722222222222,  5.97},
+{8971, NULL, 354.793333333333, 75.2927777777778,  5.95},
+{8972, NULL, 354.837916666667, 74.0027777777778,  5.98},
+{8973, NULL, 355.011666666667, 37.6525,  6.53},
+{8974, "35Gam Cep", 354.836666666667, 77.6325,  3.21},
+{8975, "Mu  Scl", 355.159166666667, -32.0730555555556,  5.31},
+{8976, "19Kap And", 355.102083333333, 44.3338888888889,  4.14},
+{8977, NULL, 355.169166666667, 36.7208333333333,  6.23},
+{8978, NULL, 355.279166666667, -24.1602777777778,  6.60},
+{8979, NULL, 355.287083333333, -11.6805555555556,  5.89},
+{8980, "103    Aqr", 355.39375, -18.0272222222222,  5.34},
+{8981, NULL, 355.362083333333, 49.5122222222222,  6.26},
+{8982, "104    Aqr", 355.440833333333, -17.8163888888889,  4.82},
+{8983, NULL, 355.48625, 7.25055555555556,  5.89},
+{8984, "18Lam Psc", 355.511666666667, 1.78,  4.50},
+{8985, NULL, 355.477083333333, 57.26,  6.24},
+{8986, NULL, 355.561666666667, 44.9919444444444,  6.57},
+{8987, NULL, 355.61625, -15.4477777777778,  5.28},
+{8988, "105Ome2Aqr", 355.680416666667, -14.545,  4.49},
+{8989, NULL, 355.586666666667, 64.5155555555556,  6.56},
+{8990, NULL, 355.63125, 61.6794444444444,  6.40},
+{8991, "77    Peg", 355.843333333333, 10.3313888888889,  5.06},
+{8992, NULL, 355.95625, -15.2844444444444,  6.36},
+{8993, NULL, 356.005833333333, -45.0833333333333,  6.09},
+{8994, NULL, 356.105833333333, -70.4902777777778,  6.07},
+{8995, NULL, 356.169583333333, -78.7913888888889,  5.75},
+{8996, NULL, 356.05, -64.4044444444445,  5.72},
+{8997, "78    Peg", 355.997916666667, 29.3616666666667,  4.93},
+{8998, "106    Aqr", 356.050416666667, -18.2769444444444,  5.24},
+{8999, NULL, 356.120416666667, -26.2463888888889,  6.17},
+{9000, NULL, 356.20125, 55.7997222222222,  6.51},
+{9001, NULL, 356.505, -40.1825,  6.31},
+{9002, "107    Aqr", 356.50375, -18.6780555555556,  5.29},
+{9003, "20Psi And", 356.50875, 46.4202777777778,  4.95},
+{9004, "19    Psc", 356.597916666667, 3.48666666666667,  5.04},
+{9005, NULL, 356.652916666667, 66.7822222222222,  5.95},
+{9006, "Sig Phe", 356.816666666667, -50.2266666666667,  5.18},
+{9007, NULL, 356.847083333333, -68.3941666666667,  6.89},
+{9008, "5Tau Cas", 356.764583333333, 58.6519444444444,  4.87},
+{9009, NULL, 356.81625, -11.9108333333333,  5.73},
+{9010, NULL, 356.757916666667, 57.4513888888889,  5.51},
+{9011, NULL, 356.888333333333, 46.8325,  6.07},
+{9012, "20    Psc", 356.985416666667, -2.76166666666667,  5.49},
+{9013, NULL, 356.978333333333, 67.8069444444444,  5.04},
+{9014, NULL, 357.135416666667, -6.38055555555556,  6.07},
+{9015, NULL, 357.205416666667, 2.21416666666667,  6.46},
+{9016, "Del Scl", 357.231666666667, -28.1302777777778,  4.57},
+{9017, NULL, 357.1625, 64.8763888888889,  6.41},
+{9018, "6    Cas", 357.209166666667, 62.2144444444444,  5.43},
+{9019, NULL, 357.224583333333, 59.9788888888889,  6.34},
+{9020, NULL, 357.3, 58.9630555555556,  6.33},
+{9021, NULL, 357.381666666667, -15.8611111111111,  6.24},
+{9022, "21    Psc", 357.364583333333, 1.07611111111111,  5.77},
+{9023, NULL, 357.43625, -62.8394444444444,  6.59},
+{9024, NULL, 357.420833333333, 36.4252777777778,  5.90},
+{9025, "79    Peg", 357.414166666667, 28.8425,  5.97},
+{9026, NULL, 357.456666666667, -25.3313888888889,  6.42},
+{9027, NULL, 357.56125, -9.97416666666667,  5.94},
+{9028, NULL, 357.592916666667, 51.6216666666667,  6.44},
+{9029, NULL, 357.63875, -14.4019444444444,  5.72},
+{9030, "80    Peg", 357.838333333333, 9.31333333333333,  5.79},
+{9031, "108    Aqr", 357.83875, -18.9088888888889,  5.18},
+{9032, "Gam1Oct", 358.026666666667, -82.0188888888889,  5.11},
+{9033, "22    Psc", 357.99125, 2.93027777777778,  5.55},
+{9034, NULL, 357.99, 77.5994444444444,  6.55},
+{9035, NULL, 358.0975, 21.6708333333333,  6.11},
+{9036, "81Phi Peg", 358.122083333333, 19.1202777777778,  5.08},
+{9037, NULL, 358.125, -14.2511111111111,  5.87},
+{9038, NULL, 358.104583333333, 75.5447222222222,  6.39},
+{9039, "82    Peg", 358.154583333333, 10.9475,  5.30},
+{9040, NULL, 358.210416666667, -8.99666666666667,  5.75},
+{9041, "24    Psc", 358.231666666667, -3.15555555555556,  5.93},
+{9042, "25    Psc", 358.27, 2.09055555555556,  6.28},
+{9043, NULL, 358.336666666667, -24.2291666666667,  6.24},
+{9044, NULL, 358.589166666667, -27.0422222222222,  6.35},
+{9045, "7Rho Cas", 358.595833333333, 57.4994444444444,  4.54},
+{9046, NULL, 358.660833333333, -40.3,  6.03},
+{9047, NULL, 358.694166666667, 0.109166666666667,  5.61},
+{9048, "26    Psc", 358.7825, 7.07111111111111,  6.21},
+{9049, NULL, 358.819166666667, -31.9216666666667,  6.10},
+{9050, NULL, 358.819166666667, -31.8841666666667,  6.83},
+{9051, NULL, 358.845833333333, 25.955,  6.54},
+{9052, NULL, 358.890416666667, 57.4122222222222,  6.00},
+{9053, NULL, 358.89, 47.3558333333333,  6.00},
+{9054, NULL, 359.124583333333, -24.7372222222222,  6.31},
+{9055, NULL, 359.172916666667, 22.6480555555556,  6.15},
+{9056, NULL, 359.115416666667, 83.1911111111111,  6.59},
+{9057, NULL, 359.265, 42.6583333333333,  5.97},
+{9058, NULL, 359.284583333333, -26.6236111111111,  6.26},
+{9059, NULL, 359.285416666667, 55.7058333333333,  5.55},
+{9060, NULL, 359.332916666667, -62.9563888888889,  5.97},
+{9061, "Gam2Oct", 359.38625, -82.17,  5.73},
+{9062, "Eta Tuc", 359.396666666667, -64.2983333333333,  5.00},
+{9063, NULL, 359.389583333333, 60.0236111111111,  6.47},
+{9064, "84Psi Peg", 359.439583333333, 25.1413888888889,  4.66},
+{9065, "1    Cet", 359.588333333333, -15.8475,  6.26},
+{9066, NULL, 359.603333333333, 51.3886111111111,  4.8 },
+{9067, "27    Psc", 359.668333333333, -3.55611111111111,  4.86},
+{9068, NULL, 359.705, 32.3816666666667,  6.52},
+{9069, "Pi  Phe", 359.7325, -52.7458333333333,  5.13},
+{9070, NULL, 359.69375, 46.4130555555556,  6.54},
+{9071, "8Sig Cas", 359.752083333333, 55.755,  4.88},
+{9072, "28Ome Psc", 359.827916666667, 6.86333333333333,  4.01},
+{9073, NULL, 359.86625, -29.485,  5.62},
+{9074, NULL, 359.871666666667, 33.7244444444444,  6.58},
+{9075, NULL, 359.871666666667, 33.7244444444444,  6.58},
+{9076, "Eps Tuc", 359.979166666667, -65.5772222222222,  4.50},
+{9077, NULL, 0.08, -44.2905555555556,  6.29},
+{9078, NULL, 0.0995833333333333, 26.9183333333333,  6.46},
+{9079, NULL, 0.12875, 59.5597222222222,  6.19},
+{9080, NULL, 0.182083333333333, 45.2533333333333,  6.38},
+{9081, "Tau Phe", 0.26875, -48.81,  5.71},
+{9082, NULL, 0.333333333333333, -50.3372222222222,  5.53},
+{9083, NULL, 0.330416666666667, 49.9816666666667,  6.22},
+{9084, "The Oct", 0.39875, -77.0658333333333,  4.78},
+{9085, NULL, 0.40375, 61.2230555555556,  5.55},
+{9086, NULL, 0.4325, 42.3672222222222,  6.25},
+{9087, "29    Psc", 0.455833333333333, -3.0275,  5.10},
+{9088, "85    Peg", 0.5425, 27.0819444444444,  5.75},
+{9089, "30    Psc", 0.49, -6.01416666666667,  4.41},
+{9090, NULL, 0.530416666666667, -14.6761111111111,  7.1 },
+{9091, "Zet Scl", 0.582916666666667, -29.7202777777778,  5.01},
+{9092, "31    Psc", 0.600833333333333, 8.95694444444444,  6.32},
+{9093, "32    Psc", 0.62375, 8.48555555555556,  5.63},
+{9094, NULL, 0.650416666666667, 66.0988888888889,  5.86},
+{9095, NULL, 0.74, -20.0461111111111,  6.25},
+{9096, NULL, 0.782083333333333, -24.1452777777778,  6.44},
+{9097, NULL, 0.857083333333333, 63.6419444444444,  6.24},
+{9098, "2    Cet", 0.935, -17.3361111111111,  4.55},
+{9099, NULL, 0.96625, 66.7122222222222,  6.29},
+{9100, "9    Cas", 1.05666666666667, 62.2877777777778,  5.88},
+{9101, NULL, 1.08208333333333, -16.5288888888889,  5.78},
+{9102, NULL, 1.08458333333333, -29.2686111111111,  6.40},
+{9103, "3    Cet", 1.12541666666667, -10.5094444444444,  4.94},
+{9104, NULL, 1.175, 67.1666666666667,  5.67},
+{9105, NULL, 1.15291666666667, 42.0922222222222,  6.01},
+{9106, NULL, 1.12791666666667, -72.8977777777778,  7.31},
+{9107, NULL, 1.22416666666667, 34.6597222222222,  6.12},
+{9108, NULL, 1.17208333333333, -71.4369444444444,  5.59},
+{9109, NULL, 1.23333333333333, 26.6488888888889,  6.25},
+{9110, NULL, 1.27583333333333, 61.3141666666667,  5.80},
+{-1, NULL, 0, 0, 0}};
@@ -30,7 +30,7 @@ void GetRequestAuthorized::execute (XmlRpc::XmlRpcSource *source, struct sockadd
 	if (getServer ()->isPublic (saddr, getPrefix () + path))
 	{
 		http_code = HTTP_OK;
-		authorizedExecute (source, path, params, response_type, response, response_length);
+		cachedExecute (source, path, params, http_code, response_type, response, response_length);
 		return;
 	}
 
@@ -50,11 +50,75 @@ void GetRequestAuthorized::execute (XmlRpc::XmlRpcSource *source, struct sockadd
 	}
 	http_code = HTTP_OK;
 
-	authorizedExecute (source, path, params, response_type, response, response_length);
+	cachedExecute (source, path, params, http_code, response_type, response, response_length);
 
 	getServer ()->addExecutedPage ();
 }
 
+void GetRequestAuthorized::cachedExecute (XmlRpc::XmlRpcSource *source, std::string path, HttpParams *params, int &http_code, const char* &response_type, char* &response, size_t &response_length)
+{
+	ResponseCache *cache = getServer ()->getResponseCache ();
+	CachePolicy policy;
+	if (cache != NULL)
+		responseCachePolicy (path, params, policy);
+
+	if (cache == NULL || policy.maxAge <= 0)
+	{
+		authorizedExecute (source, path, params, response_type, response, response_length);
+		return;
+	}
+
+	std::string key = ResponseCache::requestKey (getPrefix (), path, params, policy.validator);
+	double now = getNow ();
+
+	CachedResponse *cr = cache->find (key, now);
+	if (cr == NULL)
+	{
+		authorizedExecute (source, path, params, response_type, response, response_length);
+		// asynchronous and chunked responses cannot be cached
+		if (response == NULL || response_length == 0 || connection->isChunked ())
+			return;
+		cr = cache->add (key, response_type, response, response_length, now, policy);
+		getServer ()->cacheHit (false);
+	}
+	else
+	{
+		response_type = cr->getResponseType ();
+		getServer ()->cacheHit (true);
+	}
+
+	addExtraHeader ("ETag", cr->getETag ().c_str ());
+
+	if (connection->matchETag (cr->getETag ()))
+	{
+		delete[] response;
+		response = NULL;
+		response_length = 0;
+		http_code = HTTP_NOT_MODIFIED;
+		return;
+	}
+
+	const std::string *body = &(cr->getBody ());
+	if (cr->haveGzip ())
+	{
+		addExtraHeader ("Vary", "Accept-Encoding");
+		if (connection->acceptGzip ())
+		{
+			addExtraHeader ("Content-Encoding", "gzip");
+			body = &(cr->getGzipBody ());
+		}
+	}
+
+	// fresh response, which is not compressed, can be send as it is
+	if (response != NULL && body == &(cr->getBody ()))
+		return;
+
+	delete[] response;
+	response_length = body->length ();
+	response = new char[response_length];
+	memcpy (response, body->data (), response_length);
+}
+
 void GetRequestAuthorized::printHeader (std::ostream &os, const char *title, const char *css, const char *cssLink, const char *onLoad)
 {
 	os << "<html><head><title>" << title << "</title>";
@@ -38,8 +38,9 @@ void HTTPServer::registerAPI (AsyncAPI *a)
 	}
 }
 
-void HTTPServer::asyncIdle ()
+long HTTPServer::asyncIdle ()
 {
+	double next = NAN;
 	// delete freed async, check for shared memory data
 	for (std::list <rts2json::AsyncAPI *>::iterator iter = asyncAPIs.begin (); iter != asyncAPIs.end ();)
 	{
@@ -52,7 +53,37 @@ void HTTPServer::asyncIdle ()
 		}
 		else
 		{
+			double n = (*iter)->nextFlush ();
+			if (!isnan (n) && (isnan (next) || n < next))
+				next = n;
 			iter++;
 		}
 	}
+	if (isnan (next))
+		return -1;
+	next -= getNow ();
+	return next > 0 ? (long) (next * USEC_SEC) : 0;
+}
+
+void HTTPServer::invalidateCache (int events, const char *device)
+{
+	responseCache.invalidate (events, device);
+	if (cacheEntries)
+		cacheEntries->setValueInteger (responseCache.size ());
+}
+
+void HTTPServer::cacheHit (bool hit)
+{
+	if (hit)
+	{
+		if (cacheHits)
+			cacheHits->inc ();
+	}
+	else
+	{
+		if (cacheMisses)
+			cacheMisses->inc ();
+	}
+	if (cacheEntries)
+		cacheEntries->setValueInteger (responseCache.size ());
 }
@@ -105,6 +105,7 @@
 #include <archive_entry.h>
 #endif
 #include <libgen.h>
+#include <sys/stat.h>
 
 #include "xmlrpc++/urlencoding.h"
 
@@ -225,6 +226,28 @@ void Previewer::pageLink (std::ostringstream& _os, int i, int pagesiz, int prevs
 #include <Magick++.h>
 using namespace Magick;
 
+/**
+ * Fills cache validator with file modification time and size, so modified files are not served from the cache.
+ *
+ * @return false if file does not exists
+ */
+static bool fileValidator (const char *fn, CachePolicy &policy)
+{
+	struct stat st;
+	if (stat (fn, &st))
+		return false;
+	std::ostringstream os;
+	os << st.st_mtime << ':' << st.st_size;
+	policy.validator = os.str ();
+	return true;
+}
+
+void JpegImageRequest::responseCachePolicy (const std::string &path, XmlRpc::HttpParams *params, CachePolicy &policy)
+{
+	if (fileValidator (path.c_str (), policy))
+		policy.maxAge = 600;
+}
+
 void JpegImageRequest::authorizedExecute (XmlRpc::XmlRpcSource *source, std::string path, XmlRpc::HttpParams *params, const char* &response_type, char* &response, size_t &response_length)
 {
 	response_type = "image/jpeg";
@@ -250,6 +273,22 @@ void JpegImageRequest::authorizedExecute (XmlRpc::XmlRpcSource *source, std::str
 	delete mimage;
 }
 
+void JpegPreview::responseCachePolicy (const std::string &path, XmlRpc::HttpParams *params, CachePolicy &policy)
+{
+	std::string absPath = dirPath + path;
+	if (path.length () > 6 && (path.substr (path.length () - 5)) == std::string (".fits"))
+	{
+		if (fileValidator (absPath.c_str (), policy))
+			policy.maxAge = 600;
+	}
+	// directory listing changes with new images
+	else
+	{
+		policy.maxAge = 60;
+		policy.invalidate = CACHE_INVALIDATE_IMAGE;
+	}
+}
+
 void JpegPreview::authorizedExecute (XmlRpc::XmlRpcSource *source, std::string path, XmlRpc::HttpParams *params, const char* &response_type, char* &response, size_t &response_length)
 {
 	// size of previews
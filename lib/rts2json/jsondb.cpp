@@ -36,6 +36,7 @@
 #include "rts2json/jsonvalue.h"
 
 #include "rts2script/script.h"
+#include "rts2script/scriptcache.h"
 
 #include "xmlrpc++/XmlRpcException.h"
 
@@ -52,8 +53,31 @@ rts2db::Target * rts2json::getTarget (XmlRpc::HttpParams *params, const char *pa
 	return target;
 }
 
+void JSONDBRequest::responseCachePolicy (const std::string &path, XmlRpc::HttpParams *params, CachePolicy &policy)
+{
+	std::vector <std::string> vals = SplitStr (path, std::string ("/"));
+	if (vals.size () != 1)
+		return;
+	const std::string &call = vals[0];
+
+	if (call == "tbyname" || call == "tbyid" || call == "tbylabel" || call == "tbydistance" || call == "consts" || call == "cnst_alt" || call == "cnst_alt_v" || call == "cnst_time" || call == "cnst_time_v" || call == "labellist" || call == "tlabs_list" || call == "plan")
+	{
+		policy.maxAge = 60;
+		policy.invalidate = CACHE_INVALIDATE_TARGET;
+	}
+	else if (call == "obytid" || call == "obyid" || call == "ibyoid")
+	{
+		policy.maxAge = 60;
+		policy.invalidate = CACHE_INVALIDATE_IMAGE;
+	}
+}
+
 void JSONDBRequest::dbJSON (const std::vector <std::string> vals, XmlRpc::XmlRpcSource *source, std::string path, XmlRpc::HttpParams *params, std::ostringstream &os)
 {
+	// requests modifying targets invalidate cached target informations
+	if (vals[0] == "create_target" || vals[0] == "create_tle_target" || vals[0] == "update_target" || vals[0] == "change_script" || vals[0] == "change_constraints" || vals[0] == "tlabs_delete" || vals[0] == "tlabs_add" || vals[0] == "tlabs_set")
+		getServer ()->invalidateCache (CACHE_INVALIDATE_TARGET);
+
 	// returns target information specified by target name
 	if (vals[0] == "tbyname")
 	{
@@ -459,6 +483,7 @@ void JSONDBRequest::dbJSON (const std::vector <std::string> vals, XmlRpc::XmlRpc
 		}
 
 		tar->setScript (cam, s);
+		rts2script::ScriptCache::instance ()->invalidate (tar->getTargetID ());
 		os << "\"id\":" << tar->getTargetID () << ",\"camera\":\"" << cam << "\",\"script\":\"" << s << "\"";
 		delete tar;
 	}
@@ -843,13 +868,12 @@ void JSONDBRequest::jsonTargets (rts2db::TargetSet &tar_set, std::ostringstream
 				try
 				{
 					std::string script_buf;
-					rts2script::Script script;
 					tar->getScript (cam->c_str(), script_buf);
 					if (cam != getServer ()->getCameras ()->begin ())
 						cs << ",";
-					script.setTarget (cam->c_str (), tar);
-					double d = script.getExpectedDuration ();
-					int e = script.getExpectedImages ();
+					rts2script::ScriptTemplate *script = rts2script::ScriptCache::instance ()->getTemplate (cam->c_str (), tar);
+					double d = script->getExpectedDuration (0);
+					int e = script->getExpectedImages ();
 					cs << "{\"" << *cam << "\":[\"" << script_buf << "\"," << d << "," << e << "]}";
 					if (d > md)
 						md = d;  
@@ -0,0 +1,273 @@
+/*
+ * Cache for HTTP responses.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2json/responsecache.h"
+#include "rts2-config.h"
+
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string.h>
+#include <stdint.h>
+
+#ifdef RTS2_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+using namespace rts2json;
+
+/**
+ * 64bit FNV-1a hash of the data.
+ */
+static uint64_t fnv1a (const char *data, size_t len)
+{
+	uint64_t h = 14695981039346656037ULL;
+	for (size_t i = 0; i < len; i++)
+	{
+		h ^= (unsigned char) data[i];
+		h *= 1099511628211ULL;
+	}
+	return h;
+}
+
+#ifdef RTS2_HAVE_ZLIB
+/**
+ * Compress data with gzip header. Returns false if compression failed or does not save any space.
+ */
+static bool gzipData (const char *data, size_t len, std::string &out)
+{
+	z_stream zs;
+	memset (&zs, 0, sizeof (zs));
+	// 15 + 16 - maximal window with gzip header
+	if (deflateInit2 (&zs, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		return false;
+
+	size_t bound = deflateBound (&zs, len);
+	char *buf = new char[bound];
+
+	zs.next_in = (Bytef *) data;
+	zs.avail_in = len;
+	zs.next_out = (Bytef *) buf;
+	zs.avail_out = bound;
+
+	int ret = deflate (&zs, Z_FINISH);
+	size_t clen = bound - zs.avail_out;
+	deflateEnd (&zs);
+
+	if (ret != Z_STREAM_END || clen >= len)
+	{
+		delete[] buf;
+		return false;
+	}
+
+	out.assign (buf, clen);
+	delete[] buf;
+	return true;
+}
+#endif // RTS2_HAVE_ZLIB
+
+CachedResponse::CachedResponse (const char *_response_type, const char *_response, size_t _response_length, double _created, const CachePolicy &policy):response_type (_response_type), body (_response, _response_length), gzipBody (), device (policy.device)
+{
+	created = _created;
+	expires = _created + policy.maxAge;
+	invalidate = policy.invalidate;
+
+	std::ostringstream os;
+	os << '"' << std::hex << std::setfill ('0') << std::setw (16) << fnv1a (_response, _response_length) << '-' << _response_length << '"';
+	etag = os.str ();
+
+#ifdef RTS2_HAVE_ZLIB
+	// JPEGs and other images are already compressed
+	if (_response_length >= CACHE_GZIP_MIN_SIZE && strncmp (_response_type, "image/", 6))
+		gzipData (_response, _response_length, gzipBody);
+#endif
+}
+
+bool CachedResponse::invalidatedBy (int events, const char *_device)
+{
+	if ((invalidate & events) == 0)
+		return false;
+	if (_device == NULL || device.length () == 0)
+		return true;
+	return device == _device;
+}
+
+ResponseCache::ResponseCache (size_t _maxEntries, size_t _maxSize):entries ()
+{
+	maxEntries = _maxEntries;
+	maxSize = _maxSize;
+	currentSize = 0;
+}
+
+ResponseCache::~ResponseCache ()
+{
+	clear ();
+}
+
+static bool paramCompare (XmlRpc::HttpParam p1, XmlRpc::HttpParam p2)
+{
+	int c = strcmp (p1.getName (), p2.getName ());
+	if (c == 0)
+		return strcmp (p1.getValue (), p2.getValue ()) < 0;
+	return c < 0;
+}
+
+std::string ResponseCache::requestKey (const std::string &prefix, const std::string &path, XmlRpc::HttpParams *params, const std::string &validator)
+{
+	std::ostringstream os;
+	os << prefix << path;
+	if (params != NULL && params->size () > 0)
+	{
+		std::vector <XmlRpc::HttpParam> sorted (params->begin (), params->end ());
+		std::sort (sorted.begin (), sorted.end (), paramCompare);
+		char sep = '?';
+		for (std::vector <XmlRpc::HttpParam>::iterator iter = sorted.begin (); iter != sorted.end (); iter++)
+		{
+			os << sep << iter->getName () << '=' << iter->getValue ();
+			sep = '&';
+		}
+	}
+	if (validator.length () > 0)
+		os << '#' << validator;
+	return os.str ();
+}
+
+CachedResponse *ResponseCache::find (const std::string &key, double now)
+{
+	std::map <std::string, CachedResponse *>::iterator iter = entries.find (key);
+	if (iter == entries.end ())
+		return NULL;
+	if (iter->second->expired (now))
+	{
+		remove (iter);
+		return NULL;
+	}
+	return iter->second;
+}
+
+CachedResponse *ResponseCache::add (const std::string &key, const char *response_type, const char *response, size_t response_length, double now, const CachePolicy &policy)
+{
+	std::map <std::string, CachedResponse *>::iterator iter = entries.find (key);
+	if (iter != entries.end ())
+		remove (iter);
+
+	CachedResponse *cr = new CachedResponse (response_type, response, response_length, now, policy);
+
+	expire (now, cr->getSize ());
+
+	entries[key] = cr;
+	for (int b = 0; b < CACHE_INVALIDATE_BITS; b++)
+	{
+		if (policy.invalidate & (1 << b))
+			eventIndex[b][policy.device].insert (key);
+	}
+	currentSize += cr->getSize ();
+	return cr;
+}
+
+void ResponseCache::invalidate (int events, const char *device)
+{
+	// collect keys first, removal modifies the index
+	std::set <std::string> keys;
+	for (int b = 0; b < CACHE_INVALIDATE_BITS; b++)
+	{
+		if ((events & (1 << b)) == 0)
+			continue;
+		std::map <std::string, std::set <std::string> > &index = eventIndex[b];
+		if (device == NULL)
+		{
+			for (std::map <std::string, std::set <std::string> >::iterator iter = index.begin (); iter != index.end (); iter++)
+				keys.insert (iter->second.begin (), iter->second.end ());
+			continue;
+		}
+		std::map <std::string, std::set <std::string> >::iterator iter = index.find (device);
+		if (iter != index.end ())
+			keys.insert (iter->second.begin (), iter->second.end ());
+		// entries not bound to a device are invalidated by events of any device
+		iter = index.find (std::string ());
+		if (iter != index.end ())
+			keys.insert (iter->second.begin (), iter->second.end ());
+	}
+	removeKeys (keys);
+}
+
+void ResponseCache::clear ()
+{
+	for (std::map <std::string, CachedResponse *>::iterator iter = entries.begin (); iter != entries.end (); iter++)
+		delete iter->second;
+	entries.clear ();
+	for (int b = 0; b < CACHE_INVALIDATE_BITS; b++)
+		eventIndex[b].clear ();
+	currentSize = 0;
+}
+
+void ResponseCache::remove (std::map <std::string, CachedResponse *>::iterator iter)
+{
+	CachedResponse *cr = iter->second;
+	for (int b = 0; b < CACHE_INVALIDATE_BITS; b++)
+	{
+		if ((cr->getInvalidate () & (1 << b)) == 0)
+			continue;
+		std::map <std::string, std::set <std::string> >::iterator di = eventIndex[b].find (cr->getDevice ());
+		if (di == eventIndex[b].end ())
+			continue;
+		di->second.erase (iter->first);
+		if (di->second.empty ())
+			eventIndex[b].erase (di);
+	}
+	currentSize -= cr->getSize ();
+	delete cr;
+	entries.erase (iter);
+}
+
+void ResponseCache::removeKeys (const std::set <std::string> &keys)
+{
+	for (std::set <std::string>::const_iterator ki = keys.begin (); ki != keys.end (); ki++)
+	{
+		std::map <std::string, CachedResponse *>::iterator iter = entries.find (*ki);
+		if (iter != entries.end ())
+			remove (iter);
+	}
+}
+
+void ResponseCache::expire (double now, size_t newSize)
+{
+	if (entries.size () < maxEntries && currentSize + newSize <= maxSize)
+		return;
+
+	for (std::map <std::string, CachedResponse *>::iterator iter = entries.begin (); iter != entries.end ();)
+	{
+		if (iter->second->expired (now))
+			remove (iter++);
+		else
+			iter++;
+	}
+
+	while (entries.size () > 0 && (entries.size () >= maxEntries || currentSize + newSize > maxSize))
+	{
+		std::map <std::string, CachedResponse *>::iterator oldest = entries.begin ();
+		for (std::map <std::string, CachedResponse *>::iterator iter = entries.begin (); iter != entries.end (); iter++)
+		{
+			if (iter->second->getCreated () < oldest->second->getCreated ())
+				oldest = iter;
+		}
+		remove (oldest);
+	}
+}
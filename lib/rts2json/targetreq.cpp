@@ -31,6 +31,8 @@
 #include "rts2db/constraints.h"
 #include "rts2db/planset.h"
 #include "rts2db/labels.h"
+
+#include "rts2script/scriptcache.h"
 #endif /* RTS2_HAVE_PGSQL */
 
 using namespace rts2json;
@@ -496,6 +498,7 @@ void Targets::callAPI (rts2db::Target *tar, XmlRpc::HttpParams *params, const ch
 	if (e != NULL && c != NULL)
 	{
 		tar->setScript (c, e);
+		rts2script::ScriptCache::instance ()->invalidate (tar->getTargetID ());
 		returnJSON ("{\"status\":0}", response_type, response, response_length);
 		return;
 	}
@@ -0,0 +1,64 @@
+/*
+ * Journal of serialised value changes.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2json/valuejournal.h"
+#include "rts2json/jsonvalue.h"
+
+#include <sys/time.h>
+#include <unistd.h>
+
+using namespace rts2json;
+
+ValueJournal::ValueJournal (size_t _maxRecords):records ()
+{
+	maxRecords = _maxRecords;
+	nextSeq = 1;
+	enabled = false;
+
+	struct timeval tv;
+	gettimeofday (&tv, NULL);
+	std::ostringstream os;
+	os << std::hex << tv.tv_sec << "." << tv.tv_usec << "." << getpid ();
+	instance = os.str ();
+}
+
+const ValueChangeRecord *ValueJournal::record (const char *device, rts2core::Value *value)
+{
+	if (enabled == false)
+		return NULL;
+
+	std::ostringstream os;
+	os << std::fixed;
+	rts2json::jsonValue (value, true, os);
+
+	while (records.size () >= maxRecords)
+		records.pop_front ();
+
+	records.push_back (ValueChangeRecord (nextSeq, device, value->getName (), os.str ()));
+	nextSeq++;
+	return &(records.back ());
+}
+
+const ValueChangeRecord *ValueJournal::find (unsigned long seq)
+{
+	if (records.empty () || seq < records.front ().seq || seq > records.back ().seq)
+		return NULL;
+	// sequence numbers in the journal are continuous
+	return &(records[seq - records.front ().seq]);
+}
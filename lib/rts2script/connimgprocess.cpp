@@ -19,6 +19,7 @@
 
 #include "rts2script/connimgprocess.h"
 
+#include "catfile.h"
 #include "command.h"
 #include "configuration.h"
 #include "utilsfunc.h"
@@ -54,6 +55,12 @@ int ConnProcess::init ()
 	return ConnExe::init ();
 }
 
+/**
+ * Catalogue of native plate solver, opened on first use.
+ */
+static rts2catd::CatFile *solverCatalogue = NULL;
+static bool solverCatalogueFailed = false;
+
 ConnImgOnlyProcess::ConnImgOnlyProcess (rts2core::Block *_master, const char *_exe, const char *_path, int _timeout):ConnProcess (_master, _exe, _timeout)
 {
 	imgPath = std::string (_path);
@@ -64,8 +71,11 @@ int ConnImgOnlyProcess::init ()
 {
 	try
 	{
+		std::string catalogue = Configuration::instance ()->getAstrometryCatalogue ();
+
 		Image image;
-		image.openFile (imgPath.c_str (), true, false);
+		// image is written with native astrometry results
+		image.openFile (imgPath.c_str (), catalogue.empty (), false);
 		if (image.getShutter () == SHUT_CLOSED)
 		{
 			astrometryStat = DARK;
@@ -73,6 +83,28 @@ int ConnImgOnlyProcess::init ()
 		}
 
 		expDate = image.getExposureStart () + image.getExposureLength ();
+
+		int minSources = Configuration::instance ()->getAstrometryMinSources ();
+		if (minSources > 0)
+		{
+			int srcnum;
+			try
+			{
+				image.getValue ("SRCNUM", srcnum, true);
+			}
+			catch (rts2image::KeyNotFound &er)
+			{
+				srcnum = image.extractSources ();
+			}
+			if (srcnum >= 0 && srcnum < minSources)
+			{
+				logStream (MESSAGE_INFO) << "only " << srcnum << " sources detected on " << imgPath << ", skipping astrometry" << sendLog;
+				astrometryStat = TRASH;
+			}
+		}
+
+		if (astrometryStat == NOT_ASTROMETRY && !catalogue.empty ())
+			solveNative (image, catalogue.c_str ());
 	}
 	catch (rts2core::Error &e)
 	{
@@ -87,6 +119,40 @@ int ConnImgOnlyProcess::init ()
 	return ConnProcess::init ();
 }
 
+void ConnImgOnlyProcess::solveNative (Image &image, const char *catalogue)
+{
+	if (solverCatalogue == NULL)
+	{
+		if (solverCatalogueFailed)
+			return;
+		solverCatalogue = new rts2catd::CatFile ();
+		if (solverCatalogue->openFile (catalogue))
+		{
+			logStream (MESSAGE_ERROR) << "cannot open plate solver catalogue " << catalogue << ", native plate solver disabled" << sendLog;
+			delete solverCatalogue;
+			solverCatalogue = NULL;
+			solverCatalogueFailed = true;
+			return;
+		}
+	}
+
+	PlateSolver solver (solverCatalogue);
+	solver.setSearchRadius (Configuration::instance ()->getAstrometrySearchRadius ());
+	plateSolution sol;
+	double t = getNow ();
+	if (image.solveAstrometry (solver, sol))
+	{
+		logStream (MESSAGE_DEBUG) << "native plate solver failed on " << imgPath << ", calling astrometry script" << sendLog;
+		return;
+	}
+
+	id = image.getImgId ();
+	image.getAstroResults (ra, dec, ra_err, dec_err);
+	logStream (MESSAGE_INFO) << "solved " << imgPath << " in " << (getNow () - t) << " s, " << sol.matched << " stars, RMS " << sol.rms << " arcsec" << sendLog;
+	astrometryStat = GET;
+	checkAstrometry ();
+}
+
 void ConnImgOnlyProcess::processCommand (char *cmd)
 {
 	if (!strcasecmp (cmd, "correct"))
@@ -156,7 +222,8 @@ ConnImgProcess::ConnImgProcess (rts2core::Block *_master, const char *_exe, cons
 
 int ConnImgProcess::newProcess ()
 {
-	if (astrometryStat == DARK)
+	// native plate solver provided astrometry
+	if (astrometryStat == DARK || astrometryStat == TRASH || astrometryStat == GET)
 		return 0;
 	
 	return ConnImgOnlyProcess::newProcess ();
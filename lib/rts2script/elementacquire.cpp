@@ -176,6 +176,9 @@ int ElementAcquire::processImage (Image * image)
 	obsId = image->getObsId ();
 	imgId = image->getImgId ();
 	processor = new ConnImgProcess (script->getMaster (), defaultImgProccess.c_str (), image->getFileName (), Configuration::instance ()->getAstrometryTimeout ());
+	// detected sources are used to skip astrometry on empty images
+	if (Configuration::instance ()->getAstrometryMinSources () > 0 && image->extractSources () >= 0)
+		image->writeSourcesStats ();
 	// save image before processing..
 	image->saveImage ();
 	ret = processor->init ();
@@ -566,7 +566,7 @@ void ElementWhile::printScript (std::ostream &os)
 
 bool ElementWhile::endLoop ()
 {
-	return getLoopCount () >= max_cycles || condition->getDouble () == 0;
+	return getLoopCount () >= max_cycles || conditionCode.evaluate () == 0;
 }
 
 void ElementDo::printScript (std::ostream &os)
@@ -579,7 +579,7 @@ bool ElementDo::endLoop ()
 {
 	if (getLoopCount () == 0)
 		return false;
-	return getLoopCount () >= max_cycles || condition->getDouble () == 0;
+	return getLoopCount () >= max_cycles || conditionCode.evaluate () == 0;
 }
 
 void ElementOnce::printScript (std::ostream &os)
@@ -17,7 +17,6 @@
  * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
  */
 
-#include "rts2script/simulque.h"
 #include "rts2script/executorque.h"
 #include "rts2script/script.h"
 #include "rts2db/constraints.h"
@@ -41,6 +40,7 @@ QueuedTarget::QueuedTarget (unsigned int _queue_id, rts2db::Target * _target, do
 	rep_separation = _rep_separation;
 
 	unobservable_reported = false;
+	simulationStarted = false;
 
 	create ();
 }
@@ -49,35 +49,63 @@ QueuedTarget::QueuedTarget (unsigned int _queue_id, unsigned int _qid, struct ln
 {
 	load ();
 	target = createTarget (tar_id, observer, obs_altitude);
+	unobservable_reported = false;
+	simulationStarted = false;
 }
 
 /**
  * Sorting based on altitude.
  */
-class sortQuedTargetByAltitude:public rts2db::sortByAltitude
+class sortQuedTargetByAltitude
 {
 	public:
-		sortQuedTargetByAltitude (struct ln_lnlat_posn *_observer = NULL, double _jd = NAN):rts2db::sortByAltitude (_observer, _jd) {}
-		bool operator () (QueuedTarget &tar1, QueuedTarget &tar2) { return doSort (tar1.target, tar2.target); }
+		sortQuedTargetByAltitude (TargetQueue *_queue, double _jd) { queue = _queue; JD = _jd; }
+		bool operator () (QueuedTarget &tar1, QueuedTarget &tar2);
+	private:
+		TargetQueue *queue;
+		double JD;
 };
 
+bool sortQuedTargetByAltitude::operator () (QueuedTarget &tar1, QueuedTarget &tar2)
+{
+	struct ln_hrz_posn hr1, hr2;
+	queue->getAltAz (tar1.target, &hr1, JD);
+	queue->getAltAz (tar2.target, &hr2, JD);
+	return hr1.alt > hr2.alt;
+}
+
 /**
- * Sort from westmost to eastmost objects
+ * Sort from westmost to eastmost objects. Target positions are retrieved
+ * from the queue.
  */
-class sortQuedTargetWestEast:public rts2db::sortWestEast
+class sortQuedTargetWestEast
 {
 	public:
-		sortQuedTargetWestEast (struct ln_lnlat_posn *_observer = NULL, double _jd = NAN):rts2db::sortWestEast (_observer, _jd) {};
+		sortQuedTargetWestEast (TargetQueue *_queue, double _jd) { queue = _queue; JD = _jd; }
 		bool operator () (QueuedTarget &tar1, QueuedTarget &tar2) { return doSort (tar1.target, tar2.target); }
+	protected:
+		bool doSort (rts2db::Target *tar1, rts2db::Target *tar2);
+		TargetQueue *queue;
+		double JD;
 };
 
+bool sortQuedTargetWestEast::doSort (rts2db::Target *tar1, rts2db::Target *tar2)
+{
+	bool above1 = queue->isAboveHorizon (tar1, JD);
+	bool above2 = queue->isAboveHorizon (tar2, JD);
+	if (above1 != above2)
+		return above1 == true;
+	// ha1 on west, ha2 on east - ha1 is winner
+	return queue->getHourAngle (tar1, JD) > queue->getHourAngle (tar2, JD);
+}
+
 /**
  * Sort by priority, and then west to east
  */
-class sortByMeridianPriority:public rts2db::sortWestEast
+class sortByMeridianPriority:public sortQuedTargetWestEast
 {
 	public:
-		sortByMeridianPriority (struct ln_lnlat_posn *_observer, double jd):rts2db::sortWestEast (_observer, jd) {};
+		sortByMeridianPriority (TargetQueue *_queue, double jd):sortQuedTargetWestEast (_queue, jd) {};
 		bool operator () (rts2db::Target *tar1, rts2db::Target *tar2) { return doSort (tar1, tar2); }
 	protected:
 		bool doSort (rts2db::Target *tar1, rts2db::Target *tar2);
@@ -86,15 +114,15 @@ class sortByMeridianPriority:public rts2db::sortWestEast
 bool sortByMeridianPriority::doSort (rts2db::Target *tar1, rts2db::Target *tar2)
 {
 	// if both targets did not yet pass meridian, pick the highest
-	if (tar1->getHourAngle (JD, observer) < 0 && tar2->getHourAngle (JD, observer) < 0)
+	if (queue->getHourAngle (tar1, JD) < 0 && queue->getHourAngle (tar2, JD) < 0)
 	{
 		struct ln_hrz_posn hr1, hr2;
-		tar1->getAltAz (&hr1, JD, observer);
-		tar2->getAltAz (&hr2, JD, observer);
+		queue->getAltAz (tar1, &hr1, JD);
+		queue->getAltAz (tar2, &hr2, JD);
 		return hr1.alt > hr2.alt;
 	}	
 	if (tar1->getTargetPriority () == tar2->getTargetPriority ())
-		return sortWestEast::doSort (tar1, tar2);
+		return sortQuedTargetWestEast::doSort (tar1, tar2);
 	else
 		return tar1->getTargetPriority () > tar2->getTargetPriority ();
 }
@@ -103,10 +131,10 @@ bool sortByMeridianPriority::doSort (rts2db::Target *tar1, rts2db::Target *tar2)
  * Sort targets by time they set. First will be targets that go out of limits, last targets that are
  * above limits for the longest period of time (or are below limit now)
  */
-class sortByOutOfLimits:public rts2db::sortWestEast
+class sortByOutOfLimits:public sortQuedTargetWestEast
 {
 	public:
-		sortByOutOfLimits (struct ln_lnlat_posn *_observer, double jd):rts2db::sortWestEast (_observer, jd) {};
+		sortByOutOfLimits (TargetQueue *_queue, double jd):sortQuedTargetWestEast (_queue, jd) {};
 		bool operator () (rts2db::Target *tar1, rts2db::Target *tar2) { return doSort (tar1, tar2); }
 	protected:
 		bool doSort (rts2db::Target *tar1, rts2db::Target *tar2);
@@ -118,13 +146,13 @@ bool sortByOutOfLimits::doSort (rts2db::Target *tar1, rts2db::Target *tar2)
 	ln_get_timet_from_julian (JD, &t_from);
 	double from = t_from;
 
-	double v1 = tar1->getSatisfiedDuration (from, from + 86400, 0, 60);
-	double v2 = tar2->getSatisfiedDuration (from, from + 86400, 0, 60);
+	double v1 = queue->getSatisfiedDuration (tar1, from, from + 86400, 0, 60);
+	double v2 = queue->getSatisfiedDuration (tar2, from, from + 86400, 0, 60);
 	std::cout << "sorting " << tar1->getTargetName () << " " << v1 << " 2: " << tar2->getTargetName () << " " << v2 << std::endl;
 	if ((isnan (v1) && isnan (v2)) || (isinf (v1) && isinf (v2)))
 	{
 		// if both are not visible, order west-east..
-		return sortWestEast::doSort (tar1, tar2);
+		return sortQuedTargetWestEast::doSort (tar1, tar2);
 	}
 	// only one is not visible..
 	else if (isnan (v1) || isinf (v2))
@@ -173,9 +201,7 @@ void TargetQueue::beforeChange (double now)
 						front ().t_start = now + front ().rep_separation;
 					}
 				}
-				push_back (QueuedTarget (front (), createTarget (front ().target->getTargetID (), *observer, obs_altitude)));
-				delete front ().target;
-				pop_front ();
+				requeueFront ();
 			}
 			break;
 		case QUEUE_FIFO:
@@ -191,15 +217,42 @@ void TargetQueue::beforeChange (double now)
 				{
 					front ().t_start = now + front ().rep_separation;
 				}
-				push_back (QueuedTarget (front (), createTarget (front ().target->getTargetID (), *observer, obs_altitude)));
-				delete front ().target;
-				pop_front ();
+				requeueFront ();
 			}
 			break;
 	}
 	filter (now);
 }
 
+double TargetQueue::getSatisfiedDuration (rts2db::Target *tar, double from, double to, double length, double step)
+{
+	return tar->getSatisfiedDuration (from, to, length, step);
+}
+
+void TargetQueue::getAltAz (rts2db::Target *tar, struct ln_hrz_posn *hrz, double JD)
+{
+	tar->getAltAz (hrz, JD, *observer);
+}
+
+double TargetQueue::getHourAngle (rts2db::Target *tar, double JD)
+{
+	return tar->getHourAngle (JD, *observer);
+}
+
+bool TargetQueue::isAboveHorizon (rts2db::Target *tar, double JD)
+{
+	struct ln_hrz_posn hrz;
+	tar->getAltAz (&hrz, JD, *observer);
+	return tar->isAboveHorizon (&hrz);
+}
+
+void TargetQueue::requeueFront ()
+{
+	push_back (QueuedTarget (front (), createTarget (front ().target->getTargetID (), *observer, obs_altitude)));
+	delete front ().target;
+	pop_front ();
+}
+
 void TargetQueue::sortQueue (double now)
 {
 	time_t t_now = now;
@@ -210,10 +263,10 @@ void TargetQueue::sortQueue (double now)
 		case QUEUE_CIRCULAR:
 			break;
 		case QUEUE_HIGHEST:
-			sort (sortQuedTargetByAltitude (*observer, now_JD));
+			sort (sortQuedTargetByAltitude (this, now_JD));
 			break;
 		case QUEUE_WESTEAST:
-			sort (sortQuedTargetWestEast (*observer, now_JD));
+			sort (sortQuedTargetWestEast (this, now_JD));
 			break;
 		case QUEUE_WESTEAST_MERIDIAN:
 			sortWestEastMeridian (now_JD);
@@ -306,13 +359,13 @@ void TargetQueue::sortWestEastMeridian (double jd)
 	while (!preparedTargets.empty ())
 	{
 		// find maximal priority in targets, and order by HA..
-		preparedTargets.sort (sortByMeridianPriority (*observer, jd));
+		preparedTargets.sort (sortByMeridianPriority (this, jd));
 		// now find the first target which is on west (for HA + its duration).
 		std::list < rts2db::Target *>::iterator iter;
 
 		for (iter = preparedTargets.begin (); iter != preparedTargets.end (); iter++)
 		{
-		  	// std::cout << (*iter)->getTargetName () << " " << (*iter)->getHourAngle (jd, *observer) << " " << getMaximalDuration (*iter) << " " << (*iter)->getHourAngle (jd, *observer) / 15.0 + getMaximalDuration (*iter) / 3600.0 << std::endl; 
+		  	// std::cout << (*iter)->getTargetName () << " " << getHourAngle (*iter, jd) << " " << getMaximalDuration (*iter) << " " << getHourAngle (*iter, jd) / 15.0 + getMaximalDuration (*iter) / 3600.0 << std::endl; 
 			// skip target if it's not above horizon
 			ExecutorQueue::iterator qi = findTarget (*iter);
 			double tjd = jd;
@@ -323,7 +376,7 @@ void TargetQueue::sortWestEastMeridian (double jd)
 			}
 
 			jd = tjd;	
-			if ((*iter)->getHourAngle (jd, *observer) / 15.0 + getMaximalDuration (*iter) / 3600.0 > 0)
+			if (getHourAngle (*iter, jd) / 15.0 + getMaximalDuration (*iter) / 3600.0 > 0)
 				break;  
 		}
 		// If such target does not exists, select front..
@@ -358,14 +411,14 @@ void TargetQueue::sortOutOfLimits (double jd)
 	{
 		std::cout << "sorting by out of limits" << std::endl;
 		// find maximal priority in targets, and order by HA..
-		preparedTargets.sort (sortByOutOfLimits (*observer, jd));
+		preparedTargets.sort (sortByOutOfLimits (this, jd));
 		std::cout << "sorting finished" << std::endl;
 		// now find the first target which is on west (for HA + its duration).
 		std::list < rts2db::Target *>::iterator iter;
 
 		for (iter = preparedTargets.begin (); iter != preparedTargets.end (); iter++)
 		{
-		  	std::cout << "sort out of limits " << (*iter)->getTargetName () << " " << (*iter)->getHourAngle (jd, *observer) << " " << getMaximalDuration (*iter) << " " << (*iter)->getHourAngle (jd, *observer) / 15.0 + getMaximalDuration (*iter) / 3600.0 << std::endl; 
+		  	std::cout << "sort out of limits " << (*iter)->getTargetName () << " " << getHourAngle (*iter, jd) << " " << getMaximalDuration (*iter) << " " << getHourAngle (*iter, jd) / 15.0 + getMaximalDuration (*iter) / 3600.0 << std::endl; 
 			// skip target if it's not above horizon
 			ExecutorQueue::iterator qi = findTarget (*iter);
 			double tjd = jd;
@@ -376,7 +429,7 @@ void TargetQueue::sortOutOfLimits (double jd)
 			}
 
 			jd = tjd;	
-			if ((*iter)->getHourAngle (jd, *observer) / 15.0 + getMaximalDuration (*iter) / 3600.0 > 0)
+			if (getHourAngle (*iter, jd) / 15.0 + getMaximalDuration (*iter) / 3600.0 > 0)
 				break;  
 		}
 		// If such target does not exists, select front..
@@ -414,7 +467,8 @@ void TargetQueue::filterExpired (double now)
 				double t_end = iter->t_end;
 				if ((!isnan (t_start) && t_start <= now) || (!isnan (t_end) && t_end <= now))
 				{
-					logStream (MESSAGE_DEBUG) << "target " << iter->target->getTargetName () << " (" << iter->target->getTargetID () << ") has start and end times set (" << LibnovaDateDouble (t_start) << " " << LibnovaDateDouble (t_end) << ", removing previous targets." << sendLog;
+					if (logChanges ())
+						logStream (MESSAGE_DEBUG) << "target " << iter->target->getTargetName () << " (" << iter->target->getTargetID () << ") has start and end times set (" << LibnovaDateDouble (t_start) << " " << LibnovaDateDouble (t_end) << ", removing previous targets." << sendLog;
 					for (TargetQueue::iterator irem = begin (); irem != iter;)
 						irem = removeEntry (irem, REMOVED_NEXT_NEEDED);
 				}
@@ -429,7 +483,7 @@ void TargetQueue::filterExpired (double now)
 		double t_end = iter->t_end;
 		if (!isnan (t_end) && t_end <= now)
 			iter = removeEntry (iter, REMOVED_TIMES_EXPIRED);
-		else if (iter->target->observationStarted () && getRemoveAfterExecution () == true)
+		else if (observationStarted (*iter) && getRemoveAfterExecution () == true)
 		  	iter = removeEntry (iter, REMOVED_STARTED);
 		else  
 			iter++;
@@ -469,7 +523,7 @@ void TargetQueue::filterUnobservable (double now, double maxLength, std::list <Q
 					cameras->load ();
 				}
 				// calculate target script length..
-				double tl = getMaximalDuration (iter->target, NULL, iter->target->observationStarted () ? 1 : 0);
+				double tl = getMaximalDuration (iter->target, NULL, observationStarted (*iter) ? 1 : 0);
 				// if target will fit into available time, and target isAbove..
 				if (((getRemoveAfterExecution () == false && removeObserved == false) || tl < maxLength) && isAboveHorizon (*iter, tjd))
 					return;
@@ -483,9 +537,10 @@ void TargetQueue::filterUnobservable (double now, double maxLength, std::list <Q
 					case QUEUE_CIRCULAR:
 						break;
 					default:
-						if (!(isnan (iter->t_start) && isnan (iter->t_end)) && iter->target->observationStarted ())
+						if (!(isnan (iter->t_start) && isnan (iter->t_end)) && observationStarted (*iter))
 						{
-							logStream (MESSAGE_WARNING) << "target " << iter->target->getTargetName () << " (" << iter->target->getTargetID () << ") was observed, and as it has specified start or end times (" << LibnovaDateDouble (iter->t_start) << " to " << LibnovaDateDouble (iter->t_end) << "), and queue is not circular (" << getQueueType () << "), it will be removed" << sendLog;
+							if (logChanges ())
+								logStream (MESSAGE_WARNING) << "target " << iter->target->getTargetName () << " (" << iter->target->getTargetID () << ") was observed, and as it has specified start or end times (" << LibnovaDateDouble (iter->t_start) << " to " << LibnovaDateDouble (iter->t_end) << "), and queue is not circular (" << getQueueType () << "), it will be removed" << sendLog;
 							iter->remove ();
 							iter = erase (iter);
 							continue;
@@ -493,7 +548,8 @@ void TargetQueue::filterUnobservable (double now, double maxLength, std::list <Q
 				}
 				if (iter->unobservable_reported == false)
 				{
-					logStream (MESSAGE_WARNING) << "Target " << iter->target->getTargetName () << " (" << iter->target->getTargetID () << ") is at " << LibnovaDate (tjd) << " unobservable, putting it on back of the queue" << sendLog;
+					if (logChanges ())
+						logStream (MESSAGE_WARNING) << "Target " << iter->target->getTargetName () << " (" << iter->target->getTargetID () << ") is at " << LibnovaDate (tjd) << " unobservable, putting it on back of the queue" << sendLog;
 					iter->unobservable_reported = true;
 				}
 
@@ -502,7 +558,8 @@ void TargetQueue::filterUnobservable (double now, double maxLength, std::list <Q
 			}
 			else
 			{
-				logStream (MESSAGE_WARNING) << "Removing target " << iter->target->getTargetName () << " (" << iter->target->getTargetID () << ") is at " << LibnovaDate (tjd) << " below horizon" << sendLog;
+				if (logChanges ())
+					logStream (MESSAGE_WARNING) << "Removing target " << iter->target->getTargetName () << " (" << iter->target->getTargetID () << ") is at " << LibnovaDate (tjd) << " below horizon" << sendLog;
 				iter->remove ();
 				iter = erase (iter);
 			}
@@ -817,46 +874,6 @@ int ExecutorQueue::selectNextObservation (int &pid, int &qid, bool &hard, double
 	return -1;
 }
 
-int ExecutorQueue::selectNextSimulation (SimulQueueTargets &sq, double from, double to, double &e_end, struct ln_equ_posn *currentp, struct ln_equ_posn *nextp)
-{
-	if (queueEnabled->getValueBool () == false)
-		return -1;
-	if (sq.size () > 0)
-	{
-		time_t tn = from;
-		double JD = ln_get_julian_from_timet (&tn);
-		sq.front ().target->getPosition (nextp, JD);
-		double md = getMaximalDuration (sq.front ().target, currentp);
-		if (isAboveHorizon (sq.front(), JD) && sq.front ().notExpired (from) && from + md < to)
-		{
-		  	// single execution?
-			if (removeAfterExecution->getValueBool ())
-			{
-				e_end = from + md;
-			}
-			// otherwise, put end to either time_end, 
-			else
-			{
-				if (!isnan (sq.front ().t_end))
-				{
-				  	e_end = sq.front ().t_end;
-				}
-				// or to time when target will become unacessible
-				else
-				{
-					e_end = sq.front ().target->getSatisfiedDuration (from, to, md, 60);
-					if (isnan (e_end))
-						e_end = to;
-				}
-			}
-			return sq.front ().target->getTargetID ();
-		}
-		// if target is not visible, put its start time as cutoff to possible next queue simulation
-		e_end = sq.front ().t_start;
-	}
-	return -1;
-}
-
 int ExecutorQueue::queueFromConn (rts2core::Connection *conn, int index, bool withTimes, bool tryFirstPossible, double n_start, bool withNRep)
 {
 	double t_start = NAN;
@@ -258,6 +258,33 @@ double OperandsLREquation::getDouble ()
 	throw rts2script::ParsingError (_os.str ());
 }
 
+void OperandsLREquation::compile (rts2expression::Bytecode &bc)
+{
+	l->compile (bc);
+	r->compile (bc);
+	switch (cmp)
+	{
+		case CMP_EQUAL:
+			bc.pushOperator (rts2expression::EQU);
+			return;
+		case CMP_LESS:
+			bc.pushOperator (rts2expression::LT);
+			return;
+		case CMP_LESS_EQU:
+			bc.pushOperator (rts2expression::LEQU);
+			return;
+		case CMP_GREAT_EQU:
+			bc.pushOperator (rts2expression::GEQU);
+			return;
+		case CMP_GREAT:
+			bc.pushOperator (rts2expression::GT);
+			return;
+	}
+	std::ostringstream _os;
+	_os << "Unknown comparator " << cmp;
+	throw rts2script::ParsingError (_os.str ());
+}
+
 const char* OperandsLREquation::getCmpSymbol ()
 {
 	const char *cmp_sym[] = { "==", "<", "<=", ">=", ">" };
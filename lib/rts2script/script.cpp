@@ -19,6 +19,7 @@
  */
 
 #include "rts2script/script.h"
+#include "rts2script/scriptcache.h"
 
 #include "elementexe.h"
 #include "elementhex.h"
@@ -233,8 +234,24 @@ void Script::parseScript (Rts2Target *target)
 
 int Script::setTarget (const char *cam_name, Rts2Target * target)
 {
-	std::string scriptText;
+	std::vector <std::string> lines;
 
+	try
+	{
+		getScriptLines (cam_name, target, lines);
+	}
+	catch (rts2core::Error &er)
+	{
+		logStream (MESSAGE_ERROR) << "cannot load script for device " << cam_name << " and target " << target->getTargetName () << "(# " << target->getTargetID () << sendLog;
+		el_iter = begin ();
+		return -1;
+	}
+
+	return setTarget (cam_name, target, lines);
+}
+
+int Script::setTarget (const char *cam_name, Rts2Target * target, const std::vector <std::string> &lines)
+{
 	target->getPosition (&target_pos);
 
 	strcpy (defaultDevice, cam_name);
@@ -249,27 +266,14 @@ int Script::setTarget (const char *cam_name, Rts2Target * target)
 	commentNumber = 1;
 	wholeScript = std::string ("");
 
-	int ret = 1;
-	do
+	for (std::vector <std::string>::const_iterator iter = lines.begin (); iter != lines.end (); iter++)
 	{
 		delete[] cmdBuf;
 
-		try
-		{
-			ret = target->getScript (cam_name, scriptText);
-		}
-		catch (rts2core::Error &er)
-		{
-			logStream (MESSAGE_ERROR) << "cannot load script for device " << cam_name << " and target " << target->getTargetName () << "(# " << target->getTargetID () << sendLog;
-			el_iter = begin ();
-			return -1;
-		}
-
-		cmdBuf = new char[scriptText.length () + 1];
-		strcpy (cmdBuf, scriptText.c_str ());
+		cmdBuf = new char[iter->length () + 1];
+		strcpy (cmdBuf, iter->c_str ());
 		parseScript (target);
-		// ret == 0 if this was the last (or only) line of the script - see target->getScript call comments.
-	} while (ret == 1);
+	}
 
 	executedCount = 0;
 	currElement = NULL;
@@ -281,6 +285,13 @@ int Script::setTarget (const char *cam_name, Rts2Target * target)
 	return 0;
 }
 
+double Script::getSlewDuration (struct ln_equ_posn *tel, struct ln_equ_posn *pos)
+{
+	if (tel == NULL || isnan (pos->ra) || isnan (pos->dec))
+		return 0;
+	return getTelescopeSettleTime () + ln_get_angular_separation (tel, pos) * getTelescopeSpeed ();
+}
+
 void Script::postEvent (rts2core::Event * event)
 {
 	Script::iterator el_iter_sig;
@@ -960,12 +971,7 @@ Script::iterator Script::findElement (const char *name, Script::iterator start)
 
 double Script::getExpectedDuration (struct ln_equ_posn *tel, int runnum)
 {
-	double ret = 0;
-	if (tel && !isnan (target_pos.ra) && !isnan (target_pos.dec))
-	{
-		double dist = ln_get_angular_separation (tel, &target_pos);
-		ret += getTelescopeSettleTime () + dist * getTelescopeSpeed ();
-	}
+	double ret = getSlewDuration (tel, &target_pos);
 	for (Script::iterator iter = begin (); iter != end (); iter++)
 		ret += (*iter)->getExpectedDuration (runnum);
 	return ret;
@@ -987,16 +993,25 @@ int Script::getExpectedImages ()
 	return ret;
 }
 
+void rts2script::getScriptLines (const char *cam_name, Rts2Target *target, std::vector <std::string> &lines)
+{
+	lines.clear ();
+	bool ret;
+	// ret == false if this was the last (or only) line of the script - see target->getScript call comments.
+	do
+	{
+		std::string scriptText;
+		ret = target->getScript (cam_name, scriptText);
+		lines.push_back (scriptText);
+	} while (ret);
+}
+
 double rts2script::getMaximalScriptDuration (Rts2Target *tar, rts2db::CamList &cameras, struct ln_equ_posn *tel, int runnum)
 {
   	double md = 0;
 	for (rts2db::CamList::iterator cam = cameras.begin (); cam != cameras.end (); cam++)
 	{
-		std::string script_buf;
-		rts2script::Script script;
-		tar->getScript (cam->c_str(), script_buf);
-		script.setTarget (cam->c_str (), tar);
-		double d = script.getExpectedDuration (tel, runnum);
+		double d = ScriptCache::instance ()->getExpectedDuration (cam->c_str (), tar, tel, runnum);
 		if (d > md)
 			md = d;  
 	}
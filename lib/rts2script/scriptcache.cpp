@@ -0,0 +1,159 @@
+/*
+ * Cache of parsed target scripts.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2script/scriptcache.h"
+
+#include <math.h>
+
+using namespace rts2script;
+
+/**
+ * FNV-1a hash of script lines.
+ */
+static unsigned long hashLines (const std::vector <std::string> &lines)
+{
+	unsigned long h = 2166136261UL;
+	for (std::vector <std::string>::const_iterator iter = lines.begin (); iter != lines.end (); iter++)
+	{
+		for (std::string::const_iterator c = iter->begin (); c != iter->end (); c++)
+		{
+			h ^= (unsigned char) *c;
+			h = (h * 16777619UL) & 0xffffffffUL;
+		}
+		// line separator
+		h ^= '\n';
+		h = (h * 16777619UL) & 0xffffffffUL;
+	}
+	return h;
+}
+
+ScriptTemplate::ScriptTemplate (const char *cam_name, Rts2Target *target, const std::vector <std::string> &_lines, unsigned long _hash):lines (_lines), durations ()
+{
+	hash = _hash;
+	acquired = target->isAcquired ();
+	lightTime = NAN;
+	images = -1;
+
+	script = new Script ();
+	try
+	{
+		script->setTarget (cam_name, target, lines);
+	}
+	catch (rts2core::Error &er)
+	{
+		delete script;
+		throw;
+	}
+}
+
+ScriptTemplate::~ScriptTemplate ()
+{
+	delete script;
+}
+
+double ScriptTemplate::getExpectedDuration (int runnum)
+{
+	std::map <int, double>::iterator iter = durations.find (runnum);
+	if (iter != durations.end ())
+		return iter->second;
+	double ret = script->getExpectedDuration (NULL, runnum);
+	durations[runnum] = ret;
+	return ret;
+}
+
+double ScriptTemplate::getExpectedLightTime ()
+{
+	if (isnan (lightTime))
+		lightTime = script->getExpectedLightTime ();
+	return lightTime;
+}
+
+int ScriptTemplate::getExpectedImages ()
+{
+	if (images < 0)
+		images = script->getExpectedImages ();
+	return images;
+}
+
+ScriptCache *ScriptCache::pInstance = NULL;
+
+ScriptCache *ScriptCache::instance ()
+{
+	if (!pInstance)
+		pInstance = new ScriptCache ();
+	return pInstance;
+}
+
+ScriptCache::~ScriptCache ()
+{
+	clear ();
+}
+
+ScriptTemplate *ScriptCache::getTemplate (const char *cam_name, Rts2Target *target)
+{
+	std::vector <std::string> lines;
+	getScriptLines (cam_name, target, lines);
+
+	unsigned long hash = hashLines (lines);
+
+	std::pair <int, std::string> key (target->getTargetID (), std::string (cam_name));
+	std::map <std::pair <int, std::string>, ScriptTemplate *>::iterator iter = templates.find (key);
+	if (iter != templates.end ())
+	{
+		if (iter->second->matches (lines, hash, target->isAcquired ()))
+			return iter->second;
+		// script was changed
+		delete iter->second;
+		templates.erase (iter);
+	}
+
+	ScriptTemplate *tmpl = new ScriptTemplate (cam_name, target, lines, hash);
+	templates[key] = tmpl;
+	return tmpl;
+}
+
+double ScriptCache::getExpectedDuration (const char *cam_name, Rts2Target *target, struct ln_equ_posn *tel, int runnum)
+{
+	ScriptTemplate *tmpl = getTemplate (cam_name, target);
+	double ret = tmpl->getExpectedDuration (runnum);
+	if (tel)
+	{
+		struct ln_equ_posn pos;
+		target->getPosition (&pos);
+		ret += tmpl->getSlewDuration (tel, &pos);
+	}
+	return ret;
+}
+
+void ScriptCache::invalidate (int tar_id)
+{
+	// templates are ordered by target ID, empty camera name is the first key of the target
+	std::map <std::pair <int, std::string>, ScriptTemplate *>::iterator first = templates.lower_bound (std::pair <int, std::string> (tar_id, std::string ()));
+	std::map <std::pair <int, std::string>, ScriptTemplate *>::iterator iter;
+	for (iter = first; iter != templates.end () && iter->first.first == tar_id; iter++)
+		delete iter->second;
+	templates.erase (first, iter);
+}
+
+void ScriptCache::clear ()
+{
+	for (std::map <std::pair <int, std::string>, ScriptTemplate *>::iterator iter = templates.begin (); iter != templates.end (); iter++)
+		delete iter->second;
+	templates.clear ();
+}
@@ -1,6 +1,7 @@
 /*
  * Simulation queue.
  * Copyright (C) 2010,2011     Petr Kubanek, Institute of Physics <kubanek@fzu.cz>
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -18,20 +19,209 @@
  */
 
 #include "rts2script/simulque.h"
+#include "rts2script/scriptcache.h"
 
 using namespace rts2plan;
 
-SimulQueueTargets::SimulQueueTargets (ExecutorQueue &eq):TargetQueue (eq.master, eq.observer, eq.obs_altitude)
+SimulTarget::SimulTarget (rts2db::Target *_target)
 {
+	target = _target;
+	constraints = NULL;
+	sourceConstraints = NULL;
+	repeatsViolated = false;
+	durationsValid = false;
+
+	startPosition.ra = startPosition.dec = NAN;
+}
+
+SimulTarget::~SimulTarget ()
+{
+	delete constraints;
+	delete target;
+}
+
+void SimulTarget::refresh (rts2db::CamList &cameras, struct ln_lnlat_posn *observer, double from, double to)
+{
+	rts2db::Constraints *cs = target->getConstraints ();
+	if (cs != sourceConstraints || constraints == NULL)
+	{
+		delete constraints;
+		constraints = new rts2db::Constraints (*cs);
+		// evaluated below, as it needs database
+		constraints->erase (CONSTRAINT_MAXREPEATS);
+		sourceConstraints = cs;
+
+		samples.clear ();
+	}
+
+	rts2db::Constraints::iterator mr = cs->find (CONSTRAINT_MAXREPEATS);
+	repeatsViolated = (mr != cs->end () && !(mr->second->satisfy (target, ln_get_julian_from_sys (), NULL)));
+
+	durations.clear ();
+	durationsValid = true;
+	for (rts2db::CamList::iterator cam = cameras.begin (); cam != cameras.end (); cam++)
+	{
+		try
+		{
+			rts2script::ScriptTemplate *tmpl = rts2script::ScriptCache::instance ()->getTemplate (cam->c_str (), target);
+			scriptDuration sd;
+			sd.first = tmpl->getExpectedDuration (0);
+			sd.next = tmpl->getExpectedDuration (1);
+			sd.settleTime = tmpl->getTelescopeSettleTime ();
+			sd.speed = tmpl->getTelescopeSpeed ();
+			durations.push_back (sd);
+		}
+		catch (rts2core::Error &er)
+		{
+			logStream (MESSAGE_ERROR) << er << sendLog;
+			durationsValid = false;
+		}
+	}
+
+	time_t t = from;
+	double fromJD = ln_get_julian_from_timet (&t);
+	t = to;
+	double toJD = ln_get_julian_from_timet (&t);
+
+	target->getPosition (&startPosition, fromJD);
+
+	long first = (long) floor (fromJD * 1440.0 + 0.5);
+	long last = (long) floor (toJD * 1440.0 + 0.5);
+
+	// drop samples outside of the simulated interval
+	samples.erase (samples.begin (), samples.lower_bound (first));
+	samples.erase (samples.upper_bound (last), samples.end ());
+
+	for (long minute = first; minute <= last; minute++)
+	{
+		if (samples.find (minute) != samples.end ())
+			continue;
+		double mjd = minute / 1440.0;
+		positionSample ps;
+		target->getPosition (&ps.pos, mjd);
+		target->getAltAz (&ps.hrz, mjd, observer);
+		ps.ha = target->getHourAngle (mjd, observer);
+		ps.visible = target->isAboveHorizon (&ps.hrz) ? 1 : 0;
+		rts2db::ConstraintsList violated;
+		if (constraints->getViolated (target, mjd, violated) == 0)
+			ps.visible |= 2;
+		samples[minute] = ps;
+	}
+}
+
+void SimulTarget::getPosition (struct ln_equ_posn *pos, double JD)
+{
+	positionSample *ps = getSample (JD);
+	if (ps == NULL)
+	{
+		pos->ra = pos->dec = NAN;
+		return;
+	}
+	pos->ra = ps->pos.ra;
+	pos->dec = ps->pos.dec;
+}
+
+void SimulTarget::getAltAz (struct ln_hrz_posn *hrz, double JD)
+{
+	positionSample *ps = getSample (JD);
+	if (ps == NULL)
+	{
+		hrz->alt = hrz->az = NAN;
+		return;
+	}
+	hrz->alt = ps->hrz.alt;
+	hrz->az = ps->hrz.az;
+}
+
+double SimulTarget::getHourAngle (double JD)
+{
+	positionSample *ps = getSample (JD);
+	return ps == NULL ? NAN : ps->ha;
+}
+
+double SimulTarget::getMaximalDuration (struct ln_equ_posn *currentp, int runnum)
+{
+	if (durationsValid == false)
+		return NAN;
+
+	double slew = 0;
+	if (currentp != NULL && !isnan (currentp->ra) && !isnan (currentp->dec) && !isnan (startPosition.ra) && !isnan (startPosition.dec))
+		slew = ln_get_angular_separation (currentp, &startPosition);
+
+	double md = 0;
+	for (std::vector <scriptDuration>::iterator iter = durations.begin (); iter != durations.end (); iter++)
+	{
+		double d = (runnum == 0 ? iter->first : iter->next);
+		if (slew > 0)
+			d += iter->settleTime + slew * iter->speed;
+		if (d > md)
+			md = d;
+	}
+	return md;
+}
+
+bool SimulTarget::isAboveHorizon (double JD, bool testConstraints)
+{
+	positionSample *ps = getSample (JD);
+	if (ps == NULL || !(ps->visible & 1))
+		return false;
+	return !testConstraints || ((ps->visible & 2) && repeatsViolated == false);
+}
+
+double SimulTarget::getSatisfiedDuration (double from, double to, double length, double step)
+{
+	if (repeatsViolated)
+		return NAN;
+	// the same as rts2db::Constraints::getSatisfiedDuration, evaluated on samples
+	time_t fti = (time_t) to;
+	double to_JD = ln_get_julian_from_timet (&fti);
+	fti = (time_t) (from + length);
+	double from_JD = ln_get_julian_from_timet (&fti);
+	for (double t = from_JD; t < to_JD; t += step / 86400.0)
+	{
+		positionSample *ps = getSample (t);
+		// simulation does not continue past the simulated interval
+		if (ps == NULL)
+			break;
+		if (!(ps->visible & 2))
+		{
+			if (t == from_JD)
+				return NAN;
+			time_t ret;
+			ln_get_timet_from_julian (t, &ret);
+			return ret;
+		}
+	}
+	return INFINITY;
+}
+
+SimulTarget::positionSample *SimulTarget::getSample (double JD)
+{
+	std::map <long, positionSample>::iterator iter = samples.find ((long) floor (JD * 1440.0 + 0.5));
+	if (iter == samples.end ())
+		return NULL;
+	return &(iter->second);
+}
+
+SimulQueueTargets::SimulQueueTargets (ExecutorQueue &eq, SimulTargets &_targets):TargetQueue (eq.master, eq.observer, eq.obs_altitude)
+{
+	targets = &_targets;
+
   	queueType = eq.getQueueType ();
 	removeAfterExecution = eq.getRemoveAfterExecution ();
 	skipBelowHorizon = eq.getSkipBelowHorizon ();
 	testConstraints = eq.getTestConstraints ();
 	blockUntilVisible = eq.getBlockUntilVisible ();
 	checkTargetLength = eq.getCheckTargetLength ();
+	queueEnabled = eq.queueEnabled->getValueBool ();
 
 	for (ExecutorQueue::iterator qi = eq.begin (); qi != eq.end (); qi++)
-		push_back ( QueuedTarget (*qi, createTarget (qi->target->getTargetID(), *observer, obs_altitude) ) );
+	{
+		QueuedTarget qt (*qi, (*targets)[qi->target->getTargetID ()]->getTarget ());
+		// entry is not in database, so removing it will not touch the real queue
+		qt.queue_id = -1;
+		push_back (qt);
+	}
 }
 
 SimulQueueTargets::~SimulQueueTargets ()
@@ -40,78 +230,283 @@ SimulQueueTargets::~SimulQueueTargets ()
 
 void SimulQueueTargets::clearNext ()
 {
-	for (SimulQueueTargets::iterator iter = begin (); iter != end (); iter = erase (iter))
-		delete iter->target;
+	// targets are owned by snapshots
+	clear ();
 }
 
+int SimulQueueTargets::selectNext (double from, double to, double &e_end, struct ln_equ_posn *currentp, struct ln_equ_posn *nextp)
+{
+	if (queueEnabled == false)
+		return -1;
+	if (size () > 0)
+	{
+		time_t tn = from;
+		double JD = ln_get_julian_from_timet (&tn);
+		getSimulTarget (front ().target)->getPosition (nextp, JD);
+		double md = getMaximalDuration (front ().target, currentp);
+		if (isAboveHorizon (front (), JD) && front ().notExpired (from) && from + md < to)
+		{
+		  	// single execution?
+			if (removeAfterExecution)
+			{
+				e_end = from + md;
+			}
+			// otherwise, put end to either time_end, 
+			else
+			{
+				if (!isnan (front ().t_end))
+				{
+				  	e_end = front ().t_end;
+				}
+				// or to time when target will become unacessible
+				else
+				{
+					e_end = getSatisfiedDuration (front ().target, from, to, md, 60);
+					if (isnan (e_end))
+						e_end = to;
+				}
+			}
+			return front ().target->getTargetID ();
+		}
+		// if target is not visible, put its start time as cutoff to possible next queue simulation
+		e_end = front ().t_start;
+	}
+	return -1;
+}
+
+double SimulQueueTargets::getMaximalDuration (rts2db::Target *tar, struct ln_equ_posn *currentp, int runnum)
+{
+	return getSimulTarget (tar)->getMaximalDuration (currentp, runnum);
+}
+
+double SimulQueueTargets::getSatisfiedDuration (rts2db::Target *tar, double from, double to, double length, double step)
+{
+	return getSimulTarget (tar)->getSatisfiedDuration (from, to, length, step);
+}
+
+void SimulQueueTargets::getAltAz (rts2db::Target *tar, struct ln_hrz_posn *hrz, double JD)
+{
+	getSimulTarget (tar)->getAltAz (hrz, JD);
+}
+
+double SimulQueueTargets::getHourAngle (rts2db::Target *tar, double JD)
+{
+	return getSimulTarget (tar)->getHourAngle (JD);
+}
+
+bool SimulQueueTargets::isAboveHorizon (rts2db::Target *tar, double JD)
+{
+	return getSimulTarget (tar)->isAboveHorizon (JD, false);
+}
 
 TargetQueue::iterator SimulQueueTargets::removeEntry (TargetQueue::iterator &iter, const removed_t reason)
 {
-	delete iter->target;
 	return erase (iter);
 }
 
-SimulQueue::SimulQueue (rts2db::DeviceDb *_master, const char *name, struct ln_lnlat_posn **_observer, Queues *_queues):ExecutorQueue (_master, name, _observer, -1, true)
+bool SimulQueueTargets::isAboveHorizon (QueuedTarget &qt, double &JD)
+{
+	if (!isnan (qt.t_start))
+	{
+		time_t t = qt.t_start;
+		double njd = ln_get_julian_from_timet (&t);
+		// only change time to calculate conditions when start time is in future
+		if (njd > JD)
+			JD = njd;
+	}
+	return getSimulTarget (qt.target)->isAboveHorizon (JD, testConstraints);
+}
+
+void SimulQueueTargets::requeueFront ()
+{
+	push_back (QueuedTarget (front (), front ().target));
+	pop_front ();
+}
+
+SimulTarget *SimulQueueTargets::getSimulTarget (rts2db::Target *tar)
+{
+	return (*targets)[tar->getTargetID ()];
+}
+
+SimulQueue::SimulQueue (rts2db::DeviceDb *_master, const char *name, struct ln_lnlat_posn **_observer, double _altitude, Queues *_queues):ExecutorQueue (_master, name, _observer, _altitude, -1, true)
 {
 	queues = _queues;
+
+	from = to = t = NAN;
+
+	running = false;
+	finished = false;
+	cancelled = false;
+	pthread_mutex_init (&stepsMutex, NULL);
 }
 
 SimulQueue::~SimulQueue ()
 {
-
+	cancel ();
+	for (SimulTargets::iterator iter = simulTargets.begin (); iter != simulTargets.end (); iter++)
+		delete iter->second;
+	pthread_mutex_destroy (&stepsMutex);
 }
 
 void SimulQueue::start (double _from, double _to)
 {
+	cancel ();
+
   	from = _from;
-	fr = from;
 	to = _to;
 	t = from;
 
 	sqs.clear ();
+	clearNext ();
+	steps.clear ();
+
+	// refresh snapshots of queued targets, drop snapshots of targets no longer queued
+	SimulTargets old;
+	old.swap (simulTargets);
+	for (Queues::iterator qi = queues->begin (); qi != queues->end (); qi++)
+	{
+		for (ExecutorQueue::iterator ei = qi->begin (); ei != qi->end (); ei++)
+		{
+			int tar_id = ei->target->getTargetID ();
+			if (simulTargets.find (tar_id) != simulTargets.end ())
+				continue;
+			SimulTargets::iterator oi = old.find (tar_id);
+			if (oi != old.end ())
+			{
+				simulTargets[tar_id] = oi->second;
+				old.erase (oi);
+			}
+			else
+			{
+				simulTargets[tar_id] = new SimulTarget (createTarget (tar_id, *observer, obs_altitude));
+			}
+			simulTargets[tar_id]->refresh (master->cameras, *observer, from, to);
+		}
+	}
+	for (SimulTargets::iterator iter = old.begin (); iter != old.end (); iter++)
+		delete iter->second;
 
 	// fill in simulation queues
 	for (Queues::iterator qi = queues->begin (); qi != queues->end (); qi++)
-		sqs.push_back (SimulQueueTargets (*qi));
+		sqs.push_back (SimulQueueTargets (*qi, simulTargets));
 
-	clear ();
+	updateVals ();
+
+	finished = false;
+	cancelled = false;
+	if (pthread_create (&simulThread, NULL, SimulQueue::runSimulation, this))
+	{
+		logStream (MESSAGE_ERROR) << "cannot start simulation thread: " << strerror (errno) << sendLog;
+		finished = true;
+		return;
+	}
+	running = true;
+}
+
+void SimulQueue::cancel ()
+{
+	if (running == false)
+		return;
+	pthread_mutex_lock (&stepsMutex);
+	cancelled = true;
+	pthread_mutex_unlock (&stepsMutex);
+	pthread_join (simulThread, NULL);
+	running = false;
 }
 
 double SimulQueue::step ()
+{
+	pthread_mutex_lock (&stepsMutex);
+	if (steps.empty ())
+	{
+		bool done = finished;
+		pthread_mutex_unlock (&stepsMutex);
+		if (done == false)
+			return NAN;
+		if (running)
+		{
+			pthread_join (simulThread, NULL);
+			running = false;
+		}
+		return 2;
+	}
+	simulStep st = steps.front ();
+	steps.pop_front ();
+	pthread_mutex_unlock (&stepsMutex);
+
+	t = st.t;
+	if (st.tar_id > 0)
+	{
+		// queue owns its targets, snapshot targets are used by the simulation thread
+		try
+		{
+			rts2db::Target *tar = createTarget (st.tar_id, *observer, obs_altitude);
+			addTarget (tar, st.t_start, st.t_end, -1, -1, false, false);
+			logStream (MESSAGE_DEBUG) << "adding to simulation:" << tar->getTargetID () << " " << tar->getTargetName () << " from " << LibnovaDateDouble (st.t_start) << " to " << LibnovaDateDouble (st.t_end) << sendLog;
+		}
+		catch (rts2core::Error &er)
+		{
+			logStream (MESSAGE_ERROR) << "cannot add target " << st.tar_id << " to simulation: " << er << sendLog;
+		}
+	}
+	return st.progress;
+}
+
+void *SimulQueue::runSimulation (void *arg)
+{
+	((SimulQueue *) arg)->run ();
+	return NULL;
+}
+
+void SimulQueue::run ()
 {
 	std::vector <SimulQueueTargets>::iterator sq;
 
-	double e_end = NAN;
+	double st = from;
+	double fr = from;
+
+	struct ln_equ_posn currentp;
+	currentp.ra = currentp.dec = NAN;
 
-	if (t < to)
+	while (st < to)
 	{
+		pthread_mutex_lock (&stepsMutex);
+		bool c = cancelled;
+		pthread_mutex_unlock (&stepsMutex);
+		if (c)
+			break;
+
+		double e_end = NAN;
+		simulStep ss;
+		ss.tar_id = -1;
+
 	  	sq = sqs.begin ();
 		bool found = false;
 		double t_to = to;
-		for (Queues::iterator qi = queues->begin (); qi != queues->end (); qi++)
+		for (; sq != sqs.end (); sq++)
 		{
-			sq->filter (t);
+			sq->filter (st);
 			struct ln_equ_posn nextp;
-			int n_id = qi->selectNextSimulation (*sq, t, t_to, e_end, &currentp, &nextp);
+			int n_id = sq->selectNext (st, t_to, e_end, &currentp, &nextp);
 			// remove target from simulation..
 			if (n_id > 0)
 			{
 				// check if there is target in upper queues..
 				for (std::vector <SimulQueueTargets>::iterator sq2 = sqs.begin (); sq2 != sq; sq2++)
 				{
-					if (!(sq2->empty ()) && !isnan (sq2->front ().t_start) && sq2->front ().t_start < e_end && sq2->front ().t_start > t)
+					if (!(sq2->empty ()) && !isnan (sq2->front ().t_start) && sq2->front ().t_start < e_end && sq2->front ().t_start > st)
 					{
 						e_end = sq2->front ().t_start;
 						break;		
 					}
 						
 				}
-				t = e_end;
-				rts2db::Target *tar = createTarget (n_id, *observer, obs_altitude);
-				addTarget (tar, fr, t, -1, -1, false, false);
-				logStream (MESSAGE_DEBUG) << "adding to simulation:" << n_id << " " << tar->getTargetName () << " from " << LibnovaDateDouble (fr) << " to " << LibnovaDateDouble (t) << sendLog;
-				sq->front ().target->startObservation ();
-				sq->beforeChange (t);
+				st = e_end;
+				ss.tar_id = n_id;
+				ss.t_start = fr;
+				ss.t_end = st;
+				sq->startFront ();
+				sq->beforeChange (st);
 				found = true;
 				currentp.ra = nextp.ra;
 				currentp.dec = nextp.dec;
@@ -120,24 +515,29 @@ double SimulQueue::step ()
 			// e_end holds possible start of next target..
 			if (!isnan (e_end) && e_end < to)
 				t_to = e_end;
-			sq++;
 		}
-		if (found && !isnan (e_end) && e_end > t)
-			t = e_end;
+		if (found && !isnan (e_end) && e_end > st)
+			st = e_end;
 		else
-			t += 60;
+			st += 60;
 
-		fr = t;
+		fr = st;
+
+		ss.t = st;
 		if (found)
-			return (t - from) / (to - from);
+			ss.progress = (st - from) / (to - from);
 		else
-			return (from - t) / (to - from);
+			ss.progress = (from - st) / (to - from);
+
+		pthread_mutex_lock (&stepsMutex);
+		steps.push_back (ss);
+		pthread_mutex_unlock (&stepsMutex);
 	}
 
 	for (sq = sqs.begin (); sq != sqs.end (); sq++)
 		sq->clearNext ();
 
-	updateVals ();
-
-	return 2;
+	pthread_mutex_lock (&stepsMutex);
+	finished = true;
+	pthread_mutex_unlock (&stepsMutex);
 }
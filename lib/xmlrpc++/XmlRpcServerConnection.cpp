@@ -67,6 +67,7 @@ XmlRpcServerConnection::XmlRpcServerConnection(int fd, XmlRpcServer* server, boo
 
 	_get_response_length = 0;
 	_get_response = NULL;
+	_notModified = false;
 
 	memcpy (&_saddr, saddr, addrlen);
 	_addrlen = addrlen;
@@ -134,6 +135,8 @@ bool XmlRpcServerConnection::readHeader()
 	char *lp = 0;				 // Start of content-length value
 	char *kp = 0;				 // Start of connection value
 	char *ap = 0;				 // Start of authorization header
+	char *np = 0;				 // Start of if-none-match header
+	char *zp = 0;				 // Start of accept-encoding header
 
 	for (char *cp = hp; (bp == 0) && (cp < ep); ++cp)
 	{
@@ -147,6 +150,10 @@ bool XmlRpcServerConnection::readHeader()
 			kp = cp + 12;
 		else if ((ep - cp > 12) && (strncasecmp (cp, "Authorization: ", 15) == 0))
 			ap = cp + 15;
+		else if ((ep - cp > 15) && (strncasecmp (cp, "If-None-Match: ", 15) == 0))
+			np = cp + 15;
+		else if ((ep - cp > 17) && (strncasecmp (cp, "Accept-Encoding: ", 17) == 0))
+			zp = cp + 17;
 		else if ((ep - cp >= 4) && (strncmp(cp, "\r\n\r\n", 4) == 0))
 			bp = cp + 4;
 		else if ((ep - cp >= 2) && (strncmp(cp, "\n\n", 2) == 0))
@@ -192,6 +199,12 @@ bool XmlRpcServerConnection::readHeader()
 		}
 	}
 
+	// conditional GET and compression headers
+	if (np != 0)
+		_if_none_match = headerValue (np, ep);
+	if (zp != 0)
+		_accept_encoding = headerValue (zp, ep);
+
 	// Parse out any interesting bits from the header (HTTP version, connection)
 	_keepAlive = true;
 	if (_header.find("HTTP/1.0") != std::string::npos)
@@ -314,13 +327,13 @@ bool XmlRpcServerConnection::readRequest()
 
 bool XmlRpcServerConnection::handleGet()
 {
-	if (_get_response_header.length () == 0 || _get_response_length == 0)
+	if (_get_response_header.length () == 0 || (_get_response_length == 0 && _notModified == false))
 	{
 		executeGet();
 		_getHeaderWritten = 0;
 		_getWritten = 0;
 		_bytesWritten = 0;
-		if (_get_response_header.length () == 0 || _get_response_length == 0)
+		if (_get_response_header.length () == 0 || (_get_response_length == 0 && _notModified == false))
 		{
 			XmlRpcUtil::error("XmlRpcServerConnection::handleGet: empty response.");
 			return false;
@@ -549,6 +562,10 @@ void XmlRpcServerConnection::executeGet()
 		case HTTP_OK:
 			http_code_string = "OK";
 			break;
+		case HTTP_NOT_MODIFIED:
+			http_code_string = "Not Modified";
+			_notModified = true;
+			break;
 		case HTTP_UNAUTHORIZED:
 			http_code_string = "Authorization Required";
 			addExtraHeader ("WWW-Authenticate", "Basic realm=\"Your RTS2 login\"");
@@ -750,6 +767,55 @@ void XmlRpcServerConnection::asyncFinished ()
 		close ();
 }
 
+bool XmlRpcServerConnection::matchETag (const std::string &etag)
+{
+	if (_if_none_match.length () == 0)
+		return false;
+	if (_if_none_match == "*")
+		return true;
+	// If-None-Match can contain comma separated list of etags
+	std::string::size_type s = 0;
+	while (s < _if_none_match.length ())
+	{
+		std::string::size_type e = _if_none_match.find (',', s);
+		if (e == std::string::npos)
+			e = _if_none_match.length ();
+		std::string::size_type b = s;
+		while (b < e && isspace (_if_none_match[b]))
+			b++;
+		std::string::size_type l = e;
+		while (l > b && isspace (_if_none_match[l - 1]))
+			l--;
+		if (_if_none_match.compare (b, l - b, etag) == 0)
+			return true;
+		s = e + 1;
+	}
+	return false;
+}
+
+bool XmlRpcServerConnection::acceptGzip ()
+{
+	std::string::size_type g = _accept_encoding.find ("gzip");
+	if (g == std::string::npos)
+		return false;
+	// gzip;q=0 explicitly refuses gzip
+	std::string::size_type q = _accept_encoding.find ("q=", g);
+	std::string::size_type c = _accept_encoding.find (',', g);
+	if (q != std::string::npos && (c == std::string::npos || q < c))
+		return atof (_accept_encoding.c_str () + q + 2) > 0;
+	return true;
+}
+
+std::string XmlRpcServerConnection::headerValue (const char *vp, const char *ep)
+{
+	while (vp < ep && (*vp == ' ' || *vp == '\t'))
+		vp++;
+	const char *ve = vp;
+	while (ve < ep && *ve != '\r' && *ve != '\n')
+		ve++;
+	return std::string (vp, ve - vp);
+}
+
 std::string XmlRpcServerConnection::getHttpDate ()
 {
 	std::ostringstream ret;
@@ -787,6 +853,9 @@ void XmlRpcServerConnection::prepareForNext ()
 	_get_response_length = 0;
 	delete[] _get_response;
 	_get_response = NULL;
+	_notModified = false;
+	_if_none_match = "";
+	_accept_encoding = "";
 	_response = "";
 	_connectionState = READ_HEADER;
 }
@@ -798,8 +867,13 @@ std::string XmlRpc::printHeaders (int http_code, const char *http_code_string, c
 
 	_os << "HTTP/1.1 " << http_code << " " << http_code_string
 		<< "\r\nDate: " << XmlRpcServerConnection::getHttpDate ()
-		<< "\r\nServer: " << XMLRPC_VERSION 
-		<< "\r\nContent-Type: " << response_type << "\r\n";
+		<< "\r\nServer: " << XMLRPC_VERSION;
+
+	// 304 responses does not carry any body
+	if (http_code == HTTP_NOT_MODIFIED)
+		return _os.str ();
+
+	_os << "\r\nContent-Type: " << response_type << "\r\n";
 	if (response_length > 0)
 		_os << "Content-length: " << response_length;
 	else
@@ -20,7 +20,9 @@
 #include "bb.h"
 #include "rts2json/directory.h"
 
-#define OPT_WWW_DIR    OPT_LOCAL + 1
+#define OPT_WWW_DIR          OPT_LOCAL + 1
+#define OPT_REQUEST_TIMEOUT  OPT_LOCAL + 2
+#define OPT_TASK_THREADS     OPT_LOCAL + 3
 
 using namespace XmlRpc;
 using namespace rts2bb;
@@ -45,6 +47,10 @@ BB::BB (int argc, char ** argv):
 	rpcPort = 8889;
 
 	createValue (queueSize, "queue_size", "task queue size", false);
+	createValue (requestTimeout, "request_timeout", "[s] timeout of requests to observatories", false);
+	requestTimeout->setValueInteger (ObservatorySessions::instance ()->getTimeout ());
+	createValue (taskThreads, "task_threads", "number of threads processing tasks", false);
+	taskThreads->setValueInteger (task_queue.getNumberOfThreads ());
 
 	createValue (debugConn, "debug_conn", "debug connections calls", false, RTS2_VALUE_WRITABLE | RTS2_DT_ONOFF);
 	debugConn->setValueBool (false);
@@ -55,6 +61,8 @@ BB::BB (int argc, char ** argv):
 
 	addOption ('p', NULL, 1, "RPC listening port");
 	addOption (OPT_WWW_DIR, "www-directory", 1, "default directory for BB requests");
+	addOption (OPT_REQUEST_TIMEOUT, "request-timeout", 1, "timeout (in seconds) of requests to observatories; default to 30");
+	addOption (OPT_TASK_THREADS, "task-threads", 1, "number of threads contacting observatories; default to 4");
 }
 
 void BB::postEvent (rts2core::Event *event)
@@ -86,6 +94,19 @@ int BB::processOption (int opt)
 		case OPT_WWW_DIR:
 			XmlRpcServer::setDefaultGetRequest (new rts2json::Directory (NULL, this, optarg, "index.html", NULL));
 			break;
+		case OPT_REQUEST_TIMEOUT:
+			ObservatorySessions::instance ()->setTimeout (atoi (optarg));
+			requestTimeout->setValueInteger (ObservatorySessions::instance ()->getTimeout ());
+			break;
+		case OPT_TASK_THREADS:
+			if (atoi (optarg) <= 0)
+			{
+				std::cerr << "number of task threads must be positive" << std::endl;
+				return -1;
+			}
+			task_queue.setNumberOfThreads (atoi (optarg));
+			taskThreads->setValueInteger (task_queue.getNumberOfThreads ());
+			break;
 		default:
 			return rts2db::DeviceDb::processOption (opt);
 	}
@@ -121,6 +142,16 @@ int BB::info ()
 
 int BB::idle ()
 {
+	// schedules processed by task threads
+	ObservatorySchedule *obs_sched;
+	while ((obs_sched = task_queue.popDone ()) != NULL)
+	{
+		postEvent (new rts2core::Event (EVENT_SCHEDULING_DONE, (void *) obs_sched));
+		delete obs_sched;
+	}
+	// check often while observatories are contacted
+	setTimeout (task_queue.getOutstanding () > 0 ? USEC_SEC / 10 : USEC_SEC * 10);
+
 	HTTPServer::asyncIdle ();
 	return rts2db::DeviceDb::idle ();
 }
@@ -141,6 +172,15 @@ void BB::processSchedule (ObservatorySchedule *obs_sched)
 {
 	try
 	{
+		int quorum = task_queue.getScheduleQuorum (obs_sched->getScheduleId ());
+		if (quorum < 0)
+		{
+			// already confirmed, keep late observatory as backup
+			if (obs_sched->getState () == BB_SCHEDULE_OBSERVABLE)
+				obs_sched->updateState (BB_SCHEDULE_BACKUP, obs_sched->getFrom (), obs_sched->getTo ());
+			return;
+		}
+
 		BBSchedules all (obs_sched->getScheduleId ());
 		all.load ();
 
@@ -148,6 +188,8 @@ void BB::processSchedule (ObservatorySchedule *obs_sched)
 
 		double min_time = NAN;
 		int min_observatory = -1;
+		int observable = 0;
+		int pending = 0;
 
 		for (iter = all.begin (); iter != all.end (); iter++)
 		{
@@ -157,6 +199,7 @@ void BB::processSchedule (ObservatorySchedule *obs_sched)
 			}
 			else if (iter->getState () == BB_SCHEDULE_OBSERVABLE)
 			{
+				observable++;
 				if (!isnan (iter->getFrom ()) && (isnan (min_time) || iter->getFrom () < min_time))
 				{
 					min_time = iter->getFrom ();
@@ -165,20 +208,21 @@ void BB::processSchedule (ObservatorySchedule *obs_sched)
 			}
 			else if (iter->getState () == BB_SCHEDULE_CREATED)
 			{
-				break;
+				pending++;
 			}
 			else
 			{
 				logStream (MESSAGE_WARNING) << "wrong state of schedule entry with id " << iter->getScheduleId () << " for observatory " << iter->getObservatoryId () << sendLog;
-				break;
+				return;
 			}
 		}
 
-		if (iter != all.end ())
-		{
-			// some requests weren't processed
+		// some requests weren't processed, and not enough observatories responded
+		if (pending > 0 && (quorum == 0 || observable < quorum))
+			return;
+
+		if (!task_queue.claimSchedule (obs_sched->getScheduleId ()))
 			return;
-		}
 
 		// inform selected observatory..
 		task_queue.queueTask (new BBConfirmTask (obs_sched->getScheduleId (), min_observatory));
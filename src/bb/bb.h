@@ -111,6 +111,8 @@ class BB:public rts2db::DeviceDb, XmlRpc::XmlRpcServer, rts2json::HTTPServer
 
 		rts2core::ValueBool *debugConn;
 		rts2core::ValueInteger *queueSize;
+		rts2core::ValueInteger *requestTimeout;
+		rts2core::ValueInteger *taskThreads;
 
 		BBTasks task_queue;
 
@@ -113,17 +113,23 @@ void BBAPI::executeJSON (XmlRpc::XmlRpcSource *source, std::string path, XmlRpc:
 			if (tar_id < 0)
 				throw XmlRpc::JSONException ("unknown target ID");
 
+			// confirm once that many observatories can observe; 0 waits for all observatories
+			int responses = params->getInteger ("responses", 0);
+			if (responses < 0)
+				throw XmlRpc::JSONException ("invalid number of responses");
+
 			Observatories obs;
 			obs.load ();
 
 			int schedule_id = createSchedule (tar_id);
+			queue->setScheduleQuorum (schedule_id, responses);
 
 			for (Observatories::iterator iter = obs.begin (); iter != obs.end (); iter++)
 			{
 				ObservatorySchedule *oss = new ObservatorySchedule (schedule_id, iter->getId ());
 				oss->updateState (BB_SCHEDULE_CREATED);
-				// queue targets into scheduling thread
-				queue->queueTask (new BBTaskSchedule (oss, tar_id, iter->getId ()));
+				// queue targets into scheduling threads, observatories are contacted in parallel
+				queue->queueTask (new BBTaskSchedule (queue, oss, tar_id));
 			}
 			os << "\"target_id\":" << tar_id << ",\"schedule_id\":" << schedule_id;
 		}
@@ -22,7 +22,13 @@
 #include "bbtasks.h"
 #include "app.h"
 
+#include "configuration.h"
 #include "rts2db/sqlerror.h"
+#include "rts2db/target.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <unistd.h>
 
 using namespace rts2bb;
 
@@ -33,31 +39,101 @@ static void auth (SoupSession *session, SoupMessage *msg, SoupAuth *_auth, gbool
 	((Observatory *) data)->auth (_auth);
 }
 
-JsonParser *BBTask::jsonRequest (int observatory_id, std::string path)
+ObservatorySessions *ObservatorySessions::pInstance = NULL;
+
+ObservatorySessions::ObservatorySessions ()
 {
-	Observatory obs (observatory_id);
-	obs.load ();
+	pthread_mutex_init (&sessions_mutex, NULL);
+	timeout = 30;
+}
 
-	std::ostringstream request;
-	request << obs.getURL () << path;
+ObservatorySessions::~ObservatorySessions ()
+{
+	for (std::map <int, ObservatorySession>::iterator iter = sessions.begin (); iter != sessions.end (); iter++)
+	{
+		g_object_unref (iter->second.session);
+		delete iter->second.observatory;
+	}
+	sessions.clear ();
+	pthread_mutex_destroy (&sessions_mutex);
+}
 
-	g_type_init ();
+ObservatorySessions *ObservatorySessions::instance ()
+{
+	if (pInstance == NULL)
+		pInstance = new ObservatorySessions ();
+	return pInstance;
+}
 
-	SoupMessage *msg = soup_message_new (SOUP_METHOD_GET, request.str ().c_str ());
+ObservatorySessions::ObservatorySession *ObservatorySessions::getSession (int observatory_id)
+{
+	pthread_mutex_lock (&sessions_mutex);
+
+	std::map <int, ObservatorySession>::iterator iter = sessions.find (observatory_id);
+	if (iter != sessions.end ())
+	{
+		pthread_mutex_unlock (&sessions_mutex);
+		return &(iter->second);
+	}
+
+	ObservatorySession os;
+	os.observatory = new Observatory (observatory_id);
+	try
+	{
+		os.observatory->load ();
+	}
+	catch (rts2db::SqlError &er)
+	{
+		pthread_mutex_unlock (&sessions_mutex);
+		delete os.observatory;
+		logStream (MESSAGE_ERROR) << "cannot load observatory " << observatory_id << ": " << er << sendLog;
+		return NULL;
+	}
+
+	std::ostringstream key;
+	key << "observatory_" << observatory_id << "_url";
+	os.url = rts2core::Configuration::instance ()->getStringDefault ("bb", key.str ().c_str (), os.observatory->getURL ());
 
-	SoupSession *session = soup_session_sync_new_with_options (
+	g_type_init ();
+
+	// sync session can be used from multiple threads
+	os.session = soup_session_sync_new_with_options (
 		SOUP_SESSION_ADD_FEATURE_BY_TYPE, SOUP_TYPE_CONTENT_DECODER,
 		SOUP_SESSION_ADD_FEATURE_BY_TYPE, SOUP_TYPE_COOKIE_JAR,
 		SOUP_SESSION_USER_AGENT, "rts2 bb",
+		SOUP_SESSION_TIMEOUT, timeout,
 		NULL);
 
-	g_signal_connect (session, "authenticate", G_CALLBACK (auth), &obs);
+	g_signal_connect (os.session, "authenticate", G_CALLBACK (auth), os.observatory);
 
-	soup_session_send_message (session, msg);
+	ObservatorySession *ret = &(sessions[observatory_id] = os);
+
+	pthread_mutex_unlock (&sessions_mutex);
+	return ret;
+}
+
+JsonParser *ObservatorySessions::jsonRequest (int observatory_id, std::string path)
+{
+	ObservatorySession *os = getSession (observatory_id);
+	if (os == NULL)
+		return NULL;
+
+	std::ostringstream request;
+	request << os->url << path;
+
+	SoupMessage *msg = soup_message_new (SOUP_METHOD_GET, request.str ().c_str ());
+	if (msg == NULL)
+	{
+		logStream (MESSAGE_ERROR) << "invalid request URL " << request.str () << sendLog;
+		return NULL;
+	}
+
+	soup_session_send_message (os->session, msg);
 
 	if (!SOUP_STATUS_IS_SUCCESSFUL (msg->status_code))
 	{
-		logStream (MESSAGE_ERROR) << "error calling " << path << ": " << msg->status_code << " : " << msg->reason_phrase << sendLog;
+		logStream (MESSAGE_ERROR) << "error calling " << request.str () << ": " << msg->status_code << " : " << msg->reason_phrase << sendLog;
+		g_object_unref (msg);
 		return NULL;
 	}
 
@@ -65,18 +141,17 @@ JsonParser *BBTask::jsonRequest (int observatory_id, std::string path)
 
 	GError *error = NULL;
 
-	json_parser_load_from_data (result, msg->response_body->data, strlen (msg->response_body->data), &error);
+	json_parser_load_from_data (result, msg->response_body->data, msg->response_body->length, &error);
 	if (error)
 	{
-		logStream (MESSAGE_ERROR) << "unable to parse " << path << sendLog;
+		logStream (MESSAGE_ERROR) << "unable to parse " << request.str () << ": " << error->message << sendLog;
 		g_error_free (error);
+		g_object_unref (result);
 		g_object_unref (msg);
-		g_object_unref (session);
 		return NULL;
 	}
 
 	g_object_unref (msg);
-	g_object_unref (session);
 
 	return result;
 }
@@ -86,12 +161,110 @@ int BBTaskSchedule::run ()
 	switch (obs_sched->getState ())
 	{
 		case BB_SCHEDULE_CREATED:
-			sched_process = scheduleTarget (tar_id, obs_sched->getObservatoryId (), obs_sched);
-			return 0;
+			try
+			{
+				int obs_tar_id;
+				try
+				{
+					obs_tar_id = findObservatoryMapping (obs_sched->getObservatoryId (), tar_id);
+				}
+				catch (rts2db::SqlError &er)
+				{
+					obs_tar_id = createObservatoryTarget ();
+				}
+				if (obs_tar_id >= 0)
+					askSchedule (obs_tar_id);
+				if (obs_sched->getState () == BB_SCHEDULE_CREATED)
+					obs_sched->updateState (BB_SCHEDULE_FAILED);
+			}
+			catch (rts2core::Error &er)
+			{
+				logStream (MESSAGE_ERROR) << "while scheduling target " << tar_id << " on observatory " << obs_sched->getObservatoryId () << " occured error " << er << sendLog;
+				// observatory must be counted as responded, otherwise the schedule waits for it forever
+				if (obs_sched->getState () == BB_SCHEDULE_CREATED)
+				{
+					try
+					{
+						obs_sched->updateState (BB_SCHEDULE_FAILED);
+					}
+					catch (rts2core::Error &er2)
+					{
+						logStream (MESSAGE_ERROR) << "cannot mark schedule " << obs_sched->getScheduleId () << " on observatory " << obs_sched->getObservatoryId () << " as failed: " << er2 << sendLog;
+					}
+				}
+			}
+			break;
 		default:
 			logStream (MESSAGE_WARNING) << "unknow BBTaskSchedule state: " << obs_sched->getState () << sendLog;
-			return 0;
+			break;
 	}
+	// BB main thread decides which observatory will observe
+	tasks->scheduleDone (obs_sched);
+	return 0;
+}
+
+int BBTaskSchedule::createObservatoryTarget ()
+{
+	rts2db::Target *tar = createTarget (tar_id, rts2core::Configuration::instance ()->getObserver (), rts2core::Configuration::instance ()->getObservatoryAltitude ());
+	if (tar == NULL)
+	{
+		logStream (MESSAGE_ERROR) << "cannot find target with ID " << tar_id << sendLog;
+		return -1;
+	}
+
+	struct ln_equ_posn pos;
+	tar->getPosition (&pos);
+
+	gchar *tn = g_uri_escape_string (tar->getTargetName (), NULL, FALSE);
+
+	std::ostringstream url;
+	url.precision (10);
+	url << "/api/create_target?tn=" << tn << "&ra=" << pos.ra << "&dec=" << pos.dec;
+
+	g_free (tn);
+	delete tar;
+
+	JsonParser *ret = jsonRequest (obs_sched->getObservatoryId (), url.str ());
+	if (ret == NULL)
+		return -1;
+
+	int obs_tar_id = -1;
+	JsonObject *root = json_node_get_object (json_parser_get_root (ret));
+	if (root && json_object_has_member (root, "id"))
+		obs_tar_id = json_object_get_int_member (root, "id");
+	g_object_unref (ret);
+
+	if (obs_tar_id < 0)
+	{
+		logStream (MESSAGE_ERROR) << "observatory " << obs_sched->getObservatoryId () << " did not create target " << tar_id << sendLog;
+		return -1;
+	}
+
+	createMapping (obs_sched->getObservatoryId (), tar_id, obs_tar_id);
+	return obs_tar_id;
+}
+
+void BBTaskSchedule::askSchedule (int obs_tar_id)
+{
+	std::ostringstream url;
+	url << "/bbapi/schedule?id=" << obs_tar_id;
+
+	JsonParser *ret = jsonRequest (obs_sched->getObservatoryId (), url.str ());
+	if (ret == NULL)
+		return;
+
+	JsonObject *root = json_node_get_object (json_parser_get_root (ret));
+	if (root && json_object_has_member (root, "ret") && json_object_get_int_member (root, "ret") == 0 && json_object_has_member (root, "from"))
+	{
+		obs_sched->updateState (BB_SCHEDULE_OBSERVABLE, json_object_get_double_member (root, "from"), NAN);
+	}
+	else
+	{
+		logStream (MESSAGE_INFO) << "observatory " << obs_sched->getObservatoryId () << " cannot schedule target " << tar_id << sendLog;
+		obs_sched->updateState (BB_SCHEDULE_FAILED);
+	}
+
+	g_object_unref (ret);
 }
 
 int BBConfirmTask::run ()
@@ -134,10 +307,12 @@ void BBConfirmTask::confirmTarget (BBSchedules &bbsch, ObservatorySchedule &sche
 	}
 }
 
-BBTasks::BBTasks (BB *_server):TSQueue <BBTask *> ()
+BBTasks::BBTasks (BB *_server):TSQueue <BBTask *> (), threads (), quorums (), doneSchedules ()
 {
-	send_thread = 0;
+	numThreads = 4;
 	server = _server;
+	outstanding = 0;
+	pthread_mutex_init (&state_mutex, NULL);
 }
 
 BBTasks::~BBTasks ()
@@ -147,6 +322,9 @@ BBTasks::~BBTasks ()
 		BBTask *task = pop ();
 		delete task;
 	}
+	while (!doneSchedules.empty ())
+		delete doneSchedules.pop ();
+	pthread_mutex_destroy (&state_mutex);
 }
 
 void BBTasks::run ()
@@ -160,15 +338,20 @@ void BBTasks::run ()
 	else
 	{
 		delete t;
+		pthread_mutex_lock (&state_mutex);
+		outstanding--;
+		pthread_mutex_unlock (&state_mutex);
 	}
 }
 
 void *processTasks (void *arg)
 {
-	char *conn_name;
-	asprintf (&conn_name, "thread_%ld", pthread_self ());
+	char conn_name[50];
+	snprintf (conn_name, 50, "task_%lu", (unsigned long) pthread_self ());
 
-	((rts2db::DeviceDb *) getMasterApp ())->initDB (conn_name);
+	// tasks access the database, they cannot be run before thread has its own connection
+	while (((rts2db::DeviceDb *) getMasterApp ())->connectDB (conn_name))
+		sleep (20);
 
 	while (true)
 	{
@@ -179,8 +362,65 @@ void *processTasks (void *arg)
 
 void BBTasks::queueTask (BBTask *t)
 {
-	if (send_thread == 0)
-		pthread_create (&send_thread, NULL, processTasks, (void *) this);
+	if (threads.empty ())
+	{
+		for (int i = 0; i < numThreads; i++)
+		{
+			pthread_t th;
+			if (pthread_create (&th, NULL, processTasks, (void *) this))
+			{
+				logStream (MESSAGE_ERROR) << "cannot create task thread: " << strerror (errno) << sendLog;
+				break;
+			}
+			threads.push_back (th);
+		}
+	}
+
+	pthread_mutex_lock (&state_mutex);
+	outstanding++;
+	pthread_mutex_unlock (&state_mutex);
 
 	push (t);
 }
+
+void BBTasks::setScheduleQuorum (int schedule_id, int responses)
+{
+	pthread_mutex_lock (&state_mutex);
+	quorums[schedule_id] = responses;
+	pthread_mutex_unlock (&state_mutex);
+}
+
+int BBTasks::getScheduleQuorum (int schedule_id)
+{
+	pthread_mutex_lock (&state_mutex);
+	std::map <int, int>::iterator iter = quorums.find (schedule_id);
+	int ret = (iter == quorums.end ()) ? -1 : iter->second;
+	pthread_mutex_unlock (&state_mutex);
+	return ret;
+}
+
+bool BBTasks::claimSchedule (int schedule_id)
+{
+	pthread_mutex_lock (&state_mutex);
+	std::map <int, int>::iterator iter = quorums.find (schedule_id);
+	bool ret = (iter != quorums.end ());
+	if (ret)
+		quorums.erase (iter);
+	pthread_mutex_unlock (&state_mutex);
+	return ret;
+}
+
+ObservatorySchedule *BBTasks::popDone ()
+{
+	if (doneSchedules.empty ())
+		return NULL;
+	return doneSchedules.pop ();
+}
+
+int BBTasks::getOutstanding ()
+{
+	pthread_mutex_lock (&state_mutex);
+	int ret = outstanding;
+	pthread_mutex_unlock (&state_mutex);
+	return ret;
+}
@@ -25,6 +25,8 @@
 #include "bbdb.h"
 #include "bbconn.h"
 
+#include <map>
+#include <vector>
 #include <pthread.h>
 #include <glib-object.h>
 #include <json-glib/json-glib.h>
@@ -35,6 +37,58 @@ namespace rts2bb
 
 class BB;
 
+/**
+ * HTTP sessions to observatories. One session is kept for each observatory,
+ * so connections (and authentication) are reused between requests. Sessions
+ * are shared between task threads.
+ *
+ * Observatory URL can be overwritten in [bb] section of configuration file,
+ * with observatory_<id>_url key. That can be used to test BB against local
+ * rts2-httpd instances.
+ */
+class ObservatorySessions
+{
+	public:
+		~ObservatorySessions ();
+
+		static ObservatorySessions *instance ();
+
+		/**
+		 * Set request timeout (in seconds). Applies to sessions created after the call.
+		 */
+		void setTimeout (int _timeout) { timeout = _timeout; }
+
+		int getTimeout () { return timeout; }
+
+		/**
+		 * Perform GET request on observatory API.
+		 *
+		 * @param observatory_id  observatory ID
+		 * @param path            request path, including parameters
+		 *
+		 * @return parsed JSON response, NULL on error or timeout. Caller is responsible for freeing the parser.
+		 */
+		JsonParser *jsonRequest (int observatory_id, std::string path);
+
+	private:
+		ObservatorySessions ();
+
+		static ObservatorySessions *pInstance;
+
+		struct ObservatorySession
+		{
+			Observatory *observatory;
+			std::string url;
+			SoupSession *session;
+		};
+
+		std::map <int, ObservatorySession> sessions;
+		pthread_mutex_t sessions_mutex;
+		int timeout;
+
+		ObservatorySession *getSession (int observatory_id);
+};
+
 /**
  * Abstract class for tasks scheduled inside BB.
  */
@@ -53,20 +107,25 @@ class BBTask
 		virtual int run () = 0;
 	
 	protected:
-		JsonParser *jsonRequest (int observatory_id, std::string url);
+		JsonParser *jsonRequest (int observatory_id, std::string url) { return ObservatorySessions::instance ()->jsonRequest (observatory_id, url); }
 };
 
+class BBTasks;
+
 /**
- * Task to schedule observation on a single observatory.
+ * Task to schedule observation on a single observatory. Target is created
+ * on the observatory if it is not yet mapped, and observatory is asked when
+ * it can observe the target. Schedule is handed back to BB once the
+ * observatory responds, or the request fails or times out.
  */
 class BBTaskSchedule:public BBTask
 {
 	public:
-		BBTaskSchedule (ObservatorySchedule *_schedule, int _tar_id, int _observatory_id)
+		BBTaskSchedule (BBTasks *_tasks, ObservatorySchedule *_schedule, int _tar_id)
 		{
+			tasks = _tasks;
 			obs_sched = _schedule;
 			tar_id = _tar_id;
-			sched_process = NULL;
 		}
 
 		virtual ~BBTaskSchedule ()
@@ -76,9 +135,18 @@ class BBTaskSchedule:public BBTask
 		virtual int run ();
 
 	private:
+		BBTasks *tasks;
 		ObservatorySchedule *obs_sched;
 		int tar_id;
-		ConnBBQueue *sched_process;
+
+		/**
+		 * Create target on remote observatory, and record mapping between central and observatory target.
+		 *
+		 * @return observatory target ID, -1 on error
+		 */
+		int createObservatoryTarget ();
+
+		void askSchedule (int obs_tar_id);
 };
 
 /**
@@ -108,7 +176,10 @@ class BBConfirmTask:public BBTask
 
 
 /**
- * Queue holding all tasks.
+ * Queue holding all tasks. Tasks are processed by a pool of threads, so
+ * requests to different observatories run in parallel. Every thread opens
+ * its own database connection, as ECPG connections cannot be shared
+ * between threads.
  */
 class BBTasks:public TSQueue <BBTask *>
 {
@@ -119,10 +190,67 @@ class BBTasks:public TSQueue <BBTask *>
 		void run ();
 
 		void queueTask (BBTask *t);
-	
+
+		/**
+		 * Set number of threads processing the tasks. Must be called before the first task is queued.
+		 */
+		void setNumberOfThreads (int _num) { numThreads = _num; }
+
+		int getNumberOfThreads () { return numThreads; }
+
+		/**
+		 * Set number of observatories which must report they can observe
+		 * the schedule before it is confirmed. Observatories responding
+		 * after the schedule was confirmed are marked as backup.
+		 *
+		 * Quorums are kept only in memory, together with the queued
+		 * tasks. Schedules which were not confirmed before BB restart
+		 * are not confirmed after the restart, and have to be submitted
+		 * again.
+		 *
+		 * @param schedule_id  schedule ID
+		 * @param responses    number of observable responses, 0 to wait for all observatories
+		 */
+		void setScheduleQuorum (int schedule_id, int responses);
+
+		/**
+		 * Returns quorum for the given schedule, -1 if schedule was already confirmed.
+		 */
+		int getScheduleQuorum (int schedule_id);
+
+		/**
+		 * Mark schedule as confirmed.
+		 *
+		 * @return true if schedule was not yet confirmed, false if it was already confirmed
+		 */
+		bool claimSchedule (int schedule_id);
+
+		/**
+		 * Called from task threads when observatory schedule request was processed.
+		 */
+		void scheduleDone (ObservatorySchedule *obs_sched) { doneSchedules.push (obs_sched); }
+
+		/**
+		 * Returns next processed observatory schedule, NULL if there isn't any.
+		 * Called from the main thread.
+		 */
+		ObservatorySchedule *popDone ();
+
+		/**
+		 * Number of tasks queued or running.
+		 */
+		int getOutstanding ();
+
 	private:
-		pthread_t send_thread;
+		std::vector <pthread_t> threads;
+		int numThreads;
 		BB *server;
+
+		std::map <int, int> quorums;
+		int outstanding;
+		pthread_mutex_t state_mutex;
+
+		TSQueue <ObservatorySchedule *> doneSchedules;
 };
 
 }
@@ -20,6 +20,7 @@
 #include "camd.h"
 #include "utilsfunc.h"
 #include "rts2fits/image.h"
+#include "rts2fits/skygenerator.h"
 
 #define OPT_WIDTH        OPT_LOCAL + 1
 #define OPT_HEIGHT       OPT_LOCAL + 2
@@ -29,6 +30,8 @@
 #define OPT_INFOSLEEP    OPT_LOCAL + 6
 #define OPT_READSLEEP    OPT_LOCAL + 7
 #define OPT_FRAMETRANS   OPT_LOCAL + 8
+#define OPT_SKY_CATALOGUE  OPT_LOCAL + 9
+#define OPT_SKY_MOUNT    OPT_LOCAL + 10
 
 namespace rts2camd
 {
@@ -70,6 +73,7 @@ class Dummy:public Camera
 			genType->addSelVal ("flats dusk");
 			genType->addSelVal ("flats dawn");
 			genType->addSelVal ("astar");
+			genType->addSelVal ("sky");
 			genType->setValueInteger (0);
 
 			createValue (fitsTransfer, "fits_transfer", "write FITS file directly in camera", false, RTS2_VALUE_WRITABLE);
@@ -96,6 +100,57 @@ class Dummy:public Camera
 			createValue (noiseRange, "noise_range", "readout noise range", false, RTS2_VALUE_WRITABLE);
 			noiseRange->setValueDouble (300);
 
+			createValue (skyBackground, "sky_background", "[ADU] sky level of generated sky", false, RTS2_VALUE_WRITABLE);
+			skyBackground->setValueDouble (200);
+
+			createValue (skyGradientX, "sky_gradient_x", "[ADU/pixel] sky gradient along X axis", false, RTS2_VALUE_WRITABLE);
+			skyGradientX->setValueDouble (0);
+
+			createValue (skyGradientY, "sky_gradient_y", "[ADU/pixel] sky gradient along Y axis", false, RTS2_VALUE_WRITABLE);
+			skyGradientY->setValueDouble (0);
+
+			createValue (skyReadNoise, "sky_read_noise", "[ADU] read noise of generated sky", false, RTS2_VALUE_WRITABLE);
+			skyReadNoise->setValueDouble (5);
+
+			createValue (skyGain, "sky_gain", "[e-/ADU] gain used for photon noise of generated sky", false, RTS2_VALUE_WRITABLE);
+			skyGain->setValueDouble (1.5);
+
+			createValue (skyFWHM, "sky_fwhm", "[pixels] FWHM of stars on generated sky", false, RTS2_VALUE_WRITABLE);
+			skyFWHM->setValueDouble (3);
+
+			createValue (skyCosmics, "sky_cosmics", "number of cosmic rays per frame", false, RTS2_VALUE_WRITABLE);
+			skyCosmics->setValueInteger (20);
+
+			createValue (skyStars, "sky_stars", "number of random stars; used when catalogue is not specified", false, RTS2_VALUE_WRITABLE);
+			skyStars->setValueInteger (500);
+
+			createValue (skyStarFlux, "sky_star_flux", "[ADU] flux of the brightest random star", false, RTS2_VALUE_WRITABLE);
+			skyStarFlux->setValueDouble (500000);
+
+			createValue (skyCentre, "sky_centre", "centre of generated sky; updated from mount if --sky-mount is specified", false, RTS2_VALUE_WRITABLE);
+			skyCentre->setValueRaDec (0, 0);
+
+			createValue (skyScale, "sky_scale", "[arcsec/pixel] pixel scale of generated sky", false, RTS2_VALUE_WRITABLE);
+			skyScale->setValueDouble (1);
+
+			createValue (skyRotation, "sky_rotation", "[deg] rotation of generated sky, as CROTA2", false, RTS2_VALUE_WRITABLE);
+			skyRotation->setValueDouble (0);
+
+			createValue (skyZeroPoint, "sky_zero_point", "[mag] magnitude of star producing 1 ADU per second", false, RTS2_VALUE_WRITABLE);
+			skyZeroPoint->setValueDouble (22);
+
+			createValue (skyMagLimit, "sky_mag_limit", "[mag] faintest catalogue star", false, RTS2_VALUE_WRITABLE);
+			skyMagLimit->setValueFloat (18);
+
+			createValue (streamFrames, "stream_frames", "number of frames to stream back-to-back after the current one", false, RTS2_VALUE_WRITABLE);
+			streamFrames->setValueInteger (0);
+
+			createValue (genTime, "gen_time", "[s] time to generate last frame", false);
+			createValue (genRate, "gen_rate", "[MPix/s] generation rate of last frame", false);
+
+			skyCatalogue = NULL;
+			skyMount = NULL;
+
 			createValue (hasError, "has_error", "if true, info will report error", false, RTS2_VALUE_WRITABLE);
 			hasError->setValueBool (false);
 
@@ -116,12 +171,15 @@ class Dummy:public Camera
 			addOption (OPT_DATA_SIZE, "datasize", 1, "size of data block transmitted over TCP/IP");
 			addOption (OPT_CHANNELS, "channels", 1, "number of data channels");
 			addOption (OPT_REMOVE_TEMP, "no-temp", 0, "do not show temperature related fields");
+			addOption (OPT_SKY_CATALOGUE, "sky-catalogue", 1, "star catalogue for sky generator");
+			addOption (OPT_SKY_MOUNT, "sky-mount", 1, "mount providing centre of generated sky");
 		}
 
 		virtual ~Dummy (void)
 		{
 			readoutSleep = NULL;
 			delete[] written;
+			delete skyCatalogue;
 		}
 
 		virtual int processOption (int in_opt)
@@ -153,6 +211,12 @@ class Dummy:public Camera
 				case OPT_REMOVE_TEMP:
 					showTemp = false;
 					break;
+				case OPT_SKY_CATALOGUE:
+					skyCatalogueFile = optarg;
+					break;
+				case OPT_SKY_MOUNT:
+					skyMount = optarg;
+					break;
 				default:
 					return Camera::processOption (in_opt);
 			}
@@ -197,6 +261,16 @@ class Dummy:public Camera
 
 			srand (time (NULL));
 
+			if (skyCatalogueFile.length () > 0)
+			{
+				skyCatalogue = new rts2catd::CatFile ();
+				if (skyCatalogue->openFile (skyCatalogueFile.c_str ()))
+				{
+					logStream (MESSAGE_ERROR) << "cannot open sky catalogue " << skyCatalogueFile << sendLog;
+					return -1;
+				}
+			}
+
 			return initChips ();
 		}
 		virtual int initChips ()
@@ -319,6 +393,32 @@ class Dummy:public Camera
 
 		rts2core::ValueBool *fitsTransfer;
 
+		rts2core::ValueDouble *skyBackground;
+		rts2core::ValueDouble *skyGradientX;
+		rts2core::ValueDouble *skyGradientY;
+		rts2core::ValueDouble *skyReadNoise;
+		rts2core::ValueDouble *skyGain;
+		rts2core::ValueDouble *skyFWHM;
+		rts2core::ValueInteger *skyCosmics;
+		rts2core::ValueInteger *skyStars;
+		rts2core::ValueDouble *skyStarFlux;
+		rts2core::ValueRaDec *skyCentre;
+		rts2core::ValueDouble *skyScale;
+		rts2core::ValueDouble *skyRotation;
+		rts2core::ValueDouble *skyZeroPoint;
+		rts2core::ValueFloat *skyMagLimit;
+
+		rts2core::ValueInteger *streamFrames;
+
+		rts2core::ValueDouble *genTime;
+		rts2core::ValueDouble *genRate;
+
+		std::string skyCatalogueFile;
+		rts2catd::CatFile *skyCatalogue;
+		const char *skyMount;
+
+		rts2image::SkyGenerator skyGenerator;
+
 		int width;
 		int height;
 
@@ -330,6 +430,13 @@ class Dummy:public Camera
 
 		template <typename dt> void generateData (dt *data, size_t pixelsize);
 
+		void generateSky (int chan);
+
+		/**
+		 * Called when all data were sent. Queues next exposure when streaming.
+		 */
+		int readoutDone ();
+
 		// data written during readout
 		ssize_t *written;
 };
@@ -474,7 +581,7 @@ int Dummy::doReadout ()
 			image->closeFile ();
 			delete image;
 			fitsDataTransfer ("/tmp/fits_data.fits");
-			return -2;
+			return readoutDone ();
 		}
 	}
 	else
@@ -515,17 +622,35 @@ int Dummy::doReadout ()
 			image->closeFile ();
 			delete image;
 			fitsDataTransfer ("/tmp/fits_data.fits");
-			return -2;
+			return readoutDone ();
 		}
 	}
 
 	if (getWriteBinaryDataSize () == 0)
-		return -2;				 // no more data..
+		return readoutDone ();	 // no more data..
 	return 0;					 // imediately send new data
 }
 
+int Dummy::readoutDone ()
+{
+	if (streamFrames->getValueInteger () > 0)
+	{
+		streamFrames->dec ();
+		sendValueAll (streamFrames);
+		quedExpNumber->inc ();
+		sendValueAll (quedExpNumber);
+	}
+	return -2;
+}
+
 void Dummy::generateImage (size_t pixelsize, int chan)
 {
+	if (genType->getValueInteger () == 6)
+	{
+		generateSky (chan);
+		return;
+	}
+
 	// artifical star center
 	astar_Xp->clear ();
 	astar_Yp->clear ();
@@ -571,6 +696,44 @@ void Dummy::generateImage (size_t pixelsize, int chan)
 	}
 }
 
+void Dummy::generateSky (int chan)
+{
+	long w = getUsedWidthBinned ();
+	long h = getUsedHeightBinned ();
+
+	skyGenerator.setBias (noiseBias->getValueDouble ());
+	skyGenerator.setReadNoise (skyReadNoise->getValueDouble ());
+	skyGenerator.setGain (skyGain->getValueDouble ());
+	skyGenerator.setSky (skyBackground->getValueDouble ());
+	skyGenerator.setGradient (skyGradientX->getValueDouble (), skyGradientY->getValueDouble ());
+	skyGenerator.setFWHM (skyFWHM->getValueDouble ());
+	skyGenerator.setCosmics (skyCosmics->getValueInteger ());
+
+	if (skyMount)
+	{
+		rts2core::Connection *conn = getOpenConnection (skyMount);
+		rts2core::Value *tel = conn ? conn->getValue ("TEL") : NULL;
+		if (tel && tel->getValueType () == RTS2_VALUE_RADEC)
+		{
+			skyCentre->setValueRaDec (((rts2core::ValueRaDec *) tel)->getRa (), ((rts2core::ValueRaDec *) tel)->getDec ());
+			sendValueAll (skyCentre);
+		}
+	}
+
+	struct ln_equ_posn centre;
+	centre.ra = skyCentre->getRa ();
+	centre.dec = skyCentre->getDec ();
+
+	double t = getNow ();
+	skyGenerator.generateField (getDataBuffer (chan), getDataType (), w, h, skyCatalogue, &centre, skyScale->getValueDouble () * binningVertical (), skyRotation->getValueDouble (), skyZeroPoint->getValueDouble (), getExposure (), skyMagLimit->getValueFloat (), skyStars->getValueInteger (), skyStarFlux->getValueDouble (), ((uint64_t) rand () << 32) ^ (getExposureNumber () * 1000 + chan));
+	t = getNow () - t;
+
+	genTime->setValueDouble (t);
+	genRate->setValueDouble (w * h / t / 1e6);
+	sendValueAll (genTime);
+	sendValueAll (genRate);
+}
+
 template <typename dt> void Dummy::generateData (dt *data, size_t pixelSize)
 {
 	double sx = astarX->getValueDouble ();
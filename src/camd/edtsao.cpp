@@ -22,6 +22,7 @@
 
 #include "connection/fork.h"
 #include "valuearray.h"
+#include "taplayout.h"
 
 #define OPT_NOTIMEOUT  OPT_LOCAL + 73
 #define OPT_NOWRITE    OPT_LOCAL + 74
@@ -255,8 +256,6 @@ class EdtSao:public Camera
 		virtual long isExposing ();
 		virtual int readoutStart ();
 
-		virtual size_t suggestBufferSize () { return 0; }
-
 		virtual int doReadout ();
 		virtual int endReadout ();
 
@@ -433,8 +432,6 @@ class EdtSao:public Camera
 		int lastH;
 		int lastSplitMode;
 		int lastPartialReadout;
-
-		int sendChannel (int chan, u_char *buf, int chanorder, int totalchanel);
 };
 
 }
@@ -1092,20 +1089,6 @@ int EdtSao::readoutStart ()
 	return 0;
 }
 
-int EdtSao::sendChannel (int chan, u_char *buf, int chanorder, int totalchanel)
-{
-	uint16_t *sb = new uint16_t[chipUsedSize ()];
-	uint16_t *psb = sb;
-	for (uint16_t *p = ((uint16_t *) buf) + chanorder; (u_char*) p < buf + chipByteSize () * totalchanel; p += totalchanel)
-	{
-		*psb = *p;
-		psb++;
-	}
-	sendReadoutData ((char *) sb, getWriteBinaryDataSize (chanorder), chanorder);
-	delete[] sb;
-	return 0;
-}
-
 int EdtSao::doReadout ()
 {
 	int i, j;
@@ -1145,33 +1128,23 @@ int EdtSao::doReadout ()
 		return -1;
 	}
 
-	/* BYTE SWAP FOR UNIX */
-
-	if (!ft_byteswap ())
-	{
-		for (j = 0; j < imagesize; j += 2)
-		{
-			u_char bufa = bufs[0][j];
-			u_char bufb = bufs[0][j + 1];
-			bufs[0][j] = bufb;
-			bufs[0][j + 1] = bufa;
-		}
-	}
-
 	/* PRINTOUT FIRST AND LAST PIXELS - DEBUG */
 
+	// data are big endian, unless swapped by the interface
+	int hb = ft_byteswap () ? 1 : 0;
+
 	if (verbose)
 	{
 		printf ("first 8 pixels\n");
 		for (j = 0; j < 16; j += 2)
 		{
-			x = (bufs[0][j + 1] << 8) + bufs[0][j];
+			x = (bufs[0][j + hb] << 8) + bufs[0][j + 1 - hb];
 			printf ("%d ", x);
 		}
 		printf ("\nlast 8 pixels\n");
 		for (j = imagesize - 16; j < imagesize; j += 2)
 		{
-			x = (bufs[0][j + 1] << 8) + bufs[0][j];
+			x = (bufs[0][j + hb] << 8) + bufs[0][j + 1 - hb];
 			printf ("%d ", x);
 		}
 		printf ("\n");
@@ -1179,11 +1152,23 @@ int EdtSao::doReadout ()
 
 	//pdv_free (bufs[0]);
 
+	// pixels of channels are interleaved; byte swap for UNIX is done during deinterleaving
+	rts2camd::TapLayout layout;
+	layout.setTaps (getUsedChannels ());
+	layout.setInterleave (rts2camd::TAP_PIXEL);
+	layout.setByteSwap (!ft_byteswap ());
+
+	std::vector <void *> dst;
+	for (j = 0; j < getUsedChannels (); j++)
+		dst.push_back (getDataBuffer (j));
+
+	layout.extractAll (bufs[0], chipByteSize () * getUsedChannels (), getUsedWidthBinned (), getUsedHeightBinned (), &(dst[0]));
+
 	for (i = 0, j = 0; i < totalChannels; i++)
 	{
 		if ((*channels)[i])
 		{
-			ret = sendChannel (i, bufs[0], j, getUsedChannels ());
+			ret = sendReadoutData (getDataBuffer (j), getWriteBinaryDataSize (j), j);
 			if (ret < 0)
 				return -1;
 			j++;
@@ -25,10 +25,12 @@
 #include "camd.h"
 #include "valuearray.h"
 #include "iniparser.h"
+#include "taplayout.h"
 
 #define OPT_DRY             OPT_LOCAL + 1
 #define OPT_POWERUP         OPT_LOCAL + 2
 #define OPT_CONFIGURED_TAP  OPT_LOCAL + 3
+#define OPT_TAP_LAYOUT      OPT_LOCAL + 4
 
 // only constants; class is kept in reflex.cpp
 #include "reflex.h"
@@ -220,8 +222,6 @@ class Reflex:public Camera
 		virtual long isExposing ();
 		virtual int readoutStart ();
 
-		virtual size_t suggestBufferSize () { return 0; }
-
 		virtual int doReadout ();
 		virtual int endReadout ();
 
@@ -235,6 +235,9 @@ class Reflex:public Camera
 		// if tap order specified in configuration file should be used. If false, linear order will be programmed
 		bool configuredTap;
 
+		// layout of taps in readout buffer, specified with --tap-layout
+		const char *tapLayout;
+
 		// last tap parameters
 		int last_taplength;
 		int last_height;
@@ -398,6 +401,7 @@ Reflex::Reflex (int in_argc, char **in_argv):Camera (in_argc, in_argv)
 	dry_run = false;
 	powerUp = false;
 	configuredTap = false;
+	tapLayout = NULL;
 	last_taplength = -1;
 	last_height = -1;
 
@@ -492,6 +496,7 @@ Reflex::Reflex (int in_argc, char **in_argv):Camera (in_argc, in_argv)
 	config = NULL;
 
 	addOption (OPT_CONFIGURED_TAP, "configured-tap", 0, "use tap order from configuration file");
+	addOption (OPT_TAP_LAYOUT, "tap-layout", 1, "taps flips and order in readout buffer (e.g. \"flipx=1,3 order=1,0,3,2\")");
 	addOption ('c', NULL, 1, "configuration file (.rcf)");
 	addOption (OPT_DRY, "dry-run", 0, "don't perform any writes or commands");
 	addOption (OPT_POWERUP, "power-up", 0, "auto power up controller");
@@ -729,30 +734,32 @@ int Reflex::doReadout ()
 	else
 	{
 		size_t i,j;
-		int lw = getUsedWidth () * 2;
-		int dw = lw * getUsedChannels ();
-		// buffer for a single channel
-		unsigned char chanbuf[lw * getUsedHeight ()];
+		// rows of channels follow each other in the readout buffer
+		rts2camd::TapLayout layout;
+		layout.setTaps (getUsedChannels ());
+		layout.setInterleave (rts2camd::TAP_LINE);
+		if (tapLayout && layout.parse (tapLayout))
+		{
+			logStream (MESSAGE_ERROR) << "invalid tap layout " << tapLayout << sendLog;
+			return -1;
+		}
+
+		// extract channels directly to data buffers
+		std::vector <void *> dst;
+		for (j = 0; j < (size_t) getUsedChannels (); j++)
+			dst.push_back (getDataBuffer (j));
+
 		int byte_size = pdv_get_dmasize (CLHandle);
+		long rows = layout.extractAll (buf, byte_size, getUsedWidth (), getUsedHeight (), &(dst[0]));
+		if (rows < getUsedHeight ())
+			logStream (MESSAGE_ERROR) << "wrong bytesize, at row " << rows << ", passing " << byte_size << "size" << sendLog;
+
 		// actual channel
 		for (i = 0, j = 0; i < channels->size (); i++)
 		{
 			if ((*channels)[i])
 			{
-				// copy channel to channel buffer
-				// line start pointer
-				unsigned char *ls = buf + lw * j;
-				unsigned char *ds = chanbuf;
-				int l;
-				for (l = 0; l < getUsedHeight () && ls < buf + byte_size; l++)
-				{
-					memcpy (ds, ls, lw);
-					ls += dw;
-					ds += lw;
-				}
-				if (l < getUsedHeight ())
-					logStream (MESSAGE_ERROR) << "wrong bytesize, at row " << l << ", passing " << byte_size << "size" << sendLog;
-				int ret = sendChannel (i, chanbuf, j, getUsedChannels ());
+				int ret = sendChannel (i, (u_char *) dst[j], j, getUsedChannels ());
 				if (ret < 0)
 					return -1;
 				j++;
@@ -784,6 +791,17 @@ int Reflex::processOption (int in_opt)
 		case OPT_CONFIGURED_TAP:
 			configuredTap = true;
 			break;
+		case OPT_TAP_LAYOUT:
+			{
+				rts2camd::TapLayout layout;
+				if (layout.parse (optarg))
+				{
+					std::cerr << "invalid tap layout: " << optarg << std::endl;
+					return -1;
+				}
+			}
+			tapLayout = optarg;
+			break;
 		default:
 			return Camera::processOption (in_opt);
 	}
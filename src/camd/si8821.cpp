@@ -18,6 +18,7 @@
  */
 
 #include "camd.h"
+#include "taplayout.h"
 #include "utilsfunc.h"
 
 #include <string.h>
@@ -136,9 +137,6 @@ class SI8821:public Camera
 
 		rts2core::ValueBool *testImage;
 		int total;   // DMA size
-
-		// buffer for reconstructing image
-		uint16_t *chanBuffer;
 };
 
 }
@@ -151,8 +149,6 @@ SI8821::SI8821 (int argc, char **argv):Camera (argc, argv, FLOOR)
 	cameraCfg = NULL;
 	cameraSet = NULL;
 
-	chanBuffer = NULL;
-
 	createTempCCD ();
 	createTempSet ();
 	createExpType ();
@@ -188,7 +184,6 @@ SI8821::~SI8821 ()
 
 	if (camera.fd)
 		close (camera.fd);
-	delete []chanBuffer;
 }
 
 int SI8821::processOption (int opt)
@@ -291,8 +286,6 @@ int SI8821::initHardware ()
 		//print_config (); // APMONTERO: FOR TESTING
 	}
 
-	chanBuffer = new uint16_t[(camera.readout[READOUT_SERIAL_ORIGIN_IX] + camera.readout[READOUT_SERIAL_LENGTH_IX]) * (camera.readout[READOUT_PARALLEL_ORIGIN_IX] + camera.readout[READOUT_PARALLEL_LENGTH_IX])];
-
 	setSize (camera.readout[READOUT_SERIAL_LENGTH_IX], camera.readout[READOUT_PARALLEL_LENGTH_IX], camera.readout[READOUT_SERIAL_ORIGIN_IX], camera.readout[READOUT_PARALLEL_ORIGIN_IX]);
 
 	//printf("set_temp: %f\n",kelvinToCelsius(camera.config[CONFIG_SET_TEMP_IX]/10.0));
@@ -492,46 +485,21 @@ int SI8821::doReadout ()
 
 	logStream (MESSAGE_DEBUG) << "got data" << sendLog;
 
-	short unsigned int *p = chanBuffer;
-	short unsigned int *d = camera.ptr;
-
-	// get first channel
-	for (int r = 0; r < getUsedHeightBinned (); r++)
-	{
-		for (int c = 0; c < getUsedWidthBinned (); c++)
-		{
-			*p = *d;
-			p++;
-			d += 2;
-		}
-	}
-
-	ret = sendReadoutData ((char*) chanBuffer, getWriteBinaryDataSize (0), 0);
-
-	if (ret < 0)
-	{
-		return -1;
-	}
+	// pixels of the two channels are interleaved
+	rts2camd::TapLayout layout;
+	layout.setTaps (2);
+	layout.setInterleave (rts2camd::TAP_PIXEL);
 
-	p = chanBuffer;
-	d = camera.ptr + 1;
+	void *dst[2] = { getDataBuffer (0), getDataBuffer (1) };
+	layout.extractAll (camera.ptr, camera.dma_status.transferred, getUsedWidthBinned (), getUsedHeightBinned (), dst);
 
-	// get first channel
-	for (int r = 0; r < getUsedHeightBinned (); r++)
+	for (int i = 0; i < 2; i++)
 	{
-		for (int c = 0; c < getUsedWidthBinned (); c++)
-		{
-			*p = *d;
-			p++;
-			d += 2;
-		}
+		ret = sendReadoutData (getDataBuffer (i), getWriteBinaryDataSize (i), i);
+		if (ret < 0)
+			return -1;
 	}
 
-	ret = sendReadoutData ((char*) chanBuffer, getWriteBinaryDataSize (1), 1);
-
-	if (ret < 0)
-		return -1;
-
 	if (getWriteBinaryDataSize () == 0)
 		return -2;
 
@@ -0,0 +1,212 @@
+/*
+ * Benchmark of multi-tap readout deinterleaving.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "cliapp.h"
+#include "taplayout.h"
+#include "utilsfunc.h"
+
+#include <iostream>
+#include <iomanip>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+/**
+ * Deinterleaves synthetic 16 bit readouts of 4, 8 and 16 tap cameras,
+ * verifies result against per-pixel copy loop and compares their speed.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class TapBench:public rts2core::CliApp
+{
+	public:
+		TapBench (int argc, char **argv);
+
+		virtual int doProcessing ();
+
+	protected:
+		virtual int processOption (int opt);
+
+	private:
+		long width;
+		long height;
+		int repeat;
+		int prescan;
+		int overscan;
+		std::vector <int> taps;
+
+		int bench (int ntaps, rts2camd::tap_interleave_t interleave);
+};
+
+TapBench::TapBench (int argc, char **argv):rts2core::CliApp (argc, argv)
+{
+	width = 1024;
+	height = 4096;
+	repeat = 10;
+	prescan = 8;
+	overscan = 16;
+
+	addOption ('w', NULL, 1, "tap width in pixels, without prescan and overscan (default 1024)");
+	addOption ('r', NULL, 1, "number of rows (default 4096)");
+	addOption ('n', NULL, 1, "number of repeats (default 10)");
+	addOption ('t', NULL, 1, "number of taps; can be specified multiple times (default 4, 8 and 16)");
+	addOption ('p', NULL, 1, "prescan pixels (default 8)");
+	addOption ('o', NULL, 1, "overscan pixels (default 16)");
+}
+
+int TapBench::processOption (int opt)
+{
+	switch (opt)
+	{
+		case 'w':
+			width = atol (optarg);
+			break;
+		case 'r':
+			height = atol (optarg);
+			break;
+		case 'n':
+			repeat = atoi (optarg);
+			if (repeat < 1)
+				repeat = 1;
+			break;
+		case 't':
+			taps.push_back (atoi (optarg));
+			break;
+		case 'p':
+			prescan = atoi (optarg);
+			break;
+		case 'o':
+			overscan = atoi (optarg);
+			break;
+		default:
+			return rts2core::CliApp::processOption (opt);
+	}
+	return 0;
+}
+
+int TapBench::bench (int ntaps, rts2camd::tap_interleave_t interleave)
+{
+	long rawWidth = width + prescan + overscan;
+	std::vector <uint16_t> raw (rawWidth * height * ntaps);
+
+	// value encodes tap, row and column
+	for (long r = 0; r < height; r++)
+	{
+		for (int t = 0; t < ntaps; t++)
+		{
+			for (long c = 0; c < rawWidth; c++)
+			{
+				uint16_t v = (t * 7919 + r * 131 + c) & 0xffff;
+				if (interleave == rts2camd::TAP_PIXEL)
+					raw[(r * rawWidth + c) * ntaps + t] = v;
+				else
+					raw[(r * ntaps + t) * rawWidth + c] = v;
+			}
+		}
+	}
+
+	rts2camd::TapLayout layout;
+	layout.setTaps (ntaps);
+	layout.setInterleave (interleave);
+	layout.setPixelBytes (2);
+	layout.setScan (prescan, overscan);
+	// every other tap is read from the other side
+	for (int t = 1; t < ntaps; t += 2)
+		layout.setFlip (t, true, false);
+
+	std::vector <std::vector <uint16_t> > out (ntaps, std::vector <uint16_t> (width * height));
+	std::vector <void *> dst (ntaps);
+	for (int t = 0; t < ntaps; t++)
+		dst[t] = &(out[t][0]);
+
+	// per-pixel loop, as the drivers did before
+	double t0 = getNow ();
+	for (int i = 0; i < repeat; i++)
+	{
+		for (int t = 0; t < ntaps; t++)
+		{
+			uint16_t *d = &(out[t][0]);
+			for (long r = 0; r < height; r++)
+			{
+				for (long c = 0; c < width; c++)
+				{
+					long rc = (t % 2) ? rawWidth - overscan - 1 - c : prescan + c;
+					if (interleave == rts2camd::TAP_PIXEL)
+						*d = raw[(r * rawWidth + rc) * ntaps + t];
+					else
+						*d = raw[(r * ntaps + t) * rawWidth + rc];
+					d++;
+				}
+			}
+		}
+	}
+	double naive = (getNow () - t0) / repeat;
+
+	std::vector <std::vector <uint16_t> > ref (out);
+
+	t0 = getNow ();
+	for (int i = 0; i < repeat; i++)
+	{
+		if (layout.extractAll (&(raw[0]), raw.size () * 2, rawWidth, height, &(dst[0])) != height)
+		{
+			std::cerr << "extraction failed" << std::endl;
+			return -1;
+		}
+	}
+	double kernel = (getNow () - t0) / repeat;
+
+	for (int t = 0; t < ntaps; t++)
+	{
+		if (ref[t] != out[t])
+		{
+			std::cerr << ntaps << " taps: tap " << t << " differs from reference" << std::endl;
+			return -1;
+		}
+	}
+
+	double mb = raw.size () * 2 / 1048576.0;
+	std::cout << std::setw (2) << ntaps << " taps " << (interleave == rts2camd::TAP_PIXEL ? "pixel" : "line ")
+		<< std::fixed << std::setprecision (1) << " " << mb << " MB loop " << std::setprecision (2) << 1000 * naive
+		<< " ms (" << std::setprecision (0) << mb / naive << " MB/s) kernel " << std::setprecision (2) << 1000 * kernel
+		<< " ms (" << std::setprecision (0) << mb / kernel << " MB/s)" << std::endl;
+	std::cout.unsetf (std::ios_base::floatfield);
+	return 0;
+}
+
+int TapBench::doProcessing ()
+{
+	if (taps.empty ())
+	{
+		taps.push_back (4);
+		taps.push_back (8);
+		taps.push_back (16);
+	}
+	for (std::vector <int>::iterator iter = taps.begin (); iter != taps.end (); iter++)
+	{
+		if (bench (*iter, rts2camd::TAP_PIXEL) || bench (*iter, rts2camd::TAP_LINE))
+			return -1;
+	}
+	return 0;
+}
+
+int main (int argc, char **argv)
+{
+	TapBench app (argc, argv);
+	return app.run ();
+}
@@ -0,0 +1,240 @@
+/*
+ * Benchmark of catalogue file queries.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "cliapp.h"
+#include "catfile.h"
+#include "utilsfunc.h"
+
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <math.h>
+
+/**
+ * Simple xorshift generator, so synthetic catalogue can be generated twice
+ * with the same stars.
+ */
+class SynthRandom
+{
+	public:
+		SynthRandom (uint64_t seed) { state = seed ? seed : 88172645463325252ULL; }
+
+		// uniform in [0,1)
+		double next ()
+		{
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			return (state >> 11) * (1.0 / 9007199254740992.0);
+		}
+
+	private:
+		uint64_t state;
+};
+
+/**
+ * Creates synthetic catalogue with uniformly distributed stars, and measures
+ * time of cone and box queries on it.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class CatBench:public rts2core::CliApp
+{
+	public:
+		CatBench (int argc, char **argv);
+
+		virtual int doProcessing ();
+
+	protected:
+		virtual int processOption (int opt);
+		virtual int processArgs (const char *arg);
+
+	private:
+		const char *catalogue;
+		double numStars;
+		int nside;
+		int numQueries;
+		double radius;
+		double magLimit;
+		int maxStars;
+		bool generate;
+
+		int generateCatalogue ();
+
+		// print statistics of query times (in seconds)
+		void report (const char *name, std::vector <double> &times, double stars);
+};
+
+CatBench::CatBench (int argc, char **argv):rts2core::CliApp (argc, argv)
+{
+	catalogue = NULL;
+	numStars = 1e8;
+	nside = 256;
+	numQueries = 10000;
+	radius = 0.5;
+	magLimit = 99;
+	maxStars = 1000;
+	generate = false;
+
+	addOption ('g', NULL, 0, "generate synthetic catalogue before benchmarking");
+	addOption ('n', NULL, 1, "number of stars in synthetic catalogue (default 1e8)");
+	addOption ('s', NULL, 1, "HEALPix nside of synthetic catalogue (default 256)");
+	addOption ('q', NULL, 1, "number of queries (default 10000)");
+	addOption ('r', NULL, 1, "query radius in degrees (default 0.5)");
+	addOption ('m', NULL, 1, "magnitude limit of queries");
+	addOption ('l', NULL, 1, "maximal number of stars returned by query (default 1000)");
+}
+
+int CatBench::processOption (int opt)
+{
+	switch (opt)
+	{
+		case 'g':
+			generate = true;
+			break;
+		case 'n':
+			numStars = atof (optarg);
+			break;
+		case 's':
+			nside = atoi (optarg);
+			break;
+		case 'q':
+			numQueries = atoi (optarg);
+			break;
+		case 'r':
+			radius = atof (optarg);
+			break;
+		case 'm':
+			magLimit = atof (optarg);
+			break;
+		case 'l':
+			maxStars = atoi (optarg);
+			break;
+		default:
+			return rts2core::CliApp::processOption (opt);
+	}
+	return 0;
+}
+
+int CatBench::processArgs (const char *arg)
+{
+	if (catalogue != NULL)
+		return -1;
+	catalogue = arg;
+	return 0;
+}
+
+int CatBench::generateCatalogue ()
+{
+	rts2catd::CatFileWriter writer (nside);
+	uint64_t n = (uint64_t) numStars;
+
+	for (int pass = 1; pass <= 2; pass++)
+	{
+		// same seed, so both passes see the same stars
+		SynthRandom rnd (1);
+		for (uint64_t i = 0; i < n; i++)
+		{
+			double ra = rnd.next () * 360.0;
+			double dec = asin (2 * rnd.next () - 1) * 180.0 / M_PI;
+			// number of stars grows roughly as 10^(0.35 mag)
+			float mag = 21 + log10 (1 - rnd.next ()) / 0.35;
+			if (pass == 1)
+				writer.count (ra, dec);
+			else
+				writer.add (i, ra, dec, mag);
+		}
+		if (pass == 1 && writer.create (catalogue))
+			return -1;
+	}
+	return writer.finish ();
+}
+
+void CatBench::report (const char *name, std::vector <double> &times, double stars)
+{
+	std::sort (times.begin (), times.end ());
+	double sum = 0;
+	for (std::vector <double>::iterator iter = times.begin (); iter != times.end (); iter++)
+		sum += *iter;
+	std::cout << std::setw (5) << name << " mean " << std::setw (8) << 1000 * sum / times.size ()
+		<< " ms median " << std::setw (8) << 1000 * times[times.size () / 2]
+		<< " ms 99% " << std::setw (8) << 1000 * times[(size_t) (times.size () * 0.99)]
+		<< " ms max " << std::setw (8) << 1000 * times.back ()
+		<< " ms stars " << stars / times.size () << std::endl;
+}
+
+int CatBench::doProcessing ()
+{
+	if (catalogue == NULL)
+	{
+		std::cerr << "catalogue file must be specified" << std::endl;
+		return -1;
+	}
+
+	if (generate)
+	{
+		double t = getNow ();
+		if (generateCatalogue ())
+			return -1;
+		std::cout << "generated " << numStars << " stars in " << getNow () - t << " s" << std::endl;
+	}
+
+	rts2catd::CatFile catFile;
+	if (catFile.openFile (catalogue))
+		return -1;
+
+	std::cout << std::fixed << std::setprecision (3) << "catalogue " << catalogue << " with " << catFile.getNStars () << " stars, nside " << catFile.getNside () << std::endl;
+
+	SynthRandom rnd (2);
+	std::vector <const struct catfile_star *> result;
+	std::vector <double> coneTimes, boxTimes;
+	double coneStars = 0, boxStars = 0;
+
+	for (int i = 0; i < numQueries; i++)
+	{
+		struct ln_equ_posn centre, c1, c2;
+		centre.ra = rnd.next () * 360.0;
+		centre.dec = asin (2 * rnd.next () - 1) * 180.0 / M_PI;
+
+		double t = getNow ();
+		catFile.coneSearch (&centre, radius, magLimit, maxStars, result);
+		coneTimes.push_back (getNow () - t);
+		coneStars += result.size ();
+
+		c1.ra = ln_range_degrees (centre.ra - radius);
+		c2.ra = ln_range_degrees (centre.ra + radius);
+		c1.dec = std::max (-90.0, centre.dec - radius);
+		c2.dec = std::min (90.0, centre.dec + radius);
+
+		t = getNow ();
+		catFile.boxSearch (&c1, &c2, magLimit, maxStars, result);
+		boxTimes.push_back (getNow () - t);
+		boxStars += result.size ();
+	}
+
+	report ("cone", coneTimes, coneStars);
+	report ("box", boxTimes, boxStars);
+	return 0;
+}
+
+int main (int argc, char **argv)
+{
+	CatBench app (argc, argv);
+	return app.run ();
+}
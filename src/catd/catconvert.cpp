@@ -0,0 +1,260 @@
+/*
+ * Convert text catalogue to RTS2 catalogue file.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "cliapp.h"
+#include "catfile.h"
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+/**
+ * Converts whitespace separated text catalogue (e.g. subset of GSC, UCAC or
+ * Gaia exported from Vizier) to memory mapped catalogue file used by
+ * rts2_gsc. Input files are read twice - first pass counts stars in
+ * HEALPix cells, second pass writes them.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class CatConvert:public rts2core::CliApp
+{
+	public:
+		CatConvert (int argc, char **argv);
+
+		virtual int doProcessing ();
+
+	protected:
+		virtual int processOption (int opt);
+		virtual int processArgs (const char *arg);
+		virtual void usage ();
+
+	private:
+		std::vector <const char *> inputs;
+		const char *output;
+		int nside;
+
+		// columns, numbered from 1
+		int colId;
+		int colRa;
+		int colDec;
+		int colMag;
+
+		/**
+		 * Parse single line.
+		 *
+		 * @return -1 on error, 1 for comment or empty line, 0 on success
+		 */
+		int parseLine (std::string &line, uint64_t &id, double &ra, double &dec, float &mag);
+
+		/**
+		 * Process all input files.
+		 *
+		 * @param writer  catalogue writer
+		 * @param pass    1 for counting, 2 for writing
+		 */
+		int processInputs (rts2catd::CatFileWriter &writer, int pass);
+};
+
+CatConvert::CatConvert (int argc, char **argv):rts2core::CliApp (argc, argv), inputs ()
+{
+	output = NULL;
+	nside = 256;
+	colId = 1;
+	colRa = 2;
+	colDec = 3;
+	colMag = 4;
+
+	addOption ('o', NULL, 1, "output catalogue file");
+	addOption ('n', NULL, 1, "HEALPix nside (power of 2, default 256)");
+	addOption ('i', NULL, 1, "column with star ID (default 1)");
+	addOption ('r', NULL, 1, "column with RA in degrees (default 2)");
+	addOption ('d', NULL, 1, "column with DEC in degrees (default 3)");
+	addOption ('m', NULL, 1, "column with magnitude (default 4)");
+}
+
+int CatConvert::processOption (int opt)
+{
+	switch (opt)
+	{
+		case 'o':
+			output = optarg;
+			break;
+		case 'n':
+			nside = atoi (optarg);
+			if (nside <= 0 || (nside & (nside - 1)))
+			{
+				std::cerr << "nside must be power of 2" << std::endl;
+				return -1;
+			}
+			break;
+		case 'i':
+			colId = atoi (optarg);
+			break;
+		case 'r':
+			colRa = atoi (optarg);
+			break;
+		case 'd':
+			colDec = atoi (optarg);
+			break;
+		case 'm':
+			colMag = atoi (optarg);
+			break;
+		default:
+			return rts2core::CliApp::processOption (opt);
+	}
+	return 0;
+}
+
+int CatConvert::processArgs (const char *arg)
+{
+	inputs.push_back (arg);
+	return 0;
+}
+
+void CatConvert::usage ()
+{
+	std::cout << "  " << getAppName () << " -o ucac4.cat ucac4_subset.txt" << std::endl
+		<< "  " << getAppName () << " -o gsc.cat -i 1 -r 3 -d 4 -m 7 gsc1.txt gsc2.txt" << std::endl;
+}
+
+int CatConvert::parseLine (std::string &line, uint64_t &id, double &ra, double &dec, float &mag)
+{
+	size_t s = line.find_first_not_of (" \t\r");
+	if (s == std::string::npos || line[s] == '#')
+		return 1;
+
+	std::istringstream is (line);
+	std::string col;
+	int found = 0;
+	for (int c = 1; is >> col; c++)
+	{
+		const char *cs = col.c_str ();
+		char *end;
+		if (c == colId)
+		{
+			// IDs are unsigned, strtoull silently negates values with sign
+			if (!isdigit (*cs))
+				return -1;
+			errno = 0;
+			id = strtoull (cs, &end, 10);
+			if (errno == ERANGE)
+				return -1;
+			found |= 0x01;
+		}
+		else if (c == colRa)
+		{
+			ra = strtod (cs, &end);
+			found |= 0x02;
+		}
+		else if (c == colDec)
+		{
+			dec = strtod (cs, &end);
+			found |= 0x04;
+		}
+		else if (c == colMag)
+		{
+			mag = strtod (cs, &end);
+			found |= 0x08;
+		}
+		else
+		{
+			continue;
+		}
+		if (*end != '\0')
+			return -1;
+	}
+	if (found != 0x0f || ra < 0 || ra >= 360 || dec < -90 || dec > 90)
+		return -1;
+	return 0;
+}
+
+int CatConvert::processInputs (rts2catd::CatFileWriter &writer, int pass)
+{
+	for (std::vector <const char *>::iterator iter = inputs.begin (); iter != inputs.end (); iter++)
+	{
+		std::ifstream is (*iter);
+		if (is.fail ())
+		{
+			std::cerr << "cannot open " << *iter << std::endl;
+			return -1;
+		}
+		std::string line;
+		long ln = 0;
+		uint64_t id;
+		double ra, dec;
+		float mag;
+		while (std::getline (is, line))
+		{
+			ln++;
+			switch (parseLine (line, id, ra, dec, mag))
+			{
+				case 0:
+					if (pass == 1)
+						writer.count (ra, dec);
+					else if (writer.add (id, ra, dec, mag))
+					{
+						std::cerr << *iter << " changed between passes, line " << ln << std::endl;
+						return -1;
+					}
+					break;
+				case 1:
+					break;
+				default:
+					// report errors only once
+					if (pass == 1)
+						std::cerr << "ignoring invalid line " << *iter << ":" << ln << ": " << line << std::endl;
+			}
+		}
+	}
+	return 0;
+}
+
+int CatConvert::doProcessing ()
+{
+	if (output == NULL || inputs.empty ())
+	{
+		std::cerr << "output file and at least one input file must be specified" << std::endl;
+		return -1;
+	}
+
+	rts2catd::CatFileWriter writer (nside);
+
+	if (processInputs (writer, 1))
+		return -1;
+	if (writer.create (output))
+		return -1;
+	if (processInputs (writer, 2))
+		return -1;
+	if (writer.finish ())
+		return -1;
+
+	std::cout << "written " << writer.getNStars () << " stars to " << output << std::endl;
+	return 0;
+}
+
+int main (int argc, char **argv)
+{
+	CatConvert app (argc, argv);
+	return app.run ();
+}
@@ -1,5 +1,5 @@
 /* 
- * GSC access server.
+ * Catalogue server for preprocessed catalogue files (GSC, UCAC, Gaia subsets, ..).
  * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
  *
  * This program is free software; you can redistribute it and/or
@@ -18,9 +18,17 @@
  */
 
 #include "catd.h"
+#include "catfile.h"
 
 using namespace rts2catd;
 
+/**
+ * Catalogue daemon serving memory mapped catalogue file, created by
+ * rts2-catconvert. Does not need network access, so it can be used for
+ * acquisition and astrometry on isolated sites.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
 class GSC:public Catd
 {
 	public:
@@ -28,23 +36,80 @@ class GSC:public Catd
 		virtual ~GSC (void);
 
 	protected:
+		virtual int processOption (int opt);
+		virtual int initHardware ();
+
 		virtual int searchCataloge (struct ln_equ_posn *c1, struct ln_equ_posn *c2, int num);
+		virtual int coneSearch (struct ln_equ_posn *centre, double radius, int num);
+
+	private:
+		const char *catalogueFile;
+		CatFile catFile;
+
+		rts2core::ValueLong *catalogueSize;
+
+		int returnStars (std::vector <const struct catfile_star *> &stars);
 };
 
-GSC::GSC (int argc, char **argv):Catd (argc, argv)
+GSC::GSC (int argc, char **argv):Catd (argc, argv), catFile ()
 {
+	catalogueFile = NULL;
+
+	createValue (catalogueSize, "catalogue_size", "number of stars in catalogue", false);
 
+	addOption ('f', NULL, 1, "catalogue file (created with rts2-catconvert)");
 }
 
 GSC::~GSC ()
 {
+}
 
+int GSC::processOption (int opt)
+{
+	switch (opt)
+	{
+		case 'f':
+			catalogueFile = optarg;
+			break;
+		default:
+			return Catd::processOption (opt);
+	}
+	return 0;
 }
 
+int GSC::initHardware ()
+{
+	if (catalogueFile == NULL)
+	{
+		logStream (MESSAGE_ERROR) << "catalogue file must be specified with -f option" << sendLog;
+		return -1;
+	}
+	if (catFile.openFile (catalogueFile))
+		return -1;
+	catalogueSize->setValueLong (catFile.getNStars ());
+	logStream (MESSAGE_INFO) << "opened catalogue " << catalogueFile << " with " << catFile.getNStars () << " stars, nside " << catFile.getNside () << sendLog;
+	return 0;
+}
 
 int GSC::searchCataloge (struct ln_equ_posn *c1, struct ln_equ_posn *c2, int num)
 {
-	return 0;
+	std::vector <const struct catfile_star *> stars;
+	catFile.boxSearch (c1, c2, getMagLimit (), num, stars);
+	return returnStars (stars);
+}
+
+int GSC::coneSearch (struct ln_equ_posn *centre, double radius, int num)
+{
+	std::vector <const struct catfile_star *> stars;
+	catFile.coneSearch (centre, radius, getMagLimit (), num, stars);
+	return returnStars (stars);
+}
+
+int GSC::returnStars (std::vector <const struct catfile_star *> &stars)
+{
+	for (std::vector <const struct catfile_star *>::iterator iter = stars.begin (); iter != stars.end (); iter++)
+		addStar ((*iter)->id, (*iter)->ra, (*iter)->dec, (*iter)->mag);
+	return stars.size ();
 }
 
 int main (int argc, char **argv)
@@ -402,6 +402,9 @@ Centrald::Centrald (int argc, char **argv):Daemon (argc, argv, SERVERD_HARD_OFF
 	nextState->addSelVal ("dawn");
 	nextState->addSelVal ("morning");
 
+	createValue (scheduleTimes, "schedule_times", "times of the following state changes", false);
+	createValue (scheduleStates, "schedule_states", "states entered at schedule_times", false);
+
 	createConstValue (observerLng, "longitude", "observatory longitude", false, RTS2_DT_DEGREES);
 	createConstValue (observerLat, "latitude", "observatory latitude", false, RTS2_DT_DEC);
 
@@ -486,6 +489,7 @@ int Centrald::reloadConfig ()
 	openLog ();
 
 	observer = config->getObserver ();
+	ephemeris.setObserver (observer);
 
 	observerLng->setValueDouble (observer->lng);
 	observerLat->setValueDouble (observer->lat);
@@ -577,10 +581,8 @@ int Centrald::initValues ()
 
 	curr_time = time (NULL);
 
-	next_event (observer, &curr_time, &call_state, &next_event_type,
-		&next_event_time, nightHorizon->getValueDouble (),
-		dayHorizon->getValueDouble (), eveningTime->getValueInteger (),
-		morningTime->getValueInteger ());
+	updateEphemeris (curr_time);
+	ephemeris.getState (curr_time, &call_state, &next_event_type, &next_event_time);
 
 	Configuration *config = Configuration::instance ();
 
@@ -694,38 +696,31 @@ int Centrald::changeState (rts2_status_t new_state, const char *user)
 
 int Centrald::info ()
 {
-	struct ln_equ_posn pos, parallax;
 	struct ln_rst_time rst;
 	struct ln_hrz_posn hrz;
-	double JD = ln_get_julian_from_sys ();
+	double now = getNow ();
+
+	updateEphemeris (now);
 
-	ln_get_solar_equ_coords (JD, &pos);
-	ln_get_parallax (&pos, ln_get_earth_solar_dist (JD), observer, 1700, JD, &parallax);
-	pos.ra += parallax.ra;
-	pos.dec += parallax.dec;
-	ln_get_hrz_from_equ (&pos, observer, JD, &hrz);
+	ephemeris.getSun (now, &hrz);
 
 	sunAlt->setValueDouble (hrz.alt);
 	sunAz->setValueDouble (hrz.az);
 
-	ln_get_lunar_equ_coords (JD, &pos);
-	ln_get_parallax (&pos, ln_get_earth_solar_dist (JD), observer, 1700, JD, &parallax);
-	pos.ra += parallax.ra;
-	pos.dec += parallax.dec;
-	ln_get_hrz_from_equ (&pos, observer, JD, &hrz);
+	ephemeris.getMoon (now, &hrz);
 
 	moonAlt->setValueDouble (hrz.alt);
 	moonAz->setValueDouble (hrz.az);
 
-	ln_get_solar_rst (JD, observer, &rst);
+	ephemeris.getSunRst (now, &rst);
 
 	sunRise->setValueDouble (timetFromJD (rst.rise));
 	sunSet->setValueDouble (timetFromJD (rst.set));
 
-	lunarPhase->setValueDouble (ln_get_lunar_phase (JD));
-	lunarLimb->setValueDouble (ln_get_lunar_bright_limb (JD));
+	lunarPhase->setValueDouble (ephemeris.getLunarPhase (now));
+	lunarLimb->setValueDouble (ephemeris.getLunarLimb (now));
 
-	ln_get_lunar_rst (JD, observer, &rst);
+	ephemeris.getMoonRst (now, &rst);
 
 	moonRise->setValueDouble (timetFromJD (rst.rise));
 	moonSet->setValueDouble (timetFromJD (rst.set));
@@ -733,6 +728,25 @@ int Centrald::info ()
 	return Daemon::info ();
 }
 
+void Centrald::updateEphemeris (time_t now)
+{
+	ephemeris.setStateParameters (nightHorizon->getValueDouble (), dayHorizon->getValueDouble (), eveningTime->getValueInteger (), morningTime->getValueInteger ());
+	// publish schedule when it was recalculated, or when the first change passed
+	if (!ephemeris.update (now) && !(scheduleTimes->size () > 0 && (*scheduleTimes)[0] <= now))
+		return;
+
+	std::vector <double> times;
+	std::vector <rts2_status_t> states;
+	ephemeris.getSchedule (now, times, states);
+
+	std::vector <std::string> names;
+	for (std::vector <rts2_status_t>::iterator iter = states.begin (); iter != states.end (); iter++)
+		names.push_back (rts2core::CentralState::getStringShort (*iter));
+
+	scheduleTimes->setValueArray (times);
+	scheduleStates->setValueArray (names);
+}
+
 int Centrald::idle ()
 {
 	time_t curr_time;
@@ -744,10 +758,8 @@ int Centrald::idle ()
 	if (curr_time < next_event_time)
 		return Daemon::idle ();
 
-	next_event (observer, &curr_time, &call_state, &next_event_type,
-		&next_event_time, nightHorizon->getValueDouble (),
-		dayHorizon->getValueDouble (), eveningTime->getValueInteger (),
-		morningTime->getValueInteger ());
+	updateEphemeris (curr_time);
+	ephemeris.getState (curr_time, &call_state, &next_event_type, &next_event_time);
 
 	if (getState () != call_state)
 	{
@@ -21,6 +21,7 @@
 #define __RTS2_CENTRALD__
 
 #include "riseset.h"
+#include "ephemeris.h"
 
 #include <libnova/libnova.h>
 
@@ -238,6 +239,13 @@ class Centrald:public Daemon
 		time_t next_event_time;
 		struct ln_lnlat_posn *observer;
 
+		Ephemeris ephemeris;
+
+		/**
+		 * Make sure ephemeris table covers given time, publish state change schedule.
+		 */
+		void updateEphemeris (time_t now);
+
 		rts2core::ValueBool *morning_off;
 		rts2core::ValueBool *morning_standby;
 
@@ -265,6 +273,8 @@ class Centrald:public Daemon
 
 		rts2core::ValueTime *nextStateChange;
 		rts2core::ValueSelection *nextState;
+		rts2core::TimeArray *scheduleTimes;
+		StringArray *scheduleStates;
 		rts2core::ValueDouble *observerLng;
 		rts2core::ValueDouble *observerLat;
 
@@ -0,0 +1,273 @@
+/*
+ * Cached Sun and Moon ephemerides for centrald.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "ephemeris.h"
+#include "riseset.h"
+
+#include <math.h>
+
+using namespace rts2centrald;
+
+// JD of time_t 0
+#define JD_UNIX_EPOCH    2440587.5
+
+// maximal number of rows calculated in a single update call
+#define ROWS_PER_UPDATE  120
+
+Ephemeris::Ephemeris (double _step, double _length):table (), schedule ()
+{
+	observer = NULL;
+	step = _step;
+	length = _length;
+
+	nightHorizon = NAN;
+	dayHorizon = NAN;
+	eveningTime = 0;
+	morningTime = 0;
+
+	tableStart = NAN;
+	tableEnd = NAN;
+
+	scheduleTime = 0;
+	scheduleNext = 0;
+
+	sunRstDay = NAN;
+	moonRstDay = NAN;
+}
+
+void Ephemeris::setObserver (struct ln_lnlat_posn *_observer)
+{
+	observer = _observer;
+	table.clear ();
+	schedule.clear ();
+	sunRstDay = NAN;
+	moonRstDay = NAN;
+}
+
+void Ephemeris::setStateParameters (double _nightHorizon, double _dayHorizon, int _eveningTime, int _morningTime)
+{
+	if (_nightHorizon == nightHorizon && _dayHorizon == dayHorizon && _eveningTime == eveningTime && _morningTime == morningTime)
+		return;
+	nightHorizon = _nightHorizon;
+	dayHorizon = _dayHorizon;
+	eveningTime = _eveningTime;
+	morningTime = _morningTime;
+	schedule.clear ();
+}
+
+bool Ephemeris::update (time_t now)
+{
+	if (observer == NULL)
+		return false;
+
+	// time jumped outside of the table, start again
+	if (table.empty () || now < tableStart || now > tableEnd)
+	{
+		table.clear ();
+		schedule.clear ();
+		// start one step before now, aligned to step
+		tableStart = floor (now / step) * step - step;
+		tableEnd = tableStart - step;
+	}
+
+	// drop rows which passed, keep one step before now
+	while (table.size () > 2 * COLUMNS && tableStart + step < now - step)
+	{
+		table.erase (table.begin (), table.begin () + COLUMNS);
+		tableStart += step;
+	}
+
+	// usually adds a single row; new table is filled over several calls, so the main loop is not blocked
+	for (int i = 0; i < ROWS_PER_UPDATE && tableEnd < now + length; i++)
+		addRow (tableEnd + step);
+
+	if (schedule.empty ())
+	{
+		fillSchedule ();
+		return true;
+	}
+	return extendSchedule ();
+}
+
+void Ephemeris::getSunRst (double t, struct ln_rst_time *rst)
+{
+	double JD = JD_UNIX_EPOCH + t / 86400.0;
+	double day = floor (JD - 0.5) + 0.5;
+	if (day != sunRstDay)
+	{
+		ln_get_solar_rst (JD, observer, &sunRst);
+		sunRstDay = day;
+	}
+	*rst = sunRst;
+}
+
+void Ephemeris::getMoonRst (double t, struct ln_rst_time *rst)
+{
+	double JD = JD_UNIX_EPOCH + t / 86400.0;
+	double day = floor (JD - 0.5) + 0.5;
+	if (day != moonRstDay)
+	{
+		ln_get_lunar_rst (JD, observer, &moonRst);
+		moonRstDay = day;
+	}
+	*rst = moonRst;
+}
+
+void Ephemeris::getState (time_t t, rts2_status_t *curr_state, rts2_status_t *next_state, time_t *next_time)
+{
+	std::vector <transition>::iterator iter;
+	for (iter = schedule.begin (); iter != schedule.end () && iter->t <= t; iter++)
+		;
+	// time is outside of the table, calculate it
+	if (iter == schedule.begin () || iter == schedule.end ())
+	{
+		next_event (observer, &t, curr_state, next_state, next_time, nightHorizon, dayHorizon, eveningTime, morningTime);
+		return;
+	}
+	*next_state = iter->state;
+	*next_time = iter->t;
+	iter--;
+	*curr_state = iter->state;
+}
+
+void Ephemeris::getSchedule (time_t t, std::vector <double> &times, std::vector <rts2_status_t> &states)
+{
+	times.clear ();
+	states.clear ();
+	for (std::vector <transition>::iterator iter = schedule.begin (); iter != schedule.end (); iter++)
+	{
+		if (iter->t <= t)
+			continue;
+		times.push_back (iter->t);
+		states.push_back (iter->state);
+	}
+}
+
+void Ephemeris::addRow (double t)
+{
+	struct ln_equ_posn pos, parallax;
+	struct ln_hrz_posn hrz;
+	double row[COLUMNS];
+
+	double JD = JD_UNIX_EPOCH + t / 86400.0;
+
+	ln_get_solar_equ_coords (JD, &pos);
+	ln_get_parallax (&pos, ln_get_earth_solar_dist (JD), observer, 1700, JD, &parallax);
+	pos.ra += parallax.ra;
+	pos.dec += parallax.dec;
+	ln_get_hrz_from_equ (&pos, observer, JD, &hrz);
+
+	row[SUN_ALT] = hrz.alt;
+	row[SUN_AZ] = hrz.az;
+
+	ln_get_lunar_equ_coords (JD, &pos);
+	ln_get_parallax (&pos, ln_get_earth_solar_dist (JD), observer, 1700, JD, &parallax);
+	pos.ra += parallax.ra;
+	pos.dec += parallax.dec;
+	ln_get_hrz_from_equ (&pos, observer, JD, &hrz);
+
+	row[MOON_ALT] = hrz.alt;
+	row[MOON_AZ] = hrz.az;
+
+	row[LUNAR_PHASE] = ln_get_lunar_phase (JD);
+	row[LUNAR_LIMB] = ln_get_lunar_bright_limb (JD);
+
+	table.insert (table.end (), row, row + COLUMNS);
+	tableEnd = t;
+}
+
+void Ephemeris::fillSchedule ()
+{
+	schedule.clear ();
+
+	scheduleTime = (time_t) tableStart;
+	rts2_status_t curr, next;
+
+	next_event (observer, &scheduleTime, &curr, &next, &scheduleNext, nightHorizon, dayHorizon, eveningTime, morningTime);
+
+	transition tr;
+	tr.t = scheduleTime;
+	tr.state = curr;
+	schedule.push_back (tr);
+
+	extendSchedule ();
+}
+
+bool Ephemeris::extendSchedule ()
+{
+	bool ret = false;
+	rts2_status_t curr, next;
+	transition tr;
+
+	// the limit protects against loops on places without state changes
+	for (int i = 0; i < 100 && scheduleNext <= tableEnd; i++)
+	{
+		time_t change = scheduleNext;
+		// idle loop calls next_event after the change time, do the same
+		scheduleTime = (scheduleNext > scheduleTime ? scheduleNext : scheduleTime) + 1;
+		next_event (observer, &scheduleTime, &curr, &next, &scheduleNext, nightHorizon, dayHorizon, eveningTime, morningTime);
+		if (curr != schedule.back ().state)
+		{
+			tr.t = change;
+			tr.state = curr;
+			schedule.push_back (tr);
+			ret = true;
+		}
+	}
+
+	// keep the last change before the table start, it marks the current state
+	while (schedule.size () > 1 && schedule[1].t <= tableStart)
+		schedule.erase (schedule.begin ());
+
+	return ret;
+}
+
+void Ephemeris::interpolate (double t, int column, struct ln_hrz_posn *hrz)
+{
+	hrz->alt = interpolate (t, column, false);
+	hrz->az = interpolate (t, column + 1, true);
+}
+
+double Ephemeris::interpolate (double t, int column, bool angle)
+{
+	int n = table.size () / COLUMNS;
+	if (n < 2)
+		return NAN;
+
+	double idx = (t - tableStart) / step;
+	int i = (int) floor (idx);
+	if (i < 0)
+		i = 0;
+	else if (i > n - 2)
+		i = n - 2;
+	double f = idx - i;
+
+	double v0 = table[i * COLUMNS + column];
+	double v1 = table[(i + 1) * COLUMNS + column];
+	if (!angle)
+		return v0 + f * (v1 - v0);
+
+	// shortest way around the circle
+	double d = v1 - v0;
+	if (d > 180)
+		d -= 360;
+	else if (d < -180)
+		d += 360;
+	return ln_range_degrees (v0 + f * d);
+}
@@ -0,0 +1,158 @@
+/*
+ * Cached Sun and Moon ephemerides for centrald.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_CENTRALD_EPHEMERIS__
+#define __RTS2_CENTRALD_EPHEMERIS__
+
+#include "status.h"
+
+#include <libnova/libnova.h>
+#include <time.h>
+#include <deque>
+#include <vector>
+
+namespace rts2centrald
+{
+
+/**
+ * Sun and Moon ephemeris table, and schedule of the system state changes.
+ *
+ * Sun and Moon positions are calculated for the table period (by default
+ * 36 hours ahead) on a fine grid, and values between grid points are
+ * interpolated. Table is moved forward incrementally - rows which passed are
+ * dropped and new rows are calculated as time goes, so the main loop is not
+ * blocked by recalculation of the whole table. Rise and set times are
+ * calculated once per UT day. State changes (day, evening, dusk, night, dawn,
+ * morning) are calculated for the whole table period, and extended together
+ * with the table, so querying the current state does not require any
+ * calculation.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class Ephemeris
+{
+	public:
+		/**
+		 * @param _step    table step in seconds
+		 * @param _length  table length in seconds
+		 */
+		Ephemeris (double _step = 60, double _length = 129600);
+
+		/**
+		 * Set observer. Invalidates the table.
+		 */
+		void setObserver (struct ln_lnlat_posn *_observer);
+
+		/**
+		 * Set parameters of the state calculation. Invalidates the state
+		 * schedule if they changed.
+		 */
+		void setStateParameters (double _nightHorizon, double _dayHorizon, int _eveningTime, int _morningTime);
+
+		/**
+		 * Make sure the table covers given time and table length ahead
+		 * of it. Only missing rows are calculated. New table (at the
+		 * first call, or when time jumped outside of the table) is
+		 * filled over several calls; state outside of the table is
+		 * calculated directly.
+		 *
+		 * @return true if state schedule was changed
+		 */
+		bool update (time_t now);
+
+		void getSun (double t, struct ln_hrz_posn *hrz) { interpolate (t, SUN_ALT, hrz); }
+		void getMoon (double t, struct ln_hrz_posn *hrz) { interpolate (t, MOON_ALT, hrz); }
+
+		double getLunarPhase (double t) { return interpolate (t, LUNAR_PHASE, false); }
+		double getLunarLimb (double t) { return interpolate (t, LUNAR_LIMB, true); }
+
+		/**
+		 * Sun rise and set for the UT day containing t.
+		 */
+		void getSunRst (double t, struct ln_rst_time *rst);
+
+		/**
+		 * Moon rise and set for the UT day containing t.
+		 */
+		void getMoonRst (double t, struct ln_rst_time *rst);
+
+		/**
+		 * Get state at the given time, and the next state change.
+		 *
+		 * @param t           time
+		 * @param curr_state  state at t
+		 * @param next_state  next state
+		 * @param next_time   time of the next state change
+		 */
+		void getState (time_t t, rts2_status_t *curr_state, rts2_status_t *next_state, time_t *next_time);
+
+		/**
+		 * Return state changes after the given time.
+		 */
+		void getSchedule (time_t t, std::vector <double> &times, std::vector <rts2_status_t> &states);
+
+	private:
+		struct ln_lnlat_posn *observer;
+
+		double step;
+		double length;
+
+		double nightHorizon;
+		double dayHorizon;
+		int eveningTime;
+		int morningTime;
+
+		// time of the first and the last table row, as time_t
+		double tableStart;
+		double tableEnd;
+
+		enum { SUN_ALT, SUN_AZ, MOON_ALT, MOON_AZ, LUNAR_PHASE, LUNAR_LIMB, COLUMNS };
+
+		std::deque <double> table;
+
+		struct transition
+		{
+			time_t t;
+			rts2_status_t state;
+		};
+
+		// first transition marks state at the table start
+		std::vector <transition> schedule;
+		// next_event query time and its result, schedule is extended from them
+		time_t scheduleTime;
+		time_t scheduleNext;
+
+		// UT day (JD of its midnight) of cached rise and set times
+		double sunRstDay;
+		struct ln_rst_time sunRst;
+		double moonRstDay;
+		struct ln_rst_time moonRst;
+
+		void addRow (double t);
+		void fillSchedule ();
+		// add state changes up to the table end, drop changes before the table start
+		bool extendSchedule ();
+
+		void interpolate (double t, int column, struct ln_hrz_posn *hrz);
+		double interpolate (double t, int column, bool angle);
+};
+
+}
+
+#endif // !__RTS2_CENTRALD_EPHEMERIS__
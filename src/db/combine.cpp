@@ -0,0 +1,171 @@
+/*
+ * Combines calibration frames to master bias, dark or flat.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2fits/appimage.h"
+#include "rts2fits/calibcombine.h"
+
+#include <strings.h>
+
+#include <iostream>
+#include <iomanip>
+
+#define OPT_MEMORY          OPT_LOCAL + 1
+#define OPT_SIGMA_LOW       OPT_LOCAL + 2
+#define OPT_SIGMA_HIGH      OPT_LOCAL + 3
+
+/**
+ * Combines calibration frames with median or sigma clipped mean. Can be
+ * called from flat and dark processing scripts instead of external tools.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class Combine:public rts2image::AppImageCore
+{
+	public:
+		Combine (int argc, char **argv);
+
+	protected:
+		virtual int processOption (int opt);
+		virtual int init ();
+		virtual int doProcessing ();
+
+		virtual void usage ();
+
+	private:
+		rts2image::CalibCombine combiner;
+
+		const char *outputName;
+		bool overwrite;
+		double sigmaLow;
+		double sigmaHigh;
+};
+
+Combine::Combine (int argc, char **argv):rts2image::AppImageCore (argc, argv, true)
+{
+	outputName = NULL;
+	overwrite = false;
+	sigmaLow = 3;
+	sigmaHigh = 3;
+
+	addOption ('o', NULL, 1, "output (master frame) file");
+	addOption ('f', NULL, 0, "overwrite output file if it exists");
+	addOption ('m', NULL, 1, "combination method - median (default), mean or sigma (sigma clipped mean)");
+	addOption ('n', NULL, 0, "normalize frames to unity median (for flats)");
+	addOption ('i', NULL, 1, "maximal number of sigma clipping iterations (default 5)");
+	addOption ('j', NULL, 1, "number of threads (default number of CPUs)");
+	addOption (OPT_MEMORY, "memory", 1, "memory used for frame strips in MB (default 256)");
+	addOption (OPT_SIGMA_LOW, "sigma-low", 1, "lower rejection limit of sigma clipping (default 3)");
+	addOption (OPT_SIGMA_HIGH, "sigma-high", 1, "upper rejection limit of sigma clipping (default 3)");
+}
+
+int Combine::processOption (int opt)
+{
+	switch (opt)
+	{
+		case 'o':
+			outputName = optarg;
+			break;
+		case 'f':
+			overwrite = true;
+			break;
+		case 'm':
+			if (!strcasecmp (optarg, "median"))
+				combiner.setMethod (rts2image::COMBINE_MEDIAN);
+			else if (!strcasecmp (optarg, "mean"))
+				combiner.setMethod (rts2image::COMBINE_MEAN);
+			else if (!strcasecmp (optarg, "sigma"))
+				combiner.setMethod (rts2image::COMBINE_SIGMA);
+			else
+			{
+				std::cerr << "unknown combination method " << optarg << std::endl;
+				return -1;
+			}
+			break;
+		case 'n':
+			combiner.setNormalize (true);
+			break;
+		case 'i':
+			combiner.setIterations (atoi (optarg));
+			break;
+		case 'j':
+			combiner.setThreads (atoi (optarg));
+			break;
+		case OPT_MEMORY:
+			combiner.setMemoryLimit (atol (optarg) * 1024 * 1024);
+			break;
+		case OPT_SIGMA_LOW:
+			sigmaLow = atof (optarg);
+			break;
+		case OPT_SIGMA_HIGH:
+			sigmaHigh = atof (optarg);
+			break;
+		default:
+			return rts2image::AppImageCore::processOption (opt);
+	}
+	return 0;
+}
+
+int Combine::init ()
+{
+	int ret = rts2image::AppImageCore::init ();
+	if (ret)
+		return ret;
+
+	if (outputName == NULL)
+	{
+		std::cerr << "output file must be specified with -o option" << std::endl;
+		return -1;
+	}
+	if (imageNames.empty ())
+	{
+		std::cerr << "no frames to combine" << std::endl;
+		return -1;
+	}
+	combiner.setSigma (sigmaLow, sigmaHigh);
+	return 0;
+}
+
+void Combine::usage ()
+{
+	std::cout << "\t" << getAppName () << " -o master_bias.fits bias*.fits" << std::endl
+		<< "\t" << getAppName () << " -n -m sigma -o master_flat.fits flat*.fits" << std::endl;
+}
+
+int Combine::doProcessing ()
+{
+	for (std::list <const char *>::iterator iter = imageNames.begin (); iter != imageNames.end (); iter++)
+	{
+		if (combiner.addFrame (*iter))
+			return -1;
+	}
+
+	if (combiner.combine (outputName, overwrite))
+		return -1;
+
+	std::cout << "combined " << combiner.getFramesNum () << " frames " << combiner.getWidth () << "x" << combiner.getHeight ()
+		<< " to " << outputName << " in " << std::fixed << std::setprecision (2) << combiner.getCombineTime () << " s" << std::endl;
+	std::cout.unsetf (std::ios_base::floatfield);
+	return 0;
+}
+
+int main (int argc, char **argv)
+{
+	Combine app (argc, argv);
+	return app.run ();
+}
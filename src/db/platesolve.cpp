@@ -0,0 +1,178 @@
+/*
+ * Solves images with native plate solver.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2fits/appimage.h"
+#include "rts2fits/platesolver.h"
+#include "catfile.h"
+#include "libnova_cpp.h"
+#include "utilsfunc.h"
+
+#include <iostream>
+#include <iomanip>
+
+#define OPT_SEARCH_RADIUS   OPT_LOCAL + 1
+#define OPT_MAG_LIMIT       OPT_LOCAL + 2
+
+/**
+ * Solves images with native plate solver, prints solution and offsets of
+ * telescope position from it. Offsets can be used as input for pointing
+ * model fitting.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class PlateSolve:public rts2image::AppImageCore
+{
+	public:
+		PlateSolve (int argc, char **argv);
+
+	protected:
+		virtual int processOption (int opt);
+		virtual int init ();
+		virtual int processImage (rts2image::Image *image);
+
+		virtual void usage ();
+
+	private:
+		rts2catd::CatFile catalogue;
+		rts2image::PlateSolver solver;
+
+		const char *catalogueName;
+		double scale;
+		double scaleTolerance;
+};
+
+PlateSolve::PlateSolve (int argc, char **argv):rts2image::AppImageCore (argc, argv, true), solver (&catalogue)
+{
+	catalogueName = NULL;
+	scale = NAN;
+	scaleTolerance = 0.05;
+
+	addOption ('c', NULL, 1, "catalogue file");
+	addOption ('s', NULL, 1, "pixel scale in arcsec/pixel (default from CDELT1 keyword)");
+	addOption ('t', NULL, 1, "relative tolerance of the pixel scale (default 0.05)");
+	addOption ('n', NULL, 1, "minimal number of matched stars (default 8)");
+	addOption ('j', NULL, 1, "number of threads (default number of CPUs)");
+	addOption ('w', NULL, 0, "write WCS and astrometry results to the image");
+	addOption (OPT_SEARCH_RADIUS, "search-radius", 1, "maximal distance of field centre from telescope position in degrees (default 0.5)");
+	addOption (OPT_MAG_LIMIT, "mag-limit", 1, "faintest catalogue magnitude");
+}
+
+int PlateSolve::processOption (int opt)
+{
+	switch (opt)
+	{
+		case 'c':
+			catalogueName = optarg;
+			break;
+		case 's':
+			scale = atof (optarg);
+			break;
+		case 't':
+			scaleTolerance = atof (optarg);
+			break;
+		case 'n':
+			solver.setMinMatches (atoi (optarg));
+			break;
+		case 'j':
+			solver.setThreads (atoi (optarg));
+			break;
+		case 'w':
+			readOnly = false;
+			break;
+		case OPT_SEARCH_RADIUS:
+			solver.setSearchRadius (atof (optarg));
+			break;
+		case OPT_MAG_LIMIT:
+			solver.setMagLimit (atof (optarg));
+			break;
+		default:
+			return rts2image::AppImageCore::processOption (opt);
+	}
+	return 0;
+}
+
+int PlateSolve::init ()
+{
+	int ret = rts2image::AppImageCore::init ();
+	if (ret)
+		return ret;
+
+	if (catalogueName == NULL)
+	{
+		std::cerr << "catalogue file must be specified with -c option" << std::endl;
+		return -1;
+	}
+	if (catalogue.openFile (catalogueName))
+	{
+		std::cerr << "cannot open catalogue " << catalogueName << std::endl;
+		return -1;
+	}
+	return 0;
+}
+
+void PlateSolve::usage ()
+{
+	std::cout << "\t" << getAppName () << " -c stars.cat -s 1.2 image.fits" << std::endl
+		<< "\t" << getAppName () << " -c stars.cat -w *.fits" << std::endl;
+}
+
+int PlateSolve::processImage (rts2image::Image *image)
+{
+	rts2image::plateSolution sol;
+	// scale from image header is used if it is not specified
+	solver.setScale (scale, scaleTolerance);
+
+	double t = getNow ();
+	if (image->solveAstrometry (solver, sol, 0, !readOnly))
+	{
+		std::cout << image->getFileName () << " not solved" << std::endl;
+		return 0;
+	}
+	t = getNow () - t;
+
+	std::cout << image->getFileName () << " " << LibnovaRaDec (sol.crval.ra, sol.crval.dec)
+		<< std::fixed << std::setprecision (3)
+		<< " scale " << sol.scale << " rotation " << sol.rotation << (sol.flip ? " flipped" : "")
+		<< " matched " << sol.matched << std::setprecision (2) << " RMS " << sol.rms << "\"";
+
+	try
+	{
+		struct ln_equ_posn tel;
+		image->getCoordMount (tel);
+		double dra = tel.ra - sol.crval.ra;
+		if (dra > 180)
+			dra -= 360;
+		else if (dra < -180)
+			dra += 360;
+		std::cout << " offset " << LibnovaDegDist (cos (ln_deg_to_rad (tel.dec)) * dra) << " " << LibnovaDegDist (tel.dec - sol.crval.dec);
+	}
+	catch (rts2core::Error &er)
+	{
+	}
+
+	std::cout << std::setprecision (3) << " time " << t << " s" << std::endl;
+	std::cout.unsetf (std::ios_base::floatfield);
+	return 0;
+}
+
+int main (int argc, char **argv)
+{
+	PlateSolve app (argc, argv);
+	return app.run ();
+}
@@ -0,0 +1,342 @@
+/*
+ * Benchmark of native source extractor against SExtractor catalogues.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "rts2fits/appimage.h"
+#include "rts2fits/sourceextractor.h"
+#include "utilsfunc.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <time.h>
+#include <unistd.h>
+
+#define OPT_MESH       OPT_LOCAL + 1
+#define OPT_NOFILTER   OPT_LOCAL + 2
+#define OPT_SATURATION OPT_LOCAL + 3
+
+/**
+ * Runs native source extractor on images and compares results with
+ * SExtractor catalogue. The catalogue must be in ASCII_HEAD format and
+ * contain X_IMAGE and Y_IMAGE columns. FWHM_IMAGE and FLUX_APER or
+ * FLUX_AUTO columns are compared if present.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class SourceBench:public rts2image::AppImageCore
+{
+	public:
+		SourceBench (int argc, char **argv);
+
+	protected:
+		virtual int processOption (int opt);
+		virtual int processImage (rts2image::Image *image);
+
+		virtual void usage ();
+
+	private:
+		rts2image::SourceExtractor extractor;
+
+		const char *catalogue;
+		int repeat;
+		double radius;
+		bool print;
+
+		/**
+		 * Load SExtractor catalogue.
+		 *
+		 * @return -1 on error, 0 on success
+		 */
+		int loadCatalogue (const char *fn, std::vector <rts2image::stardata> &cat);
+
+		void compare (std::vector <rts2image::stardata> &sources, std::vector <rts2image::stardata> &cat);
+};
+
+static double median (std::vector <double> &v)
+{
+	if (v.empty ())
+		return NAN;
+	std::nth_element (v.begin (), v.begin () + v.size () / 2, v.end ());
+	return v[v.size () / 2];
+}
+
+SourceBench::SourceBench (int argc, char **argv):rts2image::AppImageCore (argc, argv, true)
+{
+	catalogue = NULL;
+	repeat = 1;
+	radius = 1.5;
+	print = false;
+
+	addOption ('c', NULL, 1, "SExtractor catalogue (defaults to image name with .cat extension)");
+	addOption ('t', NULL, 1, "detection threshold in background RMS (default 1.5)");
+	addOption ('m', NULL, 1, "minimal source area in pixels (default 5)");
+	addOption ('a', NULL, 1, "aperture radius in pixels (default 5)");
+	addOption ('g', NULL, 1, "detector gain in e-/ADU (default 0 - ignore source noise)");
+	addOption ('j', NULL, 1, "number of threads (default number of CPUs)");
+	addOption ('n', NULL, 1, "number of extraction runs used for timing (default 1)");
+	addOption ('r', NULL, 1, "matching radius in pixels (default 1.5)");
+	addOption ('p', NULL, 0, "print detected sources");
+	addOption (OPT_MESH, "mesh", 1, "background mesh size in pixels (default 64)");
+	addOption (OPT_NOFILTER, "no-filter", 0, "do not filter image before thresholding");
+	addOption (OPT_SATURATION, "saturation", 1, "saturation level");
+}
+
+int SourceBench::processOption (int opt)
+{
+	switch (opt)
+	{
+		case 'c':
+			catalogue = optarg;
+			break;
+		case 't':
+			extractor.setThreshold (atof (optarg));
+			break;
+		case 'm':
+			extractor.setMinArea (atoi (optarg));
+			break;
+		case 'a':
+			extractor.setAperture (atof (optarg));
+			break;
+		case 'g':
+			extractor.setGain (atof (optarg));
+			break;
+		case 'j':
+			extractor.setThreads (atoi (optarg));
+			break;
+		case 'n':
+			repeat = atoi (optarg);
+			if (repeat < 1)
+				repeat = 1;
+			break;
+		case 'r':
+			radius = atof (optarg);
+			break;
+		case 'p':
+			print = true;
+			break;
+		case OPT_MESH:
+			extractor.setMeshSize (atoi (optarg));
+			break;
+		case OPT_NOFILTER:
+			extractor.setFilter (false);
+			break;
+		case OPT_SATURATION:
+			extractor.setSaturation (atof (optarg));
+			break;
+		default:
+			return rts2image::AppImageCore::processOption (opt);
+	}
+	return 0;
+}
+
+void SourceBench::usage ()
+{
+	std::cout << "\t" << getAppName () << " -c image.cat image.fits" << std::endl
+		<< "\t" << getAppName () << " -n 10 -j 4 *.fits" << std::endl;
+}
+
+int SourceBench::loadCatalogue (const char *fn, std::vector <rts2image::stardata> &cat)
+{
+	std::ifstream is (fn);
+	if (!is.good ())
+	{
+		std::cerr << "cannot open catalogue " << fn << std::endl;
+		return -1;
+	}
+
+	int cx = -1, cy = -1, cfwhm = -1, cflux = -1, cfluxauto = -1, cflags = -1;
+	std::string line;
+	while (std::getline (is, line))
+	{
+		if (line.empty ())
+			continue;
+		std::istringstream ls (line);
+		if (line[0] == '#')
+		{
+			std::string hash, name;
+			int col;
+			ls >> hash >> col >> name;
+			if (ls.fail ())
+				continue;
+			col--;
+			if (name == "X_IMAGE")
+				cx = col;
+			else if (name == "Y_IMAGE")
+				cy = col;
+			else if (name == "FWHM_IMAGE")
+				cfwhm = col;
+			else if (name == "FLUX_APER")
+				cflux = col;
+			else if (name == "FLUX_AUTO")
+				cfluxauto = col;
+			else if (name == "FLAGS")
+				cflags = col;
+			continue;
+		}
+		if (cx < 0 || cy < 0)
+		{
+			std::cerr << "catalogue " << fn << " does not contain X_IMAGE and Y_IMAGE columns" << std::endl;
+			return -1;
+		}
+		if (cflux < 0)
+			cflux = cfluxauto;
+
+		std::vector <double> vals;
+		double v;
+		while (ls >> v)
+			vals.push_back (v);
+
+		int maxc = std::max (std::max (cx, cy), std::max (std::max (cfwhm, cflux), cflags));
+		if ((int) vals.size () <= maxc)
+		{
+			std::cerr << "invalid catalogue line: " << line << std::endl;
+			return -1;
+		}
+
+		rts2image::stardata sd;
+		sd.X = vals[cx];
+		sd.Y = vals[cy];
+		sd.fwhm = cfwhm >= 0 ? vals[cfwhm] : NAN;
+		sd.F = cflux >= 0 ? vals[cflux] : NAN;
+		sd.Fe = NAN;
+		sd.flags = cflags >= 0 ? (int) vals[cflags] : 0;
+		cat.push_back (sd);
+	}
+	return 0;
+}
+
+void SourceBench::compare (std::vector <rts2image::stardata> &sources, std::vector <rts2image::stardata> &cat)
+{
+	std::vector <bool> used (sources.size (), false);
+	std::vector <double> offsets, fwhmRatios, fluxRatios;
+	size_t matched = 0;
+
+	for (std::vector <rts2image::stardata>::iterator ci = cat.begin (); ci != cat.end (); ci++)
+	{
+		double best = radius * radius;
+		int bi = -1;
+		for (size_t i = 0; i < sources.size (); i++)
+		{
+			if (used[i])
+				continue;
+			double dx = sources[i].X - ci->X;
+			double dy = sources[i].Y - ci->Y;
+			if (dx * dx + dy * dy < best)
+			{
+				best = dx * dx + dy * dy;
+				bi = i;
+			}
+		}
+		if (bi < 0)
+			continue;
+		used[bi] = true;
+		matched++;
+		offsets.push_back (sqrt (best));
+		if (ci->flags == 0 && sources[bi].flags == 0)
+		{
+			if (!isnan (ci->fwhm) && ci->fwhm > 0)
+				fwhmRatios.push_back (sources[bi].fwhm / ci->fwhm);
+			if (!isnan (ci->F) && ci->F > 0)
+				fluxRatios.push_back (sources[bi].F / ci->F);
+		}
+	}
+
+	std::cout << "  SExtractor " << cat.size () << " matched " << matched
+		<< std::fixed << std::setprecision (1)
+		<< " (" << (cat.empty () ? 0 : 100.0 * matched / cat.size ()) << "% of SExtractor, "
+		<< (sources.empty () ? 0 : 100.0 * matched / sources.size ()) << "% of native)" << std::endl
+		<< std::setprecision (3)
+		<< "  median offset " << median (offsets) << " px, FWHM ratio " << median (fwhmRatios)
+		<< ", flux ratio " << median (fluxRatios) << std::endl;
+	std::cout.unsetf (std::ios_base::floatfield);
+}
+
+int SourceBench::processImage (rts2image::Image *image)
+{
+	const void *data = image->getChannelData (0);
+	if (data == NULL)
+	{
+		std::cerr << "cannot read data of " << image->getFileName () << std::endl;
+		return -1;
+	}
+
+	std::vector <rts2image::stardata> sources;
+	double wall = 0;
+	clock_t c = clock ();
+	for (int i = 0; i < repeat; i++)
+	{
+		sources.clear ();
+		double t = getNow ();
+		if (extractor.extract (data, image->getDataType (), image->getChannelWidth (0), image->getChannelHeight (0), sources) < 0)
+		{
+			std::cerr << "unsupported data type " << image->getDataType () << " of " << image->getFileName () << std::endl;
+			return -1;
+		}
+		wall += getNow () - t;
+	}
+	double cpu = ((double) (clock () - c)) / CLOCKS_PER_SEC;
+
+	std::cout << image->getFileName () << " " << image->getChannelWidth (0) << "x" << image->getChannelHeight (0)
+		<< " sources " << sources.size () << std::fixed << std::setprecision (1)
+		<< " background " << extractor.getBackground () << " rms " << extractor.getBackgroundRms ()
+		<< std::setprecision (2) << " wall " << 1000 * wall / repeat << " ms cpu " << 1000 * cpu / repeat << " ms" << std::endl;
+	std::cout.unsetf (std::ios_base::floatfield);
+
+	if (print)
+	{
+		for (std::vector <rts2image::stardata>::iterator iter = sources.begin (); iter != sources.end (); iter++)
+			std::cout << std::fixed << std::setprecision (3) << std::setw (10) << iter->X << " " << std::setw (10) << iter->Y
+				<< " " << std::setw (12) << iter->F << " " << std::setw (10) << iter->Fe << " " << std::setw (7) << iter->fwhm
+				<< " " << iter->flags << std::endl;
+		std::cout.unsetf (std::ios_base::floatfield);
+	}
+
+	std::string catName;
+	if (catalogue)
+	{
+		catName = catalogue;
+	}
+	else
+	{
+		catName = image->getFileName ();
+		size_t dot = catName.rfind ('.');
+		if (dot != std::string::npos && catName.find ('/', dot) == std::string::npos)
+			catName = catName.substr (0, dot);
+		catName += ".cat";
+		// catalogue is optional if its name is not specified
+		if (access (catName.c_str (), R_OK))
+			return 0;
+	}
+
+	std::vector <rts2image::stardata> cat;
+	if (loadCatalogue (catName.c_str (), cat))
+		return -1;
+	compare (sources, cat);
+	return 0;
+}
+
+int main (int argc, char **argv)
+{
+	SourceBench app (argc, argv);
+	return app.run ();
+}
@@ -41,6 +41,7 @@
 #define OPT_NOSYNC          OPT_LOCAL + 53
 #define OPT_DARK            OPT_LOCAL + 54
 #define OPT_IGNORE_BLOCK    OPT_LOCAL + 55
+#define OPT_SOURCES         OPT_LOCAL + 56
 
 #define CHECK_TIMER         0.1
 
@@ -137,6 +138,7 @@ FocusClient::FocusClient (int in_argc, char **in_argv):rts2core::Client (in_argc
 	darks = false;
 
 	focExe = NULL;
+	sources = false;
 
 	printStateChanges = false;
 
@@ -168,6 +170,7 @@ FocusClient::FocusClient (int in_argc, char **in_argv):rts2core::Client (in_argc
 	addOption ('W', NULL, 1, "image width");
 	addOption ('H', NULL, 1, "image height");
 	addOption ('F', NULL, 1, "image processing script (default to NULL - no image processing will be done");
+	addOption (OPT_SOURCES, "sources", 0, "detect sources on images and report their FWHM");
 	addOption ('o', NULL, 1, "save results to given file");
 	addOption (OPT_PHOTOMETER_TIME, "photometer_time", 1, "photometer integration time (in seconds); default to 1 second");
 	addOption (OPT_CHANGE_FILTER, "change_filter", 1, "change filter on photometer after taking n counts; default to 0 (don't change)");
@@ -228,6 +231,9 @@ int FocusClient::processOption (int in_opt)
 		case 'c':
 			defCenter = 1;
 			break;
+		case OPT_SOURCES:
+			sources = true;
+			break;
 		case 'F':
 			focExe = optarg;
 			break;
@@ -258,6 +264,7 @@ FocusCameraClient *FocusClient::initFocCamera (FocusCameraClient * cam)
 {
 	std::vector < char *>::iterator cam_iter;
 	cam->setSaveImage (autoSave || focExe);
+	cam->setExtractSources (sources);
 	if (defCenter)
 	{
 		cam->center (imageWidth, imageHeight);
@@ -61,6 +61,9 @@ class FocusClient:public rts2core::Client
 
 		char *focExe;
 
+		// detect sources with native source extractor
+		bool sources;
+
 		virtual FocusCameraClient *createFocCamera (rts2core::Connection * conn);
 		FocusCameraClient *initFocCamera (FocusCameraClient * cam);
 
@@ -25,6 +25,12 @@
 #include "grbconst.h"
 #include "grbd.h"
 
+#include "connection/fork.h"
+
+#include <list>
+#include <map>
+#include <sys/time.h>
+
 namespace rts2grbd
 {
 
@@ -33,6 +39,12 @@ class Grbd;
 /**
  * GCN sokcet connection.
  *
+ * Follow-up decision is made from GRB state cached in memory. Only target
+ * and GRB records, which executor needs to load the target, are written
+ * before executor is notified, in a single transaction. Raw GCN packets
+ * and add-exec scripts are processed after the executor was notified, from
+ * EVENT_GRB_PERSIST timer.
+ *
  * @author Petr Kubanek <petr@kubanek.net>
  */
 class ConnGrb:public rts2core::ConnNoSend
@@ -62,6 +74,46 @@ class ConnGrb:public rts2core::ConnNoSend
 		void setGbmRecordAboveError (bool _record) { gbm_record_above = _record; }
 		void setGbmEnabledAboveError (bool _enabled) { gbm_enable_above = _enabled; }
 
+		/**
+		 * Load recent GRBs into cache. GRBs received in last grbCacheDays
+		 * days are cached; older GRBs are looked up in the database.
+		 */
+		void loadGrbCache ();
+
+		/**
+		 * Write pending raw GCN packets to the database and run pending
+		 * add-exec scripts. Also loads GRB cache and retrieves next
+		 * target ID, if those are not available.
+		 *
+		 * @return number of raw packets written to the database
+		 */
+		int persistPending ();
+
+		/**
+		 * Time when the last packet was received.
+		 */
+		double stageReceived () { return last_packet.tv_sec == 0 ? NAN : last_packet.tv_sec + (double) last_packet.tv_usec / USEC_SEC; }
+
+		/**
+		 * Time when follow-up decision was made for the last GRB.
+		 */
+		double stageDecided () { return stage_decided; }
+
+		/**
+		 * Time when executor was notified about the last GRB.
+		 */
+		double stageNotified () { return stage_notified; }
+
+		/**
+		 * Time when the last raw packets were commited to the database.
+		 */
+		double stageCommitted () { return stage_committed; }
+
+		/**
+		 * Time from reception of the packet to executor notification for the last GRB.
+		 */
+		double notifyLatency () { return notify_latency; }
+
 	private:
 		Grbd * master;
 		// path to exec when we get new burst; pass parameters on command line
@@ -132,8 +184,56 @@ class ConnGrb:public rts2core::ConnNoSend
 		// was cause of GRB060929 and most probably others).
 		// Return -1 on error, 1 when insertOnly flag is true and it's update packet
 		int addGcnPoint (int grb_id, int grb_seqn, int grb_type, double grb_ra, double grb_dec, bool grb_is_grb, time_t * grb_date, long grb_date_usec, float grb_errorbox, bool insertOnly, bool enabled);
+		// queue raw packet for writing to the database
 		int addGcnRaw (int grb_id, int grb_seqn, int grb_type);
 
+		/**
+		 * Cached GRB state, holds what is needed to decide on the GRB follow-up.
+		 */
+		struct GrbState
+		{
+			int tar_id;
+			// NAN if not known
+			float errorbox;
+			bool is_grb;
+		};
+
+		// GRBs indexed by GRB ID and start of the type range (see getGrbBound)
+		std::map <std::pair <int, int>, GrbState> grbCache;
+		bool grbCacheLoaded;
+		// cache holds all GRBs with date after that time
+		time_t grbCacheFrom;
+		int grbCacheDays;
+
+		// find GRB in cache or database, returns NULL if GRB is not known
+		GrbState *findGrbState (int grb_id, int grb_type_start, int grb_type_end, time_t grb_date);
+		GrbState *addGrbState (int grb_id, int grb_type_start, int tar_id, float errorbox, bool is_grb);
+
+		// target ID for the next GRB, retrieved in advance; -1 if not available
+		int nextTarId;
+		void prefetchTarId ();
+
+		struct RawPacket
+		{
+			int grb_id;
+			int grb_seqn;
+			int grb_type;
+			int32_t packet[SIZ_PKT];
+			struct timeval received;
+		};
+
+		std::list <RawPacket> pendingRaw;
+		std::list <rts2core::ConnFork *> pendingExe;
+		bool persistScheduled;
+
+		void schedulePersist ();
+		void writeGcnRaw (RawPacket &raw);
+
+		double stage_decided;
+		double stage_notified;
+		double stage_committed;
+		double notify_latency;
+
 		int gcn_port;
 		char *gcn_hostname;
 		rts2core::ValueBool *do_hete_test;
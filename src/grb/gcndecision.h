@@ -0,0 +1,106 @@
+/*
+ * Decisions on GCN notices of known GRBs.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef __RTS2_GCNDECISION__
+#define __RTS2_GCNDECISION__
+
+#include "grbconst.h"
+
+#include <math.h>
+
+namespace rts2grbd
+{
+
+/**
+ * What GCN notice changes, decided from cached GRB state before database
+ * is touched.
+ */
+struct GcnDecision
+{
+	bool updateTarget;
+	bool updateGrb;
+	bool updateIsGrb;
+	// errorbox of this notice, NAN if notice was ignored or does not contain errorbox
+	float noticeErrorbox;
+	// errorbox stored after the notice, NAN if not known
+	float storedErrorbox;
+};
+
+/**
+ * Decide GCN notice of the GRB. Target is updated only when new position
+ * is better than the stored one, HETE retraction notices with -999
+ * coordinates are ignored.
+ *
+ * @param known           true if GRB is already known
+ * @param errorbox        stored GRB errorbox, NAN if not known
+ * @param is_grb          stored GRB flag
+ * @param containsPos     true if notice type holds GRB position
+ * @param grb_ra          notice RA
+ * @param grb_dec         notice DEC
+ * @param grb_is_grb      notice GRB flag
+ * @param grb_errorbox    notice errorbox, NAN if not known
+ */
+inline GcnDecision decideGcn (bool known, float errorbox, bool is_grb, bool containsPos, double grb_ra, double grb_dec, bool grb_is_grb, float grb_errorbox)
+{
+	GcnDecision d;
+	if (!known)
+	{
+		d.updateTarget = false;
+		d.updateGrb = false;
+		d.updateIsGrb = false;
+		d.noticeErrorbox = grb_errorbox;
+		d.storedErrorbox = grb_errorbox;
+		return d;
+	}
+
+	d.updateTarget = (isnan (errorbox) || isnan (grb_errorbox) || grb_errorbox <= errorbox)
+		&& grb_ra > -300 && grb_dec > -300;
+	d.updateGrb = d.updateTarget && containsPos && !isnan (grb_errorbox)
+		&& (isnan (errorbox) || grb_errorbox <= errorbox);
+	d.updateIsGrb = !d.updateTarget && grb_is_grb != is_grb;
+
+	d.storedErrorbox = d.updateGrb ? grb_errorbox : errorbox;
+	// ignored notice does not bring any errorbox
+	d.noticeErrorbox = d.updateTarget ? d.storedErrorbox : NAN;
+	return d;
+}
+
+/**
+ * Decide if executor is notified about GCN notice. GBM GRBs are followed
+ * only with errorbox below the limit. Without execFollowups, Swift notices
+ * which did not bring errorbox are only recorded.
+ *
+ * @param d                decision of the notice
+ * @param grb_type_start   start of notice type range
+ * @param grb_id           GRB ID
+ * @param gbm_error        GBM errorbox limit, <= 0 for no limit
+ * @param execFollowups    if follow-up notices should be executed
+ */
+inline bool followGcn (const GcnDecision &d, int grb_type_start, int grb_id, double gbm_error, bool execFollowups)
+{
+	if (grb_type_start == TYPE_FERMI_GBM_ALERT && gbm_error > 0 && d.storedErrorbox > gbm_error)
+		return false;
+	if (!execFollowups && grb_type_start == TYPE_SWIFT_BAT_GRB_ALERT_SRC && grb_id < 100000 && isnan (d.noticeErrorbox))
+		return false;
+	return true;
+}
+
+}
+
+#endif // !__RTS2_GCNDECISION__
@@ -0,0 +1,426 @@
+/*
+ * Replay recorded GCN packets.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "app.h"
+#include "utilsfunc.h"
+#include "grbconst.h"
+
+#include <errno.h>
+#include <netdb.h>
+#include <poll.h>
+#include <math.h>
+#include <arpa/inet.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+// how long to wait for packet echo
+#define ECHO_TIMEOUT        5
+// send imalive packet when there is nothing to send for that time
+#define IMALIVE_INTERVAL    60
+
+struct RecordedPacket
+{
+	double received;
+	int32_t packet[SIZ_PKT];
+};
+
+/**
+ * Replay recorded GCN packets to rts2-grbd, so GRB processing can be
+ * tested and its latency measured. Acts as GCN server - either listens
+ * for grbd connection, or connects to grbd started with --gcn-host -.
+ *
+ * Packets are read from a text file. Each line holds packet reception time
+ * (seconds since 1970, with fraction), followed by 40 packet numbers. Such file can
+ * be exported from grb_gcn table with:
+ *
+ * psql -A -t -F ' ' -c "SELECT extract (epoch FROM grb_update) + grb_update_usec / 1000000.0, array_to_string (packet, ' ') FROM grb_gcn ORDER BY grb_update, grb_update_usec" stars
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class GcnReplay:public rts2core::App
+{
+	public:
+		GcnReplay (int argc, char **argv);
+		virtual ~GcnReplay ();
+
+		virtual int run ();
+
+	protected:
+		virtual int processOption (int opt);
+		virtual int processArgs (const char *arg);
+		virtual void usage ();
+
+	private:
+		const char *host;
+		int port;
+		double interval;
+		double speedup;
+		const char *fileName;
+
+		std::vector <RecordedPacket> packets;
+
+		int sock;
+		uint32_t serial;
+
+		int loadPackets ();
+		int openConnection ();
+
+		int sendPacket (int32_t *packet);
+		// returns echo roundtrip in seconds, NAN if echo was not received
+		double waitEcho (int32_t *packet);
+		int sendImalive ();
+
+		// wait till given time, sending imalive packets
+		int waitTill (double t);
+};
+
+GcnReplay::GcnReplay (int argc, char **argv):rts2core::App (argc, argv), packets ()
+{
+	host = NULL;
+	port = 5348;
+	interval = NAN;
+	speedup = 1;
+	fileName = NULL;
+
+	sock = -1;
+	serial = 1;
+
+	addOption ('s', NULL, 1, "connect to grbd running on that host (grbd must be started with --gcn-host -); default is to listen for grbd connection");
+	addOption ('p', NULL, 1, "port (default 5348)");
+	addOption ('i', NULL, 1, "send packets with that interval (in seconds); default is to keep recorded spacing");
+	addOption ('x', NULL, 1, "speed up recorded spacing by that factor");
+}
+
+GcnReplay::~GcnReplay ()
+{
+	if (sock >= 0)
+		close (sock);
+}
+
+int GcnReplay::processOption (int opt)
+{
+	switch (opt)
+	{
+		case 's':
+			host = optarg;
+			break;
+		case 'p':
+			port = atoi (optarg);
+			break;
+		case 'i':
+			interval = atof (optarg);
+			break;
+		case 'x':
+			speedup = atof (optarg);
+			if (speedup <= 0)
+			{
+				std::cerr << "speed up factor must be positive" << std::endl;
+				return -1;
+			}
+			break;
+		default:
+			return rts2core::App::processOption (opt);
+	}
+	return 0;
+}
+
+int GcnReplay::processArgs (const char *arg)
+{
+	if (fileName)
+		return -1;
+	fileName = arg;
+	return 0;
+}
+
+void GcnReplay::usage ()
+{
+	std::cout << "\t" << getAppName () << " -p 5348 packets.txt" << std::endl
+		<< "  listen on port 5348, when grbd connects, replay packets from packets.txt with recorded spacing" << std::endl
+		<< "\t" << getAppName () << " -s localhost -p 5348 -i 2 packets.txt" << std::endl
+		<< "  connect to grbd listening on port 5348, send packets every 2 seconds" << std::endl;
+}
+
+int GcnReplay::loadPackets ()
+{
+	std::ifstream is (fileName);
+	if (is.fail ())
+	{
+		std::cerr << "cannot open " << fileName << ": " << strerror (errno) << std::endl;
+		return -1;
+	}
+	std::string line;
+	int ln = 0;
+	while (std::getline (is, line))
+	{
+		ln++;
+		if (line.length () == 0 || line[0] == '#')
+			continue;
+		std::istringstream ls (line);
+		RecordedPacket rp;
+		ls >> rp.received;
+		for (int i = 0; i < SIZ_PKT; i++)
+		{
+			long v;
+			ls >> v;
+			rp.packet[i] = v;
+		}
+		if (ls.fail ())
+		{
+			std::cerr << "invalid packet on line " << ln << " of " << fileName << std::endl;
+			return -1;
+		}
+		packets.push_back (rp);
+	}
+	return 0;
+}
+
+int GcnReplay::openConnection ()
+{
+	if (host)
+	{
+		struct addrinfo hints;
+		struct addrinfo *info;
+
+		memset (&hints, 0, sizeof (hints));
+		hints.ai_family = PF_INET;
+		hints.ai_socktype = SOCK_STREAM;
+		std::ostringstream _os;
+		_os << port;
+		int ret = getaddrinfo (host, _os.str ().c_str (), &hints, &info);
+		if (ret)
+		{
+			std::cerr << "cannot resolve " << host << ": " << gai_strerror (ret) << std::endl;
+			return -1;
+		}
+		sock = socket (info->ai_family, info->ai_socktype, info->ai_protocol);
+		if (sock == -1)
+		{
+			freeaddrinfo (info);
+			std::cerr << "cannot create socket: " << strerror (errno) << std::endl;
+			return -1;
+		}
+		ret = connect (sock, info->ai_addr, info->ai_addrlen);
+		freeaddrinfo (info);
+		if (ret)
+		{
+			std::cerr << "cannot connect to " << host << ":" << port << ": " << strerror (errno) << std::endl;
+			return -1;
+		}
+		return 0;
+	}
+
+	int listen_sock = socket (PF_INET, SOCK_STREAM, 0);
+	if (listen_sock == -1)
+	{
+		std::cerr << "cannot create socket: " << strerror (errno) << std::endl;
+		return -1;
+	}
+	const int so_reuseaddr = 1;
+	setsockopt (listen_sock, SOL_SOCKET, SO_REUSEADDR, &so_reuseaddr, sizeof (so_reuseaddr));
+	struct sockaddr_in server;
+	server.sin_family = AF_INET;
+	server.sin_port = htons (port);
+	server.sin_addr.s_addr = htonl (INADDR_ANY);
+	if (bind (listen_sock, (struct sockaddr *) &server, sizeof (server)) || listen (listen_sock, 1))
+	{
+		std::cerr << "cannot listen on port " << port << ": " << strerror (errno) << std::endl;
+		close (listen_sock);
+		return -1;
+	}
+	std::cout << "waiting for grbd connection on port " << port << std::endl;
+	struct sockaddr_in other_side;
+	socklen_t addr_size = sizeof (struct sockaddr_in);
+	sock = accept (listen_sock, (struct sockaddr *) &other_side, &addr_size);
+	close (listen_sock);
+	if (sock == -1)
+	{
+		std::cerr << "cannot accept connection: " << strerror (errno) << std::endl;
+		return -1;
+	}
+	std::cout << "grbd connected from " << inet_ntoa (other_side.sin_addr) << std::endl;
+	return 0;
+}
+
+int GcnReplay::sendPacket (int32_t *packet)
+{
+	int32_t nbuf[SIZ_PKT];
+	for (int i = 0; i < SIZ_PKT; i++)
+		nbuf[i] = htonl (packet[i]);
+	size_t sent = 0;
+	while (sent < sizeof (nbuf))
+	{
+		ssize_t ret = write (sock, ((char *) nbuf) + sent, sizeof (nbuf) - sent);
+		if (ret <= 0)
+		{
+			std::cerr << "cannot send packet: " << strerror (errno) << std::endl;
+			return -1;
+		}
+		sent += ret;
+	}
+	return 0;
+}
+
+double GcnReplay::waitEcho (int32_t *packet)
+{
+	double start = getNow ();
+	int32_t nbuf[SIZ_PKT];
+	size_t received = 0;
+	while (received < sizeof (nbuf))
+	{
+		struct pollfd pfd;
+		pfd.fd = sock;
+		pfd.events = POLLIN;
+		int timeout = (int) ((start + ECHO_TIMEOUT - getNow ()) * 1000);
+		if (timeout <= 0 || poll (&pfd, 1, timeout) <= 0)
+			return NAN;
+		ssize_t ret = read (sock, ((char *) nbuf) + received, sizeof (nbuf) - received);
+		if (ret <= 0)
+			return NAN;
+		received += ret;
+	}
+	if (ntohl (nbuf[PKT_TYPE]) != (uint32_t) packet[PKT_TYPE] || ntohl (nbuf[PKT_SERNUM]) != (uint32_t) packet[PKT_SERNUM])
+		std::cerr << "echo does not match sent packet" << std::endl;
+	return getNow () - start;
+}
+
+int GcnReplay::sendImalive ()
+{
+	int32_t packet[SIZ_PKT];
+	memset (packet, 0, sizeof (packet));
+
+	time_t now;
+	time (&now);
+	struct tm *t = gmtime (&now);
+
+	packet[PKT_TYPE] = TYPE_IM_ALIVE;
+	packet[PKT_SERNUM] = serial++;
+	packet[PKT_SOD] = (t->tm_hour * 3600 + t->tm_min * 60 + t->tm_sec) * 100;
+	packet[PKT_TERM] = '\n';
+
+	if (sendPacket (packet))
+		return -1;
+	waitEcho (packet);
+	return 0;
+}
+
+int GcnReplay::waitTill (double t)
+{
+	double now;
+	while ((now = getNow ()) < t)
+	{
+		double w = t - now;
+		if (w > IMALIVE_INTERVAL)
+		{
+			usleep (IMALIVE_INTERVAL * USEC_SEC);
+			if (sendImalive ())
+				return -1;
+		}
+		else
+		{
+			usleep ((useconds_t) (w * USEC_SEC));
+		}
+	}
+	return 0;
+}
+
+int GcnReplay::run ()
+{
+	int ret = init ();
+	if (ret)
+		return ret;
+
+	if (fileName == NULL)
+	{
+		std::cerr << "missing file with recorded packets" << std::endl;
+		return -1;
+	}
+
+	ret = loadPackets ();
+	if (ret)
+		return ret;
+
+	if (packets.empty ())
+	{
+		std::cerr << "no packets found in " << fileName << std::endl;
+		return -1;
+	}
+
+	ret = openConnection ();
+	if (ret)
+		return ret;
+
+	double start = getNow ();
+	double echoSum = 0;
+	double echoMax = 0;
+	int echoes = 0;
+
+	for (size_t i = 0; i < packets.size (); i++)
+	{
+		RecordedPacket &rp = packets[i];
+		double t;
+		if (isnan (interval))
+			t = start + (rp.received - packets[0].received) / speedup;
+		else
+			t = start + i * interval;
+		if (waitTill (t))
+			return -1;
+
+		rp.packet[PKT_SERNUM] = serial++;
+		if (sendPacket (rp.packet))
+			return -1;
+
+		std::cout << std::setw (5) << i + 1 << " type " << std::setw (3) << rp.packet[PKT_TYPE];
+		// KILL packets are not echoed
+		if (rp.packet[PKT_TYPE] != TYPE_KILL_SOCKET)
+		{
+			double echo = waitEcho (rp.packet);
+			if (isnan (echo))
+			{
+				std::cout << " echo not received" << std::endl;
+				continue;
+			}
+			std::cout << " echo " << std::fixed << std::setprecision (6) << echo;
+			echoSum += echo;
+			if (echo > echoMax)
+				echoMax = echo;
+			echoes++;
+		}
+		std::cout << std::endl;
+	}
+
+	std::cout << packets.size () << " packets sent in " << std::fixed << std::setprecision (3) << getNow () - start << " s";
+	if (echoes > 0)
+		std::cout << ", echo average " << std::setprecision (6) << echoSum / echoes << " s, maximum " << echoMax << " s";
+	std::cout << std::endl;
+
+	return 0;
+}
+
+int main (int argc, char **argv)
+{
+	GcnReplay app (argc, argv);
+	return app.run ();
+}
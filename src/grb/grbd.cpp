@@ -54,6 +54,12 @@ Grbd::Grbd (int in_argc, char **in_argv):DeviceDb (in_argc, in_argv, DEVICE_TYPE
 
 	createValue (last_packet, "last_packet", "time from last packet", false);
 
+	createValue (gcn_received, "gcn_received", "time when the last GCN packet was received", false);
+	createValue (gcn_decided, "gcn_decided", "time when follow-up of the last GRB was decided", false);
+	createValue (gcn_notified, "gcn_notified", "time when executor was notified about the last GRB", false);
+	createValue (gcn_committed, "gcn_committed", "time when the last GCN packets were commited to the database", false);
+	createValue (notify_latency, "notify_latency", "[s] time from packet reception to executor notification", false);
+
 	createValue (last_target, "last_target", "name of the last GRB target", false);
 	createValue (last_target_id, "last_target_id", "ID of the last GRB target", false);
 
@@ -177,6 +183,7 @@ int Grbd::reloadConfig ()
 	}
 	if (gcncnn)
 	{
+		gcncnn->persistPending ();
 		deleteConnection (gcncnn);
 		delete gcncnn;
 	}
@@ -197,6 +204,8 @@ int Grbd::reloadConfig ()
 	{
 		addConnection (gcncnn);
 	}
+	// load GRB cache once database is connected
+	addTimer (0, new rts2core::Event (EVENT_GRB_PERSIST, this));
 
 	return 0;
 }
@@ -242,6 +251,12 @@ void Grbd::help ()
 int Grbd::info ()
 {
 	last_packet->setValueDouble (gcncnn->lastPacket ());
+
+	gcn_received->setValueDouble (gcncnn->stageReceived ());
+	gcn_decided->setValueDouble (gcncnn->stageDecided ());
+	gcn_committed->setValueDouble (gcncnn->stageCommitted ());
+	gcn_notified->setValueDouble (gcncnn->stageNotified ());
+	notify_latency->setValueDouble (gcncnn->notifyLatency ());
 	
 	if (last_target_id->getValueInteger () != gcncnn->lastTargetId () ||
 		((isnan (last_target_time->getValueDouble ()) || last_target_time->getValueDouble () < gcncnn->lastTargetTime ()) && last_target_errorbox->getValueDouble () > gcncnn->lastTargetErrobox ()))
@@ -264,6 +279,10 @@ void Grbd::postEvent (rts2core::Event * event)
 		case RTS2_EVENT_GRB_PACKET:
 			infoAll ();
 			break;
+		case EVENT_GRB_PERSIST:
+			if (gcncnn && gcncnn->persistPending () > 0)
+				infoAll ();
+			break;
 		case EVENT_TIMER_GCNCNN_INIT:
 			if (gcncnn->init () != 0)
 			{
@@ -27,6 +27,8 @@
 // when we get GRB packet..
 #define RTS2_EVENT_GRB_PACKET      RTS2_LOCAL_EVENT + 600
 #define EVENT_TIMER_GCNCNN_INIT    RTS2_LOCAL_EVENT + 601
+// write queued GCN packets to the database
+#define EVENT_GRB_PERSIST          RTS2_LOCAL_EVENT + 602
 
 namespace rts2grbd
 {
@@ -98,6 +100,12 @@ class Grbd:public rts2db::DeviceDb
 		rts2core::ValueBool *doHeteTests;
 
 		rts2core::ValueTime *last_packet;
+
+		rts2core::ValueTime *gcn_received;
+		rts2core::ValueTime *gcn_decided;
+		rts2core::ValueTime *gcn_notified;
+		rts2core::ValueTime *gcn_committed;
+		rts2core::ValueDouble *notify_latency;
 		rts2core::ValueString *last_target;
 		rts2core::ValueInteger *last_target_id;
 		rts2core::ValueTime *last_target_time;
@@ -63,6 +63,7 @@ digraph "JSON API calls handling" {
 
 #include "httpd.h"
 #include "rts2json/jsonvalue.h"
+#include "rts2json/bsc.h"
 
 #include "rts2db/constraints.h"
 #include "rts2db/planset.h"
@@ -123,6 +124,68 @@ void sendSelection (std::ostringstream &os, rts2core::ValueSelection *value)
 
 }
 
+void API::responseCachePolicy (const std::string &path, XmlRpc::HttpParams *params, rts2json::CachePolicy &policy)
+{
+	std::vector <std::string> vals = SplitStr (path, std::string ("/"));
+	if (vals.size () != 1)
+		return;
+	const std::string &call = vals[0];
+
+	// binary data and statistics of the last image are valid till camera takes a new image
+	if (call == "lastimage" || call == "imgstats")
+	{
+		policy.maxAge = 600;
+		policy.invalidate = CACHE_INVALIDATE_IMAGE;
+		policy.device = params->getString ("ccd", "");
+	}
+	else if (call == "devices" || call == "devbytype")
+	{
+		policy.maxAge = 10;
+		policy.invalidate = CACHE_INVALIDATE_STATE;
+	}
+	else if (call == "selval" || call == "deviceinfo")
+	{
+		policy.maxAge = 60;
+		policy.invalidate = CACHE_INVALIDATE_VALUE | CACHE_INVALIDATE_STATE;
+		policy.device = params->getString ("d", "");
+	}
+	else if (call == "sunalt" || call == "night")
+	{
+		policy.maxAge = 60;
+	}
+	// catalogue does not change
+	else if (call == "bsc")
+	{
+		policy.maxAge = 3600;
+	}
+	else if (call == "get" || call == "status")
+	{
+		const char *device = params->getString ("d", "");
+		// own values change with every request
+		if (strcmp (device, ((HttpD *) getMasterApp ())->getDeviceName ()) == 0)
+			return;
+		policy.maxAge = 5;
+		policy.invalidate = CACHE_INVALIDATE_VALUE | CACHE_INVALIDATE_STATE;
+		policy.device = isCentraldName (device) ? "centrald" : device;
+	}
+	else if (call == "executor")
+	{
+		policy.maxAge = 5;
+		policy.invalidate = CACHE_INVALIDATE_VALUE | CACHE_INVALIDATE_STATE;
+	}
+#ifdef RTS2_HAVE_PGSQL
+	else if (call == "script" || call == "taltitudes")
+	{
+		policy.maxAge = 60;
+		policy.invalidate = CACHE_INVALIDATE_TARGET;
+	}
+	else
+	{
+		rts2json::JSONDBRequest::responseCachePolicy (path, params, policy);
+	}
+#endif // RTS2_HAVE_PGSQL
+}
+
 void API::executeJSON (XmlRpc::XmlRpcSource *source, std::string path, XmlRpc::HttpParams *params, const char* &response_type, char* &response, size_t &response_length)
 {
 	std::vector <std::string> vals = SplitStr (path, std::string ("/"));
@@ -155,6 +218,8 @@ void API::executeJSON (XmlRpc::XmlRpcSource *source, std::string path, XmlRpc::H
 			if (conn == NULL || conn->getOtherType () != DEVICE_TYPE_CCD)
 				throw JSONException ("cannot find camera with given name");
 			int chan = params->getInteger ("chan", 0);
+			if (chan < 0)
+				throw JSONException ("cannot find specified channel");
 
 			if (vals[0] == "currentimage")
 			{
@@ -288,6 +353,33 @@ void API::executeJSON (XmlRpc::XmlRpcSource *source, std::string path, XmlRpc::H
 			}
 			os << "]";
 		}
+		// cone search in Bright Star Catalogue
+		else if (vals[0] == "bsc")
+		{
+			double ra = params->getDouble ("ra", NAN);
+			double dec = params->getDouble ("dec", NAN);
+			if (isnan (ra) || isnan (dec))
+				throw JSONException ("missing or invalid ra or dec parameter");
+			double radius = params->getDouble ("r", 1);
+			double maxmag = params->getDouble ("mag", 10);
+
+			std::vector <const struct bsc_record *> stars;
+			rts2json::BSCIndex::instance ()->coneSearch (ra, dec, radius, maxmag, stars);
+
+			os << "[" << std::fixed;
+			for (std::vector <const struct bsc_record *>::iterator iter = stars.begin (); iter != stars.end (); iter++)
+			{
+				if (iter != stars.begin ())
+					os << ",";
+				os << "[" << (*iter)->hrn << ",";
+				if ((*iter)->name)
+					os << "\"" << rts2json::JsonString ((*iter)->name) << "\"";
+				else
+					os << "null";
+				os << "," << (*iter)->ra << "," << (*iter)->dec << "," << (*iter)->mag << "]";
+			}
+			os << "]";
+		}
 #ifdef RTS2_HAVE_PGSQL
 		else if (vals[0] == "script")
 		{
@@ -660,6 +752,34 @@ void API::executeJSON (XmlRpc::XmlRpcSource *source, std::string path, XmlRpc::H
 				rts2image::Image *image = ((XmlDevCameraClient *) (conn->getOtherDevClient ()))->getPreviousImage ();
 				os << "\"hasimage\":" << ((image == NULL) ? "false" : "true");
 			}
+			// statistics of the last image channel, computed once and cached
+			else if (vals[0] == "imgstats")
+			{
+				const char *camera = params->getString ("ccd","");
+				conn = master->getOpenConnection (camera);
+				if (conn == NULL || conn->getOtherType () != DEVICE_TYPE_CCD)
+					throw JSONException ("cannot find camera with given name");
+				// HttpD::createOtherType qurantee that the other connection is XmlDevCameraClient
+				rts2image::Image *image = ((XmlDevCameraClient *) (conn->getOtherDevClient ()))->getPreviousImage ();
+				if (image == NULL)
+					throw JSONException ("camera did not take a single image");
+				int chan = params->getInteger ("chan", 0);
+				if (chan < 0 || image->getChannelSize () <= chan)
+					throw JSONException ("cannot find specified channel");
+				double q = params->getDouble ("q", DEFAULT_QUANTILES);
+
+				rts2image::Channel *ch = image->getChannel (chan);
+				ch->computeStatistics ();
+				os << "\"pixels\":" << ch->getStatPixels ()
+					<< ",\"sum\":" << rts2json::JsonDouble ((double) ch->getPixelSum ())
+					<< ",\"average\":" << rts2json::JsonDouble (ch->getAverage ())
+					<< ",\"stdev\":" << rts2json::JsonDouble (ch->getStDev ())
+					<< ",\"min\":" << rts2json::JsonDouble (ch->getMin ())
+					<< ",\"max\":" << rts2json::JsonDouble (ch->getMax ())
+					<< ",\"median\":" << rts2json::JsonDouble (ch->getMedian ())
+					<< ",\"low\":" << rts2json::JsonDouble (ch->getQuantile (q))
+					<< ",\"high\":" << rts2json::JsonDouble (ch->getQuantile (1 - q));
+			}
 			else if (vals[0] == "expand")
 			{
 				const char *fn = params->getString ("fn", NULL);
@@ -51,6 +51,8 @@ class API:public rts2json::JSONRequest
 		void sendOwnValues (std::ostringstream & os, XmlRpc::HttpParams *params, double from, bool extended);
 
 	protected:
+		virtual void responseCachePolicy (const std::string &path, XmlRpc::HttpParams *params, rts2json::CachePolicy &policy);
+
 		virtual void executeJSON (XmlRpc::XmlRpcSource *source, std::string path, XmlRpc::HttpParams *params, const char* &response_type, char* &response, size_t &response_length);
 	
 	private:
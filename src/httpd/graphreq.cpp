@@ -48,16 +48,16 @@ void CurrentPosition::authorizedExecute (XmlRpc::XmlRpcSource *source, std::stri
 
 	if (bsc_maxsize > 0.0)
 	{
-		for (bsc_record *star = bsc; star->hrn >= 0; star++)
+		const std::vector <rts2json::BSCHorizontal> &stars = rts2json::BSCIndex::instance ()->horizontal (JD, Configuration::instance ()->getObserver (), bsc_limmag);
+		for (std::vector <rts2json::BSCHorizontal>::const_iterator iter = stars.begin (); iter != stars.end (); iter++)
 		{
-			if (star->mag > bsc_limmag)
+			// stars are sorted by magnitude
+			if (iter->star->mag > bsc_limmag)
+				break;
+			if (iter->hrz.alt <= 0.0)
 				continue;
-			pos.ra = star->ra;
-			pos.dec  = star->dec;
-			ln_get_hrz_from_equ (&pos, Configuration::instance ()->getObserver (), JD, &hrz);
-			if (hrz.alt <= 0.0)
-				continue;
-			altaz.plot (&hrz, NULL, "grey30", PLOT_TYPE_POINT, - (star->mag - bsc_limmag) / bsc_limmag * bsc_maxsize);
+			hrz = iter->hrz;
+			altaz.plot (&hrz, NULL, "grey30", PLOT_TYPE_POINT, - (iter->star->mag - bsc_limmag) / bsc_limmag * bsc_maxsize);
 		}
 	}
 
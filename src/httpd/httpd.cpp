@@ -447,6 +447,7 @@ rts2image::imageProceRes XmlDevCameraClient::processImage (rts2image::Image * im
 		}
 	}
 	previmage = image;
+	getMaster ()->invalidateCache (CACHE_INVALIDATE_IMAGE, getConnection ()->getName ());
 	return rts2image::IMAGE_KEEP_COPY;
 }
 
@@ -462,12 +463,19 @@ int HttpD::info ()
 
 int HttpD::idle ()
 {
-	rts2json::HTTPServer::asyncIdle ();
+	setTimeout (10 * USEC_SEC);
 #ifdef RTS2_HAVE_PGSQL
-	return DeviceDb::idle ();
+	// messages received during this loop are written together
+	flushMessages ();
+	int ret = DeviceDb::idle ();
 #else
-	return rts2core::Device::idle ();
+	int ret = rts2core::Device::idle ();
 #endif
+	// wake up in time to send batched value changes, keep shorter timeout requested by the base classes
+	long next = rts2json::HTTPServer::asyncIdle ();
+	if (next >= 0)
+		setTimeoutMin (next > 1000 ? next : 1000);
+	return ret;
 }
 
 #ifndef RTS2_HAVE_PGSQL
@@ -782,6 +790,12 @@ HttpD::HttpD (int argc, char **argv): rts2core::Device (argc, argv, DEVICE_TYPE_
 	createValue (sumAsync, "async_sum", "total number of async APIs", false);
 	sumAsync->setValueInteger (0);
 
+	createValue (cacheEnabled, "cache_enabled", "cache responses to API requests", false, RTS2_VALUE_WRITABLE);
+	cacheEnabled->setValueBool (true);
+	createValue (cacheHits, "cache_hits", "number of requests served from response cache", false);
+	createValue (cacheMisses, "cache_misses", "number of cacheable requests not found in response cache", false);
+	createValue (cacheEntries, "cache_entries", "number of responses in cache", false);
+
 	createValue (send_emails, "send_email", "if XML-RPC is allowed to send emails", false, RTS2_VALUE_WRITABLE);
 	send_emails->setValueBool (true);
 
@@ -820,6 +834,9 @@ HttpD::HttpD (int argc, char **argv): rts2core::Device (argc, argv, DEVICE_TYPE_
 
 HttpD::~HttpD ()
 {
+#ifdef RTS2_HAVE_PGSQL
+	flushMessages ();
+#endif
 	for (std::vector <rts2json::Directory *>::iterator id = directories.begin (); id != directories.end (); id++)
 		delete *id;
 
@@ -879,6 +896,11 @@ void HttpD::deviceReady (rts2core::Connection * conn)
 
 int HttpD::setValue (rts2core::Value *old_value, rts2core::Value *new_value)
 {
+	if (old_value == cacheEnabled)
+	{
+		invalidateCache (CACHE_INVALIDATE_ALL);
+		return 0;
+	}
 	if (old_value == bbCadency)
 	{
 		for (BBServers::iterator iter = events.bbServers.begin (); iter != events.bbServers.end (); iter++)
@@ -902,6 +924,7 @@ int HttpD::setValue (rts2core::Value *old_value, rts2core::Value *new_value)
 void HttpD::stateChangedEvent (rts2core::Connection * conn, rts2core::ServerState * new_state)
 {
 	double now = getNow ();
+	invalidateCache (CACHE_INVALIDATE_STATE, conn->getOtherType () == DEVICE_TYPE_SERVERD ? "centrald" : conn->getName ());
 	// look if there is some state change command entry, which match us..
 	for (StateCommands::iterator iter = events.stateCommands.begin (); iter != events.stateCommands.end (); iter++)
 	{
@@ -923,6 +946,9 @@ void HttpD::stateChangedEvent (rts2core::Connection * conn, rts2core::ServerStat
 void HttpD::valueChangedEvent (rts2core::Connection * conn, rts2core::Value * new_value)
 {
 	double now = getNow ();
+	invalidateCache (CACHE_INVALIDATE_VALUE, conn->getOtherType () == DEVICE_TYPE_SERVERD ? "centrald" : conn->getName ());
+	// serialise change once for all push subscriptions
+	recordValueChange (conn->getName (), new_value);
 	// look if there is some state change command entry, which match us..
 	for (ValueCommands::iterator iter = events.valueCommands.begin (); iter != events.valueCommands.end (); iter++)
 	{
@@ -949,14 +975,25 @@ void HttpD::valueChangedEvent (rts2core::Connection * conn, rts2core::Value * ne
 		(*iter)->valueChanged (conn, new_value);
 }
 
+#ifdef RTS2_HAVE_PGSQL
+void HttpD::flushMessages ()
+{
+	if (pendingMessages.empty ())
+		return;
+	rts2db::MessageDB::insertDB (pendingMessages);
+	pendingMessages.clear ();
+}
+#endif
+
 void HttpD::message (Message & msg)
 {
 // log message to DB, if database is present
 #ifdef RTS2_HAVE_PGSQL
 	if (msg.isNotDebug ())
 	{
-		rts2db::MessageDB msgDB (msg);
-		msgDB.insertDB ();
+		pendingMessages.push_back (rts2db::MessageDB (msg));
+		if (pendingMessages.size () >= 500)
+			flushMessages ();
 	}
 #endif
 	switch (msg.getID ())
@@ -27,6 +27,7 @@
 
 #ifdef RTS2_HAVE_PGSQL
 #include "rts2db/devicedb.h"
+#include "rts2db/messagedb.h"
 #include "rts2db/plan.h"
 #include "rts2json/addtargetreq.h"
 #include "bbapi.h"
@@ -476,6 +477,8 @@ class HttpD:public rts2core::Device, XmlRpc::XmlRpcServer, rts2json::HTTPServer
 
 		virtual void addExecutedPage () { numRequests->inc (); }
 
+		using rts2json::HTTPServer::invalidateCache;
+
 		/**
 		 * Called when BB information were succesfully transmitted.
 		 */
@@ -576,6 +579,10 @@ class HttpD:public rts2core::Device, XmlRpc::XmlRpcServer, rts2json::HTTPServer
 		Records records;
 		RecordsAverage recordsAverage;
 		UserLogin userLogin;
+
+		// messages waiting to be written to database in single transaction
+		std::vector <rts2db::MessageDB> pendingMessages;
+		void flushMessages ();
 #endif // RTS2_HAVE_PGSQL
 
 #ifdef RTS2_HAVE_LIBJPEG
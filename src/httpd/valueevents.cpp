@@ -24,7 +24,7 @@
 
 using namespace rts2xmlrpc;
 
-ValueChange::ValueChange (HttpD *_master, std::string _deviceName, std::string _valueName, float _cadency, Expression *_test):Object ()
+ValueChange::ValueChange (HttpD *_master, std::string _deviceName, std::string _valueName, float _cadency, Expression *_test):Object (), testCode ()
 {
 	master = _master;
 	deviceName = ci_string (_deviceName.c_str ());
@@ -33,6 +33,8 @@ ValueChange::ValueChange (HttpD *_master, std::string _deviceName, std::string _
 	lastTime = 0;
 	cadency = _cadency;
 	test = _test;
+	if (test)
+		test->compile (testCode);
 
 	if (cadency > 0)
 		master->addTimer (cadency, new Event (EVENT_XMLRPC_VALUE_TIMER, this));
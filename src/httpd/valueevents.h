@@ -22,6 +22,7 @@
 
 #include "value.h"
 #include "expression.h"
+#include "bytecode.h"
 
 #include "emailaction.h"
 
@@ -53,7 +54,7 @@ class ValueChange:public rts2core::Object
 		{
 			if (deviceName == _deviceName.c_str () && valueName == _valueName.c_str () && (cadency < 0 || lastTime + cadency < infoTime))
 			{
-				if (test && test->evaluate () == 0)
+				if (test && testCode.evaluate () == 0)
 						return false;
 				return true;
 			}
@@ -83,6 +84,7 @@ class ValueChange:public rts2core::Object
 		double lastTime;
 		float cadency;
 		Expression *test;
+		Bytecode testCode;
 };
 
 /**
@@ -29,6 +29,11 @@ DevClientLogger::DevClientLogger (rts2core::Connection * in_conn, double in_numb
 	numberSec.tv_sec = (int) (floor (in_numberSec));
 	numberSec.tv_usec = (int) (USEC_SEC * (in_numberSec - floor (in_numberSec)));
 
+	subscriptionState = SUBSCRIBE;
+	period = in_numberSec;
+	lastPush = NAN;
+	nextSubscribe = NAN;
+
 	time(&nextFileCreationCheck);
 	fileCreationInterval = in_fileCreationInterval;
 
@@ -115,14 +120,63 @@ void DevClientLogger::infoFailed ()
 	*outputStream << "info failed" << std::endl;
 }
 
+void DevClientLogger::infoPushed ()
+{
+	lastPush = getNow ();
+	infoOK ();
+}
+
+void DevClientLogger::subscribed ()
+{
+	subscriptionState = SUBSCRIBED;
+	lastPush = getNow ();
+	nextSubscribe = NAN;
+	// log current values received as reply to the subscription
+	infoOK ();
+}
+
+void DevClientLogger::subscriptionFailed ()
+{
+	// report only the first failure, not the periodic retries
+	if (isnan (nextSubscribe))
+		logStream (MESSAGE_WARNING) << "device " << getName () << " does not support value subscriptions, values will be polled every " << period << " seconds, subscription will be retried every " << getSubscribeRetry () << " seconds" << sendLog;
+	nextSubscribe = getNow () + getSubscribeRetry ();
+	subscriptionState = POLL;
+}
+
 void DevClientLogger::idle ()
 {
-	struct timeval now;
-	gettimeofday (&now, NULL);
-	if (timercmp (&nextInfoCall, &now, <))
+	switch (subscriptionState)
 	{
-		queCommand (new rts2core::CommandInfo (getMaster ()));
-		timeradd (&now, &numberSec, &nextInfoCall);
+		case SUBSCRIBE:
+			queCommand (new rts2core::CommandSubscribe (getMaster (), period, 0, logNames));
+			subscriptionState = SUBSCRIBING;
+			break;
+		case SUBSCRIBING:
+			break;
+		case SUBSCRIBED:
+			// pushes stopped - most probably device was restarted, and does not know about subscription
+			if (getNow () - lastPush > 3 * period + 10)
+			{
+				logStream (MESSAGE_WARNING) << "no values pushed from " << getName () << " for " << (getNow () - lastPush) << " seconds, subscribing again" << sendLog;
+				subscriptionState = SUBSCRIBE;
+			}
+			break;
+		case POLL:
+			// device might be restarted with subscription support
+			if (getNow () > nextSubscribe)
+			{
+				subscriptionState = SUBSCRIBE;
+				break;
+			}
+			struct timeval now;
+			gettimeofday (&now, NULL);
+			if (timercmp (&nextInfoCall, &now, <))
+			{
+				queCommand (new rts2core::CommandInfo (getMaster ()));
+				timeradd (&now, &numberSec, &nextInfoCall);
+			}
+			break;
 	}
 }
 
@@ -52,6 +52,10 @@ class DevClientLogger:public rts2core::DevClient
 		virtual void infoOK ();
 		virtual void infoFailed ();
 
+		virtual void infoPushed ();
+		virtual void subscribed ();
+		virtual void subscriptionFailed ();
+
 		virtual void idle ();
 
 		virtual void postEvent (rts2core::Event * event);
@@ -82,6 +86,33 @@ class DevClientLogger:public rts2core::DevClient
 		 */
 		struct timeval numberSec;
 
+		/**
+		 * Values are subscribed from the device. Devices not supporting
+		 * subscriptions are polled with info command.
+		 */
+		enum { SUBSCRIBE, SUBSCRIBING, SUBSCRIBED, POLL } subscriptionState;
+
+		/**
+		 * Subscription period in seconds.
+		 */
+		double period;
+
+		/**
+		 * Time of the last push received from the device.
+		 */
+		double lastPush;
+
+		/**
+		 * Time of the next subscription attempt of polled device, NAN
+		 * if subscription did not fail yet.
+		 */
+		double nextSubscribe;
+
+		/**
+		 * Interval between subscription attempts of polled device.
+		 */
+		double getSubscribeRetry () { return period * 10 > 600 ? period * 10 : 600; }
+
 		/**
 		 * Interval between two sucessive tests of file expansion.
 		 */
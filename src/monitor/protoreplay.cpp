@@ -0,0 +1,588 @@
+/*
+ * Replay recorded protocol sessions, measure command latencies.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "client.h"
+#include "command.h"
+#include "binaryvalue.h"
+#include "utilsfunc.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <map>
+#include <vector>
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define EVENT_REPLAY_NEXT    RTS2_LOCAL_EVENT + 1400
+
+// give up on commands which did not returned in that time after the last command was send
+#define REPLAY_TIMEOUT       60
+
+/**
+ * Recorded command.
+ */
+struct ReplayLine
+{
+	double t;
+	std::string text;
+};
+
+/**
+ * Result of the single command.
+ */
+struct ReplayResult
+{
+	// index to commands
+	int index;
+	// time from sending the command to its return
+	double latency;
+	bool failed;
+};
+
+class ProtoReplay;
+
+/**
+ * Command send by replay. Records its latency.
+ */
+class ReplayCommand:public rts2core::Command
+{
+	public:
+		ReplayCommand (ProtoReplay *_master, int _index, const char *_text);
+
+		virtual int send ();
+
+		virtual int commandReturnOK (rts2core::Connection *conn);
+		virtual int commandReturnFailed (int status, rts2core::Connection *conn);
+
+	private:
+		ProtoReplay *replay;
+		int index;
+		double sendTime;
+};
+
+/**
+ * Replays commands recorded with --record-protocol to a device.
+ *
+ * Commands received by the recorded daemon are sent to the given device
+ * with the recorded spacing, scaled by the speed factor. With speed factor
+ * 0, next command is sent as soon as the previous returns. Multiple clients
+ * are forked to generate load; each connects to centrald separately and
+ * replays the whole recording. Latency percentiles for each command and
+ * overall throughput are printed at the end.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class ProtoReplay:public rts2core::Client
+{
+	public:
+		ProtoReplay (int argc, char **argv);
+
+		virtual int run ();
+
+		virtual void postEvent (rts2core::Event *event);
+
+		void commandFinished (int index, double latency, bool failed);
+
+	protected:
+		virtual int processOption (int opt);
+		virtual int processArgs (const char *arg);
+		virtual void usage ();
+
+		virtual int willConnect (rts2core::NetworkAddress *in_addr);
+		virtual rts2core::ConnCentraldClient *createCentralConn ();
+		virtual int idle ();
+
+	private:
+		const char *device;
+		const char *fileName;
+		int clients;
+		double speed;
+		int repeat;
+
+		std::vector <ReplayLine> lines;
+		std::vector <ReplayResult> results;
+
+		// next command to send, counts over repeats
+		int next;
+		int running;
+		double replayStart;
+		double replayEnd;
+		double lastSend;
+
+		// forked clients report results to parent through pipes
+		int resultPipe;
+		std::vector <int> pipes;
+		std::vector <pid_t> children;
+
+		int loadRecording ();
+		bool isReplayed (const std::string &cmd);
+
+		// send commands which are due, schedule next
+		void sendCommands ();
+
+		rts2core::Connection *getDeviceConnection ();
+
+		// write results of a forked client to the pipe, read them in parent
+		int writeResults (int fd);
+		int readResults (int fd, double &start, double &end);
+
+		void printResults (double start, double end);
+};
+
+ReplayCommand::ReplayCommand (ProtoReplay *_master, int _index, const char *_text):rts2core::Command (_master, _text)
+{
+	replay = _master;
+	index = _index;
+	sendTime = NAN;
+}
+
+int ReplayCommand::send ()
+{
+	sendTime = getNow ();
+	return rts2core::Command::send ();
+}
+
+int ReplayCommand::commandReturnOK (rts2core::Connection *conn)
+{
+	replay->commandFinished (index, getNow () - sendTime, false);
+	return rts2core::Command::commandReturnOK (conn);
+}
+
+int ReplayCommand::commandReturnFailed (int status, rts2core::Connection *conn)
+{
+	replay->commandFinished (index, getNow () - sendTime, true);
+	return rts2core::Command::commandReturnFailed (status, conn);
+}
+
+ProtoReplay::ProtoReplay (int argc, char **argv):rts2core::Client (argc, argv, "protoreplay"), lines (), results ()
+{
+	device = NULL;
+	fileName = NULL;
+	clients = 1;
+	speed = 1;
+	repeat = 1;
+
+	next = -1;
+	running = 0;
+	replayStart = NAN;
+	replayEnd = NAN;
+	lastSend = NAN;
+
+	resultPipe = -1;
+
+	addOption ('d', NULL, 1, "device which will receive commands");
+	addOption ('n', NULL, 1, "number of clients (default 1)");
+	addOption ('x', NULL, 1, "speed factor (default 1 - recorded speed); 0 sends next command when the previous returns");
+	addOption ('r', NULL, 1, "replay recording that many times (default 1)");
+}
+
+int ProtoReplay::processOption (int opt)
+{
+	switch (opt)
+	{
+		case 'd':
+			device = optarg;
+			break;
+		case 'n':
+			clients = atoi (optarg);
+			break;
+		case 'x':
+			speed = atof (optarg);
+			break;
+		case 'r':
+			repeat = atoi (optarg);
+			break;
+		default:
+			return rts2core::Client::processOption (opt);
+	}
+	return 0;
+}
+
+int ProtoReplay::processArgs (const char *arg)
+{
+	if (fileName)
+		return -1;
+	fileName = arg;
+	if (device == NULL)
+	{
+		std::cerr << "device (-d) must be specified" << std::endl;
+		return -1;
+	}
+	if (loadRecording ())
+		return -1;
+	if (lines.empty ())
+	{
+		std::cerr << "no commands found in " << fileName << std::endl;
+		return -1;
+	}
+	return 0;
+}
+
+void ProtoReplay::usage ()
+{
+	std::cout << "Record device session with:" << std::endl
+		<< "\trts2-camd-dummy -d C0 --record-protocol /tmp/C0.rec" << std::endl
+		<< "Replay it with 10 clients, 5 times faster:" << std::endl
+		<< "\t" << getAppName () << " -d C0 -n 10 -x 5 /tmp/C0.rec" << std::endl;
+}
+
+bool ProtoReplay::isReplayed (const std::string &cmd)
+{
+	// command returns
+	if ((cmd[0] == '+' || cmd[0] == '-') && cmd.length () > 1 && isdigit (cmd[1]))
+		return false;
+	// protocol lines, except value settings
+	if (cmd.length () == 1)
+		return cmd == PROTO_SET_VALUE;
+	// connection management
+	const char *mgmt[] = { "auth", "authorization_key", "authorization_ok", "authorization_failed", "device", "client", "delete_device", "delete_client", "status_info", "this_device", "logged_as", "exit", NULL };
+	for (const char **m = mgmt; *m; m++)
+	{
+		if (cmd == *m)
+			return false;
+	}
+	return true;
+}
+
+int ProtoReplay::loadRecording ()
+{
+	std::ifstream is (fileName);
+	if (is.fail ())
+	{
+		std::cerr << "cannot open " << fileName << ": " << strerror (errno) << std::endl;
+		return -1;
+	}
+	std::string line;
+	long ln = 0;
+	while (std::getline (is, line))
+	{
+		ln++;
+		std::istringstream ls (line);
+		ReplayLine rl;
+		char dir;
+		std::string conn;
+		ls >> rl.t >> dir >> conn >> std::ws;
+		if (ls.fail () || !std::getline (ls, rl.text) || rl.text.empty ())
+			continue;
+		// only lines received by the recorded daemon are commands for it
+		if (dir != '<')
+			continue;
+		std::string cmd = rl.text.substr (0, rl.text.find (' '));
+		// binary payloads are not recorded, session cannot be replayed faithfully
+		if (cmd == PROTO_BINARY || cmd == PROTO_DATA || cmd == PROTO_BINARY_VALUES)
+		{
+			std::cerr << fileName << ":" << ln << ": recorded daemon received binary data, which are not recorded; such sessions cannot be replayed" << std::endl;
+			return -1;
+		}
+		if (!isReplayed (cmd))
+			continue;
+		lines.push_back (rl);
+	}
+	return 0;
+}
+
+rts2core::Connection *ProtoReplay::getDeviceConnection ()
+{
+	rts2core::Connection *conn = getOpenConnection (device);
+	if (conn == NULL || !(conn->isConnState (CONN_CONNECTED) || conn->isConnState (CONN_AUTH_OK)))
+		return NULL;
+	return conn;
+}
+
+rts2core::ConnCentraldClient *ProtoReplay::createCentralConn ()
+{
+	// called after options were parsed, before centrald connection is
+	// opened - fork additional clients here, so each has its own connection
+	if (lines.empty ())
+	{
+		std::cerr << "recording file must be specified" << std::endl;
+		setEndLoop (true);
+		return rts2core::Client::createCentralConn ();
+	}
+
+	for (int c = 1; c < clients; c++)
+	{
+		int fds[2];
+		if (pipe (fds))
+		{
+			std::cerr << "cannot create pipe: " << strerror (errno) << std::endl;
+			break;
+		}
+		pid_t pid = fork ();
+		if (pid < 0)
+		{
+			std::cerr << "cannot fork: " << strerror (errno) << std::endl;
+			close (fds[0]);
+			close (fds[1]);
+			break;
+		}
+		if (pid == 0)
+		{
+			close (fds[0]);
+			for (std::vector <int>::iterator iter = pipes.begin (); iter != pipes.end (); iter++)
+				close (*iter);
+			pipes.clear ();
+			children.clear ();
+			resultPipe = fds[1];
+			break;
+		}
+		close (fds[1]);
+		pipes.push_back (fds[0]);
+		children.push_back (pid);
+	}
+
+	return rts2core::Client::createCentralConn ();
+}
+
+int ProtoReplay::willConnect (rts2core::NetworkAddress *in_addr)
+{
+	return in_addr->isAddress (device);
+}
+
+int ProtoReplay::idle ()
+{
+	// start replay when device connection is ready
+	if (next < 0 && getDeviceConnection () != NULL)
+	{
+		next = 0;
+		replayStart = getNow ();
+		sendCommands ();
+	}
+	// all commands were send, wait for them to return
+	if (next >= (int) (lines.size () * repeat) && (running == 0 || getNow () > lastSend + REPLAY_TIMEOUT))
+	{
+		if (running > 0)
+			std::cerr << running << " commands did not returned" << std::endl;
+		replayEnd = getNow ();
+		setEndLoop (true);
+	}
+	return rts2core::Client::idle ();
+}
+
+void ProtoReplay::postEvent (rts2core::Event *event)
+{
+	switch (event->getType ())
+	{
+		case EVENT_REPLAY_NEXT:
+			sendCommands ();
+			break;
+	}
+	rts2core::Client::postEvent (event);
+}
+
+void ProtoReplay::sendCommands ()
+{
+	rts2core::Connection *conn = getDeviceConnection ();
+	if (conn == NULL)
+	{
+		std::cerr << "lost connection to " << device << std::endl;
+		setEndLoop (true);
+		return;
+	}
+	int total = lines.size () * repeat;
+	double duration = lines.back ().t - lines.front ().t;
+	while (next < total)
+	{
+		int index = next % lines.size ();
+		int rep = next / lines.size ();
+		if (speed > 0)
+		{
+			double t = replayStart + (rep * duration + lines[index].t - lines.front ().t) / speed;
+			if (t > getNow ())
+			{
+				addTimer (t - getNow (), new rts2core::Event (EVENT_REPLAY_NEXT, this));
+				return;
+			}
+		}
+		else if (running > 0)
+		{
+			// wait for the previous command
+			return;
+		}
+		conn->queCommand (new ReplayCommand (this, index, lines[index].text.c_str ()));
+		running++;
+		next++;
+		lastSend = getNow ();
+	}
+}
+
+void ProtoReplay::commandFinished (int index, double latency, bool failed)
+{
+	ReplayResult r;
+	r.index = index;
+	r.latency = latency;
+	r.failed = failed;
+	results.push_back (r);
+	running--;
+	if (speed <= 0)
+		sendCommands ();
+}
+
+// write whole buffer, returns -1 on error
+static int writeAll (int fd, const void *buf, size_t len)
+{
+	size_t done = 0;
+	while (done < len)
+	{
+		ssize_t ret = write (fd, ((const char *) buf) + done, len - done);
+		if (ret < 0 && errno == EINTR)
+			continue;
+		if (ret <= 0)
+			return -1;
+		done += ret;
+	}
+	return 0;
+}
+
+int ProtoReplay::writeResults (int fd)
+{
+	double times[2];
+	times[0] = replayStart;
+	times[1] = replayEnd;
+	int count = results.size ();
+	if (writeAll (fd, times, sizeof (times)) || writeAll (fd, &count, sizeof (count))
+		|| (count > 0 && writeAll (fd, &(results[0]), count * sizeof (ReplayResult))))
+	{
+		std::cerr << "cannot write results: " << strerror (errno) << std::endl;
+		return -1;
+	}
+	return 0;
+}
+
+int ProtoReplay::readResults (int fd, double &start, double &end)
+{
+	double times[2];
+	int count;
+	if (read (fd, times, sizeof (times)) != sizeof (times) || read (fd, &count, sizeof (count)) != sizeof (count))
+		return -1;
+	if (isnan (start) || times[0] < start)
+		start = times[0];
+	if (isnan (end) || times[1] > end)
+		end = times[1];
+	for (int i = 0; i < count; i++)
+	{
+		ReplayResult r;
+		size_t got = 0;
+		while (got < sizeof (r))
+		{
+			ssize_t ret = read (fd, ((char *) &r) + got, sizeof (r) - got);
+			if (ret <= 0)
+				return -1;
+			got += ret;
+		}
+		results.push_back (r);
+	}
+	return 0;
+}
+
+static double percentile (std::vector <double> &v, double p)
+{
+	size_t i = (size_t) ceil (p / 100.0 * v.size ());
+	if (i > 0)
+		i--;
+	return v[i];
+}
+
+static void printLine (const std::string &name, std::vector <double> &v, int failed)
+{
+	std::sort (v.begin (), v.end ());
+	std::cout << std::left << std::setw (20) << name << std::right << std::setw (8) << v.size () << std::setw (8) << failed
+		<< std::setw (12) << percentile (v, 50) * 1000 << std::setw (12) << percentile (v, 90) * 1000
+		<< std::setw (12) << percentile (v, 99) * 1000 << std::setw (12) << v.back () * 1000 << std::endl;
+}
+
+void ProtoReplay::printResults (double start, double end)
+{
+	// latencies for each command name
+	std::map <std::string, std::vector <double> > latencies;
+	std::map <std::string, int> failures;
+	std::vector <double> all;
+	int allFailures = 0;
+
+	for (std::vector <ReplayResult>::iterator iter = results.begin (); iter != results.end (); iter++)
+	{
+		std::string text = lines[iter->index].text;
+		std::string name = text.substr (0, text.find (' '));
+		latencies[name].push_back (iter->latency);
+		if (iter->failed)
+		{
+			failures[name]++;
+			allFailures++;
+		}
+		all.push_back (iter->latency);
+	}
+
+	std::cout << std::left << std::setw (20) << "command" << std::right << std::setw (8) << "count" << std::setw (8) << "failed"
+		<< std::setw (12) << "p50 [ms]" << std::setw (12) << "p90 [ms]" << std::setw (12) << "p99 [ms]" << std::setw (12) << "max [ms]" << std::endl;
+	std::cout << std::fixed << std::setprecision (3);
+	for (std::map <std::string, std::vector <double> >::iterator iter = latencies.begin (); iter != latencies.end (); iter++)
+	{
+		std::map <std::string, int>::iterator fiter = failures.find (iter->first);
+		printLine (iter->first, iter->second, fiter == failures.end () ? 0 : fiter->second);
+	}
+	if (!all.empty ())
+		printLine ("TOTAL", all, allFailures);
+	std::cout << results.size () << " commands in " << (end - start) << " s, " << results.size () / (end - start) << " commands/s" << std::endl;
+}
+
+int ProtoReplay::run ()
+{
+	int ret = rts2core::Client::run ();
+
+	if (resultPipe >= 0)
+	{
+		if (writeResults (resultPipe))
+			ret = -1;
+		close (resultPipe);
+		_exit (ret);
+	}
+
+	double start = replayStart;
+	double end = replayEnd;
+
+	for (size_t i = 0; i < pipes.size (); i++)
+	{
+		if (readResults (pipes[i], start, end))
+			std::cerr << "cannot read results of client " << i + 2 << std::endl;
+		close (pipes[i]);
+		waitpid (children[i], NULL, 0);
+	}
+
+	if (results.empty ())
+	{
+		std::cerr << "no command returned" << std::endl;
+		return -1;
+	}
+
+	printResults (start, end);
+	return ret;
+}
+
+int main (int argc, char **argv)
+{
+	ProtoReplay app (argc, argv);
+	return app.run ();
+}
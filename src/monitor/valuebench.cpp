@@ -0,0 +1,265 @@
+/*
+ * Benchmark of text and binary value protocol.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "block.h"
+#include "connection.h"
+#include "valuearray.h"
+#include "utilsfunc.h"
+
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <time.h>
+#include <sys/socket.h>
+
+/**
+ * Sends value updates over local socket pair, from connection with
+ * device values to connection which sets client copies of the values.
+ * Measures time needed to format, transfer and parse the values with
+ * text and binary value protocol.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class ValueBench:public rts2core::Block
+{
+	public:
+		ValueBench (int argc, char **argv);
+		virtual ~ValueBench ();
+
+		virtual int run ();
+
+	protected:
+		virtual int processOption (int opt);
+
+		virtual rts2core::Connection *createClientConnection (rts2core::NetworkAddress * in_addr) { return NULL; }
+
+	private:
+		long iterations;
+		int numValues;
+		int numArrays;
+		int arraySize;
+
+		std::vector <rts2core::ValueDouble *> doubles;
+		std::vector <rts2core::DoubleArray *> arrays;
+		rts2core::ValueInteger *counter;
+
+		void createValues ();
+		void updateValues (long i);
+
+		/**
+		 * Run the benchmark, returns -1 if received values differ from sent values.
+		 */
+		int bench (bool binary, double &cpu);
+
+		void removeConnection (rts2core::Connection *conn);
+};
+
+ValueBench::ValueBench (int argc, char **argv):rts2core::Block (argc, argv), doubles (), arrays ()
+{
+	iterations = 1000;
+	numValues = 200;
+	numArrays = 10;
+	arraySize = 100;
+	counter = NULL;
+
+	addOption ('n', NULL, 1, "number of updates (default 1000)");
+	addOption ('v', NULL, 1, "number of double values (default 200)");
+	addOption ('a', NULL, 1, "number of double arrays (default 10)");
+	addOption ('s', NULL, 1, "size of the arrays (default 100)");
+}
+
+ValueBench::~ValueBench ()
+{
+	for (std::vector <rts2core::ValueDouble *>::iterator iter = doubles.begin (); iter != doubles.end (); iter++)
+		delete *iter;
+	for (std::vector <rts2core::DoubleArray *>::iterator iter = arrays.begin (); iter != arrays.end (); iter++)
+		delete *iter;
+	delete counter;
+}
+
+int ValueBench::processOption (int opt)
+{
+	switch (opt)
+	{
+		case 'n':
+			iterations = atol (optarg);
+			break;
+		case 'v':
+			numValues = atoi (optarg);
+			break;
+		case 'a':
+			numArrays = atoi (optarg);
+			break;
+		case 's':
+			arraySize = atoi (optarg);
+			break;
+		default:
+			return rts2core::Block::processOption (opt);
+	}
+	return 0;
+}
+
+void ValueBench::createValues ()
+{
+	for (int i = 0; i < numValues; i++)
+	{
+		std::ostringstream _os;
+		_os << "double_" << i;
+		doubles.push_back (new rts2core::ValueDouble (_os.str (), "benchmark value"));
+	}
+	for (int i = 0; i < numArrays; i++)
+	{
+		std::ostringstream _os;
+		_os << "array_" << i;
+		arrays.push_back (new rts2core::DoubleArray (_os.str (), "benchmark array"));
+	}
+	counter = new rts2core::ValueInteger ("counter", "update counter");
+}
+
+void ValueBench::updateValues (long i)
+{
+	int j = 0;
+	for (std::vector <rts2core::ValueDouble *>::iterator iter = doubles.begin (); iter != doubles.end (); iter++, j++)
+		(*iter)->setValueDouble (i / 7.0 + j);
+	j = 0;
+	for (std::vector <rts2core::DoubleArray *>::iterator iter = arrays.begin (); iter != arrays.end (); iter++, j++)
+	{
+		std::vector <double> a (arraySize);
+		for (int k = 0; k < arraySize; k++)
+			a[k] = i / 3.0 + j + k * 0.25;
+		(*iter)->setValueArray (a);
+	}
+	counter->setValueInteger (i);
+}
+
+void ValueBench::removeConnection (rts2core::Connection *conn)
+{
+	rts2core::connections_t::iterator iter = std::find (getConnections ()->begin (), getConnections ()->end (), conn);
+	if (iter != getConnections ()->end ())
+		getConnections ()->erase (iter);
+	delete conn;
+}
+
+int ValueBench::bench (bool binary, double &cpu)
+{
+	int sv[2];
+	if (socketpair (AF_UNIX, SOCK_STREAM, 0, sv))
+	{
+		std::cerr << "cannot create socket pair: " << strerror (errno) << std::endl;
+		return -1;
+	}
+	int bufsize = 4 * 1024 * 1024;
+	setsockopt (sv[0], SOL_SOCKET, SO_SNDBUF, &bufsize, sizeof (bufsize));
+	setsockopt (sv[1], SOL_SOCKET, SO_RCVBUF, &bufsize, sizeof (bufsize));
+
+	rts2core::Connection *sender = new rts2core::Connection (sv[0], this);
+	rts2core::Connection *receiver = new rts2core::Connection (sv[1], this);
+	sender->setBinaryValues (binary);
+
+	for (std::vector <rts2core::ValueDouble *>::iterator iter = doubles.begin (); iter != doubles.end (); iter++)
+		receiver->metaInfo (RTS2_VALUE_DOUBLE, (*iter)->getName (), "benchmark value");
+	for (std::vector <rts2core::DoubleArray *>::iterator iter = arrays.begin (); iter != arrays.end (); iter++)
+		receiver->metaInfo (RTS2_VALUE_ARRAY | RTS2_VALUE_DOUBLE, (*iter)->getName (), "benchmark array");
+	receiver->metaInfo (RTS2_VALUE_INTEGER, "counter", "update counter");
+	rts2core::Value *rcounter = receiver->getValue ("counter");
+	rcounter->setValueInteger (-1);
+
+	addConnection (sender);
+	addConnection (receiver);
+
+	clock_t c = clock ();
+	double t = getNow ();
+
+	for (long i = 0; i < iterations; i++)
+	{
+		updateValues (i);
+		sender->beginValueBatch ();
+		for (std::vector <rts2core::ValueDouble *>::iterator iter = doubles.begin (); iter != doubles.end (); iter++)
+			(*iter)->send (sender);
+		for (std::vector <rts2core::DoubleArray *>::iterator iter = arrays.begin (); iter != arrays.end (); iter++)
+			(*iter)->send (sender);
+		counter->send (sender);
+		sender->endValueBatch ();
+
+		while (rcounter->getValueInteger () != i)
+		{
+			if (receiver->isConnState (CONN_BROKEN) || receiver->isConnState (CONN_DELETE))
+			{
+				std::cerr << "connection broken" << std::endl;
+				return -1;
+			}
+			oneRunLoop ();
+		}
+	}
+
+	double wall = getNow () - t;
+	cpu = ((double) (clock () - c)) / CLOCKS_PER_SEC;
+
+	int ret = 0;
+	for (std::vector <rts2core::ValueDouble *>::iterator iter = doubles.begin (); iter != doubles.end () && ret == 0; iter++)
+	{
+		if ((*iter)->getValueDouble () != receiver->getValue ((*iter)->getName ().c_str ())->getValueDouble ())
+			ret = -1;
+	}
+	for (std::vector <rts2core::DoubleArray *>::iterator iter = arrays.begin (); iter != arrays.end () && ret == 0; iter++)
+	{
+		if (!(*iter)->isEqual (receiver->getValue ((*iter)->getName ().c_str ())))
+			ret = -1;
+	}
+
+	long updates = iterations * (doubles.size () + arrays.size () + 1);
+	std::cout << (binary ? "binary" : "text  ") << std::fixed << std::setprecision (3)
+		<< "  wall " << std::setw (8) << wall << " s  cpu " << std::setw (8) << cpu << " s  "
+		<< std::setprecision (0) << std::setw (10) << updates / wall << " values/s"
+		<< (ret ? "  received values differ!" : "") << std::endl;
+	std::cout.unsetf (std::ios_base::floatfield);
+
+	removeConnection (sender);
+	removeConnection (receiver);
+	return ret;
+}
+
+int ValueBench::run ()
+{
+	int ret = init ();
+	if (ret)
+		return ret;
+
+	createValues ();
+
+	std::cout << iterations << " updates of " << numValues << " doubles and " << numArrays << " arrays of " << arraySize << " doubles" << std::endl;
+
+	double textCpu, binaryCpu;
+	ret = bench (false, textCpu);
+	if (ret)
+		return ret;
+	ret = bench (true, binaryCpu);
+	if (ret)
+		return ret;
+
+	std::cout << "cpu speedup " << std::setprecision (3) << textCpu / binaryCpu << std::endl;
+	return 0;
+}
+
+int main (int argc, char **argv)
+{
+	ValueBench app (argc, argv);
+	return app.run ();
+}
@@ -21,6 +21,9 @@
 
 #include <postgres.h>
 #include <fmgr.h>
+#include <catalog/pg_type.h>
+#include <utils/array.h>
+#include <utils/memutils.h>
 #ifdef PG_MODULE_MAGIC
 PG_MODULE_MAGIC;
 #endif
@@ -82,6 +85,9 @@ PG_FUNCTION_INFO_V1 (img_wcs2_equinox);
 // center RA and DEC
 PG_FUNCTION_INFO_V1 (img_wcs2_center_ra);
 PG_FUNCTION_INFO_V1 (img_wcs2_center_dec);
+// footprint for spatial index
+PG_FUNCTION_INFO_V1 (healpix_ang2pix);
+PG_FUNCTION_INFO_V1 (wcs2_footprint);
 
 // helper
 char *
@@ -499,3 +505,338 @@ img_wcs2_center_dec (PG_FUNCTION_ARGS)
   arg = PG_GETARG_KWCS2_P (0);
   PG_RETURN_FLOAT8 (arg->crval2);
 }
+
+/*
+ * HEALPix cells covering image footprint. Images are indexed by array of
+ * (nested scheme) HEALPix cells touching cap around the image; GIN index on
+ * that array is then used to select images which might contain given
+ * position, and isinwcs2 is used for exact check.
+ *
+ * Numbering is the same as in rts2core::HealPix, see Gorski et al., 2005,
+ * ApJ 622, 759.
+ */
+
+// face coordinates of the base cells
+static const int healpix_jrll[12] = { 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4 };
+static const int healpix_jpll[12] = { 1, 3, 5, 7, 0, 2, 4, 6, 1, 3, 5, 7 };
+
+static int64
+healpix_spread_bits (int64 x)
+{
+  int64 ret = 0;
+  int i;
+  for (i = 0; x >> i; i++)
+    ret |= ((x >> i) & 1L) << (2 * i);
+  return ret;
+}
+
+static int64
+healpix_compress_bits (int64 x)
+{
+  int64 ret = 0;
+  int i;
+  for (i = 0; x >> (2 * i); i++)
+    ret |= ((x >> (2 * i)) & 1L) << i;
+  return ret;
+}
+
+static int64
+healpix_nest_ang2pix (int nside, double ra, double dec)
+{
+  double z = sin (deg2rad (dec));
+  double za = fabs (z);
+  double tt = fmod (ra, 360.0);
+  int64 ix, iy;
+  int face;
+
+  if (tt < 0)
+    tt += 360.0;
+  // in [0,4)
+  tt /= 90.0;
+
+  if (za <= 2.0 / 3.0)
+    {
+      // equatorial region
+      double temp1 = nside * (0.5 + tt);
+      double temp2 = nside * z * 0.75;
+      int64 jp = (int64) (temp1 - temp2);
+      int64 jm = (int64) (temp1 + temp2);
+      int64 ifp = jp / nside;
+      int64 ifm = jm / nside;
+      if (ifp == ifm)
+	face = (ifp & 3) | 4;
+      else if (ifp < ifm)
+	face = ifp & 3;
+      else
+	face = (ifm & 3) + 8;
+      ix = jm & (nside - 1);
+      iy = nside - (jp & (nside - 1)) - 1;
+    }
+  else
+    {
+      // polar caps
+      int ntt = (int) tt;
+      double tp, tmp;
+      int64 jp, jm;
+      if (ntt >= 4)
+	ntt = 3;
+      tp = tt - ntt;
+      tmp = nside * sqrt (3 * (1 - za));
+      jp = (int64) (tp * tmp);
+      jm = (int64) ((1.0 - tp) * tmp);
+      if (jp >= nside)
+	jp = nside - 1;
+      if (jm >= nside)
+	jm = nside - 1;
+      if (z >= 0)
+	{
+	  face = ntt;
+	  ix = nside - jm - 1;
+	  iy = nside - jp - 1;
+	}
+      else
+	{
+	  face = ntt + 8;
+	  ix = jp;
+	  iy = jm;
+	}
+    }
+  return (int64) face *nside * nside + healpix_spread_bits (ix) +
+    (healpix_spread_bits (iy) << 1);
+}
+
+static void
+healpix_nest_pix2ang (int nside, int64 pix, double *ra, double *dec)
+{
+  int64 npface = (int64) nside *nside;
+  int face = pix / npface;
+  int64 ipf = pix % npface;
+  int64 ix = healpix_compress_bits (ipf);
+  int64 iy = healpix_compress_bits (ipf >> 1);
+
+  double fact2 = 4.0 / (12.0 * npface);
+  double fact1 = 2 * nside * fact2;
+
+  int64 jr = (int64) healpix_jrll[face] * nside - ix - iy - 1;
+  int64 nr, jp;
+  double z;
+  int kshift;
+
+  if (jr < nside)
+    {
+      nr = jr;
+      z = 1 - nr * nr * fact2;
+      kshift = 0;
+    }
+  else if (jr > 3 * nside)
+    {
+      nr = 4 * nside - jr;
+      z = nr * nr * fact2 - 1;
+      kshift = 0;
+    }
+  else
+    {
+      nr = nside;
+      z = (2 * nside - jr) * fact1;
+      kshift = (jr - nside) & 1;
+    }
+
+  jp = (healpix_jpll[face] * nr + ix - iy + 1 + kshift) / 2;
+  if (jp > 4 * nside)
+    jp -= 4 * nside;
+  if (jp < 1)
+    jp += 4 * nside;
+
+  *ra = (jp - (kshift + 1) * 0.5) * (90.0 / nr);
+  *dec = rad2deg (asin (z));
+}
+
+// upper estimate of distance of cell point from the cell centre, in degrees
+static double
+healpix_cell_radius (int nside)
+{
+  return rad2deg (1.1 * sqrt (4 * M_PI / (12.0 * nside * nside)));
+}
+
+// angular distance of two points, in degrees
+static double
+ang_distance (double ra1, double dec1, double ra2, double dec2)
+{
+  double d =
+    sin (deg2rad (dec1)) * sin (deg2rad (dec2)) +
+    cos (deg2rad (dec1)) * cos (deg2rad (dec2)) * cos (deg2rad (ra1 - ra2));
+  if (d > 1)
+    d = 1;
+  else if (d < -1)
+    d = -1;
+  return rad2deg (acos (d));
+}
+
+struct healpix_cells
+{
+  Datum *cells;
+  int num;
+  int size;
+};
+
+static void
+healpix_add_cell (struct healpix_cells *hc, int64 pix)
+{
+  if (hc->num == hc->size)
+    {
+      hc->size *= 2;
+      hc->cells = (Datum *) repalloc (hc->cells, hc->size * sizeof (Datum));
+    }
+  hc->cells[hc->num++] = Int64GetDatum (pix);
+}
+
+/*!
+ * Recursive descent from the base cells - adds cells whose centres are
+ * closer than r to ra, dec.
+ */
+static void
+healpix_query_cell (int nside, int ns, int64 pix, double ra, double dec,
+		    double r, struct healpix_cells *hc)
+{
+  double cra, cdec, dist, cr;
+  int64 i;
+
+  healpix_nest_pix2ang (ns, pix, &cra, &cdec);
+  dist = ang_distance (ra, dec, cra, cdec);
+
+  if (ns == nside)
+    {
+      if (dist <= r)
+	healpix_add_cell (hc, pix);
+      return;
+    }
+
+  cr = healpix_cell_radius (ns);
+  if (dist - cr > r)
+    return;
+
+  // whole cell is inside, add all subcells
+  if (dist + cr <= r)
+    {
+      int64 sub = (int64) (nside / ns) * (nside / ns);
+      for (i = pix * sub; i < (pix + 1) * sub; i++)
+	healpix_add_cell (hc, i);
+      return;
+    }
+
+  for (i = 0; i < 4; i++)
+    healpix_query_cell (nside, ns * 2, pix * 4 + i, ra, dec, r, hc);
+}
+
+static int
+check_nside (int nside)
+{
+  if (nside <= 0 || nside > (1 << 20) || (nside & (nside - 1)))
+    {
+      elog (ERROR, "HEALPix nside must be power of 2, %d given", nside);
+      return -1;
+    }
+  return 0;
+}
+
+/*!
+ * Returns HEALPix cell (nested scheme) containing given position.
+ *
+ * @pg_arg	nside [int4]
+ * @pg_arg	ra [float8]
+ * @pg_arg	dec [float8]
+ *
+ * @pg_ret [int8] cell index
+ */
+Datum
+healpix_ang2pix (PG_FUNCTION_ARGS)
+{
+  int nside;
+
+  if (PG_ARGISNULL (0) || PG_ARGISNULL (1) || PG_ARGISNULL (2))
+    PG_RETURN_NULL ();
+
+  nside = PG_GETARG_INT32 (0);
+  check_nside (nside);
+
+  if (isnan (PG_GETARG_FLOAT8 (1)) || isnan (PG_GETARG_FLOAT8 (2)))
+    PG_RETURN_NULL ();
+
+  PG_RETURN_INT64 (healpix_nest_ang2pix
+		   (nside, PG_GETARG_FLOAT8 (1), PG_GETARG_FLOAT8 (2)));
+}
+
+/*!
+ * Returns HEALPix cells (nested scheme) which might contain part of the
+ * image. Cells touching cap around image corners are returned. Images
+ * spanning 90 degrees or more from their centre return all cells.
+ *
+ * @pg_arg	wcs [kwcs2]
+ * @pg_arg	nside [int4]
+ *
+ * @pg_ret [int8[]] sorted cell indices, NULL if WCS is invalid
+ */
+Datum
+wcs2_footprint (PG_FUNCTION_ARGS)
+{
+  struct kwcs2 *arg;
+  int nside;
+  double cra, cdec, radius, ra, dec, d;
+  int i;
+  struct healpix_cells hc;
+
+  if (PG_ARGISNULL (0) || PG_ARGISNULL (1))
+    PG_RETURN_NULL ();
+
+  arg = PG_GETARG_KWCS2_P (0);
+  nside = PG_GETARG_INT32 (1);
+  check_nside (nside);
+
+  if (arg->naxis1 <= 0 || arg->naxis2 <= 0
+      || (arg->cd1_1 == 0 && arg->cd1_2 == 0)
+      || (arg->cd2_1 == 0 && arg->cd2_2 == 0))
+    PG_RETURN_NULL ();
+
+  RTS2pix2wcs (arg, arg->naxis1 / 2.0, arg->naxis2 / 2.0, &cra, &cdec);
+
+  radius = 0;
+  for (i = 0; i < 4; i++)
+    {
+      RTS2pix2wcs (arg, (i & 1) ? arg->naxis1 : 0, (i & 2) ? arg->naxis2 : 0,
+		   &ra, &dec);
+      d = ang_distance (cra, cdec, ra, dec);
+      if (d > radius)
+	radius = d;
+    }
+
+  if (isnan (radius))
+    PG_RETURN_NULL ();
+
+  // image covers (almost) hemisphere, all cells might contain its part
+  if (radius >= 90)
+    {
+      int64 npix = 12 * (int64) nside * nside;
+      if (npix * sizeof (Datum) > MaxAllocSize)
+	elog (ERROR, "image spans whole sky, nside %d is too large to list all cells", nside);
+      hc.num = npix;
+      hc.cells = (Datum *) palloc (hc.num * sizeof (Datum));
+      for (i = 0; i < hc.num; i++)
+	hc.cells[i] = Int64GetDatum ((int64) i);
+      PG_RETURN_ARRAYTYPE_P (construct_array
+			     (hc.cells, hc.num, INT8OID, sizeof (int64),
+			      FLOAT8PASSBYVAL, 'd'));
+    }
+
+  hc.num = 0;
+  hc.size = 32;
+  hc.cells = (Datum *) palloc (hc.size * sizeof (Datum));
+
+  // margin of cell radius - all cells intersecting the cap are included
+  for (i = 0; i < 12; i++)
+    healpix_query_cell (nside, 1, i, cra, cdec,
+			radius + healpix_cell_radius (nside), &hc);
+
+  PG_RETURN_ARRAYTYPE_P (construct_array
+			 (hc.cells, hc.num, INT8OID, sizeof (int64),
+			  FLOAT8PASSBYVAL, 'd'));
+}
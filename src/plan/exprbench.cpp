@@ -0,0 +1,199 @@
+/*
+ * Benchmark of expression evaluation.
+ * Copyright (C) 2016 Petr Kubanek <petr@kubanek.net>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "block.h"
+#include "bytecode.h"
+#include "expression.h"
+#include "utilsfunc.h"
+#include "rts2script/operands.h"
+
+#include <iostream>
+#include <iomanip>
+#include <math.h>
+
+#define BENCH_DEVICE   "C0"
+
+/**
+ * Compares evaluation of expression trees with evaluation of compiled
+ * bytecode. Values are provided by a fake connection to device C0, with
+ * double values temperature, humidity and count.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+class ExprBench:public rts2core::Block
+{
+	public:
+		ExprBench (int argc, char **argv);
+
+		virtual int run ();
+
+	protected:
+		virtual int processOption (int opt);
+		virtual int processArgs (const char *arg);
+
+		virtual rts2core::Connection *createClientConnection (rts2core::NetworkAddress * in_addr) { return NULL; }
+
+	private:
+		long iterations;
+		bool verbose;
+
+		std::vector <const char *> expressions;
+
+		void createValues ();
+
+		/**
+		 * Benchmark tree and compiled program, returns -1 if they do not give the same result.
+		 */
+		template <typename T> int bench (const char *name, T *tree, rts2expression::Bytecode &bc);
+};
+
+// adapters, so expressions and operands can be benchmarked with the same template
+static double evaluateTree (rts2expression::Expression *exp) { return exp->evaluate (); }
+static double evaluateTree (rts2operands::Operand *op) { return op->getDouble (); }
+
+ExprBench::ExprBench (int argc, char **argv):rts2core::Block (argc, argv), expressions ()
+{
+	iterations = 1000000;
+	verbose = false;
+
+	addOption ('n', NULL, 1, "number of evaluations (default 1000000)");
+	addOption ('v', NULL, 0, "print compiled programs");
+}
+
+int ExprBench::processOption (int opt)
+{
+	switch (opt)
+	{
+		case 'n':
+			iterations = atol (optarg);
+			break;
+		case 'v':
+			verbose = true;
+			break;
+		default:
+			return rts2core::Block::processOption (opt);
+	}
+	return 0;
+}
+
+int ExprBench::processArgs (const char *arg)
+{
+	expressions.push_back (arg);
+	return 0;
+}
+
+void ExprBench::createValues ()
+{
+	rts2core::Connection *conn = new rts2core::Connection (this);
+	conn->setName (-1, BENCH_DEVICE);
+	conn->metaInfo (RTS2_VALUE_DOUBLE, "temperature", "temperature");
+	conn->metaInfo (RTS2_VALUE_DOUBLE, "humidity", "humidity");
+	conn->metaInfo (RTS2_VALUE_DOUBLE, "count", "counter");
+	((rts2core::ValueDouble *) conn->getValue ("temperature"))->setValueDouble (-12.5);
+	((rts2core::ValueDouble *) conn->getValue ("humidity"))->setValueDouble (65);
+	((rts2core::ValueDouble *) conn->getValue ("count"))->setValueDouble (3);
+	getConnections ()->push_back (conn);
+}
+
+template <typename T> int ExprBench::bench (const char *name, T *tree, rts2expression::Bytecode &bc)
+{
+	double tv = evaluateTree (tree);
+	double bv = bc.evaluate ();
+
+	std::cout << name << std::endl << "  " << bc.size () << " instructions, result " << tv;
+	if (tv != bv && !(isnan (tv) && isnan (bv)))
+	{
+		std::cout << " - compiled result " << bv << " differs!" << std::endl;
+		return -1;
+	}
+	std::cout << std::endl;
+
+	if (verbose)
+		std::cout << bc;
+
+	// sum results, so the evaluation is not optimized out
+	double treeSum = 0;
+	double t = getNow ();
+	for (long i = 0; i < iterations; i++)
+		treeSum += evaluateTree (tree);
+	double treeTime = getNow () - t;
+
+	double bcSum = 0;
+	t = getNow ();
+	for (long i = 0; i < iterations; i++)
+		bcSum += bc.evaluate ();
+	double bcTime = getNow () - t;
+
+	std::cout << std::fixed << std::setprecision (0)
+		<< "  tree     " << std::setw (12) << iterations / treeTime << " evaluations/s" << std::endl
+		<< "  bytecode " << std::setw (12) << iterations / bcTime << " evaluations/s" << std::endl
+		<< std::setprecision (2) << "  speedup  " << std::setw (12) << treeTime / bcTime << std::endl;
+	std::cout.unsetf (std::ios_base::floatfield);
+	return (treeSum == bcSum || isnan (tv)) ? 0 : -1;
+}
+
+int ExprBench::run ()
+{
+	int ret = init ();
+	if (ret)
+		return ret;
+
+	createValues ();
+
+	if (expressions.empty ())
+	{
+		expressions.push_back ("C0.temperature < 10");
+		expressions.push_back ("C0.temperature > -20 and C0.humidity < 80 or C0.count == 3");
+		expressions.push_back ("1 < 2 and C0.humidity <= 90");
+	}
+
+	for (std::vector <const char *>::iterator iter = expressions.begin (); iter != expressions.end (); iter++)
+	{
+		try
+		{
+			rts2expression::Expression *exp = parseExpression (*iter);
+			rts2expression::Bytecode bc;
+			exp->compile (bc);
+			ret = bench (*iter, exp, bc);
+			delete exp;
+			if (ret)
+				return ret;
+		}
+		catch (rts2core::Error &er)
+		{
+			std::cerr << "cannot evaluate " << *iter << ": " << er << std::endl;
+			return -1;
+		}
+	}
+
+	// script condition, as parsed from while (C0.temperature < 10)
+	rts2operands::Operand *op = new rts2operands::OperandsLREquation (new rts2operands::SystemValue (this, BENCH_DEVICE, "temperature"), rts2operands::CMP_LESS, new rts2operands::Number (10));
+	rts2expression::Bytecode bc;
+	op->compile (bc);
+	ret = bench ("script condition C0.temperature < 10", op, bc);
+	delete op;
+
+	return ret;
+}
+
+int main (int argc, char **argv)
+{
+	ExprBench app (argc, argv);
+	return app.run ();
+}
@@ -24,6 +24,7 @@
 #include <algorithm>
 
 #include "askchoice.h"
+#include "skymerit.h"
 
 #include "rts2db/camlist.h"
 #include "rts2db/appdb.h"
@@ -41,10 +42,16 @@ namespace rts2plan
 class TargetEntry
 {
 	public:
-		TargetEntry (rts2db::Target *_target) { target = _target; bonus = NAN; }
+		TargetEntry (rts2db::Target *_target) { target = _target; bonus = NAN; merit = NAN; durationsKnown = false; lightTime = 0; scriptDuration = NAN; }
 		~TargetEntry () { delete target; }
 		rts2db::Target * target;
 		double bonus;
+		// bonus weighted information gain per second
+		double merit;
+		// script light time and duration, estimated once for the entry
+		bool durationsKnown;
+		double lightTime;
+		double scriptDuration;
 		void updateBonus () { bonus = target->getBonus (); }
 };
 
@@ -58,6 +65,16 @@ struct bonusSort: public std::binary_function <TargetEntry *, TargetEntry *, boo
 	bool operator () (TargetEntry * t1, TargetEntry * t2) { return t1->bonus > t2->bonus; }
 };
 
+/**
+ * For sorting TargetEntry by merit.
+ *
+ * @author Petr Kubanek <petr@kubanek.net>
+ */
+struct meritSort: public std::binary_function <TargetEntry *, TargetEntry *, bool>
+{
+	bool operator () (TargetEntry * t1, TargetEntry * t2) { return t1->merit > t2->merit; }
+};
+
 /**
  * Select next target. Traverse list of targets which are enabled and select
  * target with biggest priority.
@@ -161,6 +178,26 @@ class Selector
 
 		rts2db::CamList *cameraList;
 
+		// when not NULL, targets are ranked by merit
+		rts2core::SkyMerit *skyMerit;
+		// assumed target magnitude and exposure time, if script does not specify it
+		double meritMagnitude;
+		double meritExposure;
+
+		/**
+		 * Calculate merit of possible targets and sort them by merit.
+		 * Merit is information gain per second of the script light
+		 * time and overheads, weighted by the target bonus.
+		 */
+		void rankByMerit ();
+
+		/**
+		 * Estimate script light time and duration of the target entry.
+		 * Estimates are kept in the entry, so they are computed only
+		 * once while the target is considered for observing.
+		 */
+		void estimateDurations (TargetEntry *te);
+
 		// available filters for filter command on cameras
 		std::map <std::string, std::vector < std::string > > availableFilters;
 		std::map <std::string, std::string> filterAliases;
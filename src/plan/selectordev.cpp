@@ -182,6 +182,16 @@ class SelectorDev:public rts2db::DeviceDb
 
 		void afterQueueChange (rts2plan::ExecutorQueue *q);
 
+		/**
+		 * Start simulation of queues, cancel running simulation.
+		 */
+		void startSimulation (double _from, double to);
+
+		/**
+		 * Restart running simulation, as queues were changed.
+		 */
+		void restartSimulation ();
+
 		double simulStart;
 		// expected simulation duration
 		rts2core::ValueDouble *simulExpected;
@@ -392,7 +402,7 @@ int SelectorDev::init ()
 
 	// create and add simulation queue
 	createValue (simulTime, "simul_time", "simulation time", false);
-	simulQueue = new rts2plan::SimulQueue (this, "simul", &observer, &queues);
+	simulQueue = new rts2plan::SimulQueue (this, "simul", &observer, obs_altitude, &queues);
 
 	lastQueue->addSelVal ("simul");
 	current_queue->addSelVal ("simul");
@@ -420,28 +430,31 @@ int SelectorDev::idle ()
 {
 	if (getState () & SEL_SIMULATING)
 	{
-		double p = simulQueue->step ();
-		if (p == 2)
+		double p;
+		// collect steps computed by simulation thread
+		while (!isnan (p = simulQueue->step ()))
 		{
-			maskState (SEL_SIMULATING, SEL_IDLE, "simulation finished");
-			simulExpected->setValueDouble (getNow () - simulStart);
-			sendValueAll (simulExpected);
-
-			if (last_p < 0)
+			if (p == 2)
 			{
-				if (free_start->size () == 0)
+				maskState (SEL_SIMULATING, SEL_IDLE, "simulation finished");
+				simulExpected->setValueDouble (getNow () - simulStart);
+				sendValueAll (simulExpected);
+
+				if (last_p < 0)
 				{
-					free_start->addValue (from);
-					sendValueAll (free_start);
+					if (free_start->size () == 0)
+					{
+						free_start->addValue (from);
+						sendValueAll (free_start);
+					}
+					free_end->addValue (simulQueue->getSimulationTime ());
+					sendValueAll (free_end);
 				}
-				free_end->addValue (simulQueue->getSimulationTime ());
-				sendValueAll (free_end);
+
+				setTimeout (60 * USEC_SEC);
+				break;
 			}
 
-			setTimeout (60 * USEC_SEC);
-		}
-		else
-		{
 			if (last_p < 0 && p > 0)
 			{
 				free_end->addValue (simulTime->getValueDouble ());
@@ -454,10 +467,10 @@ int SelectorDev::idle ()
 			}
 
 			simulTime->setValueDouble (simulQueue->getSimulationTime ());
-			sendValueAll (simulTime);
 
 			last_p = p;
 		}
+		sendValueAll (simulTime);
 	}
 	return rts2db::DeviceDb::idle ();
 }
@@ -843,6 +856,7 @@ int SelectorDev::commandAuthorized (rts2core::Connection * conn)
 				return -2;
 			q->clearNext ();
 			logStream (MESSAGE_DEBUG) << "cleared queue " << name << sendLog;
+			restartSimulation ();
 			return 0;
 		}
 		else if (conn->isCommand ("queue_plan"))
@@ -852,6 +866,7 @@ int SelectorDev::commandAuthorized (rts2core::Connection * conn)
 				return -2;
 			queuePlan (q, t);
 			updateNext ();
+			restartSimulation ();
 			return 0;
 		}
 		else if (conn->isCommand ("queue_plan_id"))
@@ -869,6 +884,7 @@ int SelectorDev::commandAuthorized (rts2core::Connection * conn)
 				return -2;
 			}
 			updateNext ();
+			restartSimulation ();
 			return 0;
 		}
 		else if (conn->isCommand ("insert"))
@@ -990,19 +1006,7 @@ int SelectorDev::commandAuthorized (rts2core::Connection * conn)
 				from = simulStart;
 		}
 
-		last_p = 0;
-		free_start->clear ();
-		free_end->clear ();
-
-		sendValueAll (free_start);
-		sendValueAll (free_end);
-
-		simulTime->setValueDouble (from);
-		sendValueAll (simulTime);
-
-		simulQueue->start (from, to);
-		maskState (SEL_SIMULATING, SEL_SIMULATING, "starting simulation", simulStart, simulStart + simulExpected->getValueDouble ());
-		setTimeout (0);
+		startSimulation (from, to);
 		return 0;
 	}
 	else
@@ -1053,6 +1057,7 @@ void SelectorDev::fileModified (struct inotify_event *event)
 		iter->revalidateConstraints (event->wd);
 		updateNext ();
 	}
+	restartSimulation ();
 }
 #endif
 
@@ -1104,6 +1109,36 @@ void SelectorDev::afterQueueChange (rts2plan::ExecutorQueue *q)
 		q->sortQueue (now);
 		q->updateVals ();
 	}
+	restartSimulation ();
+}
+
+void SelectorDev::startSimulation (double _from, double to)
+{
+	from = _from;
+
+	last_p = 0;
+	free_start->clear ();
+	free_end->clear ();
+
+	sendValueAll (free_start);
+	sendValueAll (free_end);
+
+	simulTime->setValueDouble (from);
+	sendValueAll (simulTime);
+
+	simulQueue->start (from, to);
+	maskState (SEL_SIMULATING, SEL_SIMULATING, "starting simulation", simulStart, simulStart + simulExpected->getValueDouble ());
+	// simulation runs in its own thread, idle collects its results
+	setTimeout (USEC_SEC / 10);
+}
+
+void SelectorDev::restartSimulation ()
+{
+	if (!(getState () & SEL_SIMULATING))
+		return;
+	logStream (MESSAGE_DEBUG) << "queues changed, restarting simulation" << sendLog;
+	simulStart = getNow ();
+	startSimulation (simulQueue->getFrom (), simulQueue->getTo ());
 }
 
 void SelectorDev::updateFlats ()
@@ -27,13 +27,18 @@ namespace rts2sensord
 /**
  * Driver for Brooks 356 Micor-Ion Plus Module.
  *
+ * Pressure is read with asynchronous transaction, so slow or missing
+ * response does not block the daemon.
+ *
  * @author Petr Kubanek <petr@kubanek.net>
  */
-class MicroPirani925: public Sensor
+class MicroPirani925: public Sensor, rts2core::TransactionCallback
 {
 	public:
 		MicroPirani925 (int argc, char **argv);
 
+		virtual void transactionFinished (rts2core::Transaction *t);
+
 	protected:
 		virtual int processOption (int _opt);
 		virtual int initHardware ();
@@ -86,21 +91,36 @@ int MicroPirani925::initHardware ()
 
 int MicroPirani925::info ()
 {
-	int ret;
-	char buf[50];
-	ret = microConn->writeRead ("@253PR1?;FF", 11, buf, 50, ";FF");
-	if (ret < 0)
-		return ret;
-	std::istringstream is (buf + 7);
+	// previous request is still waiting for the reply
+	if (microConn->transactionsPending () == 0)
+	{
+		rts2core::Transaction *t = new rts2core::Transaction ("@253PR1?;FF", this, 2);
+		t->setEndString (";FF");
+		t->setRetries (2);
+		microConn->queueTransaction (t);
+	}
+	return Sensor::info ();
+}
+
+void MicroPirani925::transactionFinished (rts2core::Transaction *t)
+{
+	if (!t->isDone ())
+	{
+		logStream (MESSAGE_ERROR) << "cannot read pressure, transaction state " << t->getState () << sendLog;
+		return;
+	}
+	// reply is @253ACK<pressure>;FF
+	const std::string &reply = t->getResponse ();
+	std::istringstream is (reply.length () > 7 ? reply.substr (7) : std::string ());
 	double v;
 	is >> v;
 	if (is.fail ())
 	{
-		logStream (MESSAGE_ERROR) << "failed to parse buffer " << buf << sendLog;
-		return -1;
+		logStream (MESSAGE_ERROR) << "failed to parse reply " << reply << sendLog;
+		return;
 	}
 	pressure->setValueDouble (v);
-	return Sensor::info ();
+	sendValueAll (pressure);
 }
 
 MicroPirani925::MicroPirani925 (int argc, char **argv): Sensor (argc, argv)
@@ -0,0 +1,61 @@
+-- Benchmark of position queries on image footprints.
+--
+-- Populates synthetic archive of images with astrometry (uniformly
+-- distributed over the sky, 1 deg wide fields), and compares sequential
+-- isinwcs2 scan with query through HEALPix footprint index, as used by
+-- ImageSetPosition. Run on database with RTS2 schema (wcs2 type and
+-- footprint functions), number of images must be specified:
+--
+--   psql -v nimages=1000000 stars < bench_footprint.sql
+--
+-- Tables are temporary, archive is not touched.
+
+\set ON_ERROR_STOP 1
+\timing on
+
+CREATE TEMPORARY TABLE bench_images (
+	img_id		integer PRIMARY KEY,
+	astrometry	wcs2,
+	astrometry_cells int8[]
+);
+
+-- 1000x1000 pixels, 3.6 arcsec/pixel, random rotation
+INSERT INTO bench_images (img_id, astrometry)
+	SELECT i, ('NAXIS1 1000 NAXIS2 1000 CRPIX1 500 CRPIX2 500'
+		|| ' CRVAL1 ' || ra || ' CRVAL2 ' || dec
+		|| ' CD1_1 ' || -0.001 * cos (rot) || ' CD1_2 ' || 0.001 * sin (rot)
+		|| ' CD2_1 ' || 0.001 * sin (rot) || ' CD2_2 ' || 0.001 * cos (rot)
+		|| ' EQUINOX 2000')::wcs2
+	FROM (SELECT i, random () * 360 AS ra, degrees (asin (2 * random () - 1)) AS dec, random () * 2 * pi () AS rot
+		FROM generate_series (1, :nimages) AS i) AS s;
+
+UPDATE bench_images SET astrometry_cells = wcs2_footprint (astrometry, 64);
+
+CREATE INDEX bench_images_cells ON bench_images USING gin (astrometry_cells);
+
+ANALYZE bench_images;
+
+SELECT count (*) AS images, avg (array_length (astrometry_cells, 1)) AS mean_cells FROM bench_images;
+
+-- query points - centres of few images, so queries return something
+CREATE TEMPORARY TABLE bench_points AS
+	SELECT img_id, img_wcs2_crval1 (astrometry) AS ra, img_wcs2_crval2 (astrometry) AS dec
+	FROM bench_images ORDER BY random () LIMIT 100;
+
+-- sequential scan, current behaviour without footprints
+EXPLAIN ANALYZE SELECT count (*) FROM bench_points p, bench_images i
+	WHERE isinwcs2 (p.ra, p.dec, i.astrometry);
+
+-- index scan with exact recheck
+SET enable_seqscan = off;
+
+EXPLAIN ANALYZE SELECT count (*) FROM bench_points p, bench_images i
+	WHERE i.astrometry_cells @> ARRAY[healpix_ang2pix (64, p.ra, p.dec)]
+	AND isinwcs2 (p.ra, p.dec, i.astrometry);
+
+RESET enable_seqscan;
+
+-- both queries must return the same images
+SELECT count (*) AS missed FROM bench_points p, bench_images i
+	WHERE isinwcs2 (p.ra, p.dec, i.astrometry)
+	AND NOT i.astrometry_cells @> ARRAY[healpix_ang2pix (64, p.ra, p.dec)];
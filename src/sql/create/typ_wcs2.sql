@@ -50,3 +50,10 @@ CREATE OR REPLACE FUNCTION img_wcs2_cd2_2 (wcs2)
 
 CREATE OR REPLACE FUNCTION img_wcs2_equinox (wcs2)
   RETURNS float8 AS 'pg_wcs2.so', 'img_wcs2_equinox' LANGUAGE 'c';
+
+-- HEALPix (nested scheme) footprints, used to index images by position
+CREATE OR REPLACE FUNCTION healpix_ang2pix (int4, float8, float8)
+  RETURNS int8 AS 'pg_wcs2.so', 'healpix_ang2pix' LANGUAGE 'c' IMMUTABLE STRICT;
+
+CREATE OR REPLACE FUNCTION wcs2_footprint (wcs2, int4)
+  RETURNS int8[] AS 'pg_wcs2.so', 'wcs2_footprint' LANGUAGE 'c' IMMUTABLE STRICT;
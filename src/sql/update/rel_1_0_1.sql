@@ -0,0 +1,28 @@
+-- HEALPix footprints of images with astrometry. Cells are calculated for
+-- nside 64 (cells about 0.9 deg wide), which must match
+-- IMAGE_FOOTPRINT_NSIDE in lib/rts2db/imageset.ec.
+CREATE OR REPLACE FUNCTION healpix_ang2pix (int4, float8, float8)
+  RETURNS int8 AS 'pg_wcs2.so', 'healpix_ang2pix' LANGUAGE 'c' IMMUTABLE STRICT;
+
+CREATE OR REPLACE FUNCTION wcs2_footprint (wcs2, int4)
+  RETURNS int8[] AS 'pg_wcs2.so', 'wcs2_footprint' LANGUAGE 'c' IMMUTABLE STRICT;
+
+ALTER TABLE images ADD COLUMN astrometry_cells int8[];
+
+CREATE OR REPLACE FUNCTION images_astrometry_cells () RETURNS trigger AS '
+BEGIN
+	IF NEW.astrometry IS NULL THEN
+		NEW.astrometry_cells := NULL;
+	ELSE
+		NEW.astrometry_cells := wcs2_footprint (NEW.astrometry, 64);
+	END IF;
+	RETURN NEW;
+END;
+' LANGUAGE 'plpgsql';
+
+CREATE TRIGGER images_astrometry_cells BEFORE INSERT OR UPDATE OF astrometry ON images
+	FOR EACH ROW EXECUTE PROCEDURE images_astrometry_cells ();
+
+UPDATE images SET astrometry_cells = wcs2_footprint (astrometry, 64) WHERE astrometry IS NOT NULL;
+
+CREATE INDEX images_astrometry_cells ON images USING gin (astrometry_cells);